@@ -0,0 +1,94 @@
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Crypto.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/Measure.h"
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+#ifdef UAPP_CREATE_CERTIFICATE
+
+namespace {
+
+crypto::CreateCertificateResult createCertificate(std::string_view name, std::string_view uri) {
+    return crypto::createCertificate(
+        {String{"C=DE"}, String{"O=open62541pp"}, String{std::string("CN=").append(name)}},
+        {String{"DNS:localhost"}, String{std::string("URI:").append(uri)}}
+    );
+}
+
+}  // namespace
+
+/**
+ * Read arrays of doubles over a loopback connection with different security modes.
+ * Arguments: number of array elements, message security mode, chunk size in KiB (0 = default).
+ * The security policy is Basic256Sha256 for Sign and SignAndEncrypt.
+ */
+static void readValueSecureChannel(benchmark::State& state) {
+    static const auto certServer = createCertificate("Server", "urn:open62541.server.application");
+    static const auto certClient = createCertificate("Client", "urn:unconfigured:application");
+    const auto size = static_cast<size_t>(state.range(0));
+    const auto mode = static_cast<MessageSecurityMode>(state.range(1));
+    SecureChannelOptions options;
+    if (state.range(2) > 0) {
+        options.chunkSize = static_cast<uint32_t>(state.range(2) * 1024);
+    }
+
+    Server server(
+        4840, certServer.certificate, certServer.privateKey, {certClient.certificate}, {}, {}
+    );
+    server.setSecureChannelOptions(options);
+    const auto id = services::addVariable(
+        server,
+        ObjectId::ObjectsFolder,
+        {1, "variable"},
+        "variable",
+        VariableAttributes{}
+            .setValueRank(ValueRank::OneDimension)
+            .setValueArray(std::vector<double>(size, 1.0))
+    );
+    ServerRunner runner(server);
+
+    Client client(certClient.certificate, certClient.privateKey, {certServer.certificate}, {});
+    client.setSecurityMode(mode);
+    client.setSecureChannelOptions(options);
+    if (mode != MessageSecurityMode::None) {
+        auto& policy = UA_Client_getConfig(client.handle())->securityPolicyUri;
+        UA_String_clear(&policy);
+        policy = UA_STRING_ALLOC("http://opcfoundation.org/UA/SecurityPolicy#Basic256Sha256");
+    }
+    client.connect("opc.tcp://localhost:4840");
+
+    bench::measure(state, [&] { benchmark::DoNotOptimize(services::readValue(client, id)); });
+    state.SetBytesProcessed(
+        static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(size * sizeof(double))
+    );
+}
+
+static void secureChannelArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"size", "mode", "chunk_kib"});
+    for (const int64_t size : {1'000, 100'000, 1'000'000}) {
+        for (const int64_t mode : {1, 2, 3}) {  // None, Sign, SignAndEncrypt
+            b->Args({size, mode, 0});
+            b->Args({size, mode, 1024});
+        }
+    }
+}
+
+BENCHMARK(readValueSecureChannel)->Apply(secureChannelArguments)->UseRealTime();
+
+#endif
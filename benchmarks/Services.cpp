@@ -0,0 +1,235 @@
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/services/services.h"
+#include "open62541pp/types/ExtensionObject.h"
+
+#include "helper/Measure.h"
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+namespace {
+
+/* ----------------------------------------- Environment ---------------------------------------- */
+
+/// Server-local environment: no background thread, services are called directly on the server.
+template <typename T>
+class Environment {
+public:
+    void start() {}
+
+    Server& instance() noexcept {
+        return server;
+    }
+
+    Server server;
+};
+
+/// Loopback environment: server runs in a background thread, services are called by the client.
+template <>
+class Environment<Client> {
+public:
+    void start() {
+        runner = std::make_unique<ServerRunner>(server);
+        client.connect("opc.tcp://localhost:4840");
+    }
+
+    Client& instance() noexcept {
+        return client;
+    }
+
+    Server server;
+    std::unique_ptr<ServerRunner> runner;
+    Client client;
+};
+
+/// Create a Variant with a scalar double (size = 0) or an array of `size` doubles.
+Variant createPayload(size_t size) {
+    if (size == 0) {
+        return Variant::fromScalar(1.0);
+    }
+    return Variant::fromArray(std::vector<double>(size, 1.0));
+}
+
+/// Create a Variant with an array of `size` ExtensionObjects with nested structures.
+Variant createPayloadExtensionObjects(size_t size) {
+    const BrowsePath browsePath(
+        ObjectId::RootFolder,
+        {
+            {ReferenceTypeId::HasComponent, false, true, QualifiedName(0, "Objects")},
+            {ReferenceTypeId::HasComponent, false, true, QualifiedName(0, "Server")},
+        }
+    );
+    std::vector<ExtensionObject> objects(size);
+    for (auto& object : objects) {
+        object = ExtensionObject::fromDecodedCopy(browsePath);
+    }
+    return Variant::fromArray(objects);
+}
+
+NodeId addVariable(Server& server, const Variant& value) {
+    return services::addVariable(
+        server,
+        ObjectId::ObjectsFolder,
+        {1, "variable"},
+        "variable",
+        VariableAttributes{}
+            .setAccessLevel(UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE)
+            .setValueRank(ValueRank::Any)
+            .setValue(value)
+    );
+}
+
+}  // namespace
+
+/* ------------------------------------------ Attribute ----------------------------------------- */
+
+template <typename T>
+static void readValue(benchmark::State& state) {
+    Environment<T> env;
+    const auto id = addVariable(env.server, createPayload(state.range(0)));
+    env.start();
+    bench::measure(state, [&] {
+        benchmark::DoNotOptimize(services::readValue(env.instance(), id));
+    });
+}
+
+template <typename T>
+static void writeValue(benchmark::State& state) {
+    Environment<T> env;
+    const auto value = createPayload(state.range(0));
+    const auto id = addVariable(env.server, value);
+    env.start();
+    bench::measure(state, [&] { services::writeValue(env.instance(), id, value); });
+}
+
+template <typename T>
+static void writeValueExtensionObjects(benchmark::State& state) {
+    Environment<T> env;
+    const auto value = createPayloadExtensionObjects(state.range(0));
+    const auto id = addVariable(env.server, value);
+    env.start();
+    bench::measure(state, [&] { services::writeValue(env.instance(), id, value); });
+}
+
+BENCHMARK_TEMPLATE(readValue, Server)->Apply(bench::payloadSizes);
+BENCHMARK_TEMPLATE(readValue, Client)->Apply(bench::payloadSizes)->UseRealTime();
+BENCHMARK_TEMPLATE(writeValue, Server)->Apply(bench::payloadSizes);
+BENCHMARK_TEMPLATE(writeValue, Client)->Apply(bench::payloadSizes)->UseRealTime();
+BENCHMARK_TEMPLATE(writeValueExtensionObjects, Server)->Arg(1)->Arg(1'000);
+BENCHMARK_TEMPLATE(writeValueExtensionObjects, Client)->Arg(1)->Arg(1'000)->UseRealTime();
+
+/* -------------------------------------------- View -------------------------------------------- */
+
+template <typename T>
+static void browseAll(benchmark::State& state) {
+    Environment<T> env;
+    env.start();
+    const BrowseDescription bd(ObjectId::Server, BrowseDirection::Both);
+    bench::measure(state, [&] {
+        benchmark::DoNotOptimize(services::browseAll(env.instance(), bd));
+    });
+}
+
+BENCHMARK_TEMPLATE(browseAll, Server);
+BENCHMARK_TEMPLATE(browseAll, Client)->UseRealTime();
+
+/* ------------------------------------------- Method ------------------------------------------- */
+
+#ifdef UA_ENABLE_METHODCALLS
+template <typename T>
+static void call(benchmark::State& state) {
+    Environment<T> env;
+    const NodeId methodId{1, "method"};
+    services::addMethod(
+        env.server,
+        ObjectId::ObjectsFolder,
+        methodId,
+        "method",
+        [](Span<const Variant> inputs, Span<Variant> outputs) { outputs[0] = inputs[0]; },
+        {Argument("input", {}, DataTypeId::BaseDataType, ValueRank::Any)},
+        {Argument("output", {}, DataTypeId::BaseDataType, ValueRank::Any)}
+    );
+    env.start();
+    const std::vector<Variant> inputs{createPayload(state.range(0))};
+    bench::measure(state, [&] {
+        benchmark::DoNotOptimize(
+            services::call(env.instance(), ObjectId::ObjectsFolder, methodId, inputs)
+        );
+    });
+}
+
+BENCHMARK_TEMPLATE(call, Server)->Apply(bench::payloadSizes);
+BENCHMARK_TEMPLATE(call, Client)->Apply(bench::payloadSizes)->UseRealTime();
+#endif
+
+/* ---------------------------------------- Subscription ---------------------------------------- */
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/// Latency from a value write until the data change notification is received (server-local).
+static void subscribeDataChangeServer(benchmark::State& state) {
+    Server server;
+    const auto id = addVariable(server, createPayload(state.range(0)));
+    std::atomic<size_t> notifications{0};
+    services::MonitoringParameters parameters;
+    parameters.samplingInterval = 0.0;
+    [[maybe_unused]] const auto monId = services::createMonitoredItemDataChange(
+        server,
+        {id, AttributeId::Value},
+        MonitoringMode::Reporting,
+        parameters,
+        [&](uint32_t, uint32_t, const DataValue&) { notifications++; }
+    );
+    server.runIterate();
+    double value = 0.0;
+    bench::measure(state, [&] {
+        const size_t expected = notifications + 1;
+        services::writeValue(server, id, Variant::fromScalar(++value));
+        while (notifications < expected) {
+            server.runIterate();
+        }
+    });
+}
+
+/// Latency from a value write until the data change notification is received (client).
+static void subscribeDataChangeClient(benchmark::State& state) {
+    Environment<Client> env;
+    const auto id = addVariable(env.server, createPayload(state.range(0)));
+    env.start();
+    auto& client = env.client;
+    services::SubscriptionParameters subscriptionParameters;
+    subscriptionParameters.publishingInterval = 0.0;  // revised to server minimum
+    const auto subId = services::createSubscription(client, subscriptionParameters);
+    std::atomic<size_t> notifications{0};
+    services::MonitoringParameters monitoringParameters;
+    monitoringParameters.samplingInterval = 0.0;
+    [[maybe_unused]] const auto monId = services::createMonitoredItemDataChange(
+        client,
+        subId,
+        {id, AttributeId::Value},
+        MonitoringMode::Reporting,
+        monitoringParameters,
+        [&](uint32_t, uint32_t, const DataValue&) { notifications++; }
+    );
+    double value = 0.0;
+    bench::measure(state, [&] {
+        const size_t expected = notifications + 1;
+        services::writeValue(client, id, Variant::fromScalar(++value));
+        while (notifications < expected) {
+            client.runIterate(1);
+        }
+    });
+}
+
+BENCHMARK(subscribeDataChangeServer)->Arg(0)->Arg(1'000);
+BENCHMARK(subscribeDataChangeClient)->Arg(0)->Arg(1'000)->UseRealTime();
+#endif
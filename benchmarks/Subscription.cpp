@@ -0,0 +1,198 @@
+#include <algorithm>  // sort
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <ctime>  // clock
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/ValuePublisher.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "helper/Measure.h"
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+/// Duration of a benchmark iteration (measurement window).
+constexpr std::chrono::milliseconds window{1000};
+/// Time to create the monitored items and reach a steady state before the measurement.
+constexpr std::chrono::milliseconds warmup{500};
+
+int64_t nowNanoseconds() noexcept {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+        .count();
+}
+
+struct SubscriberClient {
+    Client client;
+    std::optional<Subscription<Client>> subscription;  // created after connect
+    std::vector<double> latencies;  // written by the client's event loop thread only
+};
+
+}  // namespace
+
+/**
+ * End-to-end latency and throughput of data change notifications.
+ *
+ * A producer thread publishes the current time (steady clock) to all variables with a fixed rate
+ * (ValuePublisher). Each client monitors all variables, the latency is measured from the publish
+ * call to the invocation of the data change callback and includes sampling, queueing, publishing,
+ * encoding/decoding and the client's notification dispatch.
+ *
+ * Arguments: number of variables, number of clients, update rate per variable in Hz, sampling
+ * interval in ms, queue size, publishing interval in ms.
+ *
+ * Counters:
+ * - `notifications/s`: Received notifications per second (all clients)
+ * - `p50_us`, `p99_us`, `p999_us`, `max_us`: Latency percentiles in microseconds
+ * - `cpu_us/notification`: Process CPU time (server, producer and clients) per notification
+ */
+static void subscriptionLatency(benchmark::State& state) {
+    const auto variableCount = static_cast<size_t>(state.range(0));
+    const auto clientCount = static_cast<size_t>(state.range(1));
+    const auto updateRate = static_cast<double>(state.range(2));
+    const auto samplingInterval = static_cast<double>(state.range(3));
+    const auto queueSize = static_cast<uint32_t>(state.range(4));
+    const auto publishingInterval = static_cast<double>(state.range(5));
+
+    Server server;
+    auto* config = UA_Server_getConfig(server.handle());
+    config->samplingIntervalLimits.min = 0.0;  // allow fastest practical sampling
+    config->publishingIntervalLimits.min = 1.0;
+    std::vector<NodeId> ids;
+    for (size_t i = 0; i < variableCount; ++i) {
+        ids.push_back(services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            {1, static_cast<uint32_t>(1000 + i)},
+            "variable",
+            VariableAttributes{}.setDataType(DataTypeId::Int64).setValueScalar(int64_t{0})
+        ));
+    }
+    auto publisher = server.createValuePublisher<int64_t>(ids);
+    ServerRunner runner(server);
+
+    std::atomic<bool> recording{false};
+    std::vector<std::unique_ptr<SubscriberClient>> clients;
+    for (size_t i = 0; i < clientCount; ++i) {
+        auto subscriber = std::make_unique<SubscriberClient>();
+        subscriber->client.connect("opc.tcp://localhost:4840");
+        SubscriptionParameters subscriptionParameters;
+        subscriptionParameters.publishingInterval = publishingInterval;
+        subscriber->subscription = subscriber->client.createSubscription(subscriptionParameters);
+        subscriber->latencies.reserve(1'000'000);
+        MonitoringParameters parameters;
+        parameters.samplingInterval = samplingInterval;
+        parameters.queueSize = queueSize;
+        parameters.timestamps = TimestampsToReturn::Neither;
+        subscriber->subscription->subscribeDataChange(
+            ids,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            parameters,
+            [&recording, &latencies = subscriber->latencies](const auto&, const DataValue& dv) {
+                const auto now = nowNanoseconds();
+                if (!recording.load(std::memory_order_relaxed) || !dv.getValue().isScalar()) {
+                    return;
+                }
+                const auto sent = dv.getValue().getScalar<int64_t>();
+                if (sent > 0) {
+                    latencies.push_back(static_cast<double>(now - sent) / 1000.0);
+                }
+            }
+        );
+        subscriber->client.runInBackground(1);
+        clients.push_back(std::move(subscriber));
+    }
+
+    std::atomic<bool> producing{true};
+    std::thread producer([&] {
+        const auto period = std::chrono::duration_cast<Clock::duration>(
+            std::chrono::duration<double>(1.0 / updateRate)
+        );
+        auto next = Clock::now();
+        while (producing.load(std::memory_order_relaxed)) {
+            const auto timestamp = DateTime::now();
+            for (size_t i = 0; i < publisher.size(); ++i) {
+                publisher.publish(i, nowNanoseconds(), timestamp);
+            }
+            next += period;
+            std::this_thread::sleep_until(next);
+        }
+    });
+
+    std::this_thread::sleep_for(warmup);
+    recording = true;
+    const auto cpuStart = std::clock();
+    const auto start = Clock::now();
+    for (auto _ : state) {
+        std::this_thread::sleep_for(window);
+    }
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    recording = false;
+    const auto cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+
+    producing = false;
+    producer.join();
+    std::vector<double> latencies;
+    for (auto& subscriber : clients) {
+        subscriber->client.stop();  // latencies are stable after the event loop stopped
+        latencies.insert(
+            latencies.end(), subscriber->latencies.begin(), subscriber->latencies.end()
+        );
+    }
+    std::sort(latencies.begin(), latencies.end());
+
+    const auto notifications = static_cast<double>(latencies.size());
+    state.counters["notifications/s"] = notifications / elapsed;
+    state.counters["p50_us"] = bench::percentile(latencies, 0.50);
+    state.counters["p99_us"] = bench::percentile(latencies, 0.99);
+    state.counters["p999_us"] = bench::percentile(latencies, 0.999);
+    state.counters["max_us"] = latencies.empty() ? 0.0 : latencies.back();
+    state.counters["cpu_us/notification"] =
+        notifications > 0 ? cpuSeconds * 1e6 / notifications : 0.0;
+}
+
+static void subscriptionArguments(benchmark::internal::Benchmark* b) {
+    b->ArgNames({"vars", "clients", "rate_hz", "sampling_ms", "queue", "publishing_ms"});
+    // sampling interval and publishing interval
+    for (const int64_t sampling : {0, 10, 100}) {
+        for (const int64_t publishing : {10, 100}) {
+            b->Args({100, 1, 100, sampling, 1, publishing});
+        }
+    }
+    // queue size (bursts within a publishing interval)
+    for (const int64_t queue : {1, 10, 100}) {
+        b->Args({100, 1, 1000, 0, queue, 100});
+    }
+    // scaling of variables and clients
+    for (const int64_t vars : {10, 1'000, 10'000}) {
+        for (const int64_t clients : {1, 10}) {
+            b->Args({vars, clients, 10, 0, 1, 100});
+        }
+    }
+}
+
+BENCHMARK(subscriptionLatency)
+    ->Apply(subscriptionArguments)
+    ->Iterations(3)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+#endif
@@ -0,0 +1,32 @@
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Variant.h"
+
+#include "helper/Measure.h"
+
+using namespace opcua;
+
+static void variantSetArrayCopy(benchmark::State& state) {
+    const std::vector<double> array(state.range(0), 1.0);
+    Variant var;
+    bench::measure(state, [&] { var.setArrayCopy(array); });
+}
+
+static void variantGetArrayCopy(benchmark::State& state) {
+    const auto var = Variant::fromArray(std::vector<double>(state.range(0), 1.0));
+    bench::measure(state, [&] { benchmark::DoNotOptimize(var.getArrayCopy<double>()); });
+}
+
+static void variantSetArrayCopyString(benchmark::State& state) {
+    const std::vector<String> array(state.range(0), String("value"));
+    Variant var;
+    bench::measure(state, [&] { var.setArrayCopy(array); });
+}
+
+BENCHMARK(variantSetArrayCopy)->Arg(1)->Arg(1'000)->Arg(100'000);
+BENCHMARK(variantGetArrayCopy)->Arg(1)->Arg(1'000)->Arg(100'000);
+BENCHMARK(variantSetArrayCopyString)->Arg(1)->Arg(1'000)->Arg(100'000);
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include "open62541pp/AllocStats.h"
+
+namespace bench {
+
+/// Number of calls to the global `operator new` (defined in main.cpp).
+extern std::atomic<size_t> allocationCount;
+
+/// Get the `p`-th percentile (0...1) of sorted values.
+inline double percentile(const std::vector<double>& sorted, double p) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    const auto index = static_cast<size_t>(std::ceil(p * static_cast<double>(sorted.size()))) - 1;
+    return sorted[std::min(index, sorted.size() - 1)];
+}
+
+/**
+ * Run and measure an operation for every benchmark iteration.
+ *
+ * Reports the following counters:
+ * - `ops/s`: Operations per second
+ * - `p50_us`, `p99_us`: Latency percentiles in microseconds
+ * - `allocs/op`: Allocations per operation (C++ heap only)
+ *
+ * With `UAPP_ENABLE_ALLOC_STATS`, the counts of open62541 of the calling thread are reported too:
+ * - `ua_allocs/op`: open62541 allocations per operation
+ * - `ua_bytes/op`: Allocated bytes of open62541 per operation
+ * - `copies/op`: Deep copies of wrapper types per operation
+ */
+template <typename F>
+void measure(benchmark::State& state, F&& operation) {
+    using Clock = std::chrono::steady_clock;
+    std::vector<double> latencies;
+    latencies.reserve(static_cast<size_t>(state.max_iterations));  // no allocations in the loop
+    const size_t allocationsBefore = allocationCount.load(std::memory_order_relaxed);
+#ifdef UAPP_ENABLE_ALLOC_STATS
+    const opcua::AllocStatsScope allocStats;
+#endif
+    for (auto _ : state) {
+        const auto start = Clock::now();
+        operation();
+        const auto stop = Clock::now();
+        latencies.push_back(std::chrono::duration<double, std::micro>(stop - start).count());
+    }
+    const size_t allocations = allocationCount.load(std::memory_order_relaxed) - allocationsBefore;
+    std::sort(latencies.begin(), latencies.end());
+    const auto iterations = static_cast<double>(state.iterations());
+    state.counters["ops/s"] = benchmark::Counter(iterations, benchmark::Counter::kIsRate);
+    state.counters["p50_us"] = percentile(latencies, 0.50);
+    state.counters["p99_us"] = percentile(latencies, 0.99);
+    state.counters["allocs/op"] = benchmark::Counter(
+        static_cast<double>(allocations), benchmark::Counter::kAvgIterations
+    );
+#ifdef UAPP_ENABLE_ALLOC_STATS
+    const auto stats = allocStats.get();
+    state.counters["ua_allocs/op"] = benchmark::Counter(
+        static_cast<double>(stats.allocations + stats.reallocations),
+        benchmark::Counter::kAvgIterations
+    );
+    state.counters["ua_bytes/op"] = benchmark::Counter(
+        static_cast<double>(stats.allocatedBytes), benchmark::Counter::kAvgIterations
+    );
+    state.counters["copies/op"] = benchmark::Counter(
+        static_cast<double>(stats.deepCopies), benchmark::Counter::kAvgIterations
+    );
+#endif
+}
+
+/// Payload sizes: 0 (scalar), 1k and 100k array elements.
+inline void payloadSizes(benchmark::internal::Benchmark* b) {
+    b->Arg(0)->Arg(1'000)->Arg(100'000);
+}
+
+}  // namespace bench
@@ -0,0 +1,32 @@
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+#include <benchmark/benchmark.h>
+
+#include "helper/Measure.h"
+
+namespace bench {
+
+std::atomic<size_t> allocationCount{0};
+
+}  // namespace bench
+
+// count allocations of the C++ layer, allocations of open62541 (UA_malloc) are not tracked
+void* operator new(size_t size) {
+    bench::allocationCount.fetch_add(1, std::memory_order_relaxed);
+    if (void* ptr = std::malloc(size == 0 ? 1 : size)) {  // NOLINT
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept {
+    std::free(ptr);  // NOLINT
+}
+
+void operator delete(void* ptr, size_t /* size */) noexcept {
+    std::free(ptr);  // NOLINT
+}
+
+BENCHMARK_MAIN();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <functional>
 #include <string>
 #include <vector>
 
@@ -22,6 +23,27 @@ struct Login {
     std::string password;
 };
 
+/**
+ * Per-session rate limit of node operations.
+ *
+ * Each session gets a token bucket, that is refilled with `operationsPerSecond` multiplied by the
+ * weight of the session. Reading/writing a value (AccessControlBase::getUserAccessLevel) and
+ * browsing a node (AccessControlBase::allowBrowseNode) consume one token each. Operations of a
+ * session with an empty bucket are denied (`BadUserAccessDenied`) until the bucket is refilled, so
+ * heavy readers are throttled before they starve other sessions.
+ *
+ * @see Server::setRequestPolicy
+ */
+struct RequestPolicy {
+    /// Refill rate of the token bucket, `0` disables the rate limit.
+    double operationsPerSecond = 0;
+    /// Capacity of the token bucket (burst size), `0` allows a burst of one second.
+    double burst = 0;
+    /// Optional weight of a session, scales the rate and burst (default: `1`).
+    /// Evaluated once per session activation, e.g. to prioritize HMI sessions over data loggers.
+    std::function<double(Session& session)> weight;
+};
+
 /**
  * Access control base class.
  *
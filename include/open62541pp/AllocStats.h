@@ -0,0 +1,87 @@
+#pragma once
+
+#include <cstdint>
+
+#include "open62541pp/Config.h"
+
+#ifdef UAPP_ENABLE_ALLOC_STATS
+
+namespace opcua {
+
+/**
+ * Allocation and copy counters of open62541 and the wrapper types.
+ * @see getThreadAllocStats, getAllocStats, AllocStatsScope
+ */
+struct AllocStats {
+    /// Number of allocations (`UA_malloc`, `UA_calloc`, `UA_realloc` with `nullptr`).
+    uint64_t allocations{0};
+    /// Number of reallocations of existing memory (`UA_realloc`).
+    uint64_t reallocations{0};
+    /// Number of deallocations (`UA_free`, `nullptr` excluded).
+    uint64_t deallocations{0};
+    /// Requested bytes of allocations and reallocations.
+    uint64_t allocatedBytes{0};
+    /// Number of deep copies of wrapper types and variants (`UA_copy`, `UA_Variant_set*Copy`).
+    uint64_t deepCopies{0};
+};
+
+/// Difference of two samples, e.g. to get the counts of an operation.
+AllocStats operator-(const AllocStats& lhs, const AllocStats& rhs) noexcept;
+
+/**
+ * Get the counters of the current thread.
+ * Cheap (no locks), use it to sample the counts of operations within the calling thread.
+ */
+AllocStats getThreadAllocStats() noexcept;
+
+/**
+ * Get the counters of all threads, including threads that have exited.
+ * Takes a lock to collect the counters of the running threads, use it for periodic diagnostics.
+ */
+AllocStats getAllocStats() noexcept;
+
+/**
+ * Count the allocations of the calling thread.
+ *
+ * The allocator hooks of open62541 (`UA_mallocSingleton`, ...) are thread-local. The counting
+ * hooks are installed with static initialization for the initializing (main) thread and by the
+ * threads started by this library with a thread configuration (see applyThreadConfig), e.g. the
+ * network threads of Server::runInBackground and ServerGroup. Call this function at the start of
+ * other threads, e.g. application threads running clients. Deep copies are counted in all threads.
+ * Call it outside of a ScopedArena or RealtimePool scope. No-op if already enabled.
+ */
+void enableAllocCounting() noexcept;
+
+/**
+ * Check if allocations of the calling thread are counted (see enableAllocCounting).
+ * Allocations are counted only if open62541 is compiled with `UA_ENABLE_MALLOC_SINGLETON`,
+ * otherwise only deep copies are counted. Allocations served by a ScopedArena are not counted.
+ */
+bool isAllocCountingEnabled() noexcept;
+
+/**
+ * Measure the allocations and copies of the current thread within a scope.
+ *
+ * @code
+ * opcua::AllocStatsScope scope;
+ * auto value = node.readValue();
+ * std::cout << scope.get().allocations << " allocations, " << scope.get().deepCopies << " copies";
+ * @endcode
+ */
+class AllocStatsScope {
+public:
+    AllocStatsScope() noexcept
+        : start_(getThreadAllocStats()) {}
+
+    /// Counts since construction.
+    AllocStats get() const noexcept {
+        return getThreadAllocStats() - start_;
+    }
+
+private:
+    AllocStats start_;
+};
+
+}  // namespace opcua
+
+#endif
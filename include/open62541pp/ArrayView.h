@@ -0,0 +1,126 @@
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+
+#include "open62541pp/Span.h"
+
+namespace opcua {
+
+/**
+ * Multi-dimensional view to a contiguous array in row-major order, similar to `std::mdspan` in
+ * C++23.
+ *
+ * The view holds the pointer to `T` and the extents of the dimensions, the elements are not copied.
+ * The last dimension varies fastest (row-major), which is the layout of OPC UA multi-dimensional
+ * arrays (see Variant::getArrayView).
+ *
+ * @tparam T Type of the array object, use `const T` for an immutable view
+ * @tparam Rank Number of dimensions
+ *
+ * @see https://en.cppreference.com/w/cpp/container/mdspan
+ */
+template <typename T, size_t Rank>
+class ArrayView {
+    static_assert(Rank > 0, "Rank must be greater than zero");
+
+public:
+    // clang-format off
+    using element_type = T;
+    using value_type   = std::remove_cv_t<T>;
+    using size_type    = size_t;
+    using pointer      = T*;
+    using reference    = T&;
+    using extents_type = std::array<size_t, Rank>;
+    // clang-format on
+
+    constexpr ArrayView() noexcept = default;
+
+    constexpr ArrayView(T* data, const extents_type& extents) noexcept
+        : data_(data),
+          extents_(extents) {}
+
+    /// Implicit conversion to an immutable view.
+    template <typename U = T, typename = std::enable_if_t<!std::is_const_v<U>>>
+    constexpr operator ArrayView<const T, Rank>() const noexcept {  // NOLINT
+        return {data_, extents_};
+    }
+
+    /// Number of dimensions.
+    [[nodiscard]] static constexpr size_t rank() noexcept {
+        return Rank;
+    }
+
+    /// Number of elements in dimension `dim`.
+    [[nodiscard]] constexpr size_t extent(size_t dim) const noexcept {
+        assert(dim < Rank);
+        return extents_[dim];
+    }
+
+    [[nodiscard]] constexpr const extents_type& extents() const noexcept {
+        return extents_;
+    }
+
+    /// Distance between two consecutive elements of dimension `dim` (in elements).
+    [[nodiscard]] constexpr size_t stride(size_t dim) const noexcept {
+        assert(dim < Rank);
+        size_t result = 1;
+        for (size_t i = dim + 1; i < Rank; ++i) {
+            result *= extents_[i];
+        }
+        return result;
+    }
+
+    /// Total number of elements.
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return stride(0) * extents_[0];
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return size() == 0;
+    }
+
+    [[nodiscard]] constexpr pointer data() const noexcept {
+        return data_;
+    }
+
+    /// Flat view of all elements.
+    [[nodiscard]] constexpr Span<T> flat() const noexcept {
+        return {data_, size()};
+    }
+
+    /// Access element by its indices, one per dimension.
+    template <typename... Indices>
+    [[nodiscard]] constexpr reference operator()(Indices... indices) const noexcept {
+        static_assert(sizeof...(Indices) == Rank, "Number of indices must match the rank");
+        const std::array<size_t, Rank> index{static_cast<size_t>(indices)...};
+        size_t offset = 0;
+        for (size_t i = 0; i < Rank; ++i) {
+            assert(index[i] < extents_[i]);
+            offset = offset * extents_[i] + index[i];
+        }
+        return data_[offset];
+    }
+
+    /// Access element (rank 1) or sub-array view of the first dimension (e.g. a row of a matrix).
+    [[nodiscard]] constexpr decltype(auto) operator[](size_t index) const noexcept {
+        assert(index < extents_[0]);
+        if constexpr (Rank == 1) {
+            return data_[index];
+        } else {
+            std::array<size_t, Rank - 1> subExtents{};
+            for (size_t i = 1; i < Rank; ++i) {
+                subExtents[i - 1] = extents_[i];
+            }
+            return ArrayView<T, Rank - 1>(data_ + index * stride(0), subExtents);
+        }
+    }
+
+private:
+    T* data_{nullptr};
+    extents_type extents_{};
+};
+
+}  // namespace opcua
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"  // guessDataType
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+namespace opcua {
+
+/**
+ * @defgroup BinaryEncoding Binary encoding
+ * Encode and decode values with the OPC UA binary encoding.
+ *
+ * The encoding functions write into caller-owned buffers, so many values can be serialized into a
+ * single preallocated buffer without intermediate allocations:
+ *
+ * @code
+ * size_t size = 0;
+ * for (const auto& dv : values) {
+ *     size += calcSizeBinary(dv);
+ * }
+ * std::vector<uint8_t> buffer(size);
+ * Span<uint8_t> out(buffer);
+ * for (const auto& dv : values) {
+ *     out = out.subview(encodeBinary(dv, out));
+ * }
+ * @endcode
+ *
+ * The type based overloads accept native types and type wrappers, the data type is deduced.
+ * Custom data types are supported with the overloads taking a DataType.
+ *
+ * @note Only available with open62541 >= v1.3
+ * @{
+ */
+
+/// Get the size of the binary encoding in bytes.
+size_t calcSizeBinary(const void* data, const UA_DataType& type) noexcept;
+
+/// Get the size of the binary encoding in bytes.
+template <typename T>
+size_t calcSizeBinary(const T& data) noexcept {
+    return calcSizeBinary(&data, guessDataType<T>());
+}
+
+/**
+ * Encode into a caller-owned buffer.
+ * @return Number of bytes written to the front of the buffer
+ * @exception BadStatus (BadEncodingLimitsExceeded) If the buffer is too small
+ */
+size_t encodeBinary(const void* data, const UA_DataType& type, Span<uint8_t> buffer);
+
+/// @copydoc encodeBinary(const void*, const UA_DataType&, Span<uint8_t>)
+template <typename T>
+size_t encodeBinary(const T& data, Span<uint8_t> buffer) {
+    return encodeBinary(&data, guessDataType<T>(), buffer);
+}
+
+/**
+ * Encode into a new ByteString.
+ * @exception BadStatus If the encoding fails
+ */
+ByteString encodeBinary(const void* data, const UA_DataType& type);
+
+/// @copydoc encodeBinary(const void*, const UA_DataType&)
+template <typename T>
+ByteString encodeBinary(const T& data) {
+    return encodeBinary(&data, guessDataType<T>());
+}
+
+/**
+ * Decode from a buffer into an empty (zero-initialized) object of the given type.
+ * @param buffer Encoded data, trailing bytes are ignored
+ * @param data Pointer to the object to decode into
+ * @param type Data type of the object
+ * @param customTypes Custom data types referenced by the encoding (e.g. within extension objects)
+ * @exception BadStatus (BadDecodingError) If the buffer can't be decoded
+ */
+void decodeBinary(
+    Span<const uint8_t> buffer,
+    void* data,
+    const UA_DataType& type,
+    Span<const DataType> customTypes = {}
+);
+
+/**
+ * Decode from a buffer into an empty (zero-initialized) object of the given type.
+ * @param buffer Encoded data, trailing bytes are ignored
+ * @param data Pointer to the object to decode into
+ * @param type Data type of the object
+ * @param registry Custom data types referenced by the encoding, including the parent registries
+ * @exception BadStatus (BadDecodingError) If the buffer can't be decoded
+ */
+void decodeBinary(
+    Span<const uint8_t> buffer,
+    void* data,
+    const UA_DataType& type,
+    const DataTypeRegistry& registry
+);
+
+/// Decode from a buffer.
+/// @exception BadStatus (BadDecodingError) If the buffer can't be decoded
+template <typename T>
+T decodeBinary(Span<const uint8_t> buffer, Span<const DataType> customTypes = {}) {
+    T result{};
+    decodeBinary(buffer, &result, guessDataType<T>(), customTypes);
+    return result;
+}
+
+/**
+ * @}
+ */
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <cstdarg>  // va_list
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Logger.h"
+
+namespace opcua {
+
+/**
+ * Binary log sink with deferred formatting (in the style of NanoLog).
+ *
+ * Instead of formatting log messages to text, the sink stores the format string once and the raw
+ * arguments of each message (decoded from the printf conversion specifiers) in a binary log.
+ * Logging costs a short memcpy-like encoding into a preallocated buffer, which is written to
+ * the file when it is full. The text is rendered offline with `tools/decode_binary_log.py`.
+ *
+ * Pass the sink with LoggerOptions::binarySink to Server::setLogger or Client::setLogger.
+ *
+ * File format (host byte order):
+ * - Header: `UAPPBLOG` magic, uint32 version
+ * - Format record: `F`, uint32 format id, uint32 length, format string (not null-terminated)
+ *   (format strings are interned by content; if many distinct formats are logged, e.g. formats
+ *   built at runtime, the table is cleared and formats are written again with new ids)
+ * - Message record: `M`, uint32 format id, uint8 level, uint8 category, int64 timestamp (ns since
+ *   Unix epoch), uint32 size of arguments, arguments
+ * - Argument: type tag (`i`: int64, `u`: uint64, `d`: double, `p`: uint64, `s`: uint32 length +
+ *   string) followed by the value
+ *
+ * The sink is thread-safe.
+ */
+class BinaryLogSink {
+public:
+    static constexpr uint32_t version = 1;
+
+    /**
+     * Create or truncate the binary log file.
+     * @param filepath   Path of the log file
+     * @param bufferSize Size of the write buffer in bytes
+     * @exception BadStatus (BadNotFound) If the file can not be opened
+     */
+    explicit BinaryLogSink(std::string_view filepath, size_t bufferSize = 1024 * 1024);
+
+    /// Flush and close the log file.
+    ~BinaryLogSink();
+
+    BinaryLogSink(const BinaryLogSink&) = delete;
+    BinaryLogSink(BinaryLogSink&&) noexcept = delete;
+    BinaryLogSink& operator=(const BinaryLogSink&) = delete;
+    BinaryLogSink& operator=(BinaryLogSink&&) noexcept = delete;
+
+    /// Write a log message with printf-style format and arguments.
+    void log(LogLevel level, LogCategory category, const char* format, va_list args) noexcept;
+
+    /// Write the buffered records to the file.
+    void flush();
+
+private:
+    /// Maximum number of interned format strings, the table is cleared if exceeded.
+    static constexpr size_t maxFormats = 4096;
+
+    uint32_t getFormatId(const char* format);
+    void flushLocked();
+
+    std::mutex mutex_;
+    std::ofstream stream_;
+    size_t bufferSize_;
+    std::vector<uint8_t> buffer_;
+    std::vector<uint8_t> args_;
+    std::string formatKey_;  // reused lookup key
+    std::unordered_map<std::string, uint32_t> formats_;
+    uint32_t nextFormatId_{0};
+};
+
+}  // namespace opcua
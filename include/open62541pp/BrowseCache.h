@@ -0,0 +1,133 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class Variant;
+template <typename ServerOrClient>
+class MonitoredItem;
+template <typename ServerOrClient>
+class Subscription;
+
+/**
+ * Client-side cache of browse results.
+ *
+ * Memoizes the references returned by services::browseAll per node id and browse description
+ * (browse direction, reference type, subtypes, node class mask, result mask and maximum number
+ * of references). Attach the cache to a client with Client::setBrowseCache; all browse operations
+ * of the client (e.g. Node::browseReferences, Node::browseChildren) are then served from the cache.
+ *
+ * Entries are invalidated after a time to live, manually with @ref invalidate / @ref clear or
+ * by GeneralModelChangeEvents of the server (see @ref subscribeModelChanges).
+ * The cache is thread-safe and can be shared by multiple clients connected to the same server.
+ */
+class BrowseCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Create a browse cache.
+    /// @param timeToLive Expiration time of the entries, entries never expire if zero
+    explicit BrowseCache(Clock::duration timeToLive = Clock::duration::zero())
+        : timeToLive_(timeToLive) {}
+
+    /// Get the cached references of a browse description, `std::nullopt` on a cache miss.
+    std::optional<std::vector<ReferenceDescription>> find(
+        const BrowseDescription& bd, uint32_t maxReferences = 0
+    );
+
+    /// Insert or replace the references of a browse description.
+    void insert(
+        const BrowseDescription& bd,
+        uint32_t maxReferences,
+        std::vector<ReferenceDescription> references
+    );
+
+    /// Remove all entries of a node.
+    void invalidate(const NodeId& id);
+
+    /// Remove all entries.
+    void clear();
+
+    /// Number of cached browse results.
+    size_t size() const;
+
+    /// Number of cache hits and misses since creation.
+    uint64_t getHitCount() const noexcept {
+        return hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getMissCount() const noexcept {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Invalidate the entries affected by a GeneralModelChangeEvent.
+     *
+     * Node and reference additions and deletions clear the whole cache (the references of the
+     * parent and target nodes change as well, but only one affected node is reported), data type
+     * changes invalidate the affected node.
+     * Events without change details (e.g. a BaseModelChangeEvent) clear the whole cache.
+     *
+     * @param eventFields Event fields selected by @ref getModelChangeEventFilter
+     */
+    void handleModelChangeEvent(Span<const Variant> eventFields);
+
+    /// Event filter selecting the `Changes` field of GeneralModelChangeEvents.
+    static EventFilter getModelChangeEventFilter();
+
+private:
+    struct Entry {
+        BrowseDirection browseDirection;
+        NodeId referenceTypeId;
+        bool includeSubtypes;
+        uint32_t nodeClassMask;
+        uint32_t resultMask;
+        uint32_t maxReferences;
+        Clock::time_point inserted;
+        std::vector<ReferenceDescription> references;
+    };
+
+    static bool matches(const Entry& entry, const BrowseDescription& bd, uint32_t maxReferences);
+
+    Clock::duration timeToLive_;
+    mutable std::mutex mutex_;
+    std::unordered_map<NodeId, std::vector<Entry>> entries_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/**
+ * Monitor the model changes of the server and invalidate the affected cache entries.
+ *
+ * Creates an event monitored item for GeneralModelChangeEvents of the `Server` object. The
+ * cache is referenced weakly, the monitored item stays valid after the cache is destroyed.
+ * Requires a server that emits model change events.
+ *
+ * @param subscription Subscription to create the monitored item in
+ * @param cache Browse cache to invalidate
+ * @see BrowseCache::handleModelChangeEvent
+ */
+MonitoredItem<Client> subscribeModelChanges(
+    Subscription<Client>& subscription, const std::shared_ptr<BrowseCache>& cache
+);
+#endif
+
+}  // namespace opcua
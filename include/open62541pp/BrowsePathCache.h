@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cstddef>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Browse path of browse names, starting from an origin node.
+ * The browse names are resolved following forward hierarchical references (including subtypes),
+ * like in services::browseSimplifiedBrowsePath.
+ */
+struct SimplifiedBrowsePath {
+    NodeId origin;
+    std::vector<QualifiedName> path;
+};
+
+/**
+ * Persistent cache of resolved browse paths.
+ *
+ * Maps simplified browse paths to the resolved node ids. The namespace indices of the node ids
+ * and browse names refer to the namespace array of the cache, which has to be revalidated against
+ * the namespace array of the server with @ref revalidate (done by @ref resolveBrowsePaths). The
+ * cache can be stored on disk with @ref save to skip the resolution on warm restarts.
+ */
+class BrowsePathCache {
+public:
+    /// Get the resolved node id of a browse path, `std::nullopt` on a cache miss.
+    std::optional<NodeId> find(const SimplifiedBrowsePath& browsePath) const;
+
+    /// Insert or replace the resolved node id of a browse path.
+    void insert(SimplifiedBrowsePath browsePath, NodeId target);
+
+    /// Remove all entries.
+    void clear() noexcept;
+
+    /// Number of cached browse paths.
+    size_t size() const noexcept;
+
+    /// Namespace array the cached node ids and browse names refer to.
+    const std::vector<std::string>& getNamespaceArray() const noexcept;
+
+    /**
+     * Revalidate the cache against the namespace array of a server.
+     *
+     * The namespace indices of all entries are mapped to the new namespace array by namespace
+     * URI. Entries with namespaces that don't exist anymore are removed.
+     *
+     * @param namespaceArray Current namespace array of the server
+     */
+    void revalidate(Span<const std::string> namespaceArray);
+
+    /**
+     * Write the cache (including the namespace array) to a binary stream.
+     * @param stream Output stream (use `std::ios::binary`)
+     * @note Requires open62541 v1.3 or later.
+     */
+    void save(std::ostream& stream) const;
+
+    /**
+     * Read a cache written by @ref save.
+     * @param stream Input stream (use `std::ios::binary`)
+     * @exception BadStatus (BadDecodingError) If the stream is invalid
+     * @note Requires open62541 v1.3 or later.
+     */
+    static BrowsePathCache load(std::istream& stream);
+
+private:
+    struct Hash {
+        size_t operator()(const SimplifiedBrowsePath& browsePath) const noexcept;
+    };
+
+    struct Equal {
+        bool operator()(
+            const SimplifiedBrowsePath& lhs, const SimplifiedBrowsePath& rhs
+        ) const noexcept;
+    };
+
+    std::vector<std::string> namespaceArray_;
+    std::unordered_map<SimplifiedBrowsePath, NodeId, Hash, Equal> entries_;
+};
+
+/**
+ * Resolve multiple browse paths with batched TranslateBrowsePathsToNodeIds requests.
+ *
+ * The cache is revalidated against the namespace array of the server first. Cached paths are
+ * served from the cache, all other paths are resolved with batched requests (see
+ * services::translateBrowsePathsToNodeIds) and inserted into the cache.
+ *
+ * @param client Instance of type Client
+ * @param browsePaths Browse paths to resolve
+ * @param cache Cache of resolved browse paths
+ * @returns Resolved node id of each browse path, a null node id if the path couldn't be resolved
+ */
+std::vector<NodeId> resolveBrowsePaths(
+    Client& client, Span<const SimplifiedBrowsePath> browsePaths, BrowsePathCache& cache
+);
+
+}  // namespace opcua
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+#include "open62541pp/types/DateTime.h"
+
+namespace opcua {
+
+/**
+ * Coarse cached wall clock for high-frequency timestamping.
+ *
+ * @ref now returns the time of the last @ref update instead of querying the system clock. The
+ * clock is updated by update sources: a CachedClockTicker or a server with cached clock enabled
+ * (see Server::setCachedClock), which updates the clock once per iteration of its main loop.
+ * Without any registered source, @ref now falls back to DateTime::now.
+ *
+ * Use it for timestamps that don't need a higher resolution than the update interval, e.g.
+ * `Event::writeTime(CachedClock::now())`. The source timestamps of ValuePublisher::publish and the
+ * keys of the server-side historian use the cached clock.
+ */
+class CachedClock {
+public:
+    /// Get the cached time (current time if no update source is registered).
+    static DateTime now() noexcept;
+
+    /// Update the cached time with the current time.
+    static void update() noexcept;
+
+    /// Register an update source, the cached time is used while at least one is registered.
+    static void addSource() noexcept;
+
+    /// Unregister an update source.
+    static void removeSource() noexcept;
+
+    /// Check if at least one update source is registered.
+    static bool isActive() noexcept;
+};
+
+/**
+ * Background thread updating the CachedClock periodically while the ticker is alive.
+ */
+class CachedClockTicker {
+public:
+    explicit CachedClockTicker(std::chrono::milliseconds interval = std::chrono::milliseconds(1));
+    ~CachedClockTicker();
+
+    CachedClockTicker(const CachedClockTicker&) = delete;
+    CachedClockTicker(CachedClockTicker&&) noexcept = delete;
+    CachedClockTicker& operator=(const CachedClockTicker&) = delete;
+    CachedClockTicker& operator=(CachedClockTicker&&) noexcept = delete;
+
+private:
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool stop_{false};
+    std::thread thread_;
+};
+
+}  // namespace opcua
@@ -1,17 +1,23 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <utility>  // pair
 #include <vector>
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Logger.h"
+#include "open62541pp/PollGroup.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/ThreadConfig.h"
 #include "open62541pp/types/NodeId.h"
 
 // forward declaration open62541
@@ -21,16 +27,72 @@ namespace opcua {
 
 // forward declaration
 class ApplicationDescription;
+class BrowseCache;
 class ByteString;
 class ClientContext;
 class DataType;
+class DataTypeRegistry;
+class DiscoveryCache;
 class EndpointDescription;
 struct Login;
+class NamespaceTable;
 template <typename ServerOrClient>
 class Node;
+class NodeAttributeCache;
+class NodeIdPool;
+class Server;
+class Statistics;
+class Tracer;
+class WriteCoalescer;
 
 using StateCallback = std::function<void()>;
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/// Callback for subscriptions that were recreated after a reconnect with a new session.
+/// The monitored item ids are pairs of the previous and the new id.
+using SubscriptionRecreatedCallback = std::function<void(
+    uint32_t oldSubscriptionId,
+    uint32_t newSubscriptionId,
+    Span<const std::pair<uint32_t, uint32_t>> monitoredItemIds
+)>;
+
+/// Callback for notifications of a subscription that were lost with a connection loss.
+/// The sequence numbers of the lost notification messages are empty if the subscription was
+/// recreated, the number of lost notifications is unknown then.
+using NotificationGapCallback =
+    std::function<void(uint32_t subscriptionId, Span<const uint32_t> missingSequenceNumbers)>;
+#endif
+
+/**
+ * Options of the automatic reconnect.
+ * @see Client::setReconnect
+ */
+struct ReconnectOptions {
+    /// Delay of the first reconnect attempt.
+    std::chrono::milliseconds initialDelay{100};
+    /// Maximum delay between reconnect attempts.
+    std::chrono::milliseconds maxDelay{30000};
+    /// Factor to increase the delay after each failed attempt (exponential backoff).
+    double backoffFactor{2.0};
+    /// Maximum number of attempts after a connection loss (0 = unlimited).
+    size_t maxAttempts{0};
+};
+
+/**
+ * Options of the adaptive request sizing.
+ * @see Client::setAdaptiveRequestSizing
+ */
+struct AdaptiveRequestSizing {
+    /// Number of operations of the first request.
+    size_t initialSize{1000};
+    /// Minimum number of operations per request.
+    size_t minSize{1};
+    /// Maximum number of operations per request (further bounded by the server's operation limit).
+    size_t maxSize{100000};
+    /// The request size grows while the response time stays below the target latency.
+    std::chrono::milliseconds targetLatency{100};
+};
+
 /**
  * High-level client class.
  *
@@ -87,6 +149,8 @@ public:
 
     /// Set custom logging function.
     void setLogger(Logger logger);
+    /// Set custom logging function with options, e.g. a minimum log level or async logging.
+    void setLogger(Logger logger, const LoggerOptions& options);
 
     /// Set response timeout in milliseconds.
     void setTimeout(uint32_t milliseconds);
@@ -94,9 +158,27 @@ public:
     /// Set message security mode.
     void setSecurityMode(MessageSecurityMode mode);
 
+    /**
+     * Set secure channel options, e.g. larger chunks for high throughput with encryption.
+     * The lifetime is the requested lifetime of the security token (revised by the server).
+     * @note Applied with the next connect.
+     */
+    void setSecureChannelOptions(const SecureChannelOptions& options);
+
+    /**
+     * Set transport configuration, e.g. larger buffers for bulk transfers or `TCP_NODELAY` for low
+     * latency.
+     * @note Applied with the next connect.
+     */
+    void setTransportConfig(const TransportConfig& config);
+
     /// Set custom data types.
     /// All data types provided are automatically considered for decoding of received messages.
     void setCustomDataTypes(std::vector<DataType> dataTypes);
+    /// Set custom data types of a shared registry (`nullptr` to reset).
+    /// The registry is referenced instead of copied, the data types are not duplicated.
+    /// @see DataTypeRegistry
+    void setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry);
 
     /// Set a state callback that will be called after the client is connected.
     void onConnected(StateCallback callback);
@@ -106,10 +188,26 @@ public:
     void onSessionActivated(StateCallback callback);
     /// Set a state callback that will be called after the session is closed.
     void onSessionClosed(StateCallback callback);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /// Set a callback that will be called for each subscription recreated by the reconnect.
+    void onSubscriptionRecreated(SubscriptionRecreatedCallback callback);
+    /**
+     * Set a callback that will be called for notifications that couldn't be recovered after a
+     * reconnect.
+     *
+     * Notification messages retained by the server for transferred subscriptions are requested
+     * with Republish and delivered in order through the usual callbacks, before any new
+     * notification. Messages the server doesn't retain anymore and subscriptions that had to be
+     * recreated are reported with this callback.
+     */
+    void onNotificationGap(NotificationGapCallback callback);
+#endif
 
     /**
      * Connect to the selected server.
      * @param endpointUrl Endpoint URL (for example `opc.tcp://localhost:4840/open62541/server/`)
+     *                    or `opc.shm://<name>` for the shared memory transport of a server on the
+     *                    same host (see Server::addSharedMemoryTransport)
      */
     void connect(std::string_view endpointUrl);
 
@@ -120,14 +218,143 @@ public:
      */
     void connect(std::string_view endpointUrl, const Login& login);
 
+    /**
+     * Connect to a server of the same process without a network connection.
+     *
+     * Messages are handed over to the server thread with its command queue (see Server::post)
+     * and responses are passed back in memory, no sockets or copies are involved. Secure channel,
+     * session and access control behave as with TCP connections, e.g. for tests and in-process
+     * adapters. The server processes the messages with its iterations, run it in a background
+     * thread (Server::runInBackground) or call Server::runIterate. Use NetworkBackend::Epoll to
+     * wake up the server thread with each message, the default backend processes the messages
+     * with the command interval of Server::runInBackground.
+     *
+     * @param server Server to connect to, the connection is closed if it's deleted
+     * @note Only available with open62541 v1.1 - v1.3
+     * @exception BadStatus (BadNotSupported) If in-process connections are not available
+     */
+    void connect(Server& server);
+
+    /// Connect to a server of the same process with the given username and password.
+    /// @see connect(Server&)
+    void connect(Server& server, const Login& login);
+
     /// Disconnect and close a connection to the server (async, without blocking).
+    /// A pending automatic reconnect is cancelled.
     void disconnect() noexcept;
 
+    /**
+     * Enable or disable (`std::nullopt`) the automatic reconnect.
+     *
+     * If the connection is lost, runIterate (and run) don't throw but reconnect to the last
+     * endpoint with the last login and an exponential backoff. After the reconnect, existing
+     * subscriptions are transferred to the session with `TransferSubscriptions`. Subscriptions that
+     * can't be transferred are recreated from the stored parameters and monitored items, the new
+     * ids are reported with @ref onSubscriptionRecreated.
+     *
+     * @exception BadStatus (runIterate) If the maximum number of attempts is exceeded
+     */
+    void setReconnect(std::optional<ReconnectOptions> options);
+
+    /**
+     * Enable or disable the endpoint cache to skip the endpoint discovery on (re)connects.
+     *
+     * Without the cache, each connect requests the endpoints of the server (GetEndpoints) to select
+     * an endpoint and user token policy before the secure channel is opened. With the cache, the
+     * selected endpoint (incl. security policy and server certificate) is stored per endpoint URL
+     * after a successful connect and preselected by further connects and automatic reconnects.
+     * The results of @ref getEndpoints are cached per server URL as well.
+     * If a connect with a cached endpoint fails, the entry is dropped and the connect is retried
+     * with discovery. An endpoint and user token policy selected in the client config (e.g. with
+     * `UA_Client_getConfig`) are kept and used for endpoint URLs without a cache entry.
+     *
+     * @note Only available with open62541 >= v1.1, the cache is ignored otherwise
+     */
+    void setEndpointCaching(bool enable);
+    /// Clear the cached endpoints, e.g. after the server certificate changed.
+    void clearEndpointCache() noexcept;
+
+    /// Attach a cache of discovery results (`nullptr` to detach).
+    /// @ref findServers and @ref getEndpoints are served from the cache, new results are inserted.
+    /// The cache can be shared by multiple clients, e.g. the clients of a network scanner.
+    /// @see DiscoveryCache
+    void setDiscoveryCache(std::shared_ptr<DiscoveryCache> cache);
+    /// Get the attached discovery cache (`nullptr` if no cache is attached).
+    std::shared_ptr<DiscoveryCache> getDiscoveryCache() noexcept;
+
+    /**
+     * Enable or disable (`std::nullopt`) the adaptive request sizing of batched services.
+     *
+     * Batched reads, writes, method calls and browse path translations are split into requests
+     * of at most the server's operation limits (`Server_ServerCapabilities_OperationLimits`, read
+     * once per session). With adaptive sizing, the number of operations per request is tuned at
+     * runtime: Requests rejected with BadTooManyOperations or BadResponseTooLarge are resent with
+     * half the size, the size grows while the response time stays below the target latency but
+     * stays below the last rejected size (until a long streak of successful requests).
+     * The sizes are tracked per service and reset with every new session.
+     *
+     * @note Set the options before services are called from other threads.
+     */
+    void setAdaptiveRequestSizing(std::optional<AdaptiveRequestSizing> options);
+
     /// Check if client is connected (secure channel open).
     bool isConnected() noexcept;
 
     /// Get all defined namespaces.
     std::vector<std::string> getNamespaceArray();
+    /// Get the cached namespace table, fetched on first use and reset on session activation.
+    /// The table is not refreshed if the server registers new namespaces, use
+    /// @ref trackNamespaceArray to keep it up to date.
+    std::shared_ptr<const NamespaceTable> getNamespaceTable();
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /// Monitor the `NamespaceArray` of the server and replace the cached namespace table.
+    /// @return Monitored item, delete it to stop tracking
+    MonitoredItem<Client> trackNamespaceArray(Subscription<Client>& subscription);
+#endif
+
+    /// Attach a browse cache to memoize the results of browse operations (`nullptr` to detach).
+    /// The cache can be shared by multiple clients connected to the same server.
+    /// @see BrowseCache
+    void setBrowseCache(std::shared_ptr<BrowseCache> cache);
+    /// Get the attached browse cache (`nullptr` if no cache is attached).
+    std::shared_ptr<BrowseCache> getBrowseCache() noexcept;
+
+    /// Attach a cache of static node attributes (`nullptr` to detach).
+    /// Attribute reads of the client are served from the cache, writes invalidate the node.
+    /// @see NodeAttributeCache
+    void setAttributeCache(std::shared_ptr<NodeAttributeCache> cache);
+    /// Get the attached attribute cache (`nullptr` if no cache is attached).
+    std::shared_ptr<NodeAttributeCache> getAttributeCache() noexcept;
+
+    /// Attach a pool to intern the node ids of monitored items (`nullptr` to detach).
+    /// Monitored items with equal node ids share one node id instance, which reduces memory usage
+    /// for many monitored items with long string node ids. Only affects new monitored items.
+    /// @see NodeIdPool
+    void setNodeIdPool(std::shared_ptr<NodeIdPool> pool);
+    /// Get the attached node id pool (`nullptr` if no pool is attached).
+    std::shared_ptr<NodeIdPool> getNodeIdPool() noexcept;
+
+    /// Attach a write coalescer to merge and rate limit value writes (`nullptr` to detach).
+    /// Value writes of the client are enqueued and flushed by runIterate.
+    /// @see WriteCoalescer
+    void setWriteCoalescer(std::shared_ptr<WriteCoalescer> coalescer);
+    /// Get the attached write coalescer (`nullptr` if no coalescer is attached).
+    std::shared_ptr<WriteCoalescer> getWriteCoalescer() noexcept;
+
+    /**
+     * Register frequently accessed nodes with the RegisterNodes service.
+     *
+     * The server returns aliases (e.g. numeric node ids) that allow faster access. The aliases are
+     * transparently substituted in read and write requests (services::readAttribute,
+     * services::readAttributes, ... and Node<Client>). The nodes are registered again
+     * automatically if the session is re-created.
+     *
+     * @param ids Node ids to register
+     * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.8.5
+     */
+    void registerHotNodes(Span<const NodeId> ids);
+    /// Unregister nodes registered with @ref registerHotNodes.
+    void unregisterHotNodes(Span<const NodeId> ids);
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     /// Create a subscription to monitor data changes and events (default subscription parameters).
@@ -138,6 +365,13 @@ public:
     std::vector<Subscription<Client>> getSubscriptions();
 #endif
 
+    /// Create a poll group to read node attributes periodically, the first poll is due
+    /// immediately. Poll groups are driven by runIterate.
+    /// @see PollGroup
+    PollGroup createPollGroup(const PollGroupParameters& parameters = {});
+    /// Get all poll groups.
+    std::vector<PollGroup> getPollGroups();
+
     /**
      * Run a single iteration of the client's main loop.
      * Listen on the network and process arriving asynchronous responses in the background.
@@ -145,13 +379,76 @@ public:
      * @param timeoutMilliseconds Timeout in milliseconds
      */
     void runIterate(uint16_t timeoutMilliseconds = 1000);
+
+    /**
+     * Process pending events without blocking, same as `runIterate(0)`.
+     *
+     * Use with getSocketFd and getNextTimeout to drive many clients from a single external event
+     * loop (e.g. epoll) instead of one thread per client:
+     *
+     * @code
+     * // register client.getSocketFd() of all clients with the epoll instance (EPOLLIN)
+     * while (...) {
+     *     // timeout: minimum of getNextTimeout() of all clients
+     *     const int n = epoll_wait(loopFd, events, maxEvents, timeout);
+     *     // call processEvents() of ready clients and of clients with an elapsed timeout
+     * }
+     * @endcode
+     *
+     * @note An automatic reconnect (see setReconnect) connects synchronously and blocks.
+     */
+    void processEvents();
+
+    /**
+     * Get the socket file descriptor of the connection to the server.
+     * The descriptor changes with every (re)connect, register it again after the
+     * ClientState::Connected callback.
+     * @returns File descriptor or -1 if not connected or not available (requires open62541
+     *          v1.1 - v1.3)
+     */
+    int getSocketFd() const noexcept;
+
+    /**
+     * Get the maximum period until processEvents must be called again, even if the socket isn't
+     * readable, e.g. for the next reconnect attempt, secure channel renewal and request timeouts.
+     */
+    std::chrono::milliseconds getNextTimeout() const noexcept;
+
     /// Run the client's main loop by. This method will block until Client::stop is called.
     void run();
-    /// Stop the client's main loop.
+    /**
+     * Run the client's main loop in a background thread until Client::stop is called.
+     *
+     * Services can then be called from any thread. Read, write, browse and call requests of
+     * different threads are sent asynchronously and multiplexed over the connection, each caller
+     * waits for its own response. Other services are serialized. Callbacks (subscriptions,
+     * asynchronous services, state changes) are invoked by the background thread.
+     * Runtime errors of the main loop are not propagated, failing requests report them instead.
+     *
+     * The configuration of the client is not thread-safe. This client instance (not a copy) must
+     * outlive the main loop, Client::runIterate must not be called meanwhile.
+     *
+     * @param timeoutMilliseconds Timeout of a single iteration, the client is locked meanwhile
+     */
+    void runInBackground(uint16_t timeoutMilliseconds = 10);
+    /// Stop the client's main loop (and join the background thread).
     void stop();
     /// Check if the client's main loop is running.
     bool isRunning() const noexcept;
 
+    /// Get latency and error statistics of synchronous services.
+    /// @see Statistics
+    Statistics& getStatistics() noexcept;
+
+    /// Set a tracer to trace synchronous services (`nullptr` to disable tracing).
+    /// Set the tracer before services are called from other threads.
+    /// @see Tracer
+    void setTracer(std::shared_ptr<Tracer> tracer);
+
+    /// Set the thread configuration (CPU affinity, priority, NUMA node) of the background thread.
+    /// Applied with the next Client::runInBackground.
+    void setThreadConfig(const ThreadConfig& config);
+
     Node<Client> getNode(NodeId id);
     Node<Client> getRootNode();
     Node<Client> getObjectsNode();
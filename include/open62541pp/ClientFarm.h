@@ -0,0 +1,182 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "open62541pp/AccessControl.h"  // Login
+#include "open62541pp/Client.h"
+#include "open62541pp/Common.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+
+namespace opcua {
+
+// forward declaration
+class DataTypeRegistry;
+
+/**
+ * Options of a ClientFarm.
+ */
+struct ClientFarmOptions {
+    /// Number of event loop threads, the endpoints are distributed round-robin.
+    size_t threads{1};
+    /// Delay between the initial connects of consecutive endpoints of an event loop thread.
+    std::chrono::milliseconds connectStagger{10};
+    /// Reconnect after failed connects and connection losses with exponential backoff.
+    /// The delays are randomized within [delay / 2, delay] to spread the reconnects of endpoints
+    /// that failed at the same time.
+    ReconnectOptions reconnect{std::chrono::seconds(1), std::chrono::seconds(60), 2.0, 0};
+    /// Configuration of the event loop threads (CPU affinity, priority, NUMA node).
+    ThreadConfig threadConfig;
+};
+
+/**
+ * Endpoint of a ClientFarm with the nodes read on schedule.
+ */
+struct ClientFarmEndpoint {
+    /// Server endpoint URL, e.g. `opc.tcp://plc-42:4840`.
+    std::string endpointUrl;
+    /// Optional login (connects synchronously, see ClientFarm).
+    std::optional<Login> login;
+    /// Nodes read with a single Read request per interval.
+    std::vector<ReadValueId> nodesToRead;
+    /// Interval of the batched reads, the next read is sent after the previous one completed.
+    std::chrono::milliseconds readInterval{1000};
+    /// Timestamps to return.
+    TimestampsToReturn timestamps{TimestampsToReturn::Source};
+};
+
+/**
+ * Result of a scheduled batched read of an endpoint.
+ */
+struct ClientFarmResult {
+    /// Index of the endpoint returned by ClientFarm::addEndpoint.
+    size_t endpoint{0};
+    /// Service result, or the status of the connection loss while the read was pending.
+    StatusCode status;
+    /// Results in the order of ClientFarmEndpoint::nodesToRead, empty if the status is bad.
+    std::vector<DataValue> values;
+    /// Time the response was received.
+    std::chrono::steady_clock::time_point timestamp;
+};
+
+/**
+ * Connection state of a ClientFarm endpoint.
+ */
+enum class ClientFarmState {
+    Disconnected,
+    Connecting,
+    Connected,
+};
+
+/**
+ * Client engine for thousands of endpoints on a fixed number of event loop threads.
+ *
+ * Each endpoint gets its own Client. The clients of an event loop thread are driven with
+ * non-blocking iterations (Client::processEvents) and their sockets are waited on with a single
+ * `poll` call, so a thread serves hundreds of endpoints. Connects are asynchronous, initial connects
+ * are staggered and reconnects are randomized with an exponential backoff.
+ *
+ * The results of the scheduled reads are collected per event loop iteration and passed to a single
+ * sink. The sink calls are serialized, the sink doesn't have to be thread-safe.
+ *
+ * Shared configuration:
+ * - custom data types are referenced by all clients (see setCustomDataTypes)
+ * - certificates, security mode and timeouts are applied by the client factory, e.g. by
+ *   constructing all clients with the same certificate and key
+ *
+ * @code
+ * ClientFarm farm({4});  // 4 event loop threads
+ * farm.setSink([&](Span<ClientFarmResult> results) { ... });
+ * for (const auto& url : urls) {
+ *     farm.addEndpoint({url, std::nullopt, items, std::chrono::seconds(1)});
+ * }
+ * farm.start();
+ * @endcode
+ *
+ * @note Requires open62541 v1.1 or later for asynchronous connects. Endpoints with a login and
+ *       older versions connect synchronously and block the other endpoints of the event loop
+ *       thread meanwhile (at most the client timeout).
+ */
+class ClientFarm {
+public:
+    /// Factory to create the client of an endpoint, e.g. with encryption (default: `Client()`).
+    using ClientFactory = std::function<std::unique_ptr<Client>(const ClientFarmEndpoint&)>;
+    /// Sink of the read results of an event loop iteration.
+    using Sink = std::function<void(Span<ClientFarmResult> results)>;
+
+    explicit ClientFarm(ClientFarmOptions options = {}, ClientFactory factory = {});
+
+    /// Stop the event loop threads and disconnect the clients.
+    ~ClientFarm();
+
+    ClientFarm(const ClientFarm&) = delete;
+    ClientFarm(ClientFarm&&) noexcept = delete;
+    ClientFarm& operator=(const ClientFarm&) = delete;
+    ClientFarm& operator=(ClientFarm&&) noexcept = delete;
+
+    /// Set custom data types of a shared registry, referenced by all clients.
+    /// @note Call before the farm is started.
+    void setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry);
+
+    /// Set the sink of the read results.
+    /// @note Call before the farm is started.
+    void setSink(Sink sink);
+
+    /**
+     * Add an endpoint and create its client.
+     * @returns Index of the endpoint, passed to the sink with the results
+     * @exception BadStatus (BadInvalidState) If the farm is running
+     */
+    size_t addEndpoint(ClientFarmEndpoint endpoint);
+
+    /// Number of endpoints.
+    size_t size() const noexcept;
+
+    /// Connection state of an endpoint.
+    ClientFarmState getState(size_t endpoint) const;
+
+    /// Number of connected endpoints (session activated).
+    size_t getConnectedCount() const noexcept;
+
+    /// Start the event loop threads and connect the endpoints.
+    void start();
+
+    /// Stop the event loop threads and disconnect the clients.
+    void stop();
+
+    /// Check if the event loop threads are running.
+    bool isRunning() const noexcept;
+
+private:
+    struct Endpoint;
+    struct Worker;
+
+    void run(Worker& worker);
+    void connect(Endpoint& endpoint);
+    void scheduleReconnect(Endpoint& endpoint, Worker& worker);
+    void sendRead(Endpoint& endpoint, Worker& worker);
+    void deliver(Span<ClientFarmResult> results);
+
+    ClientFarmOptions options_;
+    ClientFactory factory_;
+    std::shared_ptr<const DataTypeRegistry> dataTypes_;
+    Sink sink_;
+    std::mutex sinkMutex_;
+    std::vector<std::unique_ptr<Endpoint>> endpoints_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<size_t> connectedCount_{0};
+};
+
+}  // namespace opcua
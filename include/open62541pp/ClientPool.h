@@ -0,0 +1,161 @@
+#pragma once
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <type_traits>
+#include <utility>  // forward, move
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Common.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+// forward declaration
+class DataType;
+class DataTypeRegistry;
+struct Login;
+
+/**
+ * Pool of client connections to the same endpoint.
+ *
+ * A single client has one session and its services are not thread-safe. The pool owns `N`
+ * clients, each with its own session and a worker thread that exclusively uses that client.
+ * Tasks are queued and executed by the next idle worker, so multiple requests are in flight in
+ * parallel. Batched reads and writes are split into one chunk per session.
+ *
+ * Configure and connect the pool before submitting tasks. The configuration functions apply to
+ * all clients and must not be called while tasks are pending.
+ *
+ * @code
+ * ClientPool pool(4);
+ * pool.connect("opc.tcp://localhost:4840");
+ * const auto values = pool.readValues(ids);
+ * auto future = pool.submit([&](Client& client) { return services::browseAll(client, bd); });
+ * @endcode
+ */
+class ClientPool {
+public:
+    /// Factory to create the clients, e.g. with encryption (default: `Client()`).
+    using ClientFactory = std::function<std::unique_ptr<Client>()>;
+
+    /**
+     * Create the clients and start the worker threads.
+     * @param size Number of clients/sessions (at least one)
+     * @param factory Factory to create the clients
+     * @param threadConfig Configuration of the worker threads (CPU affinity, priority, NUMA node)
+     */
+    explicit ClientPool(size_t size, ClientFactory factory = {}, ThreadConfig threadConfig = {});
+
+    /// Finish the pending tasks, join the worker threads and disconnect the clients.
+    ~ClientPool();
+
+    ClientPool(const ClientPool&) = delete;
+    ClientPool(ClientPool&&) noexcept = delete;
+    ClientPool& operator=(const ClientPool&) = delete;
+    ClientPool& operator=(ClientPool&&) noexcept = delete;
+
+    /// Number of clients.
+    size_t size() const noexcept {
+        return clients_.size();
+    }
+
+    /// Get the client with the given index, e.g. for further configuration.
+    /// @note The client is used by its worker thread, don't access it while tasks are pending.
+    Client& getClient(size_t index) {
+        return *clients_.at(index);
+    }
+
+    /// @copydoc Client::setTimeout
+    void setTimeout(uint32_t milliseconds);
+
+    /// @copydoc Client::setSecurityMode
+    void setSecurityMode(MessageSecurityMode mode);
+
+    /// @copydoc Client::setCustomDataTypes(std::vector<DataType>)
+    void setCustomDataTypes(const std::vector<DataType>& dataTypes);
+
+    /// Set custom data types of a shared registry, referenced by all clients.
+    void setCustomDataTypes(const std::shared_ptr<const DataTypeRegistry>& registry);
+
+    /// Connect all clients to the selected server.
+    /// @exception BadStatus If a client fails to connect, the remaining clients are not connected
+    void connect(std::string_view endpointUrl);
+
+    /// Connect all clients to the selected server with the given username and password.
+    /// @exception BadStatus If a client fails to connect, the remaining clients are not connected
+    void connect(std::string_view endpointUrl, const Login& login);
+
+    /// Disconnect all clients.
+    void disconnect() noexcept;
+
+    /**
+     * Queue a task to be executed with the client of the next idle worker.
+     * Any service function can be used within the task.
+     * @param func Callable with the signature `R(Client&)`
+     * @return Future with the result or the exception of the task
+     */
+    template <typename F>
+    auto submit(F&& func) {
+        using Result = std::invoke_result_t<F, Client&>;
+        auto task = std::make_shared<std::packaged_task<Result(Client&)>>(std::forward<F>(func));
+        auto future = task->get_future();
+        post([task = std::move(task)](Client& client) { (*task)(client); });
+        return future;
+    }
+
+    /// Read multiple attributes, split across the sessions.
+    /// @see services::readAttributes
+    std::vector<DataValue> readAttributes(
+        Span<const ReadValueId> nodesToRead,
+        TimestampsToReturn timestamps = TimestampsToReturn::Neither
+    );
+
+    /// Read the `Value` attribute of multiple nodes, split across the sessions.
+    /// @see services::readValues
+    std::vector<DataValue> readValues(
+        Span<const NodeId> ids, TimestampsToReturn timestamps = TimestampsToReturn::Neither
+    );
+
+    /// Write multiple attributes, split across the sessions.
+    /// @see services::writeAttributes
+    std::vector<StatusCode> writeAttributes(Span<const WriteValue> nodesToWrite);
+
+    /// Write the `Value` attribute of multiple nodes, split across the sessions.
+    /// @see services::writeValues
+    std::vector<StatusCode> writeValues(Span<const NodeId> ids, Span<const Variant> values);
+
+private:
+    using Task = std::function<void(Client&)>;
+
+    void post(Task task);
+    void run(Client& client);
+
+    /// Split `size` operations into one chunk per client and concatenate the results.
+    template <typename Result, typename F>
+    std::vector<Result> dispatch(size_t size, F&& func);
+
+    std::vector<std::unique_ptr<Client>> clients_;
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Task> tasks_;
+    bool running_{true};
+};
+
+}  // namespace opcua
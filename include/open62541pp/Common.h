@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 #include <string_view>
 #include <tuple>
 
@@ -212,6 +213,68 @@ enum class MessageSecurityMode : uint32_t {
     // clang-format on
 };
 
+/**
+ * Secure channel and connection limits.
+ *
+ * Messages are split into chunks, every chunk is signed and encrypted separately with a fixed
+ * overhead (headers, padding, signature). Larger chunks reduce the number of crypto operations and
+ * syscalls per message with Sign or SignAndEncrypt. The chunk size is negotiated with the peer on
+ * connect, the smaller size of both ends is used. Unset options keep the defaults of open62541.
+ *
+ * @see Client::setSecureChannelOptions
+ * @see Server::setSecureChannelOptions
+ * @see https://reference.opcfoundation.org/Core/Part6/v105/docs/6.7.2
+ */
+struct SecureChannelOptions {
+    /// Size of the send and receive buffers, i.e. the maximum chunk size in bytes (min 8192).
+    std::optional<uint32_t> chunkSize;
+    /// Maximum size of a message in bytes, `0` for no limit.
+    std::optional<uint32_t> maxMessageSize;
+    /// Maximum number of chunks per message, `0` for no limit.
+    std::optional<uint32_t> maxChunkCount;
+    /// Lifetime of the security token in milliseconds. The symmetric keys are renewed with every
+    /// token, longer lifetimes reduce the number of asymmetric handshakes.
+    std::optional<uint32_t> lifetime;
+};
+
+/**
+ * Transport configuration of binary (TCP) connections.
+ *
+ * Messages are split into chunks of at most the buffer size, every chunk is sent with a separate
+ * syscall (see SecureChannelOptions for the effect on encrypted connections).
+ * - Bulk transfers: large buffers (e.g. 1 MiB) and socket buffers reduce the number of chunks and
+ *   syscalls per message.
+ * - Low latency: small messages with the default buffers and Nagle's algorithm disabled
+ *   (`noDelay`).
+ *
+ * The buffer sizes are negotiated with the peer in the Hello/Acknowledge handshake, the smaller
+ * size of both ends is used. Unset options keep the defaults of open62541 and the operating system.
+ *
+ * The socket options are applied to the client socket after connect and to the sockets of the
+ * server's NetworkBackend::Epoll. The sockets of the default server network layer are owned by
+ * open62541 and keep their defaults.
+ *
+ * @see Client::setTransportConfig
+ * @see Server::setTransportConfig
+ * @see https://reference.opcfoundation.org/Core/Part6/v105/docs/7.1.2
+ */
+struct TransportConfig {
+    /// Size of the send buffer, i.e. the maximum size of sent chunks in bytes (min 8192).
+    std::optional<uint32_t> sendBufferSize;
+    /// Size of the receive buffer, i.e. the maximum size of received chunks in bytes (min 8192).
+    std::optional<uint32_t> recvBufferSize;
+    /// Maximum size of a received message in bytes, `0` for no limit.
+    std::optional<uint32_t> maxMessageSize;
+    /// Maximum number of chunks of a received message, `0` for no limit.
+    std::optional<uint32_t> maxChunkCount;
+    /// Disable Nagle's algorithm (socket option `TCP_NODELAY`).
+    std::optional<bool> noDelay;
+    /// Size of the kernel send buffer of the socket in bytes (socket option `SO_SNDBUF`).
+    std::optional<uint32_t> socketSendBufferSize;
+    /// Size of the kernel receive buffer of the socket in bytes (socket option `SO_RCVBUF`).
+    std::optional<uint32_t> socketRecvBufferSize;
+};
+
 namespace detail {
 
 using BuiltinTypes = std::tuple<
@@ -0,0 +1,133 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+namespace opcua {
+
+/**
+ * @defgroup Compression Payload compression
+ * Opt-in compression of large values, e.g. camera frames or waveforms.
+ *
+ * A compressed value is a ByteString scalar with a self-describing header: a magic number, the
+ * compression algorithm and the uncompressed size, followed by the compressed binary encoding of
+ * the original Variant (including its data type and array dimensions). Both ends agree on the
+ * convention by using these functions, readers detect compressed payloads by their header with
+ * @ref isCompressedPayload. Variables serving compressed payloads should be declared with the data
+ * type `BaseDataType` and the value rank `Any`.
+ *
+ * The library doesn't depend on a compression library, the algorithms are provided as
+ * CompressionCodec callbacks, e.g. with LZ4:
+ *
+ * @code
+ * CompressionCodec lz4{
+ *     CompressionAlgorithm::Lz4,
+ *     [](size_t size) { return static_cast<size_t>(LZ4_compressBound(static_cast<int>(size))); },
+ *     [](Span<const uint8_t> in, Span<uint8_t> out) -> size_t {
+ *         return LZ4_compress_default(...);
+ *     },
+ *     [](Span<const uint8_t> in, Span<uint8_t> out) -> size_t {
+ *         return LZ4_decompress_safe(...);
+ *     },
+ * };
+ * @endcode
+ *
+ * @note Only available with open62541 >= v1.3
+ * @{
+ */
+
+/// Compression algorithm identifier stored in the payload header.
+enum class CompressionAlgorithm : uint8_t {
+    // clang-format off
+    None   = 0,  ///< Uncompressed binary encoding (no codec callbacks required)
+    Lz4    = 1,
+    Zstd   = 2,
+    Custom = 128,  ///< First identifier for application-defined algorithms
+    // clang-format on
+};
+
+/// Compression codec callbacks, all callbacks are required except for CompressionAlgorithm::None.
+struct CompressionCodec {
+    CompressionAlgorithm algorithm{CompressionAlgorithm::None};
+    /// Get the maximum compressed size of an input with the given size (worst case).
+    std::function<size_t(size_t inputSize)> maxCompressedSize;
+    /// Compress input into output (sized with maxCompressedSize), return the compressed size.
+    std::function<size_t(Span<const uint8_t> input, Span<uint8_t> output)> compress;
+    /// Decompress input into output (sized to the uncompressed size), return the output size.
+    std::function<size_t(Span<const uint8_t> input, Span<uint8_t> output)> decompress;
+};
+
+/// Compression options.
+struct CompressionOptions {
+    /// Only values with a larger binary encoding are compressed.
+    size_t minSize{64 * 1024};
+    /// Maximum accepted uncompressed size of received payloads.
+    size_t maxDecompressedSize{size_t{256} * 1024 * 1024};
+};
+
+/// Check if the value is a compressed payload.
+bool isCompressedPayload(const Variant& value) noexcept;
+
+/**
+ * Compress value in place if its encoded size exceeds the minimum size.
+ * The value is left unchanged if it is small, already compressed or the compression doesn't reduce
+ * the size.
+ * @return `true` if the value was compressed
+ * @exception BadStatus (BadInvalidArgument) If the codec callbacks are missing
+ */
+bool compressValue(
+    Variant& value, const CompressionCodec& codec, const CompressionOptions& options = {}
+);
+
+/**
+ * Decompress value in place if it is a compressed payload.
+ * @param value Value, replaced by the original value if compressed
+ * @param codecs Available codecs, CompressionAlgorithm::None is always supported
+ * @param options Compression options
+ * @return `true` if the value was decompressed
+ * @exception BadStatus (BadDataEncodingUnsupported) If no codec of the algorithm is available
+ * @exception BadStatus (BadDecodingError) If the payload is corrupt or exceeds the maximum size
+ */
+bool decompressValue(
+    Variant& value, Span<const CompressionCodec> codecs, const CompressionOptions& options = {}
+);
+
+/**
+ * Wrap a data source to compress read values and decompress written values.
+ * Use it with Server::setVariableNodeValueBackend.
+ */
+ValueBackendDataSource compressDataSource(
+    ValueBackendDataSource source, CompressionCodec codec, CompressionOptions options = {}
+);
+
+/// Read the value attribute of a node and decompress it if it is a compressed payload.
+/// @exception BadStatus If the read fails or the payload can't be decompressed
+template <typename T>
+Variant readValueDecompressed(
+    T& serverOrClient,
+    const NodeId& id,
+    Span<const CompressionCodec> codecs,
+    const CompressionOptions& options = {}
+) {
+    Variant value = services::readValue(serverOrClient, id);
+    decompressValue(value, codecs, options);
+    return value;
+}
+
+/**
+ * @}
+ */
+
+}  // namespace opcua
+
+#endif
@@ -35,3 +35,22 @@
     (defined(UA_ENABLE_ENCRYPTION_OPENSSL) || defined(UA_ENABLE_ENCRYPTION_LIBRESSL))
 #define UAPP_CREATE_CERTIFICATE
 #endif
+
+// asynchronous method calls require the thread-safe server API
+#if defined(UA_ENABLE_METHODCALLS) && defined(UA_MULTITHREADING) && (UA_MULTITHREADING >= 100)
+#define UAPP_ASYNC_METHODS
+#endif
+
+// polymorphic memory resources (std::pmr), missing in older standard libraries (libc++ < 16)
+#if defined(__has_include)
+#if __has_include(<memory_resource>)
+#define UAPP_HAS_PMR
+#endif
+#endif
+
+// C++20 coroutines
+#if defined(__cpp_impl_coroutine) && defined(__has_include)
+#if __has_include(<coroutine>)
+#define UAPP_HAS_COROUTINES
+#endif
+#endif
@@ -6,9 +6,52 @@
 #include "open62541pp/Span.h"
 #include "open62541pp/types/Builtin.h"
 
+namespace opcua::crypto {
+
+/// Crypto backend of open62541, selected at build time with `UA_ENABLE_ENCRYPTION`.
+enum class CryptoBackend {
+    None,  ///< Built without encryption
+    MbedTls,
+    OpenSsl,
+    LibreSsl,
+};
+
+/**
+ * Get the crypto backend of open62541, CryptoBackend::None if built without encryption.
+ *
+ * The backend signs and encrypts every message chunk (HMAC-SHA256, AES-CBC with Basic256Sha256).
+ * OpenSSL and LibreSSL detect and use AES-NI at runtime. mbedTLS uses AES-NI only if it was built
+ * with `MBEDTLS_AESNI_C` (default on x86-64), otherwise a much slower software implementation is
+ * used. The backend can't be switched at runtime, rebuild open62541 with
+ * `UA_ENABLE_ENCRYPTION=OPENSSL` instead. Larger message chunks reduce the per-chunk overhead
+ * independent of the backend (see TransportConfig).
+ */
+constexpr CryptoBackend getCryptoBackend() noexcept {
+#if !defined(UA_ENABLE_ENCRYPTION)
+    return CryptoBackend::None;
+#elif defined(UA_ENABLE_ENCRYPTION_OPENSSL)
+    return CryptoBackend::OpenSsl;
+#elif defined(UA_ENABLE_ENCRYPTION_LIBRESSL)
+    return CryptoBackend::LibreSsl;
+#else
+    return CryptoBackend::MbedTls;
+#endif
+}
+
 #ifdef UA_ENABLE_ENCRYPTION
 
-namespace opcua::crypto {
+/**
+ * Decode a PEM encoded certificate or private key to DER.
+ *
+ * open62541 accepts both formats, but PEM data is decoded again by the crypto backend whenever a
+ * client or server configuration is created. Decode the credentials once (e.g. after
+ * ByteString::fromFile) and pass the DER encoding to create many clients or reconnect cheaply.
+ * Data without a PEM block (e.g. DER) is returned unchanged, only the first PEM block is decoded.
+ *
+ * @exception BadStatus (BadDecodingError) If the PEM block is malformed
+ * @exception BadStatus (BadNotSupported) If the PEM block is encrypted
+ */
+ByteString convertPemToDer(const ByteString& data);
 
 #ifdef UAPP_CREATE_CERTIFICATE
 
@@ -52,6 +95,6 @@ CreateCertificateResult createCertificate(
 
 #endif  // ifdef UAPP_CREATE_CERTIFICATE
 
-}  // namespace opcua::crypto
-
 #endif  // ifdef UA_ENABLE_ENCRYPTION
+
+}  // namespace opcua::crypto
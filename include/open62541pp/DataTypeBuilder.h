@@ -1,11 +1,15 @@
 #pragma once
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdint>
+#include <stdexcept>  // invalid_argument
 #include <type_traits>
 #include <utility>  // move
 #include <vector>
 
+#include "open62541pp/Config.h"
 #include "open62541pp/DataType.h"
 #include "open62541pp/TypeConverter.h"
 #include "open62541pp/detail/helper.h"
@@ -327,4 +331,223 @@ template <typename T, typename Tag>
     return dataType_;
 }
 
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+/* ------------------------------------ Static structure type ----------------------------------- */
+
+namespace detail {
+
+/// Size of the binary encoding matches the memory layout (fixed-size integers and floats).
+template <typename TMember>
+constexpr bool isOverlayableMember() {
+    if constexpr (std::is_same_v<TMember, bool> || !std::is_arithmetic_v<TMember>) {
+        return false;
+    } else if constexpr (std::is_floating_point_v<TMember>) {
+        return UA_BINARY_OVERLAYABLE_FLOAT;
+    } else {
+        return UA_BINARY_OVERLAYABLE_INTEGER;
+    }
+}
+
+template <typename TMember>
+constexpr const UA_DataType* guessStaticDataType() {
+    using ValueType = UnqualifiedT<TMember>;
+    static_assert(
+        TypeConverter<ValueType>::ValidTypes::size() == 1,
+        "Ambiguous data type, please specify data type manually"
+    );
+    constexpr auto typeIndex = TypeConverter<ValueType>::ValidTypes::toArray().at(0);
+    return &UA_TYPES[typeIndex];  // NOLINT
+}
+
+}  // namespace detail
+
+/// Field of a StaticStructureType, create with @ref staticField or @ref staticArrayField.
+template <typename T>
+struct StaticField {
+    const char* name;
+    const UA_DataType* type;
+    size_t size;  // scalar or size and array pointer
+    size_t alignment;
+    bool isArray;
+    bool pointerFree;
+    bool overlayable;
+};
+
+/**
+ * Create a scalar field of a StaticStructureType.
+ * @tparam field Member pointer, e.g. `&S::value`
+ * @param fieldName Human-readable field name
+ * @param fieldType Member data type, must have static storage duration
+ */
+template <auto field, typename T = detail::MemberClassT<decltype(field)>>
+constexpr StaticField<T> staticField(const char* fieldName, const UA_DataType& fieldType) {
+    using TMember = detail::MemberTypeT<decltype(field)>;
+    static_assert(!std::is_pointer_v<TMember>, "Optional fields are not supported");
+    constexpr bool trivial = std::is_arithmetic_v<TMember> || std::is_enum_v<TMember>;
+    return {
+        fieldName,
+        &fieldType,
+        sizeof(TMember),
+        alignof(TMember),
+        false,
+        trivial,
+        detail::isOverlayableMember<TMember>(),
+    };
+}
+
+/// Create a scalar field of a StaticStructureType (derive the data type from `field`).
+/// @overload
+template <auto field, typename T = detail::MemberClassT<decltype(field)>>
+constexpr StaticField<T> staticField(const char* fieldName) {
+    return staticField<field>(
+        fieldName, *detail::guessStaticDataType<detail::MemberTypeT<decltype(field)>>()
+    );
+}
+
+/**
+ * Create an array field of a StaticStructureType.
+ * Arrays consist of two consecutive members: the size (of type `size_t`) and the data pointer.
+ * @tparam fieldSize Member pointer to the size field, e.g. `&S::length`
+ * @tparam fieldArray Member pointer to the array field, e.g. `&S::data`
+ * @param fieldName Human-readable field name
+ * @param fieldType Member data type, must have static storage duration
+ */
+template <
+    auto fieldSize,
+    auto fieldArray,
+    typename T = detail::MemberClassT<decltype(fieldArray)>>
+constexpr StaticField<T> staticArrayField(const char* fieldName, const UA_DataType& fieldType) {
+    using TSize = detail::MemberTypeT<decltype(fieldSize)>;
+    using TArray = detail::MemberTypeT<decltype(fieldArray)>;
+    static_assert(std::is_same_v<TSize, size_t>, "TSize must be size_t");
+    static_assert(std::is_pointer_v<TArray>, "TArray must be a pointer");
+    static_assert(alignof(TArray) <= alignof(TSize), "No padding between size and array allowed");
+    return {
+        fieldName, &fieldType, sizeof(TSize) + sizeof(TArray), alignof(TSize), true, false, false
+    };
+}
+
+/// Create an array field of a StaticStructureType (derive the data type from `fieldArray`).
+/// @overload
+template <
+    auto fieldSize,
+    auto fieldArray,
+    typename T = detail::MemberClassT<decltype(fieldArray)>>
+constexpr StaticField<T> staticArrayField(const char* fieldName) {
+    using TArray = detail::MemberTypeT<decltype(fieldArray)>;
+    return staticArrayField<fieldSize, fieldArray>(
+        fieldName, *detail::guessStaticDataType<std::remove_pointer_t<TArray>>()
+    );
+}
+
+/**
+ * Structure data type with a compile-time generated UA_DataType descriptor.
+ *
+ * Alternative to DataTypeBuilder::createStructure without any runtime cost: the UA_DataType and
+ * UA_DataTypeMember tables are generated by the compiler. The fields must be given in declaration
+ * order, the paddings are derived from the sizes and alignments of the members. The computed
+ * layout is checked against the size of `T` and the flags `pointerFree` and `overlayable` are
+ * deduced, so structures of fixed-size numbers can be encoded with `memcpy`.
+ *
+ * The descriptor references itself, so it must have static storage duration:
+ *
+ * @code
+ * struct Point { float x; float y; float z; };
+ * inline constexpr StaticStructureType pointType(
+ *     "Point", 1, 4242, 1,
+ *     {staticField<&Point::x>("x"), staticField<&Point::y>("y"), staticField<&Point::z>("z")}
+ * );
+ * client.setCustomDataTypes({pointType.getDataType()});
+ * @endcode
+ *
+ * Optional fields and unions are not supported, use DataTypeBuilder instead.
+ * @note Only available with open62541 >= v1.3
+ */
+template <typename T, size_t N>
+class StaticStructureType {
+public:
+    static_assert(std::is_standard_layout_v<T>, "T must have a standard layout");
+
+    /**
+     * @param typeName Human-readable type name
+     * @param namespaceIndex Namespace index of the type id and binary encoding id
+     * @param typeId Numeric identifier of the type id
+     * @param binaryEncodingId Numeric identifier of the binary encoding id
+     * @param fields Fields of the structure in declaration order
+     */
+    constexpr StaticStructureType(
+        const char* typeName,
+        uint16_t namespaceIndex,
+        uint32_t typeId,
+        uint32_t binaryEncodingId,
+        const StaticField<T> (&fields)[N]  // NOLINT
+    ) {
+        static_assert(N > 0 && N <= 255, "Invalid number of fields");
+        size_t end = 0;
+        bool pointerFree = true;
+        bool overlayable = true;
+        for (size_t i = 0; i < N; ++i) {
+            const auto& field = fields[i];  // NOLINT
+            const size_t offset = (end + field.alignment - 1) / field.alignment * field.alignment;
+            if (offset - end > 63) {
+                throw std::invalid_argument("Padding between members exceeds 63 bytes");
+            }
+            auto& member = members_[i];
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+            member.memberName = field.name;
+#endif
+            member.memberType = field.type;
+            member.padding = static_cast<uint8_t>(offset - end);
+            member.isArray = field.isArray;
+            member.isOptional = false;
+            pointerFree = pointerFree && field.pointerFree;
+            overlayable = overlayable && field.overlayable && offset == end;
+            end = offset + field.size;
+        }
+        if ((end + alignof(T) - 1) / alignof(T) * alignof(T) != sizeof(T)) {
+            throw std::invalid_argument("Fields don't match the memory layout of T");
+        }
+#ifdef UA_ENABLE_TYPEDESCRIPTION
+        dataType_.typeName = typeName;
+#else
+        static_cast<void>(typeName);
+#endif
+        dataType_.typeId.namespaceIndex = namespaceIndex;
+        dataType_.typeId.identifierType = UA_NODEIDTYPE_NUMERIC;
+        dataType_.typeId.identifier.numeric = typeId;
+        dataType_.binaryEncodingId.namespaceIndex = namespaceIndex;
+        dataType_.binaryEncodingId.identifierType = UA_NODEIDTYPE_NUMERIC;
+        dataType_.binaryEncodingId.identifier.numeric = binaryEncodingId;
+        dataType_.memSize = sizeof(T);
+        dataType_.typeKind = UA_DATATYPEKIND_STRUCTURE;
+        dataType_.pointerFree = pointerFree;
+        dataType_.overlayable = overlayable && end == sizeof(T);
+        dataType_.membersSize = N;
+        dataType_.members = const_cast<UA_DataTypeMember*>(members_.data());  // NOLINT
+    }
+
+    // the descriptor points to its own members
+    StaticStructureType(const StaticStructureType&) = delete;
+    StaticStructureType(StaticStructureType&&) = delete;
+    StaticStructureType& operator=(const StaticStructureType&) = delete;
+    StaticStructureType& operator=(StaticStructureType&&) = delete;
+
+    /// Implicit conversion to UA_DataType, e.g. for ExtensionObject::fromDecoded or Variant.
+    constexpr operator const UA_DataType&() const noexcept {  // NOLINT
+        return dataType_;
+    }
+
+    /// Get a DataType (copy), e.g. for Client::setCustomDataTypes.
+    DataType getDataType() const {
+        return DataType(dataType_);
+    }
+
+private:
+    std::array<UA_DataTypeMember, N> members_{};
+    UA_DataType dataType_{};
+};
+
+#endif
+
 }  // namespace opcua
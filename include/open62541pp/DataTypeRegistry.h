@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "open62541pp/DataType.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/detail/hash.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Immutable registry of custom data types, shared by multiple servers and clients.
+ *
+ * Client::setCustomDataTypes and Server::setCustomDataTypes with a vector copy the data types into
+ * each instance. A registry holds a single copy of the data types and its native
+ * `UA_DataTypeArray`, which is referenced by all servers and clients it is attached to. The
+ * registry is reference counted and kept alive by the attached instances.
+ *
+ * Registries can be chained with a parent registry (e.g. common types and application-specific
+ * types). The chain is linked with `UA_DataTypeArray::next`, so open62541 considers the types of
+ * all registries for decoding.
+ *
+ * The data types can be looked up in constant time by type id or binary encoding id, e.g. to
+ * decode extension objects with ExtensionObject::decode. Each registry builds a perfect hash index
+ * of its data types once on creation, so lookups don't depend on the number of data types.
+ *
+ * @code
+ * auto registry = DataTypeRegistry::create({pointType, measurementsType});
+ * for (auto& client : clients) {
+ *     client.setCustomDataTypes(registry);
+ * }
+ * @endcode
+ */
+class DataTypeRegistry {
+public:
+    /**
+     * Create a registry.
+     * @param dataTypes Custom data types
+     * @param parent Optional parent registry, searched after the data types of this registry
+     */
+    static std::shared_ptr<const DataTypeRegistry> create(
+        std::vector<DataType> dataTypes, std::shared_ptr<const DataTypeRegistry> parent = nullptr
+    );
+
+    DataTypeRegistry(const DataTypeRegistry&) = delete;
+    DataTypeRegistry(DataTypeRegistry&&) noexcept = delete;
+    DataTypeRegistry& operator=(const DataTypeRegistry&) = delete;
+    DataTypeRegistry& operator=(DataTypeRegistry&&) noexcept = delete;
+
+    ~DataTypeRegistry() = default;
+
+    /// Get the data types of this registry (without the parent registries).
+    Span<const DataType> getDataTypes() const noexcept {
+        return dataTypes_;
+    }
+
+    /// Get the parent registry (`nullptr` if none).
+    const std::shared_ptr<const DataTypeRegistry>& getParent() const noexcept {
+        return parent_;
+    }
+
+    /// Find a data type by its type id, including the parent registries.
+    /// @return Data type or `nullptr` if not found
+    const UA_DataType* findByTypeId(const NodeId& typeId) const noexcept;
+
+    /// Find a data type by its binary encoding id, including the parent registries.
+    /// @return Data type or `nullptr` if not found
+    const UA_DataType* findByBinaryEncodingId(const NodeId& binaryEncodingId) const noexcept;
+
+    /// Find a builtin data type (`UA_TYPES`) by its type id.
+    /// @return Data type or `nullptr` if not found
+    static const UA_DataType* findBuiltinByTypeId(const NodeId& typeId) noexcept;
+
+    /// Find a builtin data type (`UA_TYPES`) by its binary encoding id.
+    /// @return Data type or `nullptr` if not found
+    static const UA_DataType* findBuiltinByBinaryEncodingId(
+        const NodeId& binaryEncodingId
+    ) noexcept;
+
+    /// Get the native array, chained with the arrays of the parent registries.
+    const UA_DataTypeArray* handle() const noexcept {
+        return array_.get();
+    }
+
+private:
+    DataTypeRegistry(
+        std::vector<DataType> dataTypes, std::shared_ptr<const DataTypeRegistry> parent
+    );
+
+    std::vector<DataType> dataTypes_;
+    std::shared_ptr<const DataTypeRegistry> parent_;
+    std::unique_ptr<UA_DataTypeArray> array_;
+    detail::PerfectHashMap<NodeId, const UA_DataType*> byTypeId_;
+    detail::PerfectHashMap<NodeId, const UA_DataType*> byBinaryEncodingId_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Result.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Composed.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Cache of discovery results (FindServers and GetEndpoints) by server URL.
+ *
+ * Attach the cache to a client with Client::setDiscoveryCache; Client::findServers and
+ * Client::getEndpoints are then served from the cache. Failed requests (e.g. unreachable servers)
+ * can be cached as well to skip them in repeated network scans.
+ * The cache is thread-safe and can be shared by multiple clients and Discovery instances.
+ */
+class DiscoveryCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Create a discovery cache.
+     * @param timeToLive Expiration time of successful results, entries never expire if zero
+     * @param failureTimeToLive Expiration time of failed requests, failures are not cached if zero
+     */
+    explicit DiscoveryCache(
+        Clock::duration timeToLive = std::chrono::minutes(10),
+        Clock::duration failureTimeToLive = Clock::duration::zero()
+    )
+        : timeToLive_(timeToLive),
+          failureTimeToLive_(failureTimeToLive) {}
+
+    /// Get the cached result of FindServers, `std::nullopt` on a cache miss.
+    std::optional<Result<std::vector<ApplicationDescription>>> findServers(
+        std::string_view serverUrl
+    );
+
+    /// Get the cached result of GetEndpoints, `std::nullopt` on a cache miss.
+    std::optional<Result<std::vector<EndpointDescription>>> findEndpoints(
+        std::string_view serverUrl
+    );
+
+    /// Insert or replace the result of FindServers.
+    void insertServers(
+        std::string_view serverUrl, Result<std::vector<ApplicationDescription>> result
+    );
+
+    /// Insert or replace the result of GetEndpoints.
+    void insertEndpoints(
+        std::string_view serverUrl, Result<std::vector<EndpointDescription>> result
+    );
+
+    /// Remove the entries of a server URL, e.g. after the server certificate changed.
+    void invalidate(std::string_view serverUrl);
+
+    /// Remove all entries.
+    void clear();
+
+    /// Number of cached server URLs.
+    size_t size() const;
+
+    /// Number of cache hits and misses since creation.
+    uint64_t getHitCount() const noexcept {
+        return hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getMissCount() const noexcept {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+private:
+    template <typename T>
+    struct Slot {
+        std::optional<Result<std::vector<T>>> result;
+        Clock::time_point inserted;
+    };
+
+    struct Entry {
+        Slot<ApplicationDescription> servers;
+        Slot<EndpointDescription> endpoints;
+    };
+
+    template <typename T>
+    std::optional<Result<std::vector<T>>> find(std::string_view serverUrl, Slot<T> Entry::*slot);
+
+    template <typename T>
+    void insert(std::string_view serverUrl, Slot<T> Entry::*slot, Result<std::vector<T>> result);
+
+    Clock::duration timeToLive_;
+    Clock::duration failureTimeToLive_;
+    mutable std::mutex mutex_;
+    std::unordered_map<std::string, Entry> entries_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+/**
+ * Options of Discovery.
+ */
+struct DiscoveryOptions {
+    /// Number of concurrent requests, each served by a thread with its own discovery connection.
+    size_t connections{8};
+    /// Timeout of a request in milliseconds, including the connect.
+    uint32_t timeout{2000};
+};
+
+/**
+ * Discovery of many servers with concurrent requests and a shared result cache.
+ *
+ * Client::findServers and Client::getEndpoints perform a blocking round-trip per server. Discovery
+ * distributes the server URLs of a scan to a small pool of discovery clients (without session),
+ * each request opens a secure channel, sends the request and closes the channel again. Results of
+ * the cache are returned without network access, new results are inserted into the cache.
+ *
+ * @code
+ * Discovery discovery({32, 1000}, std::make_shared<DiscoveryCache>(
+ *     std::chrono::minutes(10), std::chrono::minutes(1)  // skip unreachable servers for a minute
+ * ));
+ * const auto results = discovery.getEndpoints(urls);
+ * for (size_t i = 0; i < urls.size(); ++i) {
+ *     if (results[i]) { ... }
+ * }
+ * @endcode
+ */
+class Discovery {
+public:
+    /**
+     * Create a discovery helper.
+     * @param options Concurrency and timeouts
+     * @param cache Result cache, a cache with the default expiration times is created if `nullptr`
+     */
+    explicit Discovery(DiscoveryOptions options = {}, std::shared_ptr<DiscoveryCache> cache = {});
+
+    ~Discovery();
+
+    Discovery(const Discovery&) = delete;
+    Discovery(Discovery&&) noexcept = delete;
+    Discovery& operator=(const Discovery&) = delete;
+    Discovery& operator=(Discovery&&) noexcept = delete;
+
+    /**
+     * Get the registered servers of each server URL (FindServers).
+     * Scans of the same instance are serialized.
+     * @returns Results in the order of the server URLs
+     */
+    std::vector<Result<std::vector<ApplicationDescription>>> findServers(
+        Span<const std::string> serverUrls
+    );
+
+    /**
+     * Get the endpoints of each server URL (GetEndpoints).
+     * @copydetails findServers
+     */
+    std::vector<Result<std::vector<EndpointDescription>>> getEndpoints(
+        Span<const std::string> serverUrls
+    );
+
+    /// Get the result cache.
+    const std::shared_ptr<DiscoveryCache>& getCache() const noexcept;
+
+private:
+    template <typename T, typename Find, typename Request>
+    std::vector<Result<std::vector<T>>> scan(
+        Span<const std::string> serverUrls, Find&& find, Request&& request
+    );
+
+    DiscoveryOptions options_;
+    std::shared_ptr<DiscoveryCache> cache_;
+    std::mutex mutex_;
+    std::vector<std::unique_ptr<Client>> clients_;  // created on demand, reused by scans
+};
+
+}  // namespace opcua
@@ -2,8 +2,10 @@
 
 #include <cstdint>
 #include <string_view>
+#include <vector>
 
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/NodeId.h"
 
@@ -70,4 +72,51 @@ private:
 bool operator==(const Event& lhs, const Event& rhs) noexcept;
 bool operator!=(const Event& lhs, const Event& rhs) noexcept;
 
+/**
+ * Reusable event with pre-resolved fields for frequently triggered events (e.g. alarms).
+ *
+ * The node representation is created once and reused for every trigger. The NodeIds of the
+ * fields are resolved once on construction, so triggering writes the values directly into the
+ * field nodes without browse path lookups or node creation/deletion.
+ *
+ * @code
+ * EventTemplate alarm(server, ObjectTypeId::BaseEventType, {{0, "Severity"}, {0, "Message"}});
+ * alarm.trigger({Variant::fromScalar(uint16_t{500}), Variant::fromScalar(message)});
+ * @endcode
+ */
+class EventTemplate {
+public:
+    /// Create the node representation and resolve the fields.
+    /// @exception BadStatus (BadNoMatch) If a field doesn't exist in the event type
+    EventTemplate(Server& server, const NodeId& eventType, Span<const QualifiedName> fields);
+
+    EventTemplate(const EventTemplate&) = delete;
+    EventTemplate(EventTemplate&&) noexcept = default;
+
+    EventTemplate& operator=(const EventTemplate&) = delete;
+    EventTemplate& operator=(EventTemplate&&) noexcept = delete;
+
+    /// Get the underlying event.
+    Event& getEvent() noexcept;
+
+    /// Get the fields in the order of the trigger values.
+    Span<const QualifiedName> getFields() const noexcept;
+
+    /// Get the NodeIds of the resolved fields.
+    Span<const NodeId> getFieldIds() const noexcept;
+
+    /// Write the field values and trigger the event.
+    /// Empty variants keep the value of the previous trigger.
+    /// @param values Values in the order of the fields
+    /// @param originId Origin node of the event (requires `EventNotifier` attribute)
+    /// @return Unique `EventId` generated by server
+    /// @exception BadStatus (BadInvalidArgument) If the number of values doesn't match the fields
+    ByteString trigger(Span<const Variant> values, const NodeId& originId = ObjectId::Server);
+
+private:
+    Event event_;
+    std::vector<QualifiedName> fields_;
+    std::vector<NodeId> fieldIds_;
+};
+
 }  // namespace opcua
@@ -0,0 +1,101 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <cstddef>
+#include <functional>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+/**
+ * Typed select clauses of an event filter.
+ *
+ * Every select clause is mapped to a member of the user-defined event struct `T`. The index of
+ * each field in the event notifications and its decoder are fixed when the field is added, so
+ * decoding a notification is a single pass over the event fields without lookups.
+ * Fields that are empty or of another type keep the default value of the member.
+ *
+ * @code
+ * struct Alarm {
+ *     DateTime time;
+ *     uint16_t severity{};
+ *     LocalizedText message;
+ * };
+ * const auto fields = EventFields<Alarm>()
+ *                         .add(&Alarm::time, {{0, "Time"}})
+ *                         .add(&Alarm::severity, {{0, "Severity"}})
+ *                         .add(&Alarm::message, {{0, "Message"}});
+ * @endcode
+ *
+ * @tparam T Default-constructible event struct
+ * @see Subscription::subscribeEvent
+ */
+template <typename T>
+class EventFields {
+public:
+    /// Add a field with the browse path relative to the event type.
+    /// @param member Member pointer of the decoded field (scalar type)
+    /// @param browsePath Browse path of the field, e.g. `{{0, "Severity"}}`
+    /// @param typeDefinitionId Event type of the field
+    template <typename U>
+    EventFields& add(
+        U T::*member,
+        Span<const QualifiedName> browsePath,
+        const NodeId& typeDefinitionId = ObjectTypeId::BaseEventType
+    ) {
+        selectClauses_.emplace_back(typeDefinitionId, browsePath, AttributeId::Value);
+        decoders_.emplace_back([member](T& event, const Variant& variant) {
+            if (variant.isScalar() && detail::isValidTypeCombination<U>(variant.getDataType())) {
+                event.*member = variant.getScalarCopy<U>();
+            }
+        });
+        return *this;
+    }
+
+    /// Set the where clause of the event filter.
+    EventFields& setWhereClause(ContentFilter whereClause) {
+        whereClause_ = std::move(whereClause);
+        return *this;
+    }
+
+    /// Get the select clauses in the order of the event fields.
+    Span<const SimpleAttributeOperand> getSelectClauses() const noexcept {
+        return selectClauses_;
+    }
+
+    /// Create the event filter of the select and where clauses.
+    EventFilter createEventFilter() const {
+        return EventFilter(selectClauses_, whereClause_);
+    }
+
+    /// Decode the event fields of a notification (in the order of the select clauses).
+    T decode(Span<const Variant> eventFields) const {
+        T event{};
+        const size_t size = std::min(eventFields.size(), decoders_.size());
+        for (size_t i = 0; i < size; ++i) {
+            decoders_[i](event, eventFields[i]);
+        }
+        return event;
+    }
+
+private:
+    std::vector<SimpleAttributeOperand> selectClauses_;
+    std::vector<std::function<void(T&, const Variant&)>> decoders_;
+    ContentFilter whereClause_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,150 @@
+#pragma once
+
+#include <memory>
+#include <utility>  // forward, move
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+/**
+ * Immutable event filter shared by copies.
+ *
+ * The filter is built once (see EventFilterBuilder) and referenced by all monitored items it is
+ * used for, e.g. thousands of monitored event notifiers with the same select and where clauses.
+ */
+class SharedEventFilter {
+public:
+    explicit SharedEventFilter(EventFilter filter)
+        : filter_(std::make_shared<const EventFilter>(std::move(filter))) {}
+
+    const EventFilter& get() const noexcept {
+        return *filter_;
+    }
+
+    const EventFilter& operator*() const noexcept {
+        return *filter_;
+    }
+
+    const EventFilter* operator->() const noexcept {
+        return filter_.get();
+    }
+
+    /// Filter as ExtensionObject without a copy, e.g. for MonitoringParameters::filter.
+    /// The ExtensionObject references the shared filter and must not outlive it.
+    ExtensionObject toExtensionObject() const noexcept {
+        // NOLINTNEXTLINE, filter isn't modified, only encoded
+        return ExtensionObject::fromDecoded(const_cast<EventFilter&>(*filter_));
+    }
+
+private:
+    std::shared_ptr<const EventFilter> filter_;
+};
+
+/**
+ * Fluent builder of event filters.
+ *
+ * Select clauses return the `Value` attribute of the event fields, where clauses are combined
+ * with the `And` operator.
+ *
+ * @code
+ * const auto filter = EventFilterBuilder()
+ *                         .select({{0, "Time"}})
+ *                         .select({{0, "Severity"}})
+ *                         .select({{0, "Message"}})
+ *                         .whereOfType(ObjectTypeId::AlarmConditionType)
+ *                         .where({{0, "Severity"}}, FilterOperator::GreaterThanOrEqual, 500U)
+ *                         .build();
+ * for (const auto& notifier : notifiers) {
+ *     sub.subscribeEvent(notifier, filter, onEvent);  // references the shared filter
+ * }
+ * @endcode
+ *
+ * @see Subscription::subscribeEvent
+ */
+class EventFilterBuilder {
+public:
+    /// Add a select clause with the browse path relative to the event type.
+    /// @param browsePath Browse path of the field, e.g. `{{0, "Severity"}}`
+    /// @param typeDefinitionId Event type of the field
+    EventFilterBuilder& select(
+        Span<const QualifiedName> browsePath,
+        const NodeId& typeDefinitionId = ObjectTypeId::BaseEventType
+    ) {
+        selectClauses_.emplace_back(typeDefinitionId, browsePath, AttributeId::Value);
+        return *this;
+    }
+
+    /// Only pass events of the event type or its subtypes (`OfType` operator).
+    EventFilterBuilder& whereOfType(const NodeId& eventTypeId) {
+        return where(
+            ContentFilterElement(FilterOperator::OfType, {LiteralOperand(eventTypeId)})
+        );
+    }
+
+    /// Only pass events whose field compares to the literal with the operator, e.g.
+    /// `where({{0, "Severity"}}, FilterOperator::GreaterThanOrEqual, 500U)`.
+    template <typename T>
+    EventFilterBuilder& where(
+        Span<const QualifiedName> browsePath,
+        FilterOperator filterOperator,
+        T&& literal,
+        const NodeId& typeDefinitionId = ObjectTypeId::BaseEventType
+    ) {
+        return where(ContentFilterElement(
+            filterOperator,
+            {
+                SimpleAttributeOperand(typeDefinitionId, browsePath, AttributeId::Value),
+                LiteralOperand(std::forward<T>(literal)),
+            }
+        ));
+    }
+
+    /// Add a where clause element.
+    EventFilterBuilder& where(const ContentFilterElement& element) {
+        if (whereClause_.getElements().empty()) {
+            whereClause_ = ContentFilter{element};
+        } else {
+            whereClause_ = whereClause_ && element;
+        }
+        return *this;
+    }
+
+    /// Add a where clause.
+    EventFilterBuilder& where(const ContentFilter& filter) {
+        if (whereClause_.getElements().empty()) {
+            whereClause_ = filter;
+        } else if (!filter.getElements().empty()) {
+            whereClause_ = whereClause_ && filter;
+        }
+        return *this;
+    }
+
+    /// Get the select clauses in the order of the event fields.
+    Span<const SimpleAttributeOperand> getSelectClauses() const noexcept {
+        return selectClauses_;
+    }
+
+    /// Build the shared event filter.
+    SharedEventFilter build() const {
+        return SharedEventFilter(EventFilter(selectClauses_, whereClause_));
+    }
+
+private:
+    std::vector<SimpleAttributeOperand> selectClauses_;
+    ContentFilter whereClause_;
+};
+
+}  // namespace opcua
+
+#endif
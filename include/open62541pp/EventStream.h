@@ -0,0 +1,79 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+namespace detail {
+class EventStreamState;
+}  // namespace detail
+
+/**
+ * Options of an event stream.
+ * @see Server::createEventStream
+ */
+struct EventStreamOptions {
+    /// Maximum number of triggered events per second (0 = unlimited).
+    /// Events exceeding the rate stay queued and are triggered in the following intervals.
+    double maxRate{0};
+    /// Maximum number of queued events (0 = unlimited), the oldest events are dropped on overflow.
+    size_t maxQueueSize{10000};
+    /// Interval to trigger the queued events within the server's main loop.
+    std::chrono::milliseconds interval{50};
+};
+
+/**
+ * Thread-safe stream of events of the same type and origin.
+ *
+ * Events can be pushed from any thread into a queue. The queued events are triggered in batches
+ * within the server's main loop (Server::runIterate) with an EventTemplate, limited to the
+ * configured maximum rate. Events with the same condition key replace the queued event with that
+ * key (coalescing), e.g. to collapse the updates of a flapping alarm within a burst.
+ *
+ * The queue is shared with the server and stays valid as long as the server exists.
+ *
+ * @see Server::createEventStream
+ */
+class EventStream {
+public:
+    /// Get the fields in the order of the pushed values.
+    Span<const QualifiedName> getFields() const noexcept;
+
+    /// Queue an event with the values of the fields (thread-safe).
+    /// @exception BadStatus (BadInvalidArgument) If the number of values doesn't match the fields
+    void push(std::vector<Variant> values);
+
+    /// Queue an event and replace a queued event with the same condition key (thread-safe).
+    /// @exception BadStatus (BadInvalidArgument) If the number of values doesn't match the fields
+    void push(std::string_view conditionKey, std::vector<Variant> values);
+
+    /// Number of queued events.
+    size_t getQueueSize() const;
+
+    /// Number of events dropped due to queue overflow.
+    uint64_t getDroppedCount() const noexcept;
+
+    /// Number of events replaced by a newer event with the same condition key.
+    uint64_t getCoalescedCount() const noexcept;
+
+    /// Number of triggered events.
+    uint64_t getTriggeredCount() const noexcept;
+
+private:
+    friend class Server;
+
+    explicit EventStream(std::shared_ptr<detail::EventStreamState> state);
+
+    std::shared_ptr<detail::EventStreamState> state_;
+};
+
+}  // namespace opcua
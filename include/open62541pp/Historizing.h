@@ -0,0 +1,19 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace opcua {
+
+/**
+ * Retention of the in-memory history of a variable node.
+ * @see Server::enableHistorizing
+ */
+struct HistorizingOptions {
+    /// Maximum number of stored values, the oldest values are overwritten (ring buffer).
+    size_t capacity{10000};
+    /// Maximum age of stored values relative to the newest value (`0` = unlimited).
+    std::chrono::milliseconds maxAge{0};
+};
+
+}  // namespace opcua
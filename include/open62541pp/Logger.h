@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <functional>
+#include <memory>
 #include <string_view>
 
+#include "open62541pp/ThreadConfig.h"
+
 // forward declare
 struct UA_Client;
 struct UA_Server;
@@ -10,6 +14,7 @@ struct UA_Server;
 namespace opcua {
 
 // forward declare
+class BinaryLogSink;
 class Client;
 class Server;
 
@@ -43,6 +48,32 @@ enum class LogCategory {
 /// Log function signature.
 using Logger = std::function<void(LogLevel, LogCategory, std::string_view msg)>;
 
+/**
+ * Options of the custom logger.
+ * @see Server::setLogger
+ * @see Client::setLogger
+ */
+struct LoggerOptions {
+    /// Minimum log level, messages with lower levels are discarded before they are formatted.
+    LogLevel minLevel = LogLevel::Trace;
+    /// Format messages into a preallocated lock-free ring buffer and invoke the logger in a
+    /// background thread. The logging thread never blocks or allocates. If the buffer is full,
+    /// messages are dropped and the number of dropped messages is reported with a warning.
+    /// Messages longer than @ref asyncMaxMessageLength are truncated.
+    bool async = false;
+    /// Capacity of the ring buffer (number of messages) in async mode, rounded to a power of two.
+    size_t asyncCapacity = 1024;
+    /// Configuration of the background thread in async mode (CPU affinity, priority, NUMA node).
+    ThreadConfig asyncThreadConfig;
+    /// Write messages to a binary log with deferred formatting instead of invoking the logger.
+    /// The logger function may be empty in this case.
+    /// @see BinaryLogSink
+    std::shared_ptr<BinaryLogSink> binarySink;
+};
+
+/// Maximum message length in async mode.
+inline constexpr size_t asyncMaxMessageLength = 499;
+
 /// Generate log message with client's logger.
 void log(UA_Client* client, LogLevel level, LogCategory category, std::string_view msg);
 
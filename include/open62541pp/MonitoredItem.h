@@ -1,6 +1,7 @@
 #pragma once
 
 #include <cstdint>
+#include <optional>
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
@@ -65,6 +66,11 @@ public:
     /// @see services::setMonitoringMode
     void setMonitoringMode(MonitoringMode monitoringMode);
 
+    /// Set a client-side data change filter, discarding unchanged or sub-deadband notifications.
+    /// Pass `std::nullopt` to remove the filter.
+    /// @see services::setClientDataChangeFilter
+    void setClientDataChangeFilter(std::optional<services::ClientDataChangeFilter> filter);
+
     /// Delete this monitored item.
     /// @see services::deleteMonitoredItem
     void deleteMonitoredItem();
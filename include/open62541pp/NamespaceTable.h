@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace opcua {
+
+/**
+ * Immutable table of namespace URIs with constant time lookups in both directions.
+ *
+ * The table is a snapshot of the `NamespaceArray` variable of a server. Server::getNamespaceTable
+ * and Client::getNamespaceTable return cached tables, so namespace URIs can be resolved before
+ * constructing node ids without reading the `NamespaceArray` every time.
+ *
+ * @code
+ * auto table = client.getNamespaceTable();
+ * if (auto index = table->find("http://example.com/")) {
+ *     NodeId id(*index, "Temperature");
+ * }
+ * @endcode
+ */
+class NamespaceTable {
+public:
+    NamespaceTable() = default;
+    explicit NamespaceTable(std::vector<std::string> uris);
+
+    NamespaceTable(const NamespaceTable& other);
+    NamespaceTable(NamespaceTable&& other) noexcept = default;
+    NamespaceTable& operator=(const NamespaceTable& other);
+    NamespaceTable& operator=(NamespaceTable&& other) noexcept = default;
+
+    ~NamespaceTable() = default;
+
+    /// Number of namespaces.
+    size_t size() const noexcept {
+        return uris_.size();
+    }
+
+    /// Get all namespace URIs, ordered by namespace index.
+    const std::vector<std::string>& getUris() const noexcept {
+        return uris_;
+    }
+
+    /// Get the URI of a namespace index.
+    /// @return Namespace URI or `std::nullopt` if the index is unknown
+    std::optional<std::string_view> getUri(uint16_t namespaceIndex) const noexcept;
+
+    /// Find the namespace index of a URI. The first index is returned for duplicate URIs.
+    /// @return Namespace index or `std::nullopt` if the URI is unknown
+    std::optional<uint16_t> find(std::string_view uri) const noexcept;
+
+private:
+    void buildIndex();
+
+    std::vector<std::string> uris_;
+    std::unordered_map<std::string_view, uint16_t> indexes_;  // views into uris_
+};
+
+}  // namespace opcua
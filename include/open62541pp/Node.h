@@ -2,17 +2,21 @@
 
 #include <cstdint>
 #include <string_view>
+#include <type_traits>
 #include <utility>  // move
 #include <vector>
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/Historizing.h"
 #include "open62541pp/NodeIds.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/TypeConverter.h"  // guessDataType
 #include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/VariableHandle.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/Awaitable.h"
 #include "open62541pp/services/Method.h"
 #include "open62541pp/services/NodeManagement.h"
 #include "open62541pp/types/Builtin.h"
@@ -145,6 +149,32 @@ public:
     }
 #endif
 
+#ifdef UAPP_ASYNC_METHODS
+    /// @copydoc services::addMethodAsync
+    Node addMethodAsync(
+        const NodeId& id,
+        std::string_view browseName,
+        services::AsyncMethodCallback callback,
+        Span<const Argument> inputArguments,
+        Span<const Argument> outputArguments,
+        const MethodAttributes& attributes = {},
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    ) {
+        NodeId resultingId = services::addMethodAsync(
+            connection_,
+            nodeId_,
+            id,
+            browseName,
+            std::move(callback),
+            inputArguments,
+            outputArguments,
+            attributes,
+            referenceType
+        );
+        return {connection_, resultingId};
+    }
+#endif
+
     /// @copydoc services::addObjectType
     Node addObjectType(
         const NodeId& id,
@@ -356,10 +386,18 @@ public:
         value = services::readValue(connection_, nodeId_);
     }
 
+#ifdef UAPP_HAS_COROUTINES
+    /// @copydoc services::readValueAwait
+    template <typename U = ServerOrClient, typename = std::enable_if_t<std::is_same_v<U, Client>>>
+    services::Awaitable<Variant> readValueAwait() {
+        return services::readValueAwait(connection_, nodeId_);
+    }
+#endif
+
     /// Read scalar value from variable node.
     template <typename T>
     T readValueScalar() {
-        return readValue().template getScalarCopy<T>();
+        return readValue().template takeScalar<T>();
     }
 
     /// @copydoc readValueScalar
@@ -371,7 +409,7 @@ public:
     /// Read array value from variable node.
     template <typename T>
     std::vector<T> readValueArray() {
-        return readValue().template getArrayCopy<T>();
+        return readValue().template takeArray<T>();
     }
 
     /// @copydoc readValueArray
@@ -470,6 +508,14 @@ public:
         return *this;
     }
 
+#ifdef UAPP_HAS_COROUTINES
+    /// @copydoc services::writeValueAwait
+    template <typename U = ServerOrClient, typename = std::enable_if_t<std::is_same_v<U, Client>>>
+    services::Awaitable<void> writeValueAwait(Variant value) {
+        return services::writeValueAwait(connection_, nodeId_, std::move(value));
+    }
+#endif
+
     /// @copydoc services::writeValue
     /// @return Current node instance to chain multiple methods (fluent interface)
     Node& writeValue(const Variant& value) {
@@ -521,6 +567,18 @@ public:
         return writeValueArray(std::forward<Args>(args)...);
     }
 
+    /// Create a typed handle of the variable node for fast scalar writes and reads.
+    /// The DataType and ValueRank of the node are validated once.
+    /// @see VariableHandle
+    /// @note Only available for Server.
+    template <
+        typename T,
+        typename U = ServerOrClient,
+        typename = std::enable_if_t<std::is_same_v<U, Server>>>
+    VariableHandle<T> typed() {
+        return VariableHandle<T>(connection_, nodeId_);
+    }
+
     /// @copydoc services::writeDataType
     /// @return Current node instance to chain multiple methods (fluent interface)
     Node& writeDataType(const NodeId& typeId) {
@@ -564,6 +622,16 @@ public:
         return *this;
     }
 
+#ifdef UA_ENABLE_HISTORIZING
+    /// @copydoc Server::enableHistorizing
+    /// @return Current node instance to chain multiple methods (fluent interface)
+    /// @note Only available for Server.
+    Node& enableHistorizing(const HistorizingOptions& options = {}) {
+        connection_.enableHistorizing(nodeId_, options);
+        return *this;
+    }
+#endif
+
     /// @copydoc services::writeMinimumSamplingInterval
     /// @return Current node instance to chain multiple methods (fluent interface)
     Node& writeMinimumSamplingInterval(double milliseconds) {
@@ -0,0 +1,147 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declarations
+class Client;
+class Variant;
+template <typename ServerOrClient>
+class MonitoredItem;
+template <typename ServerOrClient>
+class Subscription;
+
+/**
+ * Client-side read-through cache of static node attributes.
+ *
+ * Attributes that (almost) never change, like the node class, browse name, display name, data
+ * type or value rank, are read once and served from memory afterwards. The first access of a
+ * node reads all static attributes with a single Read request; use @ref prefetch to fill the
+ * cache for many nodes (e.g. a browse result) at once. Attach the cache to a client with
+ * Client::setAttributeCache; services::readAttribute and the `Node::read*` functions of the
+ * client are then served from the cache.
+ *
+ * The `Value` attribute and the user-specific attributes (`UserWriteMask`, `UserAccessLevel`,
+ * `UserExecutable`) are never cached. Attributes not supported by the node class are cached with
+ * their bad status code, transient errors (e.g. a lost connection) are not cached.
+ *
+ * Entries are invalidated after a time to live, manually with @ref invalidate / @ref clear or
+ * by GeneralModelChangeEvents of the server (see @ref subscribeModelChanges).
+ * The cache is thread-safe and can be shared by multiple clients connected to the same server.
+ */
+class NodeAttributeCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Create an attribute cache.
+    /// @param timeToLive Expiration time of the entries, entries never expire if zero
+    explicit NodeAttributeCache(Clock::duration timeToLive = Clock::duration::zero())
+        : timeToLive_(timeToLive) {}
+
+    /// Attributes stored by the cache.
+    static Span<const AttributeId> getCachedAttributes() noexcept;
+
+    /// Check if an attribute is stored by the cache.
+    static bool isCached(AttributeId attributeId) noexcept;
+
+    /// Get a cached attribute, `std::nullopt` on a cache miss.
+    std::optional<DataValue> find(const NodeId& id, AttributeId attributeId);
+
+    /**
+     * Read an attribute through the cache.
+     * All cached attributes of the node are read with a single request on a cache miss.
+     * @return Cached value, `std::nullopt` if the attribute isn't cached or couldn't be read
+     */
+    std::optional<DataValue> read(Client& client, const NodeId& id, AttributeId attributeId);
+
+    /// Insert or replace the attributes of a node.
+    /// @param values Values of all attributes returned by @ref getCachedAttributes (same order)
+    void insert(const NodeId& id, Span<const DataValue> values);
+
+    /**
+     * Read the static attributes of multiple nodes with a single call (batched).
+     * Nodes that are already cached are skipped. Requests are split to respect the
+     * `MaxNodesPerRead` operation limit of the server.
+     */
+    void prefetch(Client& client, Span<const NodeId> ids);
+
+    /// @overload
+    void prefetch(Client& client, Span<const ReferenceDescription> references);
+
+    /// Remove the attributes of a node.
+    void invalidate(const NodeId& id);
+
+    /// Remove all entries.
+    void clear();
+
+    /// Number of cached nodes.
+    size_t size() const;
+
+    /// Number of cache hits and misses since creation.
+    uint64_t getHitCount() const noexcept {
+        return hits_.load(std::memory_order_relaxed);
+    }
+
+    uint64_t getMissCount() const noexcept {
+        return misses_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Invalidate the entries affected by a GeneralModelChangeEvent.
+     *
+     * The attributes of all affected nodes are removed. Events without change details (e.g. a
+     * BaseModelChangeEvent) clear the whole cache.
+     *
+     * @param eventFields Event fields selected by BrowseCache::getModelChangeEventFilter
+     */
+    void handleModelChangeEvent(Span<const Variant> eventFields);
+
+private:
+    struct Entry {
+        Clock::time_point inserted;
+        std::vector<DataValue> values;
+    };
+
+    std::optional<DataValue> lookup(const NodeId& id, AttributeId attributeId, bool count);
+    bool contains(const NodeId& id);
+
+    Clock::duration timeToLive_;
+    mutable std::mutex mutex_;
+    std::unordered_map<NodeId, Entry> entries_;
+    std::atomic<uint64_t> hits_{0};
+    std::atomic<uint64_t> misses_{0};
+};
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+/**
+ * Monitor the model changes of the server and invalidate the affected cache entries.
+ *
+ * Creates an event monitored item for GeneralModelChangeEvents of the `Server` object. The
+ * cache is referenced weakly, the monitored item stays valid after the cache is destroyed.
+ *
+ * @param subscription Subscription to create the monitored item in
+ * @param cache Attribute cache to invalidate
+ * @see NodeAttributeCache::handleModelChangeEvent
+ */
+MonitoredItem<Client> subscribeModelChanges(
+    Subscription<Client>& subscription, const std::shared_ptr<NodeAttributeCache>& cache
+);
+#endif
+
+}  // namespace opcua
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Look up a node id defined by the OPC UA specification by its symbolic name.
+ *
+ * The names are the enumerator names of the generated node ids (@ref NodeIds), e.g.
+ * `"Server_ServerStatus_CurrentTime"` (VariableId) or `"BaseDataVariableType"` (VariableTypeId).
+ * The lookup uses a generated perfect hash table, no runtime initialization is required.
+ *
+ * @return Numeric node id of namespace 0, `std::nullopt` if the name is unknown
+ * @ingroup NodeIds
+ */
+std::optional<NodeId> lookupNodeId(std::string_view name) noexcept;
+
+/**
+ * Look up the symbolic name of a node id defined by the OPC UA specification.
+ * @return Symbolic name, empty if the id is unknown
+ * @ingroup NodeIds
+ */
+std::string_view lookupNodeIdName(uint32_t id) noexcept;
+
+/// @overload
+/// Only numeric node ids of namespace 0 are defined by the specification.
+std::string_view lookupNodeIdName(const NodeId& id) noexcept;
+
+}  // namespace opcua
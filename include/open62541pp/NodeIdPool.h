@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // hash
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>  // move
+
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class NodeIdPool;
+
+/**
+ * Shared, immutable NodeId interned by a NodeIdPool.
+ *
+ * Copies only increment a reference count. Equality of ids interned by the same pool is decided by
+ * pointer comparison and the hash is precomputed, so interned ids are cheap keys for hash maps.
+ */
+class InternedNodeId {
+public:
+    /// Create a null NodeId (not interned).
+    InternedNodeId() = default;
+
+    const NodeId& get() const noexcept;
+
+    operator const NodeId&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    const NodeId* operator->() const noexcept {
+        return &get();
+    }
+
+    /// Precomputed hash, equal to NodeId::hash.
+    uint32_t hash() const noexcept;
+
+    /// Number of references to the shared NodeId.
+    long useCount() const noexcept;
+
+    friend bool operator==(const InternedNodeId& lhs, const InternedNodeId& rhs) noexcept;
+
+private:
+    friend class NodeIdPool;
+
+    struct Entry {
+        NodeId id;
+        uint32_t hash;
+        const NodeIdPool* pool;
+    };
+
+    explicit InternedNodeId(std::shared_ptr<const Entry> entry) noexcept
+        : entry_(std::move(entry)) {}
+
+    std::shared_ptr<const Entry> entry_;
+};
+
+inline bool operator!=(const InternedNodeId& lhs, const InternedNodeId& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/**
+ * Interning pool for node ids.
+ *
+ * Equal node ids share one immutable NodeId instance, which reduces the memory of many copies of
+ * (long) string, guid or bytestring node ids. The pool is thread-safe.
+ *
+ * The pool holds a reference to each interned id. Ids that are not used anymore are removed
+ * with @ref purge.
+ *
+ * @see Client::setNodeIdPool
+ */
+class NodeIdPool {
+public:
+    /// Get the interned instance of a node id, the node id is copied if not interned yet.
+    InternedNodeId intern(const NodeId& id);
+
+    /// Number of interned node ids.
+    size_t size() const;
+
+    /// Remove all interned node ids that are only referenced by the pool.
+    /// @returns Number of removed node ids
+    size_t purge();
+
+private:
+    mutable std::mutex mutex_;
+    std::unordered_multimap<uint32_t, std::shared_ptr<const InternedNodeId::Entry>> entries_;
+};
+
+}  // namespace opcua
+
+template <>
+struct std::hash<opcua::InternedNodeId> {
+    std::size_t operator()(const opcua::InternedNodeId& id) const noexcept {
+        return id.hash();
+    }
+};
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Kinds of node accesses counted by the node profiler.
+ *
+ * Requests of remote clients are processed by open62541 internally and are classified by the
+ * nodestore operation: node lookups count as reads (Read and Browse services, sampling of remote
+ * monitored items), node copies as writes. Nodes are edited in place without a copy (open62541
+ * v1.3 without `UA_ENABLE_IMMUTABLE_NODES`), so writes of remote clients are counted as reads.
+ * Accesses of the server itself are classified by the calling service (writes, browses and
+ * samples of event-driven and aggregate monitored items).
+ */
+enum class NodeAccess : uint8_t {
+    Read,
+    Write,
+    Browse,
+    Sample,
+};
+
+/**
+ * Options of the node profiler.
+ * @see Server::enableNodeProfiler
+ */
+struct NodeProfilerOptions {
+    /// Count every n-th node access of a thread (1 = every access).
+    /// Counts are scaled back by the interval, a larger interval lowers the overhead.
+    uint32_t sampleInterval = 16;
+    /// Number of nodes of the report.
+    size_t topCount = 20;
+    /// Counters per row of the count-min sketch (rounded up to a power of two).
+    /// More counters lower the overestimation of counts due to hash collisions.
+    size_t sketchWidth = 4096;
+    /// Rows of the count-min sketch (independent hashes).
+    size_t sketchDepth = 4;
+    /// Add a diagnostic variable (String array) with the report below the Server object.
+    /// Not added if the node id is null.
+    NodeId diagnosticNodeId;
+};
+
+/**
+ * Estimated access counts of a node.
+ * @see Server::getHotNodes
+ */
+struct HotNode {
+    NodeId id;
+    /// Estimated number of accesses (count-min sketch, never underestimated).
+    uint64_t count{0};
+    /// Estimated accesses by NodeAccess since the node entered the report.
+    std::array<uint64_t, 4> accessCounts{};
+
+    uint64_t getCount(NodeAccess access) const noexcept {
+        return accessCounts[static_cast<size_t>(access)];
+    }
+};
+
+}  // namespace opcua
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/services/NodeManagement.h"
+
+namespace opcua {
+
+class Server;
+
+/**
+ * Address space model of a nodeset, e.g. parsed from a NodeSet2 XML file.
+ *
+ * The node ids, browse names and reference types refer to the namespace table of the nodeset.
+ * Use @ref remapNamespaces (or Server::loadNodeset) to map them to the namespace indices of a
+ * server.
+ *
+ * @see https://reference.opcfoundation.org/Core/Part6/v105/docs/F
+ */
+struct Nodeset {
+    /// Namespace URIs of the nodeset, index `1` refers to the first element.
+    std::vector<std::string> namespaceUris;
+    /// Node and reference definitions. The nodes are sorted such that parents, type definitions
+    /// and data types are defined before they are referenced.
+    services::NodeBatch nodes;
+
+    /**
+     * Map the namespace indices of all node definitions.
+     * @param indices Target namespace index for each namespace index of the nodeset (`indices[0]`
+     *                for namespace 0).
+     * @exception BadStatus (BadIndexRangeInvalid) If a namespace index is not mapped
+     */
+    void remapNamespaces(Span<const uint16_t> indices);
+};
+
+/**
+ * Changes applied by Server::applyModel.
+ * Nodes with a different node class are deleted and added again, they are part of both lists.
+ */
+struct ModelChanges {
+    /// Ids of the added nodes (in the order of the model definitions).
+    std::vector<NodeId> addedNodes;
+    /// Ids of the existing nodes that are not part of the model (or replaced) and were deleted.
+    /// Child nodes deleted implicitly with their deleted parent are not listed; model nodes below
+    /// a replaced node are added again and listed in `addedNodes`.
+    std::vector<NodeId> deletedNodes;
+    /// Ids of the nodes with updated attributes (display name, description or value).
+    std::vector<NodeId> updatedNodes;
+    /// Status of the added node and reference definitions.
+    services::NodeBatchResult addResult;
+
+    /// Check if the model didn't differ from the address space.
+    bool empty() const noexcept {
+        return addedNodes.empty() && deletedNodes.empty() && updatedNodes.empty();
+    }
+};
+
+/**
+ * Parse a NodeSet2 XML document.
+ *
+ * The document is parsed in a streaming fashion, the nodes are converted directly to AddNodesItem
+ * definitions. Supported values are scalars and arrays of the numeric built-in types, Boolean,
+ * String, ByteString, LocalizedText, QualifiedName and NodeId; other values are ignored.
+ * Data type definitions and extensions are ignored.
+ *
+ * @param stream Input stream of the XML document
+ * @exception BadStatus (BadDecodingError) If the document is malformed
+ */
+Nodeset readNodesetXml(std::istream& stream);
+
+/**
+ * Read a binary nodeset snapshot written by @ref writeNodesetBinary.
+ *
+ * The snapshot is decoded with a single pass over a contiguous buffer, which is much faster than
+ * parsing the original XML document.
+ *
+ * @param stream Input stream of the binary snapshot (use `std::ios::binary`)
+ * @exception BadStatus (BadDecodingError) If the snapshot is invalid
+ * @note Requires open62541 v1.3 or later.
+ */
+Nodeset readNodesetBinary(std::istream& stream);
+
+/**
+ * Write a compact binary nodeset snapshot.
+ * The node definitions are stored with the OPC UA binary encoding.
+ *
+ * @param nodeset Nodeset to write
+ * @param stream Output stream (use `std::ios::binary`)
+ * @note Requires open62541 v1.3 or later.
+ */
+void writeNodesetBinary(const Nodeset& nodeset, std::ostream& stream);
+
+/**
+ * Export the address space of a server (all nodes except namespace 0) including current values.
+ *
+ * The attributes of all nodes are read with a single batched call. Value callbacks and data
+ * source backends are not part of the nodeset, they are invoked to read the current values.
+ * Instance declarations of custom types are exported as regular nodes.
+ *
+ * @param server Server instance
+ * @see Server::writeSnapshot
+ * @note Requires open62541 v1.3 or later.
+ */
+Nodeset exportNodeset(Server& server);
+
+namespace detail {
+
+/// Check if the stream starts with the magic bytes of a binary nodeset snapshot (doesn't consume).
+bool isNodesetBinary(std::istream& stream);
+
+}  // namespace detail
+
+}  // namespace opcua
@@ -0,0 +1,136 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+// forward declarations
+class Client;
+template <typename ServerOrClient>
+class Subscription;
+
+/**
+ * Data change notifications in columnar layout (structure of arrays).
+ *
+ * Each notification is a row, all columns have the same length. The layout maps directly to
+ * columnar formats like Apache Arrow or Parquet record batches: numeric values are stored in a
+ * contiguous `double` column, node ids are dictionary encoded.
+ */
+struct ColumnarNotificationBatch {
+    /// Monitored item ids.
+    std::vector<uint32_t> monIds;
+    /// Indexes of the monitored node ids in @ref nodeIds (dictionary encoding).
+    std::vector<uint32_t> nodeIndexes;
+    /// Dictionary of the node ids referenced by @ref nodeIndexes (unique within the batch).
+    std::vector<NodeId> nodeIds;
+    /// Numeric scalar values converted to `double`, NaN for other values.
+    std::vector<double> numericValues;
+    /// Values that are not numeric scalars (e.g. strings or arrays), empty for numeric scalars.
+    std::vector<Variant> values;
+    std::vector<StatusCode> statusCodes;
+    /// Source timestamps, 0 if not returned.
+    std::vector<DateTime> sourceTimestamps;
+    /// Server timestamps, 0 if not returned.
+    std::vector<DateTime> serverTimestamps;
+
+    /// Number of rows.
+    size_t size() const noexcept {
+        return monIds.size();
+    }
+
+    bool empty() const noexcept {
+        return monIds.empty();
+    }
+
+    /// Remove all rows, the capacity of the columns is retained.
+    void clear() noexcept;
+};
+
+/// Flush conditions of a NotificationBatchBuilder.
+struct NotificationBatchOptions {
+    /// Flush if the batch has this number of rows.
+    size_t maxRows{10000};
+    /// Flush if the oldest row of the batch is older, never flushed by time if zero.
+    std::chrono::milliseconds maxAge{1000};
+};
+
+/**
+ * Callback of flushed batches.
+ * The batch is handed over without copy and can be moved by the consumer, e.g. into a queue.
+ */
+using NotificationBatchCallback = std::function<void(ColumnarNotificationBatch& batch)>;
+
+/**
+ * Accumulate data change notifications into columnar batches.
+ *
+ * Rows are appended with @ref append or by a subscription (see @ref attachNotificationBatchBuilder)
+ * and a batch is passed to the callback if it reaches the maximum number of rows or age. Call
+ * @ref flushIfDue periodically (e.g. after Client::runIterate) to flush by time without new
+ * notifications. The builder is not thread-safe, use it from the thread running the client.
+ */
+class NotificationBatchBuilder {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    NotificationBatchBuilder(NotificationBatchOptions options, NotificationBatchCallback callback);
+
+    /// Append a row, flushes if the batch is full or due.
+    void append(uint32_t monId, const NodeId& nodeId, const DataValue& value);
+
+    /// Pass the current batch to the callback (if not empty) and start a new batch.
+    void flush();
+
+    /// Flush if the age of the current batch exceeded the maximum age.
+    void flushIfDue();
+
+    /// Number of rows of the current batch.
+    size_t size() const noexcept {
+        return batch_.size();
+    }
+
+    /// Number of flushed batches since creation.
+    uint64_t getBatchCount() const noexcept {
+        return batchCount_;
+    }
+
+private:
+    uint32_t getNodeIndex(const NodeId& nodeId);
+
+    NotificationBatchOptions options_;
+    NotificationBatchCallback callback_;
+    ColumnarNotificationBatch batch_;
+    std::unordered_map<NodeId, uint32_t> nodeIndexes_;
+    Clock::time_point batchStart_;
+    uint64_t batchCount_{0};
+};
+
+/**
+ * Feed the data change notifications of a subscription into a batch builder.
+ *
+ * Sets the data change batch callback of the subscription (see
+ * Subscription::setDataChangeBatchCallback), the callbacks of the individual monitored items are
+ * not invoked anymore. The node ids are taken from the monitored items. The builder is referenced
+ * weakly.
+ */
+void attachNotificationBatchBuilder(
+    Subscription<Client>& subscription, const std::shared_ptr<NotificationBatchBuilder>& builder
+);
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <thread>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/services/Subscription.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+
+/// Behaviour of a full NotificationQueue.
+enum class NotificationQueueOverflow {
+    DiscardNewest,  ///< Discard the incoming notification and increment the dropped counter
+    Block,  ///< Block the client's main loop until the consumer made room (backpressure)
+};
+
+/**
+ * Bounded lock-free single-producer single-consumer queue of data change notifications.
+ *
+ * The producer is the thread running the client's main loop, the consumer can be any other
+ * thread. Only one thread may consume from the queue at the same time. The capacity is rounded up
+ * to the next power of two.
+ *
+ * @see Subscription::enableNotificationQueue
+ */
+class NotificationQueue {
+public:
+    using Notification = services::DataChangeNotification;
+
+    explicit NotificationQueue(
+        size_t capacity,
+        NotificationQueueOverflow overflow = NotificationQueueOverflow::DiscardNewest
+    )
+        : slots_(roundUpPowerOfTwo(capacity)),
+          mask_(slots_.size() - 1),
+          overflow_(overflow) {}
+
+    /// Maximum number of queued notifications.
+    size_t capacity() const noexcept {
+        return slots_.size();
+    }
+
+    /// Approximate number of queued notifications.
+    size_t size() const noexcept {
+        return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+    }
+
+    /// Number of notifications discarded because of a full queue.
+    uint64_t getDroppedCount() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /// Push a notification (producer only).
+    /// @returns `false` if the notification was discarded
+    bool push(Notification&& notification) noexcept {
+        const size_t tail = tail_.load(std::memory_order_relaxed);
+        while (tail - head_.load(std::memory_order_acquire) > mask_) {
+            if (overflow_ == NotificationQueueOverflow::DiscardNewest) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);
+                return false;
+            }
+            std::this_thread::yield();
+        }
+        slots_[tail & mask_] = std::move(notification);
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Pop a single notification (consumer only).
+    /// @returns `false` if the queue is empty
+    bool tryPop(Notification& notification) noexcept {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        notification = std::move(slots_[head & mask_]);
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Pop up to `maxCount` notifications and append them to `batch` (consumer only).
+    /// @returns Number of popped notifications
+    size_t poll(
+        std::vector<Notification>& batch, size_t maxCount = (std::numeric_limits<size_t>::max)()
+    ) {
+        const size_t head = head_.load(std::memory_order_relaxed);
+        const size_t tail = tail_.load(std::memory_order_acquire);
+        const size_t count = (std::min)(tail - head, maxCount);
+        batch.reserve(batch.size() + count);
+        for (size_t i = 0; i < count; ++i) {
+            batch.push_back(std::move(slots_[(head + i) & mask_]));
+        }
+        head_.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    static size_t roundUpPowerOfTwo(size_t value) noexcept {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1U;
+        }
+        return result;
+    }
+
+    std::vector<Notification> slots_;
+    size_t mask_;
+    NotificationQueueOverflow overflow_;
+    alignas(64) std::atomic<size_t> head_{0};
+    alignas(64) std::atomic<size_t> tail_{0};
+    std::atomic<uint64_t> dropped_{0};
+};
+
+}  // namespace opcua
+
+#endif
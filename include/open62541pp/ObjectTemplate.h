@@ -0,0 +1,115 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declare
+class Server;
+
+/**
+ * Flattened instance declarations of an object type to create many instances quickly.
+ *
+ * Adding an object with a type definition makes open62541 browse the type hierarchy and copy the
+ * instance declarations for every instance. The template browses the type (including supertypes)
+ * once on construction and stores the mandatory children with their attributes, modelling rules
+ * and default values. Instances are created from the flattened definitions without any browse
+ * operations; methods are referenced instead of copied (like open62541 does).
+ *
+ * Value backends and callbacks of the instance children are attached with bindings, keyed by the
+ * relative browse path of the child. The bindings are invoked for every created instance.
+ *
+ * @code
+ * ObjectTemplate robot(server, robotTypeId);
+ * robot.bind({{1, "Motor"}, {1, "Speed"}}, [](Server& server, const NodeId& id) {
+ *     server.setVariableNodeValueBackend(id, createSpeedSource());
+ * });
+ * for (int i = 0; i < 2000; ++i) {
+ *     robot.instantiate(cellId, {1, i}, "Robot" + std::to_string(i));
+ * }
+ * @endcode
+ *
+ * @note Node type lifecycle constructors (`UA_Server_setNodeTypeLifecycle`) are not invoked for
+ *       the instances.
+ */
+class ObjectTemplate {
+public:
+    /// Callback to bind a created instance child (e.g. to set a value backend).
+    using BindCallback = std::function<void(Server& server, const NodeId& id)>;
+
+    /// Flatten the instance declarations of an object type.
+    /// @exception BadStatus If the type can't be browsed or read
+    ObjectTemplate(Server& server, const NodeId& objectType);
+
+    /// Get the server instance.
+    Server& getConnection() noexcept;
+    /// Get the server instance.
+    const Server& getConnection() const noexcept;
+
+    /// Get the object type of the template.
+    const NodeId& getObjectType() const noexcept;
+
+    /// Number of instance children created per instance (excluding the object itself).
+    size_t size() const noexcept;
+
+    /// Check if an instance child with the relative browse path exists.
+    bool contains(Span<const QualifiedName> path) const noexcept;
+
+    /**
+     * Bind a callback to an instance child, invoked for every instance created afterwards.
+     * @param path Relative browse path of the child from the instance
+     * @param callback Callback invoked with the node id of the created child
+     * @exception BadStatus (BadNoMatch) If the template doesn't contain the browse path
+     */
+    void bind(Span<const QualifiedName> path, BindCallback callback);
+
+    /**
+     * Create an instance of the object type.
+     * The node ids of the instance children are generated by the server within the namespace of
+     * the instance.
+     * @return Node id of the created instance
+     * @exception BadStatus If a node can't be added
+     */
+    NodeId instantiate(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const ObjectAttributes& attributes = {},
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    );
+
+private:
+    struct Child {
+        size_t parent;  // index of the parent child, `npos` for the instance
+        std::vector<QualifiedName> path;
+        NodeId declarationId;
+        NodeId referenceType;
+        NodeClass nodeClass;
+        QualifiedName browseName;
+        NodeId typeDefinition;
+        ExtensionObject attributes;
+        std::vector<BindCallback> bindings;
+    };
+
+    static constexpr size_t npos = static_cast<size_t>(-1);
+
+    void collect(const NodeId& declarationId, size_t parent);
+    void readAttributes();
+
+    Server& connection_;
+    NodeId objectType_;
+    std::vector<Child> children_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId, TimestampsToReturn
+#include "open62541pp/services/MonitoredItem.h"  // ClientDataChangeFilter
+
+// forward declarations
+namespace opcua {
+class Client;
+class NodeId;
+}  // namespace opcua
+
+namespace opcua {
+
+/**
+ * Poll group parameters.
+ */
+struct PollGroupParameters {
+    /// Polling interval in milliseconds.
+    double interval = 1000.0;
+    /// Timestamps to be returned by the server.
+    TimestampsToReturn timestamps = TimestampsToReturn::Both;
+    /// Maximum age of the values in milliseconds, the server may return cached values.
+    /// `0.0` to read the current values from the data source.
+    double maxAge = 0.0;
+};
+
+/**
+ * Periodic polling of node attributes with batched reads (client only).
+ *
+ * Alternative to subscriptions for servers that don't support them (well). All items of a poll
+ * group are read with one Read request per interval (split by the `MaxNodesPerRead` operation
+ * limit of the server). The group is driven by Client::runIterate (or the background event loop):
+ * the request is sent asynchronously once the poll time is reached. Poll times are scheduled on a
+ * fixed grid (start time + n * interval), i.e. the period doesn't drift with the processing time.
+ * Polls are skipped while the previous request is outstanding and if runIterate is late by more
+ * than one interval.
+ *
+ * Changed values are delivered with the same callback type as data change notifications of
+ * monitored items: services::DataChangeNotificationCallback is called with the poll group id and
+ * the item id instead of the subscription and monitored item id. A client-side data change filter
+ * is applied per item, by default unchanged values are discarded.
+ *
+ * Create poll groups with Client::createPollGroup.
+ */
+class PollGroup {
+public:
+    /// Wrap an existing poll group.
+    PollGroup(Client& client, uint32_t pollGroupId) noexcept;
+
+    /// Get the client instance.
+    Client& getConnection() noexcept;
+    /// Get the client instance.
+    const Client& getConnection() const noexcept;
+
+    /// Get the client-assigned identifier of this poll group.
+    uint32_t getPollGroupId() const noexcept;
+
+    /// Get the poll group parameters.
+    /// @exception BadStatus (BadNotFound) If the poll group doesn't exist
+    PollGroupParameters getParameters() const;
+
+    /// Modify the poll group parameters, the next poll is due immediately.
+    /// @exception BadStatus (BadNotFound) If the poll group doesn't exist
+    void setParameters(const PollGroupParameters& parameters);
+
+    /**
+     * Add an attribute of a node to poll.
+     * The first value is reported after the next poll.
+     * @param id Node to poll
+     * @param callback Invoked within Client::runIterate for every change
+     * @param filter Client-side data change filter, `std::nullopt` to report every polled value
+     * @param attributeId Attribute to poll
+     * @return Client-assigned identifier of the item
+     * @exception BadStatus (BadNotFound) If the poll group doesn't exist
+     */
+    uint32_t addItem(
+        const NodeId& id,
+        services::DataChangeNotificationCallback callback,
+        std::optional<services::ClientDataChangeFilter> filter = services::ClientDataChangeFilter{},
+        AttributeId attributeId = AttributeId::Value
+    );
+
+    /// Remove an item, pending changes of the item are not reported anymore.
+    void removeItem(uint32_t itemId);
+
+    /// Get the identifiers of all items.
+    std::vector<uint32_t> getItemIds() const;
+
+    /// Number of polls skipped since creation, because the previous request was outstanding or
+    /// Client::runIterate was called too late.
+    uint64_t getSkippedPollCount() const;
+
+    /// Delete this poll group.
+    void deletePollGroup();
+
+private:
+    Client* connection_;
+    uint32_t pollGroupId_{0U};
+};
+
+bool operator==(const PollGroup& lhs, const PollGroup& rhs) noexcept;
+bool operator!=(const PollGroup& lhs, const PollGroup& rhs) noexcept;
+
+}  // namespace opcua
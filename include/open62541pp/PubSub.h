@@ -0,0 +1,336 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_PUBSUB
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+/**
+ * @defgroup PubSub PubSub
+ * Publish and subscribe data sets as UADP network messages over UDP multicast or Ethernet (server
+ * only).
+ *
+ * Client/server subscriptions create a separate publish stream for every subscriber. With PubSub,
+ * a single (multicast) stream of network messages serves any number of subscribers:
+ *
+ * @code
+ * PubSubConnection connection = server.addPubSubConnection({});  // opc.udp://224.0.0.22:4840/
+ * PublishedDataSet dataSet = server.addPublishedDataSet("Measurements");
+ * dataSet.addField(temperatureNodeId, "Temperature");
+ * WriterGroup group = connection.addWriterGroup({});
+ * group.addDataSetWriter(dataSet, 1);
+ * group.setOperational();
+ * @endcode
+ *
+ * In realtime mode (PubSubRtLevel::FixedSize), the layout of the network messages is computed
+ * once when the writer group is made operational and the messages are preallocated. Only the
+ * values are encoded with every publish at fixed offsets. All fields of the data sets must be
+ * bound to user memory (see PublishedDataSet::addField(DataValue&, std::string_view)) with
+ * fixed-size values.
+ *
+ * Subscribers receive the data sets with data set readers. The values are written into target
+ * variables of the information model or, in realtime mode, decoded directly into user memory:
+ *
+ * @code
+ * struct Axis {
+ *     double position;
+ *     double velocity;
+ * } axis{};
+ * DataValue position(Variant::fromScalar(axis.position));  // borrows the struct member
+ * DataValue velocity(Variant::fromScalar(axis.velocity));
+ *
+ * DataSetReaderConfig config;
+ * config.fields = {
+ *     {"Position", DataTypeId::Double, positionNodeId, &position},
+ *     {"Velocity", DataTypeId::Double, velocityNodeId, &velocity},
+ * };
+ * config.onMessage = [&] { control(axis); };
+ * ReaderGroup group = connection.addReaderGroup({"ReaderGroup", PubSubRtLevel::FixedSize});
+ * group.addDataSetReader(config);
+ * group.setOperational();
+ * @endcode
+ *
+ * @note Requires open62541 compiled with `UA_ENABLE_PUBSUB` (and `UA_ENABLE_PUBSUB_ETH_UADP` for
+ *       Ethernet).
+ * @see https://www.open62541.org/doc/1.3/pubsub.html
+ * @{
+ */
+
+/// Transport protocol of a PubSub connection.
+enum class PubSubTransport {
+    Udp,  ///< UADP over UDP (multicast), URL scheme `opc.udp://`
+    Ethernet,  ///< UADP over raw Ethernet, URL scheme `opc.eth://`
+};
+
+/// Realtime level of a writer or reader group.
+enum class PubSubRtLevel {
+    None,  ///< Messages are generated and encoded with every publish
+    FixedSize,  ///< Preallocated messages, values are encoded at fixed offsets
+};
+
+/// Configuration of a PubSub connection.
+struct PubSubConnectionConfig {
+    std::string name{"Connection"};
+    PubSubTransport transport{PubSubTransport::Udp};
+    /// Network address, e.g. `opc.udp://224.0.0.22:4840/` or `opc.eth://01-00-5E-00-00-01`.
+    std::string url{"opc.udp://224.0.0.22:4840/"};
+    /// Network interface, optional for UDP and required for Ethernet.
+    std::string networkInterface;
+    /// Numeric publisher id, unique within the network.
+    uint32_t publisherId{1};
+};
+
+/// Configuration of a writer group.
+struct WriterGroupConfig {
+    std::string name{"WriterGroup"};
+    /// Writer group id, unique within the connection.
+    uint16_t writerGroupId{1};
+    /// Publishing interval in milliseconds.
+    double publishingInterval{100};
+    PubSubRtLevel rtLevel{PubSubRtLevel::None};
+};
+
+/// Configuration of a reader group.
+struct ReaderGroupConfig {
+    std::string name{"ReaderGroup"};
+    PubSubRtLevel rtLevel{PubSubRtLevel::None};
+};
+
+/// Field of a data set received by a data set reader.
+struct DataSetReaderField {
+    /// Field name in the data set metadata.
+    std::string name;
+    /// Data type of the field, must match the published value.
+    NodeId dataType;
+    /// Variable node updated with the received values.
+    NodeId targetVariable;
+    /**
+     * Optional user memory the received values are decoded into, required in realtime mode.
+     *
+     * The values are copied into the (borrowed) scalar of the DataValue without allocations, e.g.
+     * into a member of a user struct bound with Variant::fromScalar(T&). The target variable is
+     * switched to an external value backend of the same memory, so the variable mirrors the
+     * received values without copies or locks. The DataValue must outlive the reader.
+     */
+    DataValue* target{nullptr};
+};
+
+/// Configuration of a data set reader.
+struct DataSetReaderConfig {
+    std::string name{"DataSetReader"};
+    /// Numeric publisher id of the publishing connection (encoded as UInt16 in UADP).
+    uint16_t publisherId{1};
+    /// Writer group id of the publisher.
+    uint16_t writerGroupId{1};
+    /// Data set writer id of the publisher.
+    uint16_t dataSetWriterId{1};
+    /// Timeout in milliseconds until the reader reports an error if no message is received.
+    double messageReceiveTimeout{1000};
+    /// Fields of the data set in the published order.
+    std::vector<DataSetReaderField> fields;
+    /**
+     * Optional callback invoked for every received DataSetMessage, after all fields have been
+     * written. Only supported if all fields are decoded into user memory.
+     * The callback is invoked from the thread running the server and must return quickly.
+     */
+    std::function<void()> onMessage;
+};
+
+/**
+ * Published data set: the fields published by the data set writers.
+ * Create it with Server::addPublishedDataSet.
+ */
+class PublishedDataSet {
+public:
+    PublishedDataSet(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /**
+     * Add a field publishing the value attribute of a variable node.
+     * @param variableId Variable node, e.g. `Node<Server>::id()`
+     * @param alias Field name in the data set metadata
+     * @return Id of the field
+     */
+    NodeId addField(const NodeId& variableId, std::string_view alias);
+
+    /**
+     * Add a field publishing a value in user memory.
+     *
+     * The value is read directly from `source` with every publish, without a lookup in the
+     * information model. Update the value in place, e.g. within Server::post or from the thread
+     * running the server. In realtime mode, the data type and size of the value must not change.
+     * @param source Value, must outlive the data set
+     * @param alias Field name in the data set metadata
+     * @return Id of the field
+     */
+    NodeId addField(DataValue& source, std::string_view alias);
+
+    /// Remove the data set.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * Writer group: publishes the network messages of its data set writers with a common interval.
+ * Create it with PubSubConnection::addWriterGroup.
+ */
+class WriterGroup {
+public:
+    WriterGroup(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /**
+     * Add a writer publishing the data set.
+     * @param dataSet Published data set
+     * @param dataSetWriterId Writer id, unique within the writer group
+     * @param keyFrameCount Number of messages until a key frame (all fields) is sent
+     * @return Id of the data set writer
+     */
+    NodeId addDataSetWriter(
+        const PublishedDataSet& dataSet, uint16_t dataSetWriterId, uint32_t keyFrameCount = 1
+    );
+
+    /// Start publishing.
+    /// The configuration is frozen first, writers and fields can't be added afterwards.
+    void setOperational();
+
+    /// Stop publishing and unfreeze the configuration.
+    void setDisabled();
+
+    /// Remove the writer group.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * Data set reader: decodes the data set messages of a single data set writer.
+ * Create it with ReaderGroup::addDataSetReader.
+ */
+class DataSetReader {
+public:
+    DataSetReader(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /// Remove the data set reader.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * Reader group: receives the network messages of its data set readers.
+ * Create it with PubSubConnection::addReaderGroup.
+ */
+class ReaderGroup {
+public:
+    ReaderGroup(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /**
+     * Add a reader decoding the data set messages into the target variables or user memory.
+     * @exception BadStatus (BadInvalidArgument) If the fields are empty, if a field without user
+     *            memory is added in realtime mode or if `onMessage` is set without user memory
+     * @exception BadStatus (BadDataTypeIdUnknown) If the data type of a field is unknown
+     */
+    DataSetReader addDataSetReader(const DataSetReaderConfig& config);
+
+    /// Start receiving.
+    /// The configuration is frozen first, readers can't be added afterwards.
+    void setOperational();
+
+    /// Stop receiving and unfreeze the configuration.
+    void setDisabled();
+
+    /// Remove the reader group.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * PubSub connection to a network (e.g. a multicast group).
+ * Create it with Server::addPubSubConnection.
+ */
+class PubSubConnection {
+public:
+    PubSubConnection(Server& server, NodeId id) noexcept;
+
+    Server& getServer() noexcept {
+        return *server_;
+    }
+
+    const NodeId& getId() const noexcept {
+        return id_;
+    }
+
+    /// Add a writer group to the connection.
+    WriterGroup addWriterGroup(const WriterGroupConfig& config);
+
+    /// Add a reader group to the connection.
+    ReaderGroup addReaderGroup(const ReaderGroupConfig& config);
+
+    /// Remove the connection including its writer and reader groups.
+    void remove();
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+/**
+ * @}
+ */
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,65 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/Config.h"
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+
+namespace opcua {
+
+/**
+ * Reaction to allocations of the system allocator within a realtime server iteration.
+ * @see RealtimeOptions
+ */
+enum class RealtimeViolationAction {
+    Count,  ///< Count the violation only (RealtimeStatistics::violations)
+    Log,  ///< Count and print a message to `stderr` (without allocation)
+    Abort,  ///< Count, print a message and abort the process, e.g. for test runs
+};
+
+/**
+ * Options of the realtime profile of a server.
+ * The limits are applied to the server config and determine the size of the preallocated pool.
+ * @see Server::enableRealtime
+ */
+struct RealtimeOptions {
+    /// Maximum number of sessions and secure channels.
+    uint16_t maxSessions = 10;
+    /// Maximum number of monitored items of all sessions.
+    uint32_t maxMonitoredItems = 1000;
+    /// Maximum queue size of monitored items.
+    uint32_t maxQueueSize = 10;
+    /// Number of preallocated blocks relative to the estimated demand of the limits.
+    double headroom = 2.0;
+    /// Number of iterations before allocations are treated as violations, e.g. to establish the
+    /// sessions, subscriptions and monitored items.
+    uint64_t warmupIterations = 100;
+    /// Reaction to allocations of the system allocator after the warm-up.
+    RealtimeViolationAction violationAction = RealtimeViolationAction::Log;
+};
+
+/**
+ * Statistics of the realtime profile of a server.
+ * @see Server::getRealtimeStatistics
+ */
+struct RealtimeStatistics {
+    /// Size of the preallocated pool in bytes.
+    size_t poolBytes{0};
+    /// Number of pool blocks in use.
+    size_t blocksInUse{0};
+    /// Number of server iterations since the realtime profile was enabled.
+    uint64_t iterations{0};
+    /// Allocations within server iterations served by the pool.
+    uint64_t poolAllocations{0};
+    /// Allocations within server iterations forwarded to the system allocator (no free block of
+    /// a sufficient size), including the warm-up.
+    uint64_t poolMisses{0};
+    /// Pool misses after the warm-up.
+    uint64_t violations{0};
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Common.h"  // AttributeId
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/**
+ * Builder of ReadValueId batches with a single arena for all nested data.
+ *
+ * Every ReadValueId object allocates its string identifiers, index range and data encoding name
+ * separately, so building large batch reads results in thousands of small allocations. The builder
+ * stores the items as native structs and copies all nested strings and byte strings into one
+ * contiguous buffer instead. With @ref reserve, a batch is built with a constant number of
+ * allocations, independent of the number of items.
+ *
+ * @code
+ * ReadRequestBuilder builder;
+ * builder.reserve(ids.size(), ids.size() * 32);
+ * for (const auto& id : ids) {
+ *     builder.add(id, AttributeId::Value);
+ * }
+ * const auto values = services::readAttributes(client, builder.getItems());
+ * @endcode
+ *
+ * The items are views into the builder and must not outlive it. They are invalidated by the next
+ * call of @ref add, @ref reserve or @ref clear.
+ */
+class ReadRequestBuilder {
+public:
+    ReadRequestBuilder() = default;
+
+    /// Reserve memory for the given number of items and nested data in bytes.
+    void reserve(size_t items, size_t arenaBytes = 0);
+
+    /// Append an item, the nested data is copied into the arena.
+    ReadRequestBuilder& add(
+        const NodeId& id,
+        AttributeId attributeId = AttributeId::Value,
+        std::string_view indexRange = {},
+        const QualifiedName& dataEncoding = {}
+    );
+
+    /// Get the items, valid until the builder is modified or destroyed.
+    /// The pointers to the nested data are updated with every call (the arena might have moved).
+    Span<const ReadValueId> getItems() noexcept;
+
+    /// Number of items.
+    size_t size() const noexcept {
+        return items_.size();
+    }
+
+    /// Size of the nested data in the arena in bytes.
+    size_t getArenaSize() const noexcept {
+        return arena_.size();
+    }
+
+    /// Remove all items, the capacity is retained.
+    void clear() noexcept;
+
+private:
+    /// Location of a nested string within an item.
+    struct Relocation {
+        size_t item;
+        size_t memberOffset;  // offset of the UA_String member within UA_ReadValueId
+        size_t arenaOffset;
+    };
+
+    void copyToArena(size_t item, size_t memberOffset, const UA_String& str);
+
+    std::vector<UA_ReadValueId> items_;
+    std::vector<uint8_t> arena_;
+    std::vector<Relocation> relocations_;
+};
+
+}  // namespace opcua
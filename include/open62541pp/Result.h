@@ -0,0 +1,217 @@
+#pragma once
+
+#include <cassert>
+#include <new>  // bad_alloc
+#include <optional>
+#include <type_traits>
+#include <utility>  // forward, move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+
+namespace opcua {
+
+/**
+ * Bad status code to construct an empty Result.
+ */
+class BadResult {
+public:
+    constexpr explicit BadResult(StatusCode code) noexcept
+        : code_(code) {
+        assert(code.isBad());
+    }
+
+    constexpr StatusCode code() const noexcept {
+        return code_;
+    }
+
+private:
+    StatusCode code_;
+};
+
+/**
+ * Value or bad status code of an operation, returned by exception-free functions.
+ *
+ * Expected failures, e.g. bad statuses of nodes on offline devices, cost a branch instead of
+ * unwinding the stack. A result with a value might have an uncertain status code.
+ *
+ * @code
+ * const auto result = services::tryReadValue(client, id);
+ * if (result) {
+ *     process(*result);
+ * } else {
+ *     log(result.code());
+ * }
+ * @endcode
+ */
+template <typename T>
+class [[nodiscard]] Result {
+public:
+    /// Create a result with a default-constructed value and a good status code.
+    constexpr Result() noexcept(std::is_nothrow_default_constructible_v<T>)
+        : value_(std::in_place) {}
+
+    /// Create a result with a value and a good or uncertain status code.
+    constexpr Result(T value, StatusCode code = {}) noexcept(  // NOLINT, implicit wanted
+        std::is_nothrow_move_constructible_v<T>
+    )
+        : code_(code),
+          value_(std::move(value)) {
+        assert(!code.isBad());
+    }
+
+    /// Create an empty result with a bad status code.
+    constexpr Result(BadResult error) noexcept  // NOLINT, implicit wanted
+        : code_(error.code()) {}
+
+    /// Status code of the operation.
+    constexpr StatusCode code() const noexcept {
+        return code_;
+    }
+
+    /// Check if the result contains a value.
+    constexpr bool hasValue() const noexcept {
+        return value_.has_value();
+    }
+
+    /// Check if the result contains a value.
+    constexpr explicit operator bool() const noexcept {
+        return hasValue();
+    }
+
+    /// Get the value.
+    /// @exception BadStatus If the result has no value (bad status code)
+    constexpr T& value() & {
+        checkValue();
+        return *value_;
+    }
+
+    /// @copydoc value
+    constexpr const T& value() const& {
+        checkValue();
+        return *value_;
+    }
+
+    /// @copydoc value
+    constexpr T&& value() && {
+        checkValue();
+        return std::move(*value_);
+    }
+
+    /// Get the value or the given default value if the result has no value.
+    template <typename U>
+    constexpr T valueOr(U&& defaultValue) const& {
+        return hasValue() ? *value_ : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    /// @copydoc valueOr
+    template <typename U>
+    constexpr T valueOr(U&& defaultValue) && {
+        return hasValue() ? std::move(*value_) : static_cast<T>(std::forward<U>(defaultValue));
+    }
+
+    /// Access the value (unchecked).
+    constexpr T& operator*() & noexcept {
+        assert(hasValue());
+        return *value_;
+    }
+
+    /// @copydoc operator*
+    constexpr const T& operator*() const& noexcept {
+        assert(hasValue());
+        return *value_;
+    }
+
+    /// @copydoc operator*
+    constexpr T&& operator*() && noexcept {
+        assert(hasValue());
+        return std::move(*value_);
+    }
+
+    /// Access the members of the value (unchecked).
+    constexpr T* operator->() noexcept {
+        assert(hasValue());
+        return &*value_;
+    }
+
+    /// @copydoc operator->
+    constexpr const T* operator->() const noexcept {
+        assert(hasValue());
+        return &*value_;
+    }
+
+private:
+    constexpr void checkValue() const {
+        if (!hasValue()) {
+            throw BadStatus(code_);
+        }
+    }
+
+    StatusCode code_;
+    std::optional<T> value_;
+};
+
+/**
+ * Status code of an operation without a value, returned by exception-free functions.
+ */
+template <>
+class [[nodiscard]] Result<void> {
+public:
+    /// Create a result with a good status code.
+    constexpr Result() noexcept = default;
+
+    /// Create a result with the status code of an operation.
+    constexpr Result(StatusCode code) noexcept  // NOLINT, implicit wanted
+        : code_(code) {}
+
+    /// Create a result with a bad status code.
+    constexpr Result(BadResult error) noexcept  // NOLINT, implicit wanted
+        : code_(error.code()) {}
+
+    /// Status code of the operation.
+    constexpr StatusCode code() const noexcept {
+        return code_;
+    }
+
+    /// Check if the status code is not bad.
+    constexpr bool hasValue() const noexcept {
+        return !code_.isBad();
+    }
+
+    /// Check if the status code is not bad.
+    constexpr explicit operator bool() const noexcept {
+        return hasValue();
+    }
+
+    /// Throw if the status code is bad.
+    /// @exception BadStatus If the status code is bad
+    constexpr void value() const {
+        if (!hasValue()) {
+            throw BadStatus(code_);
+        }
+    }
+
+private:
+    StatusCode code_;
+};
+
+namespace detail {
+
+/// Invoke a function returning a Result and convert exceptions into bad results.
+template <typename F>
+auto tryInvoke(F&& func) noexcept -> std::invoke_result_t<F> {
+    try {
+        return std::forward<F>(func)();
+    } catch (const BadStatus& e) {
+        return BadResult(e.code());
+    } catch (const std::bad_alloc&) {
+        return BadResult(UA_STATUSCODE_BADOUTOFMEMORY);
+    } catch (...) {
+        return BadResult(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+}  // namespace detail
+
+}  // namespace opcua
@@ -0,0 +1,121 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "open62541pp/Client.h"
+
+namespace opcua {
+
+/**
+ * ReverseHello message, sent by the server after it connected to a client.
+ * @see Server::addReverseConnect
+ */
+struct ReverseHello {
+    /// Application URI of the server.
+    std::string serverUri;
+    /// Endpoint URL of the server, used by the client to open the secure channel.
+    std::string endpointUrl;
+};
+
+/**
+ * Client side of reverse connects.
+ *
+ * Servers behind a firewall or NAT open the TCP connections to the listener instead of accepting
+ * connections of the clients (OPC UA Part 6, 7.1.3). The server introduces itself with a
+ * ReverseHello message, the client then opens the secure channel and session on the same
+ * connection.
+ *
+ * The listener keeps a Client per server (identified by the server URI), which is reused when the
+ * server reconnects, e.g. to recreate the subscriptions. The clients are distributed over a fixed
+ * number of event loop threads and driven with non-blocking iterations (see ClientFarm); the
+ * callbacks are invoked within these threads.
+ *
+ * @code
+ * ReverseConnectListener listener(4841, 2);
+ * listener.onSessionActivated([](Client& client, const ReverseHello& hello) { ... });
+ * listener.start();
+ * // server: server.addReverseConnect("opc.tcp://client-host:4841");
+ * @endcode
+ *
+ * @note Each connection is used for a single secure channel. Configure the security mode and
+ *       policy of the clients in the factory to match an endpoint of the server; reconnects to
+ *       another endpoint after the endpoint discovery would require another reverse connection.
+ * @note Requires open62541 v1.1 - v1.3 and a POSIX socket API.
+ */
+class ReverseConnectListener {
+public:
+    /// Factory to create the client of a server, e.g. with encryption (default: `Client()`).
+    using ClientFactory = std::function<std::unique_ptr<Client>(const ReverseHello&)>;
+    using SessionCallback = std::function<void(Client& client, const ReverseHello& hello)>;
+
+    /**
+     * Create a listener.
+     * @param port Port number of the listening socket (IPv4 and IPv6), 0 for an ephemeral port
+     * @param threads Number of event loop threads
+     * @param factory Client factory
+     */
+    explicit ReverseConnectListener(uint16_t port, size_t threads = 1, ClientFactory factory = {});
+
+    /// Stop the listener and disconnect the clients.
+    ~ReverseConnectListener();
+
+    ReverseConnectListener(const ReverseConnectListener&) = delete;
+    ReverseConnectListener(ReverseConnectListener&&) noexcept = delete;
+    ReverseConnectListener& operator=(const ReverseConnectListener&) = delete;
+    ReverseConnectListener& operator=(ReverseConnectListener&&) noexcept = delete;
+
+    /// Set the callback of activated sessions.
+    /// @note Call before the listener is started.
+    void onSessionActivated(SessionCallback callback);
+
+    /// Set the callback of closed sessions, e.g. after a connection loss.
+    /// @note Call before the listener is started.
+    void onSessionClosed(SessionCallback callback);
+
+    /**
+     * Open the listening socket and start the event loop threads.
+     * @exception BadStatus (BadNotSupported) If reverse connects are not supported
+     * @exception BadStatus (BadCommunicationError) If the socket can't be opened
+     */
+    void start();
+
+    /// Stop the event loop threads, close the listening socket and disconnect the clients.
+    void stop();
+
+    /// Check if the listener is running.
+    bool isRunning() const noexcept;
+
+    /// Port number of the listening socket (resolved after start for ephemeral ports).
+    uint16_t getPort() const noexcept;
+
+    /// Number of activated sessions.
+    size_t getSessionCount() const noexcept;
+
+private:
+    struct Session;
+    struct Worker;
+
+    void accept();
+    void run(Worker& worker);
+    void dispatch(int fd, ReverseHello hello);
+    void connect(Session& session, int fd);
+
+    uint16_t port_;
+    ClientFactory factory_;
+    SessionCallback onSessionActivated_;
+    SessionCallback onSessionClosed_;
+    int listenFd_{-1};
+    std::thread acceptor_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+    std::atomic<size_t> sessionCount_{0};
+};
+
+}  // namespace opcua
@@ -0,0 +1,99 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "open62541pp/Config.h"
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+
+namespace opcua {
+
+/**
+ * Scoped bump allocator for open62541 allocations.
+ *
+ * While the arena is alive, all allocations of open62541 (`UA_malloc`, `UA_calloc`,
+ * `UA_realloc`) of the current thread are served from large memory blocks of the arena.
+ * `UA_free` is a no-op for memory of the arena, the memory is released at once when the arena is
+ * destroyed. Memory allocated before the arena was created is forwarded to the previous allocator,
+ * so objects created outside the scope can be safely modified and destroyed within the scope.
+ *
+ * Use the arena for short-lived objects with many small allocations, e.g. to create or process a
+ * batch of thousands of DataValue objects:
+ * @code
+ * {
+ *     opcua::ScopedArena arena;
+ *     std::vector<opcua::DataValue> batch = results;  // deep copies, allocated from the arena
+ *     // ... process and modify batch
+ * }  // all allocations released here
+ * @endcode
+ *
+ * Arenas can be nested, the innermost arena is used for new allocations. Reallocations stay in
+ * the arena that owns the memory.
+ *
+ * @warning Objects allocated within the scope must not outlive the arena. Destroy them or copy the
+ *          data into non-open62541 types before the arena is destroyed.
+ * @warning Do not run the event loop of a client or server within the scope (e.g. synchronous
+ *          client services). open62541 might keep allocations like session or subscription state
+ *          beyond the scope.
+ * @note Requires open62541 compiled with `UA_ENABLE_MALLOC_SINGLETON`. The allocator hooks are
+ *       thread-local if open62541 is compiled with `UA_ENABLE_MULTITHREADING`.
+ */
+class ScopedArena {
+public:
+    /// Create and activate the arena.
+    /// @param blockSize Size of the memory blocks in bytes
+    explicit ScopedArena(size_t blockSize = 64 * 1024);
+
+    /// Deactivate the arena and release all memory.
+    ~ScopedArena();
+
+    ScopedArena(const ScopedArena&) = delete;
+    ScopedArena(ScopedArena&&) noexcept = delete;
+    ScopedArena& operator=(const ScopedArena&) = delete;
+    ScopedArena& operator=(ScopedArena&&) noexcept = delete;
+
+    /// Number of bytes allocated from the arena (including alignment and headers).
+    size_t getAllocatedBytes() const noexcept;
+
+    /// Check if the memory was allocated by the arena.
+    bool contains(const void* ptr) const noexcept;
+
+    /// Get the active arena of the current thread (`nullptr` if no arena is active).
+    static ScopedArena* getCurrent() noexcept;
+
+private:
+    struct AllocatorHooks {
+        void* (*mallocFn)(size_t size);
+        void (*freeFn)(void* ptr);
+        void* (*callocFn)(size_t nelem, size_t elsize);
+        void* (*reallocFn)(void* ptr, size_t size);
+    };
+
+    struct Block {
+        std::unique_ptr<std::byte[]> data;  // NOLINT
+        size_t size{0};
+        size_t used{0};
+    };
+
+    void* allocate(size_t size);
+    /// Find the arena of this or an outer scope that allocated the memory.
+    ScopedArena* findOwner(const void* ptr) noexcept;
+    const AllocatorHooks& getFallbackHooks() const noexcept;
+
+    static void* arenaMalloc(size_t size);
+    static void arenaFree(void* ptr);
+    static void* arenaCalloc(size_t nelem, size_t elsize);
+    static void* arenaRealloc(void* ptr, size_t size);
+
+    size_t blockSize_;
+    size_t allocatedBytes_{0};
+    std::vector<Block> blocks_;
+    ScopedArena* previous_;
+    AllocatorHooks previousHooks_;
+};
+
+}  // namespace opcua
+
+#endif
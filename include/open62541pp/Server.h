@@ -1,18 +1,37 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <memory>
+#include <optional>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>  // forward, pair
 #include <vector>
 
 #include "open62541pp/Config.h"
+#include "open62541pp/EventStream.h"
+#include "open62541pp/Historizing.h"
 #include "open62541pp/Logger.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/NodeProfiler.h"
+#include "open62541pp/Realtime.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/ValuePublisher.h"
+#include "open62541pp/Watchdog.h"
 #include "open62541pp/types/NodeId.h"
 
+#ifdef UAPP_HAS_PMR
+#include <memory_resource>
+#endif
+
 // forward declaration open62541
 struct UA_Server;
 
@@ -22,13 +41,134 @@ namespace opcua {
 class AccessControlBase;
 class ByteString;
 class DataType;
+class DataTypeRegistry;
 class Event;
+class NamespaceTable;
 template <typename ServerOrClient>
 class Node;
+struct ModelChanges;
+struct Nodeset;
+class PubSubConnection;
+struct PubSubConnectionConfig;
+class PublishedDataSet;
+struct RequestPolicy;
 class ServerContext;
 class Session;
-struct ValueBackendDataSource;
-struct ValueCallback;
+class Statistics;
+class Tracer;
+class VirtualNodeProvider;
+
+namespace services {
+struct NodeBatchResult;
+}  // namespace services
+
+/**
+ * Nodestore implementation of the server.
+ * @see Server::Server
+ */
+enum class NodestoreType {
+    /// Default nodestore of open62541 (hash map).
+    Default,
+    /// Read-optimized nodestore with a hash table per namespace. Readers hold reference counts
+    /// instead of locks and replaced nodes are reclaimed with the last release.
+    /// Suited for mostly static address spaces with read- and browse-heavy workloads.
+    /// @note Only available with open62541 v1.3
+    ReadOptimized,
+    /// Read-optimized nodestore with namespace 0 shared by all servers of the process.
+    /// Namespace 0 (a few thousand nodes) is kept once in memory instead of once per server:
+    /// the first server hands over its namespace 0, later servers drop their equivalent nodes
+    /// after construction. Edits of namespace 0 nodes create private copies (copy-on-write).
+    /// Suited for processes hosting multiple server instances, e.g. on embedded gateways.
+    /// @note Only available with open62541 v1.3
+    SharedNamespaceZero,
+};
+
+/**
+ * Network backend of the server's TCP network layer.
+ * @see Server::setNetworkBackend
+ */
+enum class NetworkBackend {
+    /// Default TCP network layer of open62541 (select).
+    Default,
+    /// TCP network layer based on epoll, scales to thousands of connections.
+    /// @note Only available on Linux with open62541 v1.1 - v1.3
+    Epoll,
+};
+
+/**
+ * Options of the shared memory transport.
+ * @see Server::addSharedMemoryTransport
+ */
+struct SharedMemoryOptions {
+    /// Maximum number of concurrent connections (slots of the segment).
+    size_t maxConnections{16};
+    /// Size of the ring buffers per connection and direction in bytes, rounded up to a power of
+    /// two. Larger messages are streamed through the ring.
+    size_t ringSize{256 * 1024};
+    /// File mode of the segment, e.g. `0660` to allow clients of the same group.
+    uint32_t permissions{0600};
+    /// Remove the TCP network layers, the server is only reachable via shared memory.
+    /// The server then waits for messages with a futex instead of polling the rings.
+    bool exclusive{false};
+};
+
+/**
+ * Request size and resource limits of the server to protect its latency and memory.
+ *
+ * The operation limits are advertised to clients with the
+ * `Server_ServerCapabilities_OperationLimits` variables. Unset options keep the current values,
+ * `0` means no limit.
+ *
+ * @see Server::setLimits
+ */
+struct ServerLimits {
+    /// Maximum number of nodes per Read request.
+    std::optional<uint32_t> maxNodesPerRead;
+    /// Maximum number of nodes per Write request.
+    std::optional<uint32_t> maxNodesPerWrite;
+    /// Maximum number of nodes per Browse request.
+    std::optional<uint32_t> maxNodesPerBrowse;
+    /// Maximum number of methods per Call request.
+    std::optional<uint32_t> maxNodesPerMethodCall;
+    /// Maximum number of browse paths per TranslateBrowsePathsToNodeIds request.
+    std::optional<uint32_t> maxNodesPerTranslateBrowsePaths;
+    /// Maximum number of nodes per AddNodes, DeleteNodes, AddReferences, DeleteReferences request.
+    std::optional<uint32_t> maxNodesPerNodeManagement;
+    /// Maximum number of monitored items per CreateMonitoredItems (etc.) request.
+    std::optional<uint32_t> maxMonitoredItemsPerCall;
+
+    /// Maximum number of secure channels.
+    std::optional<uint16_t> maxSecureChannels;
+    /// Maximum number of sessions.
+    std::optional<uint16_t> maxSessions;
+
+    /// Maximum number of subscriptions of all sessions (open62541 >= v1.1, ignored otherwise).
+    std::optional<uint32_t> maxSubscriptions;
+    /// Maximum number of subscriptions per session.
+    std::optional<uint32_t> maxSubscriptionsPerSession;
+    /// Maximum number of monitored items of all sessions (open62541 >= v1.1, ignored otherwise).
+    std::optional<uint32_t> maxMonitoredItems;
+    /// Maximum number of monitored items per subscription.
+    std::optional<uint32_t> maxMonitoredItemsPerSubscription;
+    /// Maximum number of queued publish requests per session.
+    std::optional<uint32_t> maxPublishRequestsPerSession;
+    /// Maximum number of notifications per publish response.
+    std::optional<uint32_t> maxNotificationsPerPublish;
+    /// Maximum queue size of monitored items, larger requested queue sizes are revised.
+    std::optional<uint32_t> maxMonitoredItemQueueSize;
+
+    /**
+     * Memory budget of the monitored item queues in bytes.
+     *
+     * open62541 doesn't account the memory of queued notifications, the budget is enforced by
+     * revising the maximum queue size such that `maxMonitoredItems` full queues of notifications
+     * with an estimated size of `estimatedNotificationSize` fit into the budget. Requires
+     * `maxMonitoredItems` (set with these or previous limits).
+     */
+    std::optional<size_t> monitoredItemQueueMemory;
+    /// Estimated size of a queued notification in bytes, see monitoredItemQueueMemory.
+    size_t estimatedNotificationSize{256};
+};
 
 /**
  * High-level server class.
@@ -45,8 +185,14 @@ public:
      *
      * @param port Port number
      * @param certificate Optional X.509 v3 certificate in `DER` encoded format
+     * @param nodestore Nodestore implementation
+     * @exception BadStatus (BadNotSupported) If the nodestore is not available
      */
-    explicit Server(uint16_t port = 4840, ByteString certificate = {});
+    explicit Server(
+        uint16_t port = 4840,
+        ByteString certificate = {},
+        NodestoreType nodestore = NodestoreType::Default
+    );
 
 #ifdef UA_ENABLE_ENCRYPTION
     /**
@@ -64,6 +210,7 @@ public:
      * @param trustList List of trusted certificates in `DER` encoded format
      * @param issuerList List of issuer certificates (i.e. CAs) in `DER` encoded format
      * @param revocationList Certificate revocation lists (CRL) in `DER` encoded format
+     * @param nodestore Nodestore implementation
      *
      * @see https://reference.opcfoundation.org/Core/Part2/v105/docs/8
      * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/6.1
@@ -75,18 +222,52 @@ public:
         const ByteString& privateKey,
         Span<const ByteString> trustList,
         Span<const ByteString> issuerList,
-        Span<const ByteString> revocationList = {}
+        Span<const ByteString> revocationList = {},
+        NodestoreType nodestore = NodestoreType::Default
     );
 #endif
 
     /// Set custom logging function.
     void setLogger(Logger logger);
+    /// Set custom logging function with options, e.g. a minimum log level or async logging.
+    void setLogger(Logger logger, const LoggerOptions& options);
 
     /// Set custom access control.
     void setAccessControl(AccessControlBase& accessControl);
     /// Set custom access control (transfer ownership to Server).
     void setAccessControl(std::unique_ptr<AccessControlBase> accessControl);
 
+    /**
+     * Enable/disable caching of node access control decisions, default: disabled.
+     *
+     * The access control is called per node and request, e.g. for every node of a browse
+     * request. With caching enabled, the decisions of AccessControlBase::getUserRightsMask,
+     * AccessControlBase::getUserAccessLevel, AccessControlBase::getUserExecutable and
+     * AccessControlBase::allowBrowseNode are cached per (session, node, callback).
+     * Decisions are not cached if the callback throws.
+     *
+     * The cache of a session is invalidated when the session is activated or closed. Use
+     * @ref invalidateAccessControlCache if the decisions change otherwise, e.g. if the roles of a
+     * user change.
+     */
+    void setAccessControlCaching(bool enabled);
+
+    /// Invalidate the cached access control decisions of all sessions (thread-safe).
+    void invalidateAccessControlCache();
+
+    /// Invalidate the cached access control decisions of a session (thread-safe).
+    void invalidateAccessControlCache(const NodeId& sessionId);
+
+    /**
+     * Set a per-session rate limit of node operations, default: unlimited.
+     *
+     * open62541 processes requests in arrival order, so a single client with large, frequent
+     * requests increases the latency of all other sessions. The rate limit throttles such clients
+     * with token buckets per session, weighted to prioritize sessions.
+     * @see RequestPolicy
+     */
+    void setRequestPolicy(RequestPolicy policy);
+
     /// Set custom hostname, default: system's host name.
     void setCustomHostname(std::string_view hostname);
     /// Set application name, default: `open62541-based OPC UA Application`.
@@ -96,43 +277,645 @@ public:
     /// Set product URI, default: `http://open62541.org`.
     void setProductUri(std::string_view uri);
 
+    /**
+     * Set secure channel options for all network layers, e.g. larger chunks for high throughput
+     * with encryption. The lifetime is the maximum lifetime of the security tokens granted to
+     * clients.
+     * @note Call before the server is started.
+     */
+    void setSecureChannelOptions(const SecureChannelOptions& options);
+
+    /**
+     * Set transport configuration of all network layers, e.g. larger buffers for bulk transfers.
+     * The socket options are only applied by NetworkBackend::Epoll.
+     * @note Call before the server is started.
+     */
+    void setTransportConfig(const TransportConfig& config);
+
+    /**
+     * Set request size and resource limits, e.g. to prevent single clients from exhausting the
+     * server's memory with subscriptions and monitored items.
+     * Changed limits apply to new requests, existing sessions and subscriptions are kept.
+     * @exception BadStatus (BadInvalidArgument) If the memory budget is set without
+     *            `maxMonitoredItems` or too small for a queue size of 1
+     * @see ServerLimits
+     */
+    void setLimits(const ServerLimits& limits);
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+    /**
+     * Enable the realtime profile: malloc-free server iterations in steady state.
+     *
+     * The session and monitored item limits of the options are applied to the server config.
+     * A pool of fixed-size blocks is preallocated for the estimated demand of these limits:
+     * network buffers, secure channel and session state, monitored items and their queues,
+     * notification messages and values. Allocations of open62541 within Server::runIterate (and
+     * the main loop of Server::run and Server::runInBackground) are served from the pool. After
+     * the warm-up iterations, allocations that can't be served from the pool are reported as
+     * violations (see RealtimeOptions::violationAction and getRealtimeStatistics).
+     *
+     * Allocations of the wrapper itself (e.g. `operator new` within callbacks) and of queued
+     * commands are not covered, keep the callbacks of realtime servers allocation-free.
+     *
+     * @note Call before the server is started.
+     * @note Requires open62541 compiled with `UA_ENABLE_MALLOC_SINGLETON`. If the allocator hooks
+     *       are thread-local (`UA_ENABLE_MULTITHREADING`), pooled memory must be released by the
+     *       thread running the server.
+     * @exception BadStatus (BadInvalidState) If the server is running
+     * @exception BadStatus (BadResourceUnavailable) If too many servers use the realtime profile
+     */
+    void enableRealtime(const RealtimeOptions& options = {});
+
+    /// Get the pool and violation statistics of the realtime profile (empty if not enabled).
+    RealtimeStatistics getRealtimeStatistics() const;
+#endif
+
+    /**
+     * Set the network backend of the server's TCP network layer, default: NetworkBackend::Default.
+     *
+     * The default network layer of open62541 waits for messages with `select`, which scans all
+     * sockets with every iteration and is limited to `FD_SETSIZE` connections. The epoll backend
+     * reports ready sockets only, the cost of an iteration doesn't grow with idle connections.
+     * The transport config of the replaced network layer is kept.
+     *
+     * @note Call before the server is started.
+     * @exception BadStatus (BadNotSupported) If the backend is not available
+     * @exception BadStatus (BadInvalidState) If the server is running
+     * @see getNetworkFd
+     */
+    void setNetworkBackend(NetworkBackend backend);
+
+    /**
+     * Get a pollable file descriptor of the network backend to integrate the server into an
+     * external event loop (e.g. epoll or io_uring).
+     *
+     * The descriptor is readable while messages or connections are pending. Wait until the
+     * descriptor is readable or the wait period returned by Server::runIterate elapsed (the next
+     * timer deadline), then call Server::runIterate again:
+     *
+     * @code
+     * const int fd = server.getNetworkFd();  // add to the epoll instance of the event loop
+     * auto timeout = server.runIterate();
+     * while (...) {
+     *     epoll_wait(loopFd, events, maxEvents, timeout);
+     *     timeout = server.runIterate();
+     * }
+     * @endcode
+     *
+     * @returns File descriptor or -1 if the network backend doesn't provide one
+     *          (NetworkBackend::Default)
+     */
+    int getNetworkFd() const noexcept;
+
+    /**
+     * Add a shared memory transport for clients on the same host (`opc.shm://<name>`).
+     *
+     * The transport creates the POSIX shared memory segment `/uapp-<name>` with a pair of
+     * lock-free ring buffers per connection. Clients connect with the endpoint URL
+     * `opc.shm://<name>` (see Client::connect), the binary protocol and security are unchanged.
+     * Messages skip the TCP/IP stack and readers are woken with futexes, which reduces the latency
+     * and CPU cost of local clients like HMIs and historians.
+     *
+     * The transport is served alongside the TCP network layers, but an iteration waits for
+     * messages on the TCP layers then. Use SharedMemoryOptions::exclusive for the lowest latency.
+     *
+     * @param name Name of the transport, without slashes
+     * @param options Number of connections, ring size and permissions
+     * @note Call before the server is started.
+     * @note Only available on Linux with open62541 v1.1 - v1.3
+     * @exception BadStatus (BadNotSupported) If the transport is not available
+     * @exception BadStatus (BadInvalidState) If the server is running
+     * @exception BadStatus (BadInvalidArgument) If the name is empty or contains slashes
+     */
+    void addSharedMemoryTransport(std::string_view name, const SharedMemoryOptions& options = {});
+
+    /**
+     * Add a reverse connect to a client, e.g. if the server is behind a firewall or NAT.
+     *
+     * The server opens the TCP connection to the client and introduces itself with a ReverseHello
+     * message, the client then opens the secure channel and session on this connection
+     * (OPC UA Part 6, 7.1.3). The connection is re-established after it was closed.
+     * Can be called from any thread, the connection is opened with the next iteration.
+     *
+     * @param clientUrl URL of the client's listener, e.g. `opc.tcp://client-host:4841`
+     * @returns Id of the reverse connect
+     * @exception BadStatus (BadNotSupported) If NetworkBackend::Epoll is not used
+     * @exception BadStatus (BadTcpEndpointUrlInvalid) If the URL is invalid
+     * @see ReverseConnectListener
+     */
+    uint64_t addReverseConnect(std::string_view clientUrl);
+
+    /**
+     * Remove a reverse connect and close its connection.
+     * @exception BadStatus (BadNotFound) If the reverse connect doesn't exist
+     */
+    void removeReverseConnect(uint64_t id);
+
     /// Get active client session.
     std::vector<Session> getSessions() const;
 
+#ifdef UAPP_HAS_PMR
+    /// Get active client sessions in a `std::pmr::vector` with storage allocated from `resource`.
+    std::pmr::vector<Session> getSessions(std::pmr::memory_resource* resource) const;
+#endif
+
+    /// Get the number of active client sessions.
+    size_t getSessionCount() const noexcept;
+
+    /**
+     * Invoke a callback for each active client session, without allocating a session vector.
+     * The callback has the signature `void(Session&)` and must not close sessions.
+     */
+    template <typename F>
+    void forEachSession(F&& callback) {
+        forEachSessionImpl(&callback, [](void* ptr, Session& session) {
+            (*static_cast<std::remove_reference_t<F>*>(ptr))(session);
+        });
+    }
+
     /// Get all defined namespaces.
     std::vector<std::string> getNamespaceArray();
+    /// Get the cached namespace table, refreshed after namespaces are registered.
+    /// Namespaces added with the native API (`UA_Server_addNamespace`) are not tracked.
+    std::shared_ptr<const NamespaceTable> getNamespaceTable();
     /// Register namespace. The new namespace index will be returned.
     [[nodiscard]] uint16_t registerNamespace(std::string_view uri);
 
+    /**
+     * Load a nodeset file into the address space.
+     *
+     * Accepts NodeSet2 XML files as well as binary snapshots written by writeNodesetBinary, which
+     * load much faster. The namespaces of the nodeset are registered and mapped to the namespace
+     * indices of the server.
+     *
+     * @param filepath Path to the NodeSet2 XML file or binary snapshot
+     * @returns Status of all node and reference definitions
+     * @exception BadStatus (BadNotFound) If the file can not be opened
+     * @exception BadStatus (BadDecodingError) If the file is malformed
+     * @see Nodeset.h
+     */
+    services::NodeBatchResult loadNodeset(std::string_view filepath);
+
+    /// Load a parsed nodeset into the address space.
+    /// @see loadNodeset(std::string_view)
+    services::NodeBatchResult loadNodeset(Nodeset nodeset);
+
+    /**
+     * Apply a model to the subtree of a node with a minimal set of changes.
+     *
+     * The model describes the desired nodes of the subtree. It is compared with the existing nodes
+     * (found by hierarchical references of the root node) instead of re-creating the subtree:
+     * - nodes that aren't part of the model are deleted
+     * - nodes that aren't part of the address space are added in a single batch, together with the
+     *   references of the model that refer to them
+     * - the display name, description and value of existing nodes are written if they differ
+     *
+     * Unchanged nodes keep their monitored items and value bindings. A single coalesced
+     * `GeneralModelChangeEvent` is triggered for all added and deleted nodes (if events are
+     * enabled). The namespaces of the model are registered and mapped like with @ref loadNodeset.
+     * Nodes of namespace 0 are never deleted.
+     *
+     * @param rootId Root node of the subtree, the model nodes refer to it or to other model nodes
+     * @param model Desired nodes of the subtree
+     * @note Values are compared with open62541 v1.3 or later, older versions write every value.
+     */
+    ModelChanges applyModel(const NodeId& rootId, Nodeset model);
+
+    /**
+     * Mount a provider of virtual nodes at a folder.
+     *
+     * The provider owns the namespace, its nodes are materialized on demand by any service and kept
+     * in a least recently used cache of `cacheSize` nodes. The folder references the root nodes of
+     * the provider. Must be called before the server is running.
+     *
+     * @param folderId Existing (non-virtual) folder to reference the root nodes from
+     * @param namespaceIndex Registered namespace owned by the provider (not 0)
+     * @param provider Provider of the node definitions
+     * @param cacheSize Maximum number of materialized nodes of the namespace
+     * @exception BadStatus (BadInvalidArgument) If the namespace already has a provider
+     * @exception BadStatus (BadNotSupported) If open62541 isn't v1.3
+     * @see VirtualNodes.h
+     */
+    void addVirtualNodes(
+        const NodeId& folderId,
+        uint16_t namespaceIndex,
+        std::shared_ptr<VirtualNodeProvider> provider,
+        size_t cacheSize = 10000
+    );
+
+    /// Number of currently materialized virtual nodes of a namespace.
+    size_t getVirtualNodeCount(uint16_t namespaceIndex);
+
+    /**
+     * Write a binary snapshot of the address space (all nodes except namespace 0).
+     * The snapshot contains the current values of all variable nodes and can be restored with
+     * @ref restoreSnapshot for a fast warm restart.
+     *
+     * @param filepath Path of the snapshot file
+     * @exception BadStatus (BadNotFound) If the file can not be opened for writing
+     * @see exportNodeset
+     * @note Requires open62541 v1.3 or later.
+     */
+    void writeSnapshot(std::string_view filepath);
+
+    /**
+     * Restore a snapshot written by @ref writeSnapshot and reattach the value bindings.
+     *
+     * Callbacks are not part of the snapshot. The value callbacks and data source backends are
+     * reattached by node id after all nodes are restored; the data source backends are set with a
+     * single bulk operation (see @ref setVariableNodeValueBackends).
+     *
+     * @param filepath Path of the snapshot file
+     * @param valueCallbacks Value callbacks to reattach
+     * @param dataSources Data source backends to reattach
+     * @returns Status of all restored node and reference definitions
+     * @exception BadStatus (BadNotFound) If the file can not be opened
+     * @exception BadStatus (BadDecodingError) If the snapshot is invalid
+     * @exception BadStatus If a value binding can not be reattached (e.g. unknown node id)
+     */
+    services::NodeBatchResult restoreSnapshot(
+        std::string_view filepath,
+        Span<const std::pair<NodeId, ValueCallback>> valueCallbacks = {},
+        Span<const std::pair<NodeId, ValueBackendDataSource>> dataSources = {}
+    );
+
     /// Set custom data types.
     /// All data types provided are automatically considered for decoding of received messages.
     void setCustomDataTypes(std::vector<DataType> dataTypes);
+    /// Set custom data types of a shared registry (`nullptr` to reset).
+    /// The registry is referenced instead of copied, the data types are not duplicated.
+    /// @see DataTypeRegistry
+    void setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry);
 
     /// Set value callbacks to execute before every read and after every write operation.
     void setVariableNodeValueCallback(const NodeId& id, ValueCallback callback);
+
+    /**
+     * Set grouped value callbacks for multiple variable nodes.
+     *
+     * The nodes are refreshed with a single `onBeforeRead` invocation, e.g. to refresh all nodes
+     * of a read request from the same device cache. See ValueCallbackGroup.
+     * Previously set value callbacks of the nodes are replaced.
+     *
+     * @param ids Node ids of the variable nodes
+     * @param callbacks Grouped value callbacks
+     */
+    void setVariableNodeValueCallbackGroup(Span<const NodeId> ids, ValueCallbackGroup callbacks);
     /// Set data source backend for variable node.
     void setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSource backend);
+    /**
+     * Set typed data source backend for variable node.
+     *
+     * The data source object is a class with the member functions (the write function is
+     * optional, writes are rejected with `BadWriteNotSupported` without it):
+     * - `StatusCode read(DataValue& value, const NumericRange& range, bool timestamp)`
+     * - `StatusCode write(const DataValue& value, const NumericRange& range)`
+     *
+     * The semantics are the same as ValueBackendDataSource. A dedicated native callback is
+     * generated for every data source type and the member functions are called directly without
+     * type erasure. Typed data sources are not recorded in the statistics and not traced.
+     *
+     * @param id Node id of the variable node
+     * @param source Data source object, moved into the server and kept alive until it is replaced
+     *               or the server is destroyed
+     */
+    template <
+        typename DataSource,
+        typename = std::enable_if_t<
+            !std::is_same_v<std::decay_t<DataSource>, ValueBackendDataSource>>>
+    void setVariableNodeValueBackend(const NodeId& id, DataSource&& source) {
+        using T = std::decay_t<DataSource>;
+        UA_DataSource dataSourceNative{};
+        dataSourceNative.read = detail::typedDataSourceRead<T>;
+        if constexpr (detail::HasDataSourceWrite<T>::value) {
+            dataSourceNative.write = detail::typedDataSourceWrite<T>;
+        }
+        setVariableNodeValueBackendTyped(
+            id, std::make_shared<T>(std::forward<DataSource>(source)), dataSourceNative
+        );
+    }
+
+    /// Set data source backends for multiple variable nodes.
+    /// Preferable to many Server::setVariableNodeValueBackend calls for large address spaces.
+    void setVariableNodeValueBackends(
+        Span<const std::pair<NodeId, ValueBackendDataSource>> backends
+    );
+
+    /**
+     * Set grouped data source backend for multiple variable nodes.
+     *
+     * The nodes are read with a single batch read callback, e.g. to read all nodes of a read
+     * request with one transaction of the device driver. See ValueBackendDataSourceGroup.
+     * Previously set value backends of the nodes are replaced.
+     *
+     * @param ids Node ids of the variable nodes
+     * @param group Grouped data source
+     */
+    void setVariableNodeValueBackendGroup(
+        Span<const NodeId> ids, ValueBackendDataSourceGroup group
+    );
+
+    /**
+     * Set external value backend for variable node backed by user memory.
+     *
+     * The node value points directly to the user memory (e.g. a process image). Reads and the
+     * sampling of monitored items copy the value from the memory without invoking any C++
+     * callbacks. The memory and the optional status must stay valid until the value backend is
+     * replaced or the server is destroyed.
+     *
+     * Writes are copied into the memory if `T` is non-const and the written value matches the type
+     * and size of the memory. Writes with index ranges are not supported.
+     *
+     * The memory is not synchronized with the server. Updates from other threads must be atomic
+     * per value, otherwise reads might return torn values.
+     *
+     * @tparam T Arithmetic value type (e.g. `double` or `const double` for read-only values)
+     * @param id Node id of the variable node
+     * @param value Pointer to the scalar value in user memory
+     * @param status Optional status and source timestamp attached to the read values
+     * @note Requires open62541 v1.2 or later.
+     */
+    template <typename T>
+    void setVariableNodeValueBackendExternal(
+        const NodeId& id, T* value, ValueBackendExternalStatus* status = nullptr
+    ) {
+        setVariableNodeValueBackendExternalImpl<std::remove_const_t<T>>(
+            id, const_cast<std::remove_const_t<T>*>(value), 1, false, !std::is_const_v<T>, status
+        );
+    }
+
+    /**
+     * Set external value backend for variable node backed by an array in user memory.
+     * Same as the scalar overload, writes must match the array size.
+     * @param id Node id of the variable node
+     * @param values Array in user memory
+     * @param status Optional status and source timestamp attached to the read values
+     */
+    template <typename T>
+    void setVariableNodeValueBackendExternal(
+        const NodeId& id, Span<T> values, ValueBackendExternalStatus* status = nullptr
+    ) {
+        setVariableNodeValueBackendExternalImpl<std::remove_const_t<T>>(
+            id,
+            const_cast<std::remove_const_t<T>*>(values.data()),
+            values.size(),
+            true,
+            !std::is_const_v<T>,
+            status
+        );
+    }
+
+    /**
+     * Create a lock-free publisher for high-rate scalar value updates of variable nodes.
+     *
+     * The nodes are resolved once and a read-only data source backend is installed for each node,
+     * replacing previously set value backends. The slots are initialized with the current node
+     * values. Values can be published from any thread while the server is running.
+     *
+     * @tparam T Arithmetic value type matching the data type of the nodes (e.g. `double`)
+     * @param ids Node ids of the variable nodes
+     * @exception BadStatus If a node doesn't exist or the current value type doesn't match `T`
+     */
+    template <typename T>
+    ValuePublisher<T> createValuePublisher(Span<const NodeId> ids);
+
+    /**
+     * Refresh the value of a variable node periodically in the background.
+     *
+     * The refresh function (e.g. a slow device read) is executed by the worker threads of the
+     * refresh scheduler, decoupled from the server iteration. The results are published with a
+     * value publisher (see @ref createValuePublisher), reads and the sampling of monitored items
+     * are served from the cached value. The source timestamp is the time of the last successful
+     * refresh and indicates the staleness of the value. If the refresh function throws, the
+     * previous value is kept.
+     *
+     * @tparam T Arithmetic value type matching the data type of the node (e.g. `double`)
+     * @param id Node id of the variable node
+     * @param interval Refresh interval, measured from the end of the previous refresh
+     * @param refresh Function returning the current value, called from a worker thread
+     * @exception BadStatus If the node doesn't exist or the current value type doesn't match `T`
+     */
+    template <typename T>
+    void addValueRefresh(
+        const NodeId& id, std::chrono::milliseconds interval, std::function<T()> refresh
+    );
+
+#ifdef UA_ENABLE_HISTORIZING
+    /**
+     * Record the values of a variable node in an in-memory history (ring buffer).
+     *
+     * Every value written to the node is stored and served to HistoryRead requests with
+     * ReadRawModifiedDetails. The `Historizing` attribute is set and the `HistoryRead` bit is
+     * added to the `AccessLevel` attribute. Values of data source backends are not recorded.
+     * Enabling the history again resets the stored values.
+     *
+     * @param id Variable node
+     * @param options Capacity and retention of the history
+     * @note Installs the history database of the server config on first use.
+     */
+    void enableHistorizing(const NodeId& id, const HistorizingOptions& options = {});
+#endif
+
+#ifdef UAPP_ASYNC_METHODS
+    /**
+     * Set the number of worker threads to execute async method calls (default: 1).
+     * @see services::addMethodAsync
+     * @exception BadStatus (BadInvalidState) If called after the first async method was added
+     */
+    void setAsyncMethodThreads(size_t count);
+#endif
+
+    /**
+     * Set the number of worker threads of the refresh scheduler (default: 1).
+     * @exception BadStatus (BadInvalidState) If called after the first Server::addValueRefresh
+     */
+    void setValueRefreshThreads(size_t count);
+
+    /**
+     * Set the number of worker threads of all server worker pools (default: 1).
+     *
+     * Work that doesn't have to run in the server's main loop is offloaded to worker threads:
+     * async method calls (see services::addMethodAsync) and value refresh functions (see
+     * Server::addValueRefresh). Both pools are sized with `count`, e.g. the number of cores.
+     *
+     * @note Read, write and browse requests are processed within the main loop of open62541
+     *       (`UA_Server_run_iterate`), because open62541 provides async operations for method
+     *       calls only. Keep value callbacks and data sources fast or use value refreshes to move
+     *       expensive work to the workers.
+     * @exception BadStatus (BadInvalidState) If called after a worker pool was started
+     */
+    void setWorkerThreads(size_t count);
+
+    /**
+     * Set the thread configuration (CPU affinity, priority, NUMA node) of server threads.
+     * The configuration is applied by the threads when they start, e.g. pin the network thread
+     * and the workers to the cores of the socket with the network interface.
+     * @param role Network thread (applied with the next Server::runInBackground) or worker threads
+     * @param config Thread configuration
+     * @exception BadStatus (BadInvalidState) If the workers are configured after a worker pool was
+     *                      started
+     */
+    void setThreadConfig(ThreadRole role, const ThreadConfig& config);
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     /// Create a (pseudo) subscription to monitor local data changes and events.
     Subscription<Server> createSubscription() noexcept;
+
+    /**
+     * Notify a value change of a variable node, e.g. of a data source or external memory.
+     * The event-driven monitored items of the node (see MonitoringParameters::eventDriven) are
+     * sampled immediately, nodes without event-driven monitored items are ignored.
+     * Writes of remote clients can be forwarded with the `onAfterWrite` value callback.
+     */
+    void notifyValueChanged(const NodeId& id);
+
+    /// @overload
+    void notifyValueChanged(Span<const NodeId> ids);
 #endif
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
     /// Create an event object to generate and trigger events.
     Event createEvent(const NodeId& eventType = ObjectTypeId::BaseEventType);
+
+    /**
+     * Create a thread-safe event stream to trigger queued events in batches.
+     *
+     * The queued events are triggered within the server's main loop every `options.interval`,
+     * limited to `options.maxRate` events per second. The event node and the fields are resolved
+     * once (see EventTemplate).
+     *
+     * @param originId Origin node of the events (requires `EventNotifier` attribute)
+     * @param eventType Event type
+     * @param fields Fields of the event type set by the pushed values
+     * @param options Rate limit, queue size and trigger interval
+     * @exception BadStatus (BadNoMatch) If a field doesn't exist in the event type
+     */
+    EventStream createEventStream(
+        const NodeId& originId,
+        const NodeId& eventType,
+        Span<const QualifiedName> fields,
+        const EventStreamOptions& options = {}
+    );
 #endif
 
+#ifdef UA_ENABLE_PUBSUB
+    /**
+     * Add a PubSub connection to publish UADP network messages, e.g. over UDP multicast.
+     * The transport layer is registered with the first connection of its transport.
+     * @see PubSubConnection
+     */
+    PubSubConnection addPubSubConnection(const PubSubConnectionConfig& config);
+
+    /// Add a published data set, its fields are bound to variables or user memory.
+    /// @see PublishedDataSet
+    PublishedDataSet addPublishedDataSet(std::string_view name);
+#endif
+
+    /**
+     * Enable/disable updates of the CachedClock by the server, default: disabled.
+     *
+     * The cached clock is updated once per iteration of the main loop (and with every command
+     * interval of Server::runInBackground). The server registers itself as update source, so
+     * CachedClock::now is served from the cache while enabled.
+     */
+    void setCachedClock(bool enabled);
+
     /// Run a single iteration of the server's main loop.
     /// @returns Maximum wait period until next Server::runIterate call (in ms)
     uint16_t runIterate();
     /// Run the server's main loop. This method will block until Server::stop is called.
     void run();
-    /// Stop the server's main loop.
+    /**
+     * Run the server's main loop in an internal network thread (non-blocking).
+     *
+     * The server instance is not thread-safe. While the network thread is running, other threads
+     * must not call services directly. Use Server::post or Server::execute instead to marshal
+     * calls into the network thread via a lock-free command queue.
+     *
+     * With NetworkBackend::Epoll, queued commands wake up the network thread immediately.
+     *
+     * @param commandIntervalMilliseconds Interval to wake up the network thread and process queued
+     *                                    commands, i.e. the maximum latency of commands
+     *                                    (NetworkBackend::Default)
+     */
+    void runInBackground(uint16_t commandIntervalMilliseconds = 10);
+    /// Stop the server's main loop (and join the network thread if running in background).
+    /// Must not be called from within the network thread.
     void stop();
+
+    /**
+     * Queue a command to be executed in the thread running the server's main loop.
+     * The command queue is processed with every iteration of the main loop. This method is
+     * thread-safe and doesn't block. Exceptions thrown by the command are ignored.
+     * With NetworkBackend::Epoll, a waiting iteration is woken up to execute the command.
+     */
+    void post(std::function<void()> command);
+
+    /**
+     * Queue a command to be executed in the thread running the server's main loop.
+     * This method is thread-safe and doesn't block.
+     * @return Future with the return value or exception of the command
+     * @see post
+     */
+    template <typename F>
+    auto execute(F&& command) {
+        using Result = std::invoke_result_t<F>;
+        auto task = std::make_shared<std::packaged_task<Result()>>(std::forward<F>(command));
+        auto future = task->get_future();
+        post([task = std::move(task)] { (*task)(); });
+        return future;
+    }
+
     /// Check if the server is running.
     bool isRunning() const noexcept;
 
+    /// Get latency and error statistics of value callbacks, data sources and method callbacks.
+    /// @see Statistics
+    Statistics& getStatistics() noexcept;
+
+    /// Set a tracer to trace value callbacks, data sources and method callbacks (`nullptr` to
+    /// disable tracing). Set the tracer before the server is started.
+    /// @see Tracer
+    void setTracer(std::shared_ptr<Tracer> tracer);
+
+    /**
+     * Enable the profiler of node accesses to find the nodes driving the server load.
+     *
+     * Reads, writes, browses and samples of monitored items are counted per node with sampled
+     * counters and a count-min sketch, the overhead per node access is a thread-local increment.
+     * Use the report to move hot nodes to external value backends or to throttle clients.
+     *
+     * @note Call before the server is started.
+     * @exception BadStatus (BadInvalidState) If the profiler is already enabled
+     * @exception BadStatus (BadNotSupported) If open62541 isn't v1.3
+     * @see NodeAccess
+     */
+    void enableNodeProfiler(const NodeProfilerOptions& options = {});
+
+    /// Get the most accessed nodes, sorted by their estimated count (empty if not enabled).
+    std::vector<HotNode> getHotNodes() const;
+
+    /// Reset the counts of the node profiler.
+    void resetNodeProfiler();
+
+    /**
+     * Enable the watchdog of the event loop and node callbacks.
+     *
+     * Stalls of the event loop and node callbacks (value callbacks, data sources, method
+     * callbacks) exceeding their budgets are logged and reported with the offending node.
+     * Methods exceeding the budget repeatedly can be moved to the async method worker pool (see
+     * WatchdogOptions::migrateMethodsAfter).
+     *
+     * @note Call before the server is started. Gaps between manual calls of runIterate are
+     *       reported as stalls.
+     * @see WatchdogOptions
+     */
+    void enableWatchdog(const WatchdogOptions& options = {});
+
+    /// Disable the watchdog.
+    /// @note Call before the server is started or after it was stopped.
+    void disableWatchdog();
+
     Node<Server> getNode(NodeId id);
     Node<Server> getRootNode();
     Node<Server> getObjectsNode();
@@ -147,6 +930,22 @@ public:
     ServerContext& getContext() noexcept;
 
 private:
+    void forEachSessionImpl(void* callback, void (*invoke)(void*, Session&));
+
+    void setVariableNodeValueBackendTyped(
+        const NodeId& id, std::shared_ptr<void> source, UA_DataSource dataSourceNative
+    );
+
+    template <typename T>
+    void setVariableNodeValueBackendExternalImpl(
+        const NodeId& id,
+        T* data,
+        size_t size,
+        bool isArray,
+        bool writable,
+        ValueBackendExternalStatus* status
+    );
+
     class Connection;
     std::shared_ptr<Connection> connection_;
 };
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Logger.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/types/Builtin.h"
+
+namespace opcua {
+
+// forward declaration
+class DataTypeRegistry;
+
+/**
+ * Options of a ServerGroup.
+ */
+struct ServerGroupOptions {
+    /// Number of event loop threads, the servers are distributed round-robin.
+    size_t threads{1};
+    /// Nodestore of the servers created by ServerGroup::addServer.
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+    NodestoreType nodestore{NodestoreType::SharedNamespaceZero};
+#else
+    NodestoreType nodestore{NodestoreType::Default};
+#endif
+    /// Maximum wait period of an event loop iteration, i.e. the maximum latency of commands
+    /// queued with Server::post. Also the latency of network messages of servers without a
+    /// pollable network backend (see Server::getNetworkFd).
+    std::chrono::milliseconds commandInterval{10};
+    /// Configuration of the event loop threads (CPU affinity, priority, NUMA node).
+    ThreadConfig threadConfig;
+};
+
+/**
+ * Certificate store shared by the servers of a ServerGroup.
+ * @see Server::Server
+ */
+struct ServerGroupCertificates {
+    /// X.509 v3 certificate in `DER` encoded format.
+    ByteString certificate;
+    /// Private key in `PEM` encoded format (encryption only).
+    ByteString privateKey;
+    /// Trusted certificates in `DER` encoded format (encryption only).
+    std::vector<ByteString> trustList;
+    /// Issuer certificates (i.e. CAs) in `DER` encoded format (encryption only).
+    std::vector<ByteString> issuerList;
+    /// Certificate revocation lists (CRL) in `DER` encoded format (encryption only).
+    std::vector<ByteString> revocationList;
+};
+
+/**
+ * Host many servers of a process on a fixed number of event loop threads.
+ *
+ * The servers are driven with non-blocking iterations (Server::runIterate). Each server is owned by
+ * a single event loop thread, the servers of a thread are iterated when their network descriptor
+ * is readable (see Server::getNetworkFd) or their next timer is due. Servers created by the group
+ * use the epoll network backend if available.
+ *
+ * Shared resources:
+ * - namespace 0 is kept once in memory (see NodestoreType::SharedNamespaceZero)
+ * - custom data types are referenced by all servers (see setCustomDataTypes)
+ * - the certificate store is passed to all servers created by the group (see setCertificates)
+ * - log messages of all servers are passed to a single log sink (see setLogger)
+ *
+ * The servers must not be accessed directly by other threads while the group is running. Use
+ * Server::post or Server::execute to marshal calls into the event loop thread of a server.
+ *
+ * @code
+ * ServerGroup group({4});  // 4 event loop threads
+ * group.setCustomDataTypes(registry);
+ * group.setLogger([](size_t server, LogLevel level, LogCategory category, auto msg) { ... });
+ * for (uint16_t line = 0; line < 40; ++line) {
+ *     auto& server = group.addServer(4840 + line);
+ *     // add nodes...
+ * }
+ * group.start();
+ * @endcode
+ */
+class ServerGroup {
+public:
+    /// Log function with the index of the server returned by ServerGroup::addServer.
+    using LogFunction =
+        std::function<void(size_t server, LogLevel, LogCategory, std::string_view msg)>;
+
+    explicit ServerGroup(ServerGroupOptions options = {});
+
+    /// Stop the event loop threads and shut down the servers.
+    ~ServerGroup();
+
+    ServerGroup(const ServerGroup&) = delete;
+    ServerGroup(ServerGroup&&) noexcept = delete;
+    ServerGroup& operator=(const ServerGroup&) = delete;
+    ServerGroup& operator=(ServerGroup&&) noexcept = delete;
+
+    /// Set custom data types of a shared registry, referenced by all servers.
+    /// @note Call before the group is started.
+    void setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry);
+
+    /**
+     * Set the log sink of all servers.
+     * The calls of the logger are serialized, the logger doesn't have to be thread-safe.
+     * A BinaryLogSink (LoggerOptions::binarySink) is shared by all servers. LoggerOptions::async
+     * is ignored, it would start a background thread per server.
+     * @note Call before the group is started.
+     */
+    void setLogger(LogFunction logger, const LoggerOptions& options = {});
+
+    /**
+     * Set the certificate store of the servers created by addServer.
+     * Encryption is enabled if a private key is set (requires `UA_ENABLE_ENCRYPTION`).
+     * @note Call before the servers are added.
+     */
+    void setCertificates(ServerGroupCertificates certificates);
+
+    /**
+     * Create a server with the shared resources.
+     * @param port Port number
+     * @returns Server, owned by the group
+     * @exception BadStatus (BadInvalidState) If the group is running
+     * @exception BadStatus (BadNotSupported) If encryption is not available
+     */
+    Server& addServer(uint16_t port);
+
+    /**
+     * Add a server and apply the shared custom data types and logger.
+     * @returns Server, owned by the group
+     * @exception BadStatus (BadInvalidState) If the group is running
+     */
+    Server& addServer(std::unique_ptr<Server> server);
+
+    /// Number of servers.
+    size_t size() const noexcept;
+
+    /// Get a server by its index (in the order of addServer).
+    Server& getServer(size_t index);
+
+    /**
+     * Start the servers and the event loop threads.
+     * The servers are started by the calling thread.
+     * @exception BadStatus If a server fails to start (the started servers are shut down)
+     */
+    void start();
+
+    /// Stop the event loop threads and shut down the servers.
+    void stop();
+
+    /// Check if the event loop threads are running.
+    bool isRunning() const noexcept;
+
+private:
+    struct Entry;
+    struct Worker;
+
+    void applySharedResources(size_t index);
+    void run(Worker& worker);
+
+    ServerGroupOptions options_;
+    std::shared_ptr<const DataTypeRegistry> dataTypes_;
+    LogFunction logger_;
+    std::optional<LoggerOptions> loggerOptions_;
+    std::mutex loggerMutex_;
+    ServerGroupCertificates certificates_;
+    std::vector<std::unique_ptr<Entry>> entries_;
+    std::vector<std::unique_ptr<Worker>> workers_;
+    std::atomic<bool> running_{false};
+};
+
+}  // namespace opcua
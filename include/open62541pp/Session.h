@@ -1,5 +1,8 @@
 #pragma once
 
+#include <any>
+#include <utility>  // forward
+
 #include <open62541pp/types/NodeId.h>
 
 namespace opcua {
@@ -16,6 +19,10 @@ class Variant;
  * A session carries attributes in a key-value list. Custom attributes/meta-data can be attached to
  * a session as key-value pairs of QualifiedName and Variant.
  *
+ * Additionally, a typed context can be attached to a session, e.g. the user roles of a custom
+ * access control. The context is stored by the server in a hash map keyed by the session id and
+ * retrieved in constant time, so it can be used with every request.
+ *
  * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.6
  */
 class Session {
@@ -42,11 +49,34 @@ public:
     /// @note Only supported since open62541 v1.3
     void deleteSessionAttribute(const QualifiedName& key);
 
+    /**
+     * Attach a typed context to the session, a previous context is replaced.
+     * The context is owned by the server and destroyed when the session is closed.
+     * @exception BadStatus (BadSessionIdInvalid) If the session is not active
+     */
+    template <typename T, typename... Args>
+    T& emplaceContext(Args&&... args) {
+        return getContextStorage().emplace<T>(std::forward<Args>(args)...);
+    }
+
+    /// Get the attached context of type `T`.
+    /// @return Pointer to the context or `nullptr` if no context of type `T` is attached
+    template <typename T>
+    T* getContext() noexcept {
+        return std::any_cast<T>(findContextStorage());
+    }
+
+    /// Remove the attached context.
+    void resetContext() noexcept;
+
     /// Manually close this session.
     /// @note Only supported since open62541 v1.3
     void close();
 
 private:
+    std::any& getContextStorage();
+    std::any* findContextStorage() noexcept;
+
     Server& connection_;
     NodeId sessionId_;
 };
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <memory>
+#include <utility>  // move
+
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+/**
+ * Immutable, reference-counted Variant payload with copy-on-write.
+ *
+ * Copies of a SharedVariant share the same Variant instead of copying the data, e.g. a large
+ * array value (image, waveform) delivered to many data change callbacks and stored by many
+ * consumers. The payload is only copied if a holder mutates it while it is shared.
+ *
+ * The reference count is thread-safe like `std::shared_ptr`, the payload itself is never modified
+ * while it is shared and can be read from multiple threads.
+ *
+ * @see Subscription::subscribeDataChangeShared
+ */
+class SharedVariant {
+public:
+    /// Create an empty variant.
+    SharedVariant()
+        : SharedVariant(Variant{}) {}
+
+    /// Take over a variant (no copy).
+    explicit SharedVariant(Variant&& value)
+        : payload_(std::make_shared<Variant>(std::move(value))) {}
+
+    /// Copy a variant (deep copy).
+    explicit SharedVariant(const Variant& value)
+        : payload_(std::make_shared<Variant>(value)) {}
+
+    const Variant& get() const noexcept {
+        return *payload_;
+    }
+
+    const Variant& operator*() const noexcept {
+        return *payload_;
+    }
+
+    const Variant* operator->() const noexcept {
+        return payload_.get();
+    }
+
+    /// Get the mutable variant, the payload is copied first if it is shared (copy-on-write).
+    Variant& mutate() {
+        if (payload_.use_count() > 1) {
+            payload_ = std::make_shared<Variant>(*payload_);
+        }
+        // the payload is created non-const by SharedVariant and not shared anymore
+        return const_cast<Variant&>(*payload_);  // NOLINT
+    }
+
+    /// Number of SharedVariant instances sharing the payload.
+    long useCount() const noexcept {
+        return payload_.use_count();
+    }
+
+private:
+    std::shared_ptr<const Variant> payload_;
+};
+
+}  // namespace opcua
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+/**
+ * Latency histogram with logarithmic buckets (HDR-style).
+ *
+ * Each power of two is split into 8 linear sub-buckets, the relative error of percentiles is
+ * therefore at most 12.5%. Latencies from 1 ns up to ~18 min are tracked, larger values are
+ * recorded in the last bucket. Count, sum and maximum are exact.
+ *
+ * Recording uses relaxed atomic operations only and is safe to call from multiple threads.
+ * The histogram has a fixed size of ~2.5 KiB and does not allocate.
+ */
+class LatencyHistogram {
+public:
+    using Duration = std::chrono::nanoseconds;
+
+    /// Record a latency.
+    void record(Duration latency) noexcept;
+
+    /// Number of recorded latencies.
+    uint64_t getCount() const noexcept;
+    /// Sum of all recorded latencies.
+    Duration getSum() const noexcept;
+    /// Mean of all recorded latencies.
+    Duration getMean() const noexcept;
+    /// Maximum of all recorded latencies.
+    Duration getMax() const noexcept;
+    /// Estimate the percentile (0-100) of the recorded latencies (upper bound of bucket).
+    Duration getPercentile(double percentile) const noexcept;
+
+    /// Clear all recorded latencies.
+    /// Concurrent calls of @ref record might be partially lost.
+    void reset() noexcept;
+
+private:
+    static constexpr size_t subBucketBits = 3;
+    static constexpr size_t subBucketCount = size_t{1} << subBucketBits;
+    static constexpr size_t maxValueBits = 40;
+    static constexpr size_t bucketCount = (maxValueBits - subBucketBits + 1) * subBucketCount;
+
+    static size_t getBucketIndex(uint64_t value) noexcept;
+    static uint64_t getBucketUpperBound(size_t index) noexcept;
+
+    std::array<std::atomic<uint64_t>, bucketCount> buckets_{};
+    std::atomic<uint64_t> count_{0};
+    std::atomic<uint64_t> sum_{0};
+    std::atomic<uint64_t> max_{0};
+};
+
+/// Service types tracked by Statistics.
+enum class StatisticsService : uint8_t {
+    Read,
+    Write,
+    Browse,  ///< Browse, BrowseNext, TranslateBrowsePathsToNodeIds, (Un)RegisterNodes
+    Call,
+    NodeManagement,  ///< AddNodes, AddReferences, DeleteNodes, DeleteReferences
+    Subscription,  ///< CreateSubscription, ModifySubscription, DeleteSubscriptions
+    MonitoredItem,  ///< CreateMonitoredItems, ModifyMonitoredItems, DeleteMonitoredItems, ...
+    HistoryRead,
+};
+
+/// Callback types tracked by Statistics.
+enum class StatisticsCallback : uint8_t {
+    ValueCallback,  ///< ValueCallback::onBeforeRead and ValueCallback::onAfterWrite
+    DataSource,  ///< ValueBackendDataSource::read and ValueBackendDataSource::write
+    Method,  ///< Method callbacks
+};
+
+/// Latency and error count of an operation.
+struct OperationStatistics {
+    LatencyHistogram latency;
+    std::atomic<uint64_t> errorCount{0};
+};
+
+/**
+ * Runtime statistics of a Server or Client.
+ *
+ * Collects latency histograms and error counts of synchronous client services and server
+ * callbacks. Collection is always enabled, the overhead per operation is two clock reads and a
+ * few relaxed atomic increments.
+ *
+ * @see Server::getStatistics
+ * @see Client::getStatistics
+ */
+class Statistics {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Statistics of a service type (client only).
+    const OperationStatistics& getService(StatisticsService service) const noexcept {
+        return services_[static_cast<size_t>(service)];
+    }
+
+    /// Statistics of a callback type (server only).
+    const OperationStatistics& getCallback(StatisticsCallback callback) const noexcept {
+        return callbacks_[static_cast<size_t>(callback)];
+    }
+
+    /// Clear all statistics.
+    void reset() noexcept;
+
+    /// Record a service call started at `start`.
+    /// @private
+    void record(StatisticsService service, Clock::time_point start, UA_StatusCode status) noexcept;
+
+    /// Record a callback invocation started at `start`.
+    /// @private
+    void record(
+        StatisticsCallback callback, Clock::time_point start, UA_StatusCode status
+    ) noexcept;
+
+private:
+    static constexpr size_t serviceCount = 8;
+    static constexpr size_t callbackCount = 3;
+
+    std::array<OperationStatistics, serviceCount> services_{};
+    std::array<OperationStatistics, callbackCount> callbacks_{};
+};
+
+}  // namespace opcua
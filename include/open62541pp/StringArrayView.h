@@ -0,0 +1,155 @@
+#pragma once
+
+#include <cassert>
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+
+#include "open62541pp/detail/helper.h"  // toStringView
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+/**
+ * Non-owning view to an array of `UA_String` elements, accessed as `std::string_view`.
+ *
+ * Neither the array nor the characters are copied, the view must not outlive the array.
+ * The string views are created on access and are cheap to construct (pointer and length).
+ *
+ * @see Variant::getArrayView
+ */
+class StringArrayView {
+public:
+    class Iterator {
+    public:
+        // clang-format off
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = std::string_view;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = void;
+        using reference         = std::string_view;
+        // clang-format on
+
+        constexpr Iterator() noexcept = default;
+
+        constexpr explicit Iterator(const UA_String* ptr) noexcept
+            : ptr_(ptr) {}
+
+        std::string_view operator*() const noexcept {
+            return detail::toStringView(*ptr_);
+        }
+
+        std::string_view operator[](difference_type n) const noexcept {
+            return detail::toStringView(ptr_[n]);
+        }
+
+        constexpr Iterator& operator++() noexcept {
+            ++ptr_;
+            return *this;
+        }
+
+        constexpr Iterator operator++(int) noexcept {
+            return Iterator(ptr_++);
+        }
+
+        constexpr Iterator& operator--() noexcept {
+            --ptr_;
+            return *this;
+        }
+
+        constexpr Iterator operator--(int) noexcept {
+            return Iterator(ptr_--);
+        }
+
+        constexpr Iterator& operator+=(difference_type n) noexcept {
+            ptr_ += n;
+            return *this;
+        }
+
+        constexpr Iterator& operator-=(difference_type n) noexcept {
+            ptr_ -= n;
+            return *this;
+        }
+
+        constexpr friend Iterator operator+(Iterator it, difference_type n) noexcept {
+            return it += n;
+        }
+
+        constexpr friend Iterator operator+(difference_type n, Iterator it) noexcept {
+            return it += n;
+        }
+
+        constexpr friend Iterator operator-(Iterator it, difference_type n) noexcept {
+            return it -= n;
+        }
+
+        constexpr friend difference_type operator-(Iterator lhs, Iterator rhs) noexcept {
+            return lhs.ptr_ - rhs.ptr_;
+        }
+
+        // clang-format off
+        constexpr friend bool operator==(Iterator lhs, Iterator rhs) noexcept { return lhs.ptr_ == rhs.ptr_; }
+        constexpr friend bool operator!=(Iterator lhs, Iterator rhs) noexcept { return lhs.ptr_ != rhs.ptr_; }
+        constexpr friend bool operator<(Iterator lhs, Iterator rhs) noexcept { return lhs.ptr_ < rhs.ptr_; }
+        constexpr friend bool operator>(Iterator lhs, Iterator rhs) noexcept { return lhs.ptr_ > rhs.ptr_; }
+        constexpr friend bool operator<=(Iterator lhs, Iterator rhs) noexcept { return lhs.ptr_ <= rhs.ptr_; }
+        constexpr friend bool operator>=(Iterator lhs, Iterator rhs) noexcept { return lhs.ptr_ >= rhs.ptr_; }
+        // clang-format on
+
+    private:
+        const UA_String* ptr_{nullptr};
+    };
+
+    // clang-format off
+    using value_type     = std::string_view;
+    using size_type      = size_t;
+    using iterator       = Iterator;
+    using const_iterator = Iterator;
+    // clang-format on
+
+    constexpr StringArrayView() noexcept = default;
+
+    constexpr StringArrayView(const UA_String* data, size_t size) noexcept
+        : data_(data),
+          size_(size) {}
+
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return size_;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept {
+        return size_ == 0;
+    }
+
+    /// Pointer to the underlying `UA_String` array.
+    [[nodiscard]] constexpr const UA_String* data() const noexcept {
+        return data_;
+    }
+
+    [[nodiscard]] std::string_view operator[](size_t index) const noexcept {
+        assert(index < size_);
+        return detail::toStringView(data_[index]);
+    }
+
+    [[nodiscard]] std::string_view front() const noexcept {
+        return (*this)[0];
+    }
+
+    [[nodiscard]] std::string_view back() const noexcept {
+        return (*this)[size_ - 1];
+    }
+
+    [[nodiscard]] constexpr Iterator begin() const noexcept {
+        return Iterator(data_);
+    }
+
+    [[nodiscard]] constexpr Iterator end() const noexcept {
+        return Iterator(data_ + size_);  // NOLINT
+    }
+
+private:
+    const UA_String* data_{nullptr};
+    size_t size_{0};
+};
+
+}  // namespace opcua
@@ -1,14 +1,31 @@
 #pragma once
 
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>  // move
 #include <vector>
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/EventFields.h"
 #include "open62541pp/MonitoredItem.h"
+#include "open62541pp/NotificationQueue.h"
+#include "open62541pp/SharedVariant.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/detail/traits.h"
+#include "open62541pp/services/Attribute.h"
 #include "open62541pp/services/MonitoredItem.h"
 #include "open62541pp/services/Subscription.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/NodeId.h"
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -17,11 +34,9 @@ namespace opcua {
 
 // forward declarations
 class Client;
-class DataValue;
 class EventFilter;
 class Server;
-template <typename T>
-class Span;
+class SharedEventFilter;
 class Variant;
 
 using SubscriptionParameters = services::SubscriptionParameters;
@@ -33,12 +48,75 @@ template <typename T>
 using DataChangeCallback =
     std::function<void(const MonitoredItem<T>& item, const DataValue& value)>;
 
+/// Typed data change notification callback.
+/// The value references the received notification (no copy) if `T` is a native or wrapper type.
+/// Use `Span<const T>` for array values. If the received value is empty or of another type, the
+/// callback is invoked with a default-constructed value and a bad status code.
+/// @tparam T Value type
+/// @tparam ServerOrClient Server or Client
+template <typename T, typename ServerOrClient>
+using TypedDataChangeCallback = std::function<void(
+    const MonitoredItem<ServerOrClient>& item,
+    const T& value,
+    DateTime sourceTimestamp,
+    StatusCode status
+)>;
+
+/// Data change notification callback with a shared value payload.
+/// Monitored items of the same node share the payload of a notification instead of copying it.
+/// Keep the SharedVariant to retain the value without a copy.
+/// @tparam T Server or Client
+/// @see SharedVariant
+template <typename T>
+using SharedDataChangeCallback = std::function<void(
+    const MonitoredItem<T>& item,
+    const SharedVariant& value,
+    DateTime sourceTimestamp,
+    StatusCode status
+)>;
+
 /// Event notification callback.
 /// @tparam T Server or Client
 template <typename T>
 using EventCallback =
     std::function<void(const MonitoredItem<T>& item, Span<const Variant> eventFields)>;
 
+/// Typed event notification callback with the decoded event struct.
+/// @tparam T Event struct
+/// @tparam ServerOrClient Server or Client
+/// @see EventFields
+template <typename T, typename ServerOrClient>
+using TypedEventCallback =
+    std::function<void(const MonitoredItem<ServerOrClient>& item, const T& event)>;
+
+/**
+ * Health and backlog statistics of a subscription.
+ * @see Subscription::getStatistics
+ */
+struct SubscriptionStatistics {
+    /// Received (client) or reported (server) notifications since the creation.
+    uint64_t notificationCount{0};
+    /// Notifications per second since the previous call of Subscription::getStatistics.
+    double notificationsPerSecond{0.0};
+    /// Data change notifications with the overflow bit set, the queue of the monitored item in the
+    /// server discarded values.
+    uint64_t overflowCount{0};
+    /// Delay between the server (or source) timestamp of data changes and their reception.
+    /// Includes the publishing interval and clock offsets between server and client.
+    std::chrono::nanoseconds latencyMean{0};
+    std::chrono::nanoseconds latencyP99{0};
+    std::chrono::nanoseconds latencyMax{0};
+    /// Notifications waiting for the consumer (notification queue or data change batch).
+    size_t queuedCount{0};
+    /// Notifications discarded by the notification queue.
+    uint64_t droppedCount{0};
+    /// Publish requests the client keeps outstanding (configured, shared by all subscriptions).
+    uint16_t publishRequests{0};
+    /// Current parameters revised by the server (client only), e.g. retuned by the adaptive
+    /// publishing.
+    services::SubscriptionParameters parameters{};
+};
+
 /**
  * High-level subscription class.
  *
@@ -71,6 +149,11 @@ public:
     /// Get all local monitored items.
     std::vector<MonitoredItem<ServerOrClient>> getMonitoredItems();
 
+    /// Get the health and backlog statistics.
+    /// Servers report the notifications of all local monitored items.
+    /// @exception BadStatus (BadSubscriptionIdInvalid) If the client subscription doesn't exist
+    SubscriptionStatistics getStatistics();
+
     /// Modify this subscription.
     /// @note Not implemented for Server.
     /// @see services::modifySubscription
@@ -81,6 +164,37 @@ public:
     /// @see services::setPublishingMode
     void setPublishingMode(bool publishing);
 
+    /// Deliver all data change notifications of this subscription in batches.
+    /// @note Not implemented for Server.
+    /// @see services::setDataChangeBatchCallback
+    void setDataChangeBatchCallback(services::DataChangeBatchCallback callback);
+
+    /// Enqueue all data change notifications of this subscription into a lock-free queue.
+    /// Consume the notifications from any thread with NotificationQueue::tryPop or
+    /// NotificationQueue::poll.
+    /// @param capacity Maximum number of queued notifications
+    /// @param overflow Behaviour if the queue is full
+    /// @note Not implemented for Server.
+    /// @see services::setNotificationQueue
+    std::shared_ptr<NotificationQueue> enableNotificationQueue(
+        size_t capacity,
+        NotificationQueueOverflow overflow = NotificationQueueOverflow::DiscardNewest
+    );
+
+    /// Restore the callback delivery of data change notifications.
+    /// @note Not implemented for Server.
+    void disableNotificationQueue();
+
+    /// Retune the publishing interval, the maximum number of notifications per publish and the
+    /// number of outstanding publish requests depending on the notification load.
+    /// @note Not implemented for Server.
+    /// @see services::setAdaptivePublishing
+    void enableAdaptivePublishing(const services::AdaptivePublishingPolicy& policy = {});
+
+    /// Keep the current subscription parameters fixed.
+    /// @note Not implemented for Server.
+    void disableAdaptivePublishing();
+
     /// Create a monitored item for data change notifications (default settings).
     /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
     /// MonitoringParameters are used.
@@ -99,14 +213,91 @@ public:
         DataChangeCallback<ServerOrClient> onDataChange
     );
 
-    /// Create a monitored item for event notifications (default settings).
+    /// Create multiple monitored items for data change notifications with batched requests.
+    /// Items that could not be created have the monitored item id `0U`.
+    /// @copydetails services::MonitoringParameters
+    /// @note Not implemented for Server.
+    /// @see services::createMonitoredItemsDataChange
+    std::vector<MonitoredItem<ServerOrClient>> subscribeDataChange(
+        Span<const NodeId> ids,
+        AttributeId attribute,
+        MonitoringMode monitoringMode,
+        MonitoringParameters& parameters,
+        DataChangeCallback<ServerOrClient> onDataChange
+    );
+
+    /// Create a monitored item for typed data change notifications of the `Value` attribute.
+    /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
+    /// MonitoringParameters are used.
+    /// @see TypedDataChangeCallback
+    template <typename T>
+    MonitoredItem<ServerOrClient> subscribeDataChange(
+        const NodeId& id, TypedDataChangeCallback<T, ServerOrClient> onDataChange
+    ) {
+        MonitoringParameters parameters;
+        return subscribeDataChange<T>(
+            id, MonitoringMode::Reporting, parameters, std::move(onDataChange)
+        );
+    }
+
+    /// Create a monitored item for typed data change notifications of the `Value` attribute.
+    /// The data type of the node is validated once against `T`, notifications are decoded
+    /// directly from the received DataValue.
+    /// @copydetails services::MonitoringParameters
+    /// @exception BadStatus (BadTypeMismatch) If the data type of the node doesn't match `T`
+    /// @see TypedDataChangeCallback
+    template <typename T>
+    MonitoredItem<ServerOrClient> subscribeDataChange(
+        const NodeId& id,
+        MonitoringMode monitoringMode,
+        MonitoringParameters& parameters,
+        TypedDataChangeCallback<T, ServerOrClient> onDataChange
+    );
+
+    /// Create a monitored item for data change notifications of the `Value` attribute with shared
+    /// value payloads (default settings).
     /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
     /// MonitoringParameters are used.
+    /// @see SharedDataChangeCallback
+    MonitoredItem<ServerOrClient> subscribeDataChangeShared(
+        const NodeId& id, SharedDataChangeCallback<ServerOrClient> onDataChange
+    );
+
+    /// Create a monitored item for data change notifications of the `Value` attribute with shared
+    /// value payloads.
+    /// Servers read event-driven monitored items of a node once and hand the same payload to all
+    /// shared callbacks. Equal values sampled by other monitored items of a node within one
+    /// iteration of the server share the payload as well. Clients take over the received value
+    /// without a copy.
+    /// @copydetails services::MonitoringParameters
+    /// @see SharedDataChangeCallback
+    MonitoredItem<ServerOrClient> subscribeDataChangeShared(
+        const NodeId& id,
+        MonitoringMode monitoringMode,
+        MonitoringParameters& parameters,
+        SharedDataChangeCallback<ServerOrClient> onDataChange
+    );
+
+    /// Create a monitored item for event notifications (default settings).
+    /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
+    /// MonitoringParameters are used. The filter is copied to recreate the item after a session
+    /// loss, share the filter of many monitored items with SharedEventFilter instead.
     /// @note Not implemented for Server.
     MonitoredItem<ServerOrClient> subscribeEvent(
         const NodeId& id, const EventFilter& eventFilter, EventCallback<ServerOrClient> onEvent
     );
 
+    /// Create a monitored item for event notifications with a shared filter (default settings).
+    /// The monitored item references the filter instead of a copy, which is kept to recreate the
+    /// item after a session loss. Use it for many event notifiers with the same filter.
+    /// @note Not implemented for Server.
+    /// @see EventFilterBuilder
+    MonitoredItem<ServerOrClient> subscribeEvent(
+        const NodeId& id,
+        const SharedEventFilter& eventFilter,
+        EventCallback<ServerOrClient> onEvent
+    );
+
     /// Create a monitored item for event notifications.
     /// @copydetails services::MonitoringParameters
     /// @note Not implemented for Server.
@@ -117,6 +308,88 @@ public:
         EventCallback<ServerOrClient> onEvent
     );
 
+    /// Create a monitored item for typed event notifications (default settings).
+    /// The monitoring mode is set to MonitoringMode::Reporting and the default open62541
+    /// MonitoringParameters are used.
+    /// @note Not implemented for Server.
+    /// @see EventFields
+    template <typename T>
+    MonitoredItem<ServerOrClient> subscribeEvent(
+        const NodeId& id,
+        EventFields<T> fields,
+        detail::TypeIdentityT<TypedEventCallback<T, ServerOrClient>> onEvent
+    ) {
+        MonitoringParameters parameters;
+        return subscribeEvent<T>(
+            id, MonitoringMode::Reporting, parameters, std::move(fields), std::move(onEvent)
+        );
+    }
+
+    /// Create a monitored item for typed event notifications.
+    /// The event filter of `parameters` is replaced by the filter of `fields`, the event fields
+    /// are decoded into the event struct before the callback is invoked.
+    /// @copydetails services::MonitoringParameters
+    /// @note Not implemented for Server.
+    /// @see EventFields
+    template <typename T>
+    MonitoredItem<ServerOrClient> subscribeEvent(
+        const NodeId& id,
+        MonitoringMode monitoringMode,
+        MonitoringParameters& parameters,
+        EventFields<T> fields,
+        detail::TypeIdentityT<TypedEventCallback<T, ServerOrClient>> onEvent
+    ) {
+        parameters.filter = ExtensionObject::fromDecodedCopy(fields.createEventFilter());
+        return subscribeEvent(
+            id,
+            monitoringMode,
+            parameters,
+            [fields = std::move(fields), callback = std::move(onEvent)](
+                const MonitoredItem<ServerOrClient>& item, Span<const Variant> eventFields
+            ) { callback(item, fields.decode(eventFields)); }
+        );
+    }
+
+    /**
+     * Report the linked items only if the triggering item reports a notification.
+     * The linked items are set to MonitoringMode::Sampling with one SetMonitoringMode request and
+     * linked with one SetTriggering request (split by the `MaxMonitoredItemsPerCall` operation
+     * limit). Their queued values are then transmitted with the notifications of the triggering
+     * item, e.g. axis positions only when a part-done flag changes.
+     * @param triggeringItem Monitored item in MonitoringMode::Reporting
+     * @param linkedItems Monitored items of this subscription
+     * @note Not implemented for Server.
+     * @see services::setTriggering
+     */
+    void linkTriggered(
+        const MonitoredItem<ServerOrClient>& triggeringItem,
+        Span<const MonitoredItem<ServerOrClient>> linkedItems
+    );
+
+    /**
+     * Create monitored items in MonitoringMode::Sampling with batched requests and link them to
+     * the triggering item.
+     * Items that could not be created have the monitored item id `0U` and are not linked.
+     * @copydetails services::MonitoringParameters
+     * @note Not implemented for Server.
+     * @see linkTriggered
+     */
+    std::vector<MonitoredItem<ServerOrClient>> linkTriggered(
+        const MonitoredItem<ServerOrClient>& triggeringItem,
+        Span<const NodeId> ids,
+        AttributeId attribute,
+        MonitoringParameters& parameters,
+        DataChangeCallback<ServerOrClient> onDataChange
+    );
+
+    /// Remove the triggering links of the linked items.
+    /// The linked items stay in MonitoringMode::Sampling.
+    /// @note Not implemented for Server.
+    void unlinkTriggered(
+        const MonitoredItem<ServerOrClient>& triggeringItem,
+        Span<const MonitoredItem<ServerOrClient>> linkedItems
+    );
+
     /// Delete this subscription.
     /// @note Not implemented for Server.
     /// @see services::deleteSubscription
@@ -129,6 +402,115 @@ private:
 
 /* ---------------------------------------------------------------------------------------------- */
 
+namespace detail {
+
+template <typename T>
+struct TypedDataChangeTraits {
+    using ElementType = T;
+    static constexpr bool isArray = false;
+};
+
+template <typename T>
+struct TypedDataChangeTraits<Span<const T>> {
+    using ElementType = T;
+    static constexpr bool isArray = true;
+};
+
+/// Builtin type with the same encoding, e.g. DateTime for UtcTime or Int32 for enumerations.
+inline const UA_DataType* getEncodingBaseType(const UA_DataType* dataType) noexcept {
+    if (dataType == nullptr) {
+        return nullptr;
+    }
+    if (dataType->typeKind <= UA_DATATYPEKIND_DIAGNOSTICINFO) {
+        return &UA_TYPES[dataType->typeKind];  // NOLINT, builtin type kinds are type indices
+    }
+    if (dataType->typeKind == UA_DATATYPEKIND_ENUM) {
+        return &UA_TYPES[UA_TYPES_INT32];
+    }
+    return dataType;
+}
+
+template <typename T>
+void checkTypedDataChangeType(const NodeId& dataTypeId) {
+    using ElementType = typename TypedDataChangeTraits<T>::ElementType;
+    // abstract data types like BaseDataType or Number can not be checked
+    const UA_DataType* dataType = DataTypeRegistry::findBuiltinByTypeId(dataTypeId);
+    if (dataType == nullptr) {
+        return;
+    }
+    if (!isValidTypeCombination<ElementType>(dataType) &&
+        !isValidTypeCombination<ElementType>(getEncodingBaseType(dataType))) {
+        throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+    }
+}
+
+template <typename T, typename F>
+void invokeTypedDataChangeCallback(const DataValue& dv, const F& callback) {
+    using Traits = TypedDataChangeTraits<T>;
+    using ElementType = typename Traits::ElementType;
+    static_assert(
+        !Traits::isArray || isNativeType<ElementType> || isTypeWrapper<ElementType>,
+        "Array element type must be a native or wrapper type"
+    );
+
+    const UA_DataValue& native = *dv.handle();
+    const UA_Variant& variant = native.value;
+    const DateTime sourceTimestamp(native.hasSourceTimestamp ? native.sourceTimestamp : 0);
+    StatusCode status = native.hasStatus ? native.status : UA_STATUSCODE_GOOD;
+
+    const bool valid = variant.type != nullptr && variant.data != nullptr &&
+                       UA_Variant_isScalar(&variant) != Traits::isArray &&
+                       (isValidTypeCombination<ElementType>(variant.type) ||
+                        isValidTypeCombination<ElementType>(getEncodingBaseType(variant.type)));
+    if (!valid) {
+        static const T empty{};
+        if (!status.isBad()) {
+            status = UA_STATUSCODE_BADTYPEMISMATCH;
+        }
+        callback(empty, sourceTimestamp, status);
+        return;
+    }
+    if constexpr (Traits::isArray) {
+        const T array(static_cast<const ElementType*>(variant.data), variant.arrayLength);
+        callback(array, sourceTimestamp, status);
+    } else if constexpr (isNativeType<T> || isTypeWrapper<T>) {
+        callback(*static_cast<const T*>(variant.data), sourceTimestamp, status);
+    } else {
+        using NativeType = typename TypeConverter<T>::NativeType;
+        const T value = fromNative<T>(static_cast<NativeType*>(variant.data));
+        callback(value, sourceTimestamp, status);
+    }
+}
+
+}  // namespace detail
+
+template <typename ServerOrClient>
+template <typename T>
+MonitoredItem<ServerOrClient> Subscription<ServerOrClient>::subscribeDataChange(
+    const NodeId& id,
+    MonitoringMode monitoringMode,
+    MonitoringParameters& parameters,
+    TypedDataChangeCallback<T, ServerOrClient> onDataChange
+) {
+    detail::checkTypedDataChangeType<T>(services::readDataType(connection_, id));
+    return subscribeDataChange(
+        id,
+        AttributeId::Value,
+        monitoringMode,
+        parameters,
+        [callback = std::move(onDataChange)](
+            const MonitoredItem<ServerOrClient>& item, const DataValue& value
+        ) {
+            detail::invokeTypedDataChangeCallback<T>(
+                value,
+                [&](const T& typedValue, DateTime sourceTimestamp, StatusCode status) {
+                    callback(item, typedValue, sourceTimestamp, status);
+                }
+            );
+        }
+    );
+}
+
 template <typename T>
 inline bool operator==(const Subscription<T>& lhs, const Subscription<T>& rhs) noexcept {
     return (lhs.getConnection() == rhs.getConnection()) &&
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "open62541pp/types/Builtin.h"  // StatusCode
+
+namespace opcua {
+
+/**
+ * Placement and scheduling of a thread owned by the library.
+ *
+ * Threads are configured by themselves when they start, empty fields leave the inherited settings
+ * unchanged. Failures (e.g. missing privileges for realtime priorities) are ignored by library
+ * threads, use @ref applyThreadConfig in a thread of your own to check a configuration.
+ *
+ * @note Only supported on Linux, the configuration is ignored on other platforms.
+ */
+struct ThreadConfig {
+    /// Thread name shown by debuggers and `top -H`, truncated to 15 characters.
+    /// Threads of a pool get their index as suffix, e.g. `uapp-worker-2`.
+    std::string name;
+    /// CPUs the thread may run on (`pthread_setaffinity_np`), e.g. the cores of a socket.
+    std::vector<int> cpus;
+    /// Realtime priority with the `SCHED_FIFO` policy (1-99), requires `CAP_SYS_NICE`.
+    std::optional<int> priority;
+    /// NUMA node to prefer for memory allocated by the thread (`MPOL_PREFERRED`).
+    /// Pin the thread to CPUs of the same node to avoid cross-socket memory accesses.
+    std::optional<int> numaNode;
+};
+
+/**
+ * Threads of a server.
+ * @see Server::setThreadConfig
+ */
+enum class ThreadRole {
+    EventLoop,  ///< Network thread of Server::runInBackground
+    Worker,  ///< Worker threads of value refreshes and async method calls
+};
+
+/**
+ * Apply a thread configuration to the calling thread.
+ * All fields are applied, even if one of them fails. With `UAPP_ENABLE_ALLOC_STATS`, the
+ * allocations of the thread are counted as well (see enableAllocCounting).
+ * @param config Thread configuration
+ * @param index Index of the thread within a pool, appended to the name
+ * @return First bad status: BadNotSupported on other platforms than Linux, BadUserAccessDenied if
+ *         privileges are missing or BadInvalidArgument for invalid CPUs, priorities or nodes
+ */
+StatusCode applyThreadConfig(
+    const ThreadConfig& config, std::optional<size_t> index = std::nullopt
+) noexcept;
+
+}  // namespace opcua
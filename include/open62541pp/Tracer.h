@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <string_view>
+
+#include "open62541pp/open62541.h"
+
+namespace opcua {
+
+/**
+ * Interface to trace client services and server callbacks, e.g. with OpenTelemetry.
+ *
+ * A span is opened around each synchronous client service (named after the StatisticsService,
+ * e.g. `Read` or `Browse`) and around each server callback (`ValueCallback`, `DataSource` and
+ * `Method`). Spans of server callbacks are nested in the server's service processing, so
+ * implementations can use thread-local context propagation (e.g. OpenTelemetry scopes) to build
+ * parent-child relations.
+ *
+ * Without a tracer, the overhead is a single null pointer check per operation.
+ *
+ * @see Server::setTracer
+ * @see Client::setTracer
+ */
+class Tracer {
+public:
+    Tracer() = default;
+    virtual ~Tracer() = default;
+
+    Tracer(const Tracer&) = delete;
+    Tracer(Tracer&&) noexcept = delete;
+    Tracer& operator=(const Tracer&) = delete;
+    Tracer& operator=(Tracer&&) noexcept = delete;
+
+    /**
+     * Start a span.
+     * @param name Name of the operation
+     * @returns Opaque handle of the span (e.g. pointer to the span object of the tracing
+     *          backend), passed to @ref endSpan
+     */
+    virtual void* startSpan(std::string_view name) = 0;
+
+    /**
+     * End a span started with @ref startSpan.
+     * @param span   Handle returned by @ref startSpan
+     * @param status Service result or status of the callback
+     */
+    virtual void endSpan(void* span, UA_StatusCode status) noexcept = 0;
+
+    /// Set the ratio of traced operations (0.0 - 1.0), default: 1.0 (every operation).
+    /// Operations are sampled deterministically, e.g. every 10th operation with a ratio of 0.1.
+    void setSamplingRatio(double ratio) noexcept;
+    double getSamplingRatio() const noexcept;
+
+    /// Decide if the next operation is traced.
+    /// @private
+    bool shouldSample() noexcept;
+
+private:
+    std::atomic<double> samplingRatio_{1.0};
+    std::atomic<uint64_t> counter_{0};
+};
+
+namespace detail {
+
+/// RAII span, does nothing if the tracer is `nullptr` or the operation is not sampled.
+class TraceSpan {
+public:
+    TraceSpan(Tracer* tracer, std::string_view name)
+        : tracer_(tracer != nullptr && tracer->shouldSample() ? tracer : nullptr),
+          span_(tracer_ != nullptr ? tracer_->startSpan(name) : nullptr) {}
+
+    ~TraceSpan() {
+        if (tracer_ != nullptr) {
+            tracer_->endSpan(span_, status_);
+        }
+    }
+
+    TraceSpan(const TraceSpan&) = delete;
+    TraceSpan(TraceSpan&&) noexcept = delete;
+    TraceSpan& operator=(const TraceSpan&) = delete;
+    TraceSpan& operator=(TraceSpan&&) noexcept = delete;
+
+    void setStatus(UA_StatusCode status) noexcept {
+        status_ = status;
+    }
+
+private:
+    Tracer* tracer_;
+    void* span_;
+    UA_StatusCode status_{UA_STATUSCODE_GOOD};
+};
+
+}  // namespace detail
+
+}  // namespace opcua
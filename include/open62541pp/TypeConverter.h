@@ -1,8 +1,14 @@
 #pragma once
 
+#include <algorithm>  // max
 #include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <functional>  // less
 #include <iterator>  // distance
+#include <memory>  // allocator
 #include <string>
 #include <string_view>
 #include <type_traits>
@@ -14,6 +20,7 @@
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/detail/traits.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/DateTime.h"
 
 namespace opcua {
@@ -42,6 +49,10 @@ struct TypeIndexList {
 /**
  * Type conversion from and to native `UA_*` types.
  * Template specializations can be added for conversions of arbitrary types.
+ *
+ * Specializations can define `static constexpr bool isTriviallyMappable = true` if the memory
+ * layout of `ValueType` matches the `NativeType` and no conversion is required (e.g. packed
+ * structs of custom data types). Arrays of such types are converted with a single `memcpy`.
  */
 template <typename T, typename Enable = void>
 struct TypeConverter {
@@ -61,12 +72,20 @@ namespace detail {
 
 template <typename T>
 constexpr bool isValidTypeCombination(const UA_DataType* dataType) {
-    for (auto typeIndex : TypeConverter<T>::ValidTypes::toArray()) {
-        // compare pointer
-        if (dataType == &UA_TYPES[typeIndex]) {  // NOLINT
-            return true;
+    constexpr auto typeIndexes = TypeConverter<T>::ValidTypes::toArray();
+    // fast path: data type of UA_TYPES, compare the indexes only
+    const std::less<const UA_DataType*> less;
+    if (!less(dataType, UA_TYPES) && less(dataType, UA_TYPES + UA_TYPES_COUNT)) {  // NOLINT
+        const auto index = static_cast<TypeIndex>(dataType - UA_TYPES);  // NOLINT
+        for (auto typeIndex : typeIndexes) {
+            if (index == typeIndex) {
+                return true;
+            }
         }
-        // compare type ids
+        return false;
+    }
+    // copies of builtin data types (e.g. within custom data type arrays), compare type ids
+    for (auto typeIndex : typeIndexes) {
         if (dataType->typeId == UA_TYPES[typeIndex].typeId) {  // NOLINT
             return true;
         }
@@ -91,6 +110,43 @@ constexpr const UA_DataType& guessDataTypeFromIterator() {
     return guessDataType<ValueType>();
 }
 
+template <typename T, typename = void>
+struct IsTriviallyMappable {
+    using ValueType = typename TypeConverter<T>::ValueType;
+    using NativeType = typename TypeConverter<T>::NativeType;
+
+    // native or wrapper types of fundamental types or enums
+    static constexpr bool value = (std::is_arithmetic_v<NativeType> ||
+                                   std::is_enum_v<NativeType>) &&
+                                  (std::is_same_v<ValueType, NativeType> ||
+                                   isTypeWrapper<ValueType>);
+};
+
+template <typename T>
+struct IsTriviallyMappable<T, std::void_t<decltype(TypeConverter<T>::isTriviallyMappable)>> {
+    static constexpr bool value = TypeConverter<T>::isTriviallyMappable;
+};
+
+/// Memory layout of `T` matches its native type, arrays can be copied with `memcpy`.
+template <typename T>
+inline constexpr bool isTriviallyMappable = IsTriviallyMappable<UnqualifiedT<T>>::value;
+
+/// Converter provides batched array conversions (`fromNativeArray` and `toNativeArray`).
+template <typename T, typename = void>
+struct HasArrayConversion : std::false_type {};
+
+template <typename T>
+struct HasArrayConversion<T, std::void_t<decltype(TypeConverter<T>::fromNativeArray)>>
+    : std::true_type {};
+
+template <typename T>
+inline constexpr bool hasArrayConversion = HasArrayConversion<UnqualifiedT<T>>::value;
+
+template <typename It, typename Vector = std::vector<typename std::iterator_traits<It>::value_type>>
+inline constexpr bool isContiguousIterator = std::is_pointer_v<It> ||
+                                             std::is_same_v<It, typename Vector::iterator> ||
+                                             std::is_same_v<It, typename Vector::const_iterator>;
+
 /* ------------------------------------- Converter functions ------------------------------------ */
 
 /// Convert and copy from native type.
@@ -111,12 +167,27 @@ template <typename T>
 }
 
 /// Create and convert vector from native array.
-template <typename T, typename NativeType = typename TypeConverter<T>::NativeType>
-[[nodiscard]] std::vector<T> fromNativeArray(NativeType* array, size_t size) {
+/// The vector storage is obtained from `allocator`, e.g. a `std::pmr::polymorphic_allocator`.
+template <
+    typename T,
+    typename NativeType = typename TypeConverter<T>::NativeType,
+    typename Allocator = std::allocator<T>>
+[[nodiscard]] std::vector<T, Allocator> fromNativeArray(
+    NativeType* array, size_t size, const Allocator& allocator = Allocator()
+) {
     if constexpr (isBuiltinType<T> && std::is_fundamental_v<T>) {
-        return std::vector<T>(array, array + size);  // NOLINT
+        return std::vector<T, Allocator>(array, array + size, allocator);  // NOLINT
+    } else if constexpr (isTriviallyMappable<T>) {
+        static_assert(sizeof(T) == sizeof(NativeType));
+        std::vector<T, Allocator> result(size, allocator);
+        std::memcpy(result.data(), array, size * sizeof(T));  // NOLINT
+        return result;
+    } else if constexpr (hasArrayConversion<T>) {
+        std::vector<T, Allocator> result(size, allocator);
+        TypeConverter<T>::fromNativeArray(array, result.data(), size);
+        return result;
     } else {
-        std::vector<T> result(size);
+        std::vector<T, Allocator> result(size, allocator);
         for (size_t i = 0; i < size; ++i) {
             TypeConverter<T>::fromNative(array[i], result[i]);  // NOLINT
         }
@@ -126,13 +197,16 @@ template <typename T, typename NativeType = typename TypeConverter<T>::NativeTyp
 
 /// Create and convert vector from native array.
 /// @warning Type erased version, use with caution.
-template <typename T>
-[[nodiscard]] std::vector<T> fromNativeArray(
-    void* array, size_t size, [[maybe_unused]] const UA_DataType& dataType
+template <typename T, typename Allocator = std::allocator<T>>
+[[nodiscard]] std::vector<T, Allocator> fromNativeArray(
+    void* array,
+    size_t size,
+    [[maybe_unused]] const UA_DataType& dataType,
+    const Allocator& allocator = Allocator()
 ) {
     using NativeType = typename TypeConverter<T>::NativeType;
     assert(isValidTypeCombination<T>(&dataType));
-    return fromNativeArray<T>(static_cast<NativeType*>(array), size);
+    return fromNativeArray<T>(static_cast<NativeType*>(array), size, allocator);
 }
 
 /// Allocate native type.
@@ -173,8 +247,20 @@ template <typename InputIt>
     using NativeType = typename TypeConverter<ValueType>::NativeType;
     const size_t size = std::distance(first, last);
     auto* result = allocNativeArray<NativeType>(size, guessDataTypeFromIterator<InputIt>());
-    for (size_t i = 0; i < size; ++i) {
-        TypeConverter<ValueType>::toNative(*first++, result[i]);  // NOLINT
+    if constexpr (isTriviallyMappable<ValueType> && isContiguousIterator<InputIt> &&
+                  !std::is_same_v<ValueType, bool>) {
+        static_assert(sizeof(ValueType) == sizeof(NativeType));
+        if (size > 0) {
+            std::memcpy(result, &*first, size * sizeof(ValueType));  // NOLINT
+        }
+    } else if constexpr (hasArrayConversion<ValueType> && isContiguousIterator<InputIt>) {
+        if (size > 0) {
+            TypeConverter<ValueType>::toNativeArray(&*first, result, size);
+        }
+    } else {
+        for (size_t i = 0; i < size; ++i) {
+            TypeConverter<ValueType>::toNative(*first++, result[i]);  // NOLINT
+        }
     }
     return result;
 }
@@ -273,6 +359,25 @@ struct TypeConverter<WrapperType, std::enable_if_t<detail::isTypeWrapper<Wrapper
     }
 };
 
+/* ------------------------------ Implementation for StatusCode ------------------------------ */
+
+template <>
+struct TypeConverter<StatusCode> {
+    using ValueType = StatusCode;
+    using NativeType = UA_StatusCode;
+    using ValidTypes = TypeIndexList<UA_TYPES_STATUSCODE>;
+
+    static constexpr bool isTriviallyMappable = true;
+
+    static void fromNative(const NativeType& src, ValueType& dst) {
+        dst = src;
+    }
+
+    static void toNative(const ValueType& src, NativeType& dst) {
+        dst = src.get();
+    }
+};
+
 /* ---------------------------- Implementations for std library types --------------------------- */
 
 template <>
@@ -341,6 +446,23 @@ struct TypeConverter<std::chrono::time_point<Clock, Duration>> {
     static void toNative(const ValueType& src, NativeType& dst) {
         dst = DateTime::fromTimePoint(src).get();
     }
+
+    // branch-free loops, auto-vectorized by the compiler
+    static void fromNativeArray(const NativeType* src, ValueType* dst, size_t size) noexcept {
+        for (size_t i = 0; i < size; ++i) {
+            const int64_t sinceEpoch = std::max<int64_t>(src[i] - UA_DATETIME_UNIX_EPOCH, 0);
+            const DateTime::UaDuration duration(sinceEpoch);
+            dst[i] = ValueType(std::chrono::duration_cast<Duration>(duration));
+        }
+    }
+
+    static void toNativeArray(const ValueType* src, NativeType* dst, size_t size) noexcept {
+        for (size_t i = 0; i < size; ++i) {
+            dst[i] = UA_DATETIME_UNIX_EPOCH +
+                     std::chrono::duration_cast<DateTime::UaDuration>(src[i].time_since_epoch())
+                         .count();
+        }
+    }
 };
 
 }  // namespace opcua
@@ -131,6 +131,12 @@ public:
         std::swap(native_, native);
     }
 
+    /// Release the native object (move), the caller takes the ownership.
+    /// The wrapper is empty afterwards.
+    [[nodiscard]] T release() noexcept {
+        return std::exchange(native_, {});
+    }
+
     /// Get type as type index of the ::UA_TYPES array.
     static constexpr TypeIndex getTypeIndex() {
         return typeIndex;
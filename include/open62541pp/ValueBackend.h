@@ -1,12 +1,22 @@
 #pragma once
 
+#include <atomic>
+#include <cassert>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <type_traits>
+#include <utility>  // declval
 
-namespace opcua {
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Builtin.h"  // NumericRange, StatusCode
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
 
-// forward declaration
-class NodeId;
-class DataValue;
+namespace opcua {
 
 /**
  * Value callbacks for variable nodes.
@@ -35,6 +45,42 @@ struct ValueCallback {
      * @param value New value after the write operation
      */
     std::function<void(const DataValue& value)> onAfterWrite;
+
+    /**
+     * Minimum age of the last `onBeforeRead` invocation before it is invoked again.
+     * Reads within this age are served from the current value, e.g. if a client and the sampling
+     * of monitored items read the same node in short succession (0 = invoke for every read).
+     */
+    std::chrono::nanoseconds minRefreshAge{0};
+};
+
+/**
+ * Grouped value callbacks for variable nodes refreshed from the same source (e.g. device cache).
+ *
+ * open62541 reads the nodes of a read request (or the sampling of monitored items) one by one.
+ * Instead of one `onBeforeRead` invocation per node, the callback is invoked once to refresh all
+ * nodes of the group. A new refresh is triggered if a node is read again that was already read
+ * since the last refresh (i.e. by the next request) and the refresh is older than
+ * `minRefreshAge`, or if the refresh is older than `maxAge`.
+ *
+ * @see Server::setVariableNodeValueCallbackGroup
+ */
+struct ValueCallbackGroup {
+    /**
+     * Called before the value attributes of the nodes are read.
+     *
+     * Write the current values of the nodes (using e.g. services::writeValue or Node::writeValue)
+     * to refresh them. Exceptions are caught and the nodes are read with their current values.
+     *
+     * @param ids Nodes of the group in the order of registration
+     */
+    std::function<void(Span<const NodeId> ids)> onBeforeRead;
+
+    /// Minimum age of the last refresh before a repeated read of a node triggers a new refresh.
+    std::chrono::nanoseconds minRefreshAge{0};
+
+    /// Maximum age of the last refresh to serve node reads from.
+    std::chrono::milliseconds maxAge{100};
 };
 
 /**
@@ -76,4 +122,121 @@ struct ValueBackendDataSource {
     std::function<StatusCode(const DataValue& value, const NumericRange& range)> write;
 };
 
+/// Node of a data source group with the value to be set by the batch read callback.
+struct DataSourceGroupItem {
+    NodeId nodeId;
+    DataValue value;
+};
+
+/**
+ * Grouped data source backend for variable nodes served by the same device (driver).
+ *
+ * open62541 reads the nodes of a read request (or the sampling of monitored items) one by one.
+ * Instead of one read per node, the batch read callback is invoked once for all nodes of the group
+ * and the results are served from the batch for the following node reads.
+ * A new batch is read if a node is read again that was already served from the current batch
+ * (i.e. by the next request) or if the batch is older than `maxAge`.
+ *
+ * @see Server::setVariableNodeValueBackendGroup
+ */
+struct ValueBackendDataSourceGroup {
+    /**
+     * Callback to read the values of all nodes in the group with a single (fieldbus) transaction.
+     *
+     * Set the value, the result status and optionally a source timestamp of every item. The items
+     * are cleared before each batch read. Index ranges are applied by the server.
+     * If the callback throws, the reads of the nodes fail with the status of the exception.
+     *
+     * @param items Nodes of the group in the order of registration
+     */
+    std::function<void(Span<DataSourceGroupItem> items)> read;
+
+    /**
+     * Callback to write the value of a single node of the group.
+     * This function can be empty if the operation is unsupported.
+     * The current batch is discarded after every write.
+     *
+     * @param id Node id of the written node
+     * @param value The DataValue that has been written by the writer
+     * @param range If not empty, then only this selection of (non-scalar) data should be written
+     * @return StatusCode
+     */
+    std::function<StatusCode(const NodeId& id, const DataValue& value, const NumericRange& range)>
+        write;
+
+    /// Maximum age of a batch to serve node reads from.
+    std::chrono::milliseconds maxAge{100};
+};
+
+namespace detail {
+
+template <typename T, typename = void>
+struct HasDataSourceWrite : std::false_type {};
+
+template <typename T>
+struct HasDataSourceWrite<
+    T,
+    std::void_t<decltype(std::declval<T&>().write(
+        std::declval<const DataValue&>(), std::declval<const NumericRange&>()
+    ))>> : std::true_type {};
+
+inline NumericRange asNumericRange(const UA_NumericRange* range) {
+    return range == nullptr ? NumericRange() : NumericRange(*range);
+}
+
+/// Native read callback of a typed data source, the node context points to the data source.
+template <typename T>
+UA_StatusCode typedDataSourceRead(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    [[maybe_unused]] const UA_NodeId* nodeId,
+    void* nodeContext,
+    UA_Boolean includeSourceTimestamp,
+    const UA_NumericRange* range,
+    UA_DataValue* value
+) noexcept {
+    assert(nodeContext != nullptr && value != nullptr);
+    return invokeCatchStatus([&]() -> UA_StatusCode {
+        return static_cast<T*>(nodeContext)->read(
+            asWrapper<DataValue>(*value), asNumericRange(range), includeSourceTimestamp
+        );
+    });
+}
+
+/// Native write callback of a typed data source, the node context points to the data source.
+template <typename T>
+UA_StatusCode typedDataSourceWrite(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    [[maybe_unused]] const UA_NodeId* nodeId,
+    void* nodeContext,
+    const UA_NumericRange* range,
+    const UA_DataValue* value
+) noexcept {
+    assert(nodeContext != nullptr && value != nullptr);
+    return invokeCatchStatus([&]() -> UA_StatusCode {
+        return static_cast<T*>(nodeContext)->write(
+            asWrapper<DataValue>(*value), asNumericRange(range)
+        );
+    });
+}
+
+}  // namespace detail
+
+/**
+ * Optional status and source timestamp of an external value backend.
+ *
+ * The status and source timestamp are attached to the value of every read operation. Both can be
+ * updated from any thread together with the user memory.
+ * @see Server::setVariableNodeValueBackendExternal
+ */
+struct ValueBackendExternalStatus {
+    /// Status code of the value (UA_StatusCode).
+    std::atomic<uint32_t> status{0};
+    /// Source timestamp of the value (DateTime::get), not set if `0`.
+    std::atomic<int64_t> sourceTimestamp{0};
+};
+
 }  // namespace opcua
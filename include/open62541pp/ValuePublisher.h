@@ -0,0 +1,158 @@
+#pragma once
+
+#include <atomic>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/CachedClock.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+namespace detail {
+
+/**
+ * Value slot of a single node protected by a sequence lock.
+ * Written by one producer thread, read by the server thread without locks.
+ */
+template <typename T>
+struct ValuePublisherSlot {
+    std::atomic<uint32_t> sequence{0};
+    std::atomic<T> value{};
+    std::atomic<int64_t> sourceTimestamp{0};
+
+    void store(T newValue, int64_t newSourceTimestamp) noexcept {
+        const auto seq = sequence.load(std::memory_order_relaxed);
+        sequence.store(seq + 1, std::memory_order_relaxed);  // odd -> write in progress
+        std::atomic_thread_fence(std::memory_order_release);
+        value.store(newValue, std::memory_order_relaxed);
+        sourceTimestamp.store(newSourceTimestamp, std::memory_order_relaxed);
+        sequence.store(seq + 2, std::memory_order_release);
+    }
+
+    std::pair<T, int64_t> load() const noexcept {
+        while (true) {
+            const auto seq1 = sequence.load(std::memory_order_acquire);
+            const T currentValue = value.load(std::memory_order_relaxed);
+            const int64_t currentSourceTimestamp = sourceTimestamp.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            const auto seq2 = sequence.load(std::memory_order_relaxed);
+            if (seq1 == seq2 && (seq1 & 1U) == 0) {
+                return {currentValue, currentSourceTimestamp};
+            }
+        }
+    }
+};
+
+/**
+ * Node ids and change flags of a value publisher, independent of the value type.
+ * The flags are set by the producers and consumed by the server thread to sample event-driven
+ * monitored items (see MonitoringParameters::eventDriven).
+ */
+struct ValuePublisherStateBase {
+    explicit ValuePublisherStateBase(Span<const NodeId> nodeIds)
+        : ids(nodeIds.begin(), nodeIds.end()),
+          changed(std::make_unique<std::atomic<bool>[]>(nodeIds.size())) {}
+
+    void markChanged(size_t index) noexcept {
+        changed[index].store(true, std::memory_order_relaxed);
+        pending.store(true, std::memory_order_release);
+    }
+
+    std::vector<NodeId> ids;
+    std::unique_ptr<std::atomic<bool>[]> changed;  // NOLINT
+    std::atomic<bool> pending{false};
+};
+
+template <typename T>
+struct ValuePublisherState : ValuePublisherStateBase {
+    explicit ValuePublisherState(Span<const NodeId> nodeIds)
+        : ValuePublisherStateBase(nodeIds),
+          slots(std::make_unique<ValuePublisherSlot<T>[]>(nodeIds.size())) {}
+
+    std::unique_ptr<ValuePublisherSlot<T>[]> slots;  // NOLINT, stable addresses
+};
+
+}  // namespace detail
+
+/**
+ * Publisher for high-rate scalar value updates of variable nodes.
+ *
+ * The nodes are resolved once on creation and a data source backend is installed for each node.
+ * Producers write into a lock-free slot per node (sequence lock), the server reads the latest
+ * sample from the slot on every read or sampling operation. Writers never touch the nodestore.
+ *
+ * Every slot must only be written by a single thread at a time. The slots are shared with the
+ * server and stay valid until the server is destroyed, even if the publisher is destroyed before.
+ *
+ * Published values are flagged as changed. Event-driven monitored items of the nodes (see
+ * MonitoringParameters::eventDriven) are sampled by the server thread in the next iteration.
+ *
+ * @tparam T Arithmetic value type (e.g. `bool`, `int32_t`, `double`)
+ * @see Server::createValuePublisher
+ */
+template <typename T>
+class ValuePublisher {
+public:
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic types allowed");
+    static_assert(std::atomic<T>::is_always_lock_free, "Atomic value type must be lock-free");
+
+    /// Number of published nodes.
+    size_t size() const noexcept {
+        return state_->ids.size();
+    }
+
+    /// Get the node ids of the published nodes.
+    Span<const NodeId> getNodeIds() const noexcept {
+        return state_->ids;
+    }
+
+    /// Publish a new value with the given source timestamp (thread-safe, wait-free).
+    void publish(size_t index, T value, DateTime sourceTimestamp) noexcept {
+        assert(index < size());
+        state_->slots[index].store(value, sourceTimestamp.get());
+        state_->markChanged(index);
+    }
+
+    /// Publish a new value with the current time as source timestamp (thread-safe, wait-free).
+    /// The time is taken from the CachedClock.
+    void publish(size_t index, T value) {
+        publish(index, value, CachedClock::now());
+    }
+
+    /// Publish new values for all nodes with the same source timestamp.
+    /// The size of `values` must match the number of published nodes.
+    void publish(Span<const T> values, DateTime sourceTimestamp) noexcept {
+        assert(values.size() == size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            state_->slots[i].store(values[i], sourceTimestamp.get());
+            state_->markChanged(i);
+        }
+    }
+
+    /// Get the latest published value.
+    T getValue(size_t index) const noexcept {
+        assert(index < size());
+        return state_->slots[index].load().first;
+    }
+
+private:
+    friend class Server;
+
+    explicit ValuePublisher(std::shared_ptr<detail::ValuePublisherState<T>> state)
+        : state_(std::move(state)) {}
+
+    std::shared_ptr<detail::ValuePublisherState<T>> state_;
+};
+
+}  // namespace opcua
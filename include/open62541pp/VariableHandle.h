@@ -0,0 +1,98 @@
+#pragma once
+
+#include <type_traits>
+#include <utility>  // move
+
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+// forward declaration
+class Server;
+
+namespace detail {
+
+/**
+ * Check if the variable node accepts scalar values of the data type.
+ * @exception BadStatus (BadNodeClassInvalid) If the node is not a variable node
+ * @exception BadStatus (BadTypeMismatch) If the DataType or ValueRank of the node is incompatible
+ */
+void validateVariableHandle(Server& server, const NodeId& id, const UA_DataType& type);
+
+/// Write a validated value without the type checks of the Write service.
+void writeVariableHandle(
+    Server& server, const NodeId& id, const Variant& value, DateTime sourceTimestamp
+);
+
+/// Read the value without the Read service.
+Variant readVariableHandle(Server& server, const NodeId& id);
+
+}  // namespace detail
+
+/**
+ * Typed handle of a variable node for fast writes and reads (server only).
+ *
+ * The DataType and ValueRank of the node are validated once on creation. Writes bypass the Write
+ * service with its per-call type checks: the value is stored directly into the node (open62541
+ * v1.3 without `UA_ENABLE_IMMUTABLE_NODES`). Writes to nodes with value callbacks, data sources
+ * or historizing use the Write service to invoke the backends. Event-driven monitored items of
+ * the node (see MonitoringParameters::eventDriven) are sampled like with Node::writeValue.
+ *
+ * The handle is not synchronized with a server running in another thread. Use it within the
+ * server thread (e.g. callbacks) or while the server is not running. Use ValuePublisher to
+ * publish values from other threads.
+ *
+ * @note The type is only validated once, changes of the DataType or ValueRank of the node
+ *       afterwards are not detected.
+ * @tparam T Value type with a native OPC UA data type or a TypeConverter specialization
+ * @see Node::typed
+ */
+template <typename T>
+class VariableHandle {
+public:
+    /**
+     * Create a handle and validate the variable node.
+     * @exception BadStatus (BadNodeClassInvalid) If the node is not a variable node
+     * @exception BadStatus (BadTypeMismatch) If the DataType or ValueRank of the node is not
+     *                      compatible with scalars of type `T`
+     */
+    VariableHandle(Server& server, NodeId id)
+        : server_(&server),
+          id_(std::move(id)) {
+        detail::validateVariableHandle(*server_, id_, detail::guessDataType<T>());
+    }
+
+    Server& getConnection() noexcept {
+        return *server_;
+    }
+
+    const NodeId& getNodeId() const noexcept {
+        return id_;
+    }
+
+    /// Write the value with the given source timestamp.
+    void write(const T& value, DateTime sourceTimestamp) {
+        // NOLINTNEXTLINE, variant isn't modified, try to avoid copy
+        const auto variant = Variant::fromScalar<T>(const_cast<T&>(value));
+        detail::writeVariableHandle(*server_, id_, variant, sourceTimestamp);
+    }
+
+    /// Write the value with the current time as source timestamp.
+    void write(const T& value) {
+        write(value, DateTime::now());
+    }
+
+    /// Read the value.
+    T read() {
+        return detail::readVariableHandle(*server_, id_).template takeScalar<T>();
+    }
+
+private:
+    Server* server_;
+    NodeId id_;
+};
+
+}  // namespace opcua
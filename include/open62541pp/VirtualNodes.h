@@ -0,0 +1,68 @@
+#pragma once
+
+#include <optional>
+#include <vector>
+
+#include "open62541pp/Common.h"  // NodeClass
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/// Reference of a virtual node.
+struct VirtualReference {
+    NodeId referenceType;
+    NodeId target;
+    /// Browse name of the target node, required to resolve browse paths.
+    QualifiedName targetBrowseName;
+};
+
+/// Definition of a virtual node, materialized on demand.
+struct VirtualNode {
+    /// Node class, only objects and variables are supported.
+    NodeClass nodeClass{NodeClass::Object};
+    QualifiedName browseName;
+    /// Attributes of object nodes.
+    ObjectAttributes objectAttributes;
+    /// Attributes of variable nodes, including the value.
+    VariableAttributes variableAttributes;
+    NodeId typeDefinition{ObjectTypeId::BaseObjectType};
+    /// Parent node (inverse hierarchical reference).
+    VirtualReference parent;
+    /// Child nodes (forward hierarchical references).
+    std::vector<VirtualReference> children;
+};
+
+/**
+ * Provider of virtual nodes, that are materialized on demand.
+ *
+ * Large address spaces (e.g. millions of tags of a historian) can be exposed without adding every
+ * node. The provider owns a namespace and is mounted at a folder with Server::addVirtualNodes.
+ * Nodes of the namespace are requested from the provider when they are accessed by any service
+ * (browse, read, translateBrowsePathsToNodeIds, ...) and cached in a least recently used cache, so
+ * memory stays proportional to the working set.
+ *
+ * Materialized nodes are snapshots: evicted nodes are requested again on the next access, writes to
+ * virtual nodes don't survive eviction.
+ */
+class VirtualNodeProvider {
+public:
+    VirtualNodeProvider() = default;
+    virtual ~VirtualNodeProvider() = default;
+
+    VirtualNodeProvider(const VirtualNodeProvider&) = delete;
+    VirtualNodeProvider(VirtualNodeProvider&&) noexcept = delete;
+    VirtualNodeProvider& operator=(const VirtualNodeProvider&) = delete;
+    VirtualNodeProvider& operator=(VirtualNodeProvider&&) noexcept = delete;
+
+    /// Get the top level nodes, referenced by the folder the provider is mounted at.
+    virtual std::vector<VirtualReference> getRootNodes() = 0;
+
+    /// Get the definition of a node, `std::nullopt` if the node doesn't exist.
+    /// Exceptions are caught and handled like unknown nodes.
+    virtual std::optional<VirtualNode> getNode(const NodeId& id) = 0;
+};
+
+}  // namespace opcua
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+
+#include "open62541pp/Statistics.h"  // StatisticsCallback
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+/// Types of watchdog violations.
+enum class WatchdogViolationType : uint8_t {
+    Stall,  ///< The event loop of the server was blocked longer than the stall budget
+    Callback,  ///< A node callback exceeded the callback budget
+};
+
+/**
+ * Budget violation reported by the watchdog.
+ * @see WatchdogOptions::onViolation
+ */
+struct WatchdogViolation {
+    WatchdogViolationType type{WatchdogViolationType::Callback};
+    /// Type of the offending callback.
+    StatisticsCallback callback{StatisticsCallback::ValueCallback};
+    /// Offending node, for stalls the node of the slowest callback since the last check (might be
+    /// null if the stall wasn't caused by a node callback).
+    NodeId nodeId;
+    /// Duration of the callback or the stall.
+    std::chrono::nanoseconds duration{0};
+    /// Number of callback violations of the node so far.
+    uint64_t count{0};
+};
+
+/**
+ * Options of the server watchdog.
+ *
+ * The event loop is checked by a repeated callback of the server: if it fires later than the
+ * stall budget, the loop was blocked (e.g. by a slow callback or a large request). Node callbacks
+ * (value callbacks, data sources and method callbacks) are measured individually.
+ *
+ * @see Server::enableWatchdog
+ */
+struct WatchdogOptions {
+    /// Maximum delay of the event loop.
+    std::chrono::nanoseconds stallBudget = std::chrono::milliseconds(100);
+    /// Interval of the event loop checks.
+    std::chrono::milliseconds checkInterval = std::chrono::milliseconds(50);
+    /// Maximum duration of a node callback.
+    std::chrono::nanoseconds callbackBudget = std::chrono::milliseconds(10);
+    /// Log violations as warnings with the server logger.
+    bool log = true;
+    /// Callback invoked for each violation, from the thread of the offending callback.
+    std::function<void(const WatchdogViolation&)> onViolation;
+    /// Execute the callbacks of methods that exceeded the callback budget this many times in the
+    /// async method worker pool (0 = never). The method callbacks must be thread-safe.
+    /// @note Requires open62541 compiled with `UA_MULTITHREADING >= 100`, ignored otherwise.
+    size_t migrateMethodsAfter = 0;
+};
+
+}  // namespace opcua
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "open62541pp/services/Async.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua {
+
+// forward declaration
+class Client;
+
+/**
+ * Client-side coalescing and rate limiting of value writes.
+ *
+ * Only the latest pending value of a node is kept, a new write of the same node replaces the
+ * pending value. The pending values of all nodes are flushed at most once per flush interval with
+ * a single batched Write request (split by the `MaxNodesPerWrite` operation limit of the server).
+ * The next flush waits until the responses of the previous one are received, so fast producers
+ * (e.g. UI sliders) can't flood the server or the network.
+ *
+ * Writes that are superseded by a newer value complete with the result of the write that sent the
+ * newer value. Completion callbacks and futures are fulfilled within Client::runIterate.
+ *
+ * Attach the coalescer to a client with Client::setWriteCoalescer; writes of the `Value`
+ * attribute with services::writeAttribute, services::writeValue and the `Node::writeValue*`
+ * functions of the client are then enqueued and return immediately. Their failures are reported
+ * to the error callback (@ref setErrorCallback) only. Pending values are flushed by
+ * Client::runIterate (or the background event loop), use a runIterate timeout below the flush
+ * interval to keep the rate. A coalescer must not be attached to multiple clients.
+ *
+ * @code
+ * auto coalescer = std::make_shared<opcua::WriteCoalescer>(std::chrono::milliseconds(50));
+ * client.setWriteCoalescer(coalescer);
+ * node.writeValueScalar(sliderPosition);  // enqueued, sent with the next flush
+ * @endcode
+ */
+class WriteCoalescer {
+public:
+    using Clock = std::chrono::steady_clock;
+    using ErrorCallback = std::function<void(const NodeId& id, StatusCode status)>;
+
+    /// Create a write coalescer.
+    /// @param flushInterval Minimum interval between two flushes, every write is flushed with the
+    ///                      next runIterate of the client if zero
+    explicit WriteCoalescer(Clock::duration flushInterval);
+
+    /// Enqueue a write of the `Value` attribute, replacing the pending value of the node.
+    /// @param id Node to write
+    /// @param value Value to write
+    /// @param callback Completion callback with the status code of the write that sent the value
+    void write(const NodeId& id, const DataValue& value, services::AsyncCallback<> callback);
+
+    /// @overload
+    /// Enqueue a write of the `Value` attribute and return a future.
+    /// @note The future is only fulfilled within Client::runIterate, don't wait for the future in
+    ///       the same thread that drives the client.
+    std::future<void> write(const NodeId& id, const DataValue& value);
+
+    /// Set a callback for failed writes, invoked within Client::runIterate.
+    void setErrorCallback(ErrorCallback callback);
+
+    /**
+     * Send all pending values immediately, regardless of the flush interval.
+     * Must be called by the thread that drives the client (or with the event loop stopped).
+     * @return Number of sent values
+     */
+    size_t flush(Client& client);
+
+    /**
+     * Send the pending values if the flush interval elapsed and no request is outstanding.
+     * Called by Client::runIterate of the attached client.
+     * @return Number of sent values
+     */
+    size_t flushIfDue(Client& client);
+
+    /// Remaining time until the next flush.
+    /// `Clock::duration::max()` if nothing is pending or a request is outstanding.
+    Clock::duration getNextFlush() const;
+
+    /// Number of nodes with pending values.
+    size_t getPendingCount() const;
+
+    /// Number of enqueued writes since creation.
+    uint64_t getWriteCount() const;
+
+    /// Number of writes superseded by a newer value of the same node since creation.
+    uint64_t getCoalescedCount() const;
+
+    /// Number of sent Write requests since creation.
+    uint64_t getRequestCount() const;
+
+private:
+    struct State;
+
+    // shared with the callbacks of outstanding requests
+    std::shared_ptr<State> state_;
+};
+
+}  // namespace opcua
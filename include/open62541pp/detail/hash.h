@@ -0,0 +1,187 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // hash
+#include <numeric>  // iota
+#include <utility>  // pair
+#include <vector>
+
+namespace opcua::detail {
+
+/**
+ * Immutable hash map with a perfect (collision-free) hash function, built once from its entries.
+ *
+ * The table is built with the "hash and displace" scheme: the keys are grouped into buckets and
+ * each bucket gets a seed, that maps all keys of the bucket to distinct slots. A lookup computes
+ * the key hash once and compares a single entry, independent of the number of entries.
+ * Keys with colliding hashes can't be separated by any seed and are stored in a (usually empty)
+ * overflow list, which is searched linearly.
+ * Duplicate keys are ignored, the first occurrence wins.
+ */
+template <typename Key, typename Value, typename Hash = std::hash<Key>>
+class PerfectHashMap {
+public:
+    PerfectHashMap() = default;
+
+    explicit PerfectHashMap(const std::vector<std::pair<Key, Value>>& entries) {
+        build(entries);
+    }
+
+    size_t size() const noexcept {
+        return entries_.size();
+    }
+
+    bool empty() const noexcept {
+        return entries_.empty();
+    }
+
+    /// Find the value of the given key.
+    /// @return Pointer to the value or `nullptr` if not found
+    const Value* find(const Key& key) const noexcept {
+        if (entries_.empty()) {
+            return nullptr;
+        }
+        const uint64_t hash = Hash{}(key);
+        if (!slots_.empty()) {
+            const uint32_t seed = seeds_[mix(hash, 0) % seeds_.size()];
+            const uint32_t index = slots_[mix(hash, seed) % slots_.size()];
+            if (index != emptySlot && isEntry(entries_[index], hash, key)) {
+                return &entries_[index].value;
+            }
+        }
+        for (const auto index : overflow_) {
+            if (isEntry(entries_[index], hash, key)) {
+                return &entries_[index].value;
+            }
+        }
+        return nullptr;
+    }
+
+private:
+    static constexpr uint32_t emptySlot = UINT32_MAX;
+    static constexpr uint32_t maxSeed = 1U << 16U;
+
+    struct Entry {
+        uint64_t hash;
+        Key key;
+        Value value;
+    };
+
+    static bool isEntry(const Entry& entry, uint64_t hash, const Key& key) noexcept {
+        return entry.hash == hash && entry.key == key;
+    }
+
+    /// Mix hash and seed (splitmix64 finalizer), seed 0 selects the bucket.
+    static constexpr uint64_t mix(uint64_t hash, uint32_t seed) noexcept {
+        uint64_t x = hash + (uint64_t{seed} + 1) * 0x9E3779B97F4A7C15ULL;
+        x = (x ^ (x >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+        x = (x ^ (x >> 27U)) * 0x94D049BB133111EBULL;
+        return x ^ (x >> 31U);
+    }
+
+    void build(const std::vector<std::pair<Key, Value>>& input) {
+        std::vector<uint64_t> hashes(input.size());
+        std::vector<size_t> order(input.size());
+        for (size_t i = 0; i < input.size(); ++i) {
+            hashes[i] = Hash{}(input[i].first);
+        }
+        std::iota(order.begin(), order.end(), size_t{0});
+        std::stable_sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) {
+            return hashes[lhs] < hashes[rhs];
+        });
+
+        // group equal hashes, skip duplicate keys and move colliding keys to the overflow list
+        std::vector<uint32_t> primary;
+        entries_.reserve(input.size());
+        for (size_t begin = 0; begin < order.size();) {
+            const uint64_t hash = hashes[order[begin]];
+            size_t end = begin + 1;
+            while (end < order.size() && hashes[order[end]] == hash) {
+                ++end;
+            }
+            for (size_t i = begin; i < end; ++i) {
+                const auto& [key, value] = input[order[i]];
+                const bool duplicate = std::any_of(
+                    order.begin() + begin, order.begin() + i, [&](size_t j) {
+                        return input[j].first == key;
+                    }
+                );
+                if (!duplicate) {
+                    const auto index = static_cast<uint32_t>(entries_.size());
+                    (i == begin ? primary : overflow_).push_back(index);
+                    entries_.push_back({hash, key, value});
+                }
+            }
+            begin = end;
+        }
+        if (primary.empty()) {
+            return;
+        }
+
+        // average bucket size of 2 with a load factor of 0.5 finds seeds within a few tries
+        std::vector<std::vector<uint32_t>> buckets(primary.size() / 2 + 1);
+        for (const auto index : primary) {
+            buckets[mix(entries_[index].hash, 0) % buckets.size()].push_back(index);
+        }
+        // place large buckets first, while most slots are free
+        std::vector<size_t> bucketOrder(buckets.size());
+        std::iota(bucketOrder.begin(), bucketOrder.end(), size_t{0});
+        std::stable_sort(bucketOrder.begin(), bucketOrder.end(), [&](size_t lhs, size_t rhs) {
+            return buckets[lhs].size() > buckets[rhs].size();
+        });
+        size_t slotCount = 2 * primary.size() + 1;
+        while (!place(buckets, bucketOrder, slotCount)) {
+            slotCount *= 2;
+        }
+    }
+
+    bool place(
+        const std::vector<std::vector<uint32_t>>& buckets,
+        const std::vector<size_t>& bucketOrder,
+        size_t slotCount
+    ) {
+        seeds_.assign(buckets.size(), 0);
+        slots_.assign(slotCount, emptySlot);
+        std::vector<size_t> candidates;
+        for (const auto bucketIndex : bucketOrder) {
+            const auto& bucket = buckets[bucketIndex];
+            if (bucket.empty()) {
+                break;  // sorted by size, remaining buckets are empty
+            }
+            uint32_t seed = 1;
+            while (!fits(bucket, seed, candidates)) {
+                if (++seed == maxSeed) {
+                    return false;
+                }
+            }
+            seeds_[bucketIndex] = seed;
+            for (size_t i = 0; i < bucket.size(); ++i) {
+                slots_[candidates[i]] = bucket[i];
+            }
+        }
+        return true;
+    }
+
+    bool fits(const std::vector<uint32_t>& bucket, uint32_t seed, std::vector<size_t>& candidates)
+        const {
+        candidates.clear();
+        for (const auto index : bucket) {
+            const size_t slot = mix(entries_[index].hash, seed) % slots_.size();
+            if (slots_[slot] != emptySlot ||
+                std::find(candidates.begin(), candidates.end(), slot) != candidates.end()) {
+                return false;
+            }
+            candidates.push_back(slot);
+        }
+        return true;
+    }
+
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> seeds_;
+    std::vector<uint32_t> slots_;
+    std::vector<uint32_t> overflow_;
+};
+
+}  // namespace opcua::detail
@@ -41,10 +41,18 @@ constexpr void clear(T& native, const UA_DataType& type) noexcept {
     }
 }
 
+#ifdef UAPP_ENABLE_ALLOC_STATS
+/// Count a deep copy of the current thread (see AllocStats).
+void recordDeepCopy() noexcept;
+#endif
+
 template <typename T>
 [[nodiscard]] constexpr T copy(const T& src, const UA_DataType& type) noexcept(isPointerFree<T>) {
     assert(sizeof(T) == type.memSize);
     if constexpr (!isPointerFree<T>) {
+#ifdef UAPP_ENABLE_ALLOC_STATS
+        recordDeepCopy();
+#endif
         T dst;  // NOLINT, initialized in UA_copy function
         detail::throwOnBadStatus(UA_copy(&src, &dst, &type));
         return dst;
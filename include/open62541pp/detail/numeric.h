@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/open62541.h"
+
+namespace opcua::detail {
+
+/// Numeric builtin types (Boolean excluded).
+template <typename T>
+inline constexpr bool isNumericType = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
+/// Convert numeric value and saturate to the range of the target type.
+/// Floating point values are truncated towards zero if converted to integers, NaN results in 0.
+template <typename To, typename From>
+constexpr To saturateCast(From value) noexcept {
+    static_assert(isNumericType<To> && isNumericType<From>);
+    using Limits = std::numeric_limits<To>;
+    if constexpr (std::is_floating_point_v<To>) {
+        return static_cast<To>(value);
+    } else if constexpr (std::is_floating_point_v<From>) {
+        // lowest is exact (0 or power of two), max might be rounded up to the next power of two
+        constexpr auto lowest = static_cast<From>(Limits::lowest());
+        constexpr auto max = static_cast<From>(Limits::max());
+        if (value != value) {  // NOLINT, NaN
+            return To{};
+        }
+        if (value >= max) {
+            return Limits::max();
+        }
+        if (value <= lowest) {
+            return Limits::lowest();
+        }
+        return static_cast<To>(value);
+    } else if constexpr (std::is_signed_v<From> && !std::is_signed_v<To>) {
+        if (value < 0) {
+            return To{};
+        }
+        const auto unsignedValue = static_cast<std::make_unsigned_t<From>>(value);
+        return unsignedValue > Limits::max() ? Limits::max() : static_cast<To>(value);
+    } else if constexpr (!std::is_signed_v<From> && std::is_signed_v<To>) {
+        constexpr auto max = static_cast<std::make_unsigned_t<To>>(Limits::max());
+        return value > max ? Limits::max() : static_cast<To>(value);
+    } else {
+        // same signedness
+        if (value > Limits::max()) {
+            return Limits::max();
+        }
+        if (value < Limits::lowest()) {
+            return Limits::lowest();
+        }
+        return static_cast<To>(value);
+    }
+}
+
+/**
+ * Convert numeric array element-wise (same size).
+ * The loop is branch-free for widening conversions and written to be auto-vectorized.
+ */
+template <typename To, typename From>
+void convertNumericArray(const From* input, To* output, size_t size) noexcept {
+    for (size_t i = 0; i < size; ++i) {
+        output[i] = saturateCast<To>(input[i]);  // NOLINT
+    }
+}
+
+/// Convert numeric array element-wise with linear scaling: `output = input * scale + offset`.
+template <typename To, typename From>
+void convertNumericArray(
+    const From* input, To* output, size_t size, double scale, double offset
+) noexcept {
+    // single precision is sufficient for small integers and floats -> allows wider SIMD lanes
+    using Compute = std::conditional_t<
+        std::is_same_v<To, float> && (std::is_same_v<From, float> || sizeof(From) <= 2),
+        float,
+        double>;
+    const auto scaleCompute = static_cast<Compute>(scale);
+    const auto offsetCompute = static_cast<Compute>(offset);
+    for (size_t i = 0; i < size; ++i) {
+        const auto value = static_cast<Compute>(input[i]) * scaleCompute + offsetCompute;  // NOLINT
+        output[i] = saturateCast<To>(value);  // NOLINT
+    }
+}
+
+/**
+ * Invoke the function with a typed pointer to the numeric array.
+ * @returns `false` if the data type is not a numeric builtin type
+ */
+template <typename F>
+bool visitNumericArray(const void* array, const UA_DataType* dataType, F&& func) {
+    if (dataType == nullptr) {
+        return false;
+    }
+    switch (dataType->typeKind) {
+    case UA_DATATYPEKIND_SBYTE:
+        func(static_cast<const UA_SByte*>(array));
+        return true;
+    case UA_DATATYPEKIND_BYTE:
+        func(static_cast<const UA_Byte*>(array));
+        return true;
+    case UA_DATATYPEKIND_INT16:
+        func(static_cast<const UA_Int16*>(array));
+        return true;
+    case UA_DATATYPEKIND_UINT16:
+        func(static_cast<const UA_UInt16*>(array));
+        return true;
+    case UA_DATATYPEKIND_INT32:
+        func(static_cast<const UA_Int32*>(array));
+        return true;
+    case UA_DATATYPEKIND_UINT32:
+        func(static_cast<const UA_UInt32*>(array));
+        return true;
+    case UA_DATATYPEKIND_INT64:
+        func(static_cast<const UA_Int64*>(array));
+        return true;
+    case UA_DATATYPEKIND_UINT64:
+        func(static_cast<const UA_UInt64*>(array));
+        return true;
+    case UA_DATATYPEKIND_FLOAT:
+        func(static_cast<const UA_Float*>(array));
+        return true;
+    case UA_DATATYPEKIND_DOUBLE:
+        func(static_cast<const UA_Double*>(array));
+        return true;
+    default:
+        return false;
+    }
+}
+
+}  // namespace opcua::detail
@@ -38,4 +38,25 @@ struct MemberType<T C::*> {
 template <typename T>
 using MemberTypeT = typename MemberType<T>::type;
 
+/// Derive class type from member pointer
+template <typename T>
+struct MemberClass;
+
+template <typename C, typename T>
+struct MemberClass<T C::*> {
+    using type = C;
+};
+
+template <typename T>
+using MemberClassT = typename MemberClass<T>::type;
+
+/// Establish a non-deduced context (std::type_identity of C++20).
+template <typename T>
+struct TypeIdentity {
+    using type = T;
+};
+
+template <typename T>
+using TypeIdentityT = typename TypeIdentity<T>::type;
+
 }  // namespace opcua::detail
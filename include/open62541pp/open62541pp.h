@@ -1,26 +1,67 @@
 #pragma once
 
 #include "open62541pp/AccessControl.h"
+#include "open62541pp/AllocStats.h"
+#include "open62541pp/ArrayView.h"
+#include "open62541pp/BinaryEncoding.h"
+#include "open62541pp/BinaryLogSink.h"
+#include "open62541pp/BrowseCache.h"
+#include "open62541pp/BrowsePathCache.h"
+#include "open62541pp/CachedClock.h"
 #include "open62541pp/Client.h"
+#include "open62541pp/ClientFarm.h"
+#include "open62541pp/ClientPool.h"
 #include "open62541pp/Common.h"
+#include "open62541pp/Compression.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Crypto.h"
 #include "open62541pp/DataType.h"
 #include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/Discovery.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/EventFields.h"
+#include "open62541pp/EventFilterBuilder.h"
+#include "open62541pp/EventStream.h"
+#include "open62541pp/Historizing.h"
 #include "open62541pp/Logger.h"
 #include "open62541pp/MonitoredItem.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
+#include "open62541pp/NodeAttributeCache.h"
+#include "open62541pp/NodeIdNames.h"
+#include "open62541pp/NodeIdPool.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/NodeProfiler.h"
+#include "open62541pp/Nodeset.h"
+#include "open62541pp/NotificationBatch.h"
+#include "open62541pp/ObjectTemplate.h"
+#include "open62541pp/PollGroup.h"
+#include "open62541pp/PubSub.h"
+#include "open62541pp/Realtime.h"
+#include "open62541pp/RequestBuilder.h"
+#include "open62541pp/Result.h"
+#include "open62541pp/ReverseConnect.h"
+#include "open62541pp/ScopedArena.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/ServerGroup.h"
 #include "open62541pp/Session.h"
+#include "open62541pp/SharedVariant.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/StringArrayView.h"
+#include "open62541pp/Statistics.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/Tracer.h"
 #include "open62541pp/TypeConverter.h"
 #include "open62541pp/TypeConverterNative.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/ValueBackend.h"
+#include "open62541pp/VariableHandle.h"
+#include "open62541pp/VirtualNodes.h"
+#include "open62541pp/Watchdog.h"
+#include "open62541pp/WriteCoalescer.h"
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/detail/traits.h"
 #include "open62541pp/overloads/comparison.h"
@@ -32,3 +73,4 @@
 #include "open62541pp/types/ExtensionObject.h"
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
+#include "open62541pp/types/VariantView.h"
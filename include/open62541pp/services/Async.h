@@ -0,0 +1,39 @@
+#pragma once
+
+#include <functional>
+
+#include "open62541pp/types/Builtin.h"  // StatusCode
+
+namespace opcua {
+
+namespace detail {
+
+template <typename T>
+struct AsyncCallbackImpl {
+    using type = std::function<void(StatusCode status, T& result)>;
+};
+
+template <>
+struct AsyncCallbackImpl<void> {
+    using type = std::function<void(StatusCode status)>;
+};
+
+}  // namespace detail
+
+namespace services {
+
+/**
+ * Completion callback of asynchronous client services.
+ *
+ * The callback is invoked within Client::runIterate (or any other blocking client call) once the
+ * response is received. If the status code is bad, the result is default-constructed.
+ * Exceptions thrown by the callback are ignored.
+ *
+ * @tparam T Result type, `void` for services without result
+ */
+template <typename T = void>
+using AsyncCallback = typename detail::AsyncCallbackImpl<T>::type;
+
+}  // namespace services
+
+}  // namespace opcua
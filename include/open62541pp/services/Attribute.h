@@ -1,15 +1,25 @@
 #pragma once
 
+#include <algorithm>  // move
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
 #include <vector>
 
 #include "open62541pp/Common.h"
+#include "open62541pp/ErrorHandling.h"  // isBadStatus
+#include "open62541pp/Result.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/numeric.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/services/Async.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
 
@@ -69,11 +79,190 @@ DataValue readAttribute(
     TimestampsToReturn timestamps = TimestampsToReturn::Neither
 );
 
+/**
+ * Read node attributes without exceptions.
+ *
+ * Bad status codes of the operation or the service are returned as empty result instead of
+ * throwing BadStatus, e.g. for polling loops with routinely failing reads of offline devices.
+ * A result with an uncertain status code contains the value.
+ *
+ * @see readAttribute
+ */
+template <typename T>
+Result<DataValue> tryReadAttribute(
+    T& serverOrClient,
+    const NodeId& id,
+    AttributeId attributeId,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+) noexcept;
+
+/**
+ * Read one or more attributes of one or more nodes with a single call (batched).
+ *
+ * In contrast to @ref readAttribute, no exception is thrown for failed operations. The resulting
+ * DataValues have the same order as `nodesToRead` and contain the status code of each operation.
+ * Client requests are split into multiple requests to respect the `MaxNodesPerRead` operation
+ * limit of the server.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param nodesToRead Attributes to read
+ * @param timestamps Timestamps to return
+ */
+template <typename T>
+std::vector<DataValue> readAttributes(
+    T& serverOrClient,
+    Span<const ReadValueId> nodesToRead,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
+/**
+ * @overload
+ * Read attributes into an existing vector, e.g. for cyclic polling.
+ * The vector is resized to the number of `nodesToRead`, its capacity is retained. The decoded
+ * values of the response are swapped into the elements without copy.
+ */
+template <typename T>
+void readAttributes(
+    T& serverOrClient,
+    Span<const ReadValueId> nodesToRead,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
+/**
+ * Read attributes with a single call (batched) without exceptions.
+ * Failed operations are reported per DataValue like @ref readAttributes, the result is empty for
+ * unexpected errors only (e.g. out of memory).
+ */
+template <typename T>
+Result<std::vector<DataValue>> tryReadAttributes(
+    T& serverOrClient,
+    Span<const ReadValueId> nodesToRead,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+) noexcept;
+
+/**
+ * @overload
+ * Read attributes into an existing vector without exceptions, e.g. for cyclic polling.
+ */
+template <typename T>
+Result<void> tryReadAttributes(
+    T& serverOrClient,
+    Span<const ReadValueId> nodesToRead,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+) noexcept;
+
+/**
+ * Read the `Value` attribute of multiple nodes with a single call (batched).
+ * @see readAttributes
+ */
+template <typename T>
+std::vector<DataValue> readValues(
+    T& serverOrClient,
+    Span<const NodeId> ids,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
+/**
+ * @overload
+ * Read the values into an existing vector, the capacity of the vector is retained.
+ */
+template <typename T>
+void readValues(
+    T& serverOrClient,
+    Span<const NodeId> ids,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
+/**
+ * Result of @ref readValuesColumnar (structure of arrays).
+ * All columns have the same length and order as the read nodes.
+ */
+template <typename V>
+struct ColumnarReadResult {
+    std::vector<V> values;
+    std::vector<StatusCode> statusCodes;
+    /// Source timestamps, 0 if not returned.
+    std::vector<DateTime> sourceTimestamps;
+    /// Server timestamps, 0 if not returned.
+    std::vector<DateTime> serverTimestamps;
+
+    size_t size() const noexcept {
+        return values.size();
+    }
+};
+
+/**
+ * Read the `Value` attribute of multiple nodes into contiguous columns (batched).
+ *
+ * The scalar values are decoded into a `std::vector<V>`, e.g. to compute statistics or to export
+ * columnar formats without handling DataValues. If `V` is a numeric type, values of any numeric
+ * type are converted (and saturated). Values that are not scalars or not convertible to `V` are
+ * default-initialized and get the status code `BadTypeMismatch`, unless the read already failed.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param ids Nodes to read
+ * @param result Columns to write, the capacity of the vectors is retained
+ * @param timestamps Timestamps to return
+ * @see readValues
+ */
+template <typename V, typename T>
+void readValuesColumnar(
+    T& serverOrClient,
+    Span<const NodeId> ids,
+    ColumnarReadResult<V>& result,
+    TimestampsToReturn timestamps = TimestampsToReturn::Both
+) {
+    std::vector<DataValue> values;
+    readValues(serverOrClient, ids, values, timestamps);
+    result.values.assign(values.size(), V{});
+    result.statusCodes.resize(values.size());
+    result.sourceTimestamps.resize(values.size());
+    result.serverTimestamps.resize(values.size());
+    for (size_t i = 0; i < values.size(); ++i) {
+        auto& dv = *values[i].handle();
+        UA_StatusCode status = dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD;
+        const bool scalar = dv.hasValue && UA_Variant_isScalar(&dv.value);
+        bool converted = false;
+        if constexpr (detail::isNumericType<V>) {
+            const auto convert = [&](const auto* input) {
+                detail::convertNumericArray(input, &result.values[i], 1);
+            };
+            converted = scalar && detail::visitNumericArray(dv.value.data, dv.value.type, convert);
+        } else {
+            if (scalar && detail::isValidTypeCombination<V>(dv.value.type)) {
+                result.values[i] = asWrapper<Variant>(dv.value).template takeScalar<V>();
+                converted = true;
+            }
+        }
+        if (!converted && !detail::isBadStatus(status)) {
+            status = UA_STATUSCODE_BADTYPEMISMATCH;
+        }
+        result.statusCodes[i] = status;
+        result.sourceTimestamps[i] = DateTime(dv.hasSourceTimestamp ? dv.sourceTimestamp : 0);
+        result.serverTimestamps[i] = DateTime(dv.hasServerTimestamp ? dv.serverTimestamp : 0);
+    }
+}
+
+/// @overload
+template <typename V, typename T>
+ColumnarReadResult<V> readValuesColumnar(
+    T& serverOrClient,
+    Span<const NodeId> ids,
+    TimestampsToReturn timestamps = TimestampsToReturn::Both
+) {
+    ColumnarReadResult<V> result;
+    readValuesColumnar(serverOrClient, ids, result, timestamps);
+    return result;
+}
+
 /// Helper function to read scalar node attributes.
 template <typename AttributeType, typename T>
 inline auto readAttributeScalar(T& serverOrClient, const NodeId& id, AttributeId attributeId) {
-    const auto dv = readAttribute(serverOrClient, id, attributeId);
-    return dv.getValue().template getScalarCopy<AttributeType>();
+    auto dv = readAttribute(serverOrClient, id, attributeId);
+    return dv.getValue().template takeScalar<AttributeType>();
 }
 
 /**
@@ -94,6 +283,204 @@ void writeAttribute(
     T& serverOrClient, const NodeId& id, AttributeId attributeId, const DataValue& value
 );
 
+/**
+ * Write node attributes without exceptions.
+ * Bad status codes of the operation or the service are returned instead of throwing BadStatus.
+ * @see writeAttribute
+ */
+template <typename T>
+Result<void> tryWriteAttribute(
+    T& serverOrClient, const NodeId& id, AttributeId attributeId, const DataValue& value
+) noexcept;
+
+/**
+ * Write one or more attributes of one or more nodes with a single call (batched).
+ *
+ * In contrast to @ref writeAttribute, no exception is thrown for failed operations. The resulting
+ * status codes have the same order as `nodesToWrite`.
+ * Client requests are split into multiple requests to respect the `MaxNodesPerWrite` operation
+ * limit of the server.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param nodesToWrite Attributes to write
+ */
+template <typename T>
+std::vector<StatusCode> writeAttributes(T& serverOrClient, Span<const WriteValue> nodesToWrite);
+
+/**
+ * Write attributes with a single call (batched) without exceptions.
+ * Failed operations are reported per status code like @ref writeAttributes, the result is empty
+ * for unexpected errors only (e.g. out of memory).
+ */
+template <typename T>
+Result<std::vector<StatusCode>> tryWriteAttributes(
+    T& serverOrClient, Span<const WriteValue> nodesToWrite
+) noexcept;
+
+/**
+ * Write the `Value` attribute of multiple nodes with a single call (batched).
+ * The values are not copied into the request.
+ * @exception BadStatus (BadInvalidArgument) If `ids` and `values` differ in size
+ * @see writeAttributes
+ */
+template <typename T>
+std::vector<StatusCode> writeValues(
+    T& serverOrClient, Span<const NodeId> ids, Span<const Variant> values
+);
+
+/**
+ * Asynchronously read node attribute (client only).
+ *
+ * The request is sent immediately, the callback is invoked within Client::runIterate once the
+ * response is received.
+ *
+ * @param client Instance of type Client
+ * @param id Node to read
+ * @param attributeId Attribute to read
+ * @param timestamps Timestamps to return
+ * @param callback Completion callback with the status code and the read DataValue
+ * @exception BadStatus If the request could not be sent
+ */
+void readAttributeAsync(
+    Client& client,
+    const NodeId& id,
+    AttributeId attributeId,
+    TimestampsToReturn timestamps,
+    AsyncCallback<DataValue> callback
+);
+
+/**
+ * @overload
+ * Asynchronously read node attribute and return a future.
+ * @note The future is only fulfilled within Client::runIterate, don't wait for the future in the
+ *       same thread that drives the client.
+ */
+std::future<DataValue> readAttributeAsync(
+    Client& client,
+    const NodeId& id,
+    AttributeId attributeId,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
+/**
+ * Asynchronously write node attribute (client only).
+ *
+ * The request is sent immediately, the callback is invoked within Client::runIterate once the
+ * response is received.
+ *
+ * @param client Instance of type Client
+ * @param id Node to write
+ * @param attributeId Attribute to write
+ * @param value Value to write
+ * @param callback Completion callback with the status code
+ * @exception BadStatus If the request could not be sent
+ */
+void writeAttributeAsync(
+    Client& client,
+    const NodeId& id,
+    AttributeId attributeId,
+    const DataValue& value,
+    AsyncCallback<> callback
+);
+
+/**
+ * @overload
+ * Asynchronously write node attribute and return a future.
+ * @note The future is only fulfilled within Client::runIterate, don't wait for the future in the
+ *       same thread that drives the client.
+ */
+std::future<void> writeAttributeAsync(
+    Client& client, const NodeId& id, AttributeId attributeId, const DataValue& value
+);
+
+/**
+ * Callback of a chunk delivered by readArrayChunked.
+ * @param offset Index of the first element of the chunk within the array
+ * @param chunk Array of the chunk elements, can be moved by the callback
+ */
+using ArrayChunkCallback = std::function<void(size_t offset, Variant& chunk)>;
+
+/**
+ * Read a large array in chunks with index range reads (client only).
+ *
+ * Up to `maxInFlight` chunk reads are pipelined over the connection, so the transfer overlaps with
+ * the processing of received chunks. The chunks are delivered in order to the callback within the
+ * calling thread, only the chunks in flight are held in memory. This avoids a single response
+ * exceeding the maximum message size and the allocation of the whole array.
+ * The function returns after the last chunk (fewer elements than requested) was delivered.
+ *
+ * If the event loop runs in a background thread (Client::runInBackground), the function waits
+ * for the responses received by the event loop, otherwise it drives the client with
+ * Client::runIterate.
+ *
+ * @param client Instance of type Client
+ * @param id Variable node with a one-dimensional array value
+ * @param chunkElements Number of elements per chunk
+ * @param callback Callback invoked for every chunk
+ * @param maxInFlight Maximum number of pending chunk reads
+ * @exception BadStatus If a chunk read fails
+ */
+void readArrayChunked(
+    Client& client,
+    const NodeId& id,
+    size_t chunkElements,
+    const ArrayChunkCallback& callback,
+    size_t maxInFlight = 4
+);
+
+/**
+ * @overload
+ * Read a large array in chunks into an existing buffer (only native or wrapper types).
+ * @return Number of read elements
+ * @exception BadStatus (BadOutOfRange) If the array exceeds the output span
+ * @exception BadVariantAccess If the array is not of type `T`
+ */
+template <typename T>
+size_t readArrayChunked(
+    Client& client,
+    const NodeId& id,
+    Span<T> output,
+    size_t chunkElements,
+    size_t maxInFlight = 4
+) {
+    size_t length = 0;
+    const auto moveChunk = [&](size_t offset, Variant& chunk) {
+        auto values = chunk.getArray<T>();
+        if (offset + values.size() > output.size()) {
+            throw BadStatus(UA_STATUSCODE_BADOUTOFRANGE);
+        }
+        std::move(values.begin(), values.end(), output.begin() + offset);
+        length = offset + values.size();
+    };
+    readArrayChunked(client, id, chunkElements, moveChunk, maxInFlight);
+    return length;
+}
+
+/**
+ * Write a large array in chunks with index range writes (client only).
+ *
+ * The chunks reference the elements of `array` without copy and up to `maxInFlight` chunk writes
+ * are pipelined. Index ranges can't change the array length, the array of the variable must have
+ * the full length already (e.g. written once with writeValue). Empty arrays are written with a
+ * single write.
+ * The function drives or waits for the client like readArrayChunked.
+ *
+ * @param client Instance of type Client
+ * @param id Variable node with a one-dimensional array value
+ * @param array Array to write
+ * @param chunkElements Number of elements per chunk
+ * @param maxInFlight Maximum number of pending chunk writes
+ * @exception BadStatus If a chunk write fails
+ * @exception BadVariantAccess If the value is not an array
+ */
+void writeArrayChunked(
+    Client& client,
+    const NodeId& id,
+    const Variant& array,
+    size_t chunkElements,
+    size_t maxInFlight = 4
+);
+
 /* -------------------------------- Specialized inline functions -------------------------------- */
 
 /**
@@ -221,7 +608,20 @@ readDataValue(T& serverOrClient, const NodeId& id, DataValue& value) {
 template <typename T>
 inline Variant readValue(T& serverOrClient, const NodeId& id) {
     DataValue dv = readAttribute(serverOrClient, id, AttributeId::Value);
-    return std::move(dv.getValue());
+    return dv.takeValue();
+}
+
+/**
+ * Read the `Value` attribute of a variable node without exceptions.
+ * @see tryReadAttribute
+ */
+template <typename T>
+inline Result<Variant> tryReadValue(T& serverOrClient, const NodeId& id) noexcept {
+    auto result = tryReadAttribute(serverOrClient, id, AttributeId::Value);
+    if (!result) {
+        return BadResult(result.code());
+    }
+    return {result->takeValue(), result.code()};
 }
 
 /// @copydoc readValue
@@ -259,9 +659,9 @@ inline ValueRank readValueRank(T& serverOrClient, const NodeId& id) {
  */
 template <typename T>
 inline std::vector<uint32_t> readArrayDimensions(T& serverOrClient, const NodeId& id) {
-    const auto dv = readAttribute(serverOrClient, id, AttributeId::ArrayDimensions);
+    auto dv = readAttribute(serverOrClient, id, AttributeId::ArrayDimensions);
     if (dv.getValue().isArray()) {
-        return dv.getValue().template getArrayCopy<uint32_t>();
+        return dv.getValue().template takeArray<uint32_t>();
     }
     return {};
 }
@@ -388,6 +788,20 @@ inline void writeValue(T& serverOrClient, const NodeId& id, const Variant& value
     writeAttribute(serverOrClient, id, AttributeId::Value, asWrapper<DataValue>(dv));
 }
 
+/**
+ * Write the `Value` attribute of a variable node without exceptions.
+ * @see tryWriteAttribute
+ */
+template <typename T>
+inline Result<void> tryWriteValue(
+    T& serverOrClient, const NodeId& id, const Variant& value
+) noexcept {
+    UA_DataValue dv{};
+    dv.value = *value.handle();  // shallow copy
+    dv.hasValue = true;
+    return tryWriteAttribute(serverOrClient, id, AttributeId::Value, asWrapper<DataValue>(dv));
+}
+
 /**
  * Write the `DataType` attribute of a variable (type) node.
  * @copydetails readDataType
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "open62541pp/Config.h"
+
+#ifdef UAPP_HAS_COROUTINES
+
+#include <coroutine>
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Common.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/services/Async.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/Method.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua::services {
+
+/**
+ * @defgroup Awaitable Awaitable services
+ * C++20 coroutine wrappers of the asynchronous client services.
+ *
+ * The request is sent when the awaitable is awaited. The coroutine is resumed within
+ * Client::runIterate once the response is received. Bad status codes are thrown as BadStatus at
+ * the `co_await` expression.
+ *
+ * Only available if the compiler supports C++20 coroutines (`UAPP_HAS_COROUTINES`).
+ * @ingroup Services
+ * @{
+ */
+
+/**
+ * Awaitable of an asynchronous client service.
+ * @tparam T Result type, `void` for services without result
+ */
+template <typename T>
+class Awaitable {
+public:
+    /// Function to initiate the asynchronous operation with the given completion callback.
+    using Initiation = std::function<void(AsyncCallback<T>)>;
+
+    explicit Awaitable(Initiation initiation)
+        : initiation_(std::move(initiation)) {}
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        initiation_([this, handle](StatusCode status, T& result) {
+            status_ = status;
+            if (status.isGood()) {
+                result_ = std::move(result);
+            }
+            handle.resume();
+        });
+    }
+
+    T await_resume() {
+        detail::throwOnBadStatus(status_);
+        return std::move(*result_);
+    }
+
+private:
+    Initiation initiation_;
+    StatusCode status_;
+    std::optional<T> result_;
+};
+
+/// Awaitable of an asynchronous client service without result.
+template <>
+class Awaitable<void> {
+public:
+    /// Function to initiate the asynchronous operation with the given completion callback.
+    using Initiation = std::function<void(AsyncCallback<>)>;
+
+    explicit Awaitable(Initiation initiation)
+        : initiation_(std::move(initiation)) {}
+
+    bool await_ready() const noexcept {
+        return false;
+    }
+
+    void await_suspend(std::coroutine_handle<> handle) {
+        initiation_([this, handle](StatusCode status) {
+            status_ = status;
+            handle.resume();
+        });
+    }
+
+    void await_resume() {
+        detail::throwOnBadStatus(status_);
+    }
+
+private:
+    Initiation initiation_;
+    StatusCode status_;
+};
+
+/// Await @ref readAttributeAsync.
+inline Awaitable<DataValue> readAttributeAwait(
+    Client& client,
+    NodeId id,
+    AttributeId attributeId,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+) {
+    return Awaitable<DataValue>(
+        [&client, id = std::move(id), attributeId, timestamps](AsyncCallback<DataValue> cb) {
+            readAttributeAsync(client, id, attributeId, timestamps, std::move(cb));
+        }
+    );
+}
+
+/// Await @ref readAttributeAsync of the `Value` attribute.
+inline Awaitable<Variant> readValueAwait(Client& client, NodeId id) {
+    return Awaitable<Variant>([&client, id = std::move(id)](AsyncCallback<Variant> cb) {
+        readAttributeAsync(
+            client,
+            id,
+            AttributeId::Value,
+            TimestampsToReturn::Neither,
+            [cb = std::move(cb)](StatusCode status, DataValue& dv) { cb(status, dv.getValue()); }
+        );
+    });
+}
+
+/// Await @ref writeAttributeAsync.
+inline Awaitable<void> writeAttributeAwait(
+    Client& client, NodeId id, AttributeId attributeId, DataValue value
+) {
+    return Awaitable<void>(
+        [&client, id = std::move(id), attributeId, value = std::move(value)](AsyncCallback<> cb) {
+            writeAttributeAsync(client, id, attributeId, value, std::move(cb));
+        }
+    );
+}
+
+/// Await @ref writeAttributeAsync of the `Value` attribute.
+inline Awaitable<void> writeValueAwait(Client& client, NodeId id, Variant value) {
+    DataValue dv;
+    dv.setValue(std::move(value));
+    return writeAttributeAwait(client, std::move(id), AttributeId::Value, std::move(dv));
+}
+
+#ifdef UA_ENABLE_METHODCALLS
+/// Await @ref callAsync.
+inline Awaitable<std::vector<Variant>> callAwait(
+    Client& client, NodeId objectId, NodeId methodId, std::vector<Variant> inputArguments
+) {
+    return Awaitable<std::vector<Variant>>(
+        [&client,
+         objectId = std::move(objectId),
+         methodId = std::move(methodId),
+         inputArguments = std::move(inputArguments)](AsyncCallback<std::vector<Variant>> cb) {
+            callAsync(client, objectId, methodId, inputArguments, std::move(cb));
+        }
+    );
+}
+#endif
+
+/// Await @ref browseAsync.
+inline Awaitable<BrowseResult> browseAwait(
+    Client& client, BrowseDescription bd, uint32_t maxReferences = 0
+) {
+    return Awaitable<BrowseResult>(
+        [&client, bd = std::move(bd), maxReferences](AsyncCallback<BrowseResult> cb) {
+            browseAsync(client, bd, maxReferences, std::move(cb));
+        }
+    );
+}
+
+/**
+ * @}
+ */
+
+}  // namespace opcua::services
+
+#endif
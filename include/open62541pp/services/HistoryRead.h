@@ -0,0 +1,260 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
+#include "open62541pp/types/NodeId.h"
+
+#ifdef UA_ENABLE_HISTORIZING
+
+// forward declarations
+namespace opcua {
+class Client;
+}  // namespace opcua
+
+namespace opcua::services {
+
+/**
+ * @defgroup HistoryRead HistoryRead service
+ * Read the history of variables.
+ *
+ * The values are read in batches, continuation points are followed transparently. Only one batch
+ * per node is kept in memory, so large histories can be processed without materializing them.
+ *
+ * @see https://reference.opcfoundation.org/Core/Part11/v105/docs/6.4.3
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.10.3
+ * @ingroup Services
+ * @{
+ */
+
+/// Options of a raw history read.
+struct HistoryReadRawOptions {
+    /// Maximum number of values per node and batch (0 = limit of the server).
+    uint32_t numValuesPerNode{1000};
+    /// Timestamps to return with the values.
+    TimestampsToReturn timestamps{TimestampsToReturn::Both};
+    /// Return the bounding values of the time range.
+    bool returnBounds{false};
+};
+
+/**
+ * Batched raw history read of multiple nodes (client only).
+ *
+ * Each call of @ref next reads the next batch of all nodes with remaining values. The nodes are
+ * packed into as few requests as possible, respecting the `MaxNodesPerHistoryReadData` operation
+ * limit of the server. The values of a batch are moved from the response into a buffer per node,
+ * which is reused for the following batches.
+ *
+ * Pending continuation points are released on destruction.
+ *
+ * @code
+ * services::HistoryRawReader reader(client, ids, startTime, endTime);
+ * while (reader.next()) {
+ *     for (size_t i = 0; i < reader.size(); ++i) {
+ *         process(reader.getNodeId(i), reader.getValues(i));
+ *     }
+ * }
+ * @endcode
+ */
+class HistoryRawReader {
+public:
+    /**
+     * Prepare the history read, no request is sent until the first call of @ref next.
+     * @param client Instance of type Client
+     * @param ids Nodes to read
+     * @param startTime Start of the time range (`DateTime()` to read backwards from `endTime`)
+     * @param endTime End of the time range (`DateTime()` to read forward from `startTime`)
+     * @param options Options of the read
+     */
+    HistoryRawReader(
+        Client& client,
+        Span<const NodeId> ids,
+        DateTime startTime,
+        DateTime endTime,
+        const HistoryReadRawOptions& options = {}
+    );
+
+    ~HistoryRawReader();
+
+    HistoryRawReader(const HistoryRawReader&) = delete;
+    HistoryRawReader(HistoryRawReader&& other) noexcept;
+    HistoryRawReader& operator=(const HistoryRawReader&) = delete;
+    HistoryRawReader& operator=(HistoryRawReader&&) = delete;
+
+    /**
+     * Read the next batch of values of all nodes with remaining values.
+     * The values of the previous batch are discarded.
+     * @return `false` if all values have been read
+     * @exception BadStatus If the service call fails
+     */
+    bool next();
+
+    /// Number of nodes.
+    size_t size() const noexcept {
+        return nodes_.size();
+    }
+
+    /// Get the node id of the node at `index`.
+    const NodeId& getNodeId(size_t index) const {
+        return nodes_.at(index).id;
+    }
+
+    /// Get the values of the current batch of the node at `index`.
+    Span<const DataValue> getValues(size_t index) const {
+        return nodes_.at(index).values;
+    }
+
+    /// Get the status code of the last read of the node at `index`.
+    StatusCode getStatusCode(size_t index) const {
+        return nodes_.at(index).status;
+    }
+
+    /// Check if all values of the node at `index` have been read (or the read failed).
+    bool isDone(size_t index) const {
+        return nodes_.at(index).done;
+    }
+
+private:
+    struct NodeState {
+        NodeId id;
+        ByteString continuationPoint;
+        std::vector<DataValue> values;
+        StatusCode status;
+        bool done{false};
+    };
+
+    Client* client_;
+    DateTime startTime_;
+    DateTime endTime_;
+    HistoryReadRawOptions options_;
+    std::vector<NodeState> nodes_;
+};
+
+/**
+ * Lazy range of the raw history of a single node (client only).
+ *
+ * The input iterators read the next batch when the end of the current batch is reached. Iterators
+ * are invalidated when the range is moved or destroyed.
+ *
+ * @see historyReadRaw
+ */
+class HistoryRawRange {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = DataValue;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const DataValue*;
+        using reference = const DataValue&;
+
+        Iterator() = default;
+
+        explicit Iterator(HistoryRawReader* reader)
+            : reader_(reader) {
+            skipEmptyBatches();
+        }
+
+        reference operator*() const {
+            return reader_->getValues(0)[index_];
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        Iterator& operator++() {
+            ++index_;
+            skipEmptyBatches();
+            return *this;
+        }
+
+        void operator++(int) {
+            ++*this;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return reader_ == other.reader_ && index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        /// Read batches until a value is available or all values have been read.
+        void skipEmptyBatches() {
+            while (reader_ != nullptr && index_ >= reader_->getValues(0).size()) {
+                index_ = 0;
+                if (reader_->isDone(0) || !reader_->next()) {
+                    reader_ = nullptr;
+                    break;
+                }
+                detail::throwOnBadStatus(reader_->getStatusCode(0));
+            }
+        }
+
+        HistoryRawReader* reader_{nullptr};
+        size_t index_{0};
+    };
+
+    explicit HistoryRawRange(HistoryRawReader reader)
+        : reader_(std::move(reader)) {}
+
+    /// Start the iteration, only call once.
+    /// @exception BadStatus If the service call or the read of the node fails
+    Iterator begin() {
+        return Iterator(&reader_);
+    }
+
+    Iterator end() noexcept {
+        return {};
+    }
+
+private:
+    HistoryRawReader reader_;
+};
+
+/**
+ * Read the raw history of a node as a lazy range (client only).
+ *
+ * @code
+ * for (const DataValue& dv : services::historyReadRaw(client, id, startTime, endTime)) {
+ *     process(dv);
+ * }
+ * @endcode
+ *
+ * @param client Instance of type Client
+ * @param id Node to read
+ * @param startTime Start of the time range (`DateTime()` to read backwards from `endTime`)
+ * @param endTime End of the time range (`DateTime()` to read forward from `startTime`)
+ * @param options Options of the read
+ * @see HistoryRawReader to read multiple nodes with batched requests
+ */
+inline HistoryRawRange historyReadRaw(
+    Client& client,
+    const NodeId& id,
+    DateTime startTime,
+    DateTime endTime,
+    const HistoryReadRawOptions& options = {}
+) {
+    return HistoryRawRange(HistoryRawReader(client, {id}, startTime, endTime, options));
+}
+
+/**
+ * @}
+ */
+
+}  // namespace opcua::services
+
+#endif
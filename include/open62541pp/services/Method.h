@@ -1,14 +1,24 @@
 #pragma once
 
+#include <future>
 #include <vector>
 
 #include "open62541pp/Config.h"
+
+#ifdef UAPP_HAS_PMR
+#include <memory_resource>
+#endif
+
+#include "open62541pp/Result.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/services/Async.h"
+#include "open62541pp/types/Composed.h"
 
 #ifdef UA_ENABLE_METHODCALLS
 
 // forward declarations
 namespace opcua {
+class Client;
 class NodeId;
 class Variant;
 }  // namespace opcua
@@ -46,6 +56,119 @@ std::vector<Variant> call(
     Span<const Variant> inputArguments
 );
 
+/**
+ * Call a server method without exceptions.
+ * Bad status codes of the call or the input arguments are returned as empty result.
+ * @see call
+ */
+template <typename T>
+Result<std::vector<Variant>> tryCall(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+) noexcept;
+
+/**
+ * @overload
+ * Call a server method and move the results into caller-provided output arguments.
+ * Avoids the allocation of the result vector, e.g. for repeated calls.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param objectId NodeId of the object on which the method is invoked
+ * @param methodId NodeId of the method to invoke
+ * @param inputArguments Input argument values
+ * @param outputArguments Output argument values, the size must match the number of outputs
+ * @exception BadStatus
+ * @exception BadStatus (BadInvalidArgument) If the number of output arguments doesn't match
+ */
+template <typename T>
+void call(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    Span<Variant> outputArguments
+);
+
+#ifdef UAPP_HAS_PMR
+/**
+ * @overload
+ * Call a server method and return the results in a `std::pmr::vector`.
+ * The vector storage is allocated from `resource`, e.g. a `std::pmr::monotonic_buffer_resource`
+ * released at the end of a control cycle. The variant payloads are allocated by open62541.
+ */
+template <typename T>
+std::pmr::vector<Variant> call(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    std::pmr::memory_resource* resource
+);
+#endif
+
+/**
+ * Call multiple server methods with a single call (batched).
+ *
+ * In contrast to @ref call, no exception is thrown for failed calls. The results have the same
+ * order as `methodsToCall` and contain the status code, input argument results and output
+ * arguments of each call.
+ * Client requests are split into multiple requests to respect the `MaxNodesPerMethodCall`
+ * operation limit of the server.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param methodsToCall Methods to call with their input arguments
+ */
+template <typename T>
+std::vector<CallMethodResult> callBatch(
+    T& serverOrClient, Span<const CallMethodRequest> methodsToCall
+);
+
+/**
+ * Call multiple server methods with a single call (batched) without exceptions.
+ * Failed calls are reported per result like @ref callBatch, the result is empty for unexpected
+ * errors only (e.g. out of memory).
+ */
+template <typename T>
+Result<std::vector<CallMethodResult>> tryCallBatch(
+    T& serverOrClient, Span<const CallMethodRequest> methodsToCall
+) noexcept;
+
+/**
+ * Asynchronously call a server method (client only).
+ *
+ * The request is sent immediately, the callback is invoked within Client::runIterate once the
+ * response is received.
+ *
+ * @param client Instance of type Client
+ * @param objectId NodeId of the object on which the method is invoked
+ * @param methodId NodeId of the method to invoke
+ * @param inputArguments Input argument values
+ * @param callback Completion callback with the status code and the output arguments
+ * @exception BadStatus If the request could not be sent
+ */
+void callAsync(
+    Client& client,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    AsyncCallback<std::vector<Variant>> callback
+);
+
+/**
+ * @overload
+ * Asynchronously call a server method and return a future.
+ * @note The future is only fulfilled within Client::runIterate, don't wait for the future in the
+ *       same thread that drives the client.
+ */
+std::future<std::vector<Variant>> callAsync(
+    Client& client,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+);
+
 /**
  * @}
  */
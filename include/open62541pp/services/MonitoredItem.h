@@ -2,19 +2,61 @@
 
 #include <cstdint>
 #include <functional>
+#include <optional>
+#include <vector>
 
 #include "open62541pp/Common.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/ExtensionObject.h"
 
+// forward declarations
+namespace opcua {
+class DataValue;
+}  // namespace opcua
+
+namespace opcua {
+// forward declaration
+class SharedEventFilter;
+}  // namespace opcua
+
+namespace opcua::services {
+
+/**
+ * Client-side data change filter.
+ * Notifications are discarded before the callbacks are invoked. Useful for noisy values and for
+ * servers that don't support deadband filtering. Changes of the status code are always reported.
+ * Available without subscription support, it's also applied to the items of poll groups.
+ * @ingroup MonitoredItem
+ */
+struct ClientDataChangeFilter {
+    /// Discard notifications if neither value nor status code changed.
+    bool discardUnchanged = true;
+    /// Absolute deadband of numeric scalar values (`0.0` to disable).
+    /// Notifications are discarded if the difference to the last reported value is less than or
+    /// equal to the deadband.
+    double absoluteDeadband = 0.0;
+};
+
+/**
+ * Data change notification callback.
+ * @param subId Subscription identifier (`0U` for local (server-side) monitored item)
+ * @param monId MonitoredItem identifier
+ * @param value Changed value
+ * @ingroup MonitoredItem
+ */
+using DataChangeNotificationCallback =
+    std::function<void(uint32_t subId, uint32_t monId, const DataValue& value)>;
+
+}  // namespace opcua::services
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
 // forward declarations
 namespace opcua {
 class Client;
 class Server;
-class DataValue;
 class ReadValueId;
 class Variant;
 }  // namespace opcua
@@ -38,6 +80,21 @@ namespace opcua::services {
  * @{
  */
 
+/**
+ * Aggregate functions of aggregate filters, the values are the node ids of the aggregate function
+ * objects (namespace 0).
+ * @see MonitoringParameters::setAggregateFilter
+ */
+enum class AggregateFunction : uint32_t {
+    // clang-format off
+    Interpolative = 2341,
+    Average       = 2342,
+    Minimum       = 2346,
+    Maximum       = 2347,
+    Count         = 2352,
+    // clang-format on
+};
+
 /**
  * Monitoring parameters with default values from open62541.
  * Parameters are passed by reference because illegal parameters can be revised by the server.
@@ -68,6 +125,30 @@ struct MonitoringParameters {
     /// - `true`: the oldest (first) notification in the queue is discarded
     /// - `false`: the last notification added to the queue gets replaced with the new notification
     bool discardOldest = true;
+    /// Sample the value on changes instead of periodically (local monitored items of servers only,
+    /// ignored by clients). The item is sampled on creation, after writes with the write services
+    /// of the server, after publishes of value publishers and with Server::notifyValueChanged.
+    /// Unchanged values are discarded unless another client-side filter is set. Idle variables cost
+    /// nothing, the `samplingInterval` is not used.
+    bool eventDriven = false;
+
+    /// Set a typed filter, e.g. DataChangeFilter, EventFilter or AggregateFilter.
+    template <typename T>
+    void setFilter(const T& value) {
+        filter = ExtensionObject::fromDecodedCopy(value);
+    }
+
+    /**
+     * Set an aggregate filter, only the aggregate of each processing interval is reported.
+     * The intervals start now. Local (server-side) monitored items compute the aggregates
+     * incrementally by sampling the value with the `samplingInterval` (100 ms if not positive).
+     * Only good numeric scalar values are aggregated, the reported values have the interval start
+     * as source timestamp and empty intervals are reported with BadNoData.
+     * @note open62541 (v1.3) servers reject aggregate filters of remote clients.
+     * @param function Aggregate function
+     * @param processingInterval Length of the intervals in milliseconds
+     */
+    void setAggregateFilter(AggregateFunction function, double processingInterval);
 };
 
 /**
@@ -77,15 +158,6 @@ struct MonitoringParameters {
  */
 using DeleteMonitoredItemCallback = std::function<void(uint32_t subId, uint32_t monId)>;
 
-/**
- * Data change notification callback.
- * @param subId Subscription identifier (`0U` for local (server-side) monitored item)
- * @param monId MonitoredItem identifier
- * @param value Changed value
- */
-using DataChangeNotificationCallback =
-    std::function<void(uint32_t subId, uint32_t monId, const DataValue& value)>;
-
 /**
  * Event notification callback.
  * @param subId Subscription identifier (`0U` for local (server-side) monitored item)
@@ -141,6 +213,47 @@ using EventNotificationCallback =
     DataChangeNotificationCallback dataChangeCallback
 );
 
+/**
+ * Result of a created monitored item (batched services).
+ */
+struct MonitoredItemCreateResult {
+    /// Status code of the operation.
+    StatusCode statusCode;
+    /// Server-assigned identifier of the monitored item (`0U` if not created).
+    uint32_t monitoredItemId{0U};
+    /// Revised sampling interval in milliseconds.
+    double revisedSamplingInterval{0.0};
+    /// Revised queue size.
+    uint32_t revisedQueueSize{0U};
+};
+
+/**
+ * Create and add multiple monitored items to a subscription for data change notifications.
+ *
+ * All items are created with as few CreateMonitoredItems requests as possible. The requests are
+ * split by the server's `MaxMonitoredItemsPerCall` operation limit, which is read once per session.
+ * The callbacks are shared by all items, use the `monId` argument to distinguish them.
+ * Errors of single items don't throw, check the status codes of the results instead.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param itemsToMonitor Items to monitor
+ * @param monitoringMode Monitoring mode
+ * @param parameters Monitoring parameters of all items, revised values are returned per item
+ * @param dataChangeCallback Invoked when a monitored item is changed
+ * @param deleteCallback Invoked when a monitored item is deleted
+ * @returns Results in the order of `itemsToMonitor`
+ */
+std::vector<MonitoredItemCreateResult> createMonitoredItemsDataChange(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    const DataChangeNotificationCallback& dataChangeCallback,
+    const DeleteMonitoredItemCallback& deleteCallback = {}
+);
+
 /**
  * Create and add a monitored item to a subscription for event notifications.
  * The `attributeId` of ReadValueId must be set to AttributeId::EventNotifier.
@@ -165,6 +278,25 @@ using EventNotificationCallback =
     DeleteMonitoredItemCallback deleteCallback = {}
 );
 
+/**
+ * Create and add a monitored item to a subscription for event notifications with a shared filter.
+ * The filter of `parameters` is replaced by a reference to the shared filter. The monitored item
+ * keeps the shared filter instead of a copy, e.g. for thousands of event notifiers with the same
+ * select and where clauses.
+ * @copydetails createMonitoredItemEvent
+ * @param filter Shared event filter, see EventFilterBuilder
+ */
+[[nodiscard]] uint32_t createMonitoredItemEvent(
+    Client& client,
+    uint32_t subscriptionId,
+    const ReadValueId& itemToMonitor,
+    MonitoringMode monitoringMode,
+    MonitoringParameters& parameters,
+    const SharedEventFilter& filter,
+    EventNotificationCallback eventCallback,
+    DeleteMonitoredItemCallback deleteCallback = {}
+);
+
 /**
  * Modify a monitored item of a subscription.
  * @copydetails MonitoringParameters
@@ -181,6 +313,39 @@ void modifyMonitoredItem(
     MonitoringParameters& parameters
 );
 
+/**
+ * Set a client-side data change filter of a monitored item.
+ * Pass `std::nullopt` to remove the filter.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param monitoredItemId Identifier of the monitored item
+ * @param filter Client-side data change filter
+ * @exception BadStatus (BadMonitoredItemIdInvalid) If the monitored item is unknown
+ */
+void setClientDataChangeFilter(
+    Client& client,
+    uint32_t subscriptionId,
+    uint32_t monitoredItemId,
+    std::optional<ClientDataChangeFilter> filter
+);
+
+/**
+ * Set a client-side data change filter of a local (server-side) monitored item.
+ *
+ * The filter is applied before the local data change callback is invoked. Combine it with the
+ * sampling interval of the monitored item to report only changed values, coalesced per sampling
+ * interval, e.g. for in-process historians.
+ *
+ * @param server Instance of type Server
+ * @param monitoredItemId Identifier of the monitored item
+ * @param filter Client-side data change filter
+ * @exception BadStatus (BadMonitoredItemIdInvalid) If the monitored item is unknown
+ */
+void setClientDataChangeFilter(
+    Server& server, uint32_t monitoredItemId, std::optional<ClientDataChangeFilter> filter
+);
+
 /**
  * Set the monitoring mode of a monitored item.
  *
@@ -193,6 +358,25 @@ void setMonitoringMode(
     Client& client, uint32_t subscriptionId, uint32_t monitoredItemId, MonitoringMode monitoringMode
 );
 
+/**
+ * Set the monitoring mode of multiple monitored items.
+ *
+ * The requests are split by the server's `MaxMonitoredItemsPerCall` operation limit.
+ * Errors of single items don't throw, check the returned status codes instead.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param monitoredItemIds Identifiers of the monitored items
+ * @param monitoringMode Monitoring mode
+ * @returns Status codes in the order of `monitoredItemIds`
+ */
+std::vector<StatusCode> setMonitoringMode(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const uint32_t> monitoredItemIds,
+    MonitoringMode monitoringMode
+);
+
 /**
  * Add and delete triggering links of a monitored item.
  * The triggering item and the items to report shall belong to the same subscription.
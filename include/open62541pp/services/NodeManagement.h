@@ -2,18 +2,23 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
 #include <string_view>
+#include <vector>
 
 #include "open62541pp/Common.h"  // ModellingRule
 #include "open62541pp/Config.h"
 #include "open62541pp/NodeIds.h"  // *TypeId
 #include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"  // StatusCode
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/NodeId.h"
 
 // forward declarations
 namespace opcua {
+class AsyncMethodDispatcher;
 class Client;
+class Server;
 class Variant;
 }  // namespace opcua
 
@@ -192,6 +197,73 @@ NodeId addMethod(
 );
 #endif
 
+#ifdef UAPP_ASYNC_METHODS
+/**
+ * Completion handle of an asynchronous method call.
+ *
+ * The handle can be moved to and completed from any thread. Only the first completion is
+ * considered. If the handle is destroyed without completion, the call fails with
+ * `BadInternalError`. Calls that are not completed within the async operation timeout of the
+ * server configuration fail with `BadTimeout`.
+ */
+class MethodCompletion {
+public:
+    MethodCompletion(std::shared_ptr<AsyncMethodDispatcher> dispatcher, void* context) noexcept;
+    ~MethodCompletion();
+
+    MethodCompletion(const MethodCompletion&) = delete;
+    MethodCompletion(MethodCompletion&& other) noexcept;
+    MethodCompletion& operator=(const MethodCompletion&) = delete;
+    MethodCompletion& operator=(MethodCompletion&& other) noexcept;
+
+    /// Complete the method call with output parameters (thread-safe).
+    void complete(Span<const Variant> output);
+
+    /// Fail the method call with a bad status code (thread-safe).
+    void fail(StatusCode status) noexcept;
+
+    /// Check if the method call is already completed (or failed).
+    bool isCompleted() const noexcept {
+        return dispatcher_ == nullptr;
+    }
+
+private:
+    std::shared_ptr<AsyncMethodDispatcher> dispatcher_;
+    void* context_{nullptr};
+};
+
+/**
+ * Asynchronous method callback.
+ * Executed in a worker thread of the server, see Server::setAsyncMethodThreads.
+ * @param input Input parameters, valid until the call is completed
+ * @param completion Completion handle to set the output parameters
+ */
+using AsyncMethodCallback =
+    std::function<void(Span<const Variant> input, MethodCompletion completion)>;
+
+/**
+ * Add method with asynchronous execution (server only).
+ *
+ * The method call is queued by the server and dispatched to a worker thread, the network loop
+ * continues to process other requests. The call is finished with the completion handle from any
+ * thread, so long running methods never stall other sessions or publish responses.
+ *
+ * @note Requires open62541 compiled with `UA_MULTITHREADING >= 100`.
+ * @exception BadStatus
+ */
+NodeId addMethodAsync(
+    Server& server,
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    AsyncMethodCallback callback,
+    Span<const Argument> inputArguments,
+    Span<const Argument> outputArguments,
+    const MethodAttributes& attributes = {},
+    const NodeId& referenceType = ReferenceTypeId::HasComponent
+);
+#endif
+
 /**
  * Add object type.
  * @exception BadStatus
@@ -353,6 +425,27 @@ inline void addModellingRule(T& serverOrClient, const NodeId& id, ModellingRule
 template <typename T>
 void deleteNode(T& serverOrClient, const NodeId& id, bool deleteReferences = true);
 
+/**
+ * Delete multiple nodes.
+ * Clients send a single DeleteNodes request (split by the server's `MaxNodesPerNodeManagement`
+ * operation limit). Failures of single nodes are reported in the result instead of exceptions.
+ * @return Status codes in the order of the node ids
+ * @exception BadStatus If the request fails as a whole (client only)
+ */
+template <typename T>
+std::vector<StatusCode> deleteNodes(
+    T& serverOrClient, Span<const NodeId> ids, bool deleteReferences = true
+);
+
+/**
+ * Delete a node and all its descendants.
+ * The descendants are collected with a single recursive browse of the hierarchical references
+ * and deleted bottom-up in batches (see @ref deleteNodes). Descendants in namespace 0 are kept.
+ * @exception BadStatus If a node can't be deleted
+ */
+template <typename T>
+void deleteSubtree(T& serverOrClient, const NodeId& rootId);
+
 /**
  * Delete reference.
  * @exception BadStatus
@@ -367,6 +460,121 @@ void deleteReference(
     bool deleteBidirectional
 );
 
+/* ------------------------------------------ NodeBatch ----------------------------------------- */
+
+/**
+ * Collection of node and reference definitions to add in bulk.
+ *
+ * The definitions are stored as AddNodesItem/AddReferencesItem and added with a single AddNodes
+ * and AddReferences request by a client (split by the server's `MaxNodesPerNodeManagement`
+ * operation limit) or directly within one loop by a server.
+ * @see addNodes(T&, const NodeBatch&)
+ */
+class NodeBatch {
+public:
+    /// Reserve capacity for the given number of nodes and references.
+    void reserve(size_t nodeCount, size_t referenceCount = 0);
+
+    /// Add object definition.
+    NodeBatch& addObject(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const ObjectAttributes& attributes = {},
+        const NodeId& objectType = ObjectTypeId::BaseObjectType,
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    );
+
+    /// Add folder definition.
+    NodeBatch& addFolder(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const ObjectAttributes& attributes = {},
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    );
+
+    /// Add variable definition.
+    NodeBatch& addVariable(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const VariableAttributes& attributes = {},
+        const NodeId& variableType = VariableTypeId::BaseDataVariableType,
+        const NodeId& referenceType = ReferenceTypeId::HasComponent
+    );
+
+    /// Add property definition.
+    NodeBatch& addProperty(
+        const NodeId& parentId,
+        const NodeId& id,
+        std::string_view browseName,
+        const VariableAttributes& attributes = {}
+    );
+
+    /// Add reference definition. References are added after all nodes of the batch.
+    NodeBatch& addReference(
+        const NodeId& sourceId,
+        const NodeId& targetId,
+        const NodeId& referenceType,
+        bool forward = true
+    );
+
+    /// Add node definition.
+    NodeBatch& addNode(AddNodesItem item);
+
+    /// Add reference definition.
+    NodeBatch& addReference(AddReferencesItem item);
+
+    /// Remove all definitions.
+    void clear() noexcept;
+
+    Span<AddNodesItem> getNodes() noexcept {
+        return nodes_;
+    }
+
+    Span<const AddNodesItem> getNodes() const noexcept {
+        return nodes_;
+    }
+
+    Span<AddReferencesItem> getReferences() noexcept {
+        return references_;
+    }
+
+    Span<const AddReferencesItem> getReferences() const noexcept {
+        return references_;
+    }
+
+private:
+    std::vector<AddNodesItem> nodes_;
+    std::vector<AddReferencesItem> references_;
+};
+
+/**
+ * Result of @ref addNodes(T&, const NodeBatch&).
+ * The results are in the same order as the definitions of the batch.
+ */
+struct NodeBatchResult {
+    /// Ids of the added nodes (null NodeId if the node could not be added).
+    std::vector<NodeId> nodeIds;
+    /// Status codes of the node definitions.
+    std::vector<StatusCode> nodeStatusCodes;
+    /// Status codes of the reference definitions.
+    std::vector<StatusCode> referenceStatusCodes;
+
+    /// Check if all nodes and references were added.
+    bool isGood() const noexcept;
+};
+
+/**
+ * Add all nodes and references of a batch.
+ * Failures of single definitions are reported in the result instead of exceptions.
+ * The client sends the batch in chunks of the server's operation limits. If a request fails, the
+ * results of the previous chunks are kept and the remaining definitions get its status code.
+ */
+template <typename T>
+NodeBatchResult addNodes(T& serverOrClient, const NodeBatch& batch);
+
 /**
  * @}
  */
@@ -2,14 +2,19 @@
 
 #include <cstdint>
 #include <functional>
+#include <memory>
+#include <optional>
 
 #include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/DataValue.h"
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
 // forward declarations
 namespace opcua {
 class Client;
+class NotificationQueue;
 }  // namespace opcua
 
 namespace opcua::services {
@@ -53,6 +58,24 @@ struct SubscriptionParameters {
  */
 using DeleteSubscriptionCallback = std::function<void(uint32_t subId)>;
 
+/**
+ * Data change notification of a single monitored item (batched delivery).
+ */
+struct DataChangeNotification {
+    /// MonitoredItem identifier
+    uint32_t monId{0U};
+    /// Changed value
+    DataValue value;
+};
+
+/**
+ * Batched data change notification callback.
+ * @param subId Subscription identifier
+ * @param notifications Data change notifications of all monitored items of the subscription
+ */
+using DataChangeBatchCallback =
+    std::function<void(uint32_t subId, Span<const DataChangeNotification> notifications)>;
+
 /**
  * Create a subscription.
  * @copydetails SubscriptionParameters
@@ -93,6 +116,83 @@ void modifySubscription(
  */
 void setPublishingMode(Client& client, uint32_t subscriptionId, bool publishing);
 
+/**
+ * Deliver the data change notifications of a subscription in batches.
+ *
+ * All data change notifications received within one iteration of the client's main loop
+ * (typically one PublishResponse) are collected and passed to a single callback. The callbacks of
+ * the individual monitored items are not invoked anymore. Pass an empty callback to restore the
+ * per-item delivery. The notifications are dispatched at the end of Client::runIterate.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param callback Invoked with all collected data change notifications
+ * @exception BadStatus (BadSubscriptionIdInvalid) If the subscription is unknown
+ */
+void setDataChangeBatchCallback(
+    Client& client, uint32_t subscriptionId, DataChangeBatchCallback callback
+);
+
+/**
+ * Enqueue the data change notifications of a subscription into a lock-free queue.
+ *
+ * The notifications are moved into the queue by the thread running the client's main loop and
+ * can be consumed from another thread. Callbacks of the monitored items and batch callbacks are
+ * not invoked while a queue is set. Pass `nullptr` to restore the callback delivery.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param queue Notification queue
+ * @exception BadStatus (BadSubscriptionIdInvalid) If the subscription is unknown
+ */
+void setNotificationQueue(
+    Client& client, uint32_t subscriptionId, std::shared_ptr<NotificationQueue> queue
+);
+
+/**
+ * Policy of adaptive publishing.
+ *
+ * The notification rate of the subscription is evaluated periodically. If the rate exceeds the
+ * notification budget or the notification queue piles up, the publishing interval is doubled
+ * (values of monitored items with small queue sizes are coalesced by the server). If the load is
+ * light, the publishing interval is halved again to reduce the latency. The keep-alive and
+ * lifetime counts are scaled to keep the keep-alive and lifetime periods constant.
+ */
+struct AdaptivePublishingPolicy {
+    /// Lower bound of the publishing interval in milliseconds.
+    double minPublishingInterval = 100.0;
+    /// Upper bound of the publishing interval in milliseconds.
+    double maxPublishingInterval = 10000.0;
+    /// Notification budget per second.
+    /// Also used to limit the maximum number of notifications per publish.
+    double maxNotificationsPerSecond = 1000.0;
+    /// Interval in milliseconds to evaluate the notification rate.
+    double evaluationInterval = 5000.0;
+    /// Lower bound of outstanding publish requests.
+    uint16_t minPublishRequests = 1;
+    /// Upper bound of outstanding publish requests.
+    /// Additional requests are sent if the publish responses are filled up to the limit.
+    uint16_t maxPublishRequests = 4;
+};
+
+/**
+ * Retune the parameters of a subscription automatically.
+ *
+ * The subscription is evaluated and modified (see @ref modifySubscription) within
+ * Client::runIterate. The number of outstanding publish requests is set for the whole client
+ * connection (maximum of all adaptive subscriptions). Pass `std::nullopt` to keep the current
+ * parameters fixed.
+ *
+ * @param client Instance of type Client
+ * @param subscriptionId Identifier of the subscription returned by @ref createSubscription
+ * @param policy Bounds and budget of the tuning
+ * @exception BadStatus (BadSubscriptionIdInvalid) If the subscription is unknown
+ * @exception BadStatus (BadInvalidArgument) If the bounds of the policy are invalid
+ */
+void setAdaptivePublishing(
+    Client& client, uint32_t subscriptionId, std::optional<AdaptivePublishingPolicy> policy
+);
+
 /**
  * Delete a subscription.
  *
@@ -0,0 +1,284 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>  // invoke
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <utility>  // forward, index_sequence
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/services/Method.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#ifdef UA_ENABLE_METHODCALLS
+
+namespace opcua {
+
+namespace detail {
+
+template <typename T>
+using MethodValueT = std::remove_cv_t<std::remove_reference_t<T>>;
+
+template <typename T>
+struct IsTuple : std::false_type {};
+
+template <typename... Ts>
+struct IsTuple<std::tuple<Ts...>> : std::true_type {};
+
+/// Native and wrapper types are accessed in the native storage of the variant without copy.
+template <typename T>
+inline constexpr bool isMethodArgumentNoCopy = isNativeType<T> || isTypeWrapper<T>;
+
+/// Get a scalar argument without copy for native, wrapper and view types (e.g. std::string_view).
+template <typename T>
+decltype(auto) getMethodArgument(const Variant& variant) {
+    using ValueType = MethodValueT<T>;
+    if constexpr (isMethodArgumentNoCopy<ValueType>) {
+        return variant.getScalar<ValueType>();
+    } else {
+        return variant.getScalarCopy<ValueType>();
+    }
+}
+
+/// Set a scalar argument without copy for native and wrapper types.
+template <typename T>
+void setMethodArgument(Variant& variant, const T& value) {
+    if constexpr (isMethodArgumentNoCopy<T>) {
+        variant.setScalar(const_cast<T&>(value));  // NOLINT, input arguments are not modified
+    } else {
+        variant.setScalarCopy(value);
+    }
+}
+
+template <typename T>
+Argument createMethodArgument(std::string_view name) {
+    return Argument(
+        name, {}, NodeId(guessDataType<MethodValueT<T>>().typeId), ValueRank::Scalar
+    );
+}
+
+template <typename... Ts>
+std::vector<Argument> createMethodArguments(
+    const std::tuple<Ts...>* /* unused */,
+    Span<const std::string_view> names,
+    std::string_view defaultPrefix
+) {
+    if (!names.empty() && names.size() != sizeof...(Ts)) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    std::vector<Argument> result;
+    result.reserve(sizeof...(Ts));
+    const auto add = [&](auto* type) {
+        using ValueType = std::remove_pointer_t<decltype(type)>;
+        const size_t index = result.size();
+        if (names.empty()) {
+            result.push_back(createMethodArgument<ValueType>(
+                std::string(defaultPrefix) + std::to_string(index + 1)
+            ));
+        } else {
+            result.push_back(createMethodArgument<ValueType>(names[index]));
+        }
+    };
+    (add(static_cast<MethodValueT<Ts>*>(nullptr)), ...);
+    return result;
+}
+
+template <typename R>
+struct MethodOutputs {
+    using Types = std::tuple<R>;
+};
+
+template <>
+struct MethodOutputs<void> {
+    using Types = std::tuple<>;
+};
+
+template <typename... Ts>
+struct MethodOutputs<std::tuple<Ts...>> {
+    using Types = std::tuple<Ts...>;
+};
+
+template <typename Signature>
+struct MethodSignature;
+
+/**
+ * Typed method signature `R(Args...)`.
+ * Multiple output arguments are returned as `std::tuple`, no output argument as `void`.
+ */
+template <typename R, typename... Args>
+struct MethodSignature<R(Args...)> {
+    using Outputs = typename MethodOutputs<R>::Types;
+
+    static std::vector<Argument> createInputArguments(Span<const std::string_view> names) {
+        return createMethodArguments(static_cast<std::tuple<Args...>*>(nullptr), names, "input");
+    }
+
+    static std::vector<Argument> createOutputArguments(Span<const std::string_view> names) {
+        return createMethodArguments(static_cast<Outputs*>(nullptr), names, "output");
+    }
+
+    template <typename F>
+    static void invoke(F& func, Span<const Variant> input, Span<Variant> output) {
+        invokeImpl(func, input, output, std::index_sequence_for<Args...>{});
+    }
+
+private:
+    template <typename F, size_t... Is>
+    static void invokeImpl(
+        F& func,
+        [[maybe_unused]] Span<const Variant> input,
+        [[maybe_unused]] Span<Variant> output,
+        std::index_sequence<Is...> /* unused */
+    ) {
+        if constexpr (std::is_void_v<R>) {
+            std::invoke(func, getMethodArgument<Args>(input[Is])...);
+        } else if constexpr (IsTuple<R>::value) {
+            std::apply(
+                [&](const auto&... values) {
+                    [[maybe_unused]] size_t i = 0;
+                    (output[i++].setScalarCopy(values), ...);
+                },
+                std::invoke(func, getMethodArgument<Args>(input[Is])...)
+            );
+        } else {
+            output[0].setScalarCopy(std::invoke(func, getMethodArgument<Args>(input[Is])...));
+        }
+    }
+};
+
+}  // namespace detail
+
+namespace services {
+
+/**
+ * @addtogroup NodeManagement
+ * @{
+ */
+
+/**
+ * Add method with a typed signature (server only).
+ *
+ * The argument descriptors are generated from the signature. Input arguments of native types
+ * (e.g. `int32_t`, `double`), wrapper types and `std::string_view` are passed to the callback
+ * without copy from the native storage of the request.
+ *
+ * @code
+ * services::addMethod<int32_t(int32_t, int32_t)>(
+ *     server, parentId, id, "add", [](int32_t a, int32_t b) { return a + b; }
+ * );
+ * @endcode
+ *
+ * @tparam Signature Method signature `R(Args...)`, return `std::tuple` for multiple outputs
+ * @param func Callable with the method signature
+ * @param inputNames Optional names of the input arguments (default: `input1`, `input2`, ...)
+ * @param outputNames Optional names of the output arguments (default: `output1`, ...)
+ * @exception BadStatus
+ * @exception BadStatus (BadInvalidArgument) If the number of names doesn't match the signature
+ */
+template <typename Signature, typename F>
+NodeId addMethod(
+    Server& server,
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    F&& func,
+    Span<const std::string_view> inputNames = {},
+    Span<const std::string_view> outputNames = {},
+    const MethodAttributes& attributes = {},
+    const NodeId& referenceType = ReferenceTypeId::HasComponent
+) {
+    using MethodSignature = detail::MethodSignature<Signature>;
+    return addMethod(
+        server,
+        parentId,
+        id,
+        browseName,
+        [fn = std::forward<F>(func)](Span<const Variant> input, Span<Variant> output) mutable {
+            MethodSignature::invoke(fn, input, output);
+        },
+        MethodSignature::createInputArguments(inputNames),
+        MethodSignature::createOutputArguments(outputNames),
+        attributes,
+        referenceType
+    );
+}
+
+/**
+ * @}
+ * @addtogroup Method
+ * @{
+ */
+
+/**
+ * Call a server method with typed arguments and write the results into caller-provided storage.
+ *
+ * Input arguments of native and wrapper types are passed without copy.
+ *
+ * @code
+ * int32_t sum{};
+ * services::callTyped(client, objectId, methodId, sum, 1, 2);
+ * double min{}, max{};
+ * services::callTyped(client, objectId, methodId, std::tie(min, max), values);
+ * @endcode
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param objectId NodeId of the object on which the method is invoked
+ * @param methodId NodeId of the method to invoke
+ * @param outputs Reference to a single output or `std::tie` of multiple outputs
+ * @param inputs Input argument values
+ * @exception BadStatus
+ * @exception BadStatus (BadInvalidArgument) If the number of output arguments doesn't match
+ * @exception BadStatus (BadTypeMismatch) If the type of an output argument doesn't match
+ */
+template <typename T, typename Outputs, typename... Inputs>
+void callTyped(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Outputs&& outputs,
+    const Inputs&... inputs
+) {
+    std::array<Variant, sizeof...(Inputs)> inputVariants;
+    [[maybe_unused]] size_t i = 0;
+    (detail::setMethodArgument(inputVariants[i++], inputs), ...);
+
+    auto assignOutputs = [&](auto&... values) {
+        static_assert(
+            (!std::is_same_v<detail::MethodValueT<decltype(values)>, std::string_view> && ...),
+            "Output arguments must own their data"
+        );
+        std::array<Variant, sizeof...(values)> outputVariants;
+        call(serverOrClient, objectId, methodId, inputVariants, outputVariants);
+        [[maybe_unused]] size_t j = 0;
+        ((values = outputVariants[j++].template takeScalar<
+                   detail::MethodValueT<decltype(values)>>()),
+         ...);
+    };
+    if constexpr (detail::IsTuple<detail::MethodValueT<Outputs>>::value) {
+        std::apply(assignOutputs, outputs);
+    } else {
+        assignOutputs(outputs);
+    }
+}
+
+/**
+ * @}
+ */
+
+}  // namespace services
+
+}  // namespace opcua
+
+#endif
@@ -1,12 +1,25 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <functional>
+#include <future>
+#include <iterator>  // input_iterator_tag
 #include <vector>
 
+#include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Result.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/services/Async.h"
 #include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
 #include "open62541pp/types/NodeId.h"
 
+#ifdef UAPP_HAS_PMR
+#include <memory_resource>
+#endif
+
 // forward declarations
 namespace opcua {
 class ByteString;
@@ -42,6 +55,45 @@ BrowseResponse browse(Client& client, const BrowseRequest& request);
 template <typename T>
 BrowseResult browse(T& serverOrClient, const BrowseDescription& bd, uint32_t maxReferences = 0);
 
+/**
+ * Discover the references of a specified node without exceptions.
+ * Bad status codes of the service or the browse result are returned as empty result.
+ * @see browse
+ */
+template <typename T>
+Result<BrowseResult> tryBrowse(
+    T& serverOrClient, const BrowseDescription& bd, uint32_t maxReferences = 0
+) noexcept;
+
+/**
+ * Asynchronously discover the references of a specified node (client only).
+ *
+ * The request is sent immediately, the callback is invoked within Client::runIterate once the
+ * response is received.
+ *
+ * @param client Instance of type Client
+ * @param bd Browse description
+ * @param maxReferences The maximum number of references to return (0 if no limit)
+ * @param callback Completion callback with the status code and the browse result
+ * @exception BadStatus If the request could not be sent
+ */
+void browseAsync(
+    Client& client,
+    const BrowseDescription& bd,
+    uint32_t maxReferences,
+    AsyncCallback<BrowseResult> callback
+);
+
+/**
+ * @overload
+ * Asynchronously discover the references of a specified node and return a future.
+ * @note The future is only fulfilled within Client::runIterate, don't wait for the future in the
+ *       same thread that drives the client.
+ */
+std::future<BrowseResult> browseAsync(
+    Client& client, const BrowseDescription& bd, uint32_t maxReferences = 0
+);
+
 /**
  * Request the next sets of @ref browse / @ref browseNext responses (client only).
  * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.8.3
@@ -63,6 +115,7 @@ BrowseResult browseNext(
 
 /**
  * Discover all the references of a specified node (without calling @ref browseNext).
+ * Results of clients are served from the attached BrowseCache (see Client::setBrowseCache).
  * @copydetails browse
  */
 template <typename T>
@@ -70,6 +123,201 @@ std::vector<ReferenceDescription> browseAll(
     T& serverOrClient, const BrowseDescription& bd, uint32_t maxReferences = 0
 );
 
+/**
+ * @overload
+ * Browse into an existing vector, e.g. for repeated browsing of the same nodes.
+ * The references are assigned to `references`, the capacity of the vector is retained.
+ */
+template <typename T>
+void browseAll(
+    T& serverOrClient,
+    const BrowseDescription& bd,
+    std::vector<ReferenceDescription>& references,
+    uint32_t maxReferences = 0
+);
+
+#ifdef UAPP_HAS_PMR
+/**
+ * @overload
+ * Browse into a `std::pmr::vector` with storage allocated from `resource`, e.g. a
+ * `std::pmr::monotonic_buffer_resource` released at the end of a control cycle.
+ * The members of the references (node ids, names) are allocated by open62541.
+ */
+template <typename T>
+std::pmr::vector<ReferenceDescription> browseAll(
+    T& serverOrClient,
+    const BrowseDescription& bd,
+    std::pmr::memory_resource* resource,
+    uint32_t maxReferences = 0
+);
+#endif
+
+/**
+ * Paged browse of the references of a node.
+ *
+ * In contrast to @ref browseAll, the references are not accumulated in a single vector. Each
+ * call of @ref next fetches the next page (the first with browse, the following with browseNext
+ * and the continuation point of the previous page). The references of a page can be moved out of
+ * the page without copies. The input iterators fetch the next page when the end of the current
+ * page is reached:
+ *
+ * @code
+ * services::BrowseRange range(client, bd, 1000);
+ * for (ReferenceDescription& ref : range) {
+ *     process(std::move(ref));
+ * }
+ * @endcode
+ *
+ * A pending continuation point is released with @ref release or on destruction, e.g. if the
+ * iteration is stopped early. Iterators are invalidated when the range is moved or destroyed.
+ * Results are never served from the BrowseCache.
+ */
+template <typename T>
+class BrowseRange {
+public:
+    class Iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = ReferenceDescription;
+        using difference_type = std::ptrdiff_t;
+        using pointer = ReferenceDescription*;
+        using reference = ReferenceDescription&;
+
+        Iterator() = default;
+
+        explicit Iterator(BrowseRange* range)
+            : range_(range) {
+            skipEmptyPages();
+        }
+
+        reference operator*() const {
+            return range_->getReferences()[index_];
+        }
+
+        pointer operator->() const {
+            return &**this;
+        }
+
+        Iterator& operator++() {
+            ++index_;
+            skipEmptyPages();
+            return *this;
+        }
+
+        void operator++(int) {
+            ++*this;
+        }
+
+        bool operator==(const Iterator& other) const noexcept {
+            return range_ == other.range_ && index_ == other.index_;
+        }
+
+        bool operator!=(const Iterator& other) const noexcept {
+            return !(*this == other);
+        }
+
+    private:
+        /// Fetch pages until a reference is available or all pages have been fetched.
+        void skipEmptyPages() {
+            while (range_ != nullptr && index_ >= range_->getReferences().size()) {
+                index_ = 0;
+                if (!range_->next()) {
+                    range_ = nullptr;
+                }
+            }
+        }
+
+        BrowseRange* range_{nullptr};
+        size_t index_{0};
+    };
+
+    /**
+     * Prepare the browse, no request is sent until the first call of @ref next.
+     * @param serverOrClient Instance of type Server or Client
+     * @param bd Browse description
+     * @param pageSize Maximum number of references per page (0 for the server's limit)
+     */
+    BrowseRange(T& serverOrClient, const BrowseDescription& bd, uint32_t pageSize = 0);
+
+    ~BrowseRange();
+
+    BrowseRange(const BrowseRange&) = delete;
+    BrowseRange(BrowseRange&& other) noexcept;
+    BrowseRange& operator=(const BrowseRange&) = delete;
+    BrowseRange& operator=(BrowseRange&&) = delete;
+
+    /**
+     * Fetch the next page of references, the references of the previous page are discarded.
+     * @return `false` if all references have been fetched
+     * @exception BadStatus If the service call fails
+     */
+    bool next();
+
+    /// Get the references of the current page.
+    Span<ReferenceDescription> getReferences() noexcept {
+        return page_.getReferences();
+    }
+
+    /// Release the continuation point, no more pages are fetched afterwards.
+    void release();
+
+    /// Start the iteration, only call once.
+    /// @exception BadStatus If the service call fails
+    Iterator begin() {
+        return Iterator(this);
+    }
+
+    Iterator end() noexcept {
+        return {};
+    }
+
+private:
+    T* connection_;
+    BrowseDescription bd_;
+    uint32_t pageSize_;
+    bool started_{false};
+    BrowseResult page_;
+};
+
+/**
+ * Result of @ref browseWithAttributes as a structure of arrays.
+ * All arrays (and columns) have the same order as the references.
+ */
+struct BrowseAttributesResult {
+    /// References of the browsed node.
+    std::vector<ReferenceDescription> references;
+    /// Node ids of the reference targets.
+    std::vector<NodeId> nodeIds;
+    /// Attributes of the columns.
+    std::vector<AttributeId> attributeIds;
+    /// Attribute values, one column per attribute with one value per reference target.
+    std::vector<std::vector<DataValue>> columns;
+
+    /// Get the column of an attribute (empty if the attribute wasn't requested).
+    Span<const DataValue> getColumn(AttributeId attributeId) const noexcept;
+};
+
+/**
+ * Discover all references of a node and read attributes of the reference targets.
+ *
+ * Replaces the common pattern of browsing the children and reading attributes for each child
+ * afterwards with two calls: @ref browseAll followed by a single batched read
+ * (see readAttributes) of all attributes of all targets. Read errors are reported by the status
+ * codes of the DataValues, targets on other servers get the status code `BadNodeIdUnknown`.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param bd Browse description
+ * @param attributeIds Attributes to read for each reference target
+ * @param timestamps Timestamps to return
+ */
+template <typename T>
+BrowseAttributesResult browseWithAttributes(
+    T& serverOrClient,
+    const BrowseDescription& bd,
+    Span<const AttributeId> attributeIds,
+    TimestampsToReturn timestamps = TimestampsToReturn::Neither
+);
+
 /**
  * Discover child nodes recursively (non-standard).
  *
@@ -79,7 +327,7 @@ std::vector<ReferenceDescription> browseAll(
  * NodeClass does not match. So it is possible, for example, to get all VariableNodes below a
  * certain ObjectNode, with additional objects in the hierarchy below.
  *
- * @note No implementation for `Client`.
+ * @note Use the callback-based overload for `Client`.
  *
  * @param server Instance of type Server
  * @param bd Browse description
@@ -87,6 +335,32 @@ std::vector<ReferenceDescription> browseAll(
  */
 std::vector<ExpandedNodeId> browseRecursive(Server& server, const BrowseDescription& bd);
 
+/**
+ * Discover child nodes recursively with a breadth-first crawl (client only, non-standard).
+ *
+ * Same semantics as @ref browseRecursive(Server&, const BrowseDescription&), but the results are
+ * streamed to a callback once per discovered node instead of being accumulated. Each level of the
+ * crawl is packed into as few browse requests as possible, respecting the `MaxNodesPerBrowse`
+ * operation limit of the server. Several requests are kept in flight using the asynchronous
+ * services and continuation points are followed with batched browseNext requests. Only nodes on
+ * the same server (local node ids) are followed.
+ *
+ * The function drives the client's event loop (Client::runIterate) until the crawl is finished.
+ * Don't call it while Client::run is active in another thread.
+ *
+ * @param client Instance of type Client
+ * @param bd Browse description of the starting node
+ * @param onReference Callback for each discovered node (matching the `nodeClassMask`)
+ * @param maxConcurrentRequests Maximum number of requests in flight
+ * @exception BadStatus If a browse service call fails
+ */
+void browseRecursive(
+    Client& client,
+    const BrowseDescription& bd,
+    std::function<void(const ReferenceDescription& ref)> onReference,
+    size_t maxConcurrentRequests = 4
+);
+
 /**
  * Translate browse paths to NodeIds (client only).
  * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.8.4
@@ -104,6 +378,23 @@ TranslateBrowsePathsToNodeIdsResponse translateBrowsePathsToNodeIds(
 template <typename T>
 BrowsePathResult translateBrowsePathToNodeIds(T& serverOrClient, const BrowsePath& browsePath);
 
+/**
+ * Translate multiple browse paths to NodeIds with a single call (batched).
+ *
+ * In contrast to @ref translateBrowsePathToNodeIds, no exception is thrown for failed
+ * operations. The results have the same order as `browsePaths` and contain the status code of
+ * each operation. Client requests are split into multiple requests to respect the
+ * `MaxNodesPerTranslateBrowsePathsToNodeIds` operation limit of the server.
+ *
+ * @param serverOrClient Instance of type Server or Client
+ * @param browsePaths Browse paths (starting node & relative path)
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.8.4
+ */
+template <typename T>
+std::vector<BrowsePathResult> translateBrowsePathsToNodeIds(
+    T& serverOrClient, Span<const BrowsePath> browsePaths
+);
+
 /**
  * A simplified version of @ref translateBrowsePathToNodeIds.
  *
@@ -7,11 +7,15 @@
  * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/
  */
 
+#include "open62541pp/services/Async.h"
 #include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/Awaitable.h"
+#include "open62541pp/services/HistoryRead.h"
 #include "open62541pp/services/Method.h"
 #include "open62541pp/services/MonitoredItem.h"
 #include "open62541pp/services/NodeManagement.h"
 #include "open62541pp/services/Subscription.h"
+#include "open62541pp/services/TypedMethod.h"
 #include "open62541pp/services/View.h"
 
 /**
@@ -1,10 +1,12 @@
 #pragma once
 
 #include <array>
+#include <cstddef>
 #include <cstdint>
 #include <iosfwd>  // forward declare ostream
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <vector>
 
 // Workaround for GCC 7 with partial C++17 support
@@ -19,6 +21,7 @@ namespace fs = std::filesystem;
 
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/helper.h"  // toNativeString
 #include "open62541pp/open62541.h"
 
 namespace opcua {
@@ -206,6 +209,39 @@ public:
     std::string_view getName() const;
 };
 
+/**
+ * Non-owning view of a UA_QualifiedName (no allocation).
+ *
+ * The view references the name, which must outlive the view (e.g. string literals).
+ * It implicitly converts to `const QualifiedName&` and can be passed to all functions expecting a
+ * QualifiedName. Functions that store the name create a deep copy.
+ *
+ * @code
+ * static const opcua::QualifiedNameView severity(0, "Severity");
+ * event.writeProperty(severity, value);
+ * @endcode
+ */
+class QualifiedNameView {
+public:
+    QualifiedNameView(uint16_t namespaceIndex, std::string_view name) noexcept
+        : native_{namespaceIndex, detail::toNativeString(name)} {}
+
+    operator const QualifiedName&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    const QualifiedName& get() const noexcept {
+        return asWrapper<QualifiedName>(native_);
+    }
+
+    const QualifiedName* operator->() const noexcept {
+        return &get();
+    }
+
+private:
+    UA_QualifiedName native_;
+};
+
 /**
  * UA_LocalizedText wrapper class.
  * The format of locale is `<language>[-<country/region>]`:
@@ -227,6 +263,31 @@ public:
     std::string_view getLocale() const;
 };
 
+/**
+ * Non-owning view of a UA_LocalizedText (no allocation).
+ * Like QualifiedNameView, the locale and text must outlive the view.
+ */
+class LocalizedTextView {
+public:
+    LocalizedTextView(std::string_view locale, std::string_view text) noexcept
+        : native_{detail::toNativeString(locale), detail::toNativeString(text)} {}
+
+    operator const LocalizedText&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    const LocalizedText& get() const noexcept {
+        return asWrapper<LocalizedText>(native_);
+    }
+
+    const LocalizedText* operator->() const noexcept {
+        return &get();
+    }
+
+private:
+    UA_LocalizedText native_;
+};
+
 /**
  * UA_DiagnosticInfo wrapper class.
  * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/7.12
@@ -284,4 +345,30 @@ private:
     std::vector<NumericRangeDimension> dimensions_;
 };
 
+/**
+ * Cache of parsed numeric ranges, keyed by their string encoding.
+ *
+ * Each distinct range string is parsed once, e.g. for index ranges used repeatedly in a polling
+ * loop. The returned references stay valid until the cache is cleared. Not thread-safe.
+ */
+class NumericRangeCache {
+public:
+    /// Get the parsed range, parse and insert it on the first call.
+    /// @exception BadStatus If the range can't be parsed (not cached)
+    const NumericRange& get(std::string_view encodedRange);
+
+    /// Number of cached ranges.
+    size_t size() const noexcept {
+        return ranges_.size();
+    }
+
+    /// Remove all cached ranges.
+    void clear() noexcept {
+        ranges_.clear();
+    }
+
+private:
+    std::unordered_map<std::string, NumericRange> ranges_;
+};
+
 }  // namespace opcua
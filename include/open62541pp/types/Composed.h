@@ -1192,6 +1192,46 @@ public:
     UAPP_COMPOSED_GETTER_SPAN(uint32_t, getArrayDimensions, arrayDimensions, arrayDimensionsSize)
 };
 
+/**
+ * UA_CallMethodRequest wrapper class.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.11.2
+ */
+class CallMethodRequest : public TypeWrapper<UA_CallMethodRequest, UA_TYPES_CALLMETHODREQUEST> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    CallMethodRequest(NodeId objectId, NodeId methodId, Span<const Variant> inputArguments = {});
+
+    UAPP_COMPOSED_GETTER_WRAPPER(NodeId, getObjectId, objectId)
+    UAPP_COMPOSED_GETTER_WRAPPER(NodeId, getMethodId, methodId)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        Variant, getInputArguments, inputArguments, inputArgumentsSize
+    )
+};
+
+/**
+ * UA_CallMethodResult wrapper class.
+ * @see https://reference.opcfoundation.org/Core/Part4/v105/docs/5.11.2
+ */
+class CallMethodResult : public TypeWrapper<UA_CallMethodResult, UA_TYPES_CALLMETHODRESULT> {
+public:
+    using TypeWrapperBase::TypeWrapperBase;
+
+    UAPP_COMPOSED_GETTER(StatusCode, getStatusCode, statusCode)
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        StatusCode, getInputArgumentResults, inputArgumentResults, inputArgumentResultsSize
+    )
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        DiagnosticInfo,
+        getInputArgumentDiagnosticInfos,
+        inputArgumentDiagnosticInfos,
+        inputArgumentDiagnosticInfosSize
+    )
+    UAPP_COMPOSED_GETTER_SPAN_WRAPPER(
+        Variant, getOutputArguments, outputArguments, outputArgumentsSize
+    )
+};
+
 #endif
 
 /* ---------------------------------------- Subscriptions --------------------------------------- */
@@ -1417,6 +1457,20 @@ public:
 
     DataChangeFilter(DataChangeTrigger trigger, DeadbandType deadbandType, double deadbandValue);
 
+    /// Create a filter with an absolute deadband, e.g. `0.5` for changes greater than 0.5 units.
+    static DataChangeFilter absoluteDeadband(
+        double deadbandValue, DataChangeTrigger trigger = DataChangeTrigger::StatusValue
+    ) {
+        return {trigger, DeadbandType::Absolute, deadbandValue};
+    }
+
+    /// Create a filter with a percent deadband of the `EURange` property (0.0-100.0).
+    static DataChangeFilter percentDeadband(
+        double deadbandValue, DataChangeTrigger trigger = DataChangeTrigger::StatusValue
+    ) {
+        return {trigger, DeadbandType::Percent, deadbandValue};
+    }
+
     UAPP_COMPOSED_GETTER_CAST(DataChangeTrigger, getTrigger, trigger)
     UAPP_COMPOSED_GETTER_CAST(DeadbandType, getDeadbandType, deadbandType)
     UAPP_COMPOSED_GETTER(double, getDeadbandValue, deadbandValue)
@@ -1455,6 +1509,10 @@ public:
         AggregateConfiguration aggregateConfiguration
     );
 
+    /// Create an aggregate filter with the aggregate configuration defaults of the server.
+    /// @param aggregateType NodeId of the aggregate function, e.g. `AggregateFunction_Average`
+    AggregateFilter(DateTime startTime, NodeId aggregateType, double processingInterval);
+
     UAPP_COMPOSED_GETTER_WRAPPER(DateTime, getStartTime, startTime)
     UAPP_COMPOSED_GETTER_WRAPPER(NodeId, getAggregateType, aggregateType)
     UAPP_COMPOSED_GETTER(double, getProcessingInterval, processingInterval)
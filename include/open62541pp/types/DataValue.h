@@ -52,6 +52,8 @@ public:
     Variant& getValue() noexcept;
     /// Get value.
     const Variant& getValue() const noexcept;
+    /// Move value out of the data value (without copy), the data value has no value afterwards.
+    Variant takeValue() noexcept;
     /// Get source timestamp for the value.
     DateTime getSourceTimestamp() const noexcept;
     /// Get server timestamp for the value.
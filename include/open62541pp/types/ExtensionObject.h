@@ -1,8 +1,12 @@
 #pragma once
 
+#include <cstddef>
 #include <optional>
 
 #include "open62541pp/Common.h"  // isBuiltinType
+#include "open62541pp/Config.h"
+#include "open62541pp/DataType.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/TypeConverter.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/open62541.h"
@@ -11,7 +15,9 @@ namespace opcua {
 
 // forward declarations
 class ByteString;
+class DataTypeRegistry;
 class NodeId;
+class Variant;
 
 /**
  * Extension object encoding.
@@ -103,6 +109,70 @@ public:
     /// @copydoc getDecodedData
     const void* getDecodedData() const noexcept;
 
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    /**
+     * Decode the binary encoded body with the given data type on first access (lazy decoding).
+     *
+     * Bodies of data types unknown to the decoder (e.g. custom data types that are not registered
+     * with Client::setCustomDataTypes) are kept encoded when received. The body is decoded in
+     * place, so the ExtensionObject caches the decoded data and following calls return it
+     * without decoding again.
+     *
+     * @param type Data type of the body, must outlive the ExtensionObject
+     * @param customTypes Custom data types referenced by the body
+     * @return Pointer to the decoded data, `nullptr` if the ExtensionObject is empty or holds
+     *         another data type
+     * @exception BadStatus (BadDecodingError) If the body can't be decoded
+     * @note Only available with open62541 >= v1.3
+     */
+    void* decode(const UA_DataType& type, Span<const DataType> customTypes = {});
+
+    /**
+     * Decode the binary encoded body with the data type of its encoded type id (lazy decoding).
+     *
+     * The data type is looked up by the binary encoding id in the registry (including the parent
+     * registries) and in the builtin data types, both with constant time hash lookups.
+     *
+     * @param registry Custom data types, must outlive the ExtensionObject
+     * @return Pointer to the decoded data, `nullptr` if the ExtensionObject is empty or the data
+     *         type is unknown
+     * @exception BadStatus (BadDecodingError) If the body can't be decoded
+     * @note Only available with open62541 >= v1.3
+     */
+    void* decode(const DataTypeRegistry& registry);
+
+    /// Decode with the data type of `T` on first access and return the cached decoded data.
+    /// @copydetails decode
+    template <typename T>
+    T* decodedAs(
+        const UA_DataType& type = detail::guessDataType<T>(), Span<const DataType> customTypes = {}
+    ) {
+        return static_cast<T*>(decode(type, customTypes));
+    }
+
+    /**
+     * Decode a single member of a structure without decoding the other members.
+     *
+     * If the body is still encoded, the member is decoded directly from the encoded body.
+     * Preceding members are skipped: fixed-size members by their size, strings and byte strings
+     * by their length prefix and nested structures member-wise. Other members (e.g. variants) are
+     * decoded and discarded. If the ExtensionObject is already decoded, the member is copied.
+     *
+     * @param type Structure data type of the body, e.g. created with DataTypeBuilder
+     * @param memberIndex Index of the member
+     * @param customTypes Custom data types referenced by the body
+     * @return Variant with the member (scalar or array)
+     * @exception BadStatus (BadTypeMismatch) If the ExtensionObject holds another data type
+     * @exception BadStatus (BadNotSupported) If the data type is not a plain structure
+     * @exception BadStatus (BadIndexRangeInvalid) If the member index is out of range
+     * @exception BadStatus (BadDecodingError) If the body can't be decoded
+     * @note Only available with open62541 >= v1.3
+     */
+    Variant decodeMember(
+        const UA_DataType& type, size_t memberIndex, Span<const DataType> customTypes = {}
+    ) const;
+#endif
+
 private:
     template <typename T>
     static constexpr void assertDecodedType() {
@@ -5,6 +5,8 @@
 #include <functional>  // hash
 #include <string>
 #include <string_view>
+#include <type_traits>  // enable_if_t, is_same_v
+#include <utility>  // move
 #include <variant>
 
 #include "open62541pp/Common.h"  // Type
@@ -122,6 +124,115 @@ public:
     std::string toString() const;
 };
 
+/**
+ * Compile-time numeric NodeId.
+ *
+ * Literal type that can be created in constant expressions and stored as `static constexpr`,
+ * e.g. for frequently used node ids of namespace 0. It implicitly converts to `const NodeId&`
+ * without a copy (numeric node ids don't own memory).
+ *
+ * @code
+ * static constexpr opcua::NumericNodeId objectsFolder(opcua::ObjectId::ObjectsFolder);
+ * services::browse(server, {objectsFolder, opcua::BrowseDirection::Forward});
+ * @endcode
+ */
+class NumericNodeId {
+public:
+    constexpr NumericNodeId(uint16_t namespaceIndex, uint32_t identifier) noexcept
+        : native_{namespaceIndex, UA_NODEIDTYPE_NUMERIC, {identifier}} {}
+
+    /// Create NumericNodeId from one of the node id enums of namespace 0 (e.g. ObjectId).
+    template <
+        typename NodeIdEnum,
+        typename = std::enable_if_t<
+            std::is_same_v<NodeIdEnum, DataTypeId> || std::is_same_v<NodeIdEnum, ReferenceTypeId> ||
+            std::is_same_v<NodeIdEnum, ObjectTypeId> ||
+            std::is_same_v<NodeIdEnum, VariableTypeId> || std::is_same_v<NodeIdEnum, ObjectId> ||
+            std::is_same_v<NodeIdEnum, VariableId> || std::is_same_v<NodeIdEnum, MethodId>>>
+    constexpr NumericNodeId(NodeIdEnum id) noexcept  // NOLINT, implicit wanted
+        : NumericNodeId(0, static_cast<uint32_t>(id)) {}
+
+    constexpr uint16_t getNamespaceIndex() const noexcept {
+        return native_.namespaceIndex;
+    }
+
+    constexpr uint32_t getIdentifier() const noexcept {
+        return native_.identifier.numeric;
+    }
+
+    const UA_NodeId* handle() const noexcept {
+        return &native_;
+    }
+
+    const NodeId& get() const noexcept {
+        return asWrapper<NodeId>(native_);
+    }
+
+    operator const NodeId&() const noexcept {  // NOLINT, implicit wanted
+        return get();
+    }
+
+    operator const UA_NodeId&() const noexcept {  // NOLINT, implicit wanted
+        return native_;
+    }
+
+private:
+    UA_NodeId native_;
+};
+
+constexpr bool operator==(NumericNodeId lhs, NumericNodeId rhs) noexcept {
+    return lhs.getNamespaceIndex() == rhs.getNamespaceIndex() &&
+           lhs.getIdentifier() == rhs.getIdentifier();
+}
+
+constexpr bool operator!=(NumericNodeId lhs, NumericNodeId rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+/**
+ * NodeId with precomputed hash.
+ *
+ * The hash is computed once at construction, which is useful for keys of hash maps and sets that
+ * are looked up frequently, especially for string, guid and bytestring node ids.
+ * The hash is equal to NodeId::hash.
+ */
+class HashedNodeId {
+public:
+    HashedNodeId() = default;
+
+    HashedNodeId(NodeId id) noexcept  // NOLINT, implicit wanted
+        : id_(std::move(id)),
+          hash_(id_.hash()) {}
+
+    const NodeId& get() const noexcept {
+        return id_;
+    }
+
+    operator const NodeId&() const noexcept {  // NOLINT, implicit wanted
+        return id_;
+    }
+
+    const NodeId* operator->() const noexcept {
+        return &id_;
+    }
+
+    uint32_t hash() const noexcept {
+        return hash_;
+    }
+
+private:
+    NodeId id_;
+    uint32_t hash_{NodeId().hash()};
+};
+
+inline bool operator==(const HashedNodeId& lhs, const HashedNodeId& rhs) noexcept {
+    return lhs.hash() == rhs.hash() && UA_NodeId_equal(lhs->handle(), rhs->handle());
+}
+
+inline bool operator!=(const HashedNodeId& lhs, const HashedNodeId& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
 /**
  * UA_ExpandedNodeId wrapper class.
  * @ingroup TypeWrapper
@@ -161,6 +272,20 @@ struct std::hash<opcua::NodeId> {
     }
 };
 
+template <>
+struct std::hash<opcua::NumericNodeId> {
+    std::size_t operator()(const opcua::NumericNodeId& id) const noexcept {
+        return id.get().hash();
+    }
+};
+
+template <>
+struct std::hash<opcua::HashedNodeId> {
+    std::size_t operator()(const opcua::HashedNodeId& id) const noexcept {
+        return id.hash();
+    }
+};
+
 template <>
 struct std::hash<opcua::ExpandedNodeId> {
     std::size_t operator()(const opcua::ExpandedNodeId& id) const noexcept {
@@ -1,21 +1,31 @@
 #pragma once
 
+#include <array>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
 #include <iterator>  // distance
 #include <optional>
+#include <string_view>
 #include <type_traits>  // enable_if
-#include <utility>  // as_const
+#include <utility>  // as_const, exchange, pair
 #include <vector>
 
+#include "open62541pp/ArrayView.h"
 #include "open62541pp/Common.h"
+#include "open62541pp/Config.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Span.h"
+#include "open62541pp/StringArrayView.h"
 #include "open62541pp/TypeConverter.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/numeric.h"
 #include "open62541pp/open62541.h"
 
+#ifdef UAPP_HAS_PMR
+#include <memory_resource>
+#endif
+
 namespace opcua {
 
 // forward declarations
@@ -151,11 +161,93 @@ public:
     template <typename T>
     Span<const T> getArray() const;
 
+    /**
+     * Get a view of a sub-array with given template type (only native or wrapper types).
+     *
+     * The range must select a contiguous block of the (row-major) array: a single index in the
+     * leading dimensions, any range in one dimension and the full extent of the remaining
+     * dimensions, e.g. `2:5` of a vector or `1,0:3` (a row) of a 2x4 matrix. Ranges exceeding the
+     * array are truncated. Use @ref copyRange for other ranges.
+     * @exception BadVariantAccess If the variant is not an array or not of type `T`.
+     * @exception BadStatus (BadIndexRangeInvalid) If the range is invalid or not contiguous
+     * @exception BadStatus (BadIndexRangeNoData) If the range is out of the array bounds
+     */
+    template <typename T>
+    Span<T> getArrayRange(const NumericRange& range);
+
+    /// @copydoc getArrayRange
+    template <typename T>
+    Span<const T> getArrayRange(const NumericRange& range) const;
+
+    /**
+     * Get a multi-dimensional view of the array with given template type (only native or wrapper
+     * types).
+     *
+     * The extents are taken from the array dimensions, one-dimensional arrays without array
+     * dimensions can be viewed with rank 1. The elements are not copied.
+     * @exception BadVariantAccess If the variant is not an array or not of type `T`.
+     * @exception BadVariantAccess If the array dimensions don't match the rank or array length.
+     */
+    template <typename T, size_t Rank>
+    ArrayView<T, Rank> getArrayView();
+
+    /// @copydoc getArrayView
+    template <typename T, size_t Rank>
+    ArrayView<const T, Rank> getArrayView() const;
+
+    /**
+     * Get a view of a string array with `std::string_view` elements.
+     *
+     * Neither the strings nor the characters are copied, use it instead of
+     * `getArrayCopy<std::string>()` to inspect or compare strings. The view is invalidated if the
+     * variant is modified or destroyed.
+     * @exception BadVariantAccess If the variant is not an array or not of type `String`.
+     */
+    template <typename T, typename = std::enable_if_t<std::is_same_v<T, std::string_view>>>
+    StringArrayView getArrayView() const;
+
+    /// Copy a sub-array or sub-string selected by a numeric range (any range).
+    /// @exception BadStatus If the range is invalid or out of bounds
+    Variant copyRange(const NumericRange& range) const;
+
     /// Get copy of array with given template type and return it as a std::vector.
     /// @exception BadVariantAccess If the variant is not an array or not convertible to `T`.
     template <typename T>
     std::vector<T> getArrayCopy() const;
 
+#ifdef UAPP_HAS_PMR
+    /// Get copy of array with given template type and return it as a std::pmr::vector.
+    /// The vector storage is allocated from `resource`, e.g. a per-cycle
+    /// `std::pmr::monotonic_buffer_resource`. Memory owned by the elements (e.g. the characters of
+    /// `std::string`) is allocated as usual.
+    /// @exception BadVariantAccess If the variant is not an array or not convertible to `T`.
+    template <typename T>
+    std::pmr::vector<T> getArrayCopy(std::pmr::memory_resource* resource) const;
+#endif
+
+    /// Move scalar value out of the variant with given template type, the variant is cleared.
+    /// Native and wrapper types are moved without copy if the variant owns the data.
+    /// @exception BadVariantAccess If the variant is not a scalar or not convertible to `T`.
+    template <typename T>
+    T takeScalar();
+
+    /// Move array out of the variant with given template type, the variant is cleared.
+    /// Native and wrapper types are moved without copy if the variant owns the data.
+    /// @exception BadVariantAccess If the variant is not an array or not convertible to `T`.
+    template <typename T>
+    std::vector<T> takeArray();
+
+    /**
+     * Convert numeric array to numeric type `T` and write it to the output span (no allocation).
+     * The values are converted as `input * scale + offset` and saturated to the range of `T`.
+     * @param output Output span, the size must match the array length
+     * @param scale Scaling factor
+     * @param offset Offset (added after scaling)
+     * @exception BadVariantAccess If the variant is not a numeric array or the sizes don't match
+     */
+    template <typename T>
+    void getArrayAs(Span<T> output, double scale = 1.0, double offset = 0.0) const;
+
     /// Assign scalar value to variant.
     template <typename T>
     void setScalar(T& value) noexcept;
@@ -192,6 +284,16 @@ public:
         setArray(Span{std::forward<ArrayLike>(array)}, dataType);
     }
 
+    /**
+     * Assign multi-dimensional array to variant.
+     * Neither the elements nor the dimensions are copied, both must outlive the variant.
+     * @param array Elements in row-major order
+     * @param dimensions Array dimensions, the product must match the number of elements
+     * @exception BadStatus (BadInvalidArgument) If the dimensions don't match the array length
+     */
+    template <typename T>
+    void setArray(Span<T> array, Span<const uint32_t> dimensions);
+
     /// Copy array to variant.
     template <typename T>
     void setArrayCopy(Span<T> array);
@@ -212,10 +314,31 @@ public:
         setArrayCopy(Span{std::forward<ArrayLike>(array)}, dataType);
     }
 
+    /// Copy multi-dimensional array with its dimensions to variant.
+    /// @exception BadStatus (BadInvalidArgument) If the dimensions don't match the array length
+    template <typename T>
+    void setArrayCopy(Span<T> array, Span<const uint32_t> dimensions);
+
     /// Copy range of elements as array to variant.
     template <typename InputIt>
     void setArrayCopy(InputIt first, InputIt last);
 
+    /**
+     * Convert numeric array to the numeric builtin type `T` and copy it to variant.
+     * The values are converted as `input * scale + offset` and saturated to the range of `T`.
+     * @param array Numeric input array
+     * @param scale Scaling factor
+     * @param offset Offset (added after scaling)
+     */
+    template <typename T, typename U>
+    void setArrayAs(Span<U> array, double scale = 1.0, double offset = 0.0);
+
+    /// @overload
+    template <typename T, typename ArrayLike, typename = EnableIfNoSpan<ArrayLike>>
+    void setArrayAs(ArrayLike&& array, double scale = 1.0, double offset = 0.0) {
+        setArrayAs<T>(Span{std::forward<ArrayLike>(array)}, scale, offset);
+    }
+
 private:
     template <typename T>
     static constexpr bool isConvertibleToNative() {
@@ -250,6 +373,36 @@ private:
     void checkIsScalar() const;
     void checkIsArray() const;
 
+    template <size_t Rank>
+    std::array<size_t, Rank> getArrayExtents() const {
+        std::array<size_t, Rank> extents{};
+        const auto dimensions = getArrayDimensions();
+        if (dimensions.empty() && Rank == 1) {
+            extents[0] = getArrayLength();
+            return extents;
+        }
+        if (dimensions.size() != Rank) {
+            throw BadVariantAccess("Variant array dimensions don't match the rank");
+        }
+        size_t size = 1;
+        for (size_t i = 0; i < Rank; ++i) {
+            extents[i] = dimensions[i];
+            size *= extents[i];
+        }
+        if (size != getArrayLength()) {
+            throw BadVariantAccess("Variant array dimensions don't match the array length");
+        }
+        return extents;
+    }
+
+    /// Set array dimensions after the array was assigned, validated before by the caller.
+    void setArrayDimensionsImpl(Span<const uint32_t> dimensions, bool copy);
+
+    static void checkArrayDimensions(size_t size, Span<const uint32_t> dimensions);
+
+    /// Offset and length of a contiguous range of the array.
+    std::pair<size_t, size_t> getContiguousRange(const NumericRange& range) const;
+
     template <typename T>
     inline static void checkDataType([[maybe_unused]] const UA_DataType& dataType) {
         assert(sizeof(T) == dataType.memSize);
@@ -380,6 +533,37 @@ Span<const T> Variant::getArray() const {
     return {static_cast<const T*>(handle()->data), handle()->arrayLength};
 }
 
+template <typename T>
+Span<T> Variant::getArrayRange(const NumericRange& range) {
+    const auto view = std::as_const(*this).getArrayRange<T>(range);
+    return {const_cast<T*>(view.data()), view.size()};  // NOLINT, avoid code duplication
+}
+
+template <typename T>
+Span<const T> Variant::getArrayRange(const NumericRange& range) const {
+    const auto array = getArray<T>();
+    const auto [offset, length] = getContiguousRange(range);
+    return array.subview(offset, length);
+}
+
+template <typename T, size_t Rank>
+ArrayView<T, Rank> Variant::getArrayView() {
+    const auto array = getArray<T>();
+    return {array.data(), getArrayExtents<Rank>()};
+}
+
+template <typename T, size_t Rank>
+ArrayView<const T, Rank> Variant::getArrayView() const {
+    const auto array = getArray<T>();
+    return {array.data(), getArrayExtents<Rank>()};
+}
+
+template <typename T, typename>
+StringArrayView Variant::getArrayView() const {
+    const auto array = getArray<UA_String>();
+    return {array.data(), array.size()};
+}
+
 template <typename T>
 std::vector<T> Variant::getArrayCopy() const {
     checkIsArray();
@@ -387,6 +571,80 @@ std::vector<T> Variant::getArrayCopy() const {
     return detail::fromNativeArray<T>(handle()->data, handle()->arrayLength, *getDataType());
 }
 
+#ifdef UAPP_HAS_PMR
+template <typename T>
+std::pmr::vector<T> Variant::getArrayCopy(std::pmr::memory_resource* resource) const {
+    checkIsArray();
+    checkReturnType<T>();
+    return detail::fromNativeArray<T>(
+        handle()->data,
+        handle()->arrayLength,
+        *getDataType(),
+        std::pmr::polymorphic_allocator<T>(resource)
+    );
+}
+#endif
+
+template <typename T>
+T Variant::takeScalar() {
+    checkIsScalar();
+    checkReturnType<T>();
+    if constexpr (isConvertibleToNative<T>()) {
+        if (handle()->storageType == UA_VARIANT_DATA) {
+            checkDataType<T>(*getDataType());
+            T result = std::exchange(*static_cast<T*>(handle()->data), T{});
+            clear();
+            return result;
+        }
+    }
+    T result = detail::fromNative<T>(handle()->data, *getDataType());
+    clear();
+    return result;
+}
+
+template <typename T>
+std::vector<T> Variant::takeArray() {
+    checkIsArray();
+    checkReturnType<T>();
+    if constexpr (isConvertibleToNative<T>()) {
+        if (handle()->storageType == UA_VARIANT_DATA) {
+            checkDataType<T>(*getDataType());
+            auto* array = static_cast<T*>(handle()->data);
+            std::vector<T> result;
+            result.reserve(handle()->arrayLength);
+            for (size_t i = 0; i < handle()->arrayLength; ++i) {
+                result.push_back(std::exchange(array[i], T{}));  // NOLINT
+            }
+            clear();
+            return result;
+        }
+    }
+    auto result =
+        detail::fromNativeArray<T>(handle()->data, handle()->arrayLength, *getDataType());
+    clear();
+    return result;
+}
+
+template <typename T>
+void Variant::getArrayAs(Span<T> output, double scale, double offset) const {
+    static_assert(detail::isNumericType<T>, "Template type must be a numeric type");
+    checkIsArray();
+    if (output.size() != getArrayLength()) {
+        throw BadVariantAccess("Output size does not match the array length");
+    }
+    const bool scaled = scale != 1.0 || offset != 0.0;
+    const bool numeric = detail::visitNumericArray(data(), getDataType(), [&](const auto* input) {
+        if (scaled) {
+            detail::convertNumericArray(input, output.data(), output.size(), scale, offset);
+        } else {
+            detail::convertNumericArray(input, output.data(), output.size());
+        }
+    });
+    if (!numeric) {
+        throw BadVariantAccess("Variant does not contain a numeric array");
+    }
+}
+
 template <typename T>
 void Variant::setScalar(T& value) noexcept {
     assertSetNoCopy<T>();
@@ -430,10 +688,17 @@ void Variant::setArray(Span<T> array, const UA_DataType& dataType) noexcept {
     setArrayImpl(array.data(), array.size(), dataType);
 }
 
+template <typename T>
+void Variant::setArray(Span<T> array, Span<const uint32_t> dimensions) {
+    checkArrayDimensions(array.size(), dimensions);
+    setArray(array);
+    setArrayDimensionsImpl(dimensions, false);
+}
+
 template <typename T>
 void Variant::setArrayCopy(Span<T> array) {
     assertNoVariant<T>();
-    if constexpr (detail::isBuiltinType<T>) {
+    if constexpr (detail::isBuiltinType<T> || detail::isTriviallyMappable<T>) {
         setArrayCopyImpl(array.data(), array.size(), detail::guessDataType<T>());
     } else {
         setArrayCopy(array.begin(), array.end());
@@ -447,6 +712,13 @@ void Variant::setArrayCopy(Span<T> array, const UA_DataType& dataType) {
     setArrayCopyImpl(array.data(), array.size(), dataType);
 }
 
+template <typename T>
+void Variant::setArrayCopy(Span<T> array, Span<const uint32_t> dimensions) {
+    checkArrayDimensions(array.size(), dimensions);
+    setArrayCopy(array);
+    setArrayDimensionsImpl(dimensions, true);
+}
+
 template <typename InputIt>
 void Variant::setArrayCopy(InputIt first, InputIt last) {
     using ValueType = typename std::iterator_traits<InputIt>::value_type;
@@ -459,4 +731,21 @@ void Variant::setArrayCopy(InputIt first, InputIt last) {
     );
 }
 
+template <typename T, typename U>
+void Variant::setArrayAs(Span<U> array, double scale, double offset) {
+    static_assert(
+        detail::isNumericType<T> && detail::isBuiltinType<T>,
+        "Template type must be a numeric builtin type"
+    );
+    static_assert(detail::isNumericType<std::remove_const_t<U>>, "Input must be a numeric array");
+    const auto& dataType = detail::guessDataType<T>();
+    auto* native = detail::allocNativeArray<T>(array.size(), dataType);
+    if (scale != 1.0 || offset != 0.0) {
+        detail::convertNumericArray(array.data(), native, array.size(), scale, offset);
+    } else {
+        detail::convertNumericArray(array.data(), native, array.size());
+    }
+    setArrayImpl(native, array.size(), dataType, true);  // move ownership
+}
+
 }  // namespace opcua
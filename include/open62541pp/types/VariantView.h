@@ -0,0 +1,132 @@
+#pragma once
+
+#include <memory>
+#include <string_view>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/TypeConverter.h"  // guessDataType
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/open62541.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua {
+
+/**
+ * Non-owning Variant over a contiguous, user-owned array.
+ *
+ * The view references the array without copying it (storage type `UA_VARIANT_DATA_NODELETE`).
+ * Views created from a `std::shared_ptr` keep the array alive as long as the view or any copy of
+ * it exists. Copies of the view are shallow as well.
+ *
+ * Pass the view with @ref get to functions expecting a `const Variant&` (e.g.
+ * services::writeValue). Use @ref borrow to move a non-owning Variant into a DataValue, e.g. in
+ * the read callback of a data source -- the view must outlive the DataValue in this case.
+ *
+ * Only native or wrapper types are allowed, other types would require a conversion (copy).
+ * Arrays of `std::string_view` are the exception: the view owns an array of `UA_String` headers
+ * referencing the characters of the strings, the characters are not copied.
+ */
+class VariantView {
+public:
+    VariantView() = default;
+
+    /// Create view over an array. The caller has to guarantee that the array outlives the view.
+    template <typename T>
+    explicit VariantView(Span<const T> array)
+        : VariantView(array, detail::guessDataType<T>()) {}
+
+    /// Create view over an array with custom data type.
+    /// The caller has to guarantee that the array outlives the view.
+    template <typename T>
+    VariantView(Span<const T> array, const UA_DataType& dataType) {
+        static_assert(
+            detail::isNativeType<T> || detail::isTypeWrapper<T>,
+            "Template type must be a native or wrapper type to create a view"
+        );
+        // NOLINTNEXTLINE, variant is never modified
+        variant_.setArray(Span<T>(const_cast<T*>(array.data()), array.size()), dataType);
+    }
+
+    /// Create view over an array of strings. The characters are not copied, the caller has to
+    /// guarantee that the strings outlive the view.
+    explicit VariantView(Span<const std::string_view> array) {
+        auto headers = std::make_shared<std::vector<UA_String>>(array.size());
+        for (size_t i = 0; i < array.size(); ++i) {
+            auto& header = (*headers)[i];
+            header.length = array[i].size();
+            header.data = (UA_Byte*)array[i].data();  // NOLINT, variant is never modified
+        }
+        variant_.setArray(Span<UA_String>(*headers), UA_TYPES[UA_TYPES_STRING]);
+        keepAlive_ = std::move(headers);
+    }
+
+    /// Create view over a shared array and keep it alive.
+    template <typename T>
+    explicit VariantView(std::shared_ptr<const std::vector<T>> array)
+        : VariantView(Span<const T>(*array)) {
+        keepAlive_ = std::move(array);
+    }
+
+    /// Create view over a shared array with custom data type and keep it alive.
+    template <typename T>
+    VariantView(std::shared_ptr<const std::vector<T>> array, const UA_DataType& dataType)
+        : VariantView(Span<const T>(*array), dataType) {
+        keepAlive_ = std::move(array);
+    }
+
+    VariantView(const VariantView& other) noexcept
+        : keepAlive_(other.keepAlive_) {
+        shallowCopy(other);
+    }
+
+    VariantView(VariantView&& other) noexcept = default;
+
+    VariantView& operator=(const VariantView& other) noexcept {
+        if (this != &other) {
+            keepAlive_ = other.keepAlive_;
+            shallowCopy(other);
+        }
+        return *this;
+    }
+
+    VariantView& operator=(VariantView&& other) noexcept = default;
+
+    ~VariantView() = default;
+
+    /// Get the non-owning variant.
+    const Variant& get() const noexcept {
+        return variant_;
+    }
+
+    const Variant* operator->() const noexcept {
+        return &variant_;
+    }
+
+    /// Get a shallow, non-owning copy of the variant.
+    /// The view (or the array) must outlive the returned variant.
+    Variant borrow() const noexcept {
+        Variant variant;
+        *variant.handle() = *variant_.handle();  // shallow copy
+        variant->storageType = UA_VARIANT_DATA_NODELETE;
+        return variant;
+    }
+
+    /// Get the keep-alive handle of the referenced array (`nullptr` if the view is not shared).
+    const std::shared_ptr<const void>& getKeepAlive() const noexcept {
+        return keepAlive_;
+    }
+
+private:
+    void shallowCopy(const VariantView& other) noexcept {
+        variant_.clear();
+        *variant_.handle() = *other.variant_.handle();
+        variant_->storageType = UA_VARIANT_DATA_NODELETE;
+    }
+
+    std::shared_ptr<const void> keepAlive_;
+    Variant variant_;
+};
+
+}  // namespace opcua
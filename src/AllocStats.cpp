@@ -0,0 +1,224 @@
+#include "open62541pp/AllocStats.h"
+
+#ifdef UAPP_ENABLE_ALLOC_STATS
+
+#include <atomic>
+#include <cstdlib>  // malloc, free, calloc, realloc
+#include <mutex>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/detail/helper.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+/// Counters of a thread, written by the owning thread only and read by any thread.
+struct Counters {
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> reallocations{0};
+    std::atomic<uint64_t> deallocations{0};
+    std::atomic<uint64_t> allocatedBytes{0};
+    std::atomic<uint64_t> deepCopies{0};
+
+    AllocStats load() const noexcept {
+        return {
+            allocations.load(std::memory_order_relaxed),
+            reallocations.load(std::memory_order_relaxed),
+            deallocations.load(std::memory_order_relaxed),
+            allocatedBytes.load(std::memory_order_relaxed),
+            deepCopies.load(std::memory_order_relaxed),
+        };
+    }
+};
+
+struct Registry {
+    std::mutex mutex;
+    std::vector<const Counters*> threads;
+    Counters exited;  // counters of exited threads, updated with fetch_add
+};
+
+Registry& getRegistry() {
+    // never destroyed, allocations are counted until the process exits
+    static auto* registry = new Registry;  // NOLINT
+    return *registry;
+}
+
+void add(std::atomic<uint64_t>& counter, uint64_t value, bool shared) noexcept {
+    if (shared) {
+        counter.fetch_add(value, std::memory_order_relaxed);
+    } else {
+        // single writer, a plain load/store is sufficient and avoids the locked instruction
+        counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+    }
+}
+
+void merge(Counters& dst, const AllocStats& src) noexcept {
+    add(dst.allocations, src.allocations, true);
+    add(dst.reallocations, src.reallocations, true);
+    add(dst.deallocations, src.deallocations, true);
+    add(dst.allocatedBytes, src.allocatedBytes, true);
+    add(dst.deepCopies, src.deepCopies, true);
+}
+
+thread_local bool threadExited = false;  // NOLINT, trivially destructible, valid until exit
+
+class ThreadCounters {
+public:
+    ThreadCounters() {
+        auto& registry = getRegistry();
+        const std::lock_guard lock(registry.mutex);
+        registry.threads.push_back(&counters);
+    }
+
+    ~ThreadCounters() {
+        threadExited = true;
+        auto& registry = getRegistry();
+        const std::lock_guard lock(registry.mutex);
+        merge(registry.exited, counters.load());
+        auto& threads = registry.threads;
+        for (auto it = threads.begin(); it != threads.end(); ++it) {
+            if (*it == &counters) {
+                threads.erase(it);
+                break;
+            }
+        }
+    }
+
+    ThreadCounters(const ThreadCounters&) = delete;
+    ThreadCounters(ThreadCounters&&) noexcept = delete;
+    ThreadCounters& operator=(const ThreadCounters&) = delete;
+    ThreadCounters& operator=(ThreadCounters&&) noexcept = delete;
+
+    Counters counters;
+};
+
+/// Get the counters of the current thread, the shared counters during/after thread exit.
+/// The second value indicates if the counters are shared.
+std::pair<Counters*, bool> getCounters() noexcept {
+    if (threadExited) {
+        return {&getRegistry().exited, true};
+    }
+    thread_local ThreadCounters local;
+    return {&local.counters, false};
+}
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+struct AllocatorHooks {
+    void* (*mallocFn)(size_t size);
+    void (*freeFn)(void* ptr);
+    void* (*callocFn)(size_t nelem, size_t elsize);
+    void* (*reallocFn)(void* ptr, size_t size);
+};
+
+// the allocator hooks of open62541 are thread-local, so are the hooks to forward to
+thread_local AllocatorHooks previousHooks{std::malloc, std::free, std::calloc, std::realloc};
+
+void recordAllocation(size_t size, bool reallocation) noexcept {
+    auto [counters, shared] = getCounters();
+    add(reallocation ? counters->reallocations : counters->allocations, 1, shared);
+    add(counters->allocatedBytes, size, shared);
+}
+
+void* countingMalloc(size_t size) {
+    recordAllocation(size, false);
+    return previousHooks.mallocFn(size);
+}
+
+void countingFree(void* ptr) {
+    if (ptr != nullptr) {
+        auto [counters, shared] = getCounters();
+        add(counters->deallocations, 1, shared);
+    }
+    previousHooks.freeFn(ptr);
+}
+
+void* countingCalloc(size_t nelem, size_t elsize) {
+    recordAllocation(nelem * elsize, false);
+    return previousHooks.callocFn(nelem, elsize);
+}
+
+void* countingRealloc(void* ptr, size_t size) {
+    recordAllocation(size, ptr != nullptr);
+    return previousHooks.reallocFn(ptr, size);
+}
+
+bool installHooks() noexcept {
+    if (UA_mallocSingleton == countingMalloc) {
+        return true;  // installed for this thread
+    }
+    previousHooks = {
+        UA_mallocSingleton, UA_freeSingleton, UA_callocSingleton, UA_reallocSingleton
+    };
+    UA_mallocSingleton = countingMalloc;
+    UA_freeSingleton = countingFree;
+    UA_callocSingleton = countingCalloc;
+    UA_reallocSingleton = countingRealloc;
+    return true;
+}
+
+// install for the initializing thread with static initialization, before open62541 allocates
+// memory for clients/servers; other threads install the hooks with enableAllocCounting
+const bool hooksInstalled = installHooks();  // NOLINT
+#endif
+
+}  // namespace
+
+AllocStats operator-(const AllocStats& lhs, const AllocStats& rhs) noexcept {
+    return {
+        lhs.allocations - rhs.allocations,
+        lhs.reallocations - rhs.reallocations,
+        lhs.deallocations - rhs.deallocations,
+        lhs.allocatedBytes - rhs.allocatedBytes,
+        lhs.deepCopies - rhs.deepCopies,
+    };
+}
+
+AllocStats getThreadAllocStats() noexcept {
+    return getCounters().first->load();
+}
+
+AllocStats getAllocStats() noexcept {
+    auto& registry = getRegistry();
+    const std::lock_guard lock(registry.mutex);
+    AllocStats result = registry.exited.load();
+    for (const auto* counters : registry.threads) {
+        const auto stats = counters->load();
+        result.allocations += stats.allocations;
+        result.reallocations += stats.reallocations;
+        result.deallocations += stats.deallocations;
+        result.allocatedBytes += stats.allocatedBytes;
+        result.deepCopies += stats.deepCopies;
+    }
+    return result;
+}
+
+void enableAllocCounting() noexcept {
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+    installHooks();
+#endif
+}
+
+bool isAllocCountingEnabled() noexcept {
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+    return hooksInstalled && UA_mallocSingleton == countingMalloc;
+#else
+    return false;
+#endif
+}
+
+namespace detail {
+
+void recordDeepCopy() noexcept {
+    auto [counters, shared] = getCounters();
+    add(counters->deepCopies, 1, shared);
+}
+
+}  // namespace detail
+
+}  // namespace opcua
+
+#endif
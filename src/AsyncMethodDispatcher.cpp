@@ -0,0 +1,166 @@
+#include "AsyncMethodDispatcher.h"
+
+#ifdef UAPP_ASYNC_METHODS
+
+#include <chrono>
+#include <unordered_map>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/types/Variant.h"
+
+#include "ServerContext.h"
+
+namespace opcua {
+
+// The notify callback of the server config has no context, map the servers to their dispatchers.
+static std::mutex registryMutex;  // NOLINT
+static std::unordered_map<UA_Server*, AsyncMethodDispatcher*> registry;  // NOLINT
+
+static void notifyCallback(UA_Server* server) {
+    const std::lock_guard lock(registryMutex);
+    const auto it = registry.find(server);
+    if (it != registry.end()) {
+        it->second->notify();
+    }
+}
+
+AsyncMethodDispatcher::AsyncMethodDispatcher(
+    UA_Server* server, size_t threadCount, ThreadConfig threadConfig
+)
+    : server_(server),
+      threadCount_(threadCount == 0 ? 1 : threadCount),
+      threadConfig_(std::move(threadConfig)) {}
+
+AsyncMethodDispatcher::~AsyncMethodDispatcher() {
+    stop();
+}
+
+void AsyncMethodDispatcher::start() {
+    {
+        const std::lock_guard lock(registryMutex);
+        registry[server_] = this;
+    }
+    UA_Server_getConfig(server_)->asyncOperationNotifyCallback = notifyCallback;
+    running_ = true;
+    for (size_t i = 0; i < threadCount_; ++i) {
+        threads_.emplace_back([this, i] {
+            applyThreadConfig(threadConfig_, i);
+            run();
+        });
+    }
+}
+
+void AsyncMethodDispatcher::stop() noexcept {
+    {
+        const std::lock_guard lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    threads_.clear();
+    const std::lock_guard lock(serverMutex_);
+    if (server_ != nullptr) {
+        const std::lock_guard registryLock(registryMutex);
+        registry.erase(server_);
+        UA_Server_getConfig(server_)->asyncOperationNotifyCallback = nullptr;
+        server_ = nullptr;
+    }
+}
+
+void AsyncMethodDispatcher::notify() noexcept {
+    {
+        const std::lock_guard lock(mutex_);
+        pending_ = true;
+    }
+    cv_.notify_one();
+}
+
+void AsyncMethodDispatcher::setResult(
+    void* context, UA_StatusCode status, Span<const Variant> output
+) noexcept {
+    const std::lock_guard lock(serverMutex_);
+    if (server_ == nullptr) {
+        return;  // server already stopped
+    }
+    UA_AsyncOperationResponse response{};
+    response.callMethodResult.statusCode = status;
+    if (status == UA_STATUSCODE_GOOD) {
+        // the response is copied by the server
+        response.callMethodResult.outputArgumentsSize = output.size();
+        response.callMethodResult.outputArguments = const_cast<UA_Variant*>(  // NOLINT
+            asNative(output.data())
+        );
+    }
+    UA_Server_setAsyncOperationResult(server_, &response, context);
+}
+
+void AsyncMethodDispatcher::run() {
+    std::unique_lock lock(mutex_);
+    while (running_) {
+        // poll periodically in case of operations queued before the notify callback was set
+        cv_.wait_for(lock, std::chrono::milliseconds(100), [this] {
+            return pending_ || !running_;
+        });
+        if (!running_) {
+            break;
+        }
+        pending_ = false;
+        lock.unlock();
+        UA_AsyncOperationType type{};
+        const UA_AsyncOperationRequest* request = nullptr;
+        void* context = nullptr;
+        while (UA_Server_getAsyncOperationNonBlocking(server_, &type, &request, &context, nullptr)
+        ) {
+            if (type == UA_ASYNCOPERATIONTYPE_CALL) {
+                dispatch(request->callMethodRequest, context);
+            }
+        }
+        lock.lock();
+    }
+}
+
+void AsyncMethodDispatcher::dispatch(const UA_CallMethodRequest& request, void* context) {
+    void* nodeContext = nullptr;
+    UA_Server_getNodeContext(server_, request.methodId, &nodeContext);
+    auto* methodContext = static_cast<ServerContext::NodeContext*>(nodeContext);
+    if (methodContext == nullptr || !methodContext->asyncMethodCallback) {
+        setResult(context, UA_STATUSCODE_BADINTERNALERROR, {});
+        return;
+    }
+    const auto& callback = methodContext->asyncMethodCallback;
+    services::MethodCompletion completion(shared_from_this(), context);
+    const UA_StatusCode status = methodContext->server->invokeNodeCallback(
+        StatisticsCallback::Method,
+        "Method",
+        &request.methodId,
+        [&] {
+            callback(
+                {asWrapper<Variant>(request.inputArguments), request.inputArgumentsSize},
+                std::move(completion)
+            );
+        }
+    );
+    if (status != UA_STATUSCODE_GOOD) {
+        completion.fail(status);  // no-op if moved into the callback
+    }
+}
+
+AsyncMethodDispatcher& getAsyncMethodDispatcher(UA_Server* server, ServerContext& context) {
+    if (context.asyncMethodDispatcher == nullptr) {
+        context.asyncMethodDispatcher = std::make_shared<AsyncMethodDispatcher>(
+            server, context.asyncMethodThreadCount, context.workerThreadConfig
+        );
+        context.asyncMethodDispatcher->start();
+    }
+    return *context.asyncMethodDispatcher;
+}
+
+}  // namespace opcua
+
+#endif
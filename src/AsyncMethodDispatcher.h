@@ -0,0 +1,76 @@
+#pragma once
+
+#include "open62541pp/Config.h"
+
+#ifdef UAPP_ASYNC_METHODS
+
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/ThreadConfig.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+// forward declaration
+class ServerContext;
+class Variant;
+
+/**
+ * Worker thread pool to execute asynchronous method calls.
+ *
+ * The server queues calls of async method nodes and notifies the dispatcher. The workers fetch
+ * the queued operations, invoke the async method callbacks and set the results, which can be done
+ * from any thread. Completion handles keep the dispatcher alive, results of completions after
+ * stop are discarded.
+ */
+class AsyncMethodDispatcher : public std::enable_shared_from_this<AsyncMethodDispatcher> {
+public:
+    AsyncMethodDispatcher(UA_Server* server, size_t threadCount, ThreadConfig threadConfig = {});
+    ~AsyncMethodDispatcher();
+
+    AsyncMethodDispatcher(const AsyncMethodDispatcher&) = delete;
+    AsyncMethodDispatcher(AsyncMethodDispatcher&&) noexcept = delete;
+    AsyncMethodDispatcher& operator=(const AsyncMethodDispatcher&) = delete;
+    AsyncMethodDispatcher& operator=(AsyncMethodDispatcher&&) noexcept = delete;
+
+    /// Start the worker threads.
+    void start();
+
+    /// Join the worker threads and detach from the server. Must be called before the server is
+    /// deleted.
+    void stop() noexcept;
+
+    /// Wake up a worker to fetch new operations.
+    void notify() noexcept;
+
+    /// Set the result of an operation (thread-safe).
+    void setResult(void* context, UA_StatusCode status, Span<const Variant> output) noexcept;
+
+private:
+    void run();
+    void dispatch(const UA_CallMethodRequest& request, void* context);
+
+    UA_Server* server_;
+    std::mutex serverMutex_;  // guards server_ for completions from any thread
+    size_t threadCount_;
+    ThreadConfig threadConfig_;
+    std::vector<std::thread> threads_;
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    bool pending_{false};
+    bool running_{false};
+};
+
+/// Get the dispatcher of a server, created and started with the first call.
+AsyncMethodDispatcher& getAsyncMethodDispatcher(UA_Server* server, ServerContext& context);
+
+}  // namespace opcua
+
+#endif
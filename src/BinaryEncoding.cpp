@@ -0,0 +1,74 @@
+#include "open62541pp/BinaryEncoding.h"
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"  // asNative
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+size_t calcSizeBinary(const void* data, const UA_DataType& type) noexcept {
+    return UA_calcSizeBinary(data, &type);
+}
+
+size_t encodeBinary(const void* data, const UA_DataType& type, Span<uint8_t> buffer) {
+    if (buffer.empty()) {
+        // open62541 allocates a new buffer if the given buffer is empty
+        throw BadStatus(UA_STATUSCODE_BADENCODINGLIMITSEXCEEDED);
+    }
+    // encode into the existing buffer, the length is set to the encoded length
+    UA_ByteString output{buffer.size(), buffer.data()};
+    detail::throwOnBadStatus(UA_encodeBinary(data, &type, &output));
+    return output.length;
+}
+
+ByteString encodeBinary(const void* data, const UA_DataType& type) {
+    ByteString output;
+    detail::throwOnBadStatus(UA_encodeBinary(data, &type, output.handle()));
+    return output;
+}
+
+static void decodeBinary(
+    Span<const uint8_t> buffer,
+    void* data,
+    const UA_DataType& type,
+    const UA_DataTypeArray* customTypes
+) {
+    UA_DecodeBinaryOptions options{};
+    options.customTypes = customTypes;
+    const UA_ByteString input{buffer.size(), const_cast<uint8_t*>(buffer.data())};  // NOLINT
+    const auto status = UA_decodeBinary(&input, data, &type, &options);
+    if (status != UA_STATUSCODE_GOOD) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+}
+
+void decodeBinary(
+    Span<const uint8_t> buffer,
+    void* data,
+    const UA_DataType& type,
+    Span<const DataType> customTypes
+) {
+    const UA_DataTypeArray customTypesArray{
+        nullptr,  // next
+        customTypes.size(),
+        asNative(customTypes.data()),
+        false,  // cleanup
+    };
+    decodeBinary(buffer, data, type, customTypes.empty() ? nullptr : &customTypesArray);
+}
+
+void decodeBinary(
+    Span<const uint8_t> buffer,
+    void* data,
+    const UA_DataType& type,
+    const DataTypeRegistry& registry
+) {
+    decodeBinary(buffer, data, type, registry.handle());
+}
+
+}  // namespace opcua
+
+#endif
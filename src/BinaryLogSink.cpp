@@ -0,0 +1,245 @@
+#include "open62541pp/BinaryLogSink.h"
+
+#include <chrono>
+#include <cstddef>  // ptrdiff_t
+#include <cstring>  // memcpy, strchr, strlen
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+
+namespace opcua {
+
+template <typename T>
+static void append(std::vector<uint8_t>& buffer, T value) {
+    const size_t offset = buffer.size();
+    buffer.resize(offset + sizeof(T));
+    std::memcpy(buffer.data() + offset, &value, sizeof(T));
+}
+
+static void append(std::vector<uint8_t>& buffer, const char* data, size_t length) {
+    buffer.insert(buffer.end(), data, data + length);  // NOLINT
+}
+
+enum class LengthModifier { None, Char, Short, Long, LongLong, IntMax, Size, PtrDiff, LongDouble };
+
+static const char* parseLengthModifier(const char* it, LengthModifier& modifier) noexcept {
+    switch (*it) {
+    case 'h':
+        if (it[1] == 'h') {  // NOLINT
+            modifier = LengthModifier::Char;
+            return it + 2;  // NOLINT
+        }
+        modifier = LengthModifier::Short;
+        return it + 1;  // NOLINT
+    case 'l':
+        if (it[1] == 'l') {  // NOLINT
+            modifier = LengthModifier::LongLong;
+            return it + 2;  // NOLINT
+        }
+        modifier = LengthModifier::Long;
+        return it + 1;  // NOLINT
+    case 'q':
+        modifier = LengthModifier::LongLong;
+        return it + 1;  // NOLINT
+    case 'j':
+        modifier = LengthModifier::IntMax;
+        return it + 1;  // NOLINT
+    case 'z':
+        modifier = LengthModifier::Size;
+        return it + 1;  // NOLINT
+    case 't':
+        modifier = LengthModifier::PtrDiff;
+        return it + 1;  // NOLINT
+    case 'L':
+        modifier = LengthModifier::LongDouble;
+        return it + 1;  // NOLINT
+    default:
+        modifier = LengthModifier::None;
+        return it;
+    }
+}
+
+static int64_t readSigned(LengthModifier modifier, va_list& args) noexcept {
+    switch (modifier) {
+    case LengthModifier::Long:
+        return va_arg(args, long);  // NOLINT
+    case LengthModifier::LongLong:
+        return va_arg(args, long long);  // NOLINT
+    case LengthModifier::IntMax:
+        return va_arg(args, intmax_t);  // NOLINT
+    case LengthModifier::Size:
+    case LengthModifier::PtrDiff:
+        return va_arg(args, ptrdiff_t);  // NOLINT
+    default:
+        return va_arg(args, int);  // NOLINT, char and short are promoted to int
+    }
+}
+
+static uint64_t readUnsigned(LengthModifier modifier, va_list& args) noexcept {
+    switch (modifier) {
+    case LengthModifier::Long:
+        return va_arg(args, unsigned long);  // NOLINT
+    case LengthModifier::LongLong:
+        return va_arg(args, unsigned long long);  // NOLINT
+    case LengthModifier::IntMax:
+        return va_arg(args, uintmax_t);  // NOLINT
+    case LengthModifier::Size:
+    case LengthModifier::PtrDiff:
+        return va_arg(args, size_t);  // NOLINT
+    default:
+        return va_arg(args, unsigned int);  // NOLINT
+    }
+}
+
+/// Encode the arguments of the printf conversion specifiers.
+static void encodeArguments(const char* format, va_list& args, std::vector<uint8_t>& output) {
+    for (const char* it = format; *it != '\0'; ++it) {  // NOLINT
+        if (*it != '%') {
+            continue;
+        }
+        ++it;  // NOLINT
+        if (*it == '%') {
+            continue;
+        }
+        // flags, width and precision (`*` consumes an int argument)
+        while (*it != '\0' && std::strchr("-+ #0123456789.*", *it) != nullptr) {
+            if (*it == '*') {
+                append(output, 'i');
+                append(output, static_cast<int64_t>(va_arg(args, int)));  // NOLINT
+            }
+            ++it;  // NOLINT
+        }
+        LengthModifier modifier{};
+        it = parseLengthModifier(it, modifier);
+        switch (*it) {
+        case 'd':
+        case 'i':
+        case 'c':
+            append(output, 'i');
+            append(output, readSigned(modifier, args));
+            break;
+        case 'u':
+        case 'o':
+        case 'x':
+        case 'X':
+            append(output, 'u');
+            append(output, readUnsigned(modifier, args));
+            break;
+        case 'f':
+        case 'F':
+        case 'e':
+        case 'E':
+        case 'g':
+        case 'G':
+        case 'a':
+        case 'A':
+            append(output, 'd');
+            if (modifier == LengthModifier::LongDouble) {
+                append(output, static_cast<double>(va_arg(args, long double)));  // NOLINT
+            } else {
+                append(output, va_arg(args, double));  // NOLINT
+            }
+            break;
+        case 's': {
+            const char* str = va_arg(args, const char*);  // NOLINT
+            if (str == nullptr) {
+                str = "(null)";
+            }
+            const auto length = static_cast<uint32_t>(std::strlen(str));
+            append(output, 's');
+            append(output, length);
+            append(output, str, length);
+            break;
+        }
+        case 'p': {
+            const void* ptr = va_arg(args, void*);  // NOLINT
+            append(output, 'p');
+            append(output, static_cast<uint64_t>(reinterpret_cast<uintptr_t>(ptr)));  // NOLINT
+            break;
+        }
+        case 'n':
+            (void)va_arg(args, void*);  // NOLINT, not supported
+            break;
+        default:
+            return;  // invalid or truncated specifier
+        }
+    }
+}
+
+BinaryLogSink::BinaryLogSink(std::string_view filepath, size_t bufferSize)
+    : stream_(std::string(filepath), std::ios::binary | std::ios::trunc),
+      bufferSize_(bufferSize) {
+    if (!stream_) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    buffer_.reserve(bufferSize_);
+    append(buffer_, "UAPPBLOG", 8);
+    append(buffer_, version);
+}
+
+BinaryLogSink::~BinaryLogSink() {
+    try {
+        flush();
+    } catch (...) {  // NOLINT
+    }
+}
+
+uint32_t BinaryLogSink::getFormatId(const char* format) {
+    // intern by content, format strings may be built at runtime (pointers are not stable)
+    formatKey_.assign(format);
+    const auto it = formats_.find(formatKey_);
+    if (it != formats_.end()) {
+        return it->second;
+    }
+    if (formats_.size() >= maxFormats) {
+        formats_.clear();  // bounded memory, the decoder keeps the previous ids
+    }
+    const uint32_t id = nextFormatId_++;
+    formats_.emplace(formatKey_, id);
+    append(buffer_, 'F');
+    append(buffer_, id);
+    append(buffer_, static_cast<uint32_t>(formatKey_.size()));
+    append(buffer_, formatKey_.data(), formatKey_.size());
+    return id;
+}
+
+void BinaryLogSink::log(
+    LogLevel level, LogCategory category, const char* format, va_list args
+) noexcept {
+    const auto timestamp = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()
+    );
+    try {
+        const std::lock_guard lock(mutex_);
+        const uint32_t id = getFormatId(format);
+        args_.clear();
+        va_list argsCopy{};  // NOLINT
+        va_copy(argsCopy, args);  // NOLINT
+        encodeArguments(format, argsCopy, args_);
+        va_end(argsCopy);  // NOLINT
+        append(buffer_, 'M');
+        append(buffer_, id);
+        append(buffer_, static_cast<uint8_t>(level));
+        append(buffer_, static_cast<uint8_t>(category));
+        append(buffer_, static_cast<int64_t>(timestamp.count()));
+        append(buffer_, static_cast<uint32_t>(args_.size()));
+        buffer_.insert(buffer_.end(), args_.begin(), args_.end());
+        if (buffer_.size() >= bufferSize_) {
+            flushLocked();
+        }
+    } catch (...) {  // NOLINT, drop message
+    }
+}
+
+void BinaryLogSink::flush() {
+    const std::lock_guard lock(mutex_);
+    flushLocked();
+}
+
+void BinaryLogSink::flushLocked() {
+    stream_.write(reinterpret_cast<const char*>(buffer_.data()), buffer_.size());  // NOLINT
+    stream_.flush();
+    buffer_.clear();
+}
+
+}  // namespace opcua
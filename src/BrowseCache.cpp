@@ -0,0 +1,146 @@
+#include "open62541pp/BrowseCache.h"
+
+#include <algorithm>  // any_of, find_if
+#include <iterator>  // prev
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/Variant.h"
+
+#include "detail/ModelChanges.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+bool BrowseCache::matches(const Entry& entry, const BrowseDescription& bd, uint32_t maxReferences) {
+    const auto& native = *bd.handle();
+    return entry.browseDirection == static_cast<BrowseDirection>(native.browseDirection) &&
+           entry.includeSubtypes == native.includeSubtypes &&
+           entry.nodeClassMask == native.nodeClassMask && entry.resultMask == native.resultMask &&
+           entry.maxReferences == maxReferences && entry.referenceTypeId == bd.getReferenceTypeId();
+}
+
+std::optional<std::vector<ReferenceDescription>> BrowseCache::find(
+    const BrowseDescription& bd, uint32_t maxReferences
+) {
+    const std::lock_guard lock(mutex_);
+    const auto it = entries_.find(bd.getNodeId());
+    if (it != entries_.end()) {
+        auto& nodeEntries = it->second;
+        const auto entry = std::find_if(nodeEntries.begin(), nodeEntries.end(), [&](const auto& e) {
+            return matches(e, bd, maxReferences);
+        });
+        if (entry != nodeEntries.end()) {
+            const bool expired = timeToLive_ > Clock::duration::zero() &&
+                                 Clock::now() - entry->inserted > timeToLive_;
+            if (!expired) {
+                ++hits_;
+                return entry->references;
+            }
+            nodeEntries.erase(entry);
+            if (nodeEntries.empty()) {
+                entries_.erase(it);
+            }
+        }
+    }
+    ++misses_;
+    return std::nullopt;
+}
+
+void BrowseCache::insert(
+    const BrowseDescription& bd,
+    uint32_t maxReferences,
+    std::vector<ReferenceDescription> references
+) {
+    const std::lock_guard lock(mutex_);
+    auto& nodeEntries = entries_[bd.getNodeId()];
+    auto entry = std::find_if(nodeEntries.begin(), nodeEntries.end(), [&](const auto& e) {
+        return matches(e, bd, maxReferences);
+    });
+    if (entry == nodeEntries.end()) {
+        const auto& native = *bd.handle();
+        nodeEntries.push_back(Entry{
+            static_cast<BrowseDirection>(native.browseDirection),
+            bd.getReferenceTypeId(),
+            native.includeSubtypes,
+            native.nodeClassMask,
+            native.resultMask,
+            maxReferences,
+            {},
+            {},
+        });
+        entry = std::prev(nodeEntries.end());
+    }
+    entry->inserted = Clock::now();
+    entry->references = std::move(references);
+}
+
+void BrowseCache::invalidate(const NodeId& id) {
+    const std::lock_guard lock(mutex_);
+    entries_.erase(id);
+}
+
+void BrowseCache::clear() {
+    const std::lock_guard lock(mutex_);
+    entries_.clear();
+}
+
+size_t BrowseCache::size() const {
+    const std::lock_guard lock(mutex_);
+    size_t count = 0;
+    for (const auto& [id, nodeEntries] : entries_) {
+        count += nodeEntries.size();
+    }
+    return count;
+}
+
+void BrowseCache::handleModelChangeEvent(Span<const Variant> eventFields) {
+    const auto changes = detail::getModelChanges(eventFields);
+    // the inverse references of the target nodes change as well, but only the source node is
+    // reported as affected node
+    constexpr UA_Byte referencesChanged = 0x01 | 0x02 | 0x04 | 0x08;  // Node/ReferenceAdded/Deleted
+    const bool clearAll = changes.empty() ||
+                          std::any_of(changes.begin(), changes.end(), [&](const auto* change) {
+                              return change == nullptr || (change->verb & referencesChanged) != 0;
+                          });
+    if (clearAll) {
+        clear();
+        return;
+    }
+    for (const auto* change : changes) {
+        invalidate(asWrapper<NodeId>(change->affected));
+    }
+}
+
+EventFilter BrowseCache::getModelChangeEventFilter() {
+    return EventFilter(
+        {
+            {ObjectTypeId::GeneralModelChangeEventType, {{0, "Changes"}}, AttributeId::Value},
+        },
+        {}  // where clause -> no filter
+    );
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+MonitoredItem<Client> subscribeModelChanges(
+    Subscription<Client>& subscription, const std::shared_ptr<BrowseCache>& cache
+) {
+    return subscription.subscribeEvent(
+        ObjectId::Server,
+        BrowseCache::getModelChangeEventFilter(),
+        [weakCache = std::weak_ptr<BrowseCache>(cache)](
+            [[maybe_unused]] const MonitoredItem<Client>& item, Span<const Variant> eventFields
+        ) {
+            if (auto locked = weakCache.lock()) {
+                locked->handleModelChangeEvent(eventFields);
+            }
+        }
+    );
+}
+#endif
+
+}  // namespace opcua
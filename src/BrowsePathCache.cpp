@@ -0,0 +1,251 @@
+#include "open62541pp/BrowsePathCache.h"
+
+#include <algorithm>  // find, transform
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>  // hash
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string_view>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/Variant.h"
+
+#include "detail/BinarySegment.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+static void hashCombine(size_t& seed, size_t hash) noexcept {
+    seed ^= hash + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+}
+
+size_t BrowsePathCache::Hash::operator()(const SimplifiedBrowsePath& browsePath) const noexcept {
+    size_t seed = std::hash<NodeId>()(browsePath.origin);
+    for (const auto& name : browsePath.path) {
+        hashCombine(seed, name.getNamespaceIndex());
+        hashCombine(seed, std::hash<std::string_view>()(name.getName()));
+    }
+    return seed;
+}
+
+bool BrowsePathCache::Equal::operator()(
+    const SimplifiedBrowsePath& lhs, const SimplifiedBrowsePath& rhs
+) const noexcept {
+    return lhs.origin == rhs.origin && lhs.path == rhs.path;
+}
+
+std::optional<NodeId> BrowsePathCache::find(const SimplifiedBrowsePath& browsePath) const {
+    const auto it = entries_.find(browsePath);
+    if (it == entries_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void BrowsePathCache::insert(SimplifiedBrowsePath browsePath, NodeId target) {
+    entries_.insert_or_assign(std::move(browsePath), std::move(target));
+}
+
+void BrowsePathCache::clear() noexcept {
+    entries_.clear();
+}
+
+size_t BrowsePathCache::size() const noexcept {
+    return entries_.size();
+}
+
+const std::vector<std::string>& BrowsePathCache::getNamespaceArray() const noexcept {
+    return namespaceArray_;
+}
+
+void BrowsePathCache::revalidate(Span<const std::string> namespaceArray) {
+    const bool unchanged = std::equal(
+        namespaceArray_.begin(), namespaceArray_.end(), namespaceArray.begin(), namespaceArray.end()
+    );
+    if (unchanged || namespaceArray_.empty()) {
+        namespaceArray_ = std::vector<std::string>(namespaceArray);
+        return;
+    }
+
+    // map the namespace indices by URI, unknown namespaces are mapped to `std::nullopt`
+    std::vector<std::optional<uint16_t>> indices(namespaceArray_.size());
+    indices[0] = 0;
+    for (size_t i = 1; i < namespaceArray_.size(); ++i) {
+        const auto it = std::find(namespaceArray.begin(), namespaceArray.end(), namespaceArray_[i]);
+        if (it != namespaceArray.end()) {
+            indices[i] = static_cast<uint16_t>(it - namespaceArray.begin());
+        }
+    }
+    const auto remap = [&](uint16_t& namespaceIndex) {
+        if (namespaceIndex >= indices.size() || !indices[namespaceIndex].has_value()) {
+            return false;
+        }
+        namespaceIndex = *indices[namespaceIndex];
+        return true;
+    };
+
+    decltype(entries_) entries;
+    entries.reserve(entries_.size());
+    for (auto& [key, value] : entries_) {
+        SimplifiedBrowsePath browsePath = key;
+        NodeId target = std::move(value);
+        bool valid = remap(browsePath.origin.handle()->namespaceIndex) &&
+                     remap(target.handle()->namespaceIndex);
+        for (auto& name : browsePath.path) {
+            valid = valid && remap(name.handle()->namespaceIndex);
+        }
+        if (valid) {
+            entries.insert_or_assign(std::move(browsePath), std::move(target));
+        }
+    }
+    entries_ = std::move(entries);
+    namespaceArray_ = std::vector<std::string>(namespaceArray);
+}
+
+// magic bytes + format version
+constexpr std::array<char, 8> browsePathCacheMagic{'U', 'A', 'P', 'P', 'B', 'P', 'C', '1'};
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+void BrowsePathCache::save(std::ostream& stream) const {
+    std::vector<NodeId> origins;
+    std::vector<uint32_t> pathSizes;
+    std::vector<QualifiedName> names;
+    std::vector<NodeId> targets;
+    origins.reserve(entries_.size());
+    pathSizes.reserve(entries_.size());
+    targets.reserve(entries_.size());
+    for (const auto& [browsePath, target] : entries_) {
+        origins.push_back(browsePath.origin);
+        pathSizes.push_back(static_cast<uint32_t>(browsePath.path.size()));
+        names.insert(names.end(), browsePath.path.begin(), browsePath.path.end());
+        targets.push_back(target);
+    }
+
+    stream.write(browsePathCacheMagic.data(), browsePathCacheMagic.size());
+    detail::writeBinarySegment(stream, *Variant::fromArray(namespaceArray_).handle());
+    detail::writeBinarySegment(stream, *Variant::fromArray(origins).handle());
+    detail::writeBinarySegment(stream, *Variant::fromArray(pathSizes).handle());
+    detail::writeBinarySegment(stream, *Variant::fromArray(names).handle());
+    detail::writeBinarySegment(stream, *Variant::fromArray(targets).handle());
+    if (!stream) {
+        throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+template <typename T>
+static std::vector<T> readArraySegment(std::string_view& buffer) {
+    Variant variant;
+    detail::readBinarySegment(buffer, *variant.handle());
+    if (variant.isScalar() ||
+        (!variant.isEmpty() && !variant.isType(detail::guessDataType<T>()))) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    if (!variant.isArray()) {
+        return {};  // empty array
+    }
+    return variant.getArrayCopy<T>();
+}
+
+BrowsePathCache BrowsePathCache::load(std::istream& stream) {
+    const auto buffer = detail::readBinaryFile(stream, browsePathCacheMagic);
+    std::string_view view(buffer);
+    auto namespaceArray = readArraySegment<std::string>(view);
+    auto origins = readArraySegment<NodeId>(view);
+    const auto pathSizes = readArraySegment<uint32_t>(view);
+    auto names = readArraySegment<QualifiedName>(view);
+    auto targets = readArraySegment<NodeId>(view);
+    if (origins.size() != pathSizes.size() || origins.size() != targets.size()) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+
+    BrowsePathCache cache;
+    cache.namespaceArray_ = std::move(namespaceArray);
+    cache.entries_.reserve(origins.size());
+    size_t offset = 0;
+    for (size_t i = 0; i < origins.size(); ++i) {
+        if (names.size() - offset < pathSizes[i]) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+        const auto first = names.begin() + static_cast<std::ptrdiff_t>(offset);
+        SimplifiedBrowsePath browsePath{
+            std::move(origins[i]),
+            {std::make_move_iterator(first),
+             std::make_move_iterator(first + static_cast<std::ptrdiff_t>(pathSizes[i]))},
+        };
+        offset += pathSizes[i];
+        cache.insert(std::move(browsePath), std::move(targets[i]));
+    }
+    return cache;
+}
+
+#else
+
+void BrowsePathCache::save([[maybe_unused]] std::ostream& stream) const {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+BrowsePathCache BrowsePathCache::load([[maybe_unused]] std::istream& stream) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+#endif
+
+static BrowsePath createBrowsePath(const SimplifiedBrowsePath& browsePath) {
+    std::vector<RelativePathElement> elements(browsePath.path.size());
+    std::transform(
+        browsePath.path.begin(),
+        browsePath.path.end(),
+        elements.begin(),
+        [](const auto& qn) {
+            return RelativePathElement(ReferenceTypeId::HierarchicalReferences, false, true, qn);
+        }
+    );
+    return {browsePath.origin, RelativePath(elements)};
+}
+
+std::vector<NodeId> resolveBrowsePaths(
+    Client& client, Span<const SimplifiedBrowsePath> browsePaths, BrowsePathCache& cache
+) {
+    cache.revalidate(client.getNamespaceArray());
+
+    std::vector<NodeId> results(browsePaths.size());
+    std::vector<size_t> missing;
+    std::vector<BrowsePath> request;
+    for (size_t i = 0; i < browsePaths.size(); ++i) {
+        if (auto id = cache.find(browsePaths[i])) {
+            results[i] = std::move(*id);
+        } else {
+            missing.push_back(i);
+            request.push_back(createBrowsePath(browsePaths[i]));
+        }
+    }
+    if (request.empty()) {
+        return results;
+    }
+
+    const auto resolved = services::translateBrowsePathsToNodeIds(client, request);
+    for (size_t j = 0; j < missing.size() && j < resolved.size(); ++j) {
+        const auto& result = resolved[j];
+        const auto targets = result.getTargets();
+        if (result.getStatusCode().isBad() || targets.empty() ||
+            !targets[0].getTargetId().isLocal()) {
+            continue;  // not resolved, don't cache
+        }
+        const auto i = missing[j];
+        results[i] = targets[0].getTargetId().getNodeId();
+        cache.insert(browsePaths[i], results[i]);
+    }
+    return results;
+}
+
+}  // namespace opcua
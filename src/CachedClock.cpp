@@ -0,0 +1,64 @@
+#include "open62541pp/CachedClock.h"
+
+#include <atomic>
+#include <cstdint>
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+std::atomic<int64_t> cachedTime{0};  // NOLINT
+std::atomic<int> sourceCount{0};  // NOLINT
+
+}  // namespace
+
+DateTime CachedClock::now() noexcept {
+    if (sourceCount.load(std::memory_order_relaxed) > 0) {
+        const auto time = cachedTime.load(std::memory_order_relaxed);
+        if (time != 0) {
+            return DateTime(time);
+        }
+    }
+    return DateTime(UA_DateTime_now());  // NOLINT
+}
+
+void CachedClock::update() noexcept {
+    cachedTime.store(UA_DateTime_now(), std::memory_order_relaxed);
+}
+
+void CachedClock::addSource() noexcept {
+    update();
+    sourceCount.fetch_add(1, std::memory_order_relaxed);
+}
+
+void CachedClock::removeSource() noexcept {
+    sourceCount.fetch_sub(1, std::memory_order_relaxed);
+}
+
+bool CachedClock::isActive() noexcept {
+    return sourceCount.load(std::memory_order_relaxed) > 0;
+}
+
+CachedClockTicker::CachedClockTicker(std::chrono::milliseconds interval) {
+    CachedClock::addSource();
+    thread_ = std::thread([this, interval] {
+        std::unique_lock lock(mutex_);
+        while (!cv_.wait_for(lock, interval, [this] { return stop_; })) {
+            CachedClock::update();
+        }
+    });
+}
+
+CachedClockTicker::~CachedClockTicker() {
+    {
+        const std::lock_guard lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+    CachedClock::removeSource();
+}
+
+}  // namespace opcua
@@ -1,16 +1,26 @@
 #include "open62541pp/Client.h"
 
+#include <algorithm>  // clamp, min
 #include <atomic>
-#include <cstddef>
+#include <chrono>
+#include <cstddef>  // offsetof
 #include <iterator>
+#include <optional>
 #include <string>
-#include <utility>  // move
+#include <thread>
+#include <utility>  // exchange, move
 
 #include "open62541pp/AccessControl.h"  // Login
 #include "open62541pp/Config.h"
 #include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/Discovery.h"
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/Tracer.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/open62541.h"
 #include "open62541pp/services/Attribute.h"  // readValue
@@ -21,7 +31,14 @@
 #include "ClientContext.h"
 #include "CustomDataTypes.h"
 #include "CustomLogger.h"
+#include "InProcessConnection.h"
+#include "ServerContext.h"
+#include "SharedMemoryTransport.h"
+#include "SocketConnection.h"
 #include "open62541_impl.h"
+#include "services/RegisteredNodes.h"
+#include "services/ServiceStatistics.h"
+#include "services/SubscriptionRecovery.h"
 
 namespace opcua {
 
@@ -90,6 +107,13 @@ static void stateCallback(UA_Client* client, UA_ClientState clientState) noexcep
             invokeStateCallback(context, ClientState::Connected);
             break;
         case UA_CLIENTSTATE_SESSION:
+            context.operationLimits = {};  // might be connected to another server
+            for (auto& size : context.requestSizes) {
+                size.reset();
+            }
+            std::atomic_store(&context.namespaceTable, std::shared_ptr<const NamespaceTable>{});
+            // registered node ids are only valid within a session
+            context.registeredNodes.outdated = context.registeredNodes.aliases != nullptr;
             invokeStateCallback(context, ClientState::SessionActivated);
             break;
         case UA_CLIENTSTATE_SESSION_DISCONNECTED:
@@ -114,6 +138,13 @@ static void stateCallback(
     if (sessionState != context.lastSessionState) {
         switch (sessionState) {
         case UA_SESSIONSTATE_ACTIVATED:
+            context.operationLimits = {};  // might be connected to another server
+            for (auto& size : context.requestSizes) {
+                size.reset();
+            }
+            std::atomic_store(&context.namespaceTable, std::shared_ptr<const NamespaceTable>{});
+            // registered node ids are only valid within a session
+            context.registeredNodes.outdated = context.registeredNodes.aliases != nullptr;
             invokeStateCallback(context, ClientState::SessionActivated);
             break;
         case UA_SESSIONSTATE_CLOSED:
@@ -129,6 +160,7 @@ static void stateCallback(
             invokeStateCallback(context, ClientState::Connected);
             break;
         case UA_SECURECHANNELSTATE_CLOSED:
+            context.socketFd = -1;
             invokeStateCallback(context, ClientState::Disconnected);
             break;
         default:
@@ -140,8 +172,178 @@ static void stateCallback(
 }
 #endif
 
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+// capture the socket of new connections, see Client::getSocketFd
+static UA_Connection initConnection(
+    UA_ConnectionConfig config, UA_String endpointUrl, UA_UInt32 timeout, const UA_Logger* logger
+) {
+    // the client passes the logger of its config, which references the client context
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* bytes = reinterpret_cast<const char*>(logger);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* clientConfig = reinterpret_cast<const UA_ClientConfig*>(
+        bytes - offsetof(UA_ClientConfig, logger)
+    );
+    auto& context = *static_cast<ClientContext*>(clientConfig->clientContext);
+    const std::string_view url(
+        reinterpret_cast<const char*>(endpointUrl.data),  // NOLINT
+        endpointUrl.length
+    );
+#ifdef UAPP_IN_PROCESS_CONNECTION
+    if (detail::isInProcessUrl(url) && context.inProcessHub != nullptr) {
+        context.socketFd = -1;  // no socket to expose
+        return context.inProcessHub->connect(config);
+    }
+#endif
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+    if (detail::isSharedMemoryUrl(url)) {
+        context.socketFd = -1;  // no socket to expose
+        return detail::createSharedMemoryConnection(config, url, logger);
+    }
+#endif
+#ifdef UAPP_SOCKET_CONNECTION
+    if (context.reverseSocketFd >= 0) {
+        // socket of a reverse connect, accepted by the ReverseConnectListener (used once)
+        context.socketFd = std::exchange(context.reverseSocketFd, -1);
+        detail::applySocketOptions(context.socketFd, context.socketOptions);
+        return detail::createSocketConnection(context.socketFd, config);
+    }
+#endif
+    UA_Connection connection = context.initConnectionFunc(config, endpointUrl, timeout, logger);
+    context.socketFd = connection.state == UA_CONNECTIONSTATE_CLOSED
+        ? -1
+        : static_cast<int>(connection.sockfd);
+#ifdef UAPP_SOCKET_CONNECTION
+    if (context.socketFd >= 0 &&
+        !detail::applySocketOptions(context.socketFd, context.socketOptions)) {
+        UA_LOG_WARNING(logger, UA_LOGCATEGORY_NETWORK, "Could not apply socket options");
+    }
+#endif
+    return connection;
+}
+
+static UA_StatusCode pollConnection(
+    UA_Connection* connection, UA_UInt32 timeout, const UA_Logger* logger
+) {
+#ifdef UAPP_IN_PROCESS_CONNECTION
+    if (detail::isInProcessConnection(*connection)) {
+        return detail::pollInProcessConnection(*connection);
+    }
+#endif
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+    if (detail::isSharedMemoryConnection(*connection)) {
+        return detail::pollSharedMemoryConnection(*connection);
+    }
+#endif
+#ifdef UAPP_SOCKET_CONNECTION
+    if (detail::isSocketConnection(*connection)) {
+        return detail::pollSocketConnection(*connection);
+    }
+#endif
+    // same mapping of the logger as in initConnection
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* bytes = reinterpret_cast<const char*>(logger);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* clientConfig = reinterpret_cast<const UA_ClientConfig*>(
+        bytes - offsetof(UA_ClientConfig, logger)
+    );
+    auto& context = *static_cast<ClientContext*>(clientConfig->clientContext);
+    return context.pollConnectionFunc(connection, timeout, logger);
+}
+#endif
+
 /* ----------------------------------------- Connection ----------------------------------------- */
 
+static UA_StatusCode connectNative(
+    UA_Client* client, const std::string& endpointUrl, const std::optional<Login>& login
+) {
+    if (!login.has_value()) {
+        return UA_Client_connect(client, endpointUrl.c_str());
+    }
+#if UAPP_OPEN62541_VER_LE(1, 0)
+    const auto func = UA_Client_connect_username;
+#else
+    const auto func = UA_Client_connectUsername;
+#endif
+    return func(client, endpointUrl.c_str(), login->username.c_str(), login->password.c_str());
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 1)
+static void setSelectedEndpoint(
+    UA_ClientConfig* config,
+    const UA_EndpointDescription& endpoint,
+    const UA_UserTokenPolicy& userTokenPolicy
+) {
+    UA_EndpointDescription_clear(&config->endpoint);
+    UA_EndpointDescription_copy(&endpoint, &config->endpoint);
+    UA_UserTokenPolicy_clear(&config->userTokenPolicy);
+    UA_UserTokenPolicy_copy(&userTokenPolicy, &config->userTokenPolicy);
+}
+#endif
+
+/// Connect with the cached endpoint of the URL to skip the endpoint discovery.
+static UA_StatusCode connectCached(
+    UA_Client* client,
+    ClientContext& context,
+    const std::string& endpointUrl,
+    const std::optional<Login>& login
+) {
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    auto& cache = context.endpointCache;
+    auto* config = UA_Client_getConfig(client);
+    // restore the selection of the user, only the selection installed by the cache is replaced
+    const auto restoreConfigured = [&] {
+        if (cache.configured.has_value()) {
+            const auto& configured = *cache.configured;
+            setSelectedEndpoint(
+                config, *configured.endpoint.handle(), *configured.userTokenPolicy.handle()
+            );
+        }
+    };
+    if (!cache.enabled) {
+        restoreConfigured();
+        cache.configured.reset();
+        return connectNative(client, endpointUrl, login);
+    }
+    if (!cache.configured.has_value()) {
+        cache.configured = ClientContext::EndpointCache::Selected{
+            asWrapper<EndpointDescription>(config->endpoint),
+            asWrapper<UserTokenPolicy>(config->userTokenPolicy),
+        };
+    }
+    const auto it = cache.selected.find(endpointUrl);
+    const bool cached = it != cache.selected.end() && it->second.login == login.has_value();
+    if (cached) {
+        // a preselected endpoint skips GetEndpoints
+        const auto& selected = it->second;
+        setSelectedEndpoint(
+            config, *selected.endpoint.handle(), *selected.userTokenPolicy.handle()
+        );
+    } else {
+        restoreConfigured();
+    }
+    auto status = connectNative(client, endpointUrl, login);
+    if (detail::isBadStatus(status) && cached) {
+        // endpoint might be outdated (e.g. new server certificate), retry with discovery
+        cache.selected.erase(endpointUrl);
+        UA_Client_disconnect(client);
+        restoreConfigured();
+        status = connectNative(client, endpointUrl, login);
+    }
+    if (detail::isGoodStatus(status)) {
+        cache.selected[endpointUrl] = {
+            asWrapper<EndpointDescription>(config->endpoint),
+            asWrapper<UserTokenPolicy>(config->userTokenPolicy),
+            login.has_value(),
+        };
+    }
+    return status;
+#else
+    static_cast<void>(context);
+    return connectNative(client, endpointUrl, login);
+#endif
+}
+
 class Client::Connection {
 public:
     Connection()
@@ -152,6 +354,7 @@ public:
     }
 
     ~Connection() {
+        stop();
         UA_Client_disconnect(handle());
         UA_Client_delete(handle());
     }
@@ -166,21 +369,46 @@ public:
         auto* config = getConfig(handle());
         config->clientContext = &context_;
         config->stateCallback = stateCallback;
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+        if (config->initConnectionFunc != initConnection) {
+            context_.initConnectionFunc = config->initConnectionFunc;
+            config->initConnectionFunc = initConnection;
+        }
+        if (config->pollConnectionFunc != pollConnection) {
+            context_.pollConnectionFunc = config->pollConnectionFunc;
+            config->pollConnectionFunc = pollConnection;
+        }
+#endif
     }
 
-    void runIterate(uint16_t timeoutMilliseconds) {
+    void runIterate(Client& client, uint16_t timeoutMilliseconds) {
+        if (context_.reconnect.pending) {
+            reconnect(client, timeoutMilliseconds);
+            return;
+        }
         const auto status = UA_Client_run_iterate(handle(), timeoutMilliseconds);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+        context_.dispatchDataChangeBatches();
+        context_.tuneAdaptivePublishing(handle());
+#endif
+        detail::pollDueGroups(client);
+        if (context_.writeCoalescer != nullptr) {
+            context_.writeCoalescer->flushIfDue(client);
+        }
+        if (detail::isBadStatus(status) && scheduleReconnect()) {
+            return;
+        }
         detail::throwOnBadStatus(status);
     }
 
-    void run() {
+    void run(Client& client) {
         if (running_) {
             return;
         }
         running_ = true;
         try {
             while (running_) {
-                runIterate(1000);
+                runIterate(client, 1000);
             }
         } catch (...) {
             running_ = false;
@@ -188,8 +416,61 @@ public:
         }
     }
 
+    void runInBackground(Client& client, uint16_t timeoutMilliseconds) {
+        if (running_) {
+            return;
+        }
+        if (thread_.joinable()) {
+            thread_.join();  // stopped within a callback of the event loop
+        }
+        running_ = true;
+        thread_ = std::thread([this, &client, timeoutMilliseconds] {
+            applyThreadConfig(context_.eventLoopThreadConfig);
+            context_.eventLoopThreadId = std::this_thread::get_id();
+            while (running_) {
+                try {
+                    const std::lock_guard lock(context_.mutex);
+                    runIterate(client, timeoutMilliseconds);
+                } catch (...) {
+                    // nobody to rethrow to, failing requests are reported to their callers
+                    std::this_thread::sleep_for(std::chrono::milliseconds(timeoutMilliseconds));
+                }
+                // let threads waiting to send their requests acquire the lock
+                for (size_t i = 0; i < 100 && context_.mutex.getWaiters() > 0; ++i) {
+                    std::this_thread::yield();
+                }
+            }
+            context_.eventLoopThreadId = std::thread::id();
+        });
+    }
+
     void stop() {
         running_ = false;
+        if (thread_.joinable() && thread_.get_id() != std::this_thread::get_id()) {
+            thread_.join();
+        }
+    }
+
+    std::chrono::milliseconds getNextTimeout() const noexcept {
+        const auto& reconnect = context_.reconnect;
+        if (reconnect.pending) {
+            const auto remaining = std::chrono::ceil<std::chrono::milliseconds>(
+                reconnect.nextAttempt - std::chrono::steady_clock::now()
+            );
+            return std::clamp(remaining, std::chrono::milliseconds(0), maxPollInterval);
+        }
+        auto next = std::chrono::steady_clock::duration(maxPollInterval);
+        if (context_.writeCoalescer != nullptr) {
+            next = std::min(next, context_.writeCoalescer->getNextFlush());
+        }
+        if (const auto nextPoll = detail::getNextPoll(context_)) {
+            next = std::min(next, *nextPoll);
+        }
+        return std::chrono::ceil<std::chrono::milliseconds>(next);
+    }
+
+    bool isRunningInBackground() const noexcept {
+        return thread_.joinable() && running_;
     }
 
     bool isRunning() const noexcept {
@@ -200,6 +481,53 @@ public:
         return client_;
     }
 
+    /// Schedule the automatic reconnect after a connection loss.
+    bool scheduleReconnect() noexcept {
+        auto& reconnect = context_.reconnect;
+        if (!reconnect.options.has_value() || reconnect.endpointUrl.empty()) {
+            return false;
+        }
+        reconnect.pending = true;
+        reconnect.attempts = 0;
+        reconnect.delay = reconnect.options->initialDelay;
+        reconnect.nextAttempt = std::chrono::steady_clock::now() + reconnect.delay;
+        return true;
+    }
+
+    /// Reconnect if the next attempt is due, wait at most the timeout otherwise.
+    void reconnect(Client& client, uint16_t timeoutMilliseconds) {
+        auto& reconnect = context_.reconnect;
+        const auto now = std::chrono::steady_clock::now();
+        if (now < reconnect.nextAttempt) {
+            std::this_thread::sleep_for(std::min<std::chrono::steady_clock::duration>(
+                reconnect.nextAttempt - now, std::chrono::milliseconds(timeoutMilliseconds)
+            ));
+            return;
+        }
+        const auto status =
+            connectCached(handle(), context_, reconnect.endpointUrl, reconnect.login);
+        if (detail::isGoodStatus(status)) {
+            reconnect.pending = false;
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+            detail::recoverSubscriptions(client);
+#endif
+            return;
+        }
+        const auto& options = *reconnect.options;
+        ++reconnect.attempts;
+        if (options.maxAttempts > 0 && reconnect.attempts >= options.maxAttempts) {
+            reconnect.pending = false;
+            detail::throwOnBadStatus(status);
+        }
+        reconnect.delay = std::min(
+            options.maxDelay,
+            std::chrono::duration_cast<std::chrono::milliseconds>(
+                reconnect.delay * options.backoffFactor
+            )
+        );
+        reconnect.nextAttempt = std::chrono::steady_clock::now() + reconnect.delay;
+    }
+
     ClientContext& getContext() noexcept {
         return context_;
     }
@@ -213,11 +541,16 @@ public:
     }
 
 private:
+    /// Upper bound of the wait period for housekeeping (secure channel renewal, request timeouts),
+    /// the timers of open62541 are not exposed. Same as the default timeout of runIterate.
+    static constexpr std::chrono::milliseconds maxPollInterval{1000};
+
     UA_Client* client_;
     ClientContext context_;
     CustomDataTypes customDataTypes_;
     CustomLogger logger_;
     std::atomic<bool> running_{false};
+    std::thread thread_;
 };
 
 /* ------------------------------------------- Client ------------------------------------------- */
@@ -253,7 +586,23 @@ Client::Client(
 }
 #endif
 
+template <typename T>
+static Result<std::vector<T>> toDiscoveryResult(
+    UA_StatusCode status, const std::vector<T>& values
+) {
+    if (detail::isBadStatus(status)) {
+        return BadResult(status);
+    }
+    return values;
+}
+
 std::vector<ApplicationDescription> Client::findServers(std::string_view serverUrl) {
+    const auto& discoveryCache = getContext().discoveryCache;
+    if (discoveryCache != nullptr) {
+        if (auto cached = discoveryCache->findServers(serverUrl)) {
+            return std::move(*cached).value();
+        }
+    }
     size_t arraySize{};
     UA_ApplicationDescription* array{};
     const auto status = UA_Client_findServers(
@@ -271,11 +620,27 @@ std::vector<ApplicationDescription> Client::findServers(std::string_view serverU
         std::make_move_iterator(array + arraySize)  // NOLINT
     );
     UA_free(array);  // NOLINT
+    if (discoveryCache != nullptr) {
+        discoveryCache->insertServers(serverUrl, toDiscoveryResult(status, result));
+    }
     detail::throwOnBadStatus(status);
     return result;
 }
 
 std::vector<EndpointDescription> Client::getEndpoints(std::string_view serverUrl) {
+    auto& cache = getContext().endpointCache;
+    if (cache.enabled) {
+        const auto it = cache.endpoints.find(std::string(serverUrl));
+        if (it != cache.endpoints.end()) {
+            return it->second;
+        }
+    }
+    const auto& discoveryCache = getContext().discoveryCache;
+    if (discoveryCache != nullptr) {
+        if (auto cached = discoveryCache->findEndpoints(serverUrl)) {
+            return std::move(*cached).value();
+        }
+    }
     size_t arraySize{};
     UA_EndpointDescription* array{};
     const auto status = UA_Client_getEndpoints(
@@ -289,14 +654,49 @@ std::vector<EndpointDescription> Client::getEndpoints(std::string_view serverUrl
         std::make_move_iterator(array + arraySize)  // NOLINT
     );
     UA_free(array);  // NOLINT
+    if (discoveryCache != nullptr) {
+        discoveryCache->insertEndpoints(serverUrl, toDiscoveryResult(status, result));
+    }
     detail::throwOnBadStatus(status);
+    if (cache.enabled) {
+        cache.endpoints[std::string(serverUrl)] = result;
+    }
     return result;
 }
 
+void Client::setEndpointCaching(bool enable) {
+    getContext().endpointCache.enabled = enable;
+    if (!enable) {
+        clearEndpointCache();
+    }
+}
+
+void Client::clearEndpointCache() noexcept {
+    auto& cache = getContext().endpointCache;
+    cache.endpoints.clear();
+    cache.selected.clear();
+}
+
+void Client::setDiscoveryCache(std::shared_ptr<DiscoveryCache> cache) {
+    getContext().discoveryCache = std::move(cache);
+}
+
+std::shared_ptr<DiscoveryCache> Client::getDiscoveryCache() noexcept {
+    return getContext().discoveryCache;
+}
+
+void Client::setAdaptiveRequestSizing(std::optional<AdaptiveRequestSizing> options) {
+    getContext().requestSizing = options;
+}
+
 void Client::setLogger(Logger logger) {
     connection_->getCustomLogger().setLogger(std::move(logger));
 }
 
+void Client::setLogger(Logger logger, const LoggerOptions& options) {
+    connection_->getCustomLogger().setLogger(std::move(logger), options);
+}
+
 void Client::setTimeout(uint32_t milliseconds) {
     getConfig(this)->timeout = milliseconds;
 }
@@ -305,10 +705,59 @@ void Client::setSecurityMode(MessageSecurityMode mode) {
     getConfig(this)->securityMode = static_cast<UA_MessageSecurityMode>(mode);
 }
 
+static void mergeSocketOptions(TransportConfig& options, const TransportConfig& config) noexcept {
+    if (config.noDelay) {
+        options.noDelay = config.noDelay;
+    }
+    if (config.socketSendBufferSize) {
+        options.socketSendBufferSize = config.socketSendBufferSize;
+    }
+    if (config.socketRecvBufferSize) {
+        options.socketRecvBufferSize = config.socketRecvBufferSize;
+    }
+}
+
+static void applyTransportConfig(UA_ConnectionConfig& native, const TransportConfig& config) {
+    if (config.sendBufferSize) {
+        native.sendBufferSize = *config.sendBufferSize;
+    }
+    if (config.recvBufferSize) {
+        native.recvBufferSize = *config.recvBufferSize;
+    }
+    if (config.maxMessageSize) {
+        native.localMaxMessageSize = *config.maxMessageSize;
+    }
+    if (config.maxChunkCount) {
+        native.localMaxChunkCount = *config.maxChunkCount;
+    }
+}
+
+void Client::setSecureChannelOptions(const SecureChannelOptions& options) {
+    auto* config = getConfig(this);
+    TransportConfig transport;
+    transport.sendBufferSize = options.chunkSize;
+    transport.recvBufferSize = options.chunkSize;
+    transport.maxMessageSize = options.maxMessageSize;
+    transport.maxChunkCount = options.maxChunkCount;
+    applyTransportConfig(config->localConnectionConfig, transport);
+    if (options.lifetime) {
+        config->secureChannelLifeTime = *options.lifetime;
+    }
+}
+
+void Client::setTransportConfig(const TransportConfig& config) {
+    applyTransportConfig(getConfig(this)->localConnectionConfig, config);
+    mergeSocketOptions(getContext().socketOptions, config);
+}
+
 void Client::setCustomDataTypes(std::vector<DataType> dataTypes) {
     connection_->getCustomDataTypes().setCustomDataTypes(std::move(dataTypes));
 }
 
+void Client::setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry) {
+    connection_->getCustomDataTypes().setRegistry(std::move(registry));
+}
+
 static void setStateCallback(ClientContext& context, ClientState state, StateCallback&& callback) {
     context.stateCallbacks.at(static_cast<size_t>(state)) = std::move(callback);
 }
@@ -329,25 +778,76 @@ void Client::onSessionClosed(StateCallback callback) {
     setStateCallback(getContext(), ClientState::SessionClosed, std::move(callback));
 }
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+void Client::onSubscriptionRecreated(SubscriptionRecreatedCallback callback) {
+    getContext().subscriptionRecreatedCallback = std::move(callback);
+}
+
+void Client::onNotificationGap(NotificationGapCallback callback) {
+    getContext().notificationGapCallback = std::move(callback);
+}
+#endif
+
 void Client::connect(std::string_view endpointUrl) {
-    const auto status = UA_Client_connect(handle(), std::string(endpointUrl).c_str());
+    auto& reconnect = getContext().reconnect;
+    reconnect.pending = false;
+    reconnect.endpointUrl = endpointUrl;
+    reconnect.login.reset();
+    const auto status =
+        connectCached(handle(), getContext(), reconnect.endpointUrl, reconnect.login);
+    if (detail::isBadStatus(status)) {
+        reconnect.endpointUrl.clear();
+    }
     detail::throwOnBadStatus(status);
 }
 
 void Client::connect(std::string_view endpointUrl, const Login& login) {
-#if UAPP_OPEN62541_VER_LE(1, 0)
-    const auto func = UA_Client_connect_username;
+    auto& reconnect = getContext().reconnect;
+    reconnect.pending = false;
+    reconnect.endpointUrl = endpointUrl;
+    reconnect.login = login;
+    const auto status =
+        connectCached(handle(), getContext(), reconnect.endpointUrl, reconnect.login);
+    if (detail::isBadStatus(status)) {
+        reconnect.endpointUrl.clear();
+        reconnect.login.reset();
+    }
+    detail::throwOnBadStatus(status);
+}
+
+void Client::connect([[maybe_unused]] Server& server) {
+#ifdef UAPP_IN_PROCESS_CONNECTION
+    getContext().inProcessHub = server.getContext().inProcessHub;
+    connect(detail::inProcessUrl);
 #else
-    const auto func = UA_Client_connectUsername;
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+void Client::connect([[maybe_unused]] Server& server, [[maybe_unused]] const Login& login) {
+#ifdef UAPP_IN_PROCESS_CONNECTION
+    getContext().inProcessHub = server.getContext().inProcessHub;
+    connect(detail::inProcessUrl, login);
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
 #endif
-    const auto status = func(
-        handle(), std::string(endpointUrl).c_str(), login.username.c_str(), login.password.c_str()
-    );
-    detail::throwOnBadStatus(status);
 }
 
 void Client::disconnect() noexcept {
+    auto& reconnect = getContext().reconnect;
+    reconnect.pending = false;
+    reconnect.endpointUrl.clear();
+    reconnect.login.reset();
     UA_Client_disconnect(handle());
+    getContext().socketFd = -1;
+}
+
+void Client::setReconnect(std::optional<ReconnectOptions> options) {
+    auto& reconnect = getContext().reconnect;
+    reconnect.options = options;
+    if (!options.has_value()) {
+        reconnect.pending = false;
+    }
 }
 
 bool Client::isConnected() noexcept {
@@ -361,8 +861,126 @@ bool Client::isConnected() noexcept {
 }
 
 std::vector<std::string> Client::getNamespaceArray() {
-    return services::readValue(*this, {0, UA_NS0ID_SERVER_NAMESPACEARRAY})
-        .getArrayCopy<std::string>();
+    static constexpr NumericNodeId namespaceArrayId(VariableId::Server_NamespaceArray);
+    return services::readValue(*this, namespaceArrayId).getArrayCopy<std::string>();
+}
+
+std::shared_ptr<const NamespaceTable> Client::getNamespaceTable() {
+    auto& cache = getContext().namespaceTable;
+    auto table = std::atomic_load(&cache);
+    if (table == nullptr) {
+        table = std::make_shared<const NamespaceTable>(getNamespaceArray());
+        std::atomic_store(&cache, table);
+    }
+    return table;
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+MonitoredItem<Client> Client::trackNamespaceArray(Subscription<Client>& subscription) {
+    return subscription.subscribeDataChange(
+        NodeId(VariableId::Server_NamespaceArray),
+        AttributeId::Value,
+        [context = &getContext()](const MonitoredItem<Client>&, const DataValue& dv) {
+            if (!dv.hasValue()) {
+                return;
+            }
+            auto table = std::make_shared<const NamespaceTable>(
+                dv.getValue().getArrayCopy<std::string>()
+            );
+            std::atomic_store(&context->namespaceTable, std::move(table));
+        }
+    );
+}
+#endif
+
+void Client::setBrowseCache(std::shared_ptr<BrowseCache> cache) {
+    getContext().browseCache = std::move(cache);
+}
+
+std::shared_ptr<BrowseCache> Client::getBrowseCache() noexcept {
+    return getContext().browseCache;
+}
+
+void Client::setAttributeCache(std::shared_ptr<NodeAttributeCache> cache) {
+    getContext().attributeCache = std::move(cache);
+}
+
+std::shared_ptr<NodeAttributeCache> Client::getAttributeCache() noexcept {
+    return getContext().attributeCache;
+}
+
+void Client::setNodeIdPool(std::shared_ptr<NodeIdPool> pool) {
+    getContext().nodeIdPool = std::move(pool);
+}
+
+std::shared_ptr<NodeIdPool> Client::getNodeIdPool() noexcept {
+    return getContext().nodeIdPool;
+}
+
+void Client::setWriteCoalescer(std::shared_ptr<WriteCoalescer> coalescer) {
+    getContext().writeCoalescer = std::move(coalescer);
+}
+
+std::shared_ptr<WriteCoalescer> Client::getWriteCoalescer() noexcept {
+    return getContext().writeCoalescer;
+}
+
+void Client::registerHotNodes(Span<const NodeId> ids) {
+    if (ids.empty()) {
+        return;
+    }
+    auto& context = getContext();
+    const std::lock_guard lock(context.mutex);
+    const RegisterNodesRequest request(RequestHeader(), ids);
+    RegisterNodesResponse response = detail::invokeService(*this, StatisticsService::Browse, [&] {
+        return UA_Client_Service_registerNodes(handle(), *request.handle());
+    });
+    throwOnBadStatus(response->responseHeader.serviceResult);
+    const auto registered = response.getRegisteredNodeIds();
+    if (registered.size() != ids.size()) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    auto& registeredNodes = context.registeredNodes;
+    auto aliases = registeredNodes.aliases != nullptr
+                       ? std::make_shared<detail::NodeAliases>(*registeredNodes.aliases)
+                       : std::make_shared<detail::NodeAliases>();
+    for (size_t i = 0; i < ids.size(); ++i) {
+        aliases->insert_or_assign(ids[i], registered[i]);
+    }
+    registeredNodes.aliases = std::move(aliases);
+}
+
+void Client::unregisterHotNodes(Span<const NodeId> ids) {
+    auto& context = getContext();
+    const std::lock_guard lock(context.mutex);
+    auto& registeredNodes = context.registeredNodes;
+    if (registeredNodes.aliases == nullptr) {
+        return;
+    }
+    auto aliases = std::make_shared<detail::NodeAliases>(*registeredNodes.aliases);
+    std::vector<NodeId> unregister;
+    for (const auto& id : ids) {
+        const auto it = aliases->find(id);
+        if (it != aliases->end()) {
+            unregister.push_back(std::move(it->second));
+            aliases->erase(it);
+        }
+    }
+    const bool outdated = registeredNodes.outdated;
+    if (aliases->empty()) {
+        registeredNodes.aliases = nullptr;
+        registeredNodes.outdated = false;
+    } else {
+        registeredNodes.aliases = std::move(aliases);
+    }
+    if (unregister.empty() || outdated || !isConnected()) {
+        return;  // aliases of a previous session are invalid anyway
+    }
+    const UnregisterNodesRequest request(RequestHeader(), unregister);
+    UnregisterNodesResponse response = detail::invokeService(*this, StatisticsService::Browse, [&] {
+        return UA_Client_Service_unregisterNodes(handle(), *request.handle());
+    });
+    throwOnBadStatus(response->responseHeader.serviceResult);
 }
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -387,12 +1005,52 @@ std::vector<Subscription<Client>> Client::getSubscriptions() {
 }
 #endif
 
+PollGroup Client::createPollGroup(const PollGroupParameters& parameters) {
+    auto& context = getContext();
+    const std::lock_guard lock(context.mutex);
+    const uint32_t pollGroupId = context.nextPollGroupId++;
+    auto& group = context.pollGroups[pollGroupId];
+    group.parameters = parameters;
+    group.nextPoll = std::chrono::steady_clock::now();
+    return {*this, pollGroupId};
+}
+
+std::vector<PollGroup> Client::getPollGroups() {
+    auto& context = getContext();
+    const std::lock_guard lock(context.mutex);
+    std::vector<PollGroup> result;
+    result.reserve(context.pollGroups.size());
+    for (const auto& [pollGroupId, _] : context.pollGroups) {
+        result.emplace_back(*this, pollGroupId);
+    }
+    return result;
+}
+
 void Client::runIterate(uint16_t timeoutMilliseconds) {
-    connection_->runIterate(timeoutMilliseconds);
+    if (connection_->isRunningInBackground()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    connection_->runIterate(*this, timeoutMilliseconds);
+}
+
+void Client::processEvents() {
+    runIterate(0);
+}
+
+int Client::getSocketFd() const noexcept {
+    return connection_->getContext().socketFd;
+}
+
+std::chrono::milliseconds Client::getNextTimeout() const noexcept {
+    return connection_->getNextTimeout();
 }
 
 void Client::run() {
-    connection_->run();
+    connection_->run(*this);
+}
+
+void Client::runInBackground(uint16_t timeoutMilliseconds) {
+    connection_->runInBackground(*this, timeoutMilliseconds);
 }
 
 void Client::stop() {
@@ -403,6 +1061,18 @@ bool Client::isRunning() const noexcept {
     return connection_->isRunning();
 }
 
+Statistics& Client::getStatistics() noexcept {
+    return getContext().statistics;
+}
+
+void Client::setTracer(std::shared_ptr<Tracer> tracer) {
+    getContext().tracer = std::move(tracer);
+}
+
+void Client::setThreadConfig(const ThreadConfig& config) {
+    getContext().eventLoopThreadConfig = config;
+}
+
 Node<Client> Client::getNode(NodeId id) {
     return {*this, std::move(id)};
 }
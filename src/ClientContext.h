@@ -1,17 +1,47 @@
 #pragma once
 
+#include <algorithm>
 #include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <cmath>
+#include <functional>
 #include <map>
 #include <memory>
-#include <utility>  // pair
+#include <optional>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
 
+#include "open62541pp/AccessControl.h"  // Login
+#include "open62541pp/BrowseCache.h"
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/Discovery.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/EventFilterBuilder.h"  // SharedEventFilter
+#include "open62541pp/NodeAttributeCache.h"
+#include "open62541pp/NodeIdPool.h"
+#include "open62541pp/NotificationQueue.h"
+#include "open62541pp/PollGroup.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/Tracer.h"
+#include "open62541pp/WriteCoalescer.h"
 #include "open62541pp/services/MonitoredItem.h"
 #include "open62541pp/services/Subscription.h"
+#include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
+#include "open62541pp/types/Variant.h"
 
+#include "InProcessConnection.h"
+#include "detail/AdaptiveRequestSize.h"
+#include "detail/LastReportedValue.h"
+#include "detail/ObjectPool.h"
+#include "detail/ReentrantMutex.h"
+#include "detail/SubscriptionHealth.h"
 #include "open62541_impl.h"
 
 namespace opcua {
@@ -31,23 +61,259 @@ inline constexpr size_t clientStateCount = 4;
 class ClientContext {
 public:
 #ifdef UA_ENABLE_SUBSCRIPTIONS
-    struct Subscription {
-        services::DeleteSubscriptionCallback deleteCallback;
-    };
-
     struct MonitoredItem {
-        ReadValueId itemToMonitor;
+        ReadValueId itemToMonitor;  // without node id if interned
+        std::optional<InternedNodeId> internedNodeId;
         services::DataChangeNotificationCallback dataChangeCallback;
         services::EventNotificationCallback eventCallback;
         services::DeleteMonitoredItemCallback deleteCallback;
+        std::optional<services::ClientDataChangeFilter> clientFilter;
+        detail::LastReportedValue lastReported;
+        /// Shared event filter, referenced by the filter of `parameters` instead of a copy.
+        std::optional<SharedEventFilter> eventFilter;
+        /// Requested monitoring mode and parameters to recreate the item after a session loss.
+        MonitoringMode monitoringMode{MonitoringMode::Reporting};
+        services::MonitoringParameters parameters;
+        /// Timestamp of the last data change, to skip duplicates of republished notifications.
+        UA_DateTime lastTimestamp{0};
+        /// Set after a subscription transfer, the initial value sent with the next Publish is
+        /// skipped if it isn't newer than the last delivered value.
+        bool transferred{false};
+
+        /// Store the item to monitor, the node id is interned if a pool is given.
+        void setItemToMonitor(const ReadValueId& item, NodeIdPool* pool) {
+            if (pool == nullptr) {
+                itemToMonitor = item;
+                internedNodeId.reset();
+                return;
+            }
+            UA_ReadValueId native = *item.handle();  // shallow copy
+            native.nodeId = UA_NODEID_NULL;
+            itemToMonitor = asWrapper<ReadValueId>(native);  // deep copy without node id
+            internedNodeId = pool->intern(item.getNodeId());
+        }
+
+        const NodeId& getNodeId() const noexcept {
+            return internedNodeId.has_value() ? internedNodeId->get() : itemToMonitor.getNodeId();
+        }
     };
 
     using SubId = uint32_t;
     using MonId = uint32_t;
-    using SubMonId = std::pair<uint32_t, uint32_t>;
 
-    std::map<SubId, std::unique_ptr<Subscription>> subscriptions;
-    std::map<SubMonId, std::unique_ptr<MonitoredItem>> monitoredItems;
+    struct Subscription {
+        services::DeleteSubscriptionCallback deleteCallback;
+        services::DataChangeBatchCallback dataChangeBatchCallback;
+        std::shared_ptr<NotificationQueue> notificationQueue;
+        /// Collected data changes, dispatched with dispatchDataChangeBatches.
+        std::vector<services::DataChangeNotification> pendingDataChanges;
+        /// Monitored items of the subscription (owned by ClientContext::monitoredItemPool).
+        std::unordered_map<MonId, MonitoredItem*> monitoredItems;
+        /// Current (revised) subscription parameters.
+        services::SubscriptionParameters parameters;
+        bool publishingEnabled{true};
+        /// Received notifications since the last evaluation of the adaptive publishing.
+        size_t notificationCount{0};
+        /// Counters of Subscription::getStatistics.
+        detail::SubscriptionHealth health;
+
+        struct AdaptivePublishing {
+            services::AdaptivePublishingPolicy policy;
+            double keepAlivePeriod{0.0};  // ms
+            double lifetimePeriod{0.0};  // ms
+            uint16_t publishRequests{1};
+            std::chrono::steady_clock::time_point windowStart;
+        };
+
+        std::optional<AdaptivePublishing> adaptivePublishing;
+    };
+
+    std::unordered_map<SubId, std::unique_ptr<Subscription>> subscriptions;
+    detail::ObjectPool<MonitoredItem> monitoredItemPool;
+
+    MonitoredItem* findMonitoredItem(SubId subId, MonId monId) noexcept {
+        const auto sub = subscriptions.find(subId);
+        if (sub == subscriptions.end()) {
+            return nullptr;
+        }
+        const auto mon = sub->second->monitoredItems.find(monId);
+        return mon == sub->second->monitoredItems.end() ? nullptr : mon->second;
+    }
+
+    /// Insert monitored item acquired from the pool, replacing an existing item with the same id.
+    void insertMonitoredItem(SubId subId, MonId monId, MonitoredItem* item) {
+        auto& sub = subscriptions[subId];
+        if (sub == nullptr) {
+            sub = std::make_unique<Subscription>();
+        }
+        auto [it, inserted] = sub->monitoredItems.try_emplace(monId, item);
+        if (!inserted) {
+            monitoredItemPool.release(it->second);
+            it->second = item;
+        }
+    }
+
+    void eraseMonitoredItem(SubId subId, MonId monId) noexcept {
+        const auto sub = subscriptions.find(subId);
+        if (sub == subscriptions.end()) {
+            return;
+        }
+        auto& items = sub->second->monitoredItems;
+        const auto mon = items.find(monId);
+        if (mon != items.end()) {
+            monitoredItemPool.release(mon->second);
+            items.erase(mon);
+        }
+    }
+
+    /// Subscriptions with pending data changes.
+    std::vector<SubId> pendingDataChangeBatches;
+
+    void dispatchDataChangeBatches() {
+        if (pendingDataChangeBatches.empty()) {
+            return;
+        }
+        std::vector<SubId> subIds;
+        subIds.swap(pendingDataChangeBatches);
+        std::vector<services::DataChangeNotification> batch;
+        for (const auto subId : subIds) {
+            auto it = subscriptions.find(subId);
+            if (it == subscriptions.end()) {
+                continue;
+            }
+            batch.swap(it->second->pendingDataChanges);
+            // copy, the subscription might be deleted within the callback
+            auto callback = it->second->dataChangeBatchCallback;
+            if (callback && !batch.empty()) {
+                detail::invokeCatchIgnore([&] { callback(subId, batch); });
+            }
+            batch.clear();
+            it = subscriptions.find(subId);
+            if (it != subscriptions.end() && it->second->pendingDataChanges.empty()) {
+                batch.swap(it->second->pendingDataChanges);  // keep capacity
+            }
+        }
+    }
+
+    /// Evaluate and retune subscriptions with adaptive publishing.
+    void tuneAdaptivePublishing(UA_Client* client) noexcept {
+        const auto now = std::chrono::steady_clock::now();
+        std::vector<SubId> dueSubIds;
+        for (const auto& [subId, sub] : subscriptions) {
+            const auto& adaptive = sub->adaptivePublishing;
+            if (adaptive.has_value() &&
+                std::chrono::duration<double, std::milli>(now - adaptive->windowStart).count() >=
+                    adaptive->policy.evaluationInterval) {
+                dueSubIds.push_back(subId);
+            }
+        }
+        if (dueSubIds.empty()) {
+            return;
+        }
+        // the synchronous modify request runs the client, subscriptions might be deleted meanwhile
+        for (const auto subId : dueSubIds) {
+            const auto it = subscriptions.find(subId);
+            if (it != subscriptions.end() && it->second->adaptivePublishing.has_value()) {
+                retunePublishing(client, subId, *it->second, now);
+            }
+        }
+        uint16_t publishRequests = 0;
+        for (const auto& [subId, sub] : subscriptions) {
+            if (sub->adaptivePublishing.has_value()) {
+                publishRequests =
+                    std::max(publishRequests, sub->adaptivePublishing->publishRequests);
+            }
+        }
+        if (publishRequests > 0) {
+            UA_Client_getConfig(client)->outStandingPublishRequests = publishRequests;
+        }
+    }
+
+    void retunePublishing(
+        UA_Client* client,
+        SubId subId,
+        Subscription& sub,
+        std::chrono::steady_clock::time_point now
+    ) noexcept {
+        auto& adaptive = *sub.adaptivePublishing;
+        const auto& policy = adaptive.policy;
+        const auto& current = sub.parameters;
+        const double elapsed =
+            std::chrono::duration<double, std::milli>(now - adaptive.windowStart).count();
+        const double rate = static_cast<double>(sub.notificationCount) * 1000.0 / elapsed;
+        sub.notificationCount = 0;
+        adaptive.windowStart = now;
+
+        const bool backlog = sub.notificationQueue != nullptr &&
+                             sub.notificationQueue->size() > sub.notificationQueue->capacity() / 2;
+        // publish responses filled up to the limit -> more notifications are queued in the server
+        const bool saturated = current.maxNotificationsPerPublish > 0 &&
+                               rate * current.publishingInterval / 1000.0 >=
+                                   static_cast<double>(current.maxNotificationsPerPublish);
+
+        double interval = current.publishingInterval;
+        if (backlog || rate > policy.maxNotificationsPerSecond) {
+            interval *= 2.0;
+        } else if (rate < policy.maxNotificationsPerSecond / 4.0) {
+            interval /= 2.0;
+        }
+        interval = std::clamp(interval, policy.minPublishingInterval, policy.maxPublishingInterval);
+
+        if (saturated && !backlog) {
+            adaptive.publishRequests = std::min<uint16_t>(
+                adaptive.publishRequests + 1, policy.maxPublishRequests
+            );
+        } else if (!saturated) {
+            adaptive.publishRequests = std::max<uint16_t>(
+                adaptive.publishRequests - 1, policy.minPublishRequests
+            );
+        }
+
+        const auto maxNotificationsPerPublish = static_cast<uint32_t>(
+            std::max(1.0, std::ceil(policy.maxNotificationsPerSecond * interval / 1000.0))
+        );
+        if (interval == current.publishingInterval &&
+            maxNotificationsPerPublish == current.maxNotificationsPerPublish) {
+            return;
+        }
+
+        UA_ModifySubscriptionRequest request{};
+        request.subscriptionId = subId;
+        request.requestedPublishingInterval = interval;
+        request.requestedMaxKeepAliveCount =
+            static_cast<uint32_t>(std::max(1.0, std::round(adaptive.keepAlivePeriod / interval)));
+        request.requestedLifetimeCount = std::max(
+            3 * request.requestedMaxKeepAliveCount,
+            static_cast<uint32_t>(std::round(adaptive.lifetimePeriod / interval))
+        );
+        request.maxNotificationsPerPublish = maxNotificationsPerPublish;
+        request.priority = current.priority;
+
+        UA_ModifySubscriptionResponse response = UA_Client_Subscriptions_modify(client, request);
+        if (response.responseHeader.serviceResult == UA_STATUSCODE_GOOD) {
+            // subscription might be deleted while processing the request
+            const auto it = subscriptions.find(subId);
+            if (it != subscriptions.end()) {
+                auto& parameters = it->second->parameters;
+                parameters.publishingInterval = response.revisedPublishingInterval;
+                parameters.lifetimeCount = response.revisedLifetimeCount;
+                parameters.maxKeepAliveCount = response.revisedMaxKeepAliveCount;
+                parameters.maxNotificationsPerPublish = maxNotificationsPerPublish;
+            }
+        }
+        UA_clear(&response, &UA_TYPES[UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE]);
+    }
+
+    void eraseSubscription(SubId subId) noexcept {
+        const auto sub = subscriptions.find(subId);
+        if (sub == subscriptions.end()) {
+            return;
+        }
+        for (const auto& [monId, item] : sub->second->monitoredItems) {
+            monitoredItemPool.release(item);
+        }
+        subscriptions.erase(sub);
+    }
 #endif
 
 #if UAPP_OPEN62541_VER_LE(1, 0)
@@ -57,6 +323,148 @@ public:
     UA_SessionState lastSessionState{};
 #endif
     std::array<StateCallback, clientStateCount> stateCallbacks;
+
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+    /// Connection init function of the network layer, wrapped to capture the socket.
+    decltype(UA_ClientConfig::initConnectionFunc) initConnectionFunc{nullptr};
+    /// Connection poll function of the network layer, wrapped to establish reverse connections.
+    decltype(UA_ClientConfig::pollConnectionFunc) pollConnectionFunc{nullptr};
+#endif
+    /// Socket of the current connection, see Client::getSocketFd.
+    int socketFd{-1};
+    /// Socket options of Client::setTransportConfig, applied to the socket of every connect.
+    TransportConfig socketOptions;
+    /// Socket of a reverse connect, consumed by the next connect (see ReverseConnectListener).
+    int reverseSocketFd{-1};
+#ifdef UAPP_IN_PROCESS_CONNECTION
+    /// Server of in-process connections, used by connects to detail::inProcessUrl.
+    std::shared_ptr<detail::InProcessHub> inProcessHub;
+#endif
+
+    /// Automatic reconnect, driven by Client::runIterate.
+    struct Reconnect {
+        std::optional<ReconnectOptions> options;
+        std::string endpointUrl;  // empty if not connected or disconnected explicitly
+        std::optional<Login> login;
+        bool pending{false};
+        size_t attempts{0};
+        std::chrono::milliseconds delay{0};
+        std::chrono::steady_clock::time_point nextAttempt;
+    } reconnect;
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    SubscriptionRecreatedCallback subscriptionRecreatedCallback;
+    NotificationGapCallback notificationGapCallback;
+#endif
+
+    /// Cached endpoints, see Client::setEndpointCaching.
+    struct EndpointCache {
+        bool enabled{false};
+        /// Results of Client::getEndpoints by server URL.
+        std::unordered_map<std::string, std::vector<EndpointDescription>> endpoints;
+
+        struct Selected {
+            EndpointDescription endpoint;
+            UserTokenPolicy userTokenPolicy;
+            bool login{false};  // selected for a username login
+        };
+
+        /// Endpoint selected by the last successful connect by endpoint URL.
+        std::unordered_map<std::string, Selected> selected;
+        /// Endpoint selection of the client config before the cache installed one, restored for
+        /// cache misses. Empty while the config holds no selection installed by the cache.
+        std::optional<Selected> configured;
+    } endpointCache;
+
+    /// Optional cache of discovery results, shared with other clients.
+    std::shared_ptr<DiscoveryCache> discoveryCache;
+
+    /// Optional cache of browse results.
+    std::shared_ptr<BrowseCache> browseCache;
+
+    /// Optional cache of static node attributes.
+    std::shared_ptr<NodeAttributeCache> attributeCache;
+
+    /// Optional pool to intern the node ids of monitored items.
+    std::shared_ptr<NodeIdPool> nodeIdPool;
+
+    /// Optional coalescer of value writes, flushed by Client::runIterate.
+    std::shared_ptr<WriteCoalescer> writeCoalescer;
+
+    struct PollItem {
+        ReadValueId itemToRead;
+        services::DataChangeNotificationCallback callback;
+        std::optional<services::ClientDataChangeFilter> clientFilter;
+        detail::LastReportedValue lastReported;
+    };
+
+    struct PollGroup {
+        PollGroupParameters parameters;
+        std::chrono::steady_clock::time_point nextPoll;
+        std::map<uint32_t, PollItem> items;
+        uint32_t nextItemId{1};
+        /// Outstanding read requests, the next poll is skipped if > 0.
+        size_t inFlight{0};
+        uint64_t skipped{0};
+    };
+
+    /// Poll groups by client-assigned id, polled by Client::runIterate.
+    std::map<uint32_t, PollGroup> pollGroups;
+    uint32_t nextPollGroupId{1};
+
+    /// Cached namespace table of the connected server, fetched on first use.
+    /// Accessed with `std::atomic_load`/`std::atomic_store`, it is replaced by monitored items.
+    std::shared_ptr<const NamespaceTable> namespaceTable;
+
+    /// Nodes registered with Client::registerHotNodes, guarded by mutex.
+    struct RegisteredNodes {
+        /// Requested node id -> alias returned by the server for the current session.
+        /// Immutable snapshot (`nullptr` if empty), replaced on changes to keep copies valid.
+        std::shared_ptr<const std::unordered_map<NodeId, NodeId>> aliases;
+        /// Session was re-created, the aliases are invalid until the nodes are registered again.
+        bool outdated{false};
+    } registeredNodes;
+
+    /// Latency statistics of synchronous services.
+    Statistics statistics;
+
+    /// Optional tracer of synchronous services.
+    std::shared_ptr<Tracer> tracer;
+
+    /// Lock of services and the event loop, required if the event loop runs in the background.
+    detail::ReentrantMutex mutex;
+
+    /// Configuration of the background event loop thread.
+    ThreadConfig eventLoopThreadConfig;
+
+    /// Id of the background event loop thread (default-constructed if not running).
+    std::atomic<std::thread::id> eventLoopThreadId{};
+
+    /// Check if requests of the current thread are multiplexed over the background event loop.
+    bool isMultiplexed() const noexcept {
+        const auto id = eventLoopThreadId.load();
+        return id != std::thread::id() && id != std::this_thread::get_id();
+    }
+
+    /// Callbacks of pending asynchronous requests by request id (type-erased response).
+    std::map<uint32_t, std::function<void(void* response)>> asyncCallbacks;
+
+    /// Operation limits of the connected server (0 = no limit), fetched on first use.
+    struct OperationLimits {
+        bool fetched{false};
+        uint32_t maxNodesPerRead{0};
+        uint32_t maxNodesPerWrite{0};
+        uint32_t maxMonitoredItemsPerCall{0};
+        uint32_t maxNodesPerNodeManagement{0};
+        uint32_t maxNodesPerBrowse{0};
+        uint32_t maxNodesPerTranslateBrowsePaths{0};
+        uint32_t maxNodesPerMethodCall{0};
+        uint32_t maxNodesPerHistoryReadData{0};
+    } operationLimits;
+
+    /// Adaptive request sizing of batched services (disabled if empty).
+    std::optional<AdaptiveRequestSizing> requestSizing;
+    /// Adaptive request sizes indexed by StatisticsService.
+    std::array<detail::AdaptiveRequestSize, 8> requestSizes;
 };
 
 /* ---------------------------------------------------------------------------------------------- */
@@ -68,4 +476,16 @@ inline ClientContext& getContext(UA_Client* client) {
     return *static_cast<ClientContext*>(context);
 }
 
+namespace detail {
+
+/// Send the read requests of due poll groups, called by Client::runIterate.
+void pollDueGroups(Client& client);
+
+/// Remaining time until the next poll, `std::nullopt` if no poll group exists.
+std::optional<std::chrono::steady_clock::duration> getNextPoll(
+    const ClientContext& context
+) noexcept;
+
+}  // namespace detail
+
 }  // namespace opcua
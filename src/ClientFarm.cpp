@@ -0,0 +1,350 @@
+#include "open62541pp/ClientFarm.h"
+
+#include <algorithm>  // min, max
+#include <cstdint>
+#include <iterator>  // make_move_iterator
+#include <random>
+#include <thread>
+#include <utility>  // move
+
+#ifndef _WIN32
+#include <poll.h>
+#endif
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"
+
+#include "open62541_impl.h"
+#include "services/AsyncService.h"
+
+namespace opcua {
+
+using Clock = std::chrono::steady_clock;
+
+/// Maximum wait period of an event loop iteration, e.g. to notice stop requests.
+static constexpr std::chrono::milliseconds maxWait{100};
+/// Poll interval of connecting clients without a socket yet.
+static constexpr std::chrono::milliseconds connectPollInterval{10};
+
+struct ClientFarm::Endpoint {
+    size_t index{0};
+    ClientFarmEndpoint config;
+    std::unique_ptr<Client> client;
+    std::atomic<ClientFarmState> state{ClientFarmState::Disconnected};
+    bool failed{false};  // connection lost within the last iteration
+    bool readPending{false};
+    uint64_t session{0};  // incremented with every connect, identifies stale responses
+    size_t attempts{0};
+    std::chrono::milliseconds delay{0};
+    Clock::time_point nextConnect;
+    Clock::time_point connectDeadline;
+    Clock::time_point nextRead;
+    Clock::time_point nextProcess;
+};
+
+struct ClientFarm::Worker {
+    std::vector<Endpoint*> endpoints;
+    std::vector<ClientFarmResult> results;  // collected within an iteration
+    std::minstd_rand random;
+    std::thread thread;
+};
+
+ClientFarm::ClientFarm(ClientFarmOptions options, ClientFactory factory)
+    : options_(std::move(options)),
+      factory_(std::move(factory)) {
+    options_.threads = std::max<size_t>(options_.threads, 1);
+}
+
+ClientFarm::~ClientFarm() {
+    stop();
+}
+
+void ClientFarm::setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry) {
+    dataTypes_ = std::move(registry);
+    for (auto& endpoint : endpoints_) {
+        endpoint->client->setCustomDataTypes(dataTypes_);
+    }
+}
+
+void ClientFarm::setSink(Sink sink) {
+    sink_ = std::move(sink);
+}
+
+size_t ClientFarm::addEndpoint(ClientFarmEndpoint endpoint) {
+    if (isRunning()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    auto entry = std::make_unique<Endpoint>();
+    entry->index = endpoints_.size();
+    entry->client = factory_ ? factory_(endpoint) : std::make_unique<Client>();
+    if (entry->client == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    entry->config = std::move(endpoint);
+    entry->client->setLogger({});  // thousands of clients, log connection states via the sink
+    if (dataTypes_ != nullptr) {
+        entry->client->setCustomDataTypes(dataTypes_);
+    }
+    auto& ref = *entry;
+    ref.client->onSessionActivated([this, &ref] {
+        ref.state = ClientFarmState::Connected;
+        ref.attempts = 0;
+        ref.delay = options_.reconnect.initialDelay;
+        ref.nextRead = Clock::now();
+        ++connectedCount_;
+    });
+    ref.client->onDisconnected([&ref] { ref.failed = true; });
+    ref.client->onSessionClosed([&ref] { ref.failed = true; });
+    endpoints_.push_back(std::move(entry));
+    return endpoints_.size() - 1;
+}
+
+size_t ClientFarm::size() const noexcept {
+    return endpoints_.size();
+}
+
+ClientFarmState ClientFarm::getState(size_t endpoint) const {
+    return endpoints_.at(endpoint)->state;
+}
+
+size_t ClientFarm::getConnectedCount() const noexcept {
+    return connectedCount_;
+}
+
+void ClientFarm::start() {
+    if (running_.exchange(true)) {
+        return;
+    }
+    workers_.clear();
+    for (size_t i = 0; i < options_.threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+        workers_.back()->random.seed(static_cast<std::minstd_rand::result_type>(i + 1));
+    }
+    const auto now = Clock::now();
+    for (auto& endpoint : endpoints_) {
+        const size_t thread = endpoint->index % workers_.size();
+        const auto position = static_cast<int64_t>(workers_[thread]->endpoints.size());
+        endpoint->nextConnect = now + position * options_.connectStagger;
+        endpoint->delay = options_.reconnect.initialDelay;
+        workers_[thread]->endpoints.push_back(endpoint.get());
+    }
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        workers_[i]->thread = std::thread([this, &worker = *workers_[i], i] {
+            applyThreadConfig(options_.threadConfig, i);
+            run(worker);
+        });
+    }
+}
+
+void ClientFarm::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    for (auto& worker : workers_) {
+        worker->thread.join();
+    }
+    for (auto& endpoint : endpoints_) {
+        // pending read callbacks are invoked by the disconnect, drop them before they access the
+        // results of the worker
+        ++endpoint->session;
+        endpoint->client->disconnect();
+        endpoint->state = ClientFarmState::Disconnected;
+        endpoint->readPending = false;
+        endpoint->failed = false;
+    }
+    workers_.clear();
+    connectedCount_ = 0;
+}
+
+bool ClientFarm::isRunning() const noexcept {
+    return running_;
+}
+
+void ClientFarm::deliver(Span<ClientFarmResult> results) {
+    if (results.empty() || !sink_) {
+        return;
+    }
+    const std::lock_guard lock(sinkMutex_);
+    detail::invokeCatchIgnore(sink_, results);
+}
+
+void ClientFarm::connect(Endpoint& endpoint) {
+    auto& client = *endpoint.client;
+    ++endpoint.session;
+    endpoint.failed = false;
+    endpoint.state = ClientFarmState::Connecting;
+    endpoint.connectDeadline =
+        Clock::now() + std::chrono::milliseconds(UA_Client_getConfig(client.handle())->timeout);
+    endpoint.nextProcess = Clock::now();
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    if (!endpoint.config.login.has_value()) {
+        const auto status = UA_Client_connectAsync(
+            client.handle(), endpoint.config.endpointUrl.c_str()
+        );
+        endpoint.failed = detail::isBadStatus(status);
+        return;
+    }
+#endif
+    try {
+        if (endpoint.config.login.has_value()) {
+            client.connect(endpoint.config.endpointUrl, *endpoint.config.login);
+        } else {
+            client.connect(endpoint.config.endpointUrl);
+        }
+    } catch (const BadStatus&) {
+        endpoint.failed = true;
+    }
+}
+
+/// Disconnect and schedule the next connect attempt with a randomized exponential backoff.
+void ClientFarm::scheduleReconnect(Endpoint& endpoint, Worker& worker) {
+    const auto& options = options_.reconnect;
+    if (endpoint.state == ClientFarmState::Connected) {
+        --connectedCount_;
+    }
+    endpoint.client->disconnect();
+    endpoint.state = ClientFarmState::Disconnected;
+    endpoint.failed = false;
+    ++endpoint.attempts;
+    if (options.maxAttempts > 0 && endpoint.attempts > options.maxAttempts) {
+        endpoint.nextConnect = Clock::time_point::max();  // give up
+        return;
+    }
+    const auto delay = endpoint.delay;
+    std::uniform_int_distribution<int64_t> jitter(delay.count() / 2, delay.count());
+    endpoint.nextConnect = Clock::now() + std::chrono::milliseconds(jitter(worker.random));
+    endpoint.delay = std::min(
+        options.maxDelay,
+        std::chrono::duration_cast<std::chrono::milliseconds>(delay * options.backoffFactor)
+    );
+}
+
+void ClientFarm::sendRead(Endpoint& endpoint, Worker& worker) {
+    UA_ReadRequest request{};
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(endpoint.config.timestamps);
+    request.nodesToReadSize = endpoint.config.nodesToRead.size();
+    request.nodesToRead = asNative(endpoint.config.nodesToRead.data());
+    endpoint.readPending = true;
+    detail::sendAsyncRequest<ReadResponse>(
+        *endpoint.client,
+        request,
+        UA_TYPES[UA_TYPES_READREQUEST],
+        [&endpoint, &results = worker.results, session = endpoint.session](ReadResponse& response) {
+            if (session != endpoint.session) {
+                return;  // response of a previous connection
+            }
+            endpoint.readPending = false;
+            ClientFarmResult result;
+            result.endpoint = endpoint.index;
+            result.status = response->responseHeader.serviceResult;
+            result.timestamp = Clock::now();
+            if (result.status.isGood()) {
+                auto values = response.getResults();
+                result.values.assign(
+                    std::make_move_iterator(values.begin()), std::make_move_iterator(values.end())
+                );
+            }
+            results.push_back(std::move(result));
+        }
+    );
+}
+
+void ClientFarm::run(Worker& worker) {
+#ifndef _WIN32
+    std::vector<pollfd> fds;
+#endif
+    std::vector<Endpoint*> polled;
+    while (running_) {
+        auto now = Clock::now();
+        auto wake = now + maxWait;
+#ifndef _WIN32
+        fds.clear();
+#endif
+        polled.clear();
+        for (auto* endpoint : worker.endpoints) {
+            if (endpoint->state == ClientFarmState::Disconnected) {
+                if (now < endpoint->nextConnect) {
+                    wake = std::min(wake, endpoint->nextConnect);
+                    continue;
+                }
+                connect(*endpoint);
+            }
+            if (endpoint->state == ClientFarmState::Connecting &&
+                now > endpoint->connectDeadline) {
+                endpoint->failed = true;
+            }
+            if (endpoint->state == ClientFarmState::Connected && !endpoint->readPending &&
+                !endpoint->config.nodesToRead.empty()) {
+                if (now >= endpoint->nextRead) {
+                    try {
+                        sendRead(*endpoint, worker);
+                    } catch (const BadStatus&) {
+                        endpoint->failed = true;
+                    }
+                    endpoint->nextRead = now + endpoint->config.readInterval;
+                }
+                wake = std::min(wake, endpoint->nextRead);
+            }
+            if (endpoint->failed) {
+                scheduleReconnect(*endpoint, worker);
+                wake = std::min(wake, endpoint->nextConnect);
+                continue;
+            }
+            const int fd = endpoint->client->getSocketFd();
+            if (fd < 0) {
+                // connecting or socket not available, poll periodically
+                endpoint->nextProcess = std::min(endpoint->nextProcess, now + connectPollInterval);
+            }
+            wake = std::min(wake, endpoint->nextProcess);
+#ifndef _WIN32
+            if (fd >= 0) {
+                fds.push_back({fd, POLLIN, 0});
+                polled.push_back(endpoint);
+            }
+#endif
+        }
+
+        const auto timeout = std::max<int64_t>(
+            std::chrono::ceil<std::chrono::milliseconds>(wake - now).count(), 0
+        );
+#ifndef _WIN32
+        ::poll(fds.data(), fds.size(), static_cast<int>(timeout));
+        for (size_t i = 0; i < fds.size(); ++i) {
+            if (fds[i].revents != 0) {
+                polled[i]->nextProcess = Clock::time_point::min();  // ready
+            }
+        }
+#else
+        std::this_thread::sleep_for(std::chrono::milliseconds(std::min<int64_t>(timeout, 10)));
+        for (auto* endpoint : worker.endpoints) {
+            endpoint->nextProcess = Clock::time_point::min();  // no readiness, process all
+        }
+#endif
+
+        now = Clock::now();
+        for (auto* endpoint : worker.endpoints) {
+            if (endpoint->state == ClientFarmState::Disconnected || now < endpoint->nextProcess) {
+                continue;
+            }
+            try {
+                endpoint->client->processEvents();
+            } catch (const BadStatus&) {
+                endpoint->failed = true;
+            }
+            endpoint->nextProcess = now + endpoint->client->getNextTimeout();
+            if (endpoint->failed && endpoint->readPending) {
+                endpoint->readPending = false;
+                ClientFarmResult result;
+                result.endpoint = endpoint->index;
+                result.status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+                result.timestamp = now;
+                worker.results.push_back(std::move(result));
+            }
+        }
+        deliver(worker.results);
+        worker.results.clear();
+    }
+}
+
+}  // namespace opcua
@@ -0,0 +1,173 @@
+#include "open62541pp/ClientPool.h"
+
+#include <algorithm>  // max, min
+
+#include "open62541pp/AccessControl.h"  // Login
+#include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/services/Attribute.h"
+
+namespace opcua {
+
+ClientPool::ClientPool(size_t size, ClientFactory factory, ThreadConfig threadConfig) {
+    const size_t count = std::max<size_t>(size, 1);
+    clients_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        clients_.push_back(factory ? factory() : std::make_unique<Client>());
+        if (clients_.back() == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+    }
+    threads_.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        threads_.emplace_back([this, &client = *clients_[i], threadConfig, i] {
+            applyThreadConfig(threadConfig, i);
+            run(client);
+        });
+    }
+}
+
+ClientPool::~ClientPool() {
+    {
+        const std::lock_guard lock(mutex_);
+        running_ = false;
+    }
+    cv_.notify_all();
+    for (auto& thread : threads_) {
+        thread.join();
+    }
+    disconnect();
+}
+
+void ClientPool::setTimeout(uint32_t milliseconds) {
+    for (auto& client : clients_) {
+        client->setTimeout(milliseconds);
+    }
+}
+
+void ClientPool::setSecurityMode(MessageSecurityMode mode) {
+    for (auto& client : clients_) {
+        client->setSecurityMode(mode);
+    }
+}
+
+void ClientPool::setCustomDataTypes(const std::vector<DataType>& dataTypes) {
+    for (auto& client : clients_) {
+        client->setCustomDataTypes(dataTypes);
+    }
+}
+
+void ClientPool::setCustomDataTypes(const std::shared_ptr<const DataTypeRegistry>& registry) {
+    for (auto& client : clients_) {
+        client->setCustomDataTypes(registry);
+    }
+}
+
+void ClientPool::connect(std::string_view endpointUrl) {
+    for (auto& client : clients_) {
+        client->connect(endpointUrl);
+    }
+}
+
+void ClientPool::connect(std::string_view endpointUrl, const Login& login) {
+    for (auto& client : clients_) {
+        client->connect(endpointUrl, login);
+    }
+}
+
+void ClientPool::disconnect() noexcept {
+    for (auto& client : clients_) {
+        client->disconnect();
+    }
+}
+
+void ClientPool::post(Task task) {
+    {
+        const std::lock_guard lock(mutex_);
+        tasks_.push_back(std::move(task));
+    }
+    cv_.notify_one();
+}
+
+void ClientPool::run(Client& client) {
+    while (true) {
+        Task task;
+        {
+            std::unique_lock lock(mutex_);
+            cv_.wait(lock, [&] { return !running_ || !tasks_.empty(); });
+            if (tasks_.empty()) {
+                return;  // stopped and all pending tasks are done
+            }
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+        task(client);  // exceptions are stored in the future of the task
+    }
+}
+
+template <typename Result, typename F>
+std::vector<Result> ClientPool::dispatch(size_t size, F&& func) {
+    const size_t chunkSize = std::max<size_t>((size + clients_.size() - 1) / clients_.size(), 1);
+    std::vector<std::future<std::vector<Result>>> futures;
+    for (size_t offset = 0; offset < size; offset += chunkSize) {
+        const size_t count = std::min(chunkSize, size - offset);
+        futures.push_back(submit([&func, offset, count](Client& client) {
+            return func(client, offset, count);
+        }));
+    }
+    // wait for all chunks before the first exception is rethrown, the tasks reference `func`
+    for (auto& future : futures) {
+        future.wait();
+    }
+    std::vector<Result> results;
+    results.reserve(size);
+    for (auto& future : futures) {
+        auto chunk = future.get();
+        results.insert(
+            results.end(),
+            std::make_move_iterator(chunk.begin()),
+            std::make_move_iterator(chunk.end())
+        );
+    }
+    return results;
+}
+
+std::vector<DataValue> ClientPool::readAttributes(
+    Span<const ReadValueId> nodesToRead, TimestampsToReturn timestamps
+) {
+    const auto read = [&](Client& client, size_t offset, size_t count) {
+        return services::readAttributes(client, nodesToRead.subview(offset, count), timestamps);
+    };
+    return dispatch<DataValue>(nodesToRead.size(), read);
+}
+
+std::vector<DataValue> ClientPool::readValues(
+    Span<const NodeId> ids, TimestampsToReturn timestamps
+) {
+    return dispatch<DataValue>(ids.size(), [&](Client& client, size_t offset, size_t count) {
+        return services::readValues(client, ids.subview(offset, count), timestamps);
+    });
+}
+
+std::vector<StatusCode> ClientPool::writeAttributes(Span<const WriteValue> nodesToWrite) {
+    const auto write = [&](Client& client, size_t offset, size_t count) {
+        return services::writeAttributes(client, nodesToWrite.subview(offset, count));
+    };
+    return dispatch<StatusCode>(nodesToWrite.size(), write);
+}
+
+std::vector<StatusCode> ClientPool::writeValues(
+    Span<const NodeId> ids, Span<const Variant> values
+) {
+    if (ids.size() != values.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    return dispatch<StatusCode>(ids.size(), [&](Client& client, size_t offset, size_t count) {
+        return services::writeValues(
+            client, ids.subview(offset, count), values.subview(offset, count)
+        );
+    });
+}
+
+}  // namespace opcua
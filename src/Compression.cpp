@@ -0,0 +1,180 @@
+#include "open62541pp/Compression.h"
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+#include <algorithm>  // equal, find_if
+#include <array>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/BinaryEncoding.h"
+#include "open62541pp/ErrorHandling.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+// Payload header: magic (4 bytes), version (1), algorithm (1), reserved (2),
+// uncompressed size (8, little endian)
+constexpr std::array<uint8_t, 4> payloadMagic{'U', 'A', 'P', 'Z'};
+constexpr uint8_t payloadVersion = 1;
+constexpr size_t headerSize = 16;
+
+}  // namespace
+
+static void writeHeader(uint8_t* out, CompressionAlgorithm algorithm, uint64_t size) noexcept {
+    std::copy(payloadMagic.begin(), payloadMagic.end(), out);
+    out[4] = payloadVersion;  // NOLINT
+    out[5] = static_cast<uint8_t>(algorithm);  // NOLINT
+    out[6] = 0;  // NOLINT
+    out[7] = 0;  // NOLINT
+    for (size_t i = 0; i < 8; ++i) {
+        out[8 + i] = static_cast<uint8_t>(size >> (8 * i));  // NOLINT
+    }
+}
+
+static uint64_t readUncompressedSize(const uint8_t* in) noexcept {
+    uint64_t size = 0;
+    for (size_t i = 0; i < 8; ++i) {
+        size |= static_cast<uint64_t>(in[8 + i]) << (8 * i);  // NOLINT
+    }
+    return size;
+}
+
+static const UA_ByteString& getPayload(const Variant& value) noexcept {
+    return *static_cast<const UA_ByteString*>(value.data());
+}
+
+/// Replace the variant with a ByteString scalar without copying the payload.
+static void assignPayload(Variant& value, ByteString&& payload) {
+    auto* scalar = static_cast<UA_ByteString*>(UA_new(&UA_TYPES[UA_TYPES_BYTESTRING]));
+    if (scalar == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+    }
+    *scalar = payload.release();
+    UA_Variant native;
+    UA_Variant_init(&native);
+    UA_Variant_setScalar(&native, scalar, &UA_TYPES[UA_TYPES_BYTESTRING]);
+    value = Variant(std::move(native));
+}
+
+static ByteString allocPayload(size_t size) {
+    ByteString payload;
+    detail::throwOnBadStatus(UA_ByteString_allocBuffer(payload.handle(), size));
+    return payload;
+}
+
+bool isCompressedPayload(const Variant& value) noexcept {
+    if (!value.isScalar() || !value.isType(&UA_TYPES[UA_TYPES_BYTESTRING])) {
+        return false;
+    }
+    const auto& payload = getPayload(value);
+    return payload.length >= headerSize &&
+           std::equal(payloadMagic.begin(), payloadMagic.end(), payload.data) &&
+           payload.data[4] == payloadVersion;  // NOLINT
+}
+
+bool compressValue(
+    Variant& value, const CompressionCodec& codec, const CompressionOptions& options
+) {
+    if (value.isEmpty() || isCompressedPayload(value)) {
+        return false;
+    }
+    const auto& type = UA_TYPES[UA_TYPES_VARIANT];
+    const size_t encodedSize = calcSizeBinary(value.handle(), type);
+    if (encodedSize < options.minSize) {
+        return false;
+    }
+    ByteString payload;
+    if (codec.algorithm == CompressionAlgorithm::None) {
+        payload = allocPayload(headerSize + encodedSize);
+        encodeBinary(value.handle(), type, {payload->data + headerSize, encodedSize});
+    } else {
+        if (!codec.maxCompressedSize || !codec.compress) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        std::vector<uint8_t> encoded(encodedSize);
+        encodeBinary(value.handle(), type, encoded);
+        const size_t maxSize = codec.maxCompressedSize(encodedSize);
+        payload = allocPayload(headerSize + maxSize);
+        const Span<uint8_t> output(payload->data + headerSize, maxSize);
+        const size_t compressedSize = codec.compress(encoded, output);
+        if (compressedSize == 0 || compressedSize >= encodedSize) {
+            return false;  // failed or not worth it
+        }
+        payload->length = headerSize + compressedSize;  // the buffer is freed regardless of length
+    }
+    writeHeader(payload->data, codec.algorithm, encodedSize);
+    assignPayload(value, std::move(payload));
+    return true;
+}
+
+bool decompressValue(
+    Variant& value, Span<const CompressionCodec> codecs, const CompressionOptions& options
+) {
+    if (!isCompressedPayload(value)) {
+        return false;
+    }
+    const auto& payload = getPayload(value);
+    const auto algorithm = static_cast<CompressionAlgorithm>(payload.data[5]);  // NOLINT
+    const uint64_t uncompressedSize = readUncompressedSize(payload.data);
+    if (uncompressedSize > options.maxDecompressedSize) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    const Span<const uint8_t> input(payload.data + headerSize, payload.length - headerSize);
+    const auto& type = UA_TYPES[UA_TYPES_VARIANT];
+    Variant result;
+    if (algorithm == CompressionAlgorithm::None) {
+        decodeBinary(input, result.handle(), type);
+    } else {
+        const auto it = std::find_if(codecs.begin(), codecs.end(), [&](const auto& codec) {
+            return codec.algorithm == algorithm && codec.decompress;
+        });
+        if (it == codecs.end()) {
+            throw BadStatus(UA_STATUSCODE_BADDATAENCODINGUNSUPPORTED);
+        }
+        std::vector<uint8_t> decoded(uncompressedSize);
+        if (it->decompress(input, decoded) != uncompressedSize) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+        decodeBinary(decoded, result.handle(), type);
+    }
+    value = std::move(result);
+    return true;
+}
+
+ValueBackendDataSource compressDataSource(
+    ValueBackendDataSource source, CompressionCodec codec, CompressionOptions options
+) {
+    ValueBackendDataSource result;
+    if (source.read) {
+        result.read = [read = std::move(source.read), codec, options](
+                          DataValue& value, const NumericRange& range, bool timestamp
+                      ) {
+            const StatusCode status = read(value, range, timestamp);
+            if (status.isGood() && value->hasValue) {
+                compressValue(value.getValue(), codec, options);
+            }
+            return status;
+        };
+    }
+    if (source.write) {
+        result.write = [write = std::move(source.write), codec, options](
+                           const DataValue& value, const NumericRange& range
+                       ) {
+            if (!value->hasValue || !isCompressedPayload(value.getValue())) {
+                return write(value, range);
+            }
+            DataValue decompressed(value);  // copy of the compressed payload
+            decompressValue(decompressed.getValue(), {&codec, 1}, options);
+            return write(decompressed, range);
+        };
+    }
+    return result;
+}
+
+}  // namespace opcua
+
+#endif
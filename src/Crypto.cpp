@@ -2,6 +2,7 @@
 
 #ifdef UA_ENABLE_ENCRYPTION
 
+#include <cctype>  // isspace
 #include <string>
 #include <string_view>
 #include <vector>
@@ -15,6 +16,40 @@
 
 namespace opcua::crypto {
 
+ByteString convertPemToDer(const ByteString& data) {
+    const std::string_view pem(
+        reinterpret_cast<const char*>(data.handle()->data),  // NOLINT
+        data.handle()->length
+    );
+    constexpr std::string_view dashes{"-----"};
+    const auto begin = pem.find("-----BEGIN ");
+    if (begin == std::string_view::npos) {
+        return data;
+    }
+    const auto headerEnd = pem.find(dashes, begin + dashes.size());
+    const auto footer = pem.find("-----END ", begin);
+    if (headerEnd == std::string_view::npos || footer == std::string_view::npos ||
+        footer < headerEnd) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    const auto body = pem.substr(headerEnd + dashes.size(), footer - headerEnd - dashes.size());
+    if (body.find(':') != std::string_view::npos) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);  // encapsulated headers, e.g. Proc-Type
+    }
+    std::string encoded;
+    encoded.reserve(body.size());
+    for (const char c : body) {
+        if (std::isspace(static_cast<unsigned char>(c)) == 0) {
+            encoded.push_back(c);
+        }
+    }
+    ByteString der = ByteString::fromBase64(encoded);
+    if (der.empty()) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    return der;
+}
+
 #ifdef UAPP_CREATE_CERTIFICATE
 
 static_assert(static_cast<int>(CertificateFormat::DER) == UA_CERTIFICATEFORMAT_DER);
@@ -5,6 +5,7 @@
 #include <cstdint>
 #include <exception>
 #include <functional>  // invoke
+#include <mutex>
 #include <string>
 #include <string_view>
 #include <utility>  // move
@@ -21,6 +22,7 @@
 #include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/ExtensionObject.h"
 
+#include "ServerContext.h"
 #include "open62541_impl.h"
 
 namespace opcua {
@@ -78,6 +80,49 @@ inline static auto invokeAccessCallback(
     }
 }
 
+/// Charge a node operation to the rate limit of the session.
+inline static bool tryConsumeOperation(
+    UA_Server* server,
+    UA_AccessControl* ac,
+    std::string_view callbackName,
+    const UA_NodeId* sessionId
+) noexcept {
+    return invokeAccessCallback(server, callbackName, false, [&] {
+        return getContext(ac).tryConsumeOperation(asWrapperRef<NodeId>(sessionId));
+    });
+}
+
+/// Invoke a node access control callback or return its cached decision.
+/// Decisions are only cached if the callback succeeds, i.e. exceptions are forwarded every time.
+template <typename ReturnType, typename F>
+inline static ReturnType invokeCachedAccessCallback(
+    UA_Server* server,
+    UA_AccessControl* ac,
+    std::string_view callbackName,
+    AccessDecision decision,
+    const UA_NodeId* sessionId,
+    const UA_NodeId* nodeId,
+    ReturnType returnOnException,
+    F&& fn
+) noexcept {
+    auto& context = getContext(ac);
+    const auto& session = asWrapperRef<NodeId>(sessionId);
+    const auto& node = asWrapperRef<NodeId>(nodeId);
+    try {
+        if (const auto cached = context.getCachedDecision(session, decision, node)) {
+            return static_cast<ReturnType>(*cached);
+        }
+    } catch (const std::exception& e) {
+        logException(server, callbackName, e.what());
+        return returnOnException;
+    }
+    return invokeAccessCallback(server, callbackName, returnOnException, [&] {
+        const ReturnType result = std::invoke(fn);
+        context.cacheDecision(session, decision, node, static_cast<uint32_t>(result));
+        return result;
+    });
+}
+
 static UA_StatusCode activateSession(
     UA_Server* server,
     UA_AccessControl* ac,
@@ -125,10 +170,19 @@ static UA_UInt32 getUserRightsMask(
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
-    return invokeAccessCallback(server, "getUserRightsMask", uint32_t{}, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).getUserRightsMask(session, asWrapperRef<NodeId>(nodeId));
-    });
+    return invokeCachedAccessCallback(
+        server,
+        ac,
+        "getUserRightsMask",
+        AccessDecision::UserRightsMask,
+        sessionId,
+        nodeId,
+        uint32_t{},
+        [&] {
+            auto session = getSession(ac, sessionId);
+            return getAccessControl(ac).getUserRightsMask(session, asWrapperRef<NodeId>(nodeId));
+        }
+    );
 }
 
 static UA_Byte getUserAccessLevel(
@@ -139,10 +193,22 @@ static UA_Byte getUserAccessLevel(
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
-    return invokeAccessCallback(server, "getUserAccessLevel", uint8_t{}, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).getUserAccessLevel(session, asWrapperRef<NodeId>(nodeId));
-    });
+    if (!tryConsumeOperation(server, ac, "getUserAccessLevel", sessionId)) {
+        return 0x00;
+    }
+    return invokeCachedAccessCallback(
+        server,
+        ac,
+        "getUserAccessLevel",
+        AccessDecision::UserAccessLevel,
+        sessionId,
+        nodeId,
+        uint8_t{},
+        [&] {
+            auto session = getSession(ac, sessionId);
+            return getAccessControl(ac).getUserAccessLevel(session, asWrapperRef<NodeId>(nodeId));
+        }
+    );
 }
 
 static UA_Boolean getUserExecutable(
@@ -153,10 +219,19 @@ static UA_Boolean getUserExecutable(
     const UA_NodeId* methodId,
     [[maybe_unused]] void* methodContext
 ) {
-    return invokeAccessCallback(server, "getUserExecutable", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).getUserExecutable(session, asWrapperRef<NodeId>(methodId));
-    });
+    return invokeCachedAccessCallback(
+        server,
+        ac,
+        "getUserExecutable",
+        AccessDecision::UserExecutable,
+        sessionId,
+        methodId,
+        false,
+        [&] {
+            auto session = getSession(ac, sessionId);
+            return getAccessControl(ac).getUserExecutable(session, asWrapperRef<NodeId>(methodId));
+        }
+    );
 }
 
 static UA_Boolean getUserExecutableOnObject(
@@ -241,10 +316,22 @@ static UA_Boolean allowDeleteReference(
     const UA_NodeId* nodeId,
     [[maybe_unused]] void* nodeContext
 ) {
-    return invokeAccessCallback(server, "allowBrowseNode", false, [&] {
-        auto session = getSession(ac, sessionId);
-        return getAccessControl(ac).allowBrowseNode(session, asWrapperRef<NodeId>(nodeId));
-    });
+    if (!tryConsumeOperation(server, ac, "allowBrowseNode", sessionId)) {
+        return false;
+    }
+    return invokeCachedAccessCallback(
+        server,
+        ac,
+        "allowBrowseNode",
+        AccessDecision::BrowseNode,
+        sessionId,
+        nodeId,
+        false,
+        [&] {
+            auto session = getSession(ac, sessionId);
+            return getAccessControl(ac).allowBrowseNode(session, asWrapperRef<NodeId>(nodeId));
+        }
+    );
 }
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -405,31 +492,134 @@ void CustomAccessControl::setAccessControl() {
 void CustomAccessControl::setAccessControl(AccessControlBase& accessControl) {
     userTokenPolicies_ = accessControl.getUserTokenPolicies();
     accessControl_ = &accessControl;
+    invalidateCache();
     setAccessControl();
 }
 
 void CustomAccessControl::setAccessControl(std::unique_ptr<AccessControlBase> accessControl) {
     userTokenPolicies_ = accessControl->getUserTokenPolicies();
     accessControl_ = std::move(accessControl);
+    invalidateCache();
     setAccessControl();
 }
 
 void CustomAccessControl::onSessionActivated(const NodeId& sessionId) {
-    sessionIds_.insert(sessionId);
+    // keep the attached context if an active session is activated again
+    server_.getContext().sessions.try_emplace(sessionId);
+    // re-activation may change the user identity
+    invalidateCache(sessionId);
+    tokenBuckets_.erase(sessionId);
 }
 
 void CustomAccessControl::onSessionClosed(const NodeId& sessionId) {
-    sessionIds_.erase(sessionId);
+    server_.getContext().sessions.erase(sessionId);
+    invalidateCache(sessionId);
+    tokenBuckets_.erase(sessionId);
 }
 
-std::vector<Session> CustomAccessControl::getSessions() const {
-    std::vector<Session> result;
-    for (auto id : sessionIds_) {
-        result.emplace_back(server_, std::move(id));
+void CustomAccessControl::setCaching(bool enabled) noexcept {
+    caching_ = enabled;
+    if (!enabled) {
+        invalidateCache();
+    }
+}
+
+bool CustomAccessControl::isCaching() const noexcept {
+    return caching_;
+}
+
+void CustomAccessControl::invalidateCache() noexcept {
+    const std::lock_guard lock(cacheMutex_);
+    cache_.clear();
+}
+
+void CustomAccessControl::invalidateCache(const NodeId& sessionId) noexcept {
+    const std::lock_guard lock(cacheMutex_);
+    cache_.erase(sessionId);
+}
+
+std::optional<uint32_t> CustomAccessControl::getCachedDecision(
+    const NodeId& sessionId, AccessDecision decision, const NodeId& nodeId
+) const {
+    if (!caching_) {
+        return std::nullopt;
+    }
+    const std::lock_guard lock(cacheMutex_);
+    const auto it = cache_.find(sessionId);
+    if (it == cache_.end()) {
+        return std::nullopt;
+    }
+    const auto& decisions = it->second[static_cast<size_t>(decision)];
+    const auto decisionIt = decisions.find(nodeId);
+    if (decisionIt == decisions.end()) {
+        return std::nullopt;
+    }
+    return decisionIt->second;
+}
+
+void CustomAccessControl::cacheDecision(
+    const NodeId& sessionId, AccessDecision decision, const NodeId& nodeId, uint32_t value
+) {
+    // sessions without id (e.g. detached subscriptions) are never closed, don't cache them
+    if (!caching_ || sessionId.isNull()) {
+        return;
+    }
+    const std::lock_guard lock(cacheMutex_);
+    cache_[sessionId][static_cast<size_t>(decision)].insert_or_assign(nodeId, value);
+}
+
+void CustomAccessControl::setRequestPolicy(RequestPolicy policy) {
+    requestPolicy_ = std::move(policy);
+    tokenBuckets_.clear();
+}
+
+bool CustomAccessControl::tryConsumeOperation(const NodeId& sessionId) {
+    // sessions without id (e.g. detached subscriptions) are not limited
+    if (requestPolicy_.operationsPerSecond <= 0 || sessionId.isNull()) {
+        return true;
+    }
+    const auto now = detail::TokenBucket::Clock::now();
+    auto it = tokenBuckets_.find(sessionId);
+    if (it == tokenBuckets_.end()) {
+        double weight = 1.0;
+        if (requestPolicy_.weight) {
+            Session session(server_, sessionId);
+            weight = requestPolicy_.weight(session);
+        }
+        const double rate = requestPolicy_.operationsPerSecond * weight;
+        const double burst = requestPolicy_.burst > 0 ? requestPolicy_.burst * weight : rate;
+        it = tokenBuckets_.try_emplace(sessionId, rate, burst, now).first;
+    }
+    return it->second.tryConsume(now);
+}
+
+template <typename Vector>
+static Vector getSessionsImpl(Server& server, const typename Vector::allocator_type& allocator) {
+    const auto& sessions = server.getContext().sessions;
+    Vector result(allocator);
+    result.reserve(sessions.size());
+    for (const auto& [id, context] : sessions) {
+        result.emplace_back(server, id);
     }
     return result;
 }
 
+std::vector<Session> CustomAccessControl::getSessions() const {
+    return getSessionsImpl<std::vector<Session>>(server_, {});
+}
+
+#ifdef UAPP_HAS_PMR
+std::pmr::vector<Session> CustomAccessControl::getSessions(
+    std::pmr::memory_resource* resource
+) const {
+    return getSessionsImpl<std::pmr::vector<Session>>(server_, resource);
+}
+#endif
+
+size_t CustomAccessControl::getSessionCount() const noexcept {
+    return server_.getContext().sessions.size();
+}
+
 Server& CustomAccessControl::getServer() noexcept {
     return server_;
 }
@@ -1,13 +1,27 @@
 #pragma once
 
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
-#include <set>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
+#include "open62541pp/AccessControl.h"  // RequestPolicy
+#include "open62541pp/Config.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/NodeId.h"
 
+#include "detail/TokenBucket.h"
+
+#ifdef UAPP_HAS_PMR
+#include <memory_resource>
+#endif
+
 // forward declare
 struct UA_AccessControl;
 
@@ -20,10 +34,17 @@ void clearUaAccessControl(UA_AccessControl& ac) noexcept;
 }  // namespace detail
 
 // forward declare
-class AccessControlBase;
 class Server;
 class Session;
 
+/// Node access control callbacks with cacheable decisions.
+enum class AccessDecision : uint8_t {
+    UserRightsMask,
+    UserAccessLevel,
+    UserExecutable,
+    BrowseNode,
+};
+
 class CustomAccessControl {
 public:
     CustomAccessControl(Server& server);
@@ -39,8 +60,37 @@ public:
     void onSessionActivated(const NodeId& sessionId);
     void onSessionClosed(const NodeId& sessionId);
 
+    /// Enable/disable the per-session cache of node access control decisions.
+    void setCaching(bool enabled) noexcept;
+    bool isCaching() const noexcept;
+
+    /// Invalidate the cached decisions of all sessions.
+    void invalidateCache() noexcept;
+    /// Invalidate the cached decisions of a session.
+    void invalidateCache(const NodeId& sessionId) noexcept;
+
+    /// Get a cached decision, `std::nullopt` if caching is disabled or the decision is not cached.
+    std::optional<uint32_t> getCachedDecision(
+        const NodeId& sessionId, AccessDecision decision, const NodeId& nodeId
+    ) const;
+    /// Store a decision in the cache (if caching is enabled).
+    void cacheDecision(
+        const NodeId& sessionId, AccessDecision decision, const NodeId& nodeId, uint32_t value
+    );
+
+    /// Set the per-session rate limit, resets the token buckets of all sessions.
+    void setRequestPolicy(RequestPolicy policy);
+    /// Consume a token of the session, `false` if the session exceeds its rate limit.
+    bool tryConsumeOperation(const NodeId& sessionId);
+
     /// Get active sessions.
     std::vector<Session> getSessions() const;
+#ifdef UAPP_HAS_PMR
+    /// Get active sessions, the vector storage is allocated from `resource`.
+    std::pmr::vector<Session> getSessions(std::pmr::memory_resource* resource) const;
+#endif
+    /// Get the number of active sessions.
+    size_t getSessionCount() const noexcept;
 
     Server& getServer() noexcept;
     AccessControlBase* getAccessControl() noexcept;
@@ -49,7 +99,16 @@ private:
     Server& server_;
     std::variant<AccessControlBase*, std::unique_ptr<AccessControlBase>> accessControl_;
     std::vector<UserTokenPolicy> userTokenPolicies_;
-    std::set<NodeId> sessionIds_;
+
+    // decisions per session, one map per AccessDecision
+    // invalidated by Server methods from any thread, guarded by a mutex
+    using DecisionCache = std::array<std::unordered_map<NodeId, uint32_t>, 4>;
+    std::atomic<bool> caching_{false};
+    mutable std::mutex cacheMutex_;
+    std::unordered_map<NodeId, DecisionCache> cache_;
+
+    RequestPolicy requestPolicy_;
+    std::unordered_map<NodeId, detail::TokenBucket> tokenBuckets_;
 };
 
 }  // namespace opcua
@@ -10,6 +10,7 @@ CustomDataTypes::CustomDataTypes(const UA_DataTypeArray** arrayConfig)
     : arrayConfig_(arrayConfig) {}
 
 void CustomDataTypes::setCustomDataTypes(std::vector<DataType> dataTypes) {
+    registry_.reset();
     dataTypes_ = std::move(dataTypes);
     // NOLINTNEXTLINE
     array_ = std::unique_ptr<UA_DataTypeArray>(new UA_DataTypeArray{
@@ -20,4 +21,11 @@ void CustomDataTypes::setCustomDataTypes(std::vector<DataType> dataTypes) {
     *arrayConfig_ = array_.get();
 }
 
+void CustomDataTypes::setRegistry(std::shared_ptr<const DataTypeRegistry> registry) {
+    registry_ = std::move(registry);
+    *arrayConfig_ = registry_ != nullptr ? registry_->handle() : nullptr;
+    array_.reset();
+    dataTypes_.clear();
+}
+
 }  // namespace opcua
@@ -4,6 +4,7 @@
 #include <vector>
 
 #include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
 #include "open62541pp/open62541.h"
 
 namespace opcua {
@@ -14,10 +15,14 @@ public:
 
     void setCustomDataTypes(std::vector<DataType> dataTypes);
 
+    /// Reference the native array of a shared registry instead of an own copy.
+    void setRegistry(std::shared_ptr<const DataTypeRegistry> registry);
+
 private:
     const UA_DataTypeArray** arrayConfig_;
     std::unique_ptr<UA_DataTypeArray> array_;
     std::vector<DataType> dataTypes_;
+    std::shared_ptr<const DataTypeRegistry> registry_;
 };
 
 }  // namespace opcua
@@ -1,55 +1,198 @@
 #include "CustomLogger.h"
 
+#include <algorithm>  // min
+#include <array>
+#include <atomic>
 #include <cassert>
+#include <chrono>
+#include <condition_variable>
 #include <cstdarg>  // va_list, va_copy
+#include <cstdint>
 #include <cstdio>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>  // move
 
+#include "open62541pp/BinaryLogSink.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/ThreadConfig.h"
+
 namespace opcua {
 
-static std::string printfFormatToString(const char* msg, va_list args) noexcept {
-    va_list tmp{};  // NOLINT
-    va_copy(tmp, args);  // NOLINT
-    const int charsToWrite = std::vsnprintf(nullptr, 0, msg, tmp);  // NOLINT
-    va_end(tmp);  // NOLINT
-    std::string buffer(charsToWrite, ' ');
-    const int charsWritten = std::vsnprintf(buffer.data(), buffer.size() + 1, msg, args);
-    if (charsWritten < 0) {
-        return {};
+/**
+ * Bounded lock-free ring of fixed-size log records, drained by a background thread.
+ * Multi-producer single-consumer, based on Dmitry Vyukov's bounded MPMC queue.
+ */
+class AsyncLogWriter {
+public:
+    AsyncLogWriter(Logger logger, size_t capacity, ThreadConfig threadConfig)
+        : logger_(std::move(logger)),
+          mask_(roundUpPowerOfTwo(std::max(capacity, size_t{2})) - 1),
+          records_(new Record[mask_ + 1]) {
+        for (size_t i = 0; i <= mask_; ++i) {
+            records_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        thread_ = std::thread([this, threadConfig = std::move(threadConfig)] {
+            applyThreadConfig(threadConfig);
+            run();
+        });
     }
-    return buffer;
-}
 
-static void log(
-    void* context, UA_LogLevel level, UA_LogCategory category, const char* msg, va_list args
-) {
-    assert(context != nullptr);
-    const auto* instance = static_cast<CustomLogger*>(context);
-    const Logger& logger = instance->getLogger();
+    ~AsyncLogWriter() {
+        {
+            std::lock_guard lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_one();
+        thread_.join();
+        drain();  // remaining records
+    }
 
-    // skip if no logger set
-    if (!logger) {
-        return;
+    AsyncLogWriter(const AsyncLogWriter&) = delete;
+    AsyncLogWriter(AsyncLogWriter&&) noexcept = delete;
+    AsyncLogWriter& operator=(const AsyncLogWriter&) = delete;
+    AsyncLogWriter& operator=(AsyncLogWriter&&) noexcept = delete;
+
+    /// Format the message into a free record (thread-safe, non-blocking, non-allocating).
+    void push(LogLevel level, LogCategory category, const char* msg, va_list args) noexcept {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        Record* record = nullptr;
+        for (;;) {
+            record = &records_[pos & mask_];
+            const size_t sequence = record->sequence.load(std::memory_order_acquire);
+            const auto diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    break;
+                }
+            } else if (diff < 0) {
+                dropped_.fetch_add(1, std::memory_order_relaxed);  // full
+                return;
+            } else {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+        record->level = level;
+        record->category = category;
+        const int length = std::vsnprintf(record->text.data(), record->text.size(), msg, args);
+        record->length = static_cast<uint16_t>(
+            length < 0 ? 0 : std::min(static_cast<size_t>(length), asyncMaxMessageLength)
+        );
+        record->sequence.store(pos + 1, std::memory_order_release);
+        if (sleeping_.load(std::memory_order_relaxed)) {
+            cv_.notify_one();
+        }
+    }
+
+private:
+    struct Record {
+        std::atomic<size_t> sequence{0};
+        LogLevel level{};
+        LogCategory category{};
+        uint16_t length{0};
+        std::array<char, asyncMaxMessageLength + 1> text{};
+    };
+
+    static size_t roundUpPowerOfTwo(size_t value) noexcept {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /// Invoke the logger for all pending records (consumer thread only).
+    /// @returns `true` if any record was processed
+    bool drain() {
+        bool processed = false;
+        for (;;) {
+            Record& record = records_[dequeuePos_ & mask_];
+            const size_t sequence = record.sequence.load(std::memory_order_acquire);
+            if (sequence != dequeuePos_ + 1) {
+                break;
+            }
+            if (logger_) {
+                detail::invokeCatchIgnore([&] {
+                    logger_(record.level, record.category, {record.text.data(), record.length});
+                });
+            }
+            record.sequence.store(dequeuePos_ + mask_ + 1, std::memory_order_release);
+            ++dequeuePos_;
+            processed = true;
+        }
+        const size_t dropped = dropped_.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0 && logger_) {
+            detail::invokeCatchIgnore([&] {
+                logger_(
+                    LogLevel::Warning,
+                    LogCategory::Userland,
+                    "Log buffer full, dropped " + std::to_string(dropped) + " messages"
+                );
+            });
+        }
+        return processed;
     }
 
-    logger(
-        static_cast<LogLevel>(level),
-        static_cast<LogCategory>(category),
-        printfFormatToString(msg, args)
-    );
+    void run() {
+        std::unique_lock lock(mutex_);
+        while (running_) {
+            lock.unlock();
+            const bool processed = drain();
+            lock.lock();
+            if (!processed && running_) {
+                // producers only notify if the consumer is sleeping, poll to avoid lost wakeups
+                sleeping_.store(true, std::memory_order_relaxed);
+                cv_.wait_for(lock, std::chrono::milliseconds(10));
+                sleeping_.store(false, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    Logger logger_;
+    size_t mask_;
+    std::unique_ptr<Record[]> records_;  // NOLINT
+    std::atomic<size_t> enqueuePos_{0};
+    size_t dequeuePos_{0};
+    std::atomic<size_t> dropped_{0};
+    std::atomic<bool> sleeping_{false};
+    bool running_{true};
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::thread thread_;
+};
+
+static void logTrampoline(
+    void* context, UA_LogLevel level, UA_LogCategory category, const char* msg, va_list args
+) {
+    assert(context != nullptr);
+    static_cast<CustomLogger*>(context)->log(level, category, msg, args);
 }
 
 CustomLogger::CustomLogger(UA_Logger& logger)
     : nativeLogger_(logger) {}
 
+CustomLogger::~CustomLogger() = default;
+
 void CustomLogger::setLogger(Logger logger) {
+    setLogger(std::move(logger), {});
+}
+
+void CustomLogger::setLogger(Logger logger, const LoggerOptions& options) {
     if (nativeLogger_.clear != nullptr) {
         nativeLogger_.clear(nativeLogger_.context);
         nativeLogger_.context = nullptr;
     }
+    asyncWriter_.reset();  // flush pending messages with the previous logger
+    minLevel_ = options.minLevel;
+    binarySink_ = options.binarySink;
+    if (options.async) {
+        asyncWriter_ = std::make_unique<AsyncLogWriter>(
+            logger, options.asyncCapacity, options.asyncThreadConfig
+        );
+    }
     logger_ = std::move(logger);
-    nativeLogger_.log = log;
+    nativeLogger_.log = logTrampoline;
     nativeLogger_.context = this;
     nativeLogger_.clear = nullptr;
 }
@@ -58,4 +201,52 @@ const Logger& CustomLogger::getLogger() const noexcept {
     return logger_;
 }
 
+void CustomLogger::log(
+    UA_LogLevel level, UA_LogCategory category, const char* msg, va_list args
+) noexcept {
+    // skip if level is filtered (before formatting)
+    if (static_cast<LogLevel>(level) < minLevel_) {
+        return;
+    }
+    if (binarySink_ != nullptr) {
+        binarySink_->log(
+            static_cast<LogLevel>(level), static_cast<LogCategory>(category), msg, args
+        );
+        return;
+    }
+    // skip if no logger set
+    if (!logger_) {
+        return;
+    }
+    if (asyncWriter_ != nullptr) {
+        asyncWriter_->push(
+            static_cast<LogLevel>(level), static_cast<LogCategory>(category), msg, args
+        );
+        return;
+    }
+
+    // format into stack buffer, allocate only for long messages
+    std::array<char, 512> buffer;  // NOLINT, initialized by vsnprintf
+    va_list tmp{};  // NOLINT
+    va_copy(tmp, args);  // NOLINT
+    const int length = std::vsnprintf(buffer.data(), buffer.size(), msg, tmp);  // NOLINT
+    va_end(tmp);  // NOLINT
+    if (length < 0) {
+        return;
+    }
+    detail::invokeCatchIgnore([&] {
+        if (static_cast<size_t>(length) < buffer.size()) {
+            logger_(
+                static_cast<LogLevel>(level),
+                static_cast<LogCategory>(category),
+                {buffer.data(), static_cast<size_t>(length)}
+            );
+        } else {
+            std::string message(length, ' ');
+            std::vsnprintf(message.data(), message.size() + 1, msg, args);  // NOLINT
+            logger_(static_cast<LogLevel>(level), static_cast<LogCategory>(category), message);
+        }
+    });
+}
+
 }  // namespace opcua
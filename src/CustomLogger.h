@@ -1,21 +1,38 @@
 #pragma once
 
+#include <memory>
+
 #include "open62541pp/Logger.h"
 
 #include "open62541_impl.h"  // UA_Logger
 
 namespace opcua {
 
+// forward declaration
+class AsyncLogWriter;
+
 class CustomLogger {
 public:
     explicit CustomLogger(UA_Logger& logger);
+    ~CustomLogger();
+
+    CustomLogger(const CustomLogger&) = delete;
+    CustomLogger(CustomLogger&&) noexcept = delete;
+    CustomLogger& operator=(const CustomLogger&) = delete;
+    CustomLogger& operator=(CustomLogger&&) noexcept = delete;
 
     void setLogger(Logger logger);
+    void setLogger(Logger logger, const LoggerOptions& options);
     const Logger& getLogger() const noexcept;
 
+    void log(UA_LogLevel level, UA_LogCategory category, const char* msg, va_list args) noexcept;
+
 private:
     UA_Logger& nativeLogger_;
     Logger logger_;
+    LogLevel minLevel_{LogLevel::Trace};
+    std::shared_ptr<BinaryLogSink> binarySink_;
+    std::unique_ptr<AsyncLogWriter> asyncWriter_;
 };
 
 }  // namespace opcua
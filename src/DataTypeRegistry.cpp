@@ -0,0 +1,97 @@
+#include "open62541pp/DataTypeRegistry.h"
+
+#include <utility>  // move, pair
+
+#include "open62541pp/TypeWrapper.h"  // asNative
+
+namespace opcua {
+
+using DataTypeIndex = detail::PerfectHashMap<NodeId, const UA_DataType*>;
+
+static NodeId getTypeId(const UA_DataType& type) {
+    return NodeId(type.typeId);  // NOLINT
+}
+
+static NodeId getBinaryEncodingId(const UA_DataType& type) {
+#if UAPP_OPEN62541_VER_GE(1, 2)
+    return NodeId(type.binaryEncodingId);  // NOLINT
+#else
+    return NodeId(type.typeId.namespaceIndex, type.binaryEncodingId);  // NOLINT
+#endif
+}
+
+template <typename GetId>
+static DataTypeIndex createIndex(Span<const UA_DataType> types, GetId getId) {
+    std::vector<std::pair<NodeId, const UA_DataType*>> entries;
+    entries.reserve(types.size());
+    for (const auto& type : types) {
+        entries.emplace_back(getId(type), &type);
+    }
+    return DataTypeIndex(entries);
+}
+
+std::shared_ptr<const DataTypeRegistry> DataTypeRegistry::create(
+    std::vector<DataType> dataTypes, std::shared_ptr<const DataTypeRegistry> parent
+) {
+    // private constructor, std::make_shared not applicable
+    return std::shared_ptr<const DataTypeRegistry>(
+        new DataTypeRegistry(std::move(dataTypes), std::move(parent))  // NOLINT
+    );
+}
+
+DataTypeRegistry::DataTypeRegistry(
+    std::vector<DataType> dataTypes, std::shared_ptr<const DataTypeRegistry> parent
+)
+    : dataTypes_(std::move(dataTypes)),
+      parent_(std::move(parent)) {
+    // NOLINTNEXTLINE
+    array_ = std::unique_ptr<UA_DataTypeArray>(new UA_DataTypeArray{
+        parent_ != nullptr ? parent_->handle() : nullptr,  // next
+        dataTypes_.size(),
+        asNative(dataTypes_.data()),
+    });
+    // first occurrence wins, like the linear search of open62541
+    const Span<const UA_DataType> types(asNative(dataTypes_.data()), dataTypes_.size());
+    byTypeId_ = createIndex(types, getTypeId);
+    byBinaryEncodingId_ = createIndex(types, getBinaryEncodingId);
+}
+
+const UA_DataType* DataTypeRegistry::findByTypeId(const NodeId& typeId) const noexcept {
+    for (const auto* registry = this; registry != nullptr; registry = registry->parent_.get()) {
+        if (const auto* type = registry->byTypeId_.find(typeId)) {
+            return *type;
+        }
+    }
+    return nullptr;
+}
+
+const UA_DataType* DataTypeRegistry::findByBinaryEncodingId(
+    const NodeId& binaryEncodingId
+) const noexcept {
+    for (const auto* registry = this; registry != nullptr; registry = registry->parent_.get()) {
+        if (const auto* type = registry->byBinaryEncodingId_.find(binaryEncodingId)) {
+            return *type;
+        }
+    }
+    return nullptr;
+}
+
+static Span<const UA_DataType> getBuiltinTypes() noexcept {
+    return Span<const UA_DataType>(UA_TYPES, UA_TYPES_COUNT);  // NOLINT
+}
+
+const UA_DataType* DataTypeRegistry::findBuiltinByTypeId(const NodeId& typeId) noexcept {
+    static const DataTypeIndex index = createIndex(getBuiltinTypes(), getTypeId);
+    const auto* type = index.find(typeId);
+    return type != nullptr ? *type : nullptr;
+}
+
+const UA_DataType* DataTypeRegistry::findBuiltinByBinaryEncodingId(
+    const NodeId& binaryEncodingId
+) noexcept {
+    static const DataTypeIndex index = createIndex(getBuiltinTypes(), getBinaryEncodingId);
+    const auto* type = index.find(binaryEncodingId);
+    return type != nullptr ? *type : nullptr;
+}
+
+}  // namespace opcua
@@ -0,0 +1,190 @@
+#include "open62541pp/Discovery.h"
+
+#include <algorithm>  // min
+#include <functional>  // ref
+#include <thread>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"  // BadStatus
+
+namespace opcua {
+
+/* --------------------------------------- DiscoveryCache --------------------------------------- */
+
+template <typename T>
+std::optional<Result<std::vector<T>>> DiscoveryCache::find(
+    std::string_view serverUrl, Slot<T> Entry::*slot
+) {
+    const std::lock_guard lock(mutex_);
+    const auto it = entries_.find(std::string(serverUrl));
+    if (it != entries_.end()) {
+        auto& entry = it->second.*slot;
+        if (entry.result.has_value()) {
+            const auto timeToLive = entry.result->hasValue() ? timeToLive_ : failureTimeToLive_;
+            const bool expired = timeToLive > Clock::duration::zero() &&
+                                 Clock::now() - entry.inserted > timeToLive;
+            if (!expired) {
+                ++hits_;
+                return entry.result;
+            }
+            entry.result.reset();
+        }
+    }
+    ++misses_;
+    return std::nullopt;
+}
+
+template <typename T>
+void DiscoveryCache::insert(
+    std::string_view serverUrl, Slot<T> Entry::*slot, Result<std::vector<T>> result
+) {
+    if (!result.hasValue() && failureTimeToLive_ == Clock::duration::zero()) {
+        return;  // failures are not cached
+    }
+    const std::lock_guard lock(mutex_);
+    auto& entry = entries_[std::string(serverUrl)].*slot;
+    entry.result = std::move(result);
+    entry.inserted = Clock::now();
+}
+
+std::optional<Result<std::vector<ApplicationDescription>>> DiscoveryCache::findServers(
+    std::string_view serverUrl
+) {
+    return find(serverUrl, &Entry::servers);
+}
+
+std::optional<Result<std::vector<EndpointDescription>>> DiscoveryCache::findEndpoints(
+    std::string_view serverUrl
+) {
+    return find(serverUrl, &Entry::endpoints);
+}
+
+void DiscoveryCache::insertServers(
+    std::string_view serverUrl, Result<std::vector<ApplicationDescription>> result
+) {
+    insert(serverUrl, &Entry::servers, std::move(result));
+}
+
+void DiscoveryCache::insertEndpoints(
+    std::string_view serverUrl, Result<std::vector<EndpointDescription>> result
+) {
+    insert(serverUrl, &Entry::endpoints, std::move(result));
+}
+
+void DiscoveryCache::invalidate(std::string_view serverUrl) {
+    const std::lock_guard lock(mutex_);
+    entries_.erase(std::string(serverUrl));
+}
+
+void DiscoveryCache::clear() {
+    const std::lock_guard lock(mutex_);
+    entries_.clear();
+}
+
+size_t DiscoveryCache::size() const {
+    const std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+/* ------------------------------------------ Discovery ----------------------------------------- */
+
+Discovery::Discovery(DiscoveryOptions options, std::shared_ptr<DiscoveryCache> cache)
+    : options_(options),
+      cache_(cache != nullptr ? std::move(cache) : std::make_shared<DiscoveryCache>()) {
+    options_.connections = std::max<size_t>(options_.connections, 1);
+}
+
+Discovery::~Discovery() = default;
+
+static void insertResult(
+    DiscoveryCache& cache,
+    std::string_view serverUrl,
+    const Result<std::vector<ApplicationDescription>>& result
+) {
+    cache.insertServers(serverUrl, result);
+}
+
+static void insertResult(
+    DiscoveryCache& cache,
+    std::string_view serverUrl,
+    const Result<std::vector<EndpointDescription>>& result
+) {
+    cache.insertEndpoints(serverUrl, result);
+}
+
+template <typename T, typename Find, typename Request>
+std::vector<Result<std::vector<T>>> Discovery::scan(
+    Span<const std::string> serverUrls, Find&& find, Request&& request
+) {
+    const std::lock_guard lock(mutex_);
+    std::vector<Result<std::vector<T>>> results(serverUrls.size());
+    std::vector<size_t> pending;  // indices of cache misses
+    for (size_t i = 0; i < serverUrls.size(); ++i) {
+        if (auto cached = find(*cache_, serverUrls[i])) {
+            results[i] = std::move(*cached);
+        } else {
+            pending.push_back(i);
+        }
+    }
+    if (pending.empty()) {
+        return results;
+    }
+
+    const size_t connections = std::min(options_.connections, pending.size());
+    while (clients_.size() < connections) {
+        auto client = std::make_unique<Client>();
+        client->setLogger({});  // thousands of servers, failures are returned with the results
+        client->setTimeout(options_.timeout);
+        clients_.push_back(std::move(client));
+    }
+    std::atomic<size_t> next{0};
+    auto work = [&](Client& client) {
+        for (size_t i = next++; i < pending.size(); i = next++) {
+            const auto& serverUrl = serverUrls[pending[i]];
+            auto& result = results[pending[i]];
+            try {
+                result = request(client, serverUrl);
+            } catch (const BadStatus& e) {
+                result = BadResult(e.code());
+            }
+            insertResult(*cache_, serverUrl, result);
+        }
+    };
+    std::vector<std::thread> threads;
+    threads.reserve(connections - 1);
+    for (size_t i = 1; i < connections; ++i) {
+        threads.emplace_back(work, std::ref(*clients_[i]));
+    }
+    work(*clients_[0]);  // calling thread serves the first connection
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    return results;
+}
+
+std::vector<Result<std::vector<ApplicationDescription>>> Discovery::findServers(
+    Span<const std::string> serverUrls
+) {
+    return scan<ApplicationDescription>(
+        serverUrls,
+        [](DiscoveryCache& cache, std::string_view url) { return cache.findServers(url); },
+        [](Client& client, std::string_view url) { return client.findServers(url); }
+    );
+}
+
+std::vector<Result<std::vector<EndpointDescription>>> Discovery::getEndpoints(
+    Span<const std::string> serverUrls
+) {
+    return scan<EndpointDescription>(
+        serverUrls,
+        [](DiscoveryCache& cache, std::string_view url) { return cache.findEndpoints(url); },
+        [](Client& client, std::string_view url) { return client.getEndpoints(url); }
+    );
+}
+
+const std::shared_ptr<DiscoveryCache>& Discovery::getCache() const noexcept {
+    return cache_;
+}
+
+}  // namespace opcua
@@ -0,0 +1,701 @@
+#include "EpollNetworkLayer.h"
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+
+#include <algorithm>  // find, find_if, remove
+#include <array>
+#include <cerrno>
+#include <cstddef>  // offsetof
+#include <memory>
+#include <mutex>
+#include <new>  // nothrow
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <utility>  // swap
+#include <vector>
+
+#include <netdb.h>  // getaddrinfo
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
+#include <unistd.h>  // close, gethostname
+
+#include "SocketConnection.h"  // applySocketOptions
+
+namespace opcua::detail {
+
+namespace {
+
+constexpr int maxEventsPerListen = 256;
+constexpr int sendTimeoutMilliseconds = 5000;  // wait for a full socket send buffer
+constexpr UA_DateTime helloTimeout = 120 * UA_DATETIME_SEC;  // same as the TCP network layer
+constexpr UA_DateTime helloTimeoutCheckInterval = UA_DATETIME_SEC;
+constexpr UA_DateTime reverseConnectRetryInterval = UA_DATETIME_SEC;
+
+struct EpollLayer;
+struct ReverseConnect;
+
+/// Registered socket, referenced by the epoll events.
+struct PollEntry {
+    int fd{-1};
+    UA_Connection* connection{nullptr};  // nullptr for listening sockets
+};
+
+struct EpollConnection {
+    PollEntry entry;
+    EpollLayer* layer{nullptr};
+    ReverseConnect* reverse{nullptr};  // outgoing connection of a reverse connect
+    bool connecting{false};  // non-blocking connect in progress
+    UA_Connection connection{};
+};
+
+/// Target of a reverse connect, the connection is re-established whenever it is closed.
+struct ReverseConnect {
+    uint64_t id{0};
+    std::string host;
+    std::string port;
+    EpollConnection* connection{nullptr};
+    UA_DateTime nextAttempt{0};
+};
+
+struct EpollLayer {
+    int epollFd{-1};
+    PollEntry wakeup;  // eventfd to interrupt epoll_wait, see wakeupEpollNetworkLayer
+    uint16_t port{0};
+    std::string discoveryUrl;  // endpoint URL sent with the ReverseHello messages
+    TransportConfig socketOptions;  // see setEpollSocketOptions
+    UA_Server* server{nullptr};
+    std::vector<std::unique_ptr<PollEntry>> listeners;
+    std::unordered_set<EpollConnection*> connections;
+    std::vector<EpollConnection*> closed;  // closed connections, removed with the next listen
+    std::vector<UA_Byte> recvBuffer;  // shared by all connections
+    std::array<epoll_event, maxEventsPerListen> events{};
+    UA_DateTime nextHelloTimeoutCheck{0};
+    std::vector<std::unique_ptr<ReverseConnect>> reverseConnects;
+    // reverse connects are added and removed from other threads, applied with the next listen
+    std::mutex reverseConnectsMutex;
+    std::vector<std::unique_ptr<ReverseConnect>> addedReverseConnects;
+    std::vector<uint64_t> removedReverseConnects;
+    std::vector<uint64_t> reverseConnectIds;
+    uint64_t lastReverseConnectId{0};
+};
+
+EpollConnection* getConnection(UA_Connection* connection) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* bytes = reinterpret_cast<char*>(connection);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<EpollConnection*>(bytes - offsetof(EpollConnection, connection));
+}
+
+EpollLayer& getLayer(UA_ServerNetworkLayer* nl) noexcept {
+    return *static_cast<EpollLayer*>(nl->handle);
+}
+
+/* --------------------------------------- Connection ------------------------------------------- */
+
+void closeConnection(UA_Connection* connection) noexcept {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return;
+    }
+    ::shutdown(connection->sockfd, SHUT_RDWR);
+    connection->state = UA_CONNECTIONSTATE_CLOSED;
+    auto* conn = getConnection(connection);
+    try {
+        conn->layer->closed.push_back(conn);
+    } catch (const std::bad_alloc&) {
+        // removed when the hang up is reported by epoll
+    }
+}
+
+UA_StatusCode getSendBuffer(UA_Connection* connection, size_t length, UA_ByteString* buf) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    return UA_ByteString_allocBuffer(buf, length);
+}
+
+void releaseSendBuffer(UA_Connection* /* connection */, UA_ByteString* buf) {
+    UA_ByteString_clear(buf);
+}
+
+/// Send the whole buffer and release it (also on failure).
+UA_StatusCode sendBuffer(UA_Connection* connection, UA_ByteString* buf) {
+    UA_StatusCode status = UA_STATUSCODE_GOOD;
+    size_t written = 0;
+    while (written < buf->length) {
+        if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+            status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+            break;
+        }
+        const ssize_t n = ::send(
+            connection->sockfd, buf->data + written, buf->length - written, MSG_NOSIGNAL
+        );
+        if (n >= 0) {
+            written += static_cast<size_t>(n);
+            continue;
+        }
+        if (errno == EINTR) {
+            continue;
+        }
+        if (errno == EAGAIN || errno == EWOULDBLOCK) {
+            // socket send buffer is full, wait until the peer consumed some data
+            pollfd pfd{connection->sockfd, POLLOUT, 0};
+            if (::poll(&pfd, 1, sendTimeoutMilliseconds) > 0) {
+                continue;
+            }
+        }
+        closeConnection(connection);
+        status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+        break;
+    }
+    UA_ByteString_clear(buf);
+    return status;
+}
+
+/// Receive into the shared buffer of the layer, valid until the next receive of any connection.
+UA_StatusCode recvBuffer(
+    UA_Connection* connection, UA_ByteString* response, UA_UInt32 /* timeout */
+) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    auto& buffer = getConnection(connection)->layer->recvBuffer;
+    ssize_t n = 0;
+    do {
+        n = ::recv(connection->sockfd, buffer.data(), buffer.size(), 0);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0) {
+        response->data = buffer.data();
+        response->length = static_cast<size_t>(n);
+        return UA_STATUSCODE_GOOD;
+    }
+    if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+        return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+    }
+    closeConnection(connection);
+    return UA_STATUSCODE_BADCONNECTIONCLOSED;
+}
+
+void releaseRecvBuffer(UA_Connection* /* connection */, UA_ByteString* buf) {
+    // shared buffer owned by the layer
+    *buf = UA_BYTESTRING_NULL;
+}
+
+void freeConnection(UA_Connection* connection) {
+    delete getConnection(connection);  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+/* ------------------------------------------ Layer --------------------------------------------- */
+
+void removeConnection(EpollLayer& layer, EpollConnection* conn) noexcept {
+    if (layer.connections.erase(conn) == 0) {
+        return;  // already removed
+    }
+    ::epoll_ctl(layer.epollFd, EPOLL_CTL_DEL, conn->entry.fd, nullptr);
+    ::close(conn->entry.fd);
+    conn->connection.state = UA_CONNECTIONSTATE_CLOSED;
+    if (conn->reverse != nullptr) {
+        // reconnect later
+        conn->reverse->connection = nullptr;
+        conn->reverse->nextAttempt = UA_DateTime_nowMonotonic() + reverseConnectRetryInterval;
+        conn->reverse = nullptr;
+    }
+    // detaches the secure channel and frees the connection with a delayed callback
+    UA_Server_removeConnection(layer.server, &conn->connection);
+}
+
+void removeClosedConnections(EpollLayer& layer) noexcept {
+    if (layer.closed.empty()) {
+        return;
+    }
+    std::vector<EpollConnection*> closed;
+    std::swap(closed, layer.closed);
+    for (auto* conn : closed) {
+        removeConnection(layer, conn);
+    }
+}
+
+/// Close connections without a Hello message, checked once per interval instead of every listen.
+void closeExpiredConnections(EpollLayer& layer) noexcept {
+    const auto now = UA_DateTime_nowMonotonic();
+    if (now < layer.nextHelloTimeoutCheck) {
+        return;
+    }
+    layer.nextHelloTimeoutCheck = now + helloTimeoutCheckInterval;
+    for (auto* conn : layer.connections) {
+        if (conn->connection.state == UA_CONNECTIONSTATE_OPENING &&
+            now > conn->connection.openingDate + helloTimeout) {
+            closeConnection(&conn->connection);
+        }
+    }
+}
+
+/// Create and register a connection of a connected (or connecting) non-blocking socket.
+EpollConnection* addConnection(EpollLayer& layer, int fd, uint32_t events) noexcept {
+    applySocketOptions(fd, layer.socketOptions);
+
+    auto* conn = new (std::nothrow) EpollConnection{};  // NOLINT(*-owning-memory)
+    if (conn == nullptr) {
+        ::close(fd);
+        return nullptr;
+    }
+    conn->entry.fd = fd;
+    conn->entry.connection = &conn->connection;
+    conn->layer = &layer;
+    auto& connection = conn->connection;
+    connection.state = UA_CONNECTIONSTATE_OPENING;
+    connection.sockfd = fd;
+    connection.handle = &layer;
+    connection.openingDate = UA_DateTime_nowMonotonic();
+    connection.getSendBuffer = getSendBuffer;
+    connection.releaseSendBuffer = releaseSendBuffer;
+    connection.send = sendBuffer;
+    connection.recv = recvBuffer;
+    connection.releaseRecvBuffer = releaseRecvBuffer;
+    connection.close = closeConnection;
+    connection.free = freeConnection;
+
+    epoll_event event{};
+    event.events = events;
+    event.data.ptr = &conn->entry;
+    bool inserted = false;
+    try {
+        inserted = layer.connections.insert(conn).second;
+    } catch (const std::bad_alloc&) {
+    }
+    if (!inserted || ::epoll_ctl(layer.epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        layer.connections.erase(conn);
+        ::close(fd);
+        delete conn;  // NOLINT(cppcoreguidelines-owning-memory)
+        return nullptr;
+    }
+    return conn;
+}
+
+void acceptConnections(EpollLayer& layer, int listenFd) noexcept {
+    while (true) {
+        const int fd = ::accept4(listenFd, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+        if (fd < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            break;  // backlog drained (EAGAIN) or out of descriptors, retry with next listen
+        }
+        if (addConnection(layer, fd, EPOLLIN | EPOLLRDHUP) == nullptr) {
+            break;
+        }
+    }
+}
+
+/* -------------------------------------- Reverse connect --------------------------------------- */
+
+void appendUInt32(std::vector<UA_Byte>& buffer, uint32_t value) {
+    for (int i = 0; i < 4; ++i) {
+        buffer.push_back(static_cast<UA_Byte>(value >> (8 * i)));
+    }
+}
+
+void appendString(std::vector<UA_Byte>& buffer, std::string_view str) {
+    appendUInt32(buffer, static_cast<uint32_t>(str.size()));
+    buffer.insert(buffer.end(), str.begin(), str.end());
+}
+
+/// Encode a ReverseHello message (OPC UA Part 6, 7.1.2.6).
+std::vector<UA_Byte> encodeReverseHello(std::string_view serverUri, std::string_view endpointUrl) {
+    std::vector<UA_Byte> buffer{'R', 'H', 'E', 'F', 0, 0, 0, 0};
+    appendString(buffer, serverUri);
+    appendString(buffer, endpointUrl);
+    const auto size = static_cast<uint32_t>(buffer.size());
+    for (size_t i = 0; i < 4; ++i) {
+        buffer[4 + i] = static_cast<UA_Byte>(size >> (8 * i));
+    }
+    return buffer;
+}
+
+/// Split `opc.tcp://host:port[/path]` into host and port (IPv6 hosts in brackets).
+bool parseEndpointUrl(std::string_view url, std::string& host, std::string& port) {
+    constexpr std::string_view scheme = "opc.tcp://";
+    if (url.substr(0, scheme.size()) != scheme) {
+        return false;
+    }
+    url.remove_prefix(scheme.size());
+    url = url.substr(0, url.find('/'));
+    size_t portSeparator = url.rfind(':');
+    if (!url.empty() && url.front() == '[') {
+        const size_t end = url.find(']');
+        if (end == std::string_view::npos) {
+            return false;
+        }
+        host = url.substr(1, end - 1);
+        portSeparator = url.find(':', end);
+    } else {
+        host = url.substr(0, portSeparator);
+    }
+    port = portSeparator == std::string_view::npos ? "4840" : url.substr(portSeparator + 1);
+    return !host.empty() && !port.empty();
+}
+
+/// Start a non-blocking connect to the client of a reverse connect.
+void startReverseConnect(EpollLayer& layer, ReverseConnect& target) noexcept {
+    target.nextAttempt = UA_DateTime_nowMonotonic() + reverseConnectRetryInterval;
+    addrinfo hints{};
+    hints.ai_family = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    hints.ai_protocol = IPPROTO_TCP;
+    addrinfo* result = nullptr;
+    if (::getaddrinfo(target.host.c_str(), target.port.c_str(), &hints, &result) != 0) {
+        return;
+    }
+    const auto* ai = result;
+    const int fd = ::socket(ai->ai_family, ai->ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        ::freeaddrinfo(result);
+        return;
+    }
+    const int status = ::connect(fd, ai->ai_addr, ai->ai_addrlen);
+    ::freeaddrinfo(result);
+    if (status != 0 && errno != EINPROGRESS) {
+        ::close(fd);
+        return;
+    }
+    // writable once connected, the ReverseHello is sent then
+    auto* conn = addConnection(layer, fd, EPOLLOUT | EPOLLRDHUP);
+    if (conn != nullptr) {
+        conn->reverse = &target;
+        conn->connecting = true;
+        target.connection = conn;
+    }
+}
+
+/// Complete a non-blocking connect and send the ReverseHello.
+void completeReverseConnect(EpollLayer& layer, EpollConnection& conn) noexcept {
+    conn.connecting = false;
+    int error = 0;
+    socklen_t length = sizeof(error);
+    ::getsockopt(conn.entry.fd, SOL_SOCKET, SO_ERROR, &error, &length);
+    epoll_event event{};
+    event.events = EPOLLIN | EPOLLRDHUP;
+    event.data.ptr = &conn.entry;
+    if (error != 0 || ::epoll_ctl(layer.epollFd, EPOLL_CTL_MOD, conn.entry.fd, &event) != 0) {
+        closeConnection(&conn.connection);
+        return;
+    }
+    try {
+        const auto* config = UA_Server_getConfig(layer.server);
+        const auto& applicationUri = config->applicationDescription.applicationUri;
+        const std::string_view serverUri(
+            reinterpret_cast<const char*>(applicationUri.data),  // NOLINT
+            applicationUri.length
+        );
+        auto message = encodeReverseHello(serverUri, layer.discoveryUrl);
+        UA_ByteString buf{message.size(), message.data()};
+        UA_ByteString copy = UA_BYTESTRING_NULL;
+        if (UA_ByteString_copy(&buf, &copy) == UA_STATUSCODE_GOOD) {
+            sendBuffer(&conn.connection, &copy);  // releases the copy
+        }
+        // the client continues with a Hello message, like an accepted connection
+        conn.connection.openingDate = UA_DateTime_nowMonotonic();
+    } catch (const std::bad_alloc&) {
+        closeConnection(&conn.connection);
+    }
+}
+
+void removeReverseConnect(EpollLayer& layer, uint64_t id) noexcept {
+    auto& targets = layer.reverseConnects;
+    const auto it = std::find_if(targets.begin(), targets.end(), [&](const auto& target) {
+        return target->id == id;
+    });
+    if (it == targets.end()) {
+        return;
+    }
+    if ((*it)->connection != nullptr) {
+        (*it)->connection->reverse = nullptr;
+        closeConnection(&(*it)->connection->connection);
+    }
+    targets.erase(it);
+}
+
+/// Apply the added and removed reverse connects, then (re-)connect the closed ones.
+void processReverseConnects(EpollLayer& layer) noexcept {
+    {
+        const std::lock_guard lock(layer.reverseConnectsMutex);
+        try {
+            for (auto& target : layer.addedReverseConnects) {
+                layer.reverseConnects.push_back(std::move(target));
+            }
+        } catch (const std::bad_alloc&) {
+            // retried with the next listen
+        }
+        auto& added = layer.addedReverseConnects;
+        added.erase(std::remove(added.begin(), added.end(), nullptr), added.end());
+        for (const uint64_t id : layer.removedReverseConnects) {
+            removeReverseConnect(layer, id);
+        }
+        layer.removedReverseConnects.clear();
+    }
+    if (layer.reverseConnects.empty()) {
+        return;
+    }
+    const auto now = UA_DateTime_nowMonotonic();
+    for (auto& target : layer.reverseConnects) {
+        if (target->connection == nullptr && now >= target->nextAttempt) {
+            startReverseConnect(layer, *target);
+        }
+    }
+}
+
+void addListener(EpollLayer& layer, const addrinfo& ai, const UA_Logger* logger) {
+    const int fd = ::socket(ai.ai_family, ai.ai_socktype | SOCK_NONBLOCK | SOCK_CLOEXEC, 0);
+    if (fd < 0) {
+        return;
+    }
+    const int one = 1;
+    ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+    if (ai.ai_family == AF_INET6) {
+        // bind IPv4 separately
+        ::setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &one, sizeof(one));
+    }
+    if (::bind(fd, ai.ai_addr, ai.ai_addrlen) != 0 || ::listen(fd, SOMAXCONN) != 0) {
+        UA_LOG_WARNING(
+            logger, UA_LOGCATEGORY_NETWORK, "Failed to listen on port %u (errno %d)", layer.port, errno
+        );
+        ::close(fd);
+        return;
+    }
+    auto entry = std::make_unique<PollEntry>();
+    entry->fd = fd;
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.ptr = entry.get();
+    if (::epoll_ctl(layer.epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+        ::close(fd);
+        return;
+    }
+    layer.listeners.push_back(std::move(entry));
+}
+
+std::string getHostname(const UA_String* customHostname) {
+    if (customHostname != nullptr && customHostname->length > 0) {
+        return {reinterpret_cast<const char*>(customHostname->data), customHostname->length};  // NOLINT
+    }
+    std::array<char, 256> hostname{};
+    ::gethostname(hostname.data(), hostname.size() - 1);
+    return hostname.data();
+}
+
+UA_StatusCode startLayer(
+    UA_ServerNetworkLayer* nl, const UA_Logger* logger, const UA_String* customHostname
+) {
+    auto& layer = getLayer(nl);
+    const auto port = std::to_string(layer.port);
+    try {
+        addrinfo hints{};
+        hints.ai_family = AF_UNSPEC;
+        hints.ai_socktype = SOCK_STREAM;
+        hints.ai_protocol = IPPROTO_TCP;
+        hints.ai_flags = AI_PASSIVE;
+        addrinfo* result = nullptr;
+        if (::getaddrinfo(nullptr, port.c_str(), &hints, &result) != 0) {
+            return UA_STATUSCODE_BADINTERNALERROR;
+        }
+        for (const auto* ai = result; ai != nullptr; ai = ai->ai_next) {
+            addListener(layer, *ai, logger);
+        }
+        ::freeaddrinfo(result);
+        if (layer.listeners.empty()) {
+            return UA_STATUSCODE_BADCOMMUNICATIONERROR;
+        }
+
+        const auto url = "opc.tcp://" + getHostname(customHostname) + ":" + port + "/";
+        UA_String_clear(&nl->discoveryUrl);
+        nl->discoveryUrl = UA_STRING_ALLOC(url.c_str());
+        layer.discoveryUrl = url;
+        UA_LOG_INFO(
+            logger, UA_LOGCATEGORY_NETWORK, "epoll network layer listening on %s", url.c_str()
+        );
+    } catch (const std::bad_alloc&) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode listenLayer(UA_ServerNetworkLayer* nl, UA_Server* server, UA_UInt16 timeout) {
+    auto& layer = getLayer(nl);
+    layer.server = server;
+    try {
+        layer.recvBuffer.resize(nl->localConnectionConfig.recvBufferSize);
+    } catch (const std::bad_alloc&) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    closeExpiredConnections(layer);
+    removeClosedConnections(layer);
+    processReverseConnects(layer);
+
+    const int count = ::epoll_wait(
+        layer.epollFd, layer.events.data(), static_cast<int>(layer.events.size()), timeout
+    );
+    for (int i = 0; i < count; ++i) {
+        auto* entry = static_cast<PollEntry*>(layer.events[i].data.ptr);  // NOLINT
+        if (entry == &layer.wakeup) {
+            uint64_t value = 0;
+            [[maybe_unused]] const auto n = ::read(entry->fd, &value, sizeof(value));
+            continue;
+        }
+        if (entry->connection == nullptr) {
+            acceptConnections(layer, entry->fd);
+            continue;
+        }
+        auto* conn = getConnection(entry->connection);
+        if (conn->connecting) {
+            completeReverseConnect(layer, *conn);
+            continue;
+        }
+        // one message per connection and listen, remaining data is reported again
+        UA_ByteString buf = UA_BYTESTRING_NULL;
+        if (recvBuffer(entry->connection, &buf, 0) == UA_STATUSCODE_GOOD) {
+            UA_Server_processBinaryMessage(server, entry->connection, &buf);
+            releaseRecvBuffer(entry->connection, &buf);
+        }
+    }
+    // entries of this batch stay valid until here
+    removeClosedConnections(layer);
+    return UA_STATUSCODE_GOOD;
+}
+
+void stopLayer(UA_ServerNetworkLayer* nl, UA_Server* server) {
+    auto& layer = getLayer(nl);
+    layer.server = server;
+    for (const auto& entry : layer.listeners) {
+        ::epoll_ctl(layer.epollFd, EPOLL_CTL_DEL, entry->fd, nullptr);
+        ::shutdown(entry->fd, SHUT_RDWR);
+        ::close(entry->fd);
+    }
+    layer.listeners.clear();
+    const std::vector<EpollConnection*> connections(
+        layer.connections.begin(), layer.connections.end()
+    );
+    for (auto* conn : connections) {
+        ::shutdown(conn->entry.fd, SHUT_RDWR);
+        removeConnection(layer, conn);
+    }
+    layer.closed.clear();
+}
+
+void clearLayer(UA_ServerNetworkLayer* nl) {
+    auto* layer = static_cast<EpollLayer*>(nl->handle);
+    if (layer != nullptr) {
+        if (layer->epollFd >= 0) {
+            ::close(layer->epollFd);
+        }
+        if (layer->wakeup.fd >= 0) {
+            ::close(layer->wakeup.fd);
+        }
+        delete layer;  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+    nl->handle = nullptr;
+    UA_String_clear(&nl->discoveryUrl);
+}
+
+}  // namespace
+
+UA_StatusCode initEpollNetworkLayer(
+    UA_ServerNetworkLayer& nl, uint16_t port, const UA_ConnectionConfig& config
+) {
+    auto* layer = new (std::nothrow) EpollLayer{};  // NOLINT(cppcoreguidelines-owning-memory)
+    if (layer == nullptr) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    layer->epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    layer->wakeup.fd = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    epoll_event event{};
+    event.events = EPOLLIN;
+    event.data.ptr = &layer->wakeup;
+    if (layer->epollFd < 0 || layer->wakeup.fd < 0 ||
+        ::epoll_ctl(layer->epollFd, EPOLL_CTL_ADD, layer->wakeup.fd, &event) != 0) {
+        UA_ServerNetworkLayer failed{};
+        failed.handle = layer;
+        clearLayer(&failed);
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    layer->port = port;
+    layer->socketOptions.noDelay = true;
+    nl = UA_ServerNetworkLayer{};
+    nl.handle = layer;
+    nl.localConnectionConfig = config;
+    nl.start = startLayer;
+    nl.listen = listenLayer;
+    nl.stop = stopLayer;
+    nl.clear = clearLayer;
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode addEpollReverseConnect(
+    UA_ServerNetworkLayer& nl, std::string_view url, uint64_t& id
+) {
+    if (getEpollFd(nl) < 0) {
+        return UA_STATUSCODE_BADNOTSUPPORTED;
+    }
+    auto& layer = getLayer(&nl);
+    auto target = std::make_unique<ReverseConnect>();
+    if (!parseEndpointUrl(url, target->host, target->port)) {
+        return UA_STATUSCODE_BADTCPENDPOINTURLINVALID;
+    }
+    const std::lock_guard lock(layer.reverseConnectsMutex);
+    target->id = ++layer.lastReverseConnectId;
+    layer.reverseConnectIds.push_back(target->id);
+    layer.addedReverseConnects.push_back(std::move(target));
+    id = layer.lastReverseConnectId;
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode removeEpollReverseConnect(UA_ServerNetworkLayer& nl, uint64_t id) {
+    if (getEpollFd(nl) < 0) {
+        return UA_STATUSCODE_BADNOTSUPPORTED;
+    }
+    auto& layer = getLayer(&nl);
+    const std::lock_guard lock(layer.reverseConnectsMutex);
+    auto& ids = layer.reverseConnectIds;
+    const auto it = std::find(ids.begin(), ids.end(), id);
+    if (it == ids.end()) {
+        return UA_STATUSCODE_BADNOTFOUND;
+    }
+    ids.erase(it);
+    layer.removedReverseConnects.push_back(id);
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode wakeupEpollNetworkLayer(UA_ServerNetworkLayer& nl) noexcept {
+    if (getEpollFd(nl) < 0) {
+        return UA_STATUSCODE_BADNOTSUPPORTED;
+    }
+    const uint64_t value = 1;
+    if (::write(getLayer(&nl).wakeup.fd, &value, sizeof(value)) < 0 && errno != EAGAIN) {
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+void setEpollSocketOptions(UA_ServerNetworkLayer& nl, const TransportConfig& config) noexcept {
+    if (getEpollFd(nl) < 0) {
+        return;
+    }
+    auto& options = getLayer(&nl).socketOptions;
+    options = config;
+    if (!options.noDelay) {
+        options.noDelay = true;  // low latency by default, like the default network layer
+    }
+}
+
+int getEpollFd(const UA_ServerNetworkLayer& nl) noexcept {
+    if (nl.start != startLayer || nl.handle == nullptr) {
+        return -1;
+    }
+    return static_cast<const EpollLayer*>(nl.handle)->epollFd;
+}
+
+}  // namespace opcua::detail
+
+#endif
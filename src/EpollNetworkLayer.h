@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+#include "open62541pp/Common.h"  // TransportConfig
+#include "open62541pp/Config.h"
+
+#include "open62541_impl.h"
+
+// network layer plugin API of open62541 v1.1 - v1.3 (replaced by the event loop in v1.4)
+#if defined(__linux__) && UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+#define UAPP_EPOLL_NETWORK_LAYER
+#endif
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+
+namespace opcua::detail {
+
+/**
+ * Initialize a TCP server network layer based on epoll (NetworkBackend::Epoll).
+ *
+ * The listening and connection sockets are registered with a single epoll instance, created with
+ * the network layer. Readiness is reported in O(1) per ready socket instead of scanning all
+ * sockets with select, the number of connections isn't limited by `FD_SETSIZE`. Received messages
+ * are read into a buffer shared by all connections.
+ *
+ * @param nl Network layer to initialize (overwritten, not cleared)
+ * @param port Port number of the listening sockets (IPv4 and IPv6)
+ * @param config Connection config, e.g. of the replaced network layer
+ */
+UA_StatusCode initEpollNetworkLayer(
+    UA_ServerNetworkLayer& nl, uint16_t port, const UA_ConnectionConfig& config
+);
+
+/**
+ * Add a reverse connect to a client listening at `url` (`opc.tcp://host:port`).
+ * The network layer connects to the client and sends a ReverseHello message, the client then
+ * proceeds like with a regular connection. Closed connections are re-established.
+ * Thread-safe, the change is applied with the next iteration of the network layer.
+ * @param id Assigned id of the reverse connect
+ */
+UA_StatusCode addEpollReverseConnect(
+    UA_ServerNetworkLayer& nl, std::string_view url, uint64_t& id
+);
+
+/// Remove a reverse connect and close its connection.
+UA_StatusCode removeEpollReverseConnect(UA_ServerNetworkLayer& nl, uint64_t id);
+
+/**
+ * Interrupt a waiting listen of an epoll network layer, e.g. to process commands queued by other
+ * threads without waiting for the next timer. Thread-safe.
+ */
+UA_StatusCode wakeupEpollNetworkLayer(UA_ServerNetworkLayer& nl) noexcept;
+
+/**
+ * Set the socket options (TransportConfig) of accepted and reverse connect sockets of an epoll
+ * network layer, applied to new connections. `TCP_NODELAY` is enabled unless disabled explicitly.
+ */
+void setEpollSocketOptions(UA_ServerNetworkLayer& nl, const TransportConfig& config) noexcept;
+
+/// Get the epoll file descriptor of an epoll network layer, -1 for other network layers.
+int getEpollFd(const UA_ServerNetworkLayer& nl) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
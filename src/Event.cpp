@@ -3,7 +3,9 @@
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/TypeWrapper.h"  // operator==
+#include "open62541pp/detail/helper.h"  // toNativeString
 #include "open62541pp/overloads/comparison.h"  // operator==
+#include "open62541pp/types/Composed.h"  // BrowsePathResult
 #include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/Variant.h"
 
@@ -35,20 +37,22 @@ const NodeId& Event::getNodeId() const noexcept {
     return id_;
 }
 
+// avoid allocations of the property names and values, the server copies them into the node
 Event& Event::writeSourceName(std::string_view sourceName) {
-    return writeProperty({0, "SourceName"}, Variant::fromScalar(String(sourceName)));
+    UA_String native = detail::toNativeString(sourceName);
+    return writeProperty(QualifiedNameView(0, "SourceName"), Variant::fromScalar(native));
 }
 
 Event& Event::writeTime(DateTime time) {
-    return writeProperty({0, "Time"}, Variant::fromScalar(time));
+    return writeProperty(QualifiedNameView(0, "Time"), Variant::fromScalar(time));
 }
 
 Event& Event::writeSeverity(uint16_t severity) {
-    return writeProperty({0, "Severity"}, Variant::fromScalar(severity));
+    return writeProperty(QualifiedNameView(0, "Severity"), Variant::fromScalar(severity));
 }
 
 Event& Event::writeMessage(const LocalizedText& message) {
-    return writeProperty({0, "Message"}, Variant::fromScalar(message));
+    return writeProperty(QualifiedNameView(0, "Message"), Variant::fromScalar(message));
 }
 
 Event& Event::writeProperty(const QualifiedName& propertyName, const Variant& value) {
@@ -72,6 +76,51 @@ ByteString Event::trigger(const NodeId& originId) {
     return eventId;
 }
 
+EventTemplate::EventTemplate(
+    Server& server, const NodeId& eventType, Span<const QualifiedName> fields
+)
+    : event_(server, eventType),
+      fields_(fields.begin(), fields.end()) {
+    fieldIds_.reserve(fields_.size());
+    for (const auto& field : fields_) {
+        const BrowsePathResult result = UA_Server_browseSimplifiedBrowsePath(
+            server.handle(), event_.getNodeId(), 1, field.handle()
+        );
+        detail::throwOnBadStatus(result->statusCode);
+        if (result->targetsSize == 0) {
+            throw BadStatus(UA_STATUSCODE_BADNOMATCH);
+        }
+        fieldIds_.emplace_back(result->targets[0].targetId.nodeId);  // NOLINT
+    }
+}
+
+Event& EventTemplate::getEvent() noexcept {
+    return event_;
+}
+
+Span<const QualifiedName> EventTemplate::getFields() const noexcept {
+    return fields_;
+}
+
+Span<const NodeId> EventTemplate::getFieldIds() const noexcept {
+    return fieldIds_;
+}
+
+ByteString EventTemplate::trigger(Span<const Variant> values, const NodeId& originId) {
+    if (values.size() != fieldIds_.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    auto* server = event_.getConnection().handle();
+    for (size_t i = 0; i < values.size(); ++i) {
+        if (values[i].isEmpty()) {
+            continue;
+        }
+        const auto status = UA_Server_writeValue(server, fieldIds_[i], values[i]);
+        detail::throwOnBadStatus(status);
+    }
+    return event_.trigger(originId);
+}
+
 #endif
 
 bool operator==(const Event& lhs, const Event& rhs) noexcept {
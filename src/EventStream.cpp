@@ -0,0 +1,46 @@
+#include "open62541pp/EventStream.h"
+
+#include "open62541pp/Config.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+
+#include <utility>  // move
+
+#include "detail/EventStreamState.h"
+
+namespace opcua {
+
+EventStream::EventStream(std::shared_ptr<detail::EventStreamState> state)
+    : state_(std::move(state)) {}
+
+Span<const QualifiedName> EventStream::getFields() const noexcept {
+    return state_->getFields();
+}
+
+void EventStream::push(std::vector<Variant> values) {
+    state_->push({}, std::move(values));
+}
+
+void EventStream::push(std::string_view conditionKey, std::vector<Variant> values) {
+    state_->push(conditionKey, std::move(values));
+}
+
+size_t EventStream::getQueueSize() const {
+    return state_->getQueueSize();
+}
+
+uint64_t EventStream::getDroppedCount() const noexcept {
+    return state_->getDroppedCount();
+}
+
+uint64_t EventStream::getCoalescedCount() const noexcept {
+    return state_->getCoalescedCount();
+}
+
+uint64_t EventStream::getTriggeredCount() const noexcept {
+    return state_->getTriggeredCount();
+}
+
+}  // namespace opcua
+
+#endif
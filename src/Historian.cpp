@@ -0,0 +1,273 @@
+#include "Historian.h"
+
+#ifdef UA_ENABLE_HISTORIZING
+
+#include <algorithm>  // max, min
+#include <cstring>  // memcpy
+
+#include "open62541pp/CachedClock.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/types/DateTime.h"
+
+namespace opcua {
+
+/* ---------------------------------------- HistoryBuffer --------------------------------------- */
+
+HistoryBuffer::HistoryBuffer(const HistorizingOptions& options)
+    : options_(options),
+      slots_(std::max<size_t>(options.capacity, 1)) {}
+
+void HistoryBuffer::push(const UA_DataValue& value) {
+    int64_t key = 0;
+    if (value.hasSourceTimestamp) {
+        key = value.sourceTimestamp;
+    } else if (value.hasServerTimestamp) {
+        key = value.serverTimestamp;
+    } else {
+        key = CachedClock::now().get();
+    }
+    if (count_ > 0) {
+        key = std::max(key, keyAt(count_ - 1));  // keep keys sorted
+    }
+    if (count_ == slots_.size()) {
+        popFront();
+    }
+    auto& slot = slots_[(start_ + count_) % slots_.size()];
+    slot.key = key;
+    slot.value = asWrapper<DataValue>(value);  // copy
+    if (!value.hasSourceTimestamp && !value.hasServerTimestamp) {
+        slot.value->sourceTimestamp = key;
+        slot.value->hasSourceTimestamp = true;
+    }
+    ++count_;
+
+    if (options_.maxAge.count() > 0) {
+        const int64_t maxAge = options_.maxAge.count() * UA_DATETIME_MSEC;
+        while (count_ > 1 && keyAt(0) < key - maxAge) {
+            popFront();
+        }
+    }
+}
+
+size_t HistoryBuffer::lowerBound(int64_t time) const noexcept {
+    size_t first = 0;
+    size_t count = count_;
+    while (count > 0) {
+        const size_t step = count / 2;
+        if (keyAt(first + step) < time) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+size_t HistoryBuffer::upperBound(int64_t time) const noexcept {
+    size_t first = 0;
+    size_t count = count_;
+    while (count > 0) {
+        const size_t step = count / 2;
+        if (keyAt(first + step) <= time) {
+            first += step + 1;
+            count -= step + 1;
+        } else {
+            count = step;
+        }
+    }
+    return first;
+}
+
+void HistoryBuffer::popFront() noexcept {
+    slots_[start_].value = {};
+    start_ = (start_ + 1) % slots_.size();
+    --count_;
+    ++firstSequence_;
+}
+
+/* ------------------------------------------ Historian ----------------------------------------- */
+
+/// Continuation points are stateless and contain the sequence number of the next value.
+static UA_StatusCode encodeContinuationPoint(
+    uint64_t sequence, UA_ByteString& continuationPoint
+) {
+    UA_ByteString_clear(&continuationPoint);
+    const auto status = UA_ByteString_allocBuffer(&continuationPoint, sizeof(sequence));
+    if (status == UA_STATUSCODE_GOOD) {
+        std::memcpy(continuationPoint.data, &sequence, sizeof(sequence));
+    }
+    return status;
+}
+
+static bool decodeContinuationPoint(const UA_ByteString& continuationPoint, uint64_t& sequence) {
+    if (continuationPoint.length != sizeof(sequence)) {
+        return false;
+    }
+    std::memcpy(&sequence, continuationPoint.data, sizeof(sequence));
+    return true;
+}
+
+static void applyTimestampsToReturn(UA_DataValue& dv, UA_TimestampsToReturn timestamps) noexcept {
+    const bool neither = timestamps == UA_TIMESTAMPSTORETURN_NEITHER;
+    if (neither || timestamps == UA_TIMESTAMPSTORETURN_SERVER) {
+        dv.hasSourceTimestamp = false;
+        dv.hasSourcePicoseconds = false;
+    }
+    if (neither || timestamps == UA_TIMESTAMPSTORETURN_SOURCE) {
+        dv.hasServerTimestamp = false;
+        dv.hasServerPicoseconds = false;
+    }
+}
+
+/// Read the raw values of a single node.
+/// Forward reads return values in [start, end), reverse reads (start > end or no start) return
+/// values in (end, start] from the newest to the oldest value.
+static UA_StatusCode readRaw(
+    const HistoryBuffer& buffer,
+    const UA_ReadRawModifiedDetails& details,
+    UA_TimestampsToReturn timestamps,
+    const UA_ByteString& continuationPointIn,
+    UA_ByteString& continuationPointOut,
+    UA_HistoryData& historyData
+) {
+    const bool hasStart = details.startTime != 0;
+    const bool hasEnd = details.endTime != 0;
+    if (!hasStart && !hasEnd) {
+        return UA_STATUSCODE_BADINVALIDTIMESTAMPARGUMENT;
+    }
+    const bool reverse = !hasStart || (hasEnd && details.startTime > details.endTime);
+
+    // index range [first, last) of the matching values
+    size_t first = 0;
+    size_t last = buffer.size();
+    if (!reverse) {
+        first = buffer.lowerBound(details.startTime);
+        last = hasEnd ? buffer.lowerBound(details.endTime) : buffer.size();
+    } else if (hasStart) {
+        first = hasEnd ? buffer.upperBound(details.endTime) : 0;
+        last = buffer.upperBound(details.startTime);
+    } else {
+        last = buffer.upperBound(details.endTime);
+    }
+
+    if (continuationPointIn.length > 0) {
+        uint64_t sequence = 0;
+        if (!decodeContinuationPoint(continuationPointIn, sequence)) {
+            return UA_STATUSCODE_BADCONTINUATIONPOINTINVALID;
+        }
+        const uint64_t firstSequence = buffer.getFirstSequence();
+        const size_t index = sequence < firstSequence ? 0 : sequence - firstSequence;
+        if (reverse) {
+            last = std::min(last, index + 1);
+        } else {
+            first = std::max(first, index);
+        }
+    }
+
+    const size_t available = last > first ? last - first : 0;
+    const size_t limit = details.numValuesPerNode == 0 ? available : details.numValuesPerNode;
+    const size_t count = std::min(available, limit);
+
+    if (count > 0) {
+        auto* values = static_cast<UA_DataValue*>(
+            UA_Array_new(count, &UA_TYPES[UA_TYPES_DATAVALUE])
+        );
+        if (values == nullptr) {
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        for (size_t i = 0; i < count; ++i) {
+            const size_t index = reverse ? last - 1 - i : first + i;
+            UA_DataValue_copy(buffer.at(index).handle(), &values[i]);  // NOLINT
+            applyTimestampsToReturn(values[i], timestamps);  // NOLINT
+        }
+        historyData.dataValues = values;
+        historyData.dataValuesSize = count;
+    }
+
+    if (count < available) {
+        const size_t next = reverse ? last - 1 - count : first + count;
+        return encodeContinuationPoint(buffer.getFirstSequence() + next, continuationPointOut);
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+static Historian* getHistorian(void* hdbContext) noexcept {
+    return static_cast<Historian*>(hdbContext);
+}
+
+void Historian::install(UA_Server* server) noexcept {
+    auto& hdb = UA_Server_getConfig(server)->historyDatabase;
+    if (hdb.clear != nullptr) {
+        hdb.clear(&hdb);
+    }
+    hdb = {};
+    hdb.context = this;
+    hdb.setValue = [](UA_Server* /* server */,
+                      void* hdbContext,
+                      const UA_NodeId* /* sessionId */,
+                      void* /* sessionContext */,
+                      const UA_NodeId* nodeId,
+                      UA_Boolean historizing,
+                      const UA_DataValue* value) {
+        if (!historizing || value == nullptr) {
+            return;
+        }
+        auto* buffer = getHistorian(hdbContext)->find(asWrapper<NodeId>(*nodeId));
+        if (buffer != nullptr) {
+            detail::invokeCatchIgnore([&] { buffer->push(*value); });
+        }
+    };
+    hdb.readRaw = [](UA_Server* /* server */,
+                     void* hdbContext,
+                     const UA_NodeId* /* sessionId */,
+                     void* /* sessionContext */,
+                     const UA_RequestHeader* /* requestHeader */,
+                     const UA_ReadRawModifiedDetails* details,
+                     UA_TimestampsToReturn timestampsToReturn,
+                     UA_Boolean releaseContinuationPoints,
+                     size_t nodesToReadSize,
+                     const UA_HistoryReadValueId* nodesToRead,
+                     UA_HistoryReadResponse* response,
+                     UA_HistoryData* const* const historyData) {
+        response->responseHeader.serviceResult = UA_STATUSCODE_GOOD;
+        if (releaseContinuationPoints) {
+            return;  // continuation points are stateless
+        }
+        for (size_t i = 0; i < nodesToReadSize; ++i) {
+            auto& result = response->results[i];  // NOLINT
+            const auto& item = nodesToRead[i];  // NOLINT
+            if (details->isReadModified) {
+                result.statusCode = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+                continue;
+            }
+            const auto* buffer = getHistorian(hdbContext)->find(asWrapper<NodeId>(item.nodeId));
+            if (buffer == nullptr) {
+                result.statusCode = UA_STATUSCODE_BADHISTORYOPERATIONUNSUPPORTED;
+                continue;
+            }
+            result.statusCode = readRaw(
+                *buffer,
+                *details,
+                timestampsToReturn,
+                item.continuationPoint,
+                result.continuationPoint,
+                *historyData[i]  // NOLINT
+            );
+        }
+    };
+}
+
+void Historian::enable(const NodeId& id, const HistorizingOptions& options) {
+    buffers_.insert_or_assign(id, std::make_unique<HistoryBuffer>(options));
+}
+
+HistoryBuffer* Historian::find(const NodeId& id) noexcept {
+    const auto it = buffers_.find(id);
+    return it != buffers_.end() ? it->second.get() : nullptr;
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,93 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Historizing.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "open62541_impl.h"
+
+#ifdef UA_ENABLE_HISTORIZING
+
+namespace opcua {
+
+/**
+ * Ring buffer of the historical values of a single node.
+ *
+ * Values are stored in the order of arrival. The search keys are the source timestamps (server
+ * timestamps as fallback), clamped to be non-decreasing to allow binary searches even if values
+ * arrive out of order. Every value has a sequence number used for continuation points.
+ */
+class HistoryBuffer {
+public:
+    explicit HistoryBuffer(const HistorizingOptions& options);
+
+    void push(const UA_DataValue& value);
+
+    size_t size() const noexcept {
+        return count_;
+    }
+
+    /// Sequence number of the oldest value.
+    uint64_t getFirstSequence() const noexcept {
+        return firstSequence_;
+    }
+
+    const DataValue& at(size_t index) const noexcept {
+        return slots_[(start_ + index) % slots_.size()].value;
+    }
+
+    int64_t keyAt(size_t index) const noexcept {
+        return slots_[(start_ + index) % slots_.size()].key;
+    }
+
+    /// Index of the first value with key >= time.
+    size_t lowerBound(int64_t time) const noexcept;
+
+    /// Index of the first value with key > time.
+    size_t upperBound(int64_t time) const noexcept;
+
+private:
+    struct Slot {
+        int64_t key{0};
+        DataValue value;
+    };
+
+    void popFront() noexcept;
+
+    HistorizingOptions options_;
+    std::vector<Slot> slots_;
+    size_t start_{0};
+    size_t count_{0};
+    uint64_t firstSequence_{0};
+};
+
+/**
+ * In-memory history database of the server.
+ *
+ * Values are recorded by the `setValue` hook of the history database on every write of a
+ * historizing variable and served by the `readRaw` hook (HistoryReadRawModified). All hooks are
+ * called within the server's main loop, no locks are required.
+ */
+class Historian {
+public:
+    /// Install the history database hooks in the server config.
+    void install(UA_Server* server) noexcept;
+
+    void enable(const NodeId& id, const HistorizingOptions& options);
+
+    HistoryBuffer* find(const NodeId& id) noexcept;
+
+private:
+    std::unordered_map<NodeId, std::unique_ptr<HistoryBuffer>> buffers_;
+};
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,378 @@
+#include "InProcessConnection.h"
+
+#ifdef UAPP_IN_PROCESS_CONNECTION
+
+#include <algorithm>  // remove_if
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>  // offsetof
+#include <deque>
+#include <new>  // nothrow
+#include <utility>  // exchange, move
+
+#include "open62541pp/types/Builtin.h"  // ByteString
+
+namespace opcua::detail {
+
+struct InProcessChannel {
+    // server side, accessed by the server thread only
+    UA_Connection* serverConnection{nullptr};  // freed by the server with a delayed callback
+    bool removed{false};
+
+    // server to client
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<UA_ByteString> toClient;
+    bool serverClosed{false};
+    bool clientClosed{false};
+
+    InProcessChannel() = default;
+    InProcessChannel(const InProcessChannel&) = delete;
+    InProcessChannel(InProcessChannel&&) = delete;
+    InProcessChannel& operator=(const InProcessChannel&) = delete;
+    InProcessChannel& operator=(InProcessChannel&&) = delete;
+
+    ~InProcessChannel() {
+        clearMessages();
+    }
+
+    void clearMessages() noexcept {
+        for (auto& buf : toClient) {
+            UA_ByteString_clear(&buf);
+        }
+        toClient.clear();
+    }
+};
+
+namespace {
+
+struct ServerEnd {
+    std::shared_ptr<InProcessChannel> channel;
+    UA_Connection connection{};
+};
+
+struct ClientEnd {
+    std::shared_ptr<InProcessHub> hub;
+    std::shared_ptr<InProcessChannel> channel;
+};
+
+UA_StatusCode getSendBuffer(UA_Connection* connection, size_t length, UA_ByteString* buf) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    if (length > connection->config.sendBufferSize) {
+        return UA_STATUSCODE_BADCOMMUNICATIONERROR;
+    }
+    return UA_ByteString_allocBuffer(buf, length);
+}
+
+void releaseBuffer(UA_Connection* /* connection */, UA_ByteString* buf) {
+    UA_ByteString_clear(buf);
+}
+
+/* ----------------------------------------- Server side ---------------------------------------- */
+
+ServerEnd* getServerEnd(UA_Connection* connection) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* bytes = reinterpret_cast<char*>(connection);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<ServerEnd*>(bytes - offsetof(ServerEnd, connection));
+}
+
+void markServerClosed(InProcessChannel& channel) noexcept {
+    {
+        const std::lock_guard lock(channel.mutex);
+        channel.serverClosed = true;
+    }
+    channel.cv.notify_all();
+}
+
+UA_StatusCode sendToClient(UA_Connection* connection, UA_ByteString* buf) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        UA_ByteString_clear(buf);
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    auto& channel = *getServerEnd(connection)->channel;
+    {
+        std::unique_lock lock(channel.mutex);
+        if (channel.clientClosed) {
+            lock.unlock();
+            UA_ByteString_clear(buf);
+            return UA_STATUSCODE_BADCONNECTIONCLOSED;  // closed by the next command
+        }
+        try {
+            channel.toClient.push_back(std::exchange(*buf, UA_BYTESTRING_NULL));
+        } catch (const std::bad_alloc&) {
+            lock.unlock();
+            UA_ByteString_clear(buf);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+    }
+    channel.cv.notify_one();
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode recvFromClient(
+    UA_Connection* /* connection */, UA_ByteString* /* response */, UA_UInt32 /* timeout */
+) {
+    // messages are delivered by the command queue of the server
+    return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+}
+
+void closeServerConnection(UA_Connection* connection) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return;
+    }
+    connection->state = UA_CONNECTIONSTATE_CLOSED;
+    markServerClosed(*getServerEnd(connection)->channel);
+    // remove the connection outside of the server's processing (e.g. of a timer)
+    auto* hub = static_cast<InProcessHub*>(connection->handle);
+    hub->post([hub = hub->shared_from_this()] { hub->removeClosed(); });
+}
+
+void freeServerConnection(UA_Connection* connection) {
+    delete getServerEnd(connection);  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+/* ----------------------------------------- Client side ---------------------------------------- */
+
+ClientEnd* getClientEnd(UA_Connection* connection) noexcept {
+    return static_cast<ClientEnd*>(connection->handle);
+}
+
+void closeClientConnection(UA_Connection* connection) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return;
+    }
+    connection->state = UA_CONNECTIONSTATE_CLOSED;
+    auto* end = getClientEnd(connection);
+    if (end == nullptr) {
+        return;
+    }
+    {
+        const std::lock_guard lock(end->channel->mutex);
+        end->channel->clientClosed = true;
+        end->channel->clearMessages();
+    }
+    end->hub->post([hub = end->hub, channel = end->channel] { hub->closeServerSide(channel); });
+}
+
+UA_StatusCode sendToServer(UA_Connection* connection, UA_ByteString* buf) {
+    auto* end = getClientEnd(connection);
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED || end == nullptr) {
+        UA_ByteString_clear(buf);
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    bool posted = false;
+    try {
+        ByteString message(std::move(*buf));  // take over the buffer, no copy
+        posted = end->hub->post(
+            [hub = end->hub, channel = end->channel, message = std::move(message)] {
+                hub->deliver(channel, *message.handle());
+            }
+        );
+    } catch (const std::bad_alloc&) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    if (!posted) {
+        closeClientConnection(connection);
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode recvFromServer(
+    UA_Connection* connection, UA_ByteString* response, UA_UInt32 timeout
+) {
+    auto* end = getClientEnd(connection);
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED || end == nullptr) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    auto& channel = *end->channel;
+    bool serverClosed = false;
+    {
+        std::unique_lock lock(channel.mutex);
+        channel.cv.wait_for(lock, std::chrono::milliseconds(timeout), [&] {
+            return !channel.toClient.empty() || channel.serverClosed;
+        });
+        // pending responses are received before the close is reported
+        if (!channel.toClient.empty()) {
+            *response = channel.toClient.front();
+            channel.toClient.pop_front();
+            return UA_STATUSCODE_GOOD;
+        }
+        serverClosed = channel.serverClosed;
+    }
+    if (serverClosed || end->hub->isDetached()) {
+        closeClientConnection(connection);
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+}
+
+void freeClientConnection(UA_Connection* connection) {
+    delete getClientEnd(connection);  // NOLINT(cppcoreguidelines-owning-memory)
+    connection->handle = nullptr;
+}
+
+}  // namespace
+
+InProcessHub::InProcessHub(UA_Server* server, PostFunc post)
+    : server_(server),
+      post_(std::move(post)) {}
+
+UA_Connection InProcessHub::connect(const UA_ConnectionConfig& config) {
+    UA_Connection connection{};
+    connection.state = UA_CONNECTIONSTATE_CLOSED;
+    connection.config = config;
+    connection.sockfd = UA_INVALID_SOCKET;
+    connection.getSendBuffer = getSendBuffer;
+    connection.releaseSendBuffer = releaseBuffer;
+    connection.send = sendToServer;
+    connection.recv = recvFromServer;
+    connection.releaseRecvBuffer = releaseBuffer;
+    connection.close = closeClientConnection;
+    connection.free = freeClientConnection;
+    if (isDetached()) {
+        return connection;
+    }
+    auto* end = new (std::nothrow) ClientEnd{};  // NOLINT(cppcoreguidelines-owning-memory)
+    if (end == nullptr) {
+        return connection;
+    }
+    try {
+        end->hub = shared_from_this();
+        end->channel = std::make_shared<InProcessChannel>();
+    } catch (const std::bad_alloc&) {
+        delete end;  // NOLINT(cppcoreguidelines-owning-memory)
+        return connection;
+    }
+    connection.handle = end;
+    connection.state = UA_CONNECTIONSTATE_OPENING;
+    return connection;
+}
+
+void InProcessHub::detach() noexcept {
+    {
+        const std::lock_guard lock(mutex_);
+        post_ = nullptr;
+    }
+    detached_ = true;
+    for (const auto& channel : channels_) {
+        if (!channel->removed) {
+            channel->serverConnection->state = UA_CONNECTIONSTATE_CLOSED;
+            channel->removed = true;
+            UA_Server_removeConnection(server_, std::exchange(channel->serverConnection, nullptr));
+        }
+        markServerClosed(*channel);
+    }
+    channels_.clear();
+}
+
+bool InProcessHub::post(std::function<void()> command) {
+    const std::lock_guard lock(mutex_);
+    if (!post_) {
+        return false;
+    }
+    post_(std::move(command));
+    return true;
+}
+
+bool InProcessHub::isDetached() noexcept {
+    const std::lock_guard lock(mutex_);
+    return !post_;
+}
+
+void InProcessHub::deliver(
+    const std::shared_ptr<InProcessChannel>& channel, const UA_ByteString& message
+) {
+    if (detached_ || channel->removed) {
+        return;
+    }
+    if (channel->serverConnection == nullptr) {
+        // first message (Hello), accept the connection
+        auto* end = new (std::nothrow) ServerEnd{};  // NOLINT(cppcoreguidelines-owning-memory)
+        if (end == nullptr) {
+            channel->removed = true;
+            markServerClosed(*channel);
+            return;
+        }
+        const auto* config = UA_Server_getConfig(server_);
+        end->channel = channel;
+        auto& connection = end->connection;
+        connection.state = UA_CONNECTIONSTATE_OPENING;
+        connection.config = config->networkLayersSize > 0
+            ? config->networkLayers[0].localConnectionConfig
+            : UA_ConnectionConfig_default;
+        connection.sockfd = UA_INVALID_SOCKET;
+        connection.handle = this;
+        connection.openingDate = UA_DateTime_nowMonotonic();
+        connection.getSendBuffer = getSendBuffer;
+        connection.releaseSendBuffer = releaseBuffer;
+        connection.send = sendToClient;
+        connection.recv = recvFromClient;
+        connection.releaseRecvBuffer = releaseBuffer;
+        connection.close = closeServerConnection;
+        connection.free = freeServerConnection;
+        try {
+            channels_.push_back(channel);
+        } catch (const std::bad_alloc&) {
+            delete end;  // NOLINT(cppcoreguidelines-owning-memory)
+            channel->removed = true;
+            markServerClosed(*channel);
+            return;
+        }
+        channel->serverConnection = &connection;
+    }
+    if (channel->serverConnection->state != UA_CONNECTIONSTATE_CLOSED) {
+        UA_Server_processBinaryMessage(server_, channel->serverConnection, &message);
+    }
+    removeClosed();
+}
+
+void InProcessHub::closeServerSide(const std::shared_ptr<InProcessChannel>& channel) noexcept {
+    if (channel->serverConnection == nullptr) {
+        channel->removed = true;  // closed before the first message was delivered
+        return;
+    }
+    channel->serverConnection->close(channel->serverConnection);
+    removeClosed();
+}
+
+void InProcessHub::removeClosed() noexcept {
+    for (const auto& channel : channels_) {
+        if (channel->serverConnection->state == UA_CONNECTIONSTATE_CLOSED) {
+            channel->removed = true;
+            // detaches the secure channel and frees the connection with a delayed callback
+            UA_Server_removeConnection(server_, std::exchange(channel->serverConnection, nullptr));
+        }
+    }
+    channels_.erase(
+        std::remove_if(
+            channels_.begin(),
+            channels_.end(),
+            [](const auto& channel) { return channel->removed; }
+        ),
+        channels_.end()
+    );
+}
+
+bool isInProcessUrl(std::string_view url) noexcept {
+    return url == inProcessUrl;
+}
+
+bool isInProcessConnection(const UA_Connection& connection) noexcept {
+    return connection.free == freeClientConnection;
+}
+
+UA_StatusCode pollInProcessConnection(UA_Connection& connection) noexcept {
+    if (connection.state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADDISCONNECT;
+    }
+    connection.state = UA_CONNECTIONSTATE_ESTABLISHED;
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace opcua::detail
+
+#endif
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+#include "open62541pp/Config.h"
+
+#include "open62541_impl.h"
+
+// client connection plugin API of open62541 v1.1 - v1.3
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+#define UAPP_IN_PROCESS_CONNECTION
+#endif
+
+#ifdef UAPP_IN_PROCESS_CONNECTION
+
+namespace opcua::detail {
+
+/// Endpoint URL of in-process connections, see Client::connect(Server&).
+inline constexpr std::string_view inProcessUrl = "opc.inproc://server";
+
+struct InProcessChannel;
+
+/**
+ * Server side of in-process connections between a client and a server of the same process.
+ *
+ * Messages of the client are handed over to the server thread with the command queue of the
+ * server (Server::post, which wakes up the epoll network backend) and processed with
+ * `UA_Server_processBinaryMessage`. Responses are handed
+ * over to the client with a queue per connection. The buffers are moved, not copied.
+ * Secure channels, sessions and access control are the same as for TCP connections.
+ */
+class InProcessHub : public std::enable_shared_from_this<InProcessHub> {
+public:
+    using PostFunc = std::function<void(std::function<void()>)>;
+
+    InProcessHub(UA_Server* server, PostFunc post);
+
+    /// Create a client connection to the server, closed if the server was deleted.
+    UA_Connection connect(const UA_ConnectionConfig& config);
+
+    /// Close all connections, called before the server is deleted.
+    void detach() noexcept;
+
+    /// @private
+    bool post(std::function<void()> command);
+    /// @private
+    bool isDetached() noexcept;
+    /// @private
+    void deliver(const std::shared_ptr<InProcessChannel>& channel, const UA_ByteString& message);
+    /// @private
+    void closeServerSide(const std::shared_ptr<InProcessChannel>& channel) noexcept;
+    /// @private
+    void removeClosed() noexcept;
+
+private:
+    UA_Server* server_;
+    std::mutex mutex_;
+    PostFunc post_;  // empty after detach
+    // accessed by the server thread only
+    std::vector<std::shared_ptr<InProcessChannel>> channels_;
+    bool detached_{false};
+};
+
+/// Check if the endpoint URL addresses an in-process server.
+bool isInProcessUrl(std::string_view url) noexcept;
+
+/// Check if the connection was created with InProcessHub::connect.
+bool isInProcessConnection(const UA_Connection& connection) noexcept;
+
+/// Establish a connection created with InProcessHub::connect.
+UA_StatusCode pollInProcessConnection(UA_Connection& connection) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
@@ -63,19 +63,16 @@ inline static ServerContext::MonitoredItem& getMonitoredItemContext(
 inline static ClientContext::MonitoredItem& getMonitoredItemContext(
     Client& client, uint32_t subscriptionId, uint32_t monitoredItemId
 ) {
-    auto& monitoredItems = client.getContext().monitoredItems;
-    auto it = monitoredItems.find({subscriptionId, monitoredItemId});
-    if (it == monitoredItems.end()) {
+    auto* monitoredItem = client.getContext().findMonitoredItem(subscriptionId, monitoredItemId);
+    if (monitoredItem == nullptr) {
         throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
     }
-    assert(it->second != nullptr);
-    return *(it->second);
+    return *monitoredItem;
 }
 
 template <typename T>
 const NodeId& MonitoredItem<T>::getNodeId() const {
-    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_)
-        .itemToMonitor.getNodeId();
+    return getMonitoredItemContext(connection_, subscriptionId_, monitoredItemId_).getNodeId();
 }
 
 template <typename T>
@@ -110,6 +107,20 @@ void MonitoredItem<Client>::setMonitoringMode(MonitoringMode monitoringMode) {
     services::setMonitoringMode(connection_, subscriptionId_, monitoredItemId_, monitoringMode);
 }
 
+template <>
+void MonitoredItem<Client>::setClientDataChangeFilter(
+    std::optional<services::ClientDataChangeFilter> filter
+) {
+    services::setClientDataChangeFilter(connection_, subscriptionId_, monitoredItemId_, filter);
+}
+
+template <>
+void MonitoredItem<Server>::setClientDataChangeFilter(
+    std::optional<services::ClientDataChangeFilter> filter
+) {
+    services::setClientDataChangeFilter(connection_, monitoredItemId_, filter);
+}
+
 template <>
 void MonitoredItem<Client>::deleteMonitoredItem() {
     services::deleteMonitoredItem(connection_, subscriptionId_, monitoredItemId_);
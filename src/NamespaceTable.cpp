@@ -0,0 +1,49 @@
+#include "open62541pp/NamespaceTable.h"
+
+#include <utility>  // move
+
+namespace opcua {
+
+NamespaceTable::NamespaceTable(std::vector<std::string> uris)
+    : uris_(std::move(uris)) {
+    buildIndex();
+}
+
+// the index references the strings of the copied table, rebuild it for the copy
+NamespaceTable::NamespaceTable(const NamespaceTable& other)
+    : uris_(other.uris_) {
+    buildIndex();
+}
+
+NamespaceTable& NamespaceTable::operator=(const NamespaceTable& other) {
+    if (this != &other) {
+        uris_ = other.uris_;
+        buildIndex();
+    }
+    return *this;
+}
+
+std::optional<std::string_view> NamespaceTable::getUri(uint16_t namespaceIndex) const noexcept {
+    if (namespaceIndex >= uris_.size()) {
+        return std::nullopt;
+    }
+    return uris_[namespaceIndex];
+}
+
+std::optional<uint16_t> NamespaceTable::find(std::string_view uri) const noexcept {
+    const auto it = indexes_.find(uri);
+    if (it == indexes_.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void NamespaceTable::buildIndex() {
+    indexes_.clear();
+    indexes_.reserve(uris_.size());
+    for (size_t i = 0; i < uris_.size(); ++i) {
+        indexes_.try_emplace(uris_[i], static_cast<uint16_t>(i));
+    }
+}
+
+}  // namespace opcua
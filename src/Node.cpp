@@ -7,6 +7,8 @@
 #include "open62541pp/types/Composed.h"
 
 #include "open62541_impl.h"
+#include "services/AsyncService.h"
+#include "services/ServiceStatistics.h"
 
 namespace opcua {
 
@@ -21,7 +23,13 @@ bool Node<Client>::exists() noexcept {
     request.nodesToReadSize = 1;
     request.nodesToRead = &item;
 
-    const ReadResponse response = UA_Client_Service_read(getConnection().handle(), request);
+    const ReadResponse response = detail::invokeService(
+        getConnection(), StatisticsService::Read, [&] {
+            return detail::sendRequest<ReadResponse>(
+                getConnection(), request, UA_TYPES[UA_TYPES_READREQUEST]
+            );
+        }
+    );
     if (response->responseHeader.serviceResult != UA_STATUSCODE_GOOD ||
         response->resultsSize != 1) {
         return false;
@@ -0,0 +1,216 @@
+#include "open62541pp/NodeAttributeCache.h"
+
+#include <algorithm>  // find
+#include <array>
+#include <cstddef>
+#include <utility>  // move
+
+#include "open62541pp/BrowseCache.h"  // getModelChangeEventFilter
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/types/Variant.h"
+
+#include "detail/ModelChanges.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+constexpr std::array cachedAttributes{
+    AttributeId::NodeClass,
+    AttributeId::BrowseName,
+    AttributeId::DisplayName,
+    AttributeId::Description,
+    AttributeId::WriteMask,
+    AttributeId::IsAbstract,
+    AttributeId::Symmetric,
+    AttributeId::InverseName,
+    AttributeId::ContainsNoLoops,
+    AttributeId::EventNotifier,
+    AttributeId::DataType,
+    AttributeId::ValueRank,
+    AttributeId::ArrayDimensions,
+    AttributeId::AccessLevel,
+    AttributeId::MinimumSamplingInterval,
+    AttributeId::Historizing,
+    AttributeId::Executable,
+};
+
+}  // namespace
+
+/// Attributes not supported by the node class are cached, other errors might be transient.
+static bool isCacheable(const DataValue& dv) noexcept {
+    return !dv->hasStatus || !detail::isBadStatus(dv->status) ||
+           dv->status == UA_STATUSCODE_BADATTRIBUTEIDINVALID;
+}
+
+static size_t getAttributeIndex(AttributeId attributeId) noexcept {
+    return static_cast<size_t>(
+        std::find(cachedAttributes.begin(), cachedAttributes.end(), attributeId) -
+        cachedAttributes.begin()
+    );
+}
+
+Span<const AttributeId> NodeAttributeCache::getCachedAttributes() noexcept {
+    return cachedAttributes;
+}
+
+bool NodeAttributeCache::isCached(AttributeId attributeId) noexcept {
+    return getAttributeIndex(attributeId) < cachedAttributes.size();
+}
+
+std::optional<DataValue> NodeAttributeCache::lookup(
+    const NodeId& id, AttributeId attributeId, bool count
+) {
+    const auto index = getAttributeIndex(attributeId);
+    if (index < cachedAttributes.size()) {
+        const std::lock_guard lock(mutex_);
+        const auto it = entries_.find(id);
+        if (it != entries_.end()) {
+            const bool expired = timeToLive_ > Clock::duration::zero() &&
+                                 Clock::now() - it->second.inserted > timeToLive_;
+            if (expired) {
+                entries_.erase(it);
+            } else if (isCacheable(it->second.values[index])) {
+                if (count) {
+                    ++hits_;
+                }
+                return it->second.values[index];
+            }
+        }
+    }
+    if (count) {
+        ++misses_;
+    }
+    return std::nullopt;
+}
+
+std::optional<DataValue> NodeAttributeCache::find(const NodeId& id, AttributeId attributeId) {
+    return lookup(id, attributeId, true);
+}
+
+std::optional<DataValue> NodeAttributeCache::read(
+    Client& client, const NodeId& id, AttributeId attributeId
+) {
+    if (!isCached(attributeId)) {
+        return std::nullopt;
+    }
+    if (auto dv = lookup(id, attributeId, true)) {
+        return dv;
+    }
+    prefetch(client, {&id, 1});
+    return lookup(id, attributeId, false);
+}
+
+bool NodeAttributeCache::contains(const NodeId& id) {
+    const std::lock_guard lock(mutex_);
+    const auto it = entries_.find(id);
+    if (it == entries_.end()) {
+        return false;
+    }
+    const bool expired = timeToLive_ > Clock::duration::zero() &&
+                         Clock::now() - it->second.inserted > timeToLive_;
+    return !expired;
+}
+
+void NodeAttributeCache::insert(const NodeId& id, Span<const DataValue> values) {
+    if (values.size() != cachedAttributes.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    // don't store nodes without a single cacheable attribute (e.g. unknown nodes)
+    if (std::none_of(values.begin(), values.end(), isCacheable)) {
+        return;
+    }
+    const std::lock_guard lock(mutex_);
+    auto& entry = entries_[id];
+    entry.inserted = Clock::now();
+    entry.values.assign(values.begin(), values.end());
+}
+
+void NodeAttributeCache::prefetch(Client& client, Span<const NodeId> ids) {
+    std::vector<NodeId> missing;
+    std::vector<ReadValueId> nodesToRead;
+    for (const auto& id : ids) {
+        if (contains(id) || std::find(missing.begin(), missing.end(), id) != missing.end()) {
+            continue;
+        }
+        missing.push_back(id);
+        for (const auto attributeId : cachedAttributes) {
+            nodesToRead.emplace_back(id, attributeId);
+        }
+    }
+    if (missing.empty()) {
+        return;
+    }
+    const auto values = services::readAttributes(client, nodesToRead);
+    for (size_t i = 0; i < missing.size(); ++i) {
+        insert(
+            missing[i],
+            Span(values).subview(i * cachedAttributes.size(), cachedAttributes.size())
+        );
+    }
+}
+
+void NodeAttributeCache::prefetch(Client& client, Span<const ReferenceDescription> references) {
+    std::vector<NodeId> ids;
+    ids.reserve(references.size());
+    for (const auto& ref : references) {
+        if (ref.getNodeId().isLocal()) {
+            ids.push_back(ref.getNodeId().getNodeId());
+        }
+    }
+    prefetch(client, ids);
+}
+
+void NodeAttributeCache::invalidate(const NodeId& id) {
+    const std::lock_guard lock(mutex_);
+    entries_.erase(id);
+}
+
+void NodeAttributeCache::clear() {
+    const std::lock_guard lock(mutex_);
+    entries_.clear();
+}
+
+size_t NodeAttributeCache::size() const {
+    const std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+void NodeAttributeCache::handleModelChangeEvent(Span<const Variant> eventFields) {
+    const auto changes = detail::getModelChanges(eventFields);
+    const bool clearAll = changes.empty() ||
+                          std::find(changes.begin(), changes.end(), nullptr) != changes.end();
+    if (clearAll) {
+        clear();
+        return;
+    }
+    for (const auto* change : changes) {
+        invalidate(asWrapper<NodeId>(change->affected));
+    }
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+MonitoredItem<Client> subscribeModelChanges(
+    Subscription<Client>& subscription, const std::shared_ptr<NodeAttributeCache>& cache
+) {
+    return subscription.subscribeEvent(
+        ObjectId::Server,
+        BrowseCache::getModelChangeEventFilter(),
+        [weakCache = std::weak_ptr<NodeAttributeCache>(cache)](
+            [[maybe_unused]] const MonitoredItem<Client>& item, Span<const Variant> eventFields
+        ) {
+            if (auto locked = weakCache.lock()) {
+                locked->handleModelChangeEvent(eventFields);
+            }
+        }
+    );
+}
+#endif
+
+}  // namespace opcua
@@ -0,0 +1,41 @@
+#include "open62541pp/NodeIdNames.h"
+
+#include <algorithm>  // lower_bound
+#include <iterator>  // begin, end, size
+
+#include "NodeIdNamesTable.h"
+
+namespace opcua {
+
+std::optional<NodeId> lookupNodeId(std::string_view name) noexcept {
+    using namespace detail;  // NOLINT
+    const uint32_t hash = hashNodeIdName(name);
+    const uint32_t seed = nodeIdNameSeeds[hashNodeIdName(hash, 0) % std::size(nodeIdNameSeeds)];
+    const uint16_t index = nodeIdNameSlots[hashNodeIdName(hash, seed) % std::size(nodeIdNameSlots)];
+    if (index >= std::size(nodeIdNames) || nodeIdNames[index].name != name) {
+        return std::nullopt;
+    }
+    return NodeId(0, nodeIdNames[index].id);
+}
+
+std::string_view lookupNodeIdName(uint32_t id) noexcept {
+    const auto* it = std::lower_bound(
+        std::begin(detail::nodeIdNames),
+        std::end(detail::nodeIdNames),
+        id,
+        [](const detail::NodeIdName& entry, uint32_t value) { return entry.id < value; }
+    );
+    if (it == std::end(detail::nodeIdNames) || it->id != id) {
+        return {};
+    }
+    return it->name;
+}
+
+std::string_view lookupNodeIdName(const NodeId& id) noexcept {
+    if (id.getNamespaceIndex() != 0 || id.getIdentifierType() != NodeIdType::Numeric) {
+        return {};
+    }
+    return lookupNodeIdName(id.handle()->identifier.numeric);
+}
+
+}  // namespace opcua
@@ -0,0 +1,71 @@
+#include "open62541pp/NodeIdPool.h"
+
+#include <utility>  // move
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+static const NodeId& getNullNodeId() noexcept {
+    static const NodeId nullId;
+    return nullId;
+}
+
+const NodeId& InternedNodeId::get() const noexcept {
+    return entry_ ? entry_->id : getNullNodeId();
+}
+
+uint32_t InternedNodeId::hash() const noexcept {
+    return entry_ ? entry_->hash : getNullNodeId().hash();
+}
+
+long InternedNodeId::useCount() const noexcept {
+    return entry_.use_count();
+}
+
+bool operator==(const InternedNodeId& lhs, const InternedNodeId& rhs) noexcept {
+    if (lhs.entry_ == rhs.entry_) {
+        return true;
+    }
+    if (lhs.entry_ && rhs.entry_ && lhs.entry_->pool == rhs.entry_->pool) {
+        return false;  // interned by the same pool
+    }
+    return lhs.hash() == rhs.hash() && lhs.get() == rhs.get();
+}
+
+InternedNodeId NodeIdPool::intern(const NodeId& id) {
+    const auto hash = id.hash();
+    const std::lock_guard lock(mutex_);
+    const auto [first, last] = entries_.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        if (it->second->id == id) {
+            return InternedNodeId(it->second);
+        }
+    }
+    auto entry = std::make_shared<const InternedNodeId::Entry>(
+        InternedNodeId::Entry{id, hash, this}
+    );
+    entries_.emplace(hash, entry);
+    return InternedNodeId(std::move(entry));
+}
+
+size_t NodeIdPool::size() const {
+    const std::lock_guard lock(mutex_);
+    return entries_.size();
+}
+
+size_t NodeIdPool::purge() {
+    const std::lock_guard lock(mutex_);
+    size_t count = 0;
+    for (auto it = entries_.begin(); it != entries_.end();) {
+        if (it->second.use_count() == 1) {
+            it = entries_.erase(it);
+            ++count;
+        } else {
+            ++it;
+        }
+    }
+    return count;
+}
+
+}  // namespace opcua
@@ -0,0 +1,199 @@
+#include "NodeProfiler.h"
+
+#include <algorithm>  // max, min, min_element, partial_sort
+#include <limits>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+
+namespace opcua::detail {
+
+static size_t roundUpToPowerOfTwo(size_t value) noexcept {
+    size_t result = 1;
+    while (result < value) {
+        result <<= 1U;
+    }
+    return result;
+}
+
+/// Finalizer of MurmurHash3, derives the hash of a sketch row from the node id hash.
+static uint32_t mixHash(uint32_t hash) noexcept {
+    hash ^= hash >> 16U;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13U;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16U;
+    return hash;
+}
+
+NodeProfiler::NodeProfiler(const NodeProfilerOptions& options)
+    : sampleInterval_(std::max<uint32_t>(options.sampleInterval, 1)),
+      topCount_(options.topCount),
+      candidateCount_(std::max<size_t>(options.topCount * 4, 16)),
+      depth_(std::max<size_t>(options.sketchDepth, 1)),
+      widthMask_(roundUpToPowerOfTwo(std::max<size_t>(options.sketchWidth, 1)) - 1),
+      sketch_(depth_ * (widthMask_ + 1)) {
+    candidates_.reserve(candidateCount_);
+}
+
+std::vector<HotNode> NodeProfiler::getHotNodes() const {
+    std::vector<HotNode> result;
+    {
+        const std::lock_guard lock(mutex_);
+        result.reserve(candidates_.size());
+        for (const auto& [id, candidate] : candidates_) {
+            auto& hotNode = result.emplace_back();
+            hotNode.id = id;
+            hotNode.count = candidate.count * sampleInterval_;
+            for (size_t i = 0; i < candidate.accessCounts.size(); ++i) {
+                hotNode.accessCounts[i] = candidate.accessCounts[i] * sampleInterval_;
+            }
+        }
+    }
+    const size_t count = std::min(topCount_, result.size());
+    std::partial_sort(
+        result.begin(),
+        result.begin() + static_cast<std::ptrdiff_t>(count),
+        result.end(),
+        [](const HotNode& lhs, const HotNode& rhs) { return lhs.count > rhs.count; }
+    );
+    result.resize(count);
+    return result;
+}
+
+void NodeProfiler::reset() noexcept {
+    const std::lock_guard lock(mutex_);
+    for (auto& counter : sketch_) {
+        counter.store(0, std::memory_order_relaxed);
+    }
+    candidates_.clear();
+}
+
+void NodeProfiler::recordSample(const UA_NodeId& id, NodeAccess access) noexcept {
+    const uint64_t estimate = addToSketch(UA_NodeId_hash(&id));
+    const auto accessIndex = static_cast<size_t>(access);
+    const std::lock_guard lock(mutex_);
+    const auto it = candidates_.find(asWrapper<NodeId>(id));
+    if (it != candidates_.end()) {
+        it->second.count = estimate;
+        ++it->second.accessCounts[accessIndex];
+        return;
+    }
+    if (candidates_.size() >= candidateCount_) {
+        const auto lowest = std::min_element(
+            candidates_.begin(),
+            candidates_.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.second.count < rhs.second.count; }
+        );
+        if (lowest->second.count >= estimate) {
+            return;
+        }
+        candidates_.erase(lowest);
+    }
+    invokeCatchIgnore([&] {
+        Candidate candidate;
+        candidate.count = estimate;
+        candidate.accessCounts[accessIndex] = 1;
+        candidates_.emplace(asWrapper<NodeId>(id), candidate);
+    });
+}
+
+uint64_t NodeProfiler::addToSketch(uint32_t hash) noexcept {
+    uint32_t estimate = std::numeric_limits<uint32_t>::max();
+    const size_t width = widthMask_ + 1;
+    for (size_t row = 0; row < depth_; ++row) {
+        const uint32_t rowHash = mixHash(hash + static_cast<uint32_t>(row) * 0x9e3779b9U);
+        auto& counter = sketch_[row * width + (rowHash & widthMask_)];
+        estimate = std::min(estimate, counter.fetch_add(1, std::memory_order_relaxed) + 1);
+    }
+    return estimate;
+}
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+
+namespace {
+
+struct ProfiledNodestore {
+    UA_Nodestore inner;
+    std::shared_ptr<NodeProfiler> profiler;
+};
+
+ProfiledNodestore& getNodestore(void* context) noexcept {
+    return *static_cast<ProfiledNodestore*>(context);
+}
+
+const UA_Node* getNode(void* context, const UA_NodeId* nodeId) {
+    auto& nodestore = getNodestore(context);
+    nodestore.profiler->record(*nodeId, NodeAccessScope::current);
+    return nodestore.inner.getNode(nodestore.inner.context, nodeId);
+}
+
+ProfiledNodestore* findNodestore(const UA_Nodestore& ns) noexcept {
+    return ns.getNode == &getNode ? static_cast<ProfiledNodestore*>(ns.context) : nullptr;
+}
+
+}  // namespace
+
+void installNodeProfiler(UA_Nodestore& ns, std::shared_ptr<NodeProfiler> profiler) {
+    if (findNodestore(ns) != nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-owning-memory)
+    auto* nodestore = new ProfiledNodestore{ns, std::move(profiler)};
+    ns.context = nodestore;
+    ns.clear = [](void* context) {
+        auto* nodestore = &getNodestore(context);
+        if (nodestore->inner.clear != nullptr) {
+            nodestore->inner.clear(nodestore->inner.context);
+        }
+        delete nodestore;  // NOLINT(cppcoreguidelines-owning-memory)
+    };
+    ns.newNode = [](void* context, UA_NodeClass nodeClass) {
+        auto& inner = getNodestore(context).inner;
+        return inner.newNode(inner.context, nodeClass);
+    };
+    ns.deleteNode = [](void* context, UA_Node* node) {
+        auto& inner = getNodestore(context).inner;
+        inner.deleteNode(inner.context, node);
+    };
+    ns.getNode = &getNode;
+    ns.releaseNode = [](void* context, const UA_Node* node) {
+        auto& inner = getNodestore(context).inner;
+        inner.releaseNode(inner.context, node);
+    };
+    ns.getNodeCopy = [](void* context, const UA_NodeId* nodeId, UA_Node** outNode) {
+        auto& nodestore = getNodestore(context);
+        nodestore.profiler->record(*nodeId, NodeAccess::Write);
+        return nodestore.inner.getNodeCopy(nodestore.inner.context, nodeId, outNode);
+    };
+    ns.insertNode = [](void* context, UA_Node* node, UA_NodeId* addedNodeId) {
+        auto& inner = getNodestore(context).inner;
+        return inner.insertNode(inner.context, node, addedNodeId);
+    };
+    ns.replaceNode = [](void* context, UA_Node* node) {
+        auto& inner = getNodestore(context).inner;
+        return inner.replaceNode(inner.context, node);
+    };
+    ns.removeNode = [](void* context, const UA_NodeId* nodeId) {
+        auto& inner = getNodestore(context).inner;
+        return inner.removeNode(inner.context, nodeId);
+    };
+    ns.getReferenceTypeId = [](void* context, UA_Byte refTypeIndex) {
+        auto& inner = getNodestore(context).inner;
+        return inner.getReferenceTypeId(inner.context, refTypeIndex);
+    };
+    ns.iterate = [](void* context, UA_NodestoreVisitor visitor, void* visitorContext) {
+        auto& inner = getNodestore(context).inner;
+        inner.iterate(inner.context, visitor, visitorContext);
+    };
+}
+
+UA_Nodestore& unwrapNodeProfiler(UA_Nodestore& ns) noexcept {
+    auto* nodestore = findNodestore(ns);
+    return nodestore != nullptr ? nodestore->inner : ns;
+}
+
+#endif
+
+}  // namespace opcua::detail
@@ -0,0 +1,108 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/NodeProfiler.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "open62541_impl.h"
+
+namespace opcua::detail {
+
+/// Classify the node accesses of the current thread within the scope (default NodeAccess::Read).
+class NodeAccessScope {
+public:
+    explicit NodeAccessScope(NodeAccess access) noexcept
+        : previous_(current) {
+        current = access;
+    }
+
+    ~NodeAccessScope() {
+        current = previous_;
+    }
+
+    NodeAccessScope(const NodeAccessScope&) = delete;
+    NodeAccessScope(NodeAccessScope&&) noexcept = delete;
+    NodeAccessScope& operator=(const NodeAccessScope&) = delete;
+    NodeAccessScope& operator=(NodeAccessScope&&) noexcept = delete;
+
+    static inline thread_local NodeAccess current = NodeAccess::Read;
+
+private:
+    NodeAccess previous_;
+};
+
+/**
+ * Sampled counters of node accesses.
+ *
+ * Every n-th access of a thread is added to a count-min sketch. Nodes with the highest estimates
+ * are kept in a small candidate table (a multiple of the report size), the candidate with the
+ * lowest estimate is evicted by nodes with a higher estimate. The sketch uses relaxed atomic
+ * increments, the candidate table is locked for sampled accesses only.
+ */
+class NodeProfiler {
+public:
+    explicit NodeProfiler(const NodeProfilerOptions& options);
+
+    /// Count a node access (sampled).
+    void record(const UA_NodeId& id, NodeAccess access) noexcept {
+        static thread_local uint32_t counter = 0;
+        if (++counter < sampleInterval_) {
+            return;
+        }
+        counter = 0;
+        recordSample(id, access);
+    }
+
+    /// Report of the most accessed nodes, sorted by their estimated count (descending).
+    std::vector<HotNode> getHotNodes() const;
+
+    void reset() noexcept;
+
+private:
+    struct Candidate {
+        uint64_t count{0};
+        std::array<uint64_t, 4> accessCounts{};
+    };
+
+    void recordSample(const UA_NodeId& id, NodeAccess access) noexcept;
+    uint64_t addToSketch(uint32_t hash) noexcept;
+
+    uint32_t sampleInterval_;
+    size_t topCount_;
+    size_t candidateCount_;
+    size_t depth_;
+    size_t widthMask_;
+    std::vector<std::atomic<uint32_t>> sketch_;
+    mutable std::mutex mutex_;
+    std::unordered_map<NodeId, Candidate> candidates_;
+};
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+
+/**
+ * Wrap the nodestore of a server with a decorator counting node accesses.
+ *
+ * Lookups (`getNode`) are counted with the NodeAccess of the current NodeAccessScope, copies
+ * (`getNodeCopy`) as NodeAccess::Write. In-place edits are lookups, the write paths of the server
+ * set a NodeAccessScope. All calls are forwarded to the wrapped nodestore.
+ *
+ * @exception BadStatus (BadInvalidState) If the nodestore is already wrapped
+ */
+void installNodeProfiler(UA_Nodestore& ns, std::shared_ptr<NodeProfiler> profiler);
+
+/// Nodestore wrapped by the profiler decorator, `ns` itself if not wrapped.
+/// Other decorators are installed within the profiler decorator to keep counting all accesses.
+UA_Nodestore& unwrapNodeProfiler(UA_Nodestore& ns) noexcept;
+
+#endif
+
+}  // namespace opcua::detail
@@ -0,0 +1,1215 @@
+#include "open62541pp/Nodeset.h"
+
+#include <algorithm>  // find_if
+#include <array>
+#include <charconv>  // from_chars
+#include <cstdlib>  // strtod
+#include <istream>
+#include <iterator>
+#include <optional>
+#include <ostream>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeConverter.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/ExtensionObject.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+#include "detail/BinarySegment.h"
+#include "detail/XmlReader.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+using detail::XmlReader;
+
+/* ------------------------------------------- Parsing ------------------------------------------ */
+
+[[noreturn]] static void throwDecodingError() {
+    throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+}
+
+static std::string_view trim(std::string_view str) noexcept {
+    constexpr std::string_view whitespace = " \t\n\r";
+    const auto first = str.find_first_not_of(whitespace);
+    if (first == std::string_view::npos) {
+        return {};
+    }
+    const auto last = str.find_last_not_of(whitespace);
+    return str.substr(first, last - first + 1);
+}
+
+template <typename T>
+static T parseInteger(std::string_view str) {
+    str = trim(str);
+    T value{};
+    const auto* end = str.data() + str.size();
+    const auto [ptr, ec] = std::from_chars(str.data(), end, value);
+    if (ec != std::errc() || ptr != end) {
+        throwDecodingError();
+    }
+    return value;
+}
+
+static double parseDouble(std::string_view str) {
+    const std::string copy(trim(str));
+    char* end = nullptr;
+    const double value = std::strtod(copy.c_str(), &end);
+    if (copy.empty() || *end != '\0') {
+        throwDecodingError();
+    }
+    return value;
+}
+
+static bool parseBoolean(std::string_view str) {
+    str = trim(str);
+    if (str == "true" || str == "1") {
+        return true;
+    }
+    if (str == "false" || str == "0") {
+        return false;
+    }
+    throwDecodingError();
+}
+
+static Guid parseGuid(std::string_view str) {
+    // format: 09087e75-8e5e-499b-954f-f2a9603db28a
+    if (str.size() != 36 || str[8] != '-' || str[13] != '-' || str[18] != '-' || str[23] != '-') {
+        throwDecodingError();
+    }
+    const auto hex = [&](size_t offset, size_t length) {
+        uint32_t value{};
+        const auto* first = str.data() + offset;
+        const auto [ptr, ec] = std::from_chars(first, first + length, value, 16);
+        if (ec != std::errc() || ptr != first + length) {
+            throwDecodingError();
+        }
+        return value;
+    };
+    std::array<uint8_t, 8> data4{};
+    data4[0] = static_cast<uint8_t>(hex(19, 2));
+    data4[1] = static_cast<uint8_t>(hex(21, 2));
+    for (size_t i = 0; i < 6; ++i) {
+        data4[2 + i] = static_cast<uint8_t>(hex(24 + 2 * i, 2));
+    }
+    return {
+        hex(0, 8), static_cast<uint16_t>(hex(9, 4)), static_cast<uint16_t>(hex(14, 4)), data4
+    };
+}
+
+using Aliases = std::unordered_map<std::string, NodeId>;
+
+static NodeId parseNodeId(std::string_view str, const Aliases& aliases) {
+    str = trim(str);
+    if (!aliases.empty()) {
+        const auto it = aliases.find(std::string(str));
+        if (it != aliases.end()) {
+            return it->second;
+        }
+    }
+    uint16_t namespaceIndex = 0;
+    if (str.substr(0, 3) == "ns=") {
+        const auto pos = str.find(';');
+        if (pos == std::string_view::npos) {
+            throwDecodingError();
+        }
+        namespaceIndex = parseInteger<uint16_t>(str.substr(3, pos - 3));
+        str.remove_prefix(pos + 1);
+    }
+    if (str.size() < 2 || str[1] != '=') {
+        throwDecodingError();
+    }
+    const auto identifier = str.substr(2);
+    switch (str[0]) {
+    case 'i':
+        return NodeId(namespaceIndex, parseInteger<uint32_t>(identifier));
+    case 's':
+        return NodeId(namespaceIndex, identifier);
+    case 'g':
+        return NodeId(namespaceIndex, parseGuid(identifier));
+    case 'b':
+        return NodeId(namespaceIndex, ByteString::fromBase64(identifier));
+    default:
+        throwDecodingError();
+    }
+}
+
+static QualifiedName parseQualifiedName(std::string_view str) {
+    // format: <namespace index>:<name>, namespace index 0 can be omitted
+    const auto pos = str.find(':');
+    if (pos != std::string_view::npos && pos > 0 &&
+        std::all_of(str.begin(), str.begin() + pos, [](char c) { return c >= '0' && c <= '9'; })) {
+        return QualifiedName(parseInteger<uint16_t>(str.substr(0, pos)), str.substr(pos + 1));
+    }
+    return QualifiedName(0, str);
+}
+
+static std::string_view requireAttribute(const XmlReader& reader, std::string_view name) {
+    const auto value = reader.attribute(name);
+    if (!value.has_value()) {
+        throwDecodingError();
+    }
+    return *value;
+}
+
+/// Iterate over the child elements of the current element.
+template <typename F>
+static void forEachChildElement(XmlReader& reader, F&& onElement) {
+    while (true) {
+        switch (reader.next()) {
+        case XmlReader::Event::StartElement:
+            onElement(reader.name());  // must consume the element
+            break;
+        case XmlReader::Event::EndElement:
+            return;
+        case XmlReader::Event::Text:
+            break;
+        case XmlReader::Event::EndDocument:
+            throwDecodingError();
+        }
+    }
+}
+
+/* -------------------------------------------- Values ------------------------------------------ */
+
+static LocalizedText parseLocalizedText(XmlReader& reader) {
+    std::string locale;
+    std::string text;
+    forEachChildElement(reader, [&](std::string_view name) {
+        if (name == "Locale") {
+            locale = trim(reader.readText());
+        } else if (name == "Text") {
+            text = reader.readText();
+        } else {
+            reader.skipElement();
+        }
+    });
+    return {locale, text, false};
+}
+
+static QualifiedName parseQualifiedNameValue(XmlReader& reader) {
+    uint16_t namespaceIndex = 0;
+    std::string name;
+    forEachChildElement(reader, [&](std::string_view child) {
+        if (child == "NamespaceIndex") {
+            namespaceIndex = parseInteger<uint16_t>(reader.readText());
+        } else if (child == "Name") {
+            name = reader.readText();
+        } else {
+            reader.skipElement();
+        }
+    });
+    return {namespaceIndex, name};
+}
+
+static NodeId parseNodeIdValue(XmlReader& reader, const Aliases& aliases) {
+    std::optional<NodeId> id;
+    forEachChildElement(reader, [&](std::string_view child) {
+        if (child == "Identifier") {
+            id = parseNodeId(reader.readText(), aliases);
+        } else {
+            reader.skipElement();
+        }
+    });
+    return id.value_or(NodeId{});
+}
+
+template <typename T>
+static T parseScalar(XmlReader& reader, const Aliases& aliases) {
+    if constexpr (std::is_same_v<T, bool>) {
+        return parseBoolean(reader.readText());
+    } else if constexpr (std::is_integral_v<T>) {
+        return parseInteger<T>(reader.readText());
+    } else if constexpr (std::is_floating_point_v<T>) {
+        return static_cast<T>(parseDouble(reader.readText()));
+    } else if constexpr (std::is_same_v<T, std::string>) {
+        return reader.readText();
+    } else if constexpr (std::is_same_v<T, ByteString>) {
+        return ByteString::fromBase64(trim(reader.readText()));
+    } else if constexpr (std::is_same_v<T, LocalizedText>) {
+        return parseLocalizedText(reader);
+    } else if constexpr (std::is_same_v<T, QualifiedName>) {
+        return parseQualifiedNameValue(reader);
+    } else {
+        static_assert(std::is_same_v<T, NodeId>);
+        return parseNodeIdValue(reader, aliases);
+    }
+}
+
+template <typename T>
+static Variant parseValues(XmlReader& reader, bool isArray, const Aliases& aliases) {
+    if (!isArray) {
+        return Variant::fromScalar(parseScalar<T>(reader, aliases));
+    }
+    std::vector<T> values;
+    forEachChildElement(reader, [&](std::string_view) {
+        values.push_back(parseScalar<T>(reader, aliases));
+    });
+    return Variant::fromArray(values);
+}
+
+/// Parse the child of a `<Value>` element, unsupported types return an empty Variant.
+static Variant parseValue(XmlReader& reader, const Aliases& aliases) {
+    Variant result;
+    forEachChildElement(reader, [&](std::string_view name) {
+        constexpr std::string_view listPrefix = "ListOf";
+        const bool isArray = name.substr(0, listPrefix.size()) == listPrefix;
+        const auto type = isArray ? name.substr(listPrefix.size()) : name;
+        if (type == "Boolean") {
+            result = parseValues<bool>(reader, isArray, aliases);
+        } else if (type == "SByte") {
+            result = parseValues<int8_t>(reader, isArray, aliases);
+        } else if (type == "Byte") {
+            result = parseValues<uint8_t>(reader, isArray, aliases);
+        } else if (type == "Int16") {
+            result = parseValues<int16_t>(reader, isArray, aliases);
+        } else if (type == "UInt16") {
+            result = parseValues<uint16_t>(reader, isArray, aliases);
+        } else if (type == "Int32") {
+            result = parseValues<int32_t>(reader, isArray, aliases);
+        } else if (type == "UInt32") {
+            result = parseValues<uint32_t>(reader, isArray, aliases);
+        } else if (type == "Int64") {
+            result = parseValues<int64_t>(reader, isArray, aliases);
+        } else if (type == "UInt64") {
+            result = parseValues<uint64_t>(reader, isArray, aliases);
+        } else if (type == "Float") {
+            result = parseValues<float>(reader, isArray, aliases);
+        } else if (type == "Double") {
+            result = parseValues<double>(reader, isArray, aliases);
+        } else if (type == "String") {
+            result = parseValues<std::string>(reader, isArray, aliases);
+        } else if (type == "ByteString") {
+            result = parseValues<ByteString>(reader, isArray, aliases);
+        } else if (type == "LocalizedText") {
+            result = parseValues<LocalizedText>(reader, isArray, aliases);
+        } else if (type == "QualifiedName") {
+            result = parseValues<QualifiedName>(reader, isArray, aliases);
+        } else if (type == "NodeId") {
+            result = parseValues<NodeId>(reader, isArray, aliases);
+        } else {
+            reader.skipElement();
+        }
+    });
+    return result;
+}
+
+/* -------------------------------------------- Nodes ------------------------------------------- */
+
+namespace {
+
+struct ParsedReference {
+    NodeId referenceType;
+    NodeId target;
+    bool forward{true};
+};
+
+struct ParsedNode {
+    NodeClass nodeClass{};
+    NodeId id;
+    QualifiedName browseName;
+    std::optional<NodeId> parentId;
+    NodeId dataType;
+    ExtensionObject attributes;
+    std::vector<ParsedReference> references;
+};
+
+struct Reference {
+    NodeId source;
+    NodeId referenceType;
+    NodeId target;
+
+    bool operator==(const Reference& other) const noexcept {
+        return source == other.source && referenceType == other.referenceType &&
+               target == other.target;
+    }
+};
+
+struct ReferenceHash {
+    size_t operator()(const Reference& ref) const noexcept {
+        const std::hash<NodeId> hash;
+        size_t seed = hash(ref.source);
+        seed ^= hash(ref.referenceType) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        seed ^= hash(ref.target) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+        return seed;
+    }
+};
+
+struct ParserState {
+    Nodeset nodeset;
+    Aliases aliases;
+    std::vector<ParsedNode> nodes;
+};
+
+}  // namespace
+
+template <typename Attributes>
+static void setCommonAttributes(const XmlReader& reader, Attributes& attributes) {
+    if (const auto value = reader.attribute("WriteMask")) {
+        attributes.setWriteMask(parseInteger<uint32_t>(*value));
+    }
+    if (const auto value = reader.attribute("UserWriteMask")) {
+        attributes.setUserWriteMask(parseInteger<uint32_t>(*value));
+    }
+}
+
+static std::vector<uint32_t> parseArrayDimensions(std::string_view str) {
+    std::vector<uint32_t> dimensions;
+    while (!str.empty()) {
+        const auto pos = str.find(',');
+        dimensions.push_back(parseInteger<uint32_t>(str.substr(0, pos)));
+        if (pos == std::string_view::npos) {
+            break;
+        }
+        str.remove_prefix(pos + 1);
+    }
+    return dimensions;
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    ObjectAttributes& attributes,
+    [[maybe_unused]] ParsedNode& node,
+    [[maybe_unused]] const Aliases& aliases
+) {
+    attributes.setEventNotifier(
+        parseInteger<uint8_t>(reader.attribute("EventNotifier").value_or("0"))
+    );
+}
+
+template <typename Attributes>
+static void setVariableAttributes(
+    const XmlReader& reader, Attributes& attributes, ParsedNode& node, const Aliases& aliases
+) {
+    node.dataType = parseNodeId(reader.attribute("DataType").value_or("i=24"), aliases);
+    attributes.setDataType(node.dataType);
+    attributes.setValueRank(
+        static_cast<ValueRank>(parseInteger<int32_t>(reader.attribute("ValueRank").value_or("-1")))
+    );
+    if (const auto value = reader.attribute("ArrayDimensions")) {
+        const auto dimensions = parseArrayDimensions(*value);
+        attributes.setArrayDimensions(dimensions);
+    }
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    VariableAttributes& attributes,
+    ParsedNode& node,
+    const Aliases& aliases
+) {
+    setVariableAttributes(reader, attributes, node, aliases);
+    attributes.setAccessLevel(parseInteger<uint8_t>(reader.attribute("AccessLevel").value_or("1")));
+    attributes.setUserAccessLevel(
+        parseInteger<uint8_t>(reader.attribute("UserAccessLevel").value_or("1"))
+    );
+    if (const auto value = reader.attribute("MinimumSamplingInterval")) {
+        attributes.setMinimumSamplingInterval(parseDouble(*value));
+    }
+    attributes.setHistorizing(parseBoolean(reader.attribute("Historizing").value_or("false")));
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    VariableTypeAttributes& attributes,
+    ParsedNode& node,
+    const Aliases& aliases
+) {
+    setVariableAttributes(reader, attributes, node, aliases);
+    attributes.setIsAbstract(parseBoolean(reader.attribute("IsAbstract").value_or("false")));
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    MethodAttributes& attributes,
+    [[maybe_unused]] ParsedNode& node,
+    [[maybe_unused]] const Aliases& aliases
+) {
+    attributes.setExecutable(parseBoolean(reader.attribute("Executable").value_or("true")));
+    attributes.setUserExecutable(parseBoolean(reader.attribute("UserExecutable").value_or("true")));
+}
+
+template <typename Attributes>
+static void setTypeAttributes(const XmlReader& reader, Attributes& attributes) {
+    attributes.setIsAbstract(parseBoolean(reader.attribute("IsAbstract").value_or("false")));
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    ObjectTypeAttributes& attributes,
+    [[maybe_unused]] ParsedNode& node,
+    [[maybe_unused]] const Aliases& aliases
+) {
+    setTypeAttributes(reader, attributes);
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    ReferenceTypeAttributes& attributes,
+    [[maybe_unused]] ParsedNode& node,
+    [[maybe_unused]] const Aliases& aliases
+) {
+    setTypeAttributes(reader, attributes);
+    attributes.setSymmetric(parseBoolean(reader.attribute("Symmetric").value_or("false")));
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    DataTypeAttributes& attributes,
+    [[maybe_unused]] ParsedNode& node,
+    [[maybe_unused]] const Aliases& aliases
+) {
+    setTypeAttributes(reader, attributes);
+}
+
+static void setNodeAttributes(
+    const XmlReader& reader,
+    ViewAttributes& attributes,
+    [[maybe_unused]] ParsedNode& node,
+    [[maybe_unused]] const Aliases& aliases
+) {
+    attributes->specifiedAttributes |= UA_NODEATTRIBUTESMASK_CONTAINSNOLOOPS;
+    attributes->containsNoLoops =
+        parseBoolean(reader.attribute("ContainsNoLoops").value_or("false"));
+    attributes.setEventNotifier(
+        parseInteger<uint8_t>(reader.attribute("EventNotifier").value_or("0"))
+    );
+}
+
+static void parseReferences(XmlReader& reader, ParsedNode& node, const Aliases& aliases) {
+    forEachChildElement(reader, [&](std::string_view name) {
+        if (name != "Reference") {
+            reader.skipElement();
+            return;
+        }
+        ParsedReference reference;
+        reference.referenceType = parseNodeId(requireAttribute(reader, "ReferenceType"), aliases);
+        reference.forward = parseBoolean(reader.attribute("IsForward").value_or("true"));
+        reference.target = parseNodeId(reader.readText(), aliases);
+        node.references.push_back(std::move(reference));
+    });
+}
+
+static LocalizedText parseLocalizedTextElement(XmlReader& reader) {
+    const std::string locale(reader.attribute("Locale").value_or(""));
+    return {locale, trim(reader.readText()), false};
+}
+
+template <typename Attributes>
+static void parseNode(XmlReader& reader, NodeClass nodeClass, ParserState& state) {
+    ParsedNode node;
+    node.nodeClass = nodeClass;
+    node.id = parseNodeId(requireAttribute(reader, "NodeId"), state.aliases);
+    node.browseName = parseQualifiedName(requireAttribute(reader, "BrowseName"));
+    if (const auto parentId = reader.attribute("ParentNodeId")) {
+        node.parentId = parseNodeId(*parentId, state.aliases);
+    }
+
+    Attributes attributes;
+    setCommonAttributes(reader, attributes);
+    setNodeAttributes(reader, attributes, node, state.aliases);
+
+    bool hasDisplayName = false;
+    bool hasDescription = false;
+    forEachChildElement(reader, [&](std::string_view name) {
+        if (name == "DisplayName" && !hasDisplayName) {
+            attributes.setDisplayName(parseLocalizedTextElement(reader));
+            hasDisplayName = true;
+        } else if (name == "Description" && !hasDescription) {
+            attributes.setDescription(parseLocalizedTextElement(reader));
+            hasDescription = true;
+        } else if (name == "References") {
+            parseReferences(reader, node, state.aliases);
+        } else if (name == "Value") {
+            if constexpr (std::is_same_v<Attributes, VariableAttributes> ||
+                          std::is_same_v<Attributes, VariableTypeAttributes>) {
+                attributes.setValue(parseValue(reader, state.aliases));
+            } else {
+                reader.skipElement();
+            }
+        } else if (name == "InverseName") {
+            if constexpr (std::is_same_v<Attributes, ReferenceTypeAttributes>) {
+                attributes.setInverseName(parseLocalizedTextElement(reader));
+            } else {
+                reader.skipElement();
+            }
+        } else {
+            reader.skipElement();
+        }
+    });
+    if (!hasDisplayName) {
+        attributes.setDisplayName({"", node.browseName.getName(), false});
+    }
+    node.attributes = ExtensionObject::fromDecodedCopy(attributes);
+    state.nodes.push_back(std::move(node));
+}
+
+static void parseNamespaceUris(XmlReader& reader, ParserState& state) {
+    forEachChildElement(reader, [&](std::string_view name) {
+        if (name == "Uri") {
+            state.nodeset.namespaceUris.emplace_back(trim(reader.readText()));
+        } else {
+            reader.skipElement();
+        }
+    });
+}
+
+static void parseAliases(XmlReader& reader, ParserState& state) {
+    forEachChildElement(reader, [&](std::string_view name) {
+        if (name == "Alias") {
+            std::string alias(requireAttribute(reader, "Alias"));
+            state.aliases.insert_or_assign(
+                std::move(alias), parseNodeId(reader.readText(), state.aliases)
+            );
+        } else {
+            reader.skipElement();
+        }
+    });
+}
+
+/* ----------------------------------------- NodeBatch ------------------------------------------ */
+
+static bool isHierarchicalReferenceType(const NodeId& id) noexcept {
+    if (id.getNamespaceIndex() != 0 || id.getIdentifierType() != NodeIdType::Numeric) {
+        return false;
+    }
+    switch (id.handle()->identifier.numeric) {
+    case UA_NS0ID_HIERARCHICALREFERENCES:
+    case UA_NS0ID_HASCHILD:
+    case UA_NS0ID_ORGANIZES:
+    case UA_NS0ID_HASEVENTSOURCE:
+    case UA_NS0ID_AGGREGATES:
+    case UA_NS0ID_HASSUBTYPE:
+    case UA_NS0ID_HASPROPERTY:
+    case UA_NS0ID_HASCOMPONENT:
+    case UA_NS0ID_HASNOTIFIER:
+    case UA_NS0ID_HASORDEREDCOMPONENT:
+        return true;
+    default:
+        return false;
+    }
+}
+
+static std::unordered_set<NodeId> getHierarchicalReferenceTypes(Span<const ParsedNode> nodes) {
+    // reference types of the nodeset that are subtypes of hierarchical references
+    std::unordered_set<NodeId> result;
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (const auto& node : nodes) {
+            if (node.nodeClass != NodeClass::ReferenceType || result.count(node.id) > 0) {
+                continue;
+            }
+            for (const auto& ref : node.references) {
+                if (!ref.forward && ref.referenceType == NodeId(ReferenceTypeId::HasSubtype) &&
+                    (isHierarchicalReferenceType(ref.target) || result.count(ref.target) > 0)) {
+                    result.insert(node.id);
+                    changed = true;
+                    break;
+                }
+            }
+        }
+    }
+    return result;
+}
+
+/// Sort nodes such that dependencies (parent, type definition, data type) are added first.
+static std::vector<size_t> sortNodes(
+    Span<const ParsedNode> nodes, Span<const std::optional<size_t>> parentReferences
+) {
+    std::unordered_map<NodeId, size_t> indices;
+    indices.reserve(nodes.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        indices.try_emplace(nodes[i].id, i);
+    }
+    const auto getDependencies = [&](size_t i) {
+        std::array<std::optional<size_t>, 4> dependencies{};
+        const auto find = [&](const NodeId& id) -> std::optional<size_t> {
+            const auto it = indices.find(id);
+            return it == indices.end() ? std::nullopt : std::optional<size_t>(it->second);
+        };
+        const auto& node = nodes[i];
+        if (parentReferences[i].has_value()) {
+            const auto& ref = node.references[*parentReferences[i]];
+            dependencies[0] = find(ref.target);
+            dependencies[1] = find(ref.referenceType);
+        }
+        for (const auto& ref : node.references) {
+            if (ref.forward && ref.referenceType == NodeId(ReferenceTypeId::HasTypeDefinition)) {
+                dependencies[2] = find(ref.target);
+            }
+        }
+        if (!node.dataType.isNull()) {
+            dependencies[3] = find(node.dataType);
+        }
+        return dependencies;
+    };
+
+    enum class State : uint8_t { Unvisited, Visiting, Done };
+    std::vector<State> states(nodes.size(), State::Unvisited);
+    std::vector<size_t> order;
+    order.reserve(nodes.size());
+    std::vector<std::pair<size_t, size_t>> stack;  // node index, next dependency
+    for (size_t root = 0; root < nodes.size(); ++root) {
+        if (states[root] != State::Unvisited) {
+            continue;
+        }
+        stack.emplace_back(root, 0);
+        states[root] = State::Visiting;
+        while (!stack.empty()) {
+            auto& [index, next] = stack.back();
+            const auto dependencies = getDependencies(index);
+            if (next < dependencies.size()) {
+                const auto dependency = dependencies[next++];
+                if (dependency.has_value() && states[*dependency] == State::Unvisited) {
+                    states[*dependency] = State::Visiting;
+                    stack.emplace_back(*dependency, 0);
+                }
+                continue;
+            }
+            states[index] = State::Done;
+            order.push_back(index);
+            stack.pop_back();
+        }
+    }
+    return order;
+}
+
+static void buildNodeBatch(ParserState& state) {
+    auto& nodes = state.nodes;
+    const auto hierarchicalTypes = getHierarchicalReferenceTypes(nodes);
+    const auto isHierarchical = [&](const NodeId& id) {
+        return isHierarchicalReferenceType(id) || hierarchicalTypes.count(id) > 0;
+    };
+
+    // find parent references
+    std::vector<std::optional<size_t>> parentReferences(nodes.size());
+    std::unordered_set<Reference, ReferenceHash> references;
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = nodes[i];
+        const auto& refs = node.references;
+        auto it = refs.end();
+        if (node.parentId.has_value()) {
+            it = std::find_if(refs.begin(), refs.end(), [&](const ParsedReference& ref) {
+                return !ref.forward && ref.target == *node.parentId;
+            });
+        }
+        if (it == refs.end()) {
+            it = std::find_if(refs.begin(), refs.end(), [&](const ParsedReference& ref) {
+                return !ref.forward && isHierarchical(ref.referenceType);
+            });
+        }
+        if (it != refs.end()) {
+            parentReferences[i] = static_cast<size_t>(it - refs.begin());
+            references.insert({it->target, it->referenceType, node.id});
+        }
+    }
+
+    auto& batch = state.nodeset.nodes;
+    const auto order = sortNodes(nodes, parentReferences);
+    batch.reserve(nodes.size());
+    for (const auto i : order) {
+        auto& node = nodes[i];
+        NodeId parentId;
+        NodeId referenceType;
+        if (parentReferences[i].has_value()) {
+            const auto& ref = node.references[*parentReferences[i]];
+            parentId = ref.target;
+            referenceType = ref.referenceType;
+        }
+        NodeId typeDefinition;
+        for (const auto& ref : node.references) {
+            if (ref.forward && ref.referenceType == NodeId(ReferenceTypeId::HasTypeDefinition)) {
+                typeDefinition = ref.target;
+            }
+        }
+        batch.addNode({
+            ExpandedNodeId(parentId),
+            std::move(referenceType),
+            ExpandedNodeId(node.id),
+            std::move(node.browseName),
+            node.nodeClass,
+            std::move(node.attributes),
+            ExpandedNodeId(typeDefinition),
+        });
+    }
+
+    // remaining (deduplicated) references
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const auto& node = nodes[i];
+        for (size_t j = 0; j < node.references.size(); ++j) {
+            const auto& ref = node.references[j];
+            const bool isTypeDefinition =
+                ref.forward && ref.referenceType == NodeId(ReferenceTypeId::HasTypeDefinition);
+            if (parentReferences[i] == j || isTypeDefinition) {
+                continue;
+            }
+            Reference normalized = ref.forward ? Reference{node.id, ref.referenceType, ref.target}
+                                               : Reference{ref.target, ref.referenceType, node.id};
+            if (!references.insert(normalized).second) {
+                continue;
+            }
+            batch.addReference(
+                normalized.source, normalized.target, normalized.referenceType, true
+            );
+        }
+    }
+    nodes.clear();
+}
+
+Nodeset readNodesetXml(std::istream& stream) {
+    XmlReader reader(stream);
+    ParserState state;
+    bool hasRoot = false;
+    while (true) {
+        const auto event = reader.next();
+        if (event == XmlReader::Event::EndDocument) {
+            break;
+        }
+        if (event != XmlReader::Event::StartElement) {
+            continue;
+        }
+        const auto name = reader.name();
+        if (!hasRoot) {
+            if (name != "UANodeSet") {
+                throwDecodingError();
+            }
+            hasRoot = true;
+        } else if (name == "NamespaceUris") {
+            parseNamespaceUris(reader, state);
+        } else if (name == "Aliases") {
+            parseAliases(reader, state);
+        } else if (name == "UAObject") {
+            parseNode<ObjectAttributes>(reader, NodeClass::Object, state);
+        } else if (name == "UAVariable") {
+            parseNode<VariableAttributes>(reader, NodeClass::Variable, state);
+        } else if (name == "UAMethod") {
+            parseNode<MethodAttributes>(reader, NodeClass::Method, state);
+        } else if (name == "UAObjectType") {
+            parseNode<ObjectTypeAttributes>(reader, NodeClass::ObjectType, state);
+        } else if (name == "UAVariableType") {
+            parseNode<VariableTypeAttributes>(reader, NodeClass::VariableType, state);
+        } else if (name == "UAReferenceType") {
+            parseNode<ReferenceTypeAttributes>(reader, NodeClass::ReferenceType, state);
+        } else if (name == "UADataType") {
+            parseNode<DataTypeAttributes>(reader, NodeClass::DataType, state);
+        } else if (name == "UAView") {
+            parseNode<ViewAttributes>(reader, NodeClass::View, state);
+        } else {
+            reader.skipElement();  // ServerUris, Models, Extensions, ...
+        }
+    }
+    if (!hasRoot) {
+        throwDecodingError();
+    }
+    buildNodeBatch(state);
+    return std::move(state.nodeset);
+}
+
+/* ------------------------------------------ Namespaces ---------------------------------------- */
+
+static void remapNamespace(UA_NodeId& id, Span<const uint16_t> indices) {
+    if (id.namespaceIndex >= indices.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);
+    }
+    id.namespaceIndex = indices[id.namespaceIndex];
+}
+
+template <typename T>
+static void remapDataType(UA_ExtensionObject& attributes, Span<const uint16_t> indices) {
+    remapNamespace(static_cast<T*>(attributes.content.decoded.data)->dataType, indices);
+}
+
+void Nodeset::remapNamespaces(Span<const uint16_t> indices) {
+    for (auto& node : nodes.getNodes()) {
+        auto& item = *node.handle();
+        remapNamespace(item.parentNodeId.nodeId, indices);
+        remapNamespace(item.referenceTypeId, indices);
+        remapNamespace(item.requestedNewNodeId.nodeId, indices);
+        remapNamespace(item.typeDefinition.nodeId, indices);
+        if (item.browseName.namespaceIndex >= indices.size()) {
+            throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);
+        }
+        item.browseName.namespaceIndex = indices[item.browseName.namespaceIndex];
+        auto& attributes = item.nodeAttributes;
+        if (attributes.encoding >= UA_EXTENSIONOBJECT_DECODED) {
+            const auto* type = attributes.content.decoded.type;
+            if (type == &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]) {
+                remapDataType<UA_VariableAttributes>(attributes, indices);
+            } else if (type == &UA_TYPES[UA_TYPES_VARIABLETYPEATTRIBUTES]) {
+                remapDataType<UA_VariableTypeAttributes>(attributes, indices);
+            }
+        }
+    }
+    for (auto& reference : nodes.getReferences()) {
+        auto& item = *reference.handle();
+        remapNamespace(item.sourceNodeId, indices);
+        remapNamespace(item.referenceTypeId, indices);
+        remapNamespace(item.targetNodeId.nodeId, indices);
+    }
+}
+
+/* ------------------------------------------- Binary ------------------------------------------- */
+
+// magic bytes + format version
+constexpr std::array<char, 8> nodesetBinaryMagic{'U', 'A', 'P', 'P', 'N', 'S', 'B', '1'};
+
+bool detail::isNodesetBinary(std::istream& stream) {
+    return detail::hasBinaryMagic(stream, nodesetBinaryMagic);
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+void writeNodesetBinary(const Nodeset& nodeset, std::ostream& stream) {
+    const auto nodes = nodeset.nodes.getNodes();
+    const auto references = nodeset.nodes.getReferences();
+
+    UA_AddNodesRequest nodesRequest{};
+    nodesRequest.nodesToAddSize = nodes.size();
+    nodesRequest.nodesToAdd = const_cast<UA_AddNodesItem*>(asNative(nodes.data()));  // NOLINT
+    UA_AddReferencesRequest referencesRequest{};
+    referencesRequest.referencesToAddSize = references.size();
+    referencesRequest.referencesToAdd =
+        const_cast<UA_AddReferencesItem*>(asNative(references.data()));  // NOLINT
+
+    stream.write(nodesetBinaryMagic.data(), nodesetBinaryMagic.size());
+    detail::writeBinarySegment(stream, *Variant::fromArray(nodeset.namespaceUris).handle());
+    detail::writeBinarySegment(stream, nodesRequest);
+    detail::writeBinarySegment(stream, referencesRequest);
+    if (!stream) {
+        throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
+
+Nodeset readNodesetBinary(std::istream& stream) {
+    // read the whole snapshot into a single buffer and decode in place
+    const auto buffer = detail::readBinaryFile(stream, nodesetBinaryMagic);
+    std::string_view view(buffer);
+
+    Variant namespaceUris;
+    detail::readBinarySegment(view, *namespaceUris.handle());
+    AddNodesRequest nodesRequest;
+    detail::readBinarySegment(view, *nodesRequest.handle());
+    AddReferencesRequest referencesRequest;
+    detail::readBinarySegment(view, *referencesRequest.handle());
+
+    Nodeset nodeset;
+    if (!namespaceUris.isEmpty()) {
+        nodeset.namespaceUris = namespaceUris.getArrayCopy<std::string>();
+    }
+    nodeset.nodes.reserve(nodesRequest->nodesToAddSize, referencesRequest->referencesToAddSize);
+    for (auto& item : nodesRequest.getNodesToAdd()) {
+        nodeset.nodes.addNode(std::move(item));
+    }
+    for (auto& item : referencesRequest.getReferencesToAdd()) {
+        nodeset.nodes.addReference(std::move(item));
+    }
+    return nodeset;
+}
+
+#else
+
+void writeNodesetBinary(
+    [[maybe_unused]] const Nodeset& nodeset, [[maybe_unused]] std::ostream& stream
+) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+Nodeset readNodesetBinary([[maybe_unused]] std::istream& stream) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+#endif
+
+/* ------------------------------------------- Export ------------------------------------------- */
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+static Span<const AttributeId> getExportedAttributes(NodeClass nodeClass) {
+    using Id = AttributeId;
+    // clang-format off
+    static constexpr std::array object{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::EventNotifier,
+    };
+    static constexpr std::array variable{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::Value, Id::DataType,
+        Id::ValueRank, Id::ArrayDimensions, Id::AccessLevel, Id::MinimumSamplingInterval,
+        Id::Historizing,
+    };
+    static constexpr std::array method{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::Executable,
+    };
+    static constexpr std::array type{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::IsAbstract,
+    };
+    static constexpr std::array variableType{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::Value, Id::DataType,
+        Id::ValueRank, Id::ArrayDimensions, Id::IsAbstract,
+    };
+    static constexpr std::array referenceType{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::IsAbstract,
+        Id::Symmetric, Id::InverseName,
+    };
+    static constexpr std::array view{
+        Id::BrowseName, Id::DisplayName, Id::Description, Id::WriteMask, Id::ContainsNoLoops,
+        Id::EventNotifier,
+    };
+    // clang-format on
+    switch (nodeClass) {
+    case NodeClass::Object:
+        return object;
+    case NodeClass::Variable:
+        return variable;
+    case NodeClass::Method:
+        return method;
+    case NodeClass::ObjectType:
+    case NodeClass::DataType:
+        return type;
+    case NodeClass::VariableType:
+        return variableType;
+    case NodeClass::ReferenceType:
+        return referenceType;
+    case NodeClass::View:
+        return view;
+    default:
+        return {};
+    }
+}
+
+namespace {
+
+/// Attribute values of a single node read by exportNodeset.
+struct ExportedNode {
+    Span<const AttributeId> ids;
+    Span<const DataValue> values;
+
+    const Variant* get(AttributeId id) const noexcept {
+        for (size_t i = 0; i < ids.size(); ++i) {
+            if (ids[i] == id) {
+                const auto& dv = values[i];
+                return dv.getStatusCode().isGood() && dv.hasValue() ? &dv.getValue() : nullptr;
+            }
+        }
+        return nullptr;
+    }
+
+    /// Copy the attribute value to the native attribute field and update the mask.
+    template <typename T>
+    void copy(AttributeId id, T& field, uint32_t& mask, uint32_t flag) const {
+        const auto* value = get(id);
+        if (value == nullptr) {
+            return;
+        }
+        if constexpr (std::is_same_v<T, UA_Variant>) {
+            UA_Variant_clear(&field);
+            detail::throwOnBadStatus(UA_Variant_copy(value->handle(), &field));
+        } else {
+            const auto& type = detail::guessDataType<T>();
+            if (!value->isScalar() || !value->isType(type)) {
+                return;
+            }
+            UA_clear(&field, &type);
+            detail::throwOnBadStatus(UA_copy(value->data(), &field, &type));
+        }
+        mask |= flag;
+    }
+
+    void copyArrayDimensions(UA_UInt32*& dims, size_t& size, uint32_t& mask) const {
+        const auto* value = get(AttributeId::ArrayDimensions);
+        const auto& type = UA_TYPES[UA_TYPES_UINT32];
+        if (value == nullptr || !value->isArray() || !value->isType(type)) {
+            return;
+        }
+        UA_Array_delete(dims, size, &type);
+        dims = nullptr;
+        size = 0;
+        detail::throwOnBadStatus(UA_Array_copy(
+            value->data(), (*value)->arrayLength, reinterpret_cast<void**>(&dims), &type  // NOLINT
+        ));
+        size = (*value)->arrayLength;
+        mask |= UA_NODEATTRIBUTESMASK_ARRAYDIMENSIONS;
+    }
+};
+
+}  // namespace
+
+template <typename Attributes>
+static ExtensionObject exportAttributes(const ExportedNode& exported) {
+    using Id = AttributeId;
+    Attributes attributes;
+    auto& native = *attributes.handle();
+    auto& mask = native.specifiedAttributes;
+    exported.copy(Id::DisplayName, native.displayName, mask, UA_NODEATTRIBUTESMASK_DISPLAYNAME);
+    exported.copy(Id::Description, native.description, mask, UA_NODEATTRIBUTESMASK_DESCRIPTION);
+    exported.copy(Id::WriteMask, native.writeMask, mask, UA_NODEATTRIBUTESMASK_WRITEMASK);
+    if constexpr (std::is_same_v<Attributes, ObjectAttributes> ||
+                  std::is_same_v<Attributes, ViewAttributes>) {
+        exported.copy(
+            Id::EventNotifier, native.eventNotifier, mask, UA_NODEATTRIBUTESMASK_EVENTNOTIFIER
+        );
+    }
+    if constexpr (std::is_same_v<Attributes, VariableAttributes> ||
+                  std::is_same_v<Attributes, VariableTypeAttributes>) {
+        exported.copy(Id::Value, native.value, mask, UA_NODEATTRIBUTESMASK_VALUE);
+        exported.copy(Id::DataType, native.dataType, mask, UA_NODEATTRIBUTESMASK_DATATYPE);
+        exported.copy(Id::ValueRank, native.valueRank, mask, UA_NODEATTRIBUTESMASK_VALUERANK);
+        exported.copyArrayDimensions(native.arrayDimensions, native.arrayDimensionsSize, mask);
+    }
+    if constexpr (std::is_same_v<Attributes, VariableAttributes>) {
+        exported.copy(
+            Id::AccessLevel, native.accessLevel, mask, UA_NODEATTRIBUTESMASK_ACCESSLEVEL
+        );
+        exported.copy(
+            Id::MinimumSamplingInterval,
+            native.minimumSamplingInterval,
+            mask,
+            UA_NODEATTRIBUTESMASK_MINIMUMSAMPLINGINTERVAL
+        );
+        exported.copy(
+            Id::Historizing, native.historizing, mask, UA_NODEATTRIBUTESMASK_HISTORIZING
+        );
+    }
+    if constexpr (std::is_same_v<Attributes, MethodAttributes>) {
+        exported.copy(Id::Executable, native.executable, mask, UA_NODEATTRIBUTESMASK_EXECUTABLE);
+    }
+    if constexpr (std::is_same_v<Attributes, ObjectTypeAttributes> ||
+                  std::is_same_v<Attributes, VariableTypeAttributes> ||
+                  std::is_same_v<Attributes, ReferenceTypeAttributes> ||
+                  std::is_same_v<Attributes, DataTypeAttributes>) {
+        exported.copy(Id::IsAbstract, native.isAbstract, mask, UA_NODEATTRIBUTESMASK_ISABSTRACT);
+    }
+    if constexpr (std::is_same_v<Attributes, ReferenceTypeAttributes>) {
+        exported.copy(Id::Symmetric, native.symmetric, mask, UA_NODEATTRIBUTESMASK_SYMMETRIC);
+        exported.copy(
+            Id::InverseName, native.inverseName, mask, UA_NODEATTRIBUTESMASK_INVERSENAME
+        );
+    }
+    if constexpr (std::is_same_v<Attributes, ViewAttributes>) {
+        exported.copy(
+            Id::ContainsNoLoops,
+            native.containsNoLoops,
+            mask,
+            UA_NODEATTRIBUTESMASK_CONTAINSNOLOOPS
+        );
+    }
+    return ExtensionObject::fromDecodedCopy(attributes);
+}
+
+static ExtensionObject exportAttributes(NodeClass nodeClass, const ExportedNode& exported) {
+    switch (nodeClass) {
+    case NodeClass::Object:
+        return exportAttributes<ObjectAttributes>(exported);
+    case NodeClass::Variable:
+        return exportAttributes<VariableAttributes>(exported);
+    case NodeClass::Method:
+        return exportAttributes<MethodAttributes>(exported);
+    case NodeClass::ObjectType:
+        return exportAttributes<ObjectTypeAttributes>(exported);
+    case NodeClass::VariableType:
+        return exportAttributes<VariableTypeAttributes>(exported);
+    case NodeClass::ReferenceType:
+        return exportAttributes<ReferenceTypeAttributes>(exported);
+    case NodeClass::DataType:
+        return exportAttributes<DataTypeAttributes>(exported);
+    case NodeClass::View:
+        return exportAttributes<ViewAttributes>(exported);
+    default:
+        return {};
+    }
+}
+
+static void collectNode(void* visitorContext, const UA_Node* node) {
+    // collect ids only, services must not be called while iterating the nodestore
+    auto& nodes = *static_cast<std::vector<ParsedNode>*>(visitorContext);
+    if (node->head.nodeId.namespaceIndex == 0) {
+        return;
+    }
+    auto& parsed = nodes.emplace_back();
+    parsed.id = asWrapper<NodeId>(node->head.nodeId);
+    parsed.nodeClass = static_cast<NodeClass>(node->head.nodeClass);
+}
+
+Nodeset exportNodeset(Server& server) {
+    ParserState state;
+    auto& nodes = state.nodes;
+    auto* config = UA_Server_getConfig(server.handle());
+    config->nodestore.iterate(config->nodestore.context, collectNode, &nodes);
+
+    // read all attributes with a single batched call
+    std::vector<ReadValueId> nodesToRead;
+    for (const auto& node : nodes) {
+        for (const auto id : getExportedAttributes(node.nodeClass)) {
+            nodesToRead.emplace_back(node.id, id);
+        }
+    }
+    const auto values = services::readAttributes(server, nodesToRead);
+
+    size_t offset = 0;
+    std::vector<ReferenceDescription> references;
+    for (auto& node : nodes) {
+        const auto ids = getExportedAttributes(node.nodeClass);
+        const ExportedNode exported{ids, Span(values).subview(offset, ids.size())};
+        offset += ids.size();
+        if (const auto* browseName = exported.get(AttributeId::BrowseName);
+            browseName != nullptr && browseName->isType(Type::QualifiedName)) {
+            node.browseName = browseName->getScalarCopy<QualifiedName>();
+        }
+        if (const auto* dataType = exported.get(AttributeId::DataType);
+            dataType != nullptr && dataType->isType(Type::NodeId)) {
+            node.dataType = dataType->getScalarCopy<NodeId>();
+        }
+        node.attributes = exportAttributes(node.nodeClass, exported);
+
+        // follows the continuation points if a node exceeds maxReferencesPerNode
+        services::browseAll(
+            server,
+            BrowseDescription(
+                node.id,
+                BrowseDirection::Both,
+                ReferenceTypeId::References,
+                true,
+                UA_NODECLASS_UNSPECIFIED,
+                UA_BROWSERESULTMASK_REFERENCETYPEID | UA_BROWSERESULTMASK_ISFORWARD
+            ),
+            references
+        );
+        for (const auto& ref : references) {
+            if (ref.getNodeId().isLocal()) {
+                node.references.push_back(
+                    {ref.getReferenceTypeId(), ref.getNodeId().getNodeId(), ref.getIsForward()}
+                );
+            }
+        }
+    }
+
+    auto namespaceUris = server.getNamespaceArray();
+    state.nodeset.namespaceUris.assign(
+        std::make_move_iterator(std::next(namespaceUris.begin())),
+        std::make_move_iterator(namespaceUris.end())
+    );
+    buildNodeBatch(state);
+    return std::move(state.nodeset);
+}
+
+#else
+
+Nodeset exportNodeset([[maybe_unused]] Server& server) {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+#endif
+
+}  // namespace opcua
@@ -0,0 +1,118 @@
+#include "open62541pp/NotificationBatch.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+#include <limits>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Subscription.h"
+#include "open62541pp/detail/numeric.h"
+
+#include "ClientContext.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+void ColumnarNotificationBatch::clear() noexcept {
+    monIds.clear();
+    nodeIndexes.clear();
+    nodeIds.clear();
+    numericValues.clear();
+    values.clear();
+    statusCodes.clear();
+    sourceTimestamps.clear();
+    serverTimestamps.clear();
+}
+
+NotificationBatchBuilder::NotificationBatchBuilder(
+    NotificationBatchOptions options, NotificationBatchCallback callback
+)
+    : options_(options),
+      callback_(std::move(callback)) {}
+
+uint32_t NotificationBatchBuilder::getNodeIndex(const NodeId& nodeId) {
+    const auto [it, inserted] =
+        nodeIndexes_.try_emplace(nodeId, static_cast<uint32_t>(batch_.nodeIds.size()));
+    if (inserted) {
+        batch_.nodeIds.push_back(nodeId);
+    }
+    return it->second;
+}
+
+void NotificationBatchBuilder::append(
+    uint32_t monId, const NodeId& nodeId, const DataValue& value
+) {
+    if (batch_.empty()) {
+        batchStart_ = Clock::now();
+    }
+    const UA_DataValue& dv = *value.handle();
+    double numericValue = std::numeric_limits<double>::quiet_NaN();
+    const auto convert = [&](const auto* input) {
+        detail::convertNumericArray(input, &numericValue, 1);
+    };
+    const bool numeric = dv.hasValue && UA_Variant_isScalar(&dv.value) &&
+                         detail::visitNumericArray(dv.value.data, dv.value.type, convert);
+    batch_.monIds.push_back(monId);
+    batch_.nodeIndexes.push_back(getNodeIndex(nodeId));
+    batch_.numericValues.push_back(numericValue);
+    batch_.values.push_back(numeric || !dv.hasValue ? Variant{} : value.getValue());
+    batch_.statusCodes.emplace_back(dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD);
+    batch_.sourceTimestamps.emplace_back(dv.hasSourceTimestamp ? dv.sourceTimestamp : 0);
+    batch_.serverTimestamps.emplace_back(dv.hasServerTimestamp ? dv.serverTimestamp : 0);
+
+    if (batch_.size() >= options_.maxRows) {
+        flush();
+    } else {
+        flushIfDue();
+    }
+}
+
+void NotificationBatchBuilder::flush() {
+    if (batch_.empty()) {
+        return;
+    }
+    ++batchCount_;
+    if (callback_) {
+        callback_(batch_);
+    }
+    batch_.clear();  // the columns might have been moved by the callback
+    nodeIndexes_.clear();
+}
+
+void NotificationBatchBuilder::flushIfDue() {
+    if (!batch_.empty() && options_.maxAge > std::chrono::milliseconds::zero() &&
+        Clock::now() - batchStart_ >= options_.maxAge) {
+        flush();
+    }
+}
+
+void attachNotificationBatchBuilder(
+    Subscription<Client>& subscription, const std::shared_ptr<NotificationBatchBuilder>& builder
+) {
+    subscription.setDataChangeBatchCallback(
+        [client = &subscription.getConnection(),
+         weakBuilder = std::weak_ptr<NotificationBatchBuilder>(builder)](
+            uint32_t subId, Span<const services::DataChangeNotification> notifications
+        ) {
+            const auto locked = weakBuilder.lock();
+            if (locked == nullptr) {
+                return;
+            }
+            static const NodeId unknown;
+            auto& context = client->getContext();
+            for (const auto& notification : notifications) {
+                const auto* item = context.findMonitoredItem(subId, notification.monId);
+                locked->append(
+                    notification.monId,
+                    item != nullptr ? item->getNodeId() : unknown,
+                    notification.value
+                );
+            }
+        }
+    );
+}
+
+}  // namespace opcua
+
+#endif
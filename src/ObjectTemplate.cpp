@@ -0,0 +1,309 @@
+#include "open62541pp/ObjectTemplate.h"
+
+#include <algorithm>  // any_of, equal, find_if
+#include <array>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeConverter.h"  // guessDataType
+#include "open62541pp/TypeWrapper.h"  // operator==
+#include "open62541pp/overloads/comparison.h"  // operator==
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/services/View.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+/// Attributes read from the instance declarations, variable attributes are ignored for objects.
+constexpr std::array declarationAttributes{
+    AttributeId::DisplayName,
+    AttributeId::Description,
+    AttributeId::WriteMask,
+    AttributeId::EventNotifier,
+    AttributeId::Value,
+    AttributeId::DataType,
+    AttributeId::ValueRank,
+    AttributeId::ArrayDimensions,
+    AttributeId::AccessLevel,
+    AttributeId::MinimumSamplingInterval,
+};
+
+}  // namespace
+
+template <typename T>
+static const T* getScalar(const DataValue& dv) noexcept {
+    if (!dv.hasValue() || !dv.getValue().isScalar() ||
+        !dv.getValue().isType(detail::guessDataType<T>())) {
+        return nullptr;
+    }
+    return static_cast<const T*>(dv.getValue().data());
+}
+
+template <typename Attributes>
+static void copyCommonAttributes(Span<const DataValue> values, Attributes& attributes) {
+    if (const auto* displayName = getScalar<LocalizedText>(values[0])) {
+        attributes.setDisplayName(*displayName);
+    }
+    if (const auto* description = getScalar<LocalizedText>(values[1])) {
+        attributes.setDescription(*description);
+    }
+    if (const auto* writeMask = getScalar<uint32_t>(values[2])) {
+        attributes.setWriteMask(*writeMask);
+    }
+}
+
+static ExtensionObject createObjectAttributes(Span<const DataValue> values) {
+    ObjectAttributes attributes;
+    copyCommonAttributes(values, attributes);
+    if (const auto* eventNotifier = getScalar<uint8_t>(values[3])) {
+        attributes.setEventNotifier(*eventNotifier);
+    }
+    return ExtensionObject::fromDecodedCopy(attributes);
+}
+
+static ExtensionObject createVariableAttributes(Span<const DataValue> values) {
+    VariableAttributes attributes;
+    copyCommonAttributes(values, attributes);
+    if (values[4].hasValue()) {
+        attributes.setValue(values[4].getValue());  // default value
+    }
+    if (const auto* dataType = getScalar<NodeId>(values[5])) {
+        attributes.setDataType(*dataType);
+    }
+    if (const auto* valueRank = getScalar<int32_t>(values[6])) {
+        attributes.setValueRank(static_cast<ValueRank>(*valueRank));
+    }
+    if (const auto& dims = values[7]; dims.hasValue() && dims.getValue().isType(Type::UInt32)) {
+        attributes.setArrayDimensions(dims.getValue().getArrayCopy<uint32_t>());
+    }
+    if (const auto* accessLevel = getScalar<uint8_t>(values[8])) {
+        attributes.setAccessLevel(*accessLevel);
+    }
+    if (const auto* interval = getScalar<double>(values[9])) {
+        attributes.setMinimumSamplingInterval(*interval);
+    }
+    return ExtensionObject::fromDecodedCopy(attributes);
+}
+
+static bool isMandatory(Server& server, const NodeId& id) {
+    const auto refs = services::browseAll(
+        server, BrowseDescription(id, BrowseDirection::Forward, ReferenceTypeId::HasModellingRule)
+    );
+    return std::any_of(refs.begin(), refs.end(), [](const ReferenceDescription& ref) {
+        return ref.getNodeId().getNodeId() == NodeId(ObjectId::ModellingRule_Mandatory);
+    });
+}
+
+static NodeId getSupertype(Server& server, const NodeId& typeId) {
+    if (typeId == NodeId(ObjectTypeId::BaseObjectType)) {
+        return {};  // no instance declarations
+    }
+    const auto refs = services::browseAll(
+        server,
+        BrowseDescription(typeId, BrowseDirection::Inverse, ReferenceTypeId::HasSubtype, false)
+    );
+    return refs.empty() ? NodeId{} : refs.front().getNodeId().getNodeId();
+}
+
+/// Type definition used to add an instance child without instantiating its type in open62541.
+static NodeId getBaseTypeDefinition(NodeClass nodeClass, const NodeId& typeDefinition) {
+    if (nodeClass == NodeClass::Object) {
+        return ObjectTypeId::BaseObjectType;
+    }
+    if (typeDefinition == NodeId(VariableTypeId::PropertyType)) {
+        return VariableTypeId::PropertyType;
+    }
+    return VariableTypeId::BaseDataVariableType;
+}
+
+static void replaceTypeDefinition(
+    Server& server, const NodeId& id, const NodeId& from, const NodeId& to
+) {
+    services::deleteReference(server, id, from, ReferenceTypeId::HasTypeDefinition, true, true);
+    services::addReference(server, id, to, ReferenceTypeId::HasTypeDefinition, true);
+}
+
+ObjectTemplate::ObjectTemplate(Server& server, const NodeId& objectType)
+    : connection_(server),
+      objectType_(objectType) {
+    // subtypes first, overridden instance declarations of supertypes are skipped
+    for (NodeId typeId = objectType; !typeId.isNull(); typeId = getSupertype(server, typeId)) {
+        collect(typeId, npos);
+    }
+    readAttributes();
+}
+
+Server& ObjectTemplate::getConnection() noexcept {
+    return connection_;
+}
+
+const Server& ObjectTemplate::getConnection() const noexcept {
+    return connection_;
+}
+
+const NodeId& ObjectTemplate::getObjectType() const noexcept {
+    return objectType_;
+}
+
+size_t ObjectTemplate::size() const noexcept {
+    return children_.size();
+}
+
+bool ObjectTemplate::contains(Span<const QualifiedName> path) const noexcept {
+    return std::any_of(children_.begin(), children_.end(), [&](const Child& child) {
+        return std::equal(child.path.begin(), child.path.end(), path.begin(), path.end());
+    });
+}
+
+void ObjectTemplate::bind(Span<const QualifiedName> path, BindCallback callback) {
+    const auto it = std::find_if(children_.begin(), children_.end(), [&](const Child& child) {
+        return std::equal(child.path.begin(), child.path.end(), path.begin(), path.end());
+    });
+    if (it == children_.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNOMATCH);
+    }
+    it->bindings.push_back(std::move(callback));
+}
+
+NodeId ObjectTemplate::instantiate(
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    const ObjectAttributes& attributes,
+    const NodeId& referenceType
+) {
+    auto& server = connection_;
+    const NodeId baseObjectType(ObjectTypeId::BaseObjectType);
+    const auto instanceId = services::addObject(
+        server, parentId, id, browseName, attributes, baseObjectType, referenceType
+    );
+    std::vector<NodeId> ids(children_.size());
+    try {
+        replaceTypeDefinition(server, instanceId, baseObjectType, objectType_);
+        const NodeId generatedId(instanceId.getNamespaceIndex(), 0);
+        for (size_t i = 0; i < children_.size(); ++i) {
+            const auto& child = children_[i];
+            const auto& parent = child.parent == npos ? instanceId : ids[child.parent];
+            if (child.nodeClass == NodeClass::Method) {
+                // methods are shared by all instances
+                services::addReference(
+                    server, parent, child.declarationId, child.referenceType, true
+                );
+                continue;
+            }
+            const auto baseType = getBaseTypeDefinition(child.nodeClass, child.typeDefinition);
+            const auto& decoded = child.attributes->content.decoded;
+            detail::throwOnBadStatus(__UA_Server_addNode(
+                server.handle(),
+                static_cast<UA_NodeClass>(child.nodeClass),
+                generatedId.handle(),
+                parent.handle(),
+                child.referenceType.handle(),
+                *child.browseName.handle(),
+                baseType.handle(),
+                static_cast<const UA_NodeAttributes*>(decoded.data),
+                decoded.type,
+                nullptr,  // nodeContext
+                ids[i].handle()
+            ));
+            if (!child.typeDefinition.isNull() && child.typeDefinition != baseType) {
+                replaceTypeDefinition(server, ids[i], baseType, child.typeDefinition);
+            }
+        }
+    } catch (...) {
+        // remove the partially created instance, the children are deleted bottom-up
+        std::vector<NodeId> created;
+        for (size_t i = children_.size(); i > 0; --i) {
+            if (!ids[i - 1].isNull()) {
+                created.push_back(ids[i - 1]);
+            }
+        }
+        created.push_back(instanceId);
+        services::deleteNodes(server, Span<const NodeId>(created));
+        throw;
+    }
+
+    for (size_t i = 0; i < children_.size(); ++i) {
+        const auto& child = children_[i];
+        const auto& childId = child.nodeClass == NodeClass::Method ? child.declarationId : ids[i];
+        for (const auto& binding : child.bindings) {
+            binding(server, childId);
+        }
+    }
+    return instanceId;
+}
+
+void ObjectTemplate::collect(const NodeId& declarationId, size_t parent) {
+    const auto refs = services::browseAll(
+        connection_,
+        BrowseDescription(
+            declarationId,
+            BrowseDirection::Forward,
+            ReferenceTypeId::Aggregates,
+            true,
+            UA_NODECLASS_OBJECT | UA_NODECLASS_VARIABLE | UA_NODECLASS_METHOD
+        )
+    );
+    for (const auto& ref : refs) {
+        const auto& childId = ref.getNodeId();
+        if (!childId.isLocal()) {
+            continue;
+        }
+        const bool duplicate = std::any_of(children_.begin(), children_.end(), [&](const Child& c) {
+            return c.parent == parent && c.browseName == ref.getBrowseName();
+        });
+        if (duplicate || !isMandatory(connection_, childId.getNodeId())) {
+            continue;
+        }
+        Child child;
+        child.parent = parent;
+        if (parent != npos) {
+            child.path = children_[parent].path;
+        }
+        child.path.push_back(ref.getBrowseName());
+        child.declarationId = childId.getNodeId();
+        child.referenceType = ref.getReferenceTypeId();
+        child.nodeClass = ref.getNodeClass();
+        child.browseName = ref.getBrowseName();
+        child.typeDefinition = ref.getTypeDefinition().getNodeId();
+        children_.push_back(std::move(child));
+        if (ref.getNodeClass() != NodeClass::Method) {
+            collect(childId.getNodeId(), children_.size() - 1);
+        }
+    }
+}
+
+void ObjectTemplate::readAttributes() {
+    // read the attributes of all instance declarations with a single call
+    std::vector<ReadValueId> nodesToRead;
+    nodesToRead.reserve(children_.size() * declarationAttributes.size());
+    for (const auto& child : children_) {
+        if (child.nodeClass != NodeClass::Method) {
+            for (const auto attributeId : declarationAttributes) {
+                nodesToRead.emplace_back(child.declarationId, attributeId);
+            }
+        }
+    }
+    const auto values = services::readAttributes(connection_, nodesToRead);
+
+    size_t offset = 0;
+    for (auto& child : children_) {
+        if (child.nodeClass == NodeClass::Method) {
+            continue;
+        }
+        const auto childValues = Span(values).subview(offset, declarationAttributes.size());
+        offset += declarationAttributes.size();
+        child.attributes = child.nodeClass == NodeClass::Object
+            ? createObjectAttributes(childValues)
+            : createVariableAttributes(childValues);
+    }
+}
+
+}  // namespace opcua
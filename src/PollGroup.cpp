@@ -0,0 +1,270 @@
+#include "open62541pp/PollGroup.h"
+
+#include <algorithm>  // max, min
+#include <chrono>
+#include <mutex>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "ClientContext.h"
+#include "detail/LastReportedValue.h"
+#include "open62541_impl.h"
+#include "services/AsyncService.h"
+#include "services/OperationLimits.h"
+#include "services/RegisteredNodes.h"
+
+namespace opcua {
+
+using Clock = std::chrono::steady_clock;
+
+static ClientContext::PollGroup& getPollGroup(ClientContext& context, uint32_t pollGroupId) {
+    const auto it = context.pollGroups.find(pollGroupId);
+    if (it == context.pollGroups.end()) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    return it->second;
+}
+
+static Clock::duration toDuration(double milliseconds) noexcept {
+    return std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double, std::milli>(std::max(milliseconds, 0.0))
+    );
+}
+
+/// Report the results of a read request, the callbacks might add/remove items and poll groups.
+static void processPollResponse(
+    ClientContext& context,
+    uint32_t pollGroupId,
+    const std::vector<uint32_t>& itemIds,
+    ReadResponse& response
+) {
+    auto group = context.pollGroups.find(pollGroupId);
+    if (group == context.pollGroups.end()) {
+        return;
+    }
+    --group->second.inFlight;
+    const StatusCode serviceResult = response->responseHeader.serviceResult;
+    auto results = response.getResults();
+    for (size_t i = 0; i < itemIds.size(); ++i) {
+        group = context.pollGroups.find(pollGroupId);
+        if (group == context.pollGroups.end()) {
+            return;
+        }
+        const auto item = group->second.items.find(itemIds[i]);
+        if (item == group->second.items.end()) {
+            continue;
+        }
+        DataValue dv;
+        if (serviceResult.isBad()) {
+            dv.setStatusCode(serviceResult);
+        } else if (i < results.size()) {
+            dv.swap(results[i]);
+        } else {
+            dv.setStatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        if (!detail::applyClientFilter(item->second, *dv.handle())) {
+            continue;
+        }
+        // copy, the item might be removed within the callback
+        const auto callback = item->second.callback;
+        if (callback) {
+            detail::invokeCatchIgnore(callback, pollGroupId, itemIds[i], dv);
+        }
+    }
+}
+
+static void sendPoll(
+    Client& client, uint32_t pollGroupId, ClientContext::PollGroup& group, size_t limit
+) {
+    auto& context = client.getContext();
+    const size_t chunkSize = limit == 0 ? group.items.size() : limit;
+    const auto aliases = detail::getNodeAliases(client, false);
+
+    auto item = group.items.begin();
+    while (item != group.items.end()) {
+        std::vector<uint32_t> itemIds;
+        std::vector<UA_ReadValueId> nodesToRead;
+        for (; item != group.items.end() && itemIds.size() < chunkSize; ++item) {
+            itemIds.push_back(item->first);
+            UA_ReadValueId native = *item->second.itemToRead.handle();  // shallow copy
+            native.nodeId = detail::substituteAlias(aliases.get(), native.nodeId);
+            nodesToRead.push_back(native);
+        }
+        UA_ReadRequest request{};
+        request.maxAge = group.parameters.maxAge;
+        request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(
+            group.parameters.timestamps
+        );
+        request.nodesToReadSize = nodesToRead.size();
+        request.nodesToRead = nodesToRead.data();
+        try {
+            detail::sendAsyncRequest<ReadResponse>(
+                client,
+                request,
+                UA_TYPES[UA_TYPES_READREQUEST],
+                [contextPtr = &context, pollGroupId, ids = std::move(itemIds)](
+                    ReadResponse& response
+                ) { processPollResponse(*contextPtr, pollGroupId, ids, response); }
+            );
+            ++group.inFlight;
+        } catch (const BadStatus&) {
+            ++group.skipped;  // e.g. disconnected, retried with the next poll
+            return;
+        }
+    }
+}
+
+namespace detail {
+
+void pollDueGroups(Client& client) {
+    auto& context = client.getContext();
+    if (context.pollGroups.empty()) {
+        return;
+    }
+    const auto now = Clock::now();
+    std::vector<uint32_t> due;
+    for (const auto& [pollGroupId, group] : context.pollGroups) {
+        if (now >= group.nextPoll) {
+            due.push_back(pollGroupId);
+        }
+    }
+    if (due.empty()) {
+        return;
+    }
+    // fetched synchronously on first use, responses (and callbacks) might be processed meanwhile
+    const size_t limit = getOperationLimits(client).maxNodesPerRead;
+    for (const auto pollGroupId : due) {
+        const auto it = context.pollGroups.find(pollGroupId);
+        if (it == context.pollGroups.end()) {
+            continue;
+        }
+        auto& group = it->second;
+        // fixed grid of poll times, missed poll times are skipped
+        const auto interval = toDuration(group.parameters.interval);
+        if (interval > Clock::duration::zero()) {
+            const auto missed = (now - group.nextPoll) / interval;
+            group.skipped += static_cast<uint64_t>(missed);
+            group.nextPoll += (missed + 1) * interval;
+        } else {
+            group.nextPoll = now;
+        }
+        if (group.inFlight > 0) {
+            ++group.skipped;
+            continue;
+        }
+        if (!group.items.empty()) {
+            sendPoll(client, pollGroupId, group, limit);
+        }
+    }
+}
+
+std::optional<Clock::duration> getNextPoll(const ClientContext& context) noexcept {
+    if (context.pollGroups.empty()) {
+        return std::nullopt;
+    }
+    const auto now = Clock::now();
+    auto result = Clock::duration::max();
+    for (const auto& [pollGroupId, group] : context.pollGroups) {
+        result = std::min(result, std::max(group.nextPoll - now, Clock::duration::zero()));
+    }
+    return result;
+}
+
+}  // namespace detail
+
+PollGroup::PollGroup(Client& client, uint32_t pollGroupId) noexcept
+    : connection_(&client),
+      pollGroupId_(pollGroupId) {}
+
+Client& PollGroup::getConnection() noexcept {
+    return *connection_;
+}
+
+const Client& PollGroup::getConnection() const noexcept {
+    return *connection_;
+}
+
+uint32_t PollGroup::getPollGroupId() const noexcept {
+    return pollGroupId_;
+}
+
+PollGroupParameters PollGroup::getParameters() const {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    return getPollGroup(context, pollGroupId_).parameters;
+}
+
+void PollGroup::setParameters(const PollGroupParameters& parameters) {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    auto& group = getPollGroup(context, pollGroupId_);
+    group.parameters = parameters;
+    group.nextPoll = Clock::now();
+}
+
+uint32_t PollGroup::addItem(
+    const NodeId& id,
+    services::DataChangeNotificationCallback callback,
+    std::optional<services::ClientDataChangeFilter> filter,
+    AttributeId attributeId
+) {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    auto& group = getPollGroup(context, pollGroupId_);
+    const uint32_t itemId = group.nextItemId++;
+    auto& item = group.items[itemId];
+    item.itemToRead = ReadValueId(id, attributeId);
+    item.callback = std::move(callback);
+    item.clientFilter = filter;
+    return itemId;
+}
+
+void PollGroup::removeItem(uint32_t itemId) {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    const auto it = context.pollGroups.find(pollGroupId_);
+    if (it != context.pollGroups.end()) {
+        it->second.items.erase(itemId);
+    }
+}
+
+std::vector<uint32_t> PollGroup::getItemIds() const {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    const auto& items = getPollGroup(context, pollGroupId_).items;
+    std::vector<uint32_t> result;
+    result.reserve(items.size());
+    for (const auto& [itemId, item] : items) {
+        result.push_back(itemId);
+    }
+    return result;
+}
+
+uint64_t PollGroup::getSkippedPollCount() const {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    return getPollGroup(context, pollGroupId_).skipped;
+}
+
+void PollGroup::deletePollGroup() {
+    auto& context = connection_->getContext();
+    const std::lock_guard lock(context.mutex);
+    context.pollGroups.erase(pollGroupId_);
+}
+
+bool operator==(const PollGroup& lhs, const PollGroup& rhs) noexcept {
+    return (lhs.getConnection() == rhs.getConnection()) &&
+           (lhs.getPollGroupId() == rhs.getPollGroupId());
+}
+
+bool operator!=(const PollGroup& lhs, const PollGroup& rhs) noexcept {
+    return !(lhs == rhs);
+}
+
+}  // namespace opcua
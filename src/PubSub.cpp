@@ -0,0 +1,302 @@
+#include "open62541pp/PubSub.h"
+
+#ifdef UA_ENABLE_PUBSUB
+
+#include <algorithm>  // all_of
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/detail/helper.h"  // toNativeString
+
+#include "ServerContext.h"
+#include "open62541_impl.h"
+
+namespace opcua {
+
+/// Fixed layout of UADP network messages as required for fixed offsets.
+/// Writers and readers must agree on the layout.
+static constexpr auto networkMessageContentMask = static_cast<UA_UadpNetworkMessageContentMask>(
+    UA_UADPNETWORKMESSAGECONTENTMASK_PUBLISHERID | UA_UADPNETWORKMESSAGECONTENTMASK_GROUPHEADER |
+    UA_UADPNETWORKMESSAGECONTENTMASK_WRITERGROUPID |
+    UA_UADPNETWORKMESSAGECONTENTMASK_PAYLOADHEADER
+);
+
+/* ------------------------------------- PublishedDataSet ------------------------------------- */
+
+PublishedDataSet::PublishedDataSet(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+NodeId PublishedDataSet::addField(const NodeId& variableId, std::string_view alias) {
+    UA_DataSetFieldConfig config{};
+    config.dataSetFieldType = UA_PUBSUB_DATASETFIELD_VARIABLE;
+    auto& variable = config.field.variable;
+    variable.fieldNameAlias = detail::toNativeString(alias);
+    variable.publishParameters.publishedVariable = *variableId.handle();
+    variable.publishParameters.attributeId = UA_ATTRIBUTEID_VALUE;
+
+    NodeId fieldId;
+    const auto result = UA_Server_addDataSetField(
+        server_->handle(), *id_.handle(), &config, fieldId.handle()
+    );
+    detail::throwOnBadStatus(result.result);
+    return fieldId;
+}
+
+NodeId PublishedDataSet::addField(DataValue& source, std::string_view alias) {
+    // open62541 stores a pointer to the DataValue pointer, keep it at a stable address
+    auto& sources = server_->getContext().pubSubValueSources;
+    auto*& sourcePtr = sources.emplace_back(source.handle());
+
+    UA_DataSetFieldConfig config{};
+    config.dataSetFieldType = UA_PUBSUB_DATASETFIELD_VARIABLE;
+    auto& variable = config.field.variable;
+    variable.fieldNameAlias = detail::toNativeString(alias);
+    variable.rtValueSource.rtFieldSourceEnabled = true;
+    variable.rtValueSource.staticValueSource = &sourcePtr;
+
+    NodeId fieldId;
+    const auto result = UA_Server_addDataSetField(
+        server_->handle(), *id_.handle(), &config, fieldId.handle()
+    );
+    detail::throwOnBadStatus(result.result);
+    return fieldId;
+}
+
+void PublishedDataSet::remove() {
+    detail::throwOnBadStatus(UA_Server_removePublishedDataSet(server_->handle(), *id_.handle()));
+}
+
+/* ---------------------------------------- WriterGroup --------------------------------------- */
+
+WriterGroup::WriterGroup(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+NodeId WriterGroup::addDataSetWriter(
+    const PublishedDataSet& dataSet, uint16_t dataSetWriterId, uint32_t keyFrameCount
+) {
+    UA_DataSetWriterConfig config{};
+    config.name = UA_STRING_STATIC("DataSetWriter");
+    config.dataSetWriterId = dataSetWriterId;
+    config.keyFrameCount = keyFrameCount;
+
+    NodeId writerId;
+    detail::throwOnBadStatus(UA_Server_addDataSetWriter(
+        server_->handle(), *id_.handle(), *dataSet.getId().handle(), &config, writerId.handle()
+    ));
+    return writerId;
+}
+
+void WriterGroup::setOperational() {
+    // the message layout is computed and preallocated if the realtime level is fixed size
+    detail::throwOnBadStatus(
+        UA_Server_freezeWriterGroupConfiguration(server_->handle(), *id_.handle())
+    );
+    detail::throwOnBadStatus(UA_Server_setWriterGroupOperational(server_->handle(), *id_.handle()));
+}
+
+void WriterGroup::setDisabled() {
+    detail::throwOnBadStatus(UA_Server_setWriterGroupDisabled(server_->handle(), *id_.handle()));
+    detail::throwOnBadStatus(
+        UA_Server_unfreezeWriterGroupConfiguration(server_->handle(), *id_.handle())
+    );
+}
+
+void WriterGroup::remove() {
+    detail::throwOnBadStatus(UA_Server_removeWriterGroup(server_->handle(), *id_.handle()));
+}
+
+/* --------------------------------------- DataSetReader -------------------------------------- */
+
+DataSetReader::DataSetReader(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+void DataSetReader::remove() {
+    detail::throwOnBadStatus(UA_Server_removeDataSetReader(server_->handle(), *id_.handle()));
+}
+
+/* ---------------------------------------- ReaderGroup --------------------------------------- */
+
+ReaderGroup::ReaderGroup(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+static UA_Byte getBuiltinTypeId(const UA_DataType& type) noexcept {
+    // builtin type ids are the data type kinds + 1, enumerations are encoded as Int32 and
+    // structures as ExtensionObject
+    if (type.typeKind <= UA_DATATYPEKIND_DIAGNOSTICINFO) {
+        return static_cast<UA_Byte>(type.typeKind + 1);
+    }
+    if (type.typeKind == UA_DATATYPEKIND_ENUM) {
+        return static_cast<UA_Byte>(UA_DATATYPEKIND_INT32 + 1);
+    }
+    return static_cast<UA_Byte>(UA_DATATYPEKIND_EXTENSIONOBJECT + 1);
+}
+
+static void invokeMessageCallback(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* readerId,
+    [[maybe_unused]] const UA_NodeId* readerGroupId,
+    [[maybe_unused]] const UA_NodeId* targetVariableId,
+    void* targetVariableContext,
+    [[maybe_unused]] UA_DataValue** externalDataValue
+) noexcept {
+    auto* callback = static_cast<std::function<void()>*>(targetVariableContext);
+    try {
+        (*callback)();
+    } catch (...) {  // NOLINT, ignore
+    }
+}
+
+DataSetReader ReaderGroup::addDataSetReader(const DataSetReaderConfig& config) {
+    const auto& fields = config.fields;
+    const bool userMemory = std::all_of(fields.begin(), fields.end(), [](const auto& field) {
+        return field.target != nullptr;
+    });
+    // realtime readers decode into fixed offsets of preallocated memory, not into nodes
+    const bool fixedSize = server_->getContext().pubSubFixedSizeReaderGroups.count(id_) > 0;
+    if (fields.empty() || ((config.onMessage || fixedSize) && !userMemory)) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+
+    std::vector<UA_FieldMetaData> metaData(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+        const UA_DataType* type = UA_findDataType(fields[i].dataType.handle());
+        if (type == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADDATATYPEIDUNKNOWN);
+        }
+        metaData[i].name = detail::toNativeString(fields[i].name);
+        metaData[i].dataType = *fields[i].dataType.handle();  // borrowed, the config is copied
+        metaData[i].builtInType = getBuiltinTypeId(*type);
+        metaData[i].valueRank = UA_VALUERANK_SCALAR;
+    }
+
+    UA_UadpDataSetReaderMessageDataType message{};
+    message.networkMessageContentMask = networkMessageContentMask;
+
+    uint16_t publisherId = config.publisherId;
+    UA_DataSetReaderConfig native{};
+    native.name = detail::toNativeString(config.name);
+    UA_Variant_setScalar(&native.publisherId, &publisherId, &UA_TYPES[UA_TYPES_UINT16]);
+    native.writerGroupId = config.writerGroupId;
+    native.dataSetWriterId = config.dataSetWriterId;
+    native.messageReceiveTimeout = config.messageReceiveTimeout;
+    native.dataSetMetaData.fieldsSize = metaData.size();
+    native.dataSetMetaData.fields = metaData.data();
+    native.messageSettings.encoding = UA_EXTENSIONOBJECT_DECODED;
+    native.messageSettings.content.decoded.type =
+        &UA_TYPES[UA_TYPES_UADPDATASETREADERMESSAGEDATATYPE];
+    native.messageSettings.content.decoded.data = &message;
+
+    NodeId readerId;
+    detail::throwOnBadStatus(
+        UA_Server_addDataSetReader(server_->handle(), *id_.handle(), &native, readerId.handle())
+    );
+
+    auto& context = server_->getContext();
+    std::vector<UA_FieldTargetVariable> targets(fields.size());
+    for (size_t i = 0; i < fields.size(); ++i) {
+        auto& target = targets[i];
+        target.targetVariable.attributeId = UA_ATTRIBUTEID_VALUE;
+        target.targetVariable.targetNodeId = *fields[i].targetVariable.handle();
+        if (fields[i].target != nullptr) {
+            // the reader decodes into the user memory, the variable reads from the same memory
+            auto*& valuePtr = context.pubSubValueSources.emplace_back(fields[i].target->handle());
+            target.externalDataValue = &valuePtr;
+            UA_ValueBackend backend{};
+            backend.backendType = UA_VALUEBACKENDTYPE_EXTERNAL;
+            backend.backend.external.value = &valuePtr;
+            detail::throwOnBadStatus(UA_Server_setVariableNode_valueBackend(
+                server_->handle(), *fields[i].targetVariable.handle(), backend
+            ));
+        }
+    }
+    if (config.onMessage) {
+        // the last field completes the message
+        targets.back().targetVariableContext =
+            &context.pubSubMessageCallbacks.emplace_back(config.onMessage);
+        targets.back().afterWrite = invokeMessageCallback;
+    }
+    detail::throwOnBadStatus(UA_Server_DataSetReader_createTargetVariables(
+        server_->handle(), *readerId.handle(), targets.size(), targets.data()
+    ));
+    return {*server_, std::move(readerId)};
+}
+
+void ReaderGroup::setOperational() {
+    // the message layout is computed and the offsets are cached if the realtime level is fixed size
+    detail::throwOnBadStatus(
+        UA_Server_freezeReaderGroupConfiguration(server_->handle(), *id_.handle())
+    );
+    detail::throwOnBadStatus(UA_Server_setReaderGroupOperational(server_->handle(), *id_.handle()));
+}
+
+void ReaderGroup::setDisabled() {
+    detail::throwOnBadStatus(UA_Server_setReaderGroupDisabled(server_->handle(), *id_.handle()));
+    detail::throwOnBadStatus(
+        UA_Server_unfreezeReaderGroupConfiguration(server_->handle(), *id_.handle())
+    );
+}
+
+void ReaderGroup::remove() {
+    detail::throwOnBadStatus(UA_Server_removeReaderGroup(server_->handle(), *id_.handle()));
+    server_->getContext().pubSubFixedSizeReaderGroups.erase(id_);
+}
+
+/* -------------------------------------- PubSubConnection ------------------------------------ */
+
+PubSubConnection::PubSubConnection(Server& server, NodeId id) noexcept
+    : server_(&server),
+      id_(std::move(id)) {}
+
+WriterGroup PubSubConnection::addWriterGroup(const WriterGroupConfig& config) {
+    UA_UadpWriterGroupMessageDataType message{};
+    message.networkMessageContentMask = networkMessageContentMask;
+
+    UA_WriterGroupConfig native{};
+    native.name = detail::toNativeString(config.name);
+    native.enabled = false;
+    native.writerGroupId = config.writerGroupId;
+    native.publishingInterval = config.publishingInterval;
+    native.encodingMimeType = UA_PUBSUB_ENCODING_UADP;
+    native.rtLevel = config.rtLevel == PubSubRtLevel::FixedSize ? UA_PUBSUB_RT_FIXED_SIZE
+                                                                : UA_PUBSUB_RT_NONE;
+    native.messageSettings.encoding = UA_EXTENSIONOBJECT_DECODED;
+    native.messageSettings.content.decoded.type =
+        &UA_TYPES[UA_TYPES_UADPWRITERGROUPMESSAGEDATATYPE];
+    native.messageSettings.content.decoded.data = &message;  // borrowed, the config is copied
+
+    NodeId groupId;
+    detail::throwOnBadStatus(
+        UA_Server_addWriterGroup(server_->handle(), *id_.handle(), &native, groupId.handle())
+    );
+    return {*server_, std::move(groupId)};
+}
+
+ReaderGroup PubSubConnection::addReaderGroup(const ReaderGroupConfig& config) {
+    UA_ReaderGroupConfig native{};
+    native.name = detail::toNativeString(config.name);
+    native.rtLevel = config.rtLevel == PubSubRtLevel::FixedSize ? UA_PUBSUB_RT_FIXED_SIZE
+                                                                : UA_PUBSUB_RT_NONE;
+
+    NodeId groupId;
+    detail::throwOnBadStatus(
+        UA_Server_addReaderGroup(server_->handle(), *id_.handle(), &native, groupId.handle())
+    );
+    if (config.rtLevel == PubSubRtLevel::FixedSize) {
+        server_->getContext().pubSubFixedSizeReaderGroups.insert(groupId);
+    }
+    return {*server_, std::move(groupId)};
+}
+
+void PubSubConnection::remove() {
+    detail::throwOnBadStatus(UA_Server_removePubSubConnection(server_->handle(), *id_.handle()));
+}
+
+}  // namespace opcua
+
+#endif
@@ -0,0 +1,507 @@
+#include "ReadOptimizedNodestore.h"
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+
+#include <array>
+#include <cstddef>  // offsetof
+#include <cstdint>
+#include <cstdlib>  // calloc, free
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/types/NodeId.h"
+
+namespace opcua::detail {
+
+namespace {
+
+/// Node with bookkeeping, the node is the last member and allocated with the size of its class.
+struct NodeEntry {
+    const NodeEntry* orig;  // original entry of a copy, checked on replace
+    uint32_t refCount;
+    bool retired;  // removed or replaced, deleted with the last release
+    bool shared;  // node of the shared namespace 0, immutable and not reference counted
+    UA_Node node;
+};
+
+size_t getNodeSize(UA_NodeClass nodeClass) noexcept {
+    switch (nodeClass) {
+    case UA_NODECLASS_OBJECT:
+        return sizeof(UA_ObjectNode);
+    case UA_NODECLASS_VARIABLE:
+        return sizeof(UA_VariableNode);
+    case UA_NODECLASS_METHOD:
+        return sizeof(UA_MethodNode);
+    case UA_NODECLASS_OBJECTTYPE:
+        return sizeof(UA_ObjectTypeNode);
+    case UA_NODECLASS_VARIABLETYPE:
+        return sizeof(UA_VariableTypeNode);
+    case UA_NODECLASS_REFERENCETYPE:
+        return sizeof(UA_ReferenceTypeNode);
+    case UA_NODECLASS_DATATYPE:
+        return sizeof(UA_DataTypeNode);
+    case UA_NODECLASS_VIEW:
+        return sizeof(UA_ViewNode);
+    default:
+        return 0;
+    }
+}
+
+NodeEntry* createEntry(UA_NodeClass nodeClass) noexcept {
+    const size_t nodeSize = getNodeSize(nodeClass);
+    if (nodeSize == 0) {
+        return nullptr;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+    auto* entry = static_cast<NodeEntry*>(
+        std::calloc(1, sizeof(NodeEntry) - sizeof(UA_Node) + nodeSize)
+    );
+    if (entry != nullptr) {
+        entry->node.head.nodeClass = nodeClass;
+    }
+    return entry;
+}
+
+void deleteEntry(NodeEntry* entry) noexcept {
+    UA_Node_clear(&entry->node);
+    std::free(entry);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+NodeEntry* getEntry(const UA_Node* node) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* bytes = const_cast<char*>(reinterpret_cast<const char*>(node));
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<NodeEntry*>(bytes - offsetof(NodeEntry, node));
+}
+
+/// Delete the entry now or with the last release.
+void retireEntry(NodeEntry* entry) noexcept {
+    entry->retired = true;
+    if (entry->refCount == 0) {
+        deleteEntry(entry);
+    }
+}
+
+using NodeMap = std::unordered_map<NodeId, NodeEntry*>;
+
+/// Immutable namespace 0 shared by the nodestores of all servers in the process.
+struct SharedNamespaceZero {
+    NodeMap nodes;
+
+    SharedNamespaceZero() = default;
+
+    ~SharedNamespaceZero() {
+        for (auto& [id, entry] : nodes) {
+            deleteEntry(entry);
+        }
+    }
+
+    SharedNamespaceZero(const SharedNamespaceZero&) = delete;
+    SharedNamespaceZero(SharedNamespaceZero&&) noexcept = delete;
+    SharedNamespaceZero& operator=(const SharedNamespaceZero&) = delete;
+    SharedNamespaceZero& operator=(SharedNamespaceZero&&) noexcept = delete;
+};
+
+std::mutex sharedNamespaceZeroMutex;  // NOLINT
+std::weak_ptr<const SharedNamespaceZero> sharedNamespaceZero;  // NOLINT
+
+/**
+ * Check if a node built by a server equals the node of the shared namespace 0.
+ * Namespace 0 is built deterministically by open62541, so the structure, the callbacks and the
+ * values are compared, not every attribute.
+ */
+bool isEquivalent(const UA_Node& node, const UA_Node& shared) noexcept {
+    const auto& head = node.head;
+    if (head.nodeClass != shared.head.nodeClass || head.context != shared.head.context ||
+        head.constructed != shared.head.constructed ||
+        head.referencesSize != shared.head.referencesSize) {
+        return false;
+    }
+    for (size_t i = 0; i < head.referencesSize; ++i) {
+        const auto& refs = head.references[i];  // NOLINT
+        const auto& sharedRefs = shared.head.references[i];  // NOLINT
+        if (refs.referenceTypeIndex != sharedRefs.referenceTypeIndex ||
+            refs.isInverse != sharedRefs.isInverse || refs.targetsSize != sharedRefs.targetsSize) {
+            return false;
+        }
+    }
+    switch (head.nodeClass) {
+    case UA_NODECLASS_VARIABLE: {
+        const auto& var = node.variableNode;
+        const auto& sharedVar = shared.variableNode;
+        if (var.valueSource != sharedVar.valueSource) {
+            return false;
+        }
+        if (var.valueSource == UA_VALUESOURCE_DATASOURCE) {
+            return var.value.dataSource.read == sharedVar.value.dataSource.read &&
+                   var.value.dataSource.write == sharedVar.value.dataSource.write;
+        }
+        return var.value.data.callback.onRead == sharedVar.value.data.callback.onRead &&
+               var.value.data.callback.onWrite == sharedVar.value.data.callback.onWrite &&
+               UA_order(
+                   &var.value.data.value,
+                   &sharedVar.value.data.value,
+                   &UA_TYPES[UA_TYPES_DATAVALUE]
+               ) == UA_ORDER_EQ;
+    }
+    case UA_NODECLASS_METHOD:
+        return node.methodNode.method == shared.methodNode.method;
+    case UA_NODECLASS_OBJECTTYPE:
+        return node.objectTypeNode.lifecycle.constructor ==
+                   shared.objectTypeNode.lifecycle.constructor &&
+               node.objectTypeNode.lifecycle.destructor ==
+                   shared.objectTypeNode.lifecycle.destructor;
+    default:
+        return true;
+    }
+}
+
+class Nodestore {
+public:
+    Nodestore() {
+        // namespace 0 holds a few thousand nodes, avoid rehashes while it is built
+        namespaces_.resize(1);
+        namespaces_[0].reserve(4096);
+    }
+
+    ~Nodestore() {
+        for (auto& nodes : namespaces_) {
+            for (auto& [id, entry] : nodes) {
+                deleteEntry(entry);
+            }
+        }
+    }
+
+    Nodestore(const Nodestore&) = delete;
+    Nodestore(Nodestore&&) noexcept = delete;
+    Nodestore& operator=(const Nodestore&) = delete;
+    Nodestore& operator=(Nodestore&&) noexcept = delete;
+
+    NodeMap::iterator find(const UA_NodeId& id, NodeMap*& nodes) noexcept {
+        nodes = nullptr;
+        if (id.namespaceIndex >= namespaces_.size()) {
+            return {};
+        }
+        nodes = &namespaces_[id.namespaceIndex];
+        return nodes->find(asWrapper<NodeId>(id));
+    }
+
+    /// Find a node of the shared namespace 0 that is not replaced or removed by this server.
+    NodeEntry* findShared(const UA_NodeId& id) const noexcept {
+        if (sharedNamespaceZero_ == nullptr || id.namespaceIndex != 0) {
+            return nullptr;
+        }
+        const NodeId& key = asWrapper<NodeId>(id);
+        if (namespaces_[0].count(key) > 0 || removedShared_.count(key) > 0) {
+            return nullptr;
+        }
+        const auto it = sharedNamespaceZero_->nodes.find(key);
+        return it != sharedNamespaceZero_->nodes.end() ? it->second : nullptr;
+    }
+
+    NodeEntry* find(const UA_NodeId& id) noexcept {
+        NodeMap* nodes{};
+        const auto it = find(id, nodes);
+        return (nodes != nullptr && it != nodes->end()) ? it->second : findShared(id);
+    }
+
+    const UA_Node* getNode(const UA_NodeId& id) noexcept {
+        auto* entry = find(id);
+        if (entry == nullptr) {
+            return nullptr;
+        }
+        if (!entry->shared) {
+            ++entry->refCount;
+        }
+        return &entry->node;
+    }
+
+    static void releaseNode(const UA_Node* node) noexcept {
+        if (node == nullptr) {
+            return;
+        }
+        auto* entry = getEntry(node);
+        if (entry->shared) {
+            return;
+        }
+        --entry->refCount;
+        if (entry->refCount == 0 && entry->retired) {
+            deleteEntry(entry);
+        }
+    }
+
+    UA_StatusCode getNodeCopy(const UA_NodeId& id, UA_Node** outNode) noexcept {
+        const auto* entry = find(id);
+        if (entry == nullptr) {
+            return UA_STATUSCODE_BADNODEIDUNKNOWN;
+        }
+        auto* copy = createEntry(entry->node.head.nodeClass);
+        if (copy == nullptr) {
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        const auto status = UA_Node_copy(&entry->node, &copy->node);
+        if (status != UA_STATUSCODE_GOOD) {
+            deleteEntry(copy);
+            return status;
+        }
+        copy->orig = entry;
+        *outNode = &copy->node;
+        return UA_STATUSCODE_GOOD;
+    }
+
+    UA_StatusCode insertNode(NodeEntry* entry, UA_NodeId* addedNodeId) noexcept {
+        auto& id = entry->node.head.nodeId;
+        try {
+            if (id.namespaceIndex >= namespaces_.size()) {
+                namespaces_.resize(id.namespaceIndex + 1);
+            }
+            if (id.identifierType == UA_NODEIDTYPE_NUMERIC && id.identifier.numeric == 0) {
+                assignNumericId(id);
+            }
+            const bool inserted =
+                findShared(id) == nullptr &&
+                namespaces_[id.namespaceIndex].try_emplace(NodeId(id), entry).second;
+            if (!inserted) {
+                deleteEntry(entry);
+                return UA_STATUSCODE_BADNODEIDEXISTS;
+            }
+            if (sharedNamespaceZero_ != nullptr && id.namespaceIndex == 0) {
+                removedShared_.erase(asWrapper<NodeId>(id));
+            }
+            if (entry->node.head.nodeClass == UA_NODECLASS_REFERENCETYPE) {
+                const auto index = entry->node.referenceTypeNode.referenceTypeIndex;
+                if (index < referenceTypeIds_.size()) {
+                    referenceTypeIds_[index] = NodeId(id);
+                }
+            }
+        } catch (const std::exception&) {
+            deleteEntry(entry);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        if (addedNodeId != nullptr) {
+            const auto status = UA_NodeId_copy(&id, addedNodeId);
+            if (status != UA_STATUSCODE_GOOD) {
+                removeNode(id);
+                return status;
+            }
+        }
+        return UA_STATUSCODE_GOOD;
+    }
+
+    UA_StatusCode replaceNode(NodeEntry* entry) noexcept {
+        const auto& id = entry->node.head.nodeId;
+        NodeMap* nodes{};
+        const auto it = find(id, nodes);
+        const bool found = nodes != nullptr && it != nodes->end();
+        NodeEntry* current = found ? it->second : findShared(id);
+        if (current == nullptr || current != entry->orig) {
+            // node was removed or replaced since the copy was made
+            deleteEntry(entry);
+            return UA_STATUSCODE_BADINTERNALERROR;
+        }
+        entry->orig = nullptr;
+        if (found) {
+            it->second = entry;
+            retireEntry(current);
+            return UA_STATUSCODE_GOOD;
+        }
+        // copy-on-write of a shared node, the copy shadows the shared node
+        try {
+            nodes->emplace(NodeId(id), entry);
+        } catch (const std::exception&) {
+            deleteEntry(entry);
+            return UA_STATUSCODE_BADOUTOFMEMORY;
+        }
+        return UA_STATUSCODE_GOOD;
+    }
+
+    UA_StatusCode removeNode(const UA_NodeId& id) noexcept {
+        NodeMap* nodes{};
+        const auto it = find(id, nodes);
+        const bool found = nodes != nullptr && it != nodes->end();
+        const bool shared = sharedNamespaceZero_ != nullptr && id.namespaceIndex == 0 &&
+                            sharedNamespaceZero_->nodes.count(asWrapper<NodeId>(id)) > 0;
+        if (!found && findShared(id) == nullptr) {
+            return UA_STATUSCODE_BADNODEIDUNKNOWN;
+        }
+        if (shared) {
+            try {
+                removedShared_.insert(NodeId(id));
+            } catch (const std::exception&) {
+                return UA_STATUSCODE_BADOUTOFMEMORY;
+            }
+        }
+        if (found) {
+            NodeEntry* entry = it->second;
+            nodes->erase(it);
+            retireEntry(entry);
+        }
+        return UA_STATUSCODE_GOOD;
+    }
+
+    /**
+     * Share namespace 0 with the nodestores of other servers, called after namespace 0 was built.
+     * The first nodestore hands over its nodes to the shared namespace 0. Later nodestores drop
+     * their nodes that are equivalent to the shared nodes, the remaining nodes shadow the shared
+     * ones and shared nodes missing in this server are hidden.
+     */
+    void shareNamespaceZero() {
+        const std::lock_guard lock(sharedNamespaceZeroMutex);
+        auto& nodes = namespaces_[0];
+        auto shared = sharedNamespaceZero.lock();
+        if (shared == nullptr) {
+            auto created = std::make_shared<SharedNamespaceZero>();
+            for (auto& [id, entry] : nodes) {
+                entry->shared = true;
+            }
+            created->nodes.swap(nodes);
+            sharedNamespaceZero = created;
+            sharedNamespaceZero_ = std::move(created);
+            return;
+        }
+        std::unordered_set<NodeId> missing;
+        for (const auto& [id, entry] : shared->nodes) {
+            if (nodes.count(id) == 0) {
+                missing.insert(id);
+            }
+        }
+        for (auto it = nodes.begin(); it != nodes.end();) {
+            const auto sharedIt = shared->nodes.find(it->first);
+            if (sharedIt != shared->nodes.end() &&
+                isEquivalent(it->second->node, sharedIt->second->node)) {
+                retireEntry(it->second);
+                it = nodes.erase(it);
+            } else {
+                ++it;
+            }
+        }
+        nodes.rehash(0);
+        removedShared_ = std::move(missing);
+        sharedNamespaceZero_ = std::move(shared);
+    }
+
+    const UA_NodeId* getReferenceTypeId(UA_Byte index) const noexcept {
+        if (index >= referenceTypeIds_.size() || referenceTypeIds_[index].isNull()) {
+            return nullptr;
+        }
+        return referenceTypeIds_[index].handle();
+    }
+
+    void iterate(UA_NodestoreVisitor visitor, void* visitorContext) {
+        // snapshot, the visitor may remove nodes
+        size_t count = 0;
+        for (const auto& nodes : namespaces_) {
+            count += nodes.size();
+        }
+        if (sharedNamespaceZero_ != nullptr) {
+            count += sharedNamespaceZero_->nodes.size();
+        }
+        std::vector<NodeEntry*> entries;
+        entries.reserve(count);
+        for (auto& nodes : namespaces_) {
+            for (auto& [id, entry] : nodes) {
+                ++entry->refCount;
+                entries.push_back(entry);
+            }
+        }
+        if (sharedNamespaceZero_ != nullptr) {
+            for (const auto& [id, entry] : sharedNamespaceZero_->nodes) {
+                if (findShared(*id.handle()) != nullptr) {
+                    entries.push_back(entry);
+                }
+            }
+        }
+        for (auto* entry : entries) {
+            visitor(visitorContext, &entry->node);
+            releaseNode(&entry->node);
+        }
+    }
+
+private:
+    void assignNumericId(UA_NodeId& id) {
+        if (id.namespaceIndex >= nextNumericIds_.size()) {
+            nextNumericIds_.resize(id.namespaceIndex + 1, 50000);
+        }
+        auto& next = nextNumericIds_[id.namespaceIndex];
+        do {
+            id.identifier.numeric = next++;
+        } while (find(id) != nullptr);
+    }
+
+    std::vector<NodeMap> namespaces_;
+    std::shared_ptr<const SharedNamespaceZero> sharedNamespaceZero_;
+    std::unordered_set<NodeId> removedShared_;  // shared nodes removed by this server
+    std::vector<uint32_t> nextNumericIds_;
+    std::array<NodeId, UA_REFERENCETYPESET_MAX> referenceTypeIds_;
+};
+
+Nodestore& getNodestore(void* context) noexcept {
+    return *static_cast<Nodestore*>(context);
+}
+
+}  // namespace
+
+UA_StatusCode initReadOptimizedNodestore(UA_Nodestore& ns) {
+    try {
+        ns.context = new Nodestore;  // NOLINT(cppcoreguidelines-owning-memory)
+    } catch (const std::exception&) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    ns.clear = [](void* context) {
+        delete &getNodestore(context);  // NOLINT(cppcoreguidelines-owning-memory)
+    };
+    ns.newNode = [](void*, UA_NodeClass nodeClass) -> UA_Node* {
+        auto* entry = createEntry(nodeClass);
+        return entry != nullptr ? &entry->node : nullptr;
+    };
+    ns.deleteNode = [](void*, UA_Node* node) {
+        if (node != nullptr) {
+            deleteEntry(getEntry(node));
+        }
+    };
+    ns.getNode = [](void* context, const UA_NodeId* nodeId) {
+        return getNodestore(context).getNode(*nodeId);
+    };
+    ns.releaseNode = [](void*, const UA_Node* node) { Nodestore::releaseNode(node); };
+    ns.getNodeCopy = [](void* context, const UA_NodeId* nodeId, UA_Node** outNode) {
+        return getNodestore(context).getNodeCopy(*nodeId, outNode);
+    };
+    ns.insertNode = [](void* context, UA_Node* node, UA_NodeId* addedNodeId) {
+        return getNodestore(context).insertNode(getEntry(node), addedNodeId);
+    };
+    ns.replaceNode = [](void* context, UA_Node* node) {
+        return getNodestore(context).replaceNode(getEntry(node));
+    };
+    ns.removeNode = [](void* context, const UA_NodeId* nodeId) {
+        return getNodestore(context).removeNode(*nodeId);
+    };
+    ns.getReferenceTypeId = [](void* context, UA_Byte refTypeIndex) {
+        return getNodestore(context).getReferenceTypeId(refTypeIndex);
+    };
+    ns.iterate = [](void* context, UA_NodestoreVisitor visitor, void* visitorContext) {
+        try {
+            getNodestore(context).iterate(visitor, visitorContext);
+        } catch (const std::exception&) {
+            // out of memory for the snapshot, nothing visited
+        }
+    };
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode shareNamespaceZero(UA_Nodestore& ns) noexcept {
+    try {
+        getNodestore(ns.context).shareNamespaceZero();
+    } catch (const std::exception&) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace opcua::detail
+
+#endif
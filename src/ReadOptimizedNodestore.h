@@ -0,0 +1,33 @@
+#pragma once
+
+#include "open62541pp/Config.h"
+
+#include "open62541_impl.h"
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+
+namespace opcua::detail {
+
+/**
+ * Initialize a read-optimized nodestore (NodestoreType::ReadOptimized).
+ *
+ * The nodes are stored in a hash table per namespace. Readers hold reference counts instead of
+ * locks: replaced and removed nodes are retired and deleted with the last release, so nodes handed
+ * out by `getNode` stay valid and unchanged until they are released (similar to RCU).
+ * Edits are copy-on-write with the optimistic check of open62541 (`getNodeCopy` / `replaceNode`).
+ */
+UA_StatusCode initReadOptimizedNodestore(UA_Nodestore& ns);
+
+/**
+ * Share namespace 0 of a read-optimized nodestore with other servers of the process
+ * (NodestoreType::SharedNamespaceZero). Must be called after namespace 0 was built.
+ *
+ * The nodes of the shared namespace 0 are immutable and not reference counted. Edits create
+ * copies owned by the nodestore that shadow the shared nodes, removed nodes are hidden.
+ * The shared namespace 0 is deleted with the last nodestore using it.
+ */
+UA_StatusCode shareNamespaceZero(UA_Nodestore& ns) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
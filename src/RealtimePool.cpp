@@ -0,0 +1,346 @@
+#include "RealtimePool.h"
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+
+#include <algorithm>  // max
+#include <array>
+#include <atomic>
+#include <cmath>  // ceil
+#include <cstddef>
+#include <cstdio>  // fputs, stderr
+#include <cstdlib>  // abort, malloc, free, calloc, realloc
+#include <cstring>  // memcpy, memset
+#include <functional>  // less
+#include <limits>
+#include <memory>
+#include <mutex>  // lock_guard
+
+#include "open62541pp/ErrorHandling.h"
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+namespace {
+
+struct AllocatorHooks {
+    void* (*mallocFn)(size_t size);
+    void (*freeFn)(void* ptr);
+    void* (*callocFn)(size_t nelem, size_t elsize);
+    void* (*reallocFn)(void* ptr, size_t size);
+};
+
+/// Block sizes of the size classes: small values and notifications, item and session state,
+/// message chunks and network buffers (64 KiB default buffer size of open62541).
+constexpr std::array<size_t, 9> blockSizes{32, 64, 128, 256, 512, 1024, 4096, 16384, 65536};
+
+}  // namespace
+
+struct RealtimePool::State {
+    class SpinLock {
+    public:
+        void lock() noexcept {
+            while (flag_.test_and_set(std::memory_order_acquire)) {
+            }
+        }
+
+        void unlock() noexcept {
+            flag_.clear(std::memory_order_release);
+        }
+
+    private:
+        std::atomic_flag flag_ = ATOMIC_FLAG_INIT;
+    };
+
+    struct SizeClass {
+        size_t blockSize{0};
+        std::byte* begin{nullptr};
+        std::byte* end{nullptr};
+        void* freeList{nullptr};  // next pointer stored in the free blocks
+    };
+
+    std::unique_ptr<std::byte[]> slab;  // NOLINT
+    size_t slabSize{0};
+    std::array<SizeClass, blockSizes.size()> classes{};
+    SpinLock lock;
+    size_t blocksInUse{0};
+    bool orphaned{false};  // pool destroyed while blocks were in use
+
+    uint64_t warmupIterations{0};
+    RealtimeViolationAction violationAction{RealtimeViolationAction::Log};
+    std::atomic<uint64_t> iterations{0};
+    std::atomic<uint64_t> allocations{0};
+    std::atomic<uint64_t> misses{0};
+    std::atomic<uint64_t> violations{0};
+
+    bool contains(const void* ptr) const noexcept {
+        const auto* bytes = static_cast<const std::byte*>(ptr);
+        // compare with std::less to get a total order of unrelated pointers
+        return !std::less<>()(bytes, slab.get()) && std::less<>()(bytes, slab.get() + slabSize);
+    }
+
+    SizeClass& getClass(const void* ptr) noexcept {
+        const auto* bytes = static_cast<const std::byte*>(ptr);
+        for (auto& sizeClass : classes) {
+            if (std::less<>()(bytes, sizeClass.end)) {
+                return sizeClass;
+            }
+        }
+        return classes.back();
+    }
+
+    void* allocate(size_t size) noexcept {
+        const std::lock_guard guard(lock);
+        for (auto& sizeClass : classes) {
+            if (size <= sizeClass.blockSize && sizeClass.freeList != nullptr) {
+                void* block = sizeClass.freeList;
+                std::memcpy(&sizeClass.freeList, block, sizeof(void*));
+                ++blocksInUse;
+                return block;
+            }
+        }
+        return nullptr;
+    }
+
+    /// @return `true` if the orphaned pool can be deleted
+    bool deallocate(void* ptr) noexcept {
+        const std::lock_guard guard(lock);
+        auto& sizeClass = getClass(ptr);
+        std::memcpy(ptr, &sizeClass.freeList, sizeof(void*));
+        sizeClass.freeList = ptr;
+        --blocksInUse;
+        return orphaned && blocksInUse == 0;
+    }
+};
+
+namespace {
+
+constexpr size_t maxPools = 16;
+
+std::array<std::atomic<RealtimePool::State*>, maxPools> pools{};  // NOLINT
+thread_local RealtimePool::State* currentPool = nullptr;  // NOLINT
+thread_local bool currentVerifying = false;  // NOLINT
+AllocatorHooks previousHooks{std::malloc, std::free, std::calloc, std::realloc};  // NOLINT
+
+RealtimePool::State* findPool(const void* ptr) noexcept {
+    for (auto& entry : pools) {
+        auto* pool = entry.load(std::memory_order_acquire);
+        if (pool != nullptr && pool->contains(ptr)) {
+            return pool;
+        }
+    }
+    return nullptr;
+}
+
+void unregisterPool(RealtimePool::State* pool) noexcept {
+    for (auto& entry : pools) {
+        RealtimePool::State* expected = pool;
+        if (entry.compare_exchange_strong(expected, nullptr)) {
+            return;
+        }
+    }
+}
+
+void recordMiss(RealtimePool::State& pool) noexcept {
+    pool.misses.fetch_add(1, std::memory_order_relaxed);
+    if (!currentVerifying) {
+        return;
+    }
+    pool.violations.fetch_add(1, std::memory_order_relaxed);
+    if (pool.violationAction == RealtimeViolationAction::Count) {
+        return;
+    }
+    std::fputs("open62541pp: allocation in realtime server iteration\n", stderr);
+    if (pool.violationAction == RealtimeViolationAction::Abort) {
+        std::abort();
+    }
+}
+
+void releaseBlock(RealtimePool::State& pool, void* ptr) noexcept {
+    if (pool.deallocate(ptr)) {
+        unregisterPool(&pool);
+        delete &pool;  // NOLINT
+    }
+}
+
+void* realtimeMalloc(size_t size) {
+    if (auto* pool = currentPool) {
+        if (void* ptr = pool->allocate(size)) {
+            pool->allocations.fetch_add(1, std::memory_order_relaxed);
+            return ptr;
+        }
+        recordMiss(*pool);
+    }
+    return previousHooks.mallocFn(size);
+}
+
+void realtimeFree(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (auto* pool = findPool(ptr)) {
+        releaseBlock(*pool, ptr);
+        return;
+    }
+    previousHooks.freeFn(ptr);
+}
+
+void* realtimeCalloc(size_t nelem, size_t elsize) {
+    if (elsize != 0 && nelem > std::numeric_limits<size_t>::max() / elsize) {
+        return nullptr;
+    }
+    if (currentPool == nullptr) {
+        return previousHooks.callocFn(nelem, elsize);
+    }
+    void* ptr = realtimeMalloc(nelem * elsize);
+    if (ptr != nullptr) {
+        std::memset(ptr, 0, nelem * elsize);
+    }
+    return ptr;
+}
+
+void* realtimeRealloc(void* ptr, size_t size) {
+    if (ptr == nullptr) {
+        return realtimeMalloc(size);
+    }
+    auto* owner = findPool(ptr);
+    if (owner == nullptr) {
+        if (currentPool != nullptr) {
+            recordMiss(*currentPool);  // might allocate
+        }
+        return previousHooks.reallocFn(ptr, size);
+    }
+    const size_t blockSize = owner->getClass(ptr).blockSize;
+    if (size <= blockSize) {
+        return ptr;
+    }
+    void* result = realtimeMalloc(size);
+    if (result != nullptr) {
+        std::memcpy(result, ptr, blockSize);
+        releaseBlock(*owner, ptr);
+    }
+    return result;
+}
+
+void installHooks() noexcept {
+    if (UA_mallocSingleton == realtimeMalloc) {
+        return;
+    }
+    previousHooks = {
+        UA_mallocSingleton, UA_freeSingleton, UA_callocSingleton, UA_reallocSingleton
+    };
+    UA_mallocSingleton = realtimeMalloc;
+    UA_freeSingleton = realtimeFree;
+    UA_callocSingleton = realtimeCalloc;
+    UA_reallocSingleton = realtimeRealloc;
+}
+
+/// Estimated number of blocks per size class for the limits.
+std::array<size_t, blockSizes.size()> getBlockCounts(const RealtimeOptions& options) {
+    const double sessions = options.maxSessions;
+    const double items = options.maxMonitoredItems;
+    const double queue = std::max<uint32_t>(options.maxQueueSize, 1);
+    const std::array<double, blockSizes.size()> estimates{
+        items * (queue + 1) + 64 * sessions + 256,  // 32: values of notifications, strings
+        items * (queue + 1) + 64 * sessions + 256,  // 64: node ids, small variants
+        items * queue + 32 * sessions + 256,  // 128: queued notifications
+        items + 16 * sessions + 128,  // 256: sampled values, filters
+        items + 16 * sessions + 64,  // 512: monitored items
+        8 * sessions + 32,  // 1024: sessions, subscriptions
+        4 * sessions + 16,  // 4096: secure channels, publish responses
+        2 * sessions + 8,  // 16384: message chunks
+        4 * sessions + 8,  // 65536: send and receive buffers
+    };
+    std::array<size_t, blockSizes.size()> counts{};
+    for (size_t i = 0; i < counts.size(); ++i) {
+        counts[i] = static_cast<size_t>(std::ceil(estimates[i] * std::max(options.headroom, 0.0)));
+    }
+    return counts;
+}
+
+}  // namespace
+
+RealtimePool::RealtimePool(const RealtimeOptions& options)
+    : state_(new State) {  // NOLINT
+    std::unique_ptr<State> state(state_);
+    state->warmupIterations = options.warmupIterations;
+    state->violationAction = options.violationAction;
+
+    const auto counts = getBlockCounts(options);
+    for (size_t i = 0; i < counts.size(); ++i) {
+        state->slabSize += counts[i] * blockSizes[i];
+    }
+    state->slab.reset(new std::byte[std::max<size_t>(state->slabSize, 1)]);  // NOLINT
+    // touch all pages now, no page faults in steady state
+    std::memset(state->slab.get(), 0, state->slabSize);
+
+    std::byte* begin = state->slab.get();
+    for (size_t i = 0; i < counts.size(); ++i) {
+        auto& sizeClass = state->classes[i];
+        sizeClass.blockSize = blockSizes[i];
+        sizeClass.begin = begin;
+        sizeClass.end = begin + counts[i] * blockSizes[i];
+        for (size_t j = counts[i]; j > 0; --j) {
+            std::byte* block = begin + (j - 1) * blockSizes[i];
+            std::memcpy(block, &sizeClass.freeList, sizeof(void*));
+            sizeClass.freeList = block;
+        }
+        begin = sizeClass.end;
+    }
+
+    for (auto& entry : pools) {
+        State* expected = nullptr;
+        if (entry.compare_exchange_strong(expected, state.get())) {
+            installHooks();
+            state.release();  // NOLINT, owned by state_
+            return;
+        }
+    }
+    throw BadStatus(UA_STATUSCODE_BADRESOURCEUNAVAILABLE);
+}
+
+RealtimePool::~RealtimePool() {
+    {
+        const std::lock_guard guard(state_->lock);
+        if (state_->blocksInUse > 0) {
+            state_->orphaned = true;  // deleted with the last released block
+            return;
+        }
+    }
+    unregisterPool(state_);
+    delete state_;  // NOLINT
+}
+
+RealtimeStatistics RealtimePool::getStatistics() const noexcept {
+    RealtimeStatistics stats;
+    stats.poolBytes = state_->slabSize;
+    {
+        const std::lock_guard guard(state_->lock);
+        stats.blocksInUse = state_->blocksInUse;
+    }
+    stats.iterations = state_->iterations.load(std::memory_order_relaxed);
+    stats.poolAllocations = state_->allocations.load(std::memory_order_relaxed);
+    stats.poolMisses = state_->misses.load(std::memory_order_relaxed);
+    stats.violations = state_->violations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+RealtimePool::Scope::Scope(RealtimePool& pool) noexcept
+    : previous_(currentPool),
+      previousVerifying_(currentVerifying) {
+    auto& state = *pool.state_;
+    const uint64_t iteration = state.iterations.fetch_add(1, std::memory_order_relaxed) + 1;
+    // hooks are thread-local with UA_ENABLE_MULTITHREADING, install them in the server thread
+    installHooks();
+    currentPool = &state;
+    currentVerifying = iteration > state.warmupIterations;
+}
+
+RealtimePool::Scope::~Scope() {
+    currentPool = previous_;
+    currentVerifying = previousVerifying_;
+}
+
+}  // namespace opcua
+
+#endif
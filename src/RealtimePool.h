@@ -0,0 +1,60 @@
+#pragma once
+
+#include "open62541pp/Config.h"
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+
+#include "open62541pp/Realtime.h"
+
+namespace opcua {
+
+/**
+ * Preallocated pool of fixed-size blocks for the allocations of realtime server iterations.
+ *
+ * The pool is one contiguous slab, split into size classes with intrusive free lists. While a
+ * Scope is active in the current thread, open62541 allocations are served from the smallest size
+ * class with a free block, other allocations are forwarded to the previous allocator hooks and
+ * recorded as misses (violations after the warm-up). Blocks of the pool can be released by any
+ * thread, also outside of a scope; the free lists are guarded by a spin lock.
+ *
+ * The pool is kept alive after its destruction if blocks are still in use (e.g. values copied
+ * within callbacks that outlive the server), such blocks are never returned to the system.
+ */
+class RealtimePool {
+public:
+    struct State;
+
+    /// @exception BadStatus (BadResourceUnavailable) If too many pools exist
+    explicit RealtimePool(const RealtimeOptions& options);
+    ~RealtimePool();
+
+    RealtimePool(const RealtimePool&) = delete;
+    RealtimePool(RealtimePool&&) noexcept = delete;
+    RealtimePool& operator=(const RealtimePool&) = delete;
+    RealtimePool& operator=(RealtimePool&&) noexcept = delete;
+
+    /// Activate the pool in the current thread for one server iteration.
+    class Scope {
+    public:
+        explicit Scope(RealtimePool& pool) noexcept;
+        ~Scope();
+
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) noexcept = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) noexcept = delete;
+
+    private:
+        State* previous_;
+        bool previousVerifying_;
+    };
+
+    RealtimeStatistics getStatistics() const noexcept;
+
+private:
+    State* state_;  // owned unless blocks are in use on destruction
+};
+
+}  // namespace opcua
+
+#endif
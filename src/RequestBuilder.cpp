@@ -0,0 +1,82 @@
+#include "open62541pp/RequestBuilder.h"
+
+#include <cstddef>  // offsetof
+
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+static UA_String& getMember(UA_ReadValueId& item, size_t memberOffset) noexcept {
+    return *reinterpret_cast<UA_String*>(  // NOLINT
+        reinterpret_cast<uint8_t*>(&item) + memberOffset  // NOLINT
+    );
+}
+
+void ReadRequestBuilder::reserve(size_t items, size_t arenaBytes) {
+    items_.reserve(items);
+    relocations_.reserve(items);
+    arena_.reserve(arenaBytes);
+}
+
+ReadRequestBuilder& ReadRequestBuilder::add(
+    const NodeId& id,
+    AttributeId attributeId,
+    std::string_view indexRange,
+    const QualifiedName& dataEncoding
+) {
+    const size_t index = items_.size();
+    auto& item = items_.emplace_back();
+    item.nodeId = *id.handle();  // shallow copy, nested data is copied to the arena below
+    item.attributeId = static_cast<uint32_t>(attributeId);
+    item.dataEncoding.namespaceIndex = dataEncoding->namespaceIndex;
+
+    const auto type = item.nodeId.identifierType;
+    if (type == UA_NODEIDTYPE_STRING || type == UA_NODEIDTYPE_BYTESTRING) {
+        copyToArena(
+            index,
+            offsetof(UA_ReadValueId, nodeId) + offsetof(UA_NodeId, identifier),
+            id->identifier.string
+        );
+    }
+    const UA_String range{
+        indexRange.size(),
+        reinterpret_cast<UA_Byte*>(const_cast<char*>(indexRange.data()))  // NOLINT
+    };
+    copyToArena(index, offsetof(UA_ReadValueId, indexRange), range);
+    copyToArena(
+        index,
+        offsetof(UA_ReadValueId, dataEncoding) + offsetof(UA_QualifiedName, name),
+        dataEncoding->name
+    );
+    return *this;
+}
+
+void ReadRequestBuilder::copyToArena(size_t item, size_t memberOffset, const UA_String& str) {
+    auto& member = getMember(items_[item], memberOffset);
+    member = str;
+    if (str.length == 0) {
+        return;  // keep null or empty sentinel
+    }
+    const size_t arenaOffset = arena_.size();
+    arena_.insert(arena_.end(), str.data, str.data + str.length);  // NOLINT
+    member.data = nullptr;  // set by getItems
+    relocations_.push_back({item, memberOffset, arenaOffset});
+}
+
+Span<const ReadValueId> ReadRequestBuilder::getItems() noexcept {
+    for (const auto& relocation : relocations_) {
+        getMember(items_[relocation.item], relocation.memberOffset).data =
+            arena_.data() + relocation.arenaOffset;  // NOLINT
+    }
+    return {asWrapper<ReadValueId>(items_.data()), items_.size()};
+}
+
+void ReadRequestBuilder::clear() noexcept {
+    items_.clear();
+    arena_.clear();
+    relocations_.clear();
+}
+
+}  // namespace opcua
@@ -0,0 +1,431 @@
+#include "open62541pp/ReverseConnect.h"
+
+#include <algorithm>  // min
+#include <chrono>
+#include <cstddef>  // ptrdiff_t
+#include <mutex>
+#include <string_view>
+#include <unordered_map>
+#include <utility>  // move, swap
+
+#include "open62541pp/ErrorHandling.h"
+
+#include "ClientContext.h"
+#include "SocketConnection.h"
+#include "open62541_impl.h"
+
+#ifdef UAPP_SOCKET_CONNECTION
+#include <cerrno>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>  // TCP_NODELAY
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>  // close
+#endif
+
+namespace opcua {
+
+using Clock = std::chrono::steady_clock;
+
+/// Maximum wait period of an event loop iteration, e.g. to notice stop requests.
+static constexpr std::chrono::milliseconds maxWait{100};
+/// Maximum time to receive the ReverseHello message of an accepted connection.
+static constexpr std::chrono::seconds helloTimeout{5};
+/// Maximum size of a ReverseHello message (header, server URI, endpoint URL).
+static constexpr size_t maxHelloSize = 16384;
+
+struct ReverseConnectListener::Session {
+    enum class State {
+        Idle,  // waiting for the next reverse connect of the server
+        Connecting,
+        Activated,
+    };
+
+    ReverseHello hello;
+    std::unique_ptr<Client> client;
+    State state{State::Idle};
+    bool activated{false};  // session activated within the last iteration
+    bool failed{false};  // connection lost within the last iteration
+    Clock::time_point connectDeadline;
+    Clock::time_point nextProcess;
+};
+
+struct ReverseConnectListener::Worker {
+    std::mutex mutex;
+    std::vector<std::pair<int, ReverseHello>> accepted;  // guarded by mutex
+    std::unordered_map<std::string, std::unique_ptr<Session>> sessions;  // by server URI
+    std::thread thread;
+};
+
+ReverseConnectListener::ReverseConnectListener(
+    uint16_t port, size_t threads, ClientFactory factory
+)
+    : port_(port),
+      factory_(std::move(factory)) {
+    for (size_t i = 0; i < std::max<size_t>(threads, 1); ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+}
+
+ReverseConnectListener::~ReverseConnectListener() {
+    stop();
+}
+
+void ReverseConnectListener::onSessionActivated(SessionCallback callback) {
+    onSessionActivated_ = std::move(callback);
+}
+
+void ReverseConnectListener::onSessionClosed(SessionCallback callback) {
+    onSessionClosed_ = std::move(callback);
+}
+
+bool ReverseConnectListener::isRunning() const noexcept {
+    return running_;
+}
+
+uint16_t ReverseConnectListener::getPort() const noexcept {
+    return port_;
+}
+
+size_t ReverseConnectListener::getSessionCount() const noexcept {
+    return sessionCount_;
+}
+
+#ifdef UAPP_SOCKET_CONNECTION
+
+static void closeSocket(int fd) noexcept {
+    ::close(fd);
+}
+
+static int openListenSocket(uint16_t& port) {
+    // dual-stack IPv6 socket, fallback to IPv4
+    int fd = ::socket(AF_INET6, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    const int off = 0;
+    const int on = 1;
+    if (fd >= 0) {
+        ::setsockopt(fd, IPPROTO_IPV6, IPV6_V6ONLY, &off, sizeof(off));
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        sockaddr_in6 addr{};
+        addr.sin6_family = AF_INET6;
+        addr.sin6_addr = in6addr_any;
+        addr.sin6_port = htons(port);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            closeSocket(fd);
+            fd = -1;
+        }
+    }
+    if (fd < 0) {
+        fd = ::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0);
+        if (fd < 0) {
+            throw BadStatus(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        }
+        ::setsockopt(fd, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_addr.s_addr = htonl(INADDR_ANY);
+        addr.sin_port = htons(port);
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        if (::bind(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+            closeSocket(fd);
+            throw BadStatus(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        }
+    }
+    if (::listen(fd, SOMAXCONN) != 0) {
+        closeSocket(fd);
+        throw BadStatus(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+    }
+    sockaddr_storage addr{};
+    socklen_t addrLength = sizeof(addr);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &addrLength) == 0) {
+        // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+        port = ntohs(
+            addr.ss_family == AF_INET6 ? reinterpret_cast<sockaddr_in6*>(&addr)->sin6_port
+                                       : reinterpret_cast<sockaddr_in*>(&addr)->sin_port
+        );
+        // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+    }
+    return fd;
+}
+
+static uint32_t readUInt32(const uint8_t* data) noexcept {
+    return static_cast<uint32_t>(data[0]) | (static_cast<uint32_t>(data[1]) << 8U) |
+           (static_cast<uint32_t>(data[2]) << 16U) | (static_cast<uint32_t>(data[3]) << 24U);
+}
+
+static bool readString(std::string_view& data, std::string& result) {
+    if (data.size() < 4) {
+        return false;
+    }
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    const auto* bytes = reinterpret_cast<const uint8_t*>(data.data());
+    const auto length = static_cast<int32_t>(readUInt32(bytes));
+    data.remove_prefix(4);
+    if (length < 0) {
+        result.clear();  // null string
+        return true;
+    }
+    if (static_cast<size_t>(length) > data.size()) {
+        return false;
+    }
+    result = data.substr(0, static_cast<size_t>(length));
+    data.remove_prefix(static_cast<size_t>(length));
+    return true;
+}
+
+/// Parse a complete ReverseHello message (OPC UA Part 6, 7.1.2.6).
+static bool parseReverseHello(std::string_view message, ReverseHello& hello) {
+    if (message.substr(0, 4) != "RHEF") {
+        return false;
+    }
+    message.remove_prefix(8);  // message type, chunk type, message size
+    return readString(message, hello.serverUri) && readString(message, hello.endpointUrl) &&
+           !hello.endpointUrl.empty();
+}
+
+void ReverseConnectListener::start() {
+    if (running_) {
+        return;
+    }
+    listenFd_ = openListenSocket(port_);
+    running_ = true;
+    acceptor_ = std::thread([this] { accept(); });
+    for (auto& worker : workers_) {
+        worker->thread = std::thread([this, &worker = *worker] { run(worker); });
+    }
+}
+
+void ReverseConnectListener::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    acceptor_.join();
+    closeSocket(listenFd_);
+    listenFd_ = -1;
+    for (auto& worker : workers_) {
+        worker->thread.join();
+        for (auto& [fd, hello] : worker->accepted) {
+            closeSocket(fd);
+        }
+        worker->accepted.clear();
+        for (auto& [uri, session] : worker->sessions) {
+            session->client->disconnect();
+            session->state = Session::State::Idle;
+        }
+    }
+    sessionCount_ = 0;
+}
+
+/// Accept connections and receive their ReverseHello messages.
+void ReverseConnectListener::accept() {
+    struct Pending {
+        int fd;
+        std::string data;
+        Clock::time_point deadline;
+    };
+
+    std::vector<Pending> pending;
+    std::vector<pollfd> fds;
+    while (running_) {
+        fds.clear();
+        fds.push_back({listenFd_, POLLIN, 0});
+        for (const auto& p : pending) {
+            fds.push_back({p.fd, POLLIN, 0});
+        }
+        ::poll(fds.data(), fds.size(), static_cast<int>(maxWait.count()));
+
+        const auto now = Clock::now();
+        for (size_t i = pending.size(); i > 0; --i) {
+            auto& p = pending[i - 1];
+            bool done = false;
+            if (fds[i].revents != 0) {
+                char buffer[1024];  // NOLINT(*-avoid-c-arrays)
+                const ssize_t n = ::recv(p.fd, buffer, sizeof(buffer), 0);
+                if (n > 0) {
+                    p.data.append(buffer, static_cast<size_t>(n));
+                } else if (n == 0 || (errno != EINTR && errno != EAGAIN)) {
+                    done = true;  // closed by the server
+                }
+            }
+            if (!done && p.data.size() >= 8) {
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                const size_t size = readUInt32(reinterpret_cast<const uint8_t*>(p.data.data() + 4));
+                ReverseHello hello;
+                if (size < 8 || size > maxHelloSize) {
+                    done = true;
+                } else if (p.data.size() >= size) {
+                    done = true;
+                    if (parseReverseHello({p.data.data(), size}, hello)) {
+                        ::fcntl(p.fd, F_SETFL, ::fcntl(p.fd, F_GETFL) & ~O_NONBLOCK);
+                        dispatch(p.fd, std::move(hello));
+                        p.fd = -1;
+                    }
+                }
+            }
+            if (done || now > p.deadline) {
+                if (p.fd >= 0) {
+                    closeSocket(p.fd);
+                }
+                pending.erase(pending.begin() + static_cast<ptrdiff_t>(i - 1));
+            }
+        }
+
+        if (fds[0].revents & POLLIN) {
+            const int fd = ::accept4(listenFd_, nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+            if (fd >= 0) {
+                const int on = 1;
+                ::setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+                pending.push_back({fd, {}, now + helloTimeout});
+            }
+        }
+    }
+    for (const auto& p : pending) {
+        closeSocket(p.fd);
+    }
+}
+
+/// Pass an accepted connection to the event loop thread of the server.
+void ReverseConnectListener::dispatch(int fd, ReverseHello hello) {
+    const size_t index = std::hash<std::string>{}(hello.serverUri) % workers_.size();
+    auto& worker = *workers_[index];
+    const std::lock_guard lock(worker.mutex);
+    worker.accepted.emplace_back(fd, std::move(hello));
+}
+
+void ReverseConnectListener::connect(Session& session, int fd) {
+    auto& client = *session.client;
+    auto& context = client.getContext();
+    session.failed = false;
+    session.activated = false;
+    session.state = Session::State::Connecting;
+    session.connectDeadline =
+        Clock::now() + std::chrono::milliseconds(UA_Client_getConfig(client.handle())->timeout);
+    session.nextProcess = Clock::now();
+    context.reverseSocketFd = fd;
+    const auto status = UA_Client_connectAsync(client.handle(), session.hello.endpointUrl.c_str());
+    if (context.reverseSocketFd >= 0) {
+        closeSocket(std::exchange(context.reverseSocketFd, -1));  // not consumed
+    }
+    session.failed = detail::isBadStatus(status);
+}
+
+void ReverseConnectListener::run(Worker& worker) {
+    std::vector<std::pair<int, ReverseHello>> accepted;
+    std::vector<pollfd> fds;
+    std::vector<Session*> polled;
+    while (running_) {
+        {
+            const std::lock_guard lock(worker.mutex);
+            std::swap(accepted, worker.accepted);
+        }
+        for (auto& [fd, hello] : accepted) {
+            auto& session = worker.sessions[hello.serverUri];
+            if (session == nullptr) {
+                session = std::make_unique<Session>();
+                session->client = factory_ ? factory_(hello) : std::make_unique<Client>();
+                auto& ref = *session;
+                ref.client->onSessionActivated([&ref] { ref.activated = true; });
+                ref.client->onDisconnected([&ref] { ref.failed = true; });
+                ref.client->onSessionClosed([&ref] { ref.failed = true; });
+            }
+            if (session->state != Session::State::Idle) {
+                closeSocket(fd);  // duplicate connection of a connected server
+                continue;
+            }
+            session->hello = std::move(hello);
+            connect(*session, fd);
+        }
+        accepted.clear();
+
+        auto now = Clock::now();
+        auto wake = now + maxWait;
+        fds.clear();
+        polled.clear();
+        for (auto& [uri, session] : worker.sessions) {
+            if (session->state == Session::State::Idle) {
+                continue;
+            }
+            const int fd = session->client->getSocketFd();
+            if (fd >= 0) {
+                fds.push_back({fd, POLLIN, 0});
+                polled.push_back(session.get());
+            }
+            wake = std::min(wake, session->nextProcess);
+        }
+        const auto timeout = std::max<int64_t>(
+            std::chrono::ceil<std::chrono::milliseconds>(wake - now).count(), 0
+        );
+        ::poll(fds.data(), fds.size(), static_cast<int>(timeout));
+        for (size_t i = 0; i < fds.size(); ++i) {
+            if (fds[i].revents != 0) {
+                polled[i]->nextProcess = Clock::time_point::min();  // ready
+            }
+        }
+
+        now = Clock::now();
+        for (auto& [uri, session] : worker.sessions) {
+            if (session->state == Session::State::Idle) {
+                continue;
+            }
+            if (now >= session->nextProcess) {
+                try {
+                    session->client->processEvents();
+                } catch (const BadStatus&) {
+                    session->failed = true;
+                }
+                session->nextProcess = now + session->client->getNextTimeout();
+            }
+            if (session->activated && !session->failed) {
+                session->activated = false;
+                session->state = Session::State::Activated;
+                ++sessionCount_;
+                if (onSessionActivated_) {
+                    detail::invokeCatchIgnore(
+                        onSessionActivated_, *session->client, session->hello
+                    );
+                }
+            }
+            if (session->state == Session::State::Connecting && now > session->connectDeadline) {
+                session->failed = true;
+            }
+            if (session->failed) {
+                // wait for the next reverse connect of the server
+                if (session->state == Session::State::Activated) {
+                    --sessionCount_;
+                    if (onSessionClosed_) {
+                        detail::invokeCatchIgnore(
+                            onSessionClosed_, *session->client, session->hello
+                        );
+                    }
+                }
+                session->client->disconnect();
+                session->state = Session::State::Idle;
+                session->failed = false;
+                session->activated = false;
+            }
+        }
+    }
+}
+
+#else
+
+void ReverseConnectListener::start() {
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+
+void ReverseConnectListener::stop() {}
+
+void ReverseConnectListener::accept() {}
+
+void ReverseConnectListener::run(Worker& /* worker */) {}
+
+void ReverseConnectListener::dispatch(int /* fd */, ReverseHello /* hello */) {}
+
+void ReverseConnectListener::connect(Session& /* session */, int /* fd */) {}
+
+#endif
+
+}  // namespace opcua
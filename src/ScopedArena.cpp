@@ -0,0 +1,178 @@
+#include "open62541pp/ScopedArena.h"
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+
+#include <algorithm>  // any_of, max, min
+#include <cstdlib>  // malloc, free, calloc, realloc
+#include <cstring>  // memcpy, memset
+#include <functional>  // less
+#include <limits>
+#include <new>  // bad_alloc
+#include <utility>  // move
+
+#include "open62541_impl.h"
+
+namespace opcua {
+
+// each allocation is prefixed with its size (required for realloc), keep max alignment
+constexpr size_t headerSize = alignof(std::max_align_t);
+static_assert(headerSize >= sizeof(size_t));
+
+static thread_local ScopedArena* currentArena = nullptr;  // NOLINT
+
+static size_t alignSize(size_t size) noexcept {
+    return (size + headerSize - 1) / headerSize * headerSize;
+}
+
+static size_t getAllocationSize(const void* ptr) noexcept {
+    size_t size{};
+    std::memcpy(&size, static_cast<const std::byte*>(ptr) - headerSize, sizeof(size_t));
+    return size;
+}
+
+ScopedArena::ScopedArena(size_t blockSize)
+    : blockSize_(std::max(blockSize, headerSize)),
+      previous_(currentArena),
+      previousHooks_{
+          UA_mallocSingleton, UA_freeSingleton, UA_callocSingleton, UA_reallocSingleton
+      } {
+    currentArena = this;
+    UA_mallocSingleton = arenaMalloc;
+    UA_freeSingleton = arenaFree;
+    UA_callocSingleton = arenaCalloc;
+    UA_reallocSingleton = arenaRealloc;
+}
+
+ScopedArena::~ScopedArena() {
+    currentArena = previous_;
+    UA_mallocSingleton = previousHooks_.mallocFn;
+    UA_freeSingleton = previousHooks_.freeFn;
+    UA_callocSingleton = previousHooks_.callocFn;
+    UA_reallocSingleton = previousHooks_.reallocFn;
+}
+
+size_t ScopedArena::getAllocatedBytes() const noexcept {
+    return allocatedBytes_;
+}
+
+bool ScopedArena::contains(const void* ptr) const noexcept {
+    const auto* bytes = static_cast<const std::byte*>(ptr);
+    return std::any_of(blocks_.begin(), blocks_.end(), [&](const Block& block) {
+        // compare with std::less to get a total order of unrelated pointers
+        return !std::less<>()(bytes, block.data.get()) &&
+               std::less<>()(bytes, block.data.get() + block.used);
+    });
+}
+
+ScopedArena* ScopedArena::getCurrent() noexcept {
+    return currentArena;
+}
+
+void* ScopedArena::allocate(size_t size) {
+    if (size > std::numeric_limits<size_t>::max() - 2 * headerSize) {
+        return nullptr;
+    }
+    const size_t required = headerSize + alignSize(size);
+    if (blocks_.empty() || blocks_.back().size - blocks_.back().used < required) {
+        // oversized allocations get their own block
+        const size_t newBlockSize = std::max(blockSize_, required);
+        // avoid value-initialization of std::make_unique
+        std::unique_ptr<std::byte[]> data(new std::byte[newBlockSize]);  // NOLINT
+        blocks_.push_back({std::move(data), newBlockSize, 0});
+    }
+    auto& block = blocks_.back();
+    std::byte* header = block.data.get() + block.used;
+    std::memcpy(header, &size, sizeof(size_t));
+    block.used += required;
+    allocatedBytes_ += required;
+    return header + headerSize;
+}
+
+ScopedArena* ScopedArena::findOwner(const void* ptr) noexcept {
+    for (auto* arena = this; arena != nullptr; arena = arena->previous_) {
+        if (arena->contains(ptr)) {
+            return arena;
+        }
+    }
+    return nullptr;
+}
+
+const ScopedArena::AllocatorHooks& ScopedArena::getFallbackHooks() const noexcept {
+    static constexpr AllocatorHooks defaultHooks{std::malloc, std::free, std::calloc, std::realloc};
+    const auto* arena = this;
+    while (arena->previous_ != nullptr) {
+        arena = arena->previous_;
+    }
+    // hooks are shared by all threads (not thread-local) and were installed by another thread
+    if (arena->previousHooks_.mallocFn == arenaMalloc) {
+        return defaultHooks;
+    }
+    return arena->previousHooks_;
+}
+
+void* ScopedArena::arenaMalloc(size_t size) {
+    if (currentArena == nullptr) {
+        return std::malloc(size);  // NOLINT, hooks of another thread (not thread-local)
+    }
+    try {
+        return currentArena->allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+}
+
+void ScopedArena::arenaFree(void* ptr) {
+    if (ptr == nullptr) {
+        return;
+    }
+    if (currentArena == nullptr) {
+        std::free(ptr);  // NOLINT
+        return;
+    }
+    if (currentArena->findOwner(ptr) != nullptr) {
+        return;  // released with the arena
+    }
+    currentArena->getFallbackHooks().freeFn(ptr);
+}
+
+void* ScopedArena::arenaCalloc(size_t nelem, size_t elsize) {
+    if (elsize != 0 && nelem > std::numeric_limits<size_t>::max() / elsize) {
+        return nullptr;
+    }
+    if (currentArena == nullptr) {
+        return std::calloc(nelem, elsize);  // NOLINT
+    }
+    void* ptr = arenaMalloc(nelem * elsize);
+    if (ptr != nullptr) {
+        std::memset(ptr, 0, nelem * elsize);
+    }
+    return ptr;
+}
+
+void* ScopedArena::arenaRealloc(void* ptr, size_t size) {
+    if (currentArena == nullptr) {
+        return std::realloc(ptr, size);  // NOLINT
+    }
+    if (ptr == nullptr) {
+        return arenaMalloc(size);
+    }
+    auto* owner = currentArena->findOwner(ptr);
+    if (owner == nullptr) {
+        return currentArena->getFallbackHooks().reallocFn(ptr, size);
+    }
+    // allocate from the owning arena, memory of an outer arena must outlive the inner arenas
+    void* result = nullptr;
+    try {
+        result = owner->allocate(size);
+    } catch (const std::bad_alloc&) {
+        return nullptr;
+    }
+    if (result != nullptr) {
+        std::memcpy(result, ptr, std::min(size, getAllocationSize(ptr)));
+    }
+    return result;
+}
+
+}  // namespace opcua
+
+#endif
@@ -1,30 +1,67 @@
 #include "open62541pp/Server.h"
 
+#include <algorithm>  // copy, min, max, remove
+#include <array>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstddef>
+#include <cstdint>
+#include <cstring>  // memcpy, memset
+#include <fstream>
+#include <functional>
 #include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <type_traits>  // remove_cv_t, remove_reference_t
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>  // move
 
 #include "open62541pp/AccessControl.h"
+#include "open62541pp/CachedClock.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/EventStream.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
+#include "open62541pp/Nodeset.h"
+#include "open62541pp/PubSub.h"
 #include "open62541pp/Session.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/Tracer.h"
+#include "open62541pp/TypeConverter.h"  // guessDataType
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/detail/helper.h"  // toNativeString
 #include "open62541pp/ValueBackend.h"
+#include "open62541pp/ValuePublisher.h"
+#include "open62541pp/overloads/comparison.h"  // operator==
 #include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+#include "open62541pp/services/View.h"  // browseRecursive
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/Variant.h"
 
+#include "AsyncMethodDispatcher.h"
 #include "CustomAccessControl.h"
 #include "CustomDataTypes.h"
 #include "CustomLogger.h"
+#include "EpollNetworkLayer.h"
+#include "InProcessConnection.h"
+#include "NodeProfiler.h"
+#include "ReadOptimizedNodestore.h"
 #include "ServerContext.h"
+#include "SharedMemoryTransport.h"
+#include "VirtualNodestore.h"
+#include "detail/EventStreamState.h"
+#include "detail/MpscQueue.h"
 #include "open62541_impl.h"
 
 namespace opcua {
@@ -41,20 +78,75 @@ inline static UA_ServerConfig* getConfig(Server* server) noexcept {
 
 /* ----------------------------------------- Connection ----------------------------------------- */
 
+static UA_Server* createServer(NodestoreType nodestore) {
+    if (nodestore == NodestoreType::Default) {
+        return UA_Server_new();
+    }
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+    UA_ServerConfig config;
+    std::memset(&config, 0, sizeof(UA_ServerConfig));
+    detail::throwOnBadStatus(detail::initReadOptimizedNodestore(config.nodestore));
+    // the default nodestore is only initialized if no nodestore is set
+    const auto status = UA_ServerConfig_setBasics(&config);
+    if (status != UA_STATUSCODE_GOOD) {
+        UA_ServerConfig_clean(&config);
+        throw BadStatus(status);
+    }
+    UA_Server* server = UA_Server_newWithConfig(&config);
+    if (server != nullptr && nodestore == NodestoreType::SharedNamespaceZero) {
+        const auto shareStatus = detail::shareNamespaceZero(getConfig(server)->nodestore);
+        if (shareStatus != UA_STATUSCODE_GOOD) {
+            UA_Server_delete(server);
+            throw BadStatus(shareStatus);
+        }
+    }
+    return server;
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
 class Server::Connection {
 public:
-    explicit Connection(Server& server)
-        : server_(UA_Server_new()),
+    Connection(Server& server, NodestoreType nodestore)
+        : server_(createServer(nodestore)),
           customAccessControl_(server),
           customDataTypes_(&getConfig(server_)->customDataTypes),
-          customLogger_(getConfig(server_)->logger) {}
+          customLogger_(getConfig(server_)->logger) {
+#ifdef UAPP_IN_PROCESS_CONNECTION
+        context_.inProcessHub = std::make_shared<detail::InProcessHub>(
+            server_, [this](std::function<void()> command) { post(std::move(command)); }
+        );
+#endif
+    }
 
     ~Connection() {
         // don't use stop method here because it might throw an exception
-        if (running_) {
+        running_ = false;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
+        setCachedClock(false);
+#ifdef UAPP_ASYNC_METHODS
+        if (context_.asyncMethodDispatcher != nullptr) {
+            context_.asyncMethodDispatcher->stop();
+        }
+#endif
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+        for (auto& eventStream : context_.eventStreams) {
+            eventStream->close();  // delete event nodes while the server exists
+        }
+#endif
+        if (started_) {
             UA_Server_run_shutdown(handle());
         }
+#ifdef UAPP_IN_PROCESS_CONNECTION
+        context_.inProcessHub->detach();
+#endif
         UA_Server_delete(handle());
+        for (auto& nl : context_.defaultNetworkLayers) {
+            nl.clear(&nl);
+        }
     }
 
     // prevent copy & move
@@ -66,14 +158,36 @@ public:
     void runStartup() {
         const auto status = UA_Server_run_startup(handle());
         detail::throwOnBadStatus(status);
+        started_ = true;
         running_ = true;
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+        // wake up a waiting iteration for queued commands, e.g. messages of in-process clients
+        auto* config = getConfig(handle());
+        for (size_t i = 0; i < config->networkLayersSize; ++i) {
+            if (detail::getEpollFd(config->networkLayers[i]) >= 0) {
+                wakeupLayer_ = &config->networkLayers[i];
+                break;
+            }
+        }
+#endif
     }
 
     uint16_t runIterate() {
         if (!running_) {
             runStartup();
         }
-        return UA_Server_run_iterate(handle(), false /* don't wait */);
+        processCommands();
+        return iterate(false /* don't wait */);
+    }
+
+    uint16_t iterate(bool waitInternal) {
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+        if (context_.realtimePool != nullptr) {
+            const RealtimePool::Scope scope(*context_.realtimePool);
+            return UA_Server_run_iterate(handle(), waitInternal);
+        }
+#endif
+        return UA_Server_run_iterate(handle(), waitInternal);
     }
 
     void run() {
@@ -81,25 +195,136 @@ public:
             return;
         }
         runStartup();
+        runLoop();
+    }
+
+    void runLoop() {
         const std::lock_guard<std::mutex> lock(mutex_);
         while (running_) {
+            processCommands();
             // https://github.com/open62541/open62541/blob/master/examples/server_mainloop.c
-            UA_Server_run_iterate(handle(), true /* wait for messages in the networklayer */);
+            iterate(true /* wait for messages in the networklayer */);
         }
+        processCommands();
+    }
+
+    void runInBackground(uint16_t commandIntervalMilliseconds) {
+        if (running_) {
+            return;
+        }
+        runStartup();
+        try {
+            // wake up the network layer periodically to process queued commands
+            const auto status = UA_Server_addRepeatedCallback(
+                handle(),
+                [](UA_Server*, void* data) noexcept {
+                    static_cast<Connection*>(data)->processCommands();
+                },
+                this,
+                commandIntervalMilliseconds,
+                &commandCallbackId_
+            );
+            detail::throwOnBadStatus(status);
+            thread_ = std::thread([this] {
+                applyThreadConfig(getContext().eventLoopThreadConfig);
+                runLoop();
+            });
+        } catch (...) {
+            abortStartup();
+            throw;
+        }
+    }
+
+    /// Undo runStartup if the event loop could not be started.
+    void abortStartup() noexcept {
+        running_ = false;
+        started_ = false;
+        wakeupLayer_ = nullptr;
+        if (commandCallbackId_ != 0) {
+            UA_Server_removeRepeatedCallback(handle(), commandCallbackId_);
+            commandCallbackId_ = 0;
+        }
+        UA_Server_run_shutdown(handle());
     }
 
     void stop() {
         running_ = false;
+        if (thread_.joinable()) {
+            thread_.join();
+        }
         // wait for run loop to complete
         const std::lock_guard<std::mutex> lock(mutex_);
+        wakeupLayer_ = nullptr;
+        if (commandCallbackId_ != 0) {
+            UA_Server_removeRepeatedCallback(handle(), commandCallbackId_);
+            commandCallbackId_ = 0;
+        }
+        started_ = false;
         const auto status = UA_Server_run_shutdown(handle());
         detail::throwOnBadStatus(status);
     }
 
+    void post(std::function<void()> command) {
+        commands_.push(std::move(command));
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+        if (auto* nl = wakeupLayer_.load(); nl != nullptr) {
+            detail::wakeupEpollNetworkLayer(*nl);
+        }
+#endif
+    }
+
+    void processCommands() noexcept {
+        if (cachedClock_) {
+            CachedClock::update();
+        }
+        std::function<void()> command;
+        while (commands_.pop(command)) {
+            detail::invokeCatchIgnore(command);
+        }
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+        if (!context_.sharedValues.empty()) {
+            context_.sharedValues.clear();
+        }
+        processPublishedValueChanges();
+#endif
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    /// Sample the event-driven monitored items of nodes changed by value publishers.
+    void processPublishedValueChanges() noexcept {
+        if (context_.eventDrivenMonitoredItems.empty()) {
+            return;
+        }
+        for (const auto& publisher : context_.valuePublishers) {
+            if (!publisher->pending.exchange(false, std::memory_order_acquire)) {
+                continue;
+            }
+            for (size_t i = 0; i < publisher->ids.size(); ++i) {
+                if (publisher->changed[i].exchange(false, std::memory_order_relaxed)) {
+                    detail::sampleEventDrivenMonitoredItems(
+                        customAccessControl_.getServer(), publisher->ids[i]
+                    );
+                }
+            }
+        }
+    }
+#endif
+
     bool isRunning() const noexcept {
         return running_;
     }
 
+    void setCachedClock(bool enabled) noexcept {
+        if (cachedClock_.exchange(enabled) == enabled) {
+            return;
+        }
+        if (enabled) {
+            CachedClock::addSource();
+        } else {
+            CachedClock::removeSource();
+        }
+    }
+
     UA_Server* handle() noexcept {
         return server_;
     }
@@ -131,7 +356,13 @@ private:
     CustomDataTypes customDataTypes_;
     CustomLogger customLogger_;
     std::atomic<bool> running_{false};
+    std::atomic<bool> cachedClock_{false};
+    bool started_{false};
     std::mutex mutex_;
+    std::thread thread_;
+    uint64_t commandCallbackId_{0};
+    detail::MpscQueue<std::function<void()>> commands_;
+    std::atomic<UA_ServerNetworkLayer*> wakeupLayer_{nullptr};  // NetworkBackend::Epoll only
 };
 
 /* ------------------------------------------- Server ------------------------------------------- */
@@ -146,14 +377,15 @@ static void applyDefaults(UA_ServerConfig* config) {
 #endif
 }
 
-Server::Server(uint16_t port, ByteString certificate)
-    : connection_(std::make_shared<Connection>(*this)) {
+Server::Server(uint16_t port, ByteString certificate, NodestoreType nodestore)
+    : connection_(std::make_shared<Connection>(*this, nodestore)) {
     const auto status = UA_ServerConfig_setMinimal(
         getConfig(this), port, certificate.empty() ? nullptr : certificate.handle()
     );
     detail::throwOnBadStatus(status);
     applyDefaults(getConfig(this));
     setAccessControl(std::make_unique<AccessControlDefault>());
+    getContext().port = port;
 }
 
 #ifdef UA_ENABLE_ENCRYPTION
@@ -163,9 +395,10 @@ Server::Server(
     const ByteString& privateKey,
     Span<const ByteString> trustList,
     Span<const ByteString> issuerList,
-    Span<const ByteString> revocationList
+    Span<const ByteString> revocationList,
+    NodestoreType nodestore
 )
-    : connection_(std::make_shared<Connection>(*this)) {
+    : connection_(std::make_shared<Connection>(*this, nodestore)) {
     const auto status = UA_ServerConfig_setDefaultWithSecurityPolicies(
         getConfig(this),
         port,
@@ -181,6 +414,7 @@ Server::Server(
     detail::throwOnBadStatus(status);
     applyDefaults(getConfig(this));
     setAccessControl(std::make_unique<AccessControlDefault>());
+    getContext().port = port;
 }
 #endif
 
@@ -188,6 +422,10 @@ void Server::setLogger(Logger logger) {
     connection_->getCustomLogger().setLogger(std::move(logger));
 }
 
+void Server::setLogger(Logger logger, const LoggerOptions& options) {
+    connection_->getCustomLogger().setLogger(std::move(logger), options);
+}
+
 // copy to endpoints needed, see: https://github.com/open62541/open62541/issues/1175
 static void copyApplicationDescriptionToEndpoints(UA_ServerConfig* config) {
     for (size_t i = 0; i < config->endpointsSize; ++i) {
@@ -196,6 +434,330 @@ static void copyApplicationDescriptionToEndpoints(UA_ServerConfig* config) {
     }
 }
 
+static void mergeSocketOptions(TransportConfig& options, const TransportConfig& config) noexcept {
+    if (config.noDelay) {
+        options.noDelay = config.noDelay;
+    }
+    if (config.socketSendBufferSize) {
+        options.socketSendBufferSize = config.socketSendBufferSize;
+    }
+    if (config.socketRecvBufferSize) {
+        options.socketRecvBufferSize = config.socketRecvBufferSize;
+    }
+}
+
+static void applyTransportConfig(UA_ConnectionConfig& native, const TransportConfig& config) {
+    if (config.sendBufferSize) {
+        native.sendBufferSize = *config.sendBufferSize;
+    }
+    if (config.recvBufferSize) {
+        native.recvBufferSize = *config.recvBufferSize;
+    }
+    if (config.maxMessageSize) {
+        native.localMaxMessageSize = *config.maxMessageSize;
+    }
+    if (config.maxChunkCount) {
+        native.localMaxChunkCount = *config.maxChunkCount;
+    }
+}
+
+void Server::setSecureChannelOptions(const SecureChannelOptions& options) {
+    auto* config = getConfig(this);
+    TransportConfig transport;
+    transport.sendBufferSize = options.chunkSize;
+    transport.recvBufferSize = options.chunkSize;
+    transport.maxMessageSize = options.maxMessageSize;
+    transport.maxChunkCount = options.maxChunkCount;
+    for (size_t i = 0; i < config->networkLayersSize; ++i) {
+        applyTransportConfig(config->networkLayers[i].localConnectionConfig, transport);
+    }
+    if (options.lifetime) {
+        config->maxSecurityTokenLifetime = *options.lifetime;
+    }
+}
+
+void Server::setTransportConfig(const TransportConfig& config) {
+    auto* native = getConfig(this);
+    auto& socketOptions = getContext().socketOptions;
+    mergeSocketOptions(socketOptions, config);
+    for (size_t i = 0; i < native->networkLayersSize; ++i) {
+        applyTransportConfig(native->networkLayers[i].localConnectionConfig, config);
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+        detail::setEpollSocketOptions(native->networkLayers[i], socketOptions);
+#endif
+    }
+}
+
+/// Update an advertised operation limit (values are written to namespace 0 on server creation).
+static void writeOperationLimit(Server& server, VariableId id, uint32_t value) {
+    const auto variant = Variant::fromScalar(value);
+    UA_Server_writeValue(server.handle(), NodeId(id), variant);  // ignore missing nodes
+}
+
+void Server::setLimits(const ServerLimits& limits) {
+    auto* config = getConfig(this);
+    const auto apply = [&](const std::optional<uint32_t>& limit, UA_UInt32& value, VariableId id) {
+        if (limit.has_value()) {
+            value = *limit;
+            writeOperationLimit(*this, id, *limit);
+        }
+    };
+    using Id = VariableId;
+    apply(
+        limits.maxNodesPerRead,
+        config->maxNodesPerRead,
+        Id::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead
+    );
+    apply(
+        limits.maxNodesPerWrite,
+        config->maxNodesPerWrite,
+        Id::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite
+    );
+    apply(
+        limits.maxNodesPerBrowse,
+        config->maxNodesPerBrowse,
+        Id::Server_ServerCapabilities_OperationLimits_MaxNodesPerBrowse
+    );
+    apply(
+        limits.maxNodesPerMethodCall,
+        config->maxNodesPerMethodCall,
+        Id::Server_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall
+    );
+    apply(
+        limits.maxNodesPerTranslateBrowsePaths,
+        config->maxNodesPerTranslateBrowsePathsToNodeIds,
+        Id::Server_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds
+    );
+    apply(
+        limits.maxNodesPerNodeManagement,
+        config->maxNodesPerNodeManagement,
+        Id::Server_ServerCapabilities_OperationLimits_MaxNodesPerNodeManagement
+    );
+    apply(
+        limits.maxMonitoredItemsPerCall,
+        config->maxMonitoredItemsPerCall,
+        Id::Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall
+    );
+
+    if (limits.maxSecureChannels.has_value()) {
+        config->maxSecureChannels = *limits.maxSecureChannels;
+    }
+    if (limits.maxSessions.has_value()) {
+        config->maxSessions = *limits.maxSessions;
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    const auto set = [](const std::optional<uint32_t>& limit, UA_UInt32& value) {
+        if (limit.has_value()) {
+            value = *limit;
+        }
+    };
+#if UAPP_OPEN62541_VER_GE(1, 1)
+    set(limits.maxSubscriptions, config->maxSubscriptions);
+    set(limits.maxMonitoredItems, config->maxMonitoredItems);
+    const UA_UInt32 maxMonitoredItems = config->maxMonitoredItems;
+#else
+    const UA_UInt32 maxMonitoredItems = limits.maxMonitoredItems.value_or(0);
+#endif
+    set(limits.maxSubscriptionsPerSession, config->maxSubscriptionsPerSession);
+    set(limits.maxMonitoredItemsPerSubscription, config->maxMonitoredItemsPerSubscription);
+    set(limits.maxPublishRequestsPerSession, config->maxPublishReqPerSession);
+    set(limits.maxNotificationsPerPublish, config->maxNotificationsPerPublish);
+    set(limits.maxMonitoredItemQueueSize, config->queueSizeLimits.max);
+
+    if (limits.monitoredItemQueueMemory.has_value()) {
+        if (maxMonitoredItems == 0) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        const size_t perItem = *limits.monitoredItemQueueMemory / maxMonitoredItems;
+        const size_t queueSize = perItem / std::max<size_t>(limits.estimatedNotificationSize, 1);
+        if (queueSize == 0) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        auto& range = config->queueSizeLimits;
+        if (range.max == 0 || queueSize < range.max) {
+            range.max = static_cast<UA_UInt32>(std::min<size_t>(queueSize, UINT32_MAX));
+        }
+        range.min = std::min(range.min, range.max);
+    }
+#endif
+}
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+void Server::enableRealtime(const RealtimeOptions& options) {
+    if (isRunning()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    ServerLimits limits;
+    limits.maxSecureChannels = options.maxSessions;
+    limits.maxSessions = options.maxSessions;
+    limits.maxMonitoredItems = options.maxMonitoredItems;
+    limits.maxMonitoredItemQueueSize = options.maxQueueSize;
+    setLimits(limits);
+    getContext().realtimePool = std::make_unique<RealtimePool>(options);
+}
+
+RealtimeStatistics Server::getRealtimeStatistics() const {
+    const auto& pool = connection_->getContext().realtimePool;
+    if (pool == nullptr) {
+        return {};
+    }
+    return pool->getStatistics();
+}
+#endif
+
+/// Number of TCP network layers, shared memory layers are appended after them.
+static size_t getTcpLayerCount(const UA_ServerConfig* config) noexcept {
+    size_t count = config->networkLayersSize;
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+    while (count > 0 && detail::isSharedMemoryNetworkLayer(config->networkLayers[count - 1])) {
+        --count;
+    }
+#endif
+    return count;
+}
+
+void Server::setNetworkBackend(NetworkBackend backend) {
+    if (isRunning()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    auto* config = getConfig(this);
+    auto& defaultLayers = getContext().defaultNetworkLayers;
+    const bool isDefault = defaultLayers.empty();
+    if (backend == NetworkBackend::Default) {
+        if (isDefault) {
+            return;
+        }
+        for (size_t i = 0; i < defaultLayers.size(); ++i) {
+            // keep transport config changes of the replaced layers
+            defaultLayers[i].localConnectionConfig = config->networkLayers[i].localConnectionConfig;
+            config->networkLayers[i].clear(&config->networkLayers[i]);
+            config->networkLayers[i] = defaultLayers[i];
+        }
+        defaultLayers.clear();
+        return;
+    }
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    if (!isDefault) {
+        return;
+    }
+    std::vector<UA_ServerNetworkLayer> layers(getTcpLayerCount(config));
+    for (size_t i = 0; i < layers.size(); ++i) {
+        const auto status = detail::initEpollNetworkLayer(
+            layers[i], getContext().port, config->networkLayers[i].localConnectionConfig
+        );
+        if (status == UA_STATUSCODE_GOOD) {
+            detail::setEpollSocketOptions(layers[i], getContext().socketOptions);
+        }
+        if (status != UA_STATUSCODE_GOOD) {
+            for (size_t j = 0; j < i; ++j) {
+                layers[j].clear(&layers[j]);
+            }
+            throw BadStatus(status);
+        }
+    }
+    defaultLayers.assign(config->networkLayers, config->networkLayers + layers.size());
+    std::copy(layers.begin(), layers.end(), config->networkLayers);
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+int Server::getNetworkFd() const noexcept {
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    const auto* config = UA_Server_getConfig(const_cast<UA_Server*>(handle()));  // NOLINT
+    for (size_t i = 0; i < config->networkLayersSize; ++i) {
+        const int fd = detail::getEpollFd(config->networkLayers[i]);
+        if (fd >= 0) {
+            return fd;
+        }
+    }
+#endif
+    return -1;
+}
+
+void Server::addSharedMemoryTransport(
+    [[maybe_unused]] std::string_view name, [[maybe_unused]] const SharedMemoryOptions& options
+) {
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+    if (isRunning()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    auto* config = getConfig(this);
+    // same transport config (buffer and message sizes) as the TCP network layer
+    const UA_ConnectionConfig connectionConfig = config->networkLayersSize > 0
+        ? config->networkLayers[0].localConnectionConfig
+        : UA_ConnectionConfig_default;
+    UA_ServerNetworkLayer layer{};
+    detail::throwOnBadStatus(
+        detail::initSharedMemoryNetworkLayer(layer, name, options, connectionConfig)
+    );
+    auto* layers = static_cast<UA_ServerNetworkLayer*>(UA_realloc(
+        config->networkLayers, (config->networkLayersSize + 1) * sizeof(UA_ServerNetworkLayer)
+    ));
+    if (layers == nullptr) {
+        layer.clear(&layer);
+        throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+    }
+    config->networkLayers = layers;
+    config->networkLayers[config->networkLayersSize++] = layer;
+
+    if (options.exclusive) {
+        const size_t tcpLayers = getTcpLayerCount(config);
+        for (size_t i = 0; i < tcpLayers; ++i) {
+            config->networkLayers[i].clear(&config->networkLayers[i]);
+        }
+        std::copy(
+            config->networkLayers + tcpLayers,
+            config->networkLayers + config->networkLayersSize,
+            config->networkLayers
+        );
+        config->networkLayersSize -= tcpLayers;
+        // layers replaced by NetworkBackend::Epoll
+        auto& defaultLayers = getContext().defaultNetworkLayers;
+        for (auto& nl : defaultLayers) {
+            nl.clear(&nl);
+        }
+        defaultLayers.clear();
+    }
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+/// First epoll network layer of the server, reverse connects require NetworkBackend::Epoll.
+static UA_ServerNetworkLayer& getEpollNetworkLayer(Server& server) {
+    auto* config = getConfig(&server);
+    for (size_t i = 0; i < config->networkLayersSize; ++i) {
+        if (detail::getEpollFd(config->networkLayers[i]) >= 0) {
+            return config->networkLayers[i];
+        }
+    }
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+}
+#endif
+
+uint64_t Server::addReverseConnect([[maybe_unused]] std::string_view clientUrl) {
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    uint64_t id = 0;
+    detail::throwOnBadStatus(
+        detail::addEpollReverseConnect(getEpollNetworkLayer(*this), clientUrl, id)
+    );
+    return id;
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+void Server::removeReverseConnect([[maybe_unused]] uint64_t id) {
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    detail::throwOnBadStatus(detail::removeEpollReverseConnect(getEpollNetworkLayer(*this), id));
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
 void Server::setCustomHostname(std::string_view hostname) {
     auto& ref = asWrapper<String>(getConfig(this)->customHostname);
     ref = String(hostname);
@@ -227,36 +789,435 @@ void Server::setAccessControl(std::unique_ptr<AccessControlBase> accessControl)
     connection_->getCustomAccessControl().setAccessControl(std::move(accessControl));
 }
 
+void Server::setAccessControlCaching(bool enabled) {
+    connection_->getCustomAccessControl().setCaching(enabled);
+}
+
+void Server::invalidateAccessControlCache() {
+    connection_->getCustomAccessControl().invalidateCache();
+}
+
+void Server::invalidateAccessControlCache(const NodeId& sessionId) {
+    connection_->getCustomAccessControl().invalidateCache(sessionId);
+}
+
+void Server::setRequestPolicy(RequestPolicy policy) {
+    connection_->getCustomAccessControl().setRequestPolicy(std::move(policy));
+}
+
 std::vector<Session> Server::getSessions() const {
     return connection_->getCustomAccessControl().getSessions();
 }
 
+#ifdef UAPP_HAS_PMR
+std::pmr::vector<Session> Server::getSessions(std::pmr::memory_resource* resource) const {
+    return connection_->getCustomAccessControl().getSessions(resource);
+}
+#endif
+
+size_t Server::getSessionCount() const noexcept {
+    return connection_->getCustomAccessControl().getSessionCount();
+}
+
+void Server::forEachSessionImpl(void* callback, void (*invoke)(void*, Session&)) {
+    for (const auto& [id, context] : getContext().sessions) {
+        Session session(*this, id);
+        invoke(callback, session);
+    }
+}
+
 std::vector<std::string> Server::getNamespaceArray() {
-    return services::readValue(*this, {0, UA_NS0ID_SERVER_NAMESPACEARRAY})
-        .getArrayCopy<std::string>();
+    static constexpr NumericNodeId namespaceArrayId(VariableId::Server_NamespaceArray);
+    return services::readValue(*this, namespaceArrayId).getArrayCopy<std::string>();
+}
+
+std::shared_ptr<const NamespaceTable> Server::getNamespaceTable() {
+    auto& table = getContext().namespaceTable;
+    if (table == nullptr) {
+        table = std::make_shared<const NamespaceTable>(getNamespaceArray());
+    }
+    return table;
 }
 
 uint16_t Server::registerNamespace(std::string_view uri) {
-    return UA_Server_addNamespace(handle(), std::string(uri).c_str());
+    const auto index = UA_Server_addNamespace(handle(), std::string(uri).c_str());
+    auto& table = getContext().namespaceTable;
+    if (table != nullptr && !table->getUri(index).has_value()) {
+        table = nullptr;  // new namespace, refresh with the next access
+    }
+    return index;
+}
+
+services::NodeBatchResult Server::loadNodeset(std::string_view filepath) {
+    std::ifstream stream(std::string(filepath), std::ios::binary);
+    if (!stream) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    if (detail::isNodesetBinary(stream)) {
+        return loadNodeset(readNodesetBinary(stream));
+    }
+    return loadNodeset(readNodesetXml(stream));
+}
+
+/// Register the namespaces of the nodeset and map them to the namespace indices of the server.
+static void registerNamespaces(Server& server, Nodeset& nodeset) {
+    std::vector<uint16_t> indices{0};
+    indices.reserve(nodeset.namespaceUris.size() + 1);
+    bool identity = true;
+    for (const auto& uri : nodeset.namespaceUris) {
+        indices.push_back(server.registerNamespace(uri));
+        identity = identity && indices.back() == indices.size() - 1;
+    }
+    if (!identity) {
+        nodeset.remapNamespaces(indices);
+    }
+}
+
+services::NodeBatchResult Server::loadNodeset(Nodeset nodeset) {
+    registerNamespaces(*this, nodeset);
+    return services::addNodes(*this, nodeset.nodes);
+}
+
+namespace {
+
+/// Attributes compared by Server::applyModel, the node class is read to detect replaced nodes.
+constexpr std::array modelAttributes{
+    AttributeId::NodeClass,
+    AttributeId::DisplayName,
+    AttributeId::Description,
+    AttributeId::Value,
+};
+
+/// Verbs of the ModelChangeStructureDataType.
+constexpr uint8_t verbNodeAdded = 1;
+constexpr uint8_t verbNodeDeleted = 2;
+constexpr uint8_t verbReferenceAdded = 4;
+
+}  // namespace
+
+/// Get the decoded attributes of a node definition.
+/// All attribute types start with the fields of UA_NodeAttributes.
+static const UA_NodeAttributes* getModelAttributes(const AddNodesItem& item) noexcept {
+    const auto& attributes = item->nodeAttributes;
+    if (attributes.encoding < UA_EXTENSIONOBJECT_DECODED) {
+        return nullptr;
+    }
+    return static_cast<const UA_NodeAttributes*>(attributes.content.decoded.data);
+}
+
+static const UA_Variant* getModelValue(const AddNodesItem& item) noexcept {
+    const auto& attributes = item->nodeAttributes;
+    if (attributes.encoding < UA_EXTENSIONOBJECT_DECODED ||
+        attributes.content.decoded.type != &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]) {
+        return nullptr;
+    }
+    const auto* native = static_cast<const UA_VariableAttributes*>(attributes.content.decoded.data);
+    if ((native->specifiedAttributes & UA_NODEATTRIBUTESMASK_VALUE) == 0) {
+        return nullptr;
+    }
+    return &native->value;
+}
+
+static bool isEqualModelValue(const UA_Variant& lhs, const UA_Variant& rhs) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    return UA_order(&lhs, &rhs, &UA_TYPES[UA_TYPES_VARIANT]) == UA_ORDER_EQ;
+#else
+    // no generic comparison available, write every value
+    (void)lhs;
+    (void)rhs;
+    return false;
+#endif
+}
+
+/// Compare the attributes of an existing node with the model and collect the writes.
+/// @return `true` if at least one attribute differs
+static bool diffModelAttributes(
+    const NodeId& id,
+    const AddNodesItem& item,
+    Span<const DataValue> current,
+    std::vector<WriteValue>& nodesToWrite
+) {
+    const size_t count = nodesToWrite.size();
+    const auto write = [&](AttributeId attributeId, Variant value) {
+        DataValue dv;
+        dv.setValue(std::move(value));
+        nodesToWrite.emplace_back(id, attributeId, "", std::move(dv));
+    };
+    const auto differs = [&](size_t index, const auto& expected) {
+        using T = std::remove_cv_t<std::remove_reference_t<decltype(expected)>>;
+        const auto& dv = current[index];
+        if (!dv.hasValue() || !dv.getValue().isType(detail::guessDataType<T>())) {
+            return true;
+        }
+        return !(*static_cast<const T*>(dv.getValue().data()) == expected);
+    };
+    if (const auto* attributes = getModelAttributes(item); attributes != nullptr) {
+        const auto mask = attributes->specifiedAttributes;
+        if ((mask & UA_NODEATTRIBUTESMASK_DISPLAYNAME) != 0 &&
+            differs(1, attributes->displayName)) {
+            write(AttributeId::DisplayName, Variant::fromScalar(attributes->displayName));
+        }
+        if ((mask & UA_NODEATTRIBUTESMASK_DESCRIPTION) != 0 &&
+            differs(2, attributes->description)) {
+            write(AttributeId::Description, Variant::fromScalar(attributes->description));
+        }
+    }
+    if (const auto* value = getModelValue(item); value != nullptr) {
+        const auto& dv = current[3];
+        if (!dv.hasValue() || !isEqualModelValue(*dv.getValue().handle(), *value)) {
+            write(AttributeId::Value, asWrapper<Variant>(*value));
+        }
+    }
+    return nodesToWrite.size() > count;
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+static void triggerModelChangeEvent(
+    Server& server, const ModelChanges& changes, const services::NodeBatch& added
+) {
+    std::vector<UA_ModelChangeStructureDataType> structures;  // shallow copies
+    for (const auto& id : changes.deletedNodes) {
+        structures.push_back({*id.handle(), UA_NODEID_NULL, verbNodeDeleted});
+    }
+    for (size_t i = 0; i < added.getNodes().size(); ++i) {
+        const auto& item = added.getNodes()[i];
+        if (changes.addResult.nodeStatusCodes[i].isGood()) {
+            structures.push_back({
+                *changes.addResult.nodeIds[i].handle(),
+                item->typeDefinition.nodeId,
+                verbNodeAdded,
+            });
+        }
+    }
+    for (size_t i = 0; i < added.getReferences().size(); ++i) {
+        const auto& item = added.getReferences()[i];
+        if (changes.addResult.referenceStatusCodes[i].isGood()) {
+            structures.push_back({item->sourceNodeId, UA_NODEID_NULL, verbReferenceAdded});
+        }
+    }
+    if (structures.empty()) {
+        return;
+    }
+    server.createEvent(ObjectTypeId::GeneralModelChangeEventType)
+        .writeSourceName("Server")
+        .writeProperty(
+            QualifiedName(0, "Changes"),
+            Variant::fromArray(Span<const UA_ModelChangeStructureDataType>(structures))
+        )
+        .trigger(ObjectId::Server);
+}
+#endif
+
+ModelChanges Server::applyModel(const NodeId& rootId, Nodeset model) {
+    registerNamespaces(*this, model);
+
+    std::unordered_map<NodeId, size_t> desired;  // node id -> index of the definition
+    const auto definitions = model.nodes.getNodes();
+    for (size_t i = 0; i < definitions.size(); ++i) {
+        desired.try_emplace(definitions[i].getRequestedNewNodeId().getNodeId(), i);
+    }
+
+    std::vector<NodeId> existing;
+    const BrowseDescription bd(
+        rootId, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+    );
+    for (const auto& child : services::browseRecursive(*this, bd)) {
+        if (child.isLocal() && child.getNodeId().getNamespaceIndex() != 0) {
+            existing.push_back(child.getNodeId());
+        }
+    }
+
+    // read the compared attributes of all existing nodes with a single call
+    std::vector<ReadValueId> nodesToRead;
+    nodesToRead.reserve(existing.size() * modelAttributes.size());
+    for (const auto& id : existing) {
+        for (const auto attributeId : modelAttributes) {
+            nodesToRead.emplace_back(id, attributeId);
+        }
+    }
+    const auto values = services::readAttributes(*this, nodesToRead);
+
+    ModelChanges changes;
+    std::vector<bool> keep(definitions.size(), false);
+    std::vector<NodeId> nodesToDelete;
+    std::vector<WriteValue> nodesToWrite;
+    for (size_t i = 0; i < existing.size(); ++i) {
+        const auto& id = existing[i];
+        const auto current = Span(values).subview(
+            i * modelAttributes.size(), modelAttributes.size()
+        );
+        const auto it = desired.find(id);
+        if (it == desired.end()) {
+            nodesToDelete.push_back(id);
+            continue;
+        }
+        const auto& item = definitions[it->second];
+        const auto& nodeClass = current[0];
+        if (!nodeClass.hasValue() || !nodeClass.getValue().isType(UA_TYPES[UA_TYPES_NODECLASS]) ||
+            *static_cast<const NodeClass*>(nodeClass.getValue().data()) != item.getNodeClass()) {
+            nodesToDelete.push_back(id);  // replaced
+            continue;
+        }
+        keep[it->second] = true;
+        if (diffModelAttributes(id, item, current, nodesToWrite)) {
+            changes.updatedNodes.push_back(id);
+        }
+    }
+
+    if (!nodesToWrite.empty()) {
+        for (const auto& status : services::writeAttributes(*this, nodesToWrite)) {
+            detail::throwOnBadStatus(status);
+        }
+    }
+
+    const auto deleteResults = services::deleteNodes(*this, Span<const NodeId>(nodesToDelete));
+    for (size_t i = 0; i < nodesToDelete.size(); ++i) {
+        // children might have been deleted with their parent already
+        const auto status = deleteResults[i];
+        if (status == UA_STATUSCODE_GOOD) {
+            changes.deletedNodes.push_back(nodesToDelete[i]);
+        } else if (status != UA_STATUSCODE_BADNODEIDUNKNOWN) {
+            detail::throwOnBadStatus(status);
+        }
+    }
+    if (!changes.deletedNodes.empty()) {
+        // model nodes below a replaced node are deleted with their parent, add them again
+        for (size_t i = 0; i < definitions.size(); ++i) {
+            const auto& id = definitions[i].getRequestedNewNodeId().getNodeId();
+            UA_NodeClass nodeClass{};
+            if (keep[i] &&
+                UA_Server_readNodeClass(handle(), id, &nodeClass) != UA_STATUSCODE_GOOD) {
+                keep[i] = false;
+                changes.updatedNodes.erase(
+                    std::remove(changes.updatedNodes.begin(), changes.updatedNodes.end(), id),
+                    changes.updatedNodes.end()
+                );
+            }
+        }
+    }
+
+    services::NodeBatch added;
+    std::unordered_set<NodeId> addedIds;
+    for (size_t i = 0; i < definitions.size(); ++i) {
+        if (!keep[i]) {
+            added.addNode(definitions[i]);
+            addedIds.insert(definitions[i].getRequestedNewNodeId().getNodeId());
+        }
+    }
+    for (const auto& reference : model.nodes.getReferences()) {
+        if (addedIds.count(reference.getSourceNodeId()) != 0 ||
+            addedIds.count(reference.getTargetNodeId().getNodeId()) != 0) {
+            added.addReference(reference);
+        }
+    }
+    if (!added.getNodes().empty() || !added.getReferences().empty()) {
+        changes.addResult = services::addNodes(*this, added);
+        for (size_t i = 0; i < added.getNodes().size(); ++i) {
+            if (changes.addResult.nodeStatusCodes[i].isGood()) {
+                changes.addedNodes.push_back(changes.addResult.nodeIds[i]);
+            }
+        }
+    }
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+    triggerModelChangeEvent(*this, changes, added);
+#endif
+    return changes;
+}
+
+void Server::addVirtualNodes(
+    const NodeId& folderId,
+    uint16_t namespaceIndex,
+    std::shared_ptr<VirtualNodeProvider> provider,
+    size_t cacheSize
+) {
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+    if (namespaceIndex == 0 || provider == nullptr || cacheSize == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    // keep the node profiler as the outermost decorator
+    auto& nodestore = detail::unwrapNodeProfiler(getConfig(this)->nodestore);
+    const auto roots = provider->getRootNodes();
+    detail::addVirtualNodeProvider(nodestore, namespaceIndex, std::move(provider), cacheSize);
+    detail::mountVirtualNodes(nodestore, folderId, roots);
+#else
+    (void)folderId;
+    (void)namespaceIndex;
+    (void)provider;
+    (void)cacheSize;
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+size_t Server::getVirtualNodeCount(uint16_t namespaceIndex) {
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+    return detail::getVirtualNodeCount(
+        detail::unwrapNodeProfiler(getConfig(this)->nodestore), namespaceIndex
+    );
+#else
+    (void)namespaceIndex;
+    return 0;
+#endif
+}
+
+void Server::writeSnapshot(std::string_view filepath) {
+    auto nodeset = exportNodeset(*this);
+    std::ofstream stream(std::string(filepath), std::ios::binary | std::ios::trunc);
+    if (!stream) {
+        throw BadStatus(UA_STATUSCODE_BADNOTFOUND);
+    }
+    writeNodesetBinary(nodeset, stream);
+}
+
+services::NodeBatchResult Server::restoreSnapshot(
+    std::string_view filepath,
+    Span<const std::pair<NodeId, ValueCallback>> valueCallbacks,
+    Span<const std::pair<NodeId, ValueBackendDataSource>> dataSources
+) {
+    auto result = loadNodeset(filepath);
+    setVariableNodeValueBackends(dataSources);
+    for (const auto& [id, callback] : valueCallbacks) {
+        setVariableNodeValueCallback(id, callback);
+    }
+    return result;
 }
 
 void Server::setCustomDataTypes(std::vector<DataType> dataTypes) {
     connection_->getCustomDataTypes().setCustomDataTypes(std::move(dataTypes));
 }
 
+void Server::setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry) {
+    connection_->getCustomDataTypes().setRegistry(std::move(registry));
+}
+
 static void valueCallbackOnRead(
     [[maybe_unused]] UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext,
-    [[maybe_unused]] const UA_NodeId* nodeId,
+    const UA_NodeId* nodeId,
     void* nodeContext,
     [[maybe_unused]] const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& cb = static_cast<ServerContext::NodeContext*>(nodeContext)->valueCallback.onBeforeRead;
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& cb = context->valueCallback.onBeforeRead;
     if (cb) {
-        detail::invokeCatchIgnore([&] { cb(asWrapper<DataValue>(*value)); });
+        const auto minRefreshAge = context->valueCallback.minRefreshAge;
+        if (minRefreshAge.count() > 0) {
+            const auto now = Statistics::Clock::now();
+            if (now - context->valueCallbackTimestamp < minRefreshAge) {
+                return;
+            }
+            context->valueCallbackTimestamp = now;
+        }
+        // status is ignored, exceptions are caught
+        context->server->invokeNodeCallback(
+            StatisticsCallback::ValueCallback,
+            "ValueCallback",
+            nodeId,
+            [&] { cb(asWrapper<DataValue>(*value)); }
+        );
     }
 }
 
@@ -264,22 +1225,32 @@ static void valueCallbackOnWrite(
     [[maybe_unused]] UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext,
-    [[maybe_unused]] const UA_NodeId* nodeId,
+    const UA_NodeId* nodeId,
     void* nodeContext,
     [[maybe_unused]] const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& cb = static_cast<ServerContext::NodeContext*>(nodeContext)->valueCallback.onAfterWrite;
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& cb = context->valueCallback.onAfterWrite;
     if (cb) {
-        detail::invokeCatchIgnore([&] { cb(asWrapper<DataValue>(*value)); });
+        // status is ignored, exceptions are caught
+        context->server->invokeNodeCallback(
+            StatisticsCallback::ValueCallback,
+            "ValueCallback",
+            nodeId,
+            [&] { cb(asWrapper<DataValue>(*value)); }
+        );
     }
 }
 
 void Server::setVariableNodeValueCallback(const NodeId& id, ValueCallback callback) {
     auto* nodeContext = getContext().getOrCreateNodeContext(id);
     nodeContext->valueCallback = std::move(callback);
+    nodeContext->valueCallbackTimestamp = {};
+    nodeContext->valueCallbackGroup = nullptr;
     detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), id, nodeContext));
+    getContext().eraseTypedDataSource(id);
 
     UA_ValueCallback callbackNative;
     callbackNative.onRead = valueCallbackOnRead;
@@ -287,26 +1258,95 @@ void Server::setVariableNodeValueCallback(const NodeId& id, ValueCallback callba
     detail::throwOnBadStatus(UA_Server_setVariableNode_valueCallback(handle(), id, callbackNative));
 }
 
+static void valueCallbackGroupOnRead(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    const UA_NodeId* nodeId,
+    void* nodeContext,
+    [[maybe_unused]] const UA_NumericRange* range,
+    [[maybe_unused]] const UA_DataValue* value
+) noexcept {
+    assert(nodeContext != nullptr);
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& group = *context->valueCallbackGroup;
+    if (group.refreshing) {
+        return;
+    }
+    const size_t index = context->valueCallbackGroupIndex;
+    const auto now = Statistics::Clock::now();
+    const auto age = now - group.timestamp;
+    const bool refresh = !group.valid || age > group.callbacks.maxAge ||
+                         (group.served[index] && age >= group.callbacks.minRefreshAge);
+    if (refresh) {
+        group.served.assign(group.ids.size(), false);
+        group.timestamp = now;
+        group.valid = true;
+        auto& cb = group.callbacks.onBeforeRead;
+        if (cb) {
+            group.refreshing = true;
+            // status is ignored, exceptions are caught
+            context->server->invokeNodeCallback(
+                StatisticsCallback::ValueCallback,
+                "ValueCallbackGroup",
+                nodeId,
+                [&] { cb(Span<const NodeId>(group.ids)); }
+            );
+            group.refreshing = false;
+        }
+    }
+    group.served[index] = true;
+}
+
+void Server::setVariableNodeValueCallbackGroup(
+    Span<const NodeId> ids, ValueCallbackGroup callbacks
+) {
+    auto state = std::make_unique<ServerContext::ValueCallbackGroupState>();
+    state->callbacks = std::move(callbacks);
+    state->ids.assign(ids.begin(), ids.end());
+    state->served.assign(ids.size(), false);
+    auto* statePtr = getContext().valueCallbackGroups.emplace_back(std::move(state)).get();
+
+    UA_ValueCallback callbackNative{};
+    callbackNative.onRead = valueCallbackGroupOnRead;
+    getContext().reserveNodeContexts(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto* nodeContext = getContext().getOrCreateNodeContext(ids[i]);
+        nodeContext->valueCallback = {};
+        nodeContext->valueCallbackGroup = statePtr;
+        nodeContext->valueCallbackGroupIndex = i;
+        detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), ids[i], nodeContext));
+        getContext().eraseTypedDataSource(ids[i]);
+        detail::throwOnBadStatus(
+            UA_Server_setVariableNode_valueCallback(handle(), ids[i], callbackNative)
+        );
+    }
+}
+
 inline static NumericRange asRange(const UA_NumericRange* range) noexcept {
-    return range == nullptr ? NumericRange() : NumericRange(*range);
+    return range == nullptr || range->dimensionsSize == 0 ? NumericRange() : NumericRange(*range);
 }
 
 static UA_StatusCode valueSourceRead(
     [[maybe_unused]] UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext,
-    [[maybe_unused]] const UA_NodeId* nodeId,
+    const UA_NodeId* nodeId,
     void* nodeContext,
     UA_Boolean includeSourceTimestamp,
     const UA_NumericRange* range,
     UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& callback = static_cast<ServerContext::NodeContext*>(nodeContext)->dataSource.read;
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& callback = context->dataSource.read;
     if (callback) {
-        return detail::invokeCatchStatus([&] {
-            callback(asWrapper<DataValue>(*value), asRange(range), includeSourceTimestamp);
-        });
+        return context->server->invokeNodeCallback(
+            StatisticsCallback::DataSource,
+            "DataSource",
+            nodeId,
+            [&] { callback(asWrapper<DataValue>(*value), asRange(range), includeSourceTimestamp); }
+        );
     }
     return UA_STATUSCODE_BADINTERNALERROR;
 }
@@ -315,42 +1355,564 @@ static UA_StatusCode valueSourceWrite(
     [[maybe_unused]] UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext,
-    [[maybe_unused]] const UA_NodeId* nodeId,
+    const UA_NodeId* nodeId,
     void* nodeContext,
     const UA_NumericRange* range,
     const UA_DataValue* value
 ) noexcept {
     assert(nodeContext != nullptr && value != nullptr);
-    auto& callback = static_cast<ServerContext::NodeContext*>(nodeContext)->dataSource.write;
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& callback = context->dataSource.write;
     if (callback) {
-        return detail::invokeCatchStatus([&] {
-            callback(asWrapper<DataValue>(*value), asRange(range));
-        });
+        return context->server->invokeNodeCallback(
+            StatisticsCallback::DataSource,
+            "DataSource",
+            nodeId,
+            [&] { callback(asWrapper<DataValue>(*value), asRange(range)); }
+        );
     }
     return UA_STATUSCODE_BADINTERNALERROR;
 }
 
-void Server::setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSource backend) {
-    auto* nodeContext = getContext().getOrCreateNodeContext(id);
+static void setVariableNodeDataSource(
+    Server& server, const NodeId& id, ValueBackendDataSource backend
+) {
+    auto* nodeContext = server.getContext().getOrCreateNodeContext(id);
     nodeContext->dataSource = std::move(backend);
-    detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), id, nodeContext));
+    detail::throwOnBadStatus(UA_Server_setNodeContext(server.handle(), id, nodeContext));
+    server.getContext().eraseTypedDataSource(id);
 
     UA_DataSource dataSourceNative;
     dataSourceNative.read = valueSourceRead;
     dataSourceNative.write = valueSourceWrite;
-    detail::throwOnBadStatus(UA_Server_setVariableNode_dataSource(handle(), id, dataSourceNative));
+    detail::throwOnBadStatus(
+        UA_Server_setVariableNode_dataSource(server.handle(), id, dataSourceNative)
+    );
 }
 
+void Server::setVariableNodeValueBackend(const NodeId& id, ValueBackendDataSource backend) {
+    setVariableNodeDataSource(*this, id, std::move(backend));
+}
+
+void Server::setVariableNodeValueBackends(
+    Span<const std::pair<NodeId, ValueBackendDataSource>> backends
+) {
+    getContext().reserveNodeContexts(backends.size());
+    for (const auto& [id, backend] : backends) {
+        setVariableNodeDataSource(*this, id, backend);
+    }
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 2)
+static UA_StatusCode externalValueNotificationRead(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    [[maybe_unused]] const UA_NodeId* nodeId,
+    void* nodeContext,
+    [[maybe_unused]] const UA_NumericRange* range
+) noexcept {
+    assert(nodeContext != nullptr);
+    auto& external = static_cast<ServerContext::NodeContext*>(nodeContext)->externalValue;
+    if (external.status != nullptr) {
+        // the value is copied by open62541 after this notification
+        const auto status = external.status->status.load(std::memory_order_relaxed);
+        const auto sourceTimestamp = external.status->sourceTimestamp.load(
+            std::memory_order_relaxed
+        );
+        external.value.status = status;
+        external.value.hasStatus = status != UA_STATUSCODE_GOOD;
+        external.value.sourceTimestamp = sourceTimestamp;
+        external.value.hasSourceTimestamp = sourceTimestamp != 0;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+static UA_StatusCode externalValueUserWrite(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    [[maybe_unused]] const UA_NodeId* nodeId,
+    void* nodeContext,
+    const UA_NumericRange* range,
+    const UA_DataValue* data
+) noexcept {
+    assert(nodeContext != nullptr && data != nullptr);
+    if (range != nullptr) {
+        return UA_STATUSCODE_BADWRITENOTSUPPORTED;
+    }
+    auto& target = static_cast<ServerContext::NodeContext*>(nodeContext)->externalValue.value.value;
+    const auto& source = data->value;
+    if (!data->hasValue || source.type != target.type) {
+        return UA_STATUSCODE_BADTYPEMISMATCH;
+    }
+    if (UA_Variant_isScalar(&source) != UA_Variant_isScalar(&target) ||
+        source.arrayLength != target.arrayLength) {
+        return UA_STATUSCODE_BADTYPEMISMATCH;
+    }
+    const size_t length = UA_Variant_isScalar(&target) ? 1 : target.arrayLength;
+    std::memcpy(target.data, source.data, length * target.type->memSize);
+    return UA_STATUSCODE_GOOD;
+}
+#endif
+
+template <typename T>
+void Server::setVariableNodeValueBackendExternalImpl(
+    [[maybe_unused]] const NodeId& id,
+    [[maybe_unused]] T* data,
+    [[maybe_unused]] size_t size,
+    [[maybe_unused]] bool isArray,
+    [[maybe_unused]] bool writable,
+    [[maybe_unused]] ValueBackendExternalStatus* status
+) {
+    static_assert(std::is_arithmetic_v<T>, "Only arithmetic types allowed");
+#if UAPP_OPEN62541_VER_GE(1, 2)
+    auto* nodeContext = getContext().getOrCreateNodeContext(id);
+    auto& external = nodeContext->externalValue;
+    external.value = {};
+    if (isArray) {
+        UA_Variant_setArray(&external.value.value, data, size, &detail::guessDataType<T>());
+    } else {
+        UA_Variant_setScalar(&external.value.value, data, &detail::guessDataType<T>());
+    }
+    external.value.value.storageType = UA_VARIANT_DATA_NODELETE;
+    external.value.hasValue = true;
+    external.valuePtr = &external.value;
+    external.status = status;
+    detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), id, nodeContext));
+    getContext().eraseTypedDataSource(id);
+
+    UA_ValueBackend backend{};
+    backend.backendType = UA_VALUEBACKENDTYPE_EXTERNAL;
+    backend.backend.external.value = &external.valuePtr;
+    backend.backend.external.callback.notificationRead = externalValueNotificationRead;
+    backend.backend.external.callback.userWrite = writable ? externalValueUserWrite : nullptr;
+    detail::throwOnBadStatus(UA_Server_setVariableNode_valueBackend(handle(), id, backend));
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+// explicit template instantiation
+// clang-format off
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, bool*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, int8_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, uint8_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, int16_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, uint16_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, int32_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, uint32_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, int64_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, uint64_t*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, float*, size_t, bool, bool, ValueBackendExternalStatus*);
+template void Server::setVariableNodeValueBackendExternalImpl(const NodeId&, double*, size_t, bool, bool, ValueBackendExternalStatus*);
+// clang-format on
+
+static UA_StatusCode dataSourceGroupRead(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    const UA_NodeId* nodeId,
+    void* nodeContext,
+    [[maybe_unused]] UA_Boolean includeSourceTimestamp,
+    const UA_NumericRange* range,
+    UA_DataValue* value
+) noexcept {
+    assert(nodeContext != nullptr && value != nullptr);
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& group = *context->dataSourceGroup;
+    const size_t index = context->dataSourceGroupIndex;
+    const auto now = Statistics::Clock::now();
+    if (!group.valid || group.served[index] || now - group.timestamp > group.backend.maxAge) {
+        for (auto& item : group.items) {
+            item.value = DataValue();
+        }
+        auto& callback = group.backend.read;
+        group.status = callback
+            ? context->server->invokeNodeCallback(
+                  StatisticsCallback::DataSource,
+                  "DataSourceGroup",
+                  nodeId,
+                  [&] { callback(Span<DataSourceGroupItem>(group.items)); }
+              )
+            : UA_STATUSCODE_BADINTERNALERROR;
+        group.served.assign(group.items.size(), false);
+        group.timestamp = now;
+        group.valid = true;
+    }
+    if (group.status != UA_STATUSCODE_GOOD) {
+        return group.status;
+    }
+    group.served[index] = true;
+    const UA_DataValue& source = *group.items[index].value.handle();
+    if (range == nullptr) {
+        return UA_DataValue_copy(&source, value);
+    }
+    UA_DataValue sourceWithoutValue = source;
+    sourceWithoutValue.value = {};
+    sourceWithoutValue.hasValue = false;
+    const auto status = UA_DataValue_copy(&sourceWithoutValue, value);
+    if (status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    value->hasValue = source.hasValue;
+    return source.hasValue ? UA_Variant_copyRange(&source.value, &value->value, *range)
+                           : UA_STATUSCODE_GOOD;
+}
+
+static UA_StatusCode dataSourceGroupWrite(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    const UA_NodeId* nodeId,
+    void* nodeContext,
+    const UA_NumericRange* range,
+    const UA_DataValue* value
+) noexcept {
+    assert(nodeContext != nullptr && value != nullptr);
+    auto* context = static_cast<ServerContext::NodeContext*>(nodeContext);
+    auto& group = *context->dataSourceGroup;
+    auto& callback = group.backend.write;
+    if (!callback) {
+        return UA_STATUSCODE_BADWRITENOTSUPPORTED;
+    }
+    group.valid = false;  // discard current batch
+    return context->server->invokeNodeCallback(
+        StatisticsCallback::DataSource,
+        "DataSourceGroup",
+        nodeId,
+        [&]() -> UA_StatusCode {
+            return callback(
+                group.items[context->dataSourceGroupIndex].nodeId,
+                asWrapper<DataValue>(*value),
+                asRange(range)
+            );
+        }
+    );
+}
+
+void Server::setVariableNodeValueBackendGroup(
+    Span<const NodeId> ids, ValueBackendDataSourceGroup group
+) {
+    auto state = std::make_unique<ServerContext::DataSourceGroup>();
+    state->backend = std::move(group);
+    state->items.reserve(ids.size());
+    for (const auto& id : ids) {
+        state->items.push_back({id, DataValue()});
+    }
+    state->served.assign(ids.size(), false);
+    auto* statePtr = getContext().dataSourceGroups.emplace_back(std::move(state)).get();
+
+    UA_DataSource dataSourceNative;
+    dataSourceNative.read = dataSourceGroupRead;
+    dataSourceNative.write = dataSourceGroupWrite;
+    getContext().reserveNodeContexts(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto* nodeContext = getContext().getOrCreateNodeContext(ids[i]);
+        nodeContext->dataSourceGroup = statePtr;
+        nodeContext->dataSourceGroupIndex = i;
+        detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), ids[i], nodeContext));
+        getContext().eraseTypedDataSource(ids[i]);
+        detail::throwOnBadStatus(
+            UA_Server_setVariableNode_dataSource(handle(), ids[i], dataSourceNative)
+        );
+    }
+}
+
+void Server::setVariableNodeValueBackendTyped(
+    const NodeId& id, std::shared_ptr<void> source, UA_DataSource dataSourceNative
+) {
+    // the node context points to the data source object instead of the node context of the server
+    void* nodeContext = source.get();
+    detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), id, nodeContext));
+    // replaces (and releases) a previous typed data source of the node
+    getContext().typedDataSources.insert_or_assign(id, std::move(source));
+    detail::throwOnBadStatus(
+        UA_Server_setVariableNode_dataSource(handle(), id, dataSourceNative)
+    );
+}
+
+template <typename T>
+static UA_StatusCode valuePublisherRead(
+    [[maybe_unused]] UA_Server* server,
+    [[maybe_unused]] const UA_NodeId* sessionId,
+    [[maybe_unused]] void* sessionContext,
+    [[maybe_unused]] const UA_NodeId* nodeId,
+    void* nodeContext,
+    UA_Boolean includeSourceTimestamp,
+    const UA_NumericRange* range,
+    UA_DataValue* value
+) noexcept {
+    assert(nodeContext != nullptr && value != nullptr);
+    if (range != nullptr) {
+        return UA_STATUSCODE_BADINDEXRANGEINVALID;
+    }
+    const auto* slot = static_cast<const detail::ValuePublisherSlot<T>*>(
+        static_cast<ServerContext::NodeContext*>(nodeContext)->valuePublisherSlot
+    );
+    assert(slot != nullptr);
+    const auto [current, sourceTimestamp] = slot->load();
+    const auto status = UA_Variant_setScalarCopy(
+        &value->value, &current, &detail::guessDataType<T>()
+    );
+    if (status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    value->hasValue = true;
+    if (includeSourceTimestamp) {
+        value->sourceTimestamp = sourceTimestamp;
+        value->hasSourceTimestamp = true;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+template <typename T>
+ValuePublisher<T> Server::createValuePublisher(Span<const NodeId> ids) {
+    auto state = std::make_shared<detail::ValuePublisherState<T>>(ids);
+    const auto& dataType = detail::guessDataType<T>();
+    const auto now = CachedClock::now().get();
+    for (size_t i = 0; i < ids.size(); ++i) {
+        const Variant current = services::readValue(*this, ids[i]);
+        if (current.isScalar() && current.isType(dataType)) {
+            state->slots[i].store(*static_cast<const T*>(current.data()), now);
+        } else if (!current.isEmpty()) {
+            throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+        }
+    }
+
+    UA_DataSource dataSourceNative;
+    dataSourceNative.read = valuePublisherRead<T>;
+    dataSourceNative.write = nullptr;  // read-only, writes are rejected with BadWriteNotSupported
+    getContext().reserveNodeContexts(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        auto* nodeContext = getContext().getOrCreateNodeContext(ids[i]);
+        nodeContext->valuePublisherSlot = &state->slots[i];
+        detail::throwOnBadStatus(UA_Server_setNodeContext(handle(), ids[i], nodeContext));
+        getContext().eraseTypedDataSource(ids[i]);
+        detail::throwOnBadStatus(
+            UA_Server_setVariableNode_dataSource(handle(), ids[i], dataSourceNative)
+        );
+    }
+    getContext().valuePublishers.push_back(state);
+    return ValuePublisher<T>(std::move(state));
+}
+
+// explicit template instantiation
+template ValuePublisher<bool> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<int8_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<uint8_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<int16_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<uint16_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<int32_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<uint32_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<int64_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<uint64_t> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<float> Server::createValuePublisher(Span<const NodeId>);
+template ValuePublisher<double> Server::createValuePublisher(Span<const NodeId>);
+
+template <typename T>
+void Server::addValueRefresh(
+    const NodeId& id, std::chrono::milliseconds interval, std::function<T()> refresh
+) {
+    auto publisher = createValuePublisher<T>(Span<const NodeId>(&id, 1));
+    auto& context = getContext();
+    if (context.refreshScheduler == nullptr) {
+        context.refreshScheduler = std::make_unique<detail::RefreshScheduler>(
+            context.refreshThreadCount, context.workerThreadConfig
+        );
+    }
+    context.refreshScheduler->add(
+        interval,
+        [publisher = std::move(publisher), refresh = std::move(refresh)]() mutable {
+            publisher.publish(0, refresh());
+        }
+    );
+}
+
+// explicit template instantiation
+// clang-format off
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<bool()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<int8_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<uint8_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<int16_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<uint16_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<int32_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<uint32_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<int64_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<uint64_t()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<float()>);
+template void Server::addValueRefresh(const NodeId&, std::chrono::milliseconds, std::function<double()>);
+// clang-format on
+
+#ifdef UAPP_ASYNC_METHODS
+void Server::setAsyncMethodThreads(size_t count) {
+    if (getContext().asyncMethodDispatcher != nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    getContext().asyncMethodThreadCount = count;
+}
+#endif
+
+void Server::setValueRefreshThreads(size_t count) {
+    if (getContext().refreshScheduler != nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    getContext().refreshThreadCount = count;
+}
+
+void Server::setWorkerThreads(size_t count) {
+    auto& context = getContext();
+    bool started = context.refreshScheduler != nullptr;
+#ifdef UAPP_ASYNC_METHODS
+    started = started || context.asyncMethodDispatcher != nullptr;
+#endif
+    if (started) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    context.refreshThreadCount = count;
+#ifdef UAPP_ASYNC_METHODS
+    context.asyncMethodThreadCount = count;
+#endif
+}
+
+void Server::setThreadConfig(ThreadRole role, const ThreadConfig& config) {
+    auto& context = getContext();
+    if (role == ThreadRole::EventLoop) {
+        context.eventLoopThreadConfig = config;
+        return;
+    }
+    bool started = context.refreshScheduler != nullptr;
+#ifdef UAPP_ASYNC_METHODS
+    started = started || context.asyncMethodDispatcher != nullptr;
+#endif
+    if (started) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    context.workerThreadConfig = config;
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+void Server::enableHistorizing(const NodeId& id, const HistorizingOptions& options) {
+    auto& historian = getContext().historian;
+    if (historian == nullptr) {
+        historian = std::make_unique<Historian>();
+        historian->install(handle());
+    }
+    historian->enable(id, options);
+    const auto accessLevel = services::readAccessLevel(*this, id);
+    services::writeAccessLevel(
+        *this, id, static_cast<uint8_t>(accessLevel | UA_ACCESSLEVELMASK_HISTORYREAD)
+    );
+    services::writeAttribute(*this, id, AttributeId::Historizing, DataValue::fromScalar(true));
+}
+#endif
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 Subscription<Server> Server::createSubscription() noexcept {
     return {*this, 0U};
 }
+
+void Server::notifyValueChanged(const NodeId& id) {
+    detail::sampleEventDrivenMonitoredItems(*this, id);
+}
+
+void Server::notifyValueChanged(Span<const NodeId> ids) {
+    for (const auto& id : ids) {
+        detail::sampleEventDrivenMonitoredItems(*this, id);
+    }
+}
+#endif
+
+#ifdef UA_ENABLE_PUBSUB
+static constexpr std::string_view getTransportProfileUri(PubSubTransport transport) noexcept {
+    return transport == PubSubTransport::Ethernet
+               ? "http://opcfoundation.org/UA-Profile/Transport/pubsub-eth-uadp"
+               : "http://opcfoundation.org/UA-Profile/Transport/pubsub-udp-uadp";
+}
+
+static void addPubSubTransportLayer(Server& server, PubSubTransport transport) {
+    auto& context = server.getContext();
+    auto* config = UA_Server_getConfig(server.handle());
+    if (transport == PubSubTransport::Udp && !context.pubSubUdpTransport) {
+        detail::throwOnBadStatus(
+            UA_ServerConfig_addPubSubTransportLayer(config, UA_PubSubTransportLayerUDPMP())
+        );
+        context.pubSubUdpTransport = true;
+    }
+    if (transport == PubSubTransport::Ethernet && !context.pubSubEthernetTransport) {
+#ifdef UA_ENABLE_PUBSUB_ETH_UADP
+        detail::throwOnBadStatus(
+            UA_ServerConfig_addPubSubTransportLayer(config, UA_PubSubTransportLayerEthernet())
+        );
+        context.pubSubEthernetTransport = true;
+#else
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+    }
+}
+
+PubSubConnection Server::addPubSubConnection(const PubSubConnectionConfig& config) {
+    addPubSubTransportLayer(*this, config.transport);
+
+    UA_NetworkAddressUrlDataType address{};
+    address.networkInterface = detail::toNativeString(config.networkInterface);
+    address.url = detail::toNativeString(config.url);
+
+    UA_PubSubConnectionConfig native{};
+    native.name = detail::toNativeString(config.name);
+    native.enabled = true;
+    native.transportProfileUri = detail::toNativeString(getTransportProfileUri(config.transport));
+    native.publisherIdType = UA_PUBSUB_PUBLISHERID_NUMERIC;
+    native.publisherId.numeric = config.publisherId;
+    UA_Variant_setScalar(
+        &native.address, &address, &UA_TYPES[UA_TYPES_NETWORKADDRESSURLDATATYPE]
+    );  // borrowed, the config is copied
+
+    NodeId id;
+    detail::throwOnBadStatus(UA_Server_addPubSubConnection(handle(), &native, id.handle()));
+    return {*this, std::move(id)};
+}
+
+PublishedDataSet Server::addPublishedDataSet(std::string_view name) {
+    UA_PublishedDataSetConfig native{};
+    native.publishedDataSetType = UA_PUBSUB_DATASET_PUBLISHEDITEMS;
+    native.name = detail::toNativeString(name);
+
+    NodeId id;
+    const auto result = UA_Server_addPublishedDataSet(handle(), &native, id.handle());
+    detail::throwOnBadStatus(result.addResult);
+    return {*this, std::move(id)};
+}
 #endif
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
 Event Server::createEvent(const NodeId& eventType) {
     return Event(*this, eventType);
 }
+
+EventStream Server::createEventStream(
+    const NodeId& originId,
+    const NodeId& eventType,
+    Span<const QualifiedName> fields,
+    const EventStreamOptions& options
+) {
+    auto state = std::make_shared<detail::EventStreamState>(
+        *this, originId, eventType, fields, options
+    );
+    UA_UInt64 callbackId{};
+    const auto status = UA_Server_addRepeatedCallback(
+        handle(),
+        [](UA_Server*, void* data) noexcept {
+            static_cast<detail::EventStreamState*>(data)->process();
+        },
+        state.get(),
+        static_cast<double>(options.interval.count()),
+        &callbackId
+    );
+    detail::throwOnBadStatus(status);
+    getContext().eventStreams.push_back(state);
+    return EventStream(std::move(state));
+}
 #endif
 
 uint16_t Server::runIterate() {
@@ -361,14 +1923,161 @@ void Server::run() {
     connection_->run();
 }
 
+void Server::setCachedClock(bool enabled) {
+    connection_->setCachedClock(enabled);
+}
+
+void Server::runInBackground(uint16_t commandIntervalMilliseconds) {
+    connection_->runInBackground(commandIntervalMilliseconds);
+}
+
 void Server::stop() {
     connection_->stop();
 }
 
+void Server::post(std::function<void()> command) {
+    connection_->post(std::move(command));
+}
+
 bool Server::isRunning() const noexcept {
     return connection_->isRunning();
 }
 
+Statistics& Server::getStatistics() noexcept {
+    return getContext().statistics;
+}
+
+void Server::setTracer(std::shared_ptr<Tracer> tracer) {
+    getContext().tracer = std::move(tracer);
+}
+
+/// Report of the node profiler as text lines for the diagnostic variable.
+[[maybe_unused]] static std::vector<std::string> formatHotNodes(Span<const HotNode> hotNodes) {
+    std::vector<std::string> lines;
+    lines.reserve(hotNodes.size());
+    for (const auto& hotNode : hotNodes) {
+        lines.push_back(
+            hotNode.id.toString() + " count=" + std::to_string(hotNode.count) +
+            " read=" + std::to_string(hotNode.getCount(NodeAccess::Read)) +
+            " write=" + std::to_string(hotNode.getCount(NodeAccess::Write)) +
+            " browse=" + std::to_string(hotNode.getCount(NodeAccess::Browse)) +
+            " sample=" + std::to_string(hotNode.getCount(NodeAccess::Sample))
+        );
+    }
+    return lines;
+}
+
+void Server::enableNodeProfiler(const NodeProfilerOptions& options) {
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+    auto& context = getContext();
+    if (context.nodeProfiler != nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    auto profiler = std::make_shared<detail::NodeProfiler>(options);
+    detail::installNodeProfiler(getConfig(this)->nodestore, profiler);
+    context.nodeProfiler = profiler;
+    if (options.diagnosticNodeId.isNull()) {
+        return;
+    }
+    VariableAttributes attributes;
+    attributes.setDataType(DataTypeId::String);
+    attributes.setValueRank(ValueRank::OneDimension);
+    attributes.setAccessLevel(UA_ACCESSLEVELMASK_READ);
+    services::addVariable(
+        *this, {0, UA_NS0ID_SERVER}, options.diagnosticNodeId, "HotNodes", attributes
+    );
+    ValueBackendDataSource dataSource;
+    dataSource.read = [profiler = std::move(profiler)](
+                          DataValue& dv, [[maybe_unused]] const NumericRange& range, bool
+                      ) -> StatusCode {
+        dv.setValue(Variant::fromArray(formatHotNodes(profiler->getHotNodes())));
+        return UA_STATUSCODE_GOOD;
+    };
+    setVariableNodeValueBackend(options.diagnosticNodeId, std::move(dataSource));
+#else
+    (void)options;
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+std::vector<HotNode> Server::getHotNodes() const {
+    const auto& profiler = connection_->getContext().nodeProfiler;
+    if (profiler == nullptr) {
+        return {};
+    }
+    return profiler->getHotNodes();
+}
+
+void Server::resetNodeProfiler() {
+    if (const auto& profiler = getContext().nodeProfiler) {
+        profiler->reset();
+    }
+}
+
+#ifdef UAPP_ASYNC_METHODS
+/// Execute the callback of a method in the async worker pool (WatchdogOptions::migrateMethodsAfter).
+static void migrateMethodToAsync(Server& server, const NodeId& id) {
+    auto& context = server.getContext();
+    const auto it = context.nodeContexts.find(id);
+    if (it == context.nodeContexts.end() || !it->second.methodCallback ||
+        it->second.asyncMethodCallback) {
+        return;
+    }
+    // output arguments are preallocated by the server for synchronous calls only
+    size_t outputCount = 0;
+    const QualifiedName outputArguments(0, "OutputArguments");
+    const auto result = services::browseSimplifiedBrowsePath(server, id, {&outputArguments, 1});
+    if (result.getStatusCode().isGood() && !result.getTargets().empty()) {
+        outputCount = services::readValue(server, result.getTargets()[0].getTargetId().getNodeId())
+                          .getArrayLength();
+    }
+    getAsyncMethodDispatcher(server.handle(), context);
+    it->second.asyncMethodCallback = [callback = it->second.methodCallback, outputCount](
+                                         Span<const Variant> input,
+                                         services::MethodCompletion completion
+                                     ) {
+        std::vector<Variant> output(outputCount);
+        callback(input, output);
+        completion.complete(output);
+    };
+    detail::throwOnBadStatus(UA_Server_setMethodNodeAsync(server.handle(), id, true));
+    const auto msg = "Method " + id.toString() + " moved to the async worker pool";
+    log(server, LogLevel::Info, LogCategory::Server, msg);
+}
+#endif
+
+void Server::enableWatchdog(const WatchdogOptions& options) {
+    disableWatchdog();
+    detail::Watchdog::MigrateFunc migrate;
+#ifdef UAPP_ASYNC_METHODS
+    if (options.migrateMethodsAfter > 0) {
+        migrate = [connection = connection_.get()](const NodeId& id) {
+            connection->post([connection, id] {
+                migrateMethodToAsync(connection->getCustomAccessControl().getServer(), id);
+            });
+        };
+    }
+#endif
+    auto watchdog = std::make_unique<detail::Watchdog>(handle(), options, std::move(migrate));
+    const auto status = UA_Server_addRepeatedCallback(
+        handle(),
+        [](UA_Server*, void* data) noexcept { static_cast<detail::Watchdog*>(data)->checkLoop(); },
+        watchdog.get(),
+        static_cast<double>(options.checkInterval.count()),
+        &watchdog->callbackId
+    );
+    detail::throwOnBadStatus(status);
+    getContext().watchdog = std::move(watchdog);
+}
+
+void Server::disableWatchdog() {
+    auto& watchdog = getContext().watchdog;
+    if (watchdog != nullptr) {
+        UA_Server_removeRepeatedCallback(handle(), watchdog->callbackId);
+        watchdog.reset();
+    }
+}
+
 Node<Server> Server::getNode(NodeId id) {
     return {*this, std::move(id)};
 }
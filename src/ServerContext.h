@@ -1,45 +1,284 @@
 #pragma once
 
+#include <any>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <functional>
 #include <map>
 #include <memory>
+#include <optional>
+#include <string_view>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>  // forward
+#include <vector>
 
+#include "open62541pp/Common.h"  // TransportConfig
 #include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NamespaceTable.h"
+#include "open62541pp/SharedVariant.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/Tracer.h"
 #include "open62541pp/ValueBackend.h"
+#include "open62541pp/ValuePublisher.h"
 #include "open62541pp/services/NodeManagement.h"
 #include "open62541pp/services/Subscription.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/NodeId.h"
 
+#include "Historian.h"
+#include "InProcessConnection.h"
+#include "NodeProfiler.h"
+#include "RealtimePool.h"
+#include "Watchdog.h"
+#include "detail/AggregateCalculator.h"
+#include "detail/LastReportedValue.h"
+#include "detail/RefreshScheduler.h"
+#include "detail/SubscriptionHealth.h"
+
 namespace opcua {
 
+// forward declaration
+class AsyncMethodDispatcher;
+class Server;
+
+namespace detail {
+class EventStreamState;
+}  // namespace detail
+
 /**
  * Internal storage for Server class.
  * Mainly used to store stateful function pointers.
  */
 class ServerContext {
 public:
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+    /// Pool of the realtime profile, declared first to release the pooled memory of other members.
+    std::unique_ptr<RealtimePool> realtimePool;
+#endif
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
     struct MonitoredItem {
         ReadValueId itemToMonitor;
         services::DataChangeNotificationCallback dataChangeCallback;
+        std::optional<services::ClientDataChangeFilter> clientFilter;
+        detail::LastReportedValue lastReported;
+        detail::SubscriptionHealth* health{nullptr};
+        TimestampsToReturn timestamps{TimestampsToReturn::Both};
+        MonitoringMode monitoringMode{MonitoringMode::Reporting};
+        bool eventDriven{false};
+        /// Aggregate computed by the wrapper (AggregateFilter), sampled by a repeated callback.
+        std::unique_ptr<detail::AggregateCalculator> aggregate;
+        uint64_t aggregateCallbackId{0};
+        uint32_t monitoredItemId{0};
+        ServerContext* serverContext{nullptr};
+
+        const NodeId& getNodeId() const noexcept {
+            return itemToMonitor.getNodeId();
+        }
     };
 
     std::map<uint32_t, std::unique_ptr<MonitoredItem>> monitoredItems;
+    /// Ids of event-driven monitored items by node id (see MonitoringParameters::eventDriven).
+    std::unordered_map<NodeId, std::vector<uint32_t>> eventDrivenMonitoredItems;
+    /// Counters of Subscription<Server>::getStatistics (all local monitored items).
+    detail::SubscriptionHealth subscriptionHealth;
+    /// Payload of the event-driven sample currently reported to the monitored items of a node.
+    const SharedVariant* sharedSample{nullptr};
+    /// Last shared payloads by node id (Subscription::subscribeDataChangeShared), released with
+    /// the next processing of commands.
+    std::unordered_map<NodeId, SharedVariant> sharedValues;
 #endif
 
+    /// External value backend, the variant of `value` points to the user memory (not owned).
+    struct ExternalValue {
+        UA_DataValue value{};
+        UA_DataValue* valuePtr{nullptr};  // referenced by the native external value backend
+        ValueBackendExternalStatus* status{nullptr};
+    };
+
+    /// Grouped data source with the values of the last batch read.
+    struct DataSourceGroup {
+        ValueBackendDataSourceGroup backend;
+        std::vector<DataSourceGroupItem> items;
+        std::vector<bool> served;  // node already served from the current batch
+        Statistics::Clock::time_point timestamp{};
+        UA_StatusCode status{UA_STATUSCODE_GOOD};
+        bool valid{false};
+    };
+
+    struct ValueCallbackGroupState {
+        ValueCallbackGroup callbacks;
+        std::vector<NodeId> ids;
+        std::vector<bool> served;  // node already read since the last refresh
+        Statistics::Clock::time_point timestamp{};
+        bool valid{false};
+        bool refreshing{false};  // reads within onBeforeRead don't trigger another refresh
+    };
+
     struct NodeContext {
         ValueCallback valueCallback;
+        Statistics::Clock::time_point valueCallbackTimestamp{};  // last onBeforeRead invocation
+        ValueCallbackGroupState* valueCallbackGroup{nullptr};
+        size_t valueCallbackGroupIndex{0};
         ValueBackendDataSource dataSource;
+        ExternalValue externalValue;
+        DataSourceGroup* dataSourceGroup{nullptr};
+        size_t dataSourceGroupIndex{0};
+        const void* valuePublisherSlot{nullptr};  // detail::ValuePublisherSlot<T>
+        ServerContext* server{nullptr};
 #ifdef UA_ENABLE_METHODCALLS
         services::MethodCallback methodCallback;
+#endif
+#ifdef UAPP_ASYNC_METHODS
+        services::AsyncMethodCallback asyncMethodCallback;
 #endif
     };
 
-    std::map<NodeId, std::unique_ptr<NodeContext>> nodeContexts;
+    /// Node contexts are stored by value, the addresses are stable across rehashes and are passed
+    /// to open62541 as node context pointers.
+    std::unordered_map<NodeId, NodeContext> nodeContexts;
+
+    /// Grouped data sources, referenced by the node contexts.
+    std::vector<std::unique_ptr<DataSourceGroup>> dataSourceGroups;
+
+    /// Grouped value callbacks, referenced by the node contexts.
+    std::vector<std::unique_ptr<ValueCallbackGroupState>> valueCallbackGroups;
+
+    /// Cached namespace table, reset by Server::registerNamespace.
+    std::shared_ptr<const NamespaceTable> namespaceTable;
+
+    /// Active sessions (tracked by the access control) with their attached user context.
+    std::unordered_map<NodeId, std::any> sessions;
+
+    /// Typed data source objects by node id, passed to open62541 as node context pointers.
+    std::unordered_map<NodeId, std::shared_ptr<void>> typedDataSources;
+
+    /// Keep the value publisher slots alive as long as the server exists.
+    std::vector<std::shared_ptr<detail::ValuePublisherStateBase>> valuePublishers;
+
+    /// Queues of the event streams, triggered by repeated callbacks of the server.
+    std::vector<std::shared_ptr<detail::EventStreamState>> eventStreams;
+
+    /// Configuration of the network thread of Server::runInBackground.
+    ThreadConfig eventLoopThreadConfig;
+
+    /// Configuration of the worker threads (refresh scheduler, async method dispatcher).
+    ThreadConfig workerThreadConfig;
+
+    /// Number of worker threads of the refresh scheduler.
+    size_t refreshThreadCount{1};
+
+    /// Background scheduler of value refresh functions, created with the first refresh.
+    std::unique_ptr<detail::RefreshScheduler> refreshScheduler;
+
+#ifdef UAPP_ASYNC_METHODS
+    /// Number of worker threads of the async method dispatcher.
+    size_t asyncMethodThreadCount{1};
+
+    /// Worker pool of async method calls, created with the first async method.
+    std::shared_ptr<AsyncMethodDispatcher> asyncMethodDispatcher;
+#endif
+
+#ifdef UA_ENABLE_HISTORIZING
+    /// In-memory history database, installed with the first historizing node.
+    std::unique_ptr<Historian> historian;
+#endif
+
+#ifdef UA_ENABLE_PUBSUB
+    /// Pointers to the user memory of PubSub fields (stable addresses required by open62541).
+    std::deque<UA_DataValue*> pubSubValueSources;
+    /// Message callbacks of PubSub data set readers.
+    std::deque<std::function<void()>> pubSubMessageCallbacks;
+    /// Reader groups with realtime level fixed size (fields must be decoded into user memory).
+    std::unordered_set<NodeId> pubSubFixedSizeReaderGroups;
+    /// Registered PubSub transport layers.
+    bool pubSubUdpTransport{false};
+    bool pubSubEthernetTransport{false};
+#endif
+
+    /// Port of the network layers, used to recreate them with another network backend.
+    uint16_t port{4840};
+
+    /// Default (select-based) network layers, stashed while another network backend is used.
+    std::vector<UA_ServerNetworkLayer> defaultNetworkLayers;
+    /// Socket options of Server::setTransportConfig, applied by the epoll network layers.
+    TransportConfig socketOptions;
+
+#ifdef UAPP_IN_PROCESS_CONNECTION
+    /// Server side of in-process client connections, see Client::connect(Server&).
+    std::shared_ptr<detail::InProcessHub> inProcessHub;
+#endif
+
+    /// Latency statistics of node callbacks.
+    Statistics statistics;
+
+    /// Optional tracer of node callbacks.
+    std::shared_ptr<Tracer> tracer;
+
+    /// Profiler of node accesses, shared with the nodestore decorator.
+    std::shared_ptr<detail::NodeProfiler> nodeProfiler;
+
+    /// Optional watchdog of the event loop and node callbacks.
+    std::unique_ptr<detail::Watchdog> watchdog;
+
+    /// Invoke a node callback (catch exceptions), record its latency, trace it and check it
+    /// against the budget of the watchdog.
+    template <typename F>
+    UA_StatusCode invokeNodeCallback(
+        StatisticsCallback type, std::string_view name, const UA_NodeId* nodeId, F&& func
+    ) noexcept {
+        detail::TraceSpan span(tracer.get(), name);
+        const auto start = Statistics::Clock::now();
+        const UA_StatusCode status = detail::invokeCatchStatus(std::forward<F>(func));
+        statistics.record(type, start, status);
+        span.setStatus(status);
+        if (watchdog != nullptr) {
+            watchdog->checkCallback(type, nodeId, Statistics::Clock::now() - start);
+        }
+        return status;
+    }
 
     NodeContext* getOrCreateNodeContext(const NodeId& id) {
-        return nodeContexts.emplace(id, std::make_unique<NodeContext>()).first->second.get();
+        auto* nodeContext = &nodeContexts.try_emplace(id).first->second;
+        nodeContext->server = this;
+        return nodeContext;
+    }
+
+    void reserveNodeContexts(size_t count) {
+        nodeContexts.reserve(nodeContexts.size() + count);
+    }
+
+    /// Release the typed data source of a node after its value backend has been replaced.
+    void eraseTypedDataSource(const NodeId& id) {
+        if (!typedDataSources.empty()) {
+            typedDataSources.erase(id);
+        }
+    }
+
+    /// Release the contexts of deleted nodes.
+    void eraseNodeContexts(Span<const NodeId> ids) {
+        if (nodeContexts.empty() && typedDataSources.empty()) {
+            return;
+        }
+        for (const auto& id : ids) {
+            nodeContexts.erase(id);
+            typedDataSources.erase(id);
+        }
     }
 };
 
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+namespace detail {
+
+/// Sample the event-driven monitored items of a node (see MonitoringParameters::eventDriven).
+void sampleEventDrivenMonitoredItems(Server& server, const NodeId& id) noexcept;
+
+}  // namespace detail
+#endif
+
 }  // namespace opcua
@@ -0,0 +1,245 @@
+#include "open62541pp/ServerGroup.h"
+
+#include <algorithm>  // min, max
+#include <array>
+#include <cstdint>
+#include <thread>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+
+#include "EpollNetworkLayer.h"  // UAPP_EPOLL_NETWORK_LAYER
+#include "open62541_impl.h"
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+#include <sys/epoll.h>
+#include <unistd.h>  // close
+#endif
+
+namespace opcua {
+
+using Clock = std::chrono::steady_clock;
+
+struct ServerGroup::Entry {
+    std::unique_ptr<Server> server;
+    int fd{-1};  // network descriptor, -1 if not pollable
+    bool ready{false};
+    Clock::time_point nextIterate;
+};
+
+struct ServerGroup::Worker {
+    std::vector<Entry*> entries;
+    std::thread thread;
+};
+
+ServerGroup::ServerGroup(ServerGroupOptions options)
+    : options_(std::move(options)) {
+    options_.threads = std::max<size_t>(options_.threads, 1);
+    options_.commandInterval = std::max(options_.commandInterval, std::chrono::milliseconds(1));
+}
+
+ServerGroup::~ServerGroup() {
+    try {
+        stop();
+    } catch (const BadStatus&) {  // NOLINT, shutdown failed
+    }
+}
+
+void ServerGroup::setCustomDataTypes(std::shared_ptr<const DataTypeRegistry> registry) {
+    dataTypes_ = std::move(registry);
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        applySharedResources(i);
+    }
+}
+
+void ServerGroup::setLogger(LogFunction logger, const LoggerOptions& options) {
+    logger_ = std::move(logger);
+    loggerOptions_ = options;
+    loggerOptions_->async = false;  // background thread per server
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        applySharedResources(i);
+    }
+}
+
+void ServerGroup::setCertificates(ServerGroupCertificates certificates) {
+    certificates_ = std::move(certificates);
+}
+
+void ServerGroup::applySharedResources(size_t index) {
+    auto& server = *entries_[index]->server;
+    if (dataTypes_ != nullptr) {
+        server.setCustomDataTypes(dataTypes_);
+    }
+    if (loggerOptions_.has_value()) {
+        opcua::Logger logger;
+        if (logger_) {
+            logger = [this, index](LogLevel level, LogCategory category, std::string_view msg) {
+                const std::lock_guard lock(loggerMutex_);
+                detail::invokeCatchIgnore(logger_, index, level, category, msg);
+            };
+        }
+        server.setLogger(std::move(logger), *loggerOptions_);
+    }
+}
+
+Server& ServerGroup::addServer(uint16_t port) {
+    if (isRunning()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    std::unique_ptr<Server> server;
+    if (certificates_.privateKey.empty()) {
+        server = std::make_unique<Server>(port, certificates_.certificate, options_.nodestore);
+    } else {
+#ifdef UA_ENABLE_ENCRYPTION
+        server = std::make_unique<Server>(
+            port,
+            certificates_.certificate,
+            certificates_.privateKey,
+            certificates_.trustList,
+            certificates_.issuerList,
+            certificates_.revocationList,
+            options_.nodestore
+        );
+#else
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+    }
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    server->setNetworkBackend(NetworkBackend::Epoll);  // pollable network descriptor
+#endif
+    return addServer(std::move(server));
+}
+
+Server& ServerGroup::addServer(std::unique_ptr<Server> server) {
+    if (isRunning()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDSTATE);
+    }
+    if (server == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    auto entry = std::make_unique<Entry>();
+    entry->server = std::move(server);
+    entries_.push_back(std::move(entry));
+    applySharedResources(entries_.size() - 1);
+    return *entries_.back()->server;
+}
+
+size_t ServerGroup::size() const noexcept {
+    return entries_.size();
+}
+
+Server& ServerGroup::getServer(size_t index) {
+    return *entries_.at(index)->server;
+}
+
+void ServerGroup::start() {
+    if (running_) {
+        return;
+    }
+    // start the servers in the calling thread to propagate errors, e.g. ports in use
+    const auto now = Clock::now();
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        auto& entry = *entries_[i];
+        try {
+            const auto timeout = entry.server->runIterate();
+            entry.nextIterate = now + std::chrono::milliseconds(timeout);
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                entries_[j]->server->stop();
+            }
+            throw;
+        }
+        entry.fd = entry.server->getNetworkFd();
+        entry.ready = false;
+    }
+    running_ = true;
+    workers_.clear();
+    for (size_t i = 0; i < options_.threads; ++i) {
+        workers_.push_back(std::make_unique<Worker>());
+    }
+    for (size_t i = 0; i < entries_.size(); ++i) {
+        workers_[i % workers_.size()]->entries.push_back(entries_[i].get());
+    }
+    for (size_t i = 0; i < workers_.size(); ++i) {
+        workers_[i]->thread = std::thread([this, &worker = *workers_[i], i] {
+            applyThreadConfig(options_.threadConfig, i);
+            run(worker);
+        });
+    }
+}
+
+void ServerGroup::stop() {
+    if (!running_.exchange(false)) {
+        return;
+    }
+    for (auto& worker : workers_) {
+        worker->thread.join();
+    }
+    workers_.clear();
+    for (auto& entry : entries_) {
+        entry->server->stop();
+    }
+}
+
+bool ServerGroup::isRunning() const noexcept {
+    return running_;
+}
+
+void ServerGroup::run(Worker& worker) {
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    // the network descriptors (epoll instances) of the servers are nested in an epoll instance
+    const int epollFd = ::epoll_create1(EPOLL_CLOEXEC);
+    for (auto* entry : worker.entries) {
+        epoll_event event{};
+        event.events = EPOLLIN;
+        event.data.ptr = entry;
+        if (entry->fd >= 0 &&
+            (epollFd < 0 || ::epoll_ctl(epollFd, EPOLL_CTL_ADD, entry->fd, &event) != 0)) {
+            entry->fd = -1;  // iterate periodically
+        }
+    }
+    std::array<epoll_event, 64> events{};
+#endif
+    while (running_) {
+        const auto now = Clock::now();
+        auto wake = now + options_.commandInterval;
+        for (auto* entry : worker.entries) {
+            if (entry->ready || now >= entry->nextIterate) {
+                entry->ready = false;
+                // iterate at least every command interval to process queued commands (and
+                // network messages of servers without a network descriptor)
+                std::chrono::milliseconds timeout{0};
+                try {
+                    timeout = std::chrono::milliseconds(entry->server->runIterate());
+                } catch (const BadStatus&) {
+                    timeout = options_.commandInterval;
+                }
+                entry->nextIterate = now + std::min(timeout, options_.commandInterval);
+            }
+            wake = std::min(wake, entry->nextIterate);
+        }
+
+        const auto timeout = std::max<int64_t>(
+            std::chrono::ceil<std::chrono::milliseconds>(wake - Clock::now()).count(), 0
+        );
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+        if (epollFd >= 0) {
+            const int count = ::epoll_wait(
+                epollFd, events.data(), static_cast<int>(events.size()), static_cast<int>(timeout)
+            );
+            for (int i = 0; i < count; ++i) {
+                static_cast<Entry*>(events[i].data.ptr)->ready = true;  // NOLINT
+            }
+            continue;
+        }
+#endif
+        std::this_thread::sleep_for(std::chrono::milliseconds(timeout));
+    }
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    if (epollFd >= 0) {
+        ::close(epollFd);
+    }
+#endif
+}
+
+}  // namespace opcua
@@ -11,6 +11,7 @@
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
 
+#include "ServerContext.h"
 #include "open62541_impl.h"
 
 namespace opcua {
@@ -79,6 +80,26 @@ void Session::close() {
 #endif
 }
 
+std::any& Session::getContextStorage() {
+    auto* context = findContextStorage();
+    if (context == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADSESSIONIDINVALID);
+    }
+    return *context;
+}
+
+std::any* Session::findContextStorage() noexcept {
+    auto& sessions = getConnection().getContext().sessions;
+    const auto it = sessions.find(getSessionId());
+    return it != sessions.end() ? &it->second : nullptr;
+}
+
+void Session::resetContext() noexcept {
+    if (auto* context = findContextStorage()) {
+        context->reset();
+    }
+}
+
 bool operator==(const Session& lhs, const Session& rhs) noexcept {
     return (lhs.getConnection() == rhs.getConnection()) &&
            (lhs.getSessionId() == rhs.getSessionId());
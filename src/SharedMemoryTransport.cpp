@@ -0,0 +1,925 @@
+#include "SharedMemoryTransport.h"
+
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+
+#include <algorithm>  // min, max
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <climits>  // INT_MAX
+#include <cstddef>  // byte, offsetof
+#include <cstdint>
+#include <cstring>  // memcpy
+#include <new>  // nothrow, placement new
+#include <string>
+#include <utility>  // swap
+#include <vector>
+
+#include <fcntl.h>  // O_* constants
+#include <linux/futex.h>
+#include <signal.h>  // kill
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "open62541pp/Server.h"  // SharedMemoryOptions
+
+namespace opcua::detail {
+
+namespace {
+
+constexpr uint32_t segmentMagic = 0x48534155;  // "UASH"
+constexpr uint32_t segmentVersion = 1;
+constexpr size_t cacheLineSize = 64;
+constexpr size_t minRingSize = 4096;
+constexpr int sendTimeoutMilliseconds = 5000;  // wait for a full ring, same as the epoll layer
+constexpr UA_DateTime peerCheckInterval = UA_DATETIME_SEC;
+
+static_assert(std::atomic<uint32_t>::is_always_lock_free);
+static_assert(std::atomic<uint64_t>::is_always_lock_free);
+static_assert(std::atomic<int32_t>::is_always_lock_free);
+
+/// States of a connection slot, a slot closed by one side is freed by the other side.
+enum SlotState : uint32_t {
+    SlotFree = 0,
+    SlotClaimed = 1,  // client resets the rings
+    SlotOpen = 2,
+    SlotClosedByClient = 3,
+    SlotClosedByServer = 4,
+};
+
+/// Futex word with the number of waiters, notifiers skip the syscall without waiters.
+struct WaitWord {
+    std::atomic<uint32_t> seq;
+    std::atomic<uint32_t> waiters;
+};
+
+struct alignas(cacheLineSize) SegmentHeader {
+    uint32_t magic;
+    uint32_t version;
+    uint32_t slotCount;
+    uint32_t ringSize;
+    std::atomic<int32_t> serverPid;  // 0 after the server stopped
+    std::atomic<uint32_t> ready;
+    WaitWord serverWakeup;  // data or state changes of any slot
+};
+
+/// Single-producer single-consumer byte ring, the data follows the slot header.
+struct Ring {
+    alignas(cacheLineSize) std::atomic<uint64_t> writePos;
+    alignas(cacheLineSize) std::atomic<uint64_t> readPos;
+    alignas(cacheLineSize) WaitWord data;  // waited for by the reader
+    WaitWord space;  // waited for by the writer
+};
+
+struct alignas(cacheLineSize) SlotHeader {
+    std::atomic<uint32_t> state;
+    std::atomic<int32_t> clientPid;
+    Ring toServer;
+    Ring toClient;
+};
+
+/* ------------------------------------------- Segment ------------------------------------------ */
+
+size_t getSlotStride(size_t ringSize) noexcept {
+    return sizeof(SlotHeader) + 2 * ringSize;
+}
+
+size_t getSegmentSize(size_t slotCount, size_t ringSize) noexcept {
+    return sizeof(SegmentHeader) + slotCount * getSlotStride(ringSize);
+}
+
+SegmentHeader& getHeader(void* base) noexcept {
+    return *static_cast<SegmentHeader*>(base);
+}
+
+SlotHeader& getSlot(void* base, size_t index) noexcept {
+    const auto& header = getHeader(base);
+    auto* bytes = static_cast<std::byte*>(base) + sizeof(SegmentHeader) +
+                  index * getSlotStride(header.ringSize);
+    return *reinterpret_cast<SlotHeader*>(bytes);  // NOLINT
+}
+
+std::byte* getRingData(SlotHeader& slot, const Ring& ring, size_t ringSize) noexcept {
+    auto* data = reinterpret_cast<std::byte*>(&slot) + sizeof(SlotHeader);  // NOLINT
+    return &ring == &slot.toServer ? data : data + ringSize;
+}
+
+std::string getSegmentName(std::string_view name) {
+    return "/uapp-" + std::string(name);
+}
+
+bool isValidName(std::string_view name) noexcept {
+    return !name.empty() && name.size() <= 200 && name.find('/') == std::string_view::npos;
+}
+
+bool isProcessAlive(int32_t pid) noexcept {
+    return pid > 0 && (::kill(pid, 0) == 0 || errno != ESRCH);
+}
+
+/* ------------------------------------------- Futex -------------------------------------------- */
+
+void futexWait(std::atomic<uint32_t>& word, uint32_t expected, int timeoutMilliseconds) noexcept {
+    timespec timeout{};
+    timeout.tv_sec = timeoutMilliseconds / 1000;
+    timeout.tv_nsec = static_cast<long>(timeoutMilliseconds % 1000) * 1000000L;  // NOLINT
+    // shared futex (no FUTEX_PRIVATE_FLAG), the word is mapped by multiple processes
+    ::syscall(
+        SYS_futex,
+        reinterpret_cast<uint32_t*>(&word),  // NOLINT
+        FUTEX_WAIT,
+        expected,
+        &timeout,
+        nullptr,
+        0
+    );
+}
+
+void futexWake(std::atomic<uint32_t>& word) noexcept {
+    ::syscall(
+        SYS_futex,
+        reinterpret_cast<uint32_t*>(&word),  // NOLINT
+        FUTEX_WAKE,
+        INT_MAX,
+        nullptr,
+        nullptr,
+        0
+    );
+}
+
+void notify(WaitWord& word) noexcept {
+    word.seq.fetch_add(1);
+    if (word.waiters.load() > 0) {
+        futexWake(word.seq);
+    }
+}
+
+/// Wait until `isReady` returns true, the word is notified or the timeout elapsed.
+template <typename F>
+void waitFor(WaitWord& word, int timeoutMilliseconds, F&& isReady) noexcept {
+    if (timeoutMilliseconds <= 0) {
+        return;
+    }
+    word.waiters.fetch_add(1);
+    const uint32_t seq = word.seq.load();
+    if (!isReady()) {
+        futexWait(word.seq, seq, timeoutMilliseconds);
+    }
+    word.waiters.fetch_sub(1);
+}
+
+/* -------------------------------------------- Ring -------------------------------------------- */
+
+size_t getAvailable(const Ring& ring) noexcept {
+    return static_cast<size_t>(ring.writePos.load() - ring.readPos.load());
+}
+
+size_t getFreeSpace(const Ring& ring, size_t ringSize) noexcept {
+    return ringSize - getAvailable(ring);
+}
+
+/// Read up to `maxLength` bytes and notify the writer.
+size_t readRing(SlotHeader& slot, Ring& ring, size_t ringSize, UA_Byte* out, size_t maxLength) {
+    const uint64_t read = ring.readPos.load(std::memory_order_relaxed);
+    const uint64_t write = ring.writePos.load(std::memory_order_acquire);
+    const size_t length = std::min(static_cast<size_t>(write - read), maxLength);
+    if (length == 0) {
+        return 0;
+    }
+    const auto* data = getRingData(slot, ring, ringSize);
+    const size_t offset = static_cast<size_t>(read) & (ringSize - 1);
+    const size_t first = std::min(length, ringSize - offset);
+    std::memcpy(out, data + offset, first);
+    std::memcpy(out + first, data, length - first);
+    ring.readPos.store(read + length);
+    notify(ring.space);
+    return length;
+}
+
+/// Write up to `length` bytes (limited by the free space), the caller notifies the reader.
+size_t writeRing(SlotHeader& slot, Ring& ring, size_t ringSize, const UA_Byte* in, size_t length) {
+    const uint64_t write = ring.writePos.load(std::memory_order_relaxed);
+    const uint64_t read = ring.readPos.load(std::memory_order_acquire);
+    const size_t count = std::min(ringSize - static_cast<size_t>(write - read), length);
+    if (count == 0) {
+        return 0;
+    }
+    auto* data = getRingData(slot, ring, ringSize);
+    const size_t offset = static_cast<size_t>(write) & (ringSize - 1);
+    const size_t first = std::min(count, ringSize - offset);
+    std::memcpy(data + offset, in, first);
+    std::memcpy(data, in + first, count - first);
+    ring.writePos.store(write + count);
+    return count;
+}
+
+/// Write the whole buffer, wait for free space while the peer is reading.
+template <typename F>
+bool writeAll(
+    SlotHeader& slot,
+    Ring& ring,
+    size_t ringSize,
+    WaitWord& readerWakeup,
+    const UA_ByteString& buf,
+    F&& isOpen
+) {
+    const auto deadline = std::chrono::steady_clock::now() +
+                          std::chrono::milliseconds(sendTimeoutMilliseconds);
+    size_t written = 0;
+    while (written < buf.length) {
+        const size_t count = writeRing(
+            slot, ring, ringSize, buf.data + written, buf.length - written
+        );
+        if (count > 0) {
+            written += count;
+            notify(readerWakeup);
+            continue;
+        }
+        const auto remaining = std::chrono::duration_cast<std::chrono::milliseconds>(
+            deadline - std::chrono::steady_clock::now()
+        );
+        if (!isOpen() || remaining.count() <= 0) {
+            return false;
+        }
+        waitFor(ring.space, static_cast<int>(remaining.count()), [&] {
+            return getFreeSpace(ring, ringSize) > 0 || !isOpen();
+        });
+    }
+    return true;
+}
+
+UA_StatusCode getSendBuffer(UA_Connection* connection, size_t length, UA_ByteString* buf) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    if (length > connection->config.sendBufferSize) {
+        return UA_STATUSCODE_BADCOMMUNICATIONERROR;
+    }
+    return UA_ByteString_allocBuffer(buf, length);
+}
+
+void releaseBuffer(UA_Connection* /* connection */, UA_ByteString* buf) {
+    UA_ByteString_clear(buf);
+}
+
+/* ---------------------------------------- Server layer ---------------------------------------- */
+
+struct ShmLayer;
+
+struct ShmConnection {
+    ShmLayer* layer{nullptr};
+    size_t slot{0};
+    bool freeSlot{false};  // client closed first, the server frees the slot on removal
+    UA_Connection connection{};
+};
+
+struct ShmLayer {
+    std::string name;
+    std::string segmentName;
+    size_t slotCount{0};
+    size_t ringSize{0};
+    mode_t permissions{0600};
+    void* base{nullptr};
+    size_t size{0};
+    UA_Server* server{nullptr};
+    std::vector<ShmConnection*> connections;  // by slot index
+    std::vector<ShmConnection*> closed;  // closed connections, removed with the next listen
+    std::vector<UA_Byte> recvBuffer;  // shared by all connections
+    UA_DateTime nextPeerCheck{0};
+};
+
+ShmConnection* getConnection(UA_Connection* connection) noexcept {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto* bytes = reinterpret_cast<char*>(connection);
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    return reinterpret_cast<ShmConnection*>(bytes - offsetof(ShmConnection, connection));
+}
+
+ShmLayer& getLayer(UA_ServerNetworkLayer* nl) noexcept {
+    return *static_cast<ShmLayer*>(nl->handle);
+}
+
+void closeServerConnection(UA_Connection* connection) noexcept {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return;
+    }
+    connection->state = UA_CONNECTIONSTATE_CLOSED;
+    auto* conn = getConnection(connection);
+    auto& layer = *conn->layer;
+    auto& slot = getSlot(layer.base, conn->slot);
+    uint32_t expected = SlotOpen;
+    if (!slot.state.compare_exchange_strong(expected, SlotClosedByServer)) {
+        conn->freeSlot = true;  // closed by the client before
+    }
+    notify(slot.toClient.data);
+    try {
+        layer.closed.push_back(conn);
+    } catch (const std::bad_alloc&) {
+        // removed when the closed slot is reported by the next listen
+    }
+}
+
+UA_StatusCode sendServerBuffer(UA_Connection* connection, UA_ByteString* buf) {
+    UA_StatusCode status = UA_STATUSCODE_GOOD;
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+    } else {
+        auto* conn = getConnection(connection);
+        auto& slot = getSlot(conn->layer->base, conn->slot);
+        const bool written = writeAll(
+            slot, slot.toClient, conn->layer->ringSize, slot.toClient.data, *buf, [&] {
+                return slot.state.load() == SlotOpen && isProcessAlive(slot.clientPid.load());
+            }
+        );
+        if (!written) {
+            closeServerConnection(connection);
+            status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+        }
+    }
+    UA_ByteString_clear(buf);
+    return status;
+}
+
+/// Receive into the shared buffer of the layer, valid until the next receive of any connection.
+UA_StatusCode recvServerBuffer(
+    UA_Connection* connection, UA_ByteString* response, UA_UInt32 /* timeout */
+) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    auto* conn = getConnection(connection);
+    auto& layer = *conn->layer;
+    auto& slot = getSlot(layer.base, conn->slot);
+    const size_t length = readRing(
+        slot, slot.toServer, layer.ringSize, layer.recvBuffer.data(), layer.recvBuffer.size()
+    );
+    if (length == 0) {
+        return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+    }
+    response->data = layer.recvBuffer.data();
+    response->length = length;
+    return UA_STATUSCODE_GOOD;
+}
+
+void releaseServerRecvBuffer(UA_Connection* /* connection */, UA_ByteString* buf) {
+    // shared buffer owned by the layer
+    *buf = UA_BYTESTRING_NULL;
+}
+
+void freeServerConnection(UA_Connection* connection) {
+    delete getConnection(connection);  // NOLINT(cppcoreguidelines-owning-memory)
+}
+
+void removeConnection(ShmLayer& layer, ShmConnection* conn) noexcept {
+    if (layer.connections[conn->slot] != conn) {
+        return;  // already removed
+    }
+    layer.connections[conn->slot] = nullptr;
+    conn->connection.state = UA_CONNECTIONSTATE_CLOSED;
+    if (conn->freeSlot) {
+        getSlot(layer.base, conn->slot).state.store(SlotFree);
+    }
+    // detaches the secure channel and frees the connection with a delayed callback
+    UA_Server_removeConnection(layer.server, &conn->connection);
+}
+
+void removeClosedConnections(ShmLayer& layer) noexcept {
+    if (layer.closed.empty()) {
+        return;
+    }
+    std::vector<ShmConnection*> closed;
+    std::swap(closed, layer.closed);
+    for (auto* conn : closed) {
+        removeConnection(layer, conn);
+    }
+}
+
+/// Close the connection of a slot that was closed by the client (or whose client died).
+void closeByClient(ShmLayer& layer, size_t index) noexcept {
+    auto* conn = layer.connections[index];
+    if (conn == nullptr) {
+        getSlot(layer.base, index).state.store(SlotFree);
+        return;
+    }
+    conn->freeSlot = true;
+    conn->connection.state = UA_CONNECTIONSTATE_CLOSED;
+    removeConnection(layer, conn);
+}
+
+ShmConnection* acceptConnection(ShmLayer& layer, size_t index) noexcept {
+    auto* conn = new (std::nothrow) ShmConnection{};  // NOLINT(*-owning-memory)
+    if (conn == nullptr) {
+        return nullptr;
+    }
+    conn->layer = &layer;
+    conn->slot = index;
+    auto& connection = conn->connection;
+    connection.state = UA_CONNECTIONSTATE_OPENING;
+    connection.sockfd = UA_INVALID_SOCKET;
+    connection.handle = &layer;
+    connection.openingDate = UA_DateTime_nowMonotonic();
+    connection.getSendBuffer = getSendBuffer;
+    connection.releaseSendBuffer = releaseBuffer;
+    connection.send = sendServerBuffer;
+    connection.recv = recvServerBuffer;
+    connection.releaseRecvBuffer = releaseServerRecvBuffer;
+    connection.close = closeServerConnection;
+    connection.free = freeServerConnection;
+    layer.connections[index] = conn;
+    return conn;
+}
+
+/// Free the slots of clients that died without closing their connection.
+void releaseDeadClients(ShmLayer& layer) noexcept {
+    const auto now = UA_DateTime_nowMonotonic();
+    if (now < layer.nextPeerCheck) {
+        return;
+    }
+    layer.nextPeerCheck = now + peerCheckInterval;
+    for (size_t i = 0; i < layer.slotCount; ++i) {
+        auto& slot = getSlot(layer.base, i);
+        const uint32_t state = slot.state.load();
+        if (state == SlotFree || isProcessAlive(slot.clientPid.load())) {
+            continue;
+        }
+        closeByClient(layer, i);
+    }
+}
+
+bool hasPendingWork(ShmLayer& layer) noexcept {
+    if (!layer.closed.empty()) {
+        return true;
+    }
+    for (size_t i = 0; i < layer.slotCount; ++i) {
+        auto& slot = getSlot(layer.base, i);
+        const uint32_t state = slot.state.load();
+        const auto* conn = layer.connections[i];
+        if ((state == SlotOpen && conn == nullptr) || state == SlotClosedByClient) {
+            return true;
+        }
+        if (conn != nullptr && getAvailable(slot.toServer) > 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+UA_StatusCode createSegment(ShmLayer& layer, const UA_Logger* logger) {
+    // remove the segment of a previous server that died, keep the segment of a running server
+    const int existing = ::shm_open(layer.segmentName.c_str(), O_RDONLY, 0);
+    if (existing >= 0) {
+        struct stat info {};
+        bool inUse = false;
+        if (::fstat(existing, &info) == 0 &&
+            static_cast<size_t>(info.st_size) >= sizeof(SegmentHeader)) {
+            void* base = ::mmap(nullptr, sizeof(SegmentHeader), PROT_READ, MAP_SHARED, existing, 0);
+            if (base != MAP_FAILED) {
+                inUse = isProcessAlive(getHeader(base).serverPid.load());
+                ::munmap(base, sizeof(SegmentHeader));
+            }
+        }
+        ::close(existing);
+        if (inUse) {
+            UA_LOG_WARNING(
+                logger,
+                UA_LOGCATEGORY_NETWORK,
+                "Shared memory segment %s is used by another server",
+                layer.segmentName.c_str()
+            );
+            return UA_STATUSCODE_BADCOMMUNICATIONERROR;
+        }
+        ::shm_unlink(layer.segmentName.c_str());
+    }
+
+    const int fd = ::shm_open(
+        layer.segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR | O_CLOEXEC, layer.permissions
+    );
+    if (fd < 0) {
+        return UA_STATUSCODE_BADCOMMUNICATIONERROR;
+    }
+    ::fchmod(fd, layer.permissions);  // not restricted by the umask
+    layer.size = getSegmentSize(layer.slotCount, layer.ringSize);
+    void* base = MAP_FAILED;
+    if (::ftruncate(fd, static_cast<off_t>(layer.size)) == 0) {
+        base = ::mmap(nullptr, layer.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    ::close(fd);
+    if (base == MAP_FAILED) {
+        ::shm_unlink(layer.segmentName.c_str());
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    layer.base = base;
+
+    // the mapping is zero-initialized, construct the shared objects in place
+    auto* header = new (base) SegmentHeader{};
+    header->magic = segmentMagic;
+    header->version = segmentVersion;
+    header->slotCount = static_cast<uint32_t>(layer.slotCount);
+    header->ringSize = static_cast<uint32_t>(layer.ringSize);
+    for (size_t i = 0; i < layer.slotCount; ++i) {
+        new (&getSlot(base, i)) SlotHeader{};
+    }
+    header->serverPid.store(static_cast<int32_t>(::getpid()));
+    header->ready.store(1, std::memory_order_release);
+    return UA_STATUSCODE_GOOD;
+}
+
+void removeSegment(ShmLayer& layer) noexcept {
+    if (layer.base == nullptr) {
+        return;
+    }
+    auto& header = getHeader(layer.base);
+    header.serverPid.store(0);
+    for (size_t i = 0; i < layer.slotCount; ++i) {
+        notify(getSlot(layer.base, i).toClient.data);  // wake up waiting clients
+    }
+    ::munmap(layer.base, layer.size);
+    ::shm_unlink(layer.segmentName.c_str());
+    layer.base = nullptr;
+}
+
+UA_StatusCode startLayer(
+    UA_ServerNetworkLayer* nl, const UA_Logger* logger, const UA_String* /* customHostname */
+) {
+    auto& layer = getLayer(nl);
+    try {
+        const auto status = createSegment(layer, logger);
+        if (status != UA_STATUSCODE_GOOD) {
+            return status;
+        }
+        layer.connections.assign(layer.slotCount, nullptr);
+        const auto url = std::string(sharedMemoryScheme) + layer.name;
+        UA_String_clear(&nl->discoveryUrl);
+        nl->discoveryUrl = UA_STRING_ALLOC(url.c_str());
+        UA_LOG_INFO(
+            logger, UA_LOGCATEGORY_NETWORK, "Shared memory transport listening on %s", url.c_str()
+        );
+    } catch (const std::bad_alloc&) {
+        removeSegment(layer);
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+UA_StatusCode listenLayer(UA_ServerNetworkLayer* nl, UA_Server* server, UA_UInt16 timeout) {
+    auto& layer = getLayer(nl);
+    layer.server = server;
+    if (layer.base == nullptr) {
+        return UA_STATUSCODE_BADINVALIDSTATE;
+    }
+    try {
+        layer.recvBuffer.resize(nl->localConnectionConfig.recvBufferSize);
+    } catch (const std::bad_alloc&) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    removeClosedConnections(layer);
+    releaseDeadClients(layer);
+
+    // other network layers wait within the same iteration, poll the rings then
+    if (UA_Server_getConfig(server)->networkLayersSize == 1) {
+        waitFor(getHeader(layer.base).serverWakeup, timeout, [&] {
+            return hasPendingWork(layer);
+        });
+    }
+
+    for (size_t i = 0; i < layer.slotCount; ++i) {
+        const uint32_t state = getSlot(layer.base, i).state.load();
+        auto* conn = layer.connections[i];
+        if (state == SlotClosedByClient) {
+            closeByClient(layer, i);
+            continue;
+        }
+        if (state == SlotOpen && conn == nullptr) {
+            conn = acceptConnection(layer, i);
+        }
+        if (conn == nullptr) {
+            continue;
+        }
+        // one buffer per connection and listen, remaining data is processed with the next listen
+        UA_ByteString buf = UA_BYTESTRING_NULL;
+        if (recvServerBuffer(&conn->connection, &buf, 0) == UA_STATUSCODE_GOOD) {
+            UA_Server_processBinaryMessage(server, &conn->connection, &buf);
+            releaseServerRecvBuffer(&conn->connection, &buf);
+        }
+    }
+    removeClosedConnections(layer);
+    return UA_STATUSCODE_GOOD;
+}
+
+void stopLayer(UA_ServerNetworkLayer* nl, UA_Server* server) {
+    auto& layer = getLayer(nl);
+    layer.server = server;
+    if (layer.base == nullptr) {
+        return;
+    }
+    for (auto* conn : layer.connections) {
+        if (conn != nullptr) {
+            closeServerConnection(&conn->connection);
+        }
+    }
+    removeClosedConnections(layer);
+    for (auto* conn : layer.connections) {
+        if (conn != nullptr) {
+            removeConnection(layer, conn);  // not in the closed list (out of memory)
+        }
+    }
+    removeSegment(layer);
+}
+
+void clearLayer(UA_ServerNetworkLayer* nl) {
+    auto* layer = static_cast<ShmLayer*>(nl->handle);
+    if (layer != nullptr) {
+        removeSegment(*layer);
+        delete layer;  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+    nl->handle = nullptr;
+    UA_String_clear(&nl->discoveryUrl);
+}
+
+/* -------------------------------------- Client connection ------------------------------------- */
+
+struct ShmClient {
+    void* base{nullptr};
+    size_t size{0};
+    size_t ringSize{0};
+    size_t slot{0};
+};
+
+ShmClient* getClient(UA_Connection* connection) noexcept {
+    return static_cast<ShmClient*>(connection->handle);
+}
+
+bool isClientOpen(ShmClient& client) noexcept {
+    const auto& header = getHeader(client.base);
+    return header.serverPid.load() != 0 &&
+           getSlot(client.base, client.slot).state.load() == SlotOpen;
+}
+
+void closeClientConnection(UA_Connection* connection) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return;
+    }
+    connection->state = UA_CONNECTIONSTATE_CLOSED;
+    auto* client = getClient(connection);
+    if (client == nullptr) {
+        return;
+    }
+    auto& slot = getSlot(client->base, client->slot);
+    uint32_t expected = SlotOpen;
+    if (slot.state.compare_exchange_strong(expected, SlotClosedByClient)) {
+        notify(getHeader(client->base).serverWakeup);
+    } else {
+        slot.state.store(SlotFree);  // closed by the server before
+    }
+}
+
+UA_StatusCode sendClientBuffer(UA_Connection* connection, UA_ByteString* buf) {
+    UA_StatusCode status = UA_STATUSCODE_GOOD;
+    auto* client = getClient(connection);
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED || client == nullptr) {
+        status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+    } else {
+        auto& slot = getSlot(client->base, client->slot);
+        auto& header = getHeader(client->base);
+        const bool written = writeAll(
+            slot, slot.toServer, client->ringSize, header.serverWakeup, *buf, [&] {
+                return isClientOpen(*client) && isProcessAlive(header.serverPid.load());
+            }
+        );
+        if (!written) {
+            closeClientConnection(connection);
+            status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+        }
+    }
+    UA_ByteString_clear(buf);
+    return status;
+}
+
+UA_StatusCode recvClientBuffer(
+    UA_Connection* connection, UA_ByteString* response, UA_UInt32 timeout
+) {
+    auto* client = getClient(connection);
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED || client == nullptr) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    auto& slot = getSlot(client->base, client->slot);
+    auto& ring = slot.toClient;
+    if (getAvailable(ring) == 0) {
+        waitFor(ring.data, static_cast<int>(std::min<UA_UInt32>(timeout, INT_MAX)), [&] {
+            return getAvailable(ring) > 0 || !isClientOpen(*client);
+        });
+    }
+    if (getAvailable(ring) == 0) {
+        // remaining data is received before the close is reported
+        const auto& header = getHeader(client->base);
+        if (!isClientOpen(*client) || !isProcessAlive(header.serverPid.load())) {
+            closeClientConnection(connection);
+            return UA_STATUSCODE_BADCONNECTIONCLOSED;
+        }
+        return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+    }
+    const UA_StatusCode status = UA_ByteString_allocBuffer(
+        response, connection->config.recvBufferSize
+    );
+    if (status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    response->length = readRing(slot, ring, client->ringSize, response->data, response->length);
+    return UA_STATUSCODE_GOOD;
+}
+
+void freeClientConnection(UA_Connection* connection) {
+    auto* client = getClient(connection);
+    if (client != nullptr) {
+        ::munmap(client->base, client->size);
+        delete client;  // NOLINT(cppcoreguidelines-owning-memory)
+    }
+    connection->handle = nullptr;
+}
+
+/// Check the header of a mapped segment before any offsets are derived from it.
+UA_StatusCode validateSegment(const SegmentHeader& header, size_t size) noexcept {
+    if (header.ready.load(std::memory_order_acquire) != 1 ||
+        !isProcessAlive(header.serverPid.load())) {
+        return UA_STATUSCODE_BADNOTFOUND;  // not running (yet)
+    }
+    if (header.magic != segmentMagic || header.version != segmentVersion) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    // the ring positions are mapped with `ringSize - 1` as mask
+    const size_t ringSize = header.ringSize;
+    if (ringSize < minRingSize || (ringSize & (ringSize - 1)) != 0) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    // all slots must be inside the mapping, compared without overflow
+    const size_t maxSlotCount = (size - sizeof(SegmentHeader)) / getSlotStride(ringSize);
+    if (header.slotCount == 0 || header.slotCount > maxSlotCount ||
+        size != getSegmentSize(header.slotCount, ringSize)) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    return UA_STATUSCODE_GOOD;
+}
+
+/**
+ * Map the segment of a running server.
+ * @return BadNotFound if no server is listening, BadInvalidArgument for corrupt or foreign segments
+ */
+UA_StatusCode mapSegment(const std::string& segmentName, void*& base, size_t& size) noexcept {
+    base = nullptr;
+    const int fd = ::shm_open(segmentName.c_str(), O_RDWR | O_CLOEXEC, 0);
+    if (fd < 0) {
+        return UA_STATUSCODE_BADNOTFOUND;
+    }
+    struct stat info {};
+    if (::fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) < sizeof(SegmentHeader)) {
+        ::close(fd);
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    size = static_cast<size_t>(info.st_size);
+    void* mapped = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mapped == MAP_FAILED) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    const auto status = validateSegment(getHeader(mapped), size);
+    if (status != UA_STATUSCODE_GOOD) {
+        ::munmap(mapped, size);
+        return status;
+    }
+    base = mapped;
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace
+
+UA_StatusCode initSharedMemoryNetworkLayer(
+    UA_ServerNetworkLayer& nl,
+    std::string_view name,
+    const SharedMemoryOptions& options,
+    const UA_ConnectionConfig& config
+) {
+    if (!isValidName(name) || options.maxConnections == 0) {
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    }
+    auto* layer = new (std::nothrow) ShmLayer{};  // NOLINT(cppcoreguidelines-owning-memory)
+    if (layer == nullptr) {
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    try {
+        layer->name = name;
+        layer->segmentName = getSegmentName(name);
+    } catch (const std::bad_alloc&) {
+        delete layer;  // NOLINT(cppcoreguidelines-owning-memory)
+        return UA_STATUSCODE_BADOUTOFMEMORY;
+    }
+    layer->slotCount = options.maxConnections;
+    // power of two to map the positions with a mask
+    layer->ringSize = minRingSize;
+    while (layer->ringSize < options.ringSize && layer->ringSize < (size_t{1} << 30)) {
+        layer->ringSize *= 2;
+    }
+    layer->permissions = static_cast<mode_t>(options.permissions);
+    nl = UA_ServerNetworkLayer{};
+    nl.handle = layer;
+    nl.localConnectionConfig = config;
+    nl.start = startLayer;
+    nl.listen = listenLayer;
+    nl.stop = stopLayer;
+    nl.clear = clearLayer;
+    return UA_STATUSCODE_GOOD;
+}
+
+bool isSharedMemoryNetworkLayer(const UA_ServerNetworkLayer& nl) noexcept {
+    return nl.start == startLayer;
+}
+
+bool isSharedMemoryUrl(std::string_view url) noexcept {
+    return url.substr(0, sharedMemoryScheme.size()) == sharedMemoryScheme;
+}
+
+UA_Connection createSharedMemoryConnection(
+    const UA_ConnectionConfig& config, std::string_view url, const UA_Logger* logger
+) {
+    UA_Connection connection{};
+    connection.state = UA_CONNECTIONSTATE_CLOSED;
+    connection.config = config;
+    connection.sockfd = UA_INVALID_SOCKET;
+    connection.getSendBuffer = getSendBuffer;
+    connection.releaseSendBuffer = releaseBuffer;
+    connection.send = sendClientBuffer;
+    connection.recv = recvClientBuffer;
+    connection.releaseRecvBuffer = releaseBuffer;
+    connection.close = closeClientConnection;
+    connection.free = freeClientConnection;
+
+    // opc.shm://name[/path]
+    std::string_view name = url.substr(sharedMemoryScheme.size());
+    name = name.substr(0, name.find('/'));
+    if (!isValidName(name)) {
+        UA_LOG_WARNING(logger, UA_LOGCATEGORY_NETWORK, "Invalid shared memory endpoint URL");
+        return connection;
+    }
+    auto* client = new (std::nothrow) ShmClient{};  // NOLINT(cppcoreguidelines-owning-memory)
+    if (client == nullptr) {
+        return connection;
+    }
+    UA_StatusCode status = UA_STATUSCODE_BADOUTOFMEMORY;
+    try {
+        status = mapSegment(getSegmentName(name), client->base, client->size);
+    } catch (const std::bad_alloc&) {
+    }
+    if (status != UA_STATUSCODE_GOOD) {
+        UA_LOG_WARNING(
+            logger,
+            UA_LOGCATEGORY_NETWORK,
+            status == UA_STATUSCODE_BADINVALIDARGUMENT
+                ? "Invalid shared memory segment of the endpoint"
+                : "No server listening on shared memory endpoint"
+        );
+        delete client;  // NOLINT(cppcoreguidelines-owning-memory)
+        return connection;
+    }
+    auto& header = getHeader(client->base);
+    client->ringSize = header.ringSize;
+    for (size_t i = 0; i < header.slotCount; ++i) {
+        auto& slot = getSlot(client->base, i);
+        uint32_t expected = SlotFree;
+        if (!slot.state.compare_exchange_strong(expected, SlotClaimed)) {
+            continue;
+        }
+        for (auto* ring : {&slot.toServer, &slot.toClient}) {
+            ring->writePos.store(0);
+            ring->readPos.store(0);
+        }
+        slot.clientPid.store(static_cast<int32_t>(::getpid()));
+        slot.state.store(SlotOpen);
+        notify(header.serverWakeup);
+        client->slot = i;
+        connection.handle = client;
+        connection.state = UA_CONNECTIONSTATE_OPENING;
+        return connection;
+    }
+    UA_LOG_WARNING(
+        logger, UA_LOGCATEGORY_NETWORK, "All connections of the shared memory endpoint are in use"
+    );
+    ::munmap(client->base, client->size);
+    delete client;  // NOLINT(cppcoreguidelines-owning-memory)
+    return connection;
+}
+
+bool isSharedMemoryConnection(const UA_Connection& connection) noexcept {
+    return connection.free == freeClientConnection;
+}
+
+UA_StatusCode pollSharedMemoryConnection(UA_Connection& connection) noexcept {
+    if (connection.state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADDISCONNECT;
+    }
+    connection.state = UA_CONNECTIONSTATE_ESTABLISHED;
+    return UA_STATUSCODE_GOOD;
+}
+
+}  // namespace opcua::detail
+
+#endif
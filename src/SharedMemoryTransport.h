@@ -0,0 +1,72 @@
+#pragma once
+
+#include <string_view>
+
+#include "open62541pp/Config.h"
+
+#include "open62541_impl.h"
+
+// network layer and client connection plugin API of open62541 v1.1 - v1.3, futex of Linux
+#if defined(__linux__) && UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+#define UAPP_SHARED_MEMORY_TRANSPORT
+#endif
+
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+
+namespace opcua {
+struct SharedMemoryOptions;
+}  // namespace opcua
+
+namespace opcua::detail {
+
+/// URL scheme of the shared memory transport, e.g. `opc.shm://name`.
+inline constexpr std::string_view sharedMemoryScheme = "opc.shm://";
+
+/**
+ * Initialize a server network layer of the shared memory transport (`opc.shm://name`).
+ *
+ * The layer creates a POSIX shared memory segment `/uapp-<name>` with one slot per connection.
+ * A slot holds two lock-free single-producer single-consumer byte rings (client to server and
+ * server to client). The binary protocol (Hello, secure channel, chunks) is unchanged, only the
+ * TCP socket is replaced by the rings. Readers waiting for data are woken with futexes, writers
+ * skip the syscall if the reader is busy.
+ *
+ * The layer waits for messages only if it is the only network layer of the server, otherwise it
+ * polls the rings and the other layers wait.
+ *
+ * @param nl Network layer to initialize (overwritten, not cleared)
+ * @param name Name of the segment, without slashes
+ * @param options Number of connection slots and ring size
+ * @param config Connection config, e.g. of the TCP network layer
+ */
+UA_StatusCode initSharedMemoryNetworkLayer(
+    UA_ServerNetworkLayer& nl,
+    std::string_view name,
+    const SharedMemoryOptions& options,
+    const UA_ConnectionConfig& config
+);
+
+/// Check if the network layer was created with initSharedMemoryNetworkLayer.
+bool isSharedMemoryNetworkLayer(const UA_ServerNetworkLayer& nl) noexcept;
+
+/// Check if the endpoint URL uses the shared memory transport (`opc.shm://`).
+bool isSharedMemoryUrl(std::string_view url) noexcept;
+
+/**
+ * Create a client connection to the shared memory segment of a server (`opc.shm://name`).
+ * The connection is created in the opening state and established by the next poll
+ * (see pollSharedMemoryConnection). The state is closed if no slot could be claimed.
+ */
+UA_Connection createSharedMemoryConnection(
+    const UA_ConnectionConfig& config, std::string_view url, const UA_Logger* logger
+);
+
+/// Check if the connection was created with createSharedMemoryConnection.
+bool isSharedMemoryConnection(const UA_Connection& connection) noexcept;
+
+/// Establish a connection created with createSharedMemoryConnection.
+UA_StatusCode pollSharedMemoryConnection(UA_Connection& connection) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
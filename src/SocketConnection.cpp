@@ -0,0 +1,147 @@
+#include "SocketConnection.h"
+
+#ifdef UAPP_SOCKET_CONNECTION
+
+#include <cerrno>
+
+#include <netinet/in.h>  // IPPROTO_TCP
+#include <netinet/tcp.h>  // TCP_NODELAY
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>  // close
+
+namespace opcua::detail {
+
+static UA_StatusCode getSendBuffer(UA_Connection* connection, size_t length, UA_ByteString* buf) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    if (length > connection->config.sendBufferSize) {
+        return UA_STATUSCODE_BADCOMMUNICATIONERROR;
+    }
+    return UA_ByteString_allocBuffer(buf, length);
+}
+
+static void releaseBuffer(UA_Connection* /* connection */, UA_ByteString* buf) {
+    UA_ByteString_clear(buf);
+}
+
+static void closeConnection(UA_Connection* connection) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return;
+    }
+    ::shutdown(connection->sockfd, SHUT_RDWR);
+    connection->state = UA_CONNECTIONSTATE_CLOSED;
+}
+
+/// Send the whole buffer (blocking socket) and release it.
+static UA_StatusCode sendBuffer(UA_Connection* connection, UA_ByteString* buf) {
+    UA_StatusCode status = UA_STATUSCODE_GOOD;
+    size_t written = 0;
+    while (written < buf->length) {
+        if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+            status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+            break;
+        }
+        const ssize_t n = ::send(
+            connection->sockfd, buf->data + written, buf->length - written, MSG_NOSIGNAL
+        );
+        if (n >= 0) {
+            written += static_cast<size_t>(n);
+        } else if (errno != EINTR) {
+            closeConnection(connection);
+            status = UA_STATUSCODE_BADCONNECTIONCLOSED;
+            break;
+        }
+    }
+    UA_ByteString_clear(buf);
+    return status;
+}
+
+static UA_StatusCode recvBuffer(
+    UA_Connection* connection, UA_ByteString* response, UA_UInt32 timeout
+) {
+    if (connection->state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    pollfd pfd{static_cast<int>(connection->sockfd), POLLIN, 0};
+    const int ready = ::poll(&pfd, 1, static_cast<int>(timeout));
+    if (ready == 0 || (ready < 0 && errno == EINTR)) {
+        return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+    }
+    const UA_StatusCode status = UA_ByteString_allocBuffer(
+        response, connection->config.recvBufferSize
+    );
+    if (status != UA_STATUSCODE_GOOD) {
+        return status;
+    }
+    ssize_t n = -1;
+    if (ready > 0) {
+        n = ::recv(connection->sockfd, response->data, response->length, 0);
+    }
+    if (n <= 0) {
+        UA_ByteString_clear(response);
+        if (n < 0 && (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK)) {
+            return UA_STATUSCODE_GOODNONCRITICALTIMEOUT;
+        }
+        closeConnection(connection);
+        return UA_STATUSCODE_BADCONNECTIONCLOSED;
+    }
+    response->length = static_cast<size_t>(n);
+    return UA_STATUSCODE_GOOD;
+}
+
+static void freeConnection(UA_Connection* connection) {
+    if (connection->sockfd != UA_INVALID_SOCKET) {
+        ::close(static_cast<int>(connection->sockfd));
+        connection->sockfd = UA_INVALID_SOCKET;
+    }
+}
+
+UA_Connection createSocketConnection(int fd, const UA_ConnectionConfig& config) {
+    UA_Connection connection{};
+    connection.state = UA_CONNECTIONSTATE_OPENING;
+    connection.config = config;
+    connection.sockfd = fd;
+    connection.getSendBuffer = getSendBuffer;
+    connection.releaseSendBuffer = releaseBuffer;
+    connection.send = sendBuffer;
+    connection.recv = recvBuffer;
+    connection.releaseRecvBuffer = releaseBuffer;
+    connection.close = closeConnection;
+    connection.free = freeConnection;
+    return connection;
+}
+
+bool isSocketConnection(const UA_Connection& connection) noexcept {
+    return connection.free == freeConnection;
+}
+
+UA_StatusCode pollSocketConnection(UA_Connection& connection) noexcept {
+    if (connection.state == UA_CONNECTIONSTATE_CLOSED) {
+        return UA_STATUSCODE_BADDISCONNECT;
+    }
+    connection.state = UA_CONNECTIONSTATE_ESTABLISHED;
+    return UA_STATUSCODE_GOOD;
+}
+
+bool applySocketOptions(int fd, const TransportConfig& config) noexcept {
+    const auto setOption = [fd](int level, int name, int value) {
+        return ::setsockopt(fd, level, name, &value, sizeof(value)) == 0;
+    };
+    bool ok = true;
+    if (config.noDelay) {
+        ok &= setOption(IPPROTO_TCP, TCP_NODELAY, *config.noDelay ? 1 : 0);
+    }
+    if (config.socketSendBufferSize) {
+        ok &= setOption(SOL_SOCKET, SO_SNDBUF, static_cast<int>(*config.socketSendBufferSize));
+    }
+    if (config.socketRecvBufferSize) {
+        ok &= setOption(SOL_SOCKET, SO_RCVBUF, static_cast<int>(*config.socketRecvBufferSize));
+    }
+    return ok;
+}
+
+}  // namespace opcua::detail
+
+#endif
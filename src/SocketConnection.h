@@ -0,0 +1,38 @@
+#pragma once
+
+#include "open62541pp/Common.h"  // TransportConfig
+#include "open62541pp/Config.h"
+
+#include "open62541_impl.h"
+
+// client connection plugin API of open62541 v1.1 - v1.3 (replaced by the event loop in v1.4)
+#if !defined(_WIN32) && UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+#define UAPP_SOCKET_CONNECTION
+#endif
+
+#ifdef UAPP_SOCKET_CONNECTION
+
+namespace opcua::detail {
+
+/**
+ * Create a client connection of an already connected socket, e.g. accepted by a
+ * ReverseConnectListener. The connection takes ownership of the socket and closes it when freed.
+ *
+ * The connection is created in the opening state like the connections of the TCP network layer and
+ * is established by the next poll (see pollSocketConnection).
+ */
+UA_Connection createSocketConnection(int fd, const UA_ConnectionConfig& config);
+
+/// Check if the connection was created with createSocketConnection.
+bool isSocketConnection(const UA_Connection& connection) noexcept;
+
+/// Establish a connection created with createSocketConnection.
+UA_StatusCode pollSocketConnection(UA_Connection& connection) noexcept;
+
+/// Apply the socket options of the transport config (unset options are left unchanged).
+/// @return `false` if an option could not be set
+bool applySocketOptions(int fd, const TransportConfig& config) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
@@ -0,0 +1,143 @@
+#include "open62541pp/Statistics.h"
+
+#include <algorithm>  // clamp, max, min
+#include <cmath>  // ceil
+
+#include "open62541pp/ErrorHandling.h"
+
+namespace opcua {
+
+static size_t getMostSignificantBit(uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - static_cast<size_t>(__builtin_clzll(value));
+#else
+    size_t msb = 0;
+    while (value >>= 1) {
+        ++msb;
+    }
+    return msb;
+#endif
+}
+
+static void updateMax(std::atomic<uint64_t>& max, uint64_t value) noexcept {
+    uint64_t current = max.load(std::memory_order_relaxed);
+    while (current < value &&
+           !max.compare_exchange_weak(current, value, std::memory_order_relaxed)) {
+    }
+}
+
+size_t LatencyHistogram::getBucketIndex(uint64_t value) noexcept {
+    if (value < subBucketCount) {
+        return static_cast<size_t>(value);
+    }
+    const size_t msb = std::min(getMostSignificantBit(value), maxValueBits - 1);
+    const size_t shift = msb - subBucketBits;
+    if (msb == maxValueBits - 1 && (value >> msb) > 1) {
+        return bucketCount - 1;  // overflow
+    }
+    const auto subBucket = static_cast<size_t>((value >> shift) & (subBucketCount - 1));
+    return (shift + 1) * subBucketCount + subBucket;
+}
+
+uint64_t LatencyHistogram::getBucketUpperBound(size_t index) noexcept {
+    if (index < subBucketCount) {
+        return index;
+    }
+    const size_t shift = index / subBucketCount - 1;
+    const uint64_t lower = (subBucketCount + index % subBucketCount) << shift;
+    return lower + (uint64_t{1} << shift) - 1;
+}
+
+void LatencyHistogram::record(Duration latency) noexcept {
+    const auto value = static_cast<uint64_t>(std::max(latency.count(), Duration::rep{0}));
+    buckets_[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    count_.fetch_add(1, std::memory_order_relaxed);
+    sum_.fetch_add(value, std::memory_order_relaxed);
+    updateMax(max_, value);
+}
+
+uint64_t LatencyHistogram::getCount() const noexcept {
+    return count_.load(std::memory_order_relaxed);
+}
+
+LatencyHistogram::Duration LatencyHistogram::getSum() const noexcept {
+    return Duration(static_cast<Duration::rep>(sum_.load(std::memory_order_relaxed)));
+}
+
+LatencyHistogram::Duration LatencyHistogram::getMean() const noexcept {
+    const auto count = getCount();
+    return count == 0 ? Duration{0} : getSum() / static_cast<Duration::rep>(count);
+}
+
+LatencyHistogram::Duration LatencyHistogram::getMax() const noexcept {
+    return Duration(static_cast<Duration::rep>(max_.load(std::memory_order_relaxed)));
+}
+
+LatencyHistogram::Duration LatencyHistogram::getPercentile(double percentile) const noexcept {
+    const auto count = getCount();
+    if (count == 0) {
+        return Duration{0};
+    }
+    const double fraction = std::clamp(percentile, 0.0, 100.0) / 100.0;
+    const auto rank = std::max(
+        uint64_t{1}, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(count)))
+    );
+    const auto max = static_cast<uint64_t>(getMax().count());
+    uint64_t cumulated = 0;
+    for (size_t i = 0; i < bucketCount; ++i) {
+        cumulated += buckets_[i].load(std::memory_order_relaxed);
+        if (cumulated >= rank) {
+            if (i == bucketCount - 1) {
+                return getMax();  // overflow bucket without upper bound
+            }
+            return Duration(static_cast<Duration::rep>(std::min(getBucketUpperBound(i), max)));
+        }
+    }
+    return getMax();
+}
+
+void LatencyHistogram::reset() noexcept {
+    for (auto& bucket : buckets_) {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+    count_.store(0, std::memory_order_relaxed);
+    sum_.store(0, std::memory_order_relaxed);
+    max_.store(0, std::memory_order_relaxed);
+}
+
+static void resetOperation(OperationStatistics& stats) noexcept {
+    stats.latency.reset();
+    stats.errorCount.store(0, std::memory_order_relaxed);
+}
+
+static void recordOperation(
+    OperationStatistics& stats, Statistics::Clock::time_point start, UA_StatusCode status
+) noexcept {
+    stats.latency.record(Statistics::Clock::now() - start);
+    if (detail::isBadStatus(status)) {
+        stats.errorCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void Statistics::reset() noexcept {
+    for (auto& stats : services_) {
+        resetOperation(stats);
+    }
+    for (auto& stats : callbacks_) {
+        resetOperation(stats);
+    }
+}
+
+void Statistics::record(
+    StatisticsService service, Clock::time_point start, UA_StatusCode status
+) noexcept {
+    recordOperation(services_[static_cast<size_t>(service)], start, status);
+}
+
+void Statistics::record(
+    StatisticsCallback callback, Clock::time_point start, UA_StatusCode status
+) noexcept {
+    recordOperation(callbacks_[static_cast<size_t>(callback)], start, status);
+}
+
+}  // namespace opcua
@@ -3,17 +3,23 @@
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
 #include <atomic>
+#include <memory>
 #include <utility>  // move
+#include <vector>
 
 #include "open62541pp/Client.h"
+#include "open62541pp/EventFilterBuilder.h"  // SharedEventFilter
 #include "open62541pp/Server.h"
 #include "open62541pp/Span.h"
 #include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/Subscription.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/ExtensionObject.h"
 
 #include "ClientContext.h"
 #include "ServerContext.h"
+#include "detail/LastReportedValue.h"
+#include "services/OperationLimits.h"
 
 namespace opcua {
 
@@ -42,6 +48,75 @@ MonitoredItem<T> Subscription<T>::subscribeDataChange(
     );
 }
 
+/// Share the value of a data change with other monitored items of the node.
+static SharedVariant shareDataChangeValue(
+    Server& server, const NodeId& id, const DataValue& value
+) {
+    auto& context = server.getContext();
+    const UA_Variant& variant = value->value;
+    const SharedVariant* sample = context.sharedSample;
+    if (sample != nullptr && (*sample)->handle()->type == variant.type &&
+        (*sample)->handle()->data == variant.data) {
+        return *sample;  // event-driven sample, read once for all monitored items of the node
+    }
+    // monitored items sampled by open62541 read the value individually, reuse equal payloads
+    const auto it = context.sharedValues.find(id);
+    if (it == context.sharedValues.end()) {
+        return context.sharedValues.emplace(id, SharedVariant(value.getValue())).first->second;
+    }
+    if (!detail::isEqualValue(*it->second->handle(), variant)) {
+        it->second = SharedVariant(value.getValue());
+    }
+    return it->second;
+}
+
+/// Take over the value of a data change, the notification is cleared after the callback anyway.
+static SharedVariant shareDataChangeValue(
+    [[maybe_unused]] Client& client, [[maybe_unused]] const NodeId& id, DataValue& value
+) {
+    return SharedVariant(std::move(value.getValue()));
+}
+
+template <typename T>
+MonitoredItem<T> Subscription<T>::subscribeDataChangeShared(
+    const NodeId& id, SharedDataChangeCallback<T> onDataChange
+) {
+    MonitoringParameters parameters;
+    return subscribeDataChangeShared(
+        id, MonitoringMode::Reporting, parameters, std::move(onDataChange)
+    );
+}
+
+template <typename T>
+MonitoredItem<T> Subscription<T>::subscribeDataChangeShared(
+    const NodeId& id,
+    MonitoringMode monitoringMode,
+    MonitoringParameters& parameters,
+    SharedDataChangeCallback<T> onDataChange
+) {
+    return subscribeDataChange(
+        id,
+        AttributeId::Value,
+        monitoringMode,
+        parameters,
+        [connectionPtr = &connection_, id, callback = std::move(onDataChange)](
+            const MonitoredItem<T>& item, const DataValue& value
+        ) {
+            const UA_DataValue& native = *value.handle();
+            const DateTime sourceTimestamp(native.hasSourceTimestamp ? native.sourceTimestamp : 0);
+            const StatusCode status = native.hasStatus ? native.status : UA_STATUSCODE_GOOD;
+            // the notification is not used after the callback of the monitored item
+            auto& mutableValue = const_cast<DataValue&>(value);  // NOLINT
+            callback(
+                item,
+                shareDataChangeValue(*connectionPtr, id, mutableValue),
+                sourceTimestamp,
+                status
+            );
+        }
+    );
+}
+
 /* ----------------------------------- Server specializations ----------------------------------- */
 
 template <>
@@ -62,6 +137,13 @@ std::vector<MonitoredItem<Server>> Subscription<Server>::getMonitoredItems() {
     return result;
 }
 
+template <>
+SubscriptionStatistics Subscription<Server>::getStatistics() {
+    SubscriptionStatistics stats;
+    connection_.getContext().subscriptionHealth.fill(stats);
+    return stats;
+}
+
 template <>
 MonitoredItem<Server> Subscription<Server>::subscribeDataChange(
     const NodeId& id,
@@ -105,17 +187,40 @@ Subscription<Client>::Subscription(Client& connection, uint32_t subscriptionId)
 
 template <>
 std::vector<MonitoredItem<Client>> Subscription<Client>::getMonitoredItems() {
-    const auto& monitoredItems = connection_.getContext().monitoredItems;
+    const auto& subscriptions = connection_.getContext().subscriptions;
     std::vector<MonitoredItem<Client>> result;
-    for (const auto& [subMonId, _] : monitoredItems) {
-        const auto [subId, monId] = subMonId;
-        if (subId == subscriptionId_) {
-            result.emplace_back(connection_, subId, monId);
-        }
+    const auto it = subscriptions.find(subscriptionId_);
+    if (it == subscriptions.end()) {
+        return result;
+    }
+    const auto& monitoredItems = it->second->monitoredItems;
+    result.reserve(monitoredItems.size());
+    for (const auto& [monId, _] : monitoredItems) {
+        result.emplace_back(connection_, subscriptionId_, monId);
     }
     return result;
 }
 
+template <>
+SubscriptionStatistics Subscription<Client>::getStatistics() {
+    SubscriptionStatistics stats;
+    const auto& subscriptions = connection_.getContext().subscriptions;
+    const auto it = subscriptions.find(subscriptionId_);
+    if (it == subscriptions.end()) {
+        throw BadStatus(UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID);
+    }
+    auto& sub = *it->second;
+    sub.health.fill(stats);
+    stats.queuedCount = sub.pendingDataChanges.size();
+    if (sub.notificationQueue != nullptr) {
+        stats.queuedCount += sub.notificationQueue->size();
+        stats.droppedCount = sub.notificationQueue->getDroppedCount();
+    }
+    stats.publishRequests = UA_Client_getConfig(connection_.handle())->outStandingPublishRequests;
+    stats.parameters = sub.parameters;
+    return stats;
+}
+
 template <>
 void Subscription<Client>::setSubscriptionParameters(SubscriptionParameters& parameters) {
     services::modifySubscription(connection_, subscriptionId_, parameters);
@@ -126,6 +231,37 @@ void Subscription<Client>::setPublishingMode(bool publishing) {
     services::setPublishingMode(connection_, subscriptionId_, publishing);
 }
 
+template <>
+void Subscription<Client>::setDataChangeBatchCallback(services::DataChangeBatchCallback callback) {
+    services::setDataChangeBatchCallback(connection_, subscriptionId_, std::move(callback));
+}
+
+template <>
+std::shared_ptr<NotificationQueue> Subscription<Client>::enableNotificationQueue(
+    size_t capacity, NotificationQueueOverflow overflow
+) {
+    auto queue = std::make_shared<NotificationQueue>(capacity, overflow);
+    services::setNotificationQueue(connection_, subscriptionId_, queue);
+    return queue;
+}
+
+template <>
+void Subscription<Client>::disableNotificationQueue() {
+    services::setNotificationQueue(connection_, subscriptionId_, nullptr);
+}
+
+template <>
+void Subscription<Client>::enableAdaptivePublishing(
+    const services::AdaptivePublishingPolicy& policy
+) {
+    services::setAdaptivePublishing(connection_, subscriptionId_, policy);
+}
+
+template <>
+void Subscription<Client>::disableAdaptivePublishing() {
+    services::setAdaptivePublishing(connection_, subscriptionId_, std::nullopt);
+}
+
 template <>
 MonitoredItem<Client> Subscription<Client>::subscribeDataChange(
     const NodeId& id,
@@ -150,6 +286,46 @@ MonitoredItem<Client> Subscription<Client>::subscribeDataChange(
     return {connection_, subscriptionId_, monitoredItemId};
 }
 
+template <>
+std::vector<MonitoredItem<Client>> Subscription<Client>::subscribeDataChange(
+    Span<const NodeId> ids,
+    AttributeId attribute,
+    MonitoringMode monitoringMode,
+    MonitoringParameters& parameters,
+    DataChangeCallback<Client> onDataChange
+) {
+    std::vector<ReadValueId> itemsToMonitor;
+    itemsToMonitor.reserve(ids.size());
+    for (const auto& id : ids) {
+        itemsToMonitor.emplace_back(id, attribute);
+    }
+    // share the user callback between all monitored items
+    auto callback = std::make_shared<DataChangeCallback<Client>>(std::move(onDataChange));
+    const auto results = services::createMonitoredItemsDataChange(
+        connection_,
+        subscriptionId_,
+        itemsToMonitor,
+        monitoringMode,
+        parameters,
+        [connectionPtr = &connection_, callback = std::move(callback)](
+            uint32_t subId, uint32_t monId, const DataValue& value
+        ) {
+            const MonitoredItem<Client> monitoredItem(*connectionPtr, subId, monId);
+            (*callback)(monitoredItem, value);
+        }
+    );
+    std::vector<MonitoredItem<Client>> result;
+    result.reserve(results.size());
+    for (const auto& item : results) {
+        result.emplace_back(connection_, subscriptionId_, item.monitoredItemId);
+    }
+    if (!results.empty() && results.front().statusCode.isGood()) {
+        parameters.samplingInterval = results.front().revisedSamplingInterval;
+        parameters.queueSize = results.front().revisedQueueSize;
+    }
+    return result;
+}
+
 template <>
 MonitoredItem<Client> Subscription<Client>::subscribeEvent(
     const NodeId& id,
@@ -178,10 +354,115 @@ MonitoredItem<Client> Subscription<Client>::subscribeEvent(
     const NodeId& id, const EventFilter& eventFilter, EventCallback<Client> onEvent
 ) {
     MonitoringParameters parameters;
-    parameters.filter = ExtensionObject::fromDecodedCopy(eventFilter);
+    // the monitored item stores a copy to recreate the item, not the caller's filter
+    auto& filter = const_cast<EventFilter&>(eventFilter);  // NOLINT
+    parameters.filter = ExtensionObject::fromDecoded(filter);
     return subscribeEvent(id, MonitoringMode::Reporting, parameters, std::move(onEvent));
 }
 
+template <>
+MonitoredItem<Client> Subscription<Client>::subscribeEvent(
+    const NodeId& id, const SharedEventFilter& eventFilter, EventCallback<Client> onEvent
+) {
+    MonitoringParameters parameters;
+    const uint32_t monitoredItemId = services::createMonitoredItemEvent(
+        connection_,
+        subscriptionId_,
+        {id, AttributeId::EventNotifier},
+        MonitoringMode::Reporting,
+        parameters,
+        eventFilter,
+        [connectionPtr = &connection_, callback = std::move(onEvent)](
+            uint32_t subId, uint32_t monId, Span<const Variant> eventFields
+        ) {
+            const MonitoredItem<Client> monitoredItem(*connectionPtr, subId, monId);
+            callback(monitoredItem, eventFields);
+        }
+    );
+    return {connection_, subscriptionId_, monitoredItemId};
+}
+
+static std::vector<uint32_t> getMonitoredItemIds(Span<const MonitoredItem<Client>> items) {
+    std::vector<uint32_t> ids;
+    ids.reserve(items.size());
+    for (const auto& item : items) {
+        if (item.getMonitoredItemId() != 0U) {
+            ids.push_back(item.getMonitoredItemId());
+        }
+    }
+    return ids;
+}
+
+/// Add or remove triggering links, split by the `MaxMonitoredItemsPerCall` operation limit.
+static void setTriggeringLinks(
+    Client& client,
+    uint32_t subscriptionId,
+    uint32_t triggeringItemId,
+    Span<const uint32_t> linkedItemIds,
+    bool add
+) {
+    const size_t chunkSize = detail::getChunkSize(
+        detail::getOperationLimits(client).maxMonitoredItemsPerCall, linkedItemIds.size()
+    );
+    for (size_t offset = 0; offset < linkedItemIds.size(); offset += chunkSize) {
+        const auto chunk = linkedItemIds.subview(offset, chunkSize);
+        const Span<const uint32_t> none;
+        services::setTriggering(
+            client, subscriptionId, triggeringItemId, add ? chunk : none, add ? none : chunk
+        );
+    }
+}
+
+template <>
+void Subscription<Client>::linkTriggered(
+    const MonitoredItem<Client>& triggeringItem, Span<const MonitoredItem<Client>> linkedItems
+) {
+    const auto ids = getMonitoredItemIds(linkedItems);
+    const auto results = services::setMonitoringMode(
+        connection_, subscriptionId_, ids, MonitoringMode::Sampling
+    );
+    for (const auto& result : results) {
+        detail::throwOnBadStatus(result);
+    }
+    setTriggeringLinks(
+        connection_, subscriptionId_, triggeringItem.getMonitoredItemId(), ids, true
+    );
+}
+
+template <>
+std::vector<MonitoredItem<Client>> Subscription<Client>::linkTriggered(
+    const MonitoredItem<Client>& triggeringItem,
+    Span<const NodeId> ids,
+    AttributeId attribute,
+    MonitoringParameters& parameters,
+    DataChangeCallback<Client> onDataChange
+) {
+    auto items = subscribeDataChange(
+        ids, attribute, MonitoringMode::Sampling, parameters, std::move(onDataChange)
+    );
+    setTriggeringLinks(
+        connection_,
+        subscriptionId_,
+        triggeringItem.getMonitoredItemId(),
+        getMonitoredItemIds(items),
+        true
+    );
+    return items;
+}
+
+template <>
+void Subscription<Client>::unlinkTriggered(
+    const MonitoredItem<Client>& triggeringItem, Span<const MonitoredItem<Client>> linkedItems
+) {
+    setTriggeringLinks(
+        connection_,
+        subscriptionId_,
+        triggeringItem.getMonitoredItemId(),
+        getMonitoredItemIds(linkedItems),
+        false
+    );
+}
+
 template <>
 void Subscription<Client>::deleteSubscription() {
     services::deleteSubscription(connection_, subscriptionId_);
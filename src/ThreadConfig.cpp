@@ -0,0 +1,126 @@
+#include "open62541pp/ThreadConfig.h"
+
+#include "open62541pp/AllocStats.h"
+
+#include "open62541_impl.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <climits>  // CHAR_BIT
+
+#include <pthread.h>
+#include <sched.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace opcua {
+
+#ifdef __linux__
+
+static StatusCode toStatusCode(int error) noexcept {
+    switch (error) {
+    case 0:
+        return UA_STATUSCODE_GOOD;
+    case EPERM:
+    case EACCES:
+        return UA_STATUSCODE_BADUSERACCESSDENIED;
+    case EINVAL:
+        return UA_STATUSCODE_BADINVALIDARGUMENT;
+    default:
+        return UA_STATUSCODE_BADINTERNALERROR;
+    }
+}
+
+static int setName(std::string name, std::optional<size_t> index) {
+    if (index.has_value()) {
+        name += '-';
+        name += std::to_string(*index);
+    }
+    // limited to 16 characters including the terminating null byte
+    constexpr size_t maxLength = 15;
+    if (name.size() > maxLength) {
+        name.resize(maxLength);
+    }
+    return pthread_setname_np(pthread_self(), name.c_str());
+}
+
+static int setAffinity(const std::vector<int>& cpus) noexcept {
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const int cpu : cpus) {
+        if (cpu < 0 || cpu >= CPU_SETSIZE) {
+            return EINVAL;
+        }
+        CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+static int setPriority(int priority) noexcept {
+    sched_param param{};
+    param.sched_priority = priority;
+    return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+}
+
+static int setPreferredNode(int node) noexcept {
+    // set_mempolicy without a dependency on libnuma
+    constexpr int mpolPreferred = 1;  // MPOL_PREFERRED of <numaif.h>
+    constexpr int maxNodes = 1024;
+    constexpr int bitsPerWord = sizeof(unsigned long) * CHAR_BIT;  // NOLINT
+    if (node < 0 || node >= maxNodes) {
+        return EINVAL;
+    }
+    unsigned long mask[maxNodes / bitsPerWord]{};  // NOLINT
+    mask[node / bitsPerWord] = 1UL << (node % bitsPerWord);
+    if (syscall(SYS_set_mempolicy, mpolPreferred, mask, maxNodes + 1) != 0) {
+        return errno;
+    }
+    return 0;
+}
+
+StatusCode applyThreadConfig(const ThreadConfig& config, std::optional<size_t> index) noexcept {
+#ifdef UAPP_ENABLE_ALLOC_STATS
+    enableAllocCounting();  // thread-local allocator hooks
+#endif
+    StatusCode result;
+    const auto apply = [&](int error) {
+        if (result.isGood()) {
+            result = toStatusCode(error);
+        }
+    };
+    try {
+        if (!config.name.empty()) {
+            apply(setName(config.name, index));
+        }
+    } catch (...) {
+        apply(ENOMEM);
+    }
+    if (!config.cpus.empty()) {
+        apply(setAffinity(config.cpus));
+    }
+    if (config.priority.has_value()) {
+        apply(setPriority(*config.priority));
+    }
+    if (config.numaNode.has_value()) {
+        apply(setPreferredNode(*config.numaNode));
+    }
+    return result;
+}
+
+#else
+
+StatusCode applyThreadConfig(
+    const ThreadConfig& config, [[maybe_unused]] std::optional<size_t> index
+) noexcept {
+#ifdef UAPP_ENABLE_ALLOC_STATS
+    enableAllocCounting();  // thread-local allocator hooks
+#endif
+    const bool empty = config.name.empty() && config.cpus.empty() && !config.priority.has_value() &&
+                       !config.numaNode.has_value();
+    return empty ? UA_STATUSCODE_GOOD : UA_STATUSCODE_BADNOTSUPPORTED;
+}
+
+#endif
+
+}  // namespace opcua
@@ -0,0 +1,28 @@
+#include "open62541pp/Tracer.h"
+
+#include <algorithm>  // clamp
+
+namespace opcua {
+
+void Tracer::setSamplingRatio(double ratio) noexcept {
+    samplingRatio_.store(std::clamp(ratio, 0.0, 1.0), std::memory_order_relaxed);
+}
+
+double Tracer::getSamplingRatio() const noexcept {
+    return samplingRatio_.load(std::memory_order_relaxed);
+}
+
+bool Tracer::shouldSample() noexcept {
+    const double ratio = getSamplingRatio();
+    if (ratio >= 1.0) {
+        return true;
+    }
+    if (ratio <= 0.0) {
+        return false;
+    }
+    // sample if the scaled counter crosses an integer
+    const auto n = static_cast<double>(counter_.fetch_add(1, std::memory_order_relaxed));
+    return static_cast<uint64_t>((n + 1) * ratio) > static_cast<uint64_t>(n * ratio);
+}
+
+}  // namespace opcua
@@ -0,0 +1,151 @@
+#include "open62541pp/VariableHandle.h"
+
+#include "open62541pp/Common.h"  // NodeClass, ValueRank
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/View.h"
+
+#include "NodeProfiler.h"  // NodeAccessScope
+#include "ServerContext.h"  // sampleEventDrivenMonitoredItems
+#include "open62541_impl.h"
+
+namespace opcua::detail {
+
+static bool isSupertype(Server& server, const NodeId& supertypeId, NodeId typeId) {
+    while (!typeId.isNull()) {
+        if (typeId == supertypeId) {
+            return true;
+        }
+        const auto refs = services::browseAll(
+            server,
+            BrowseDescription(typeId, BrowseDirection::Inverse, ReferenceTypeId::HasSubtype, false)
+        );
+        typeId = refs.empty() ? NodeId{} : refs.front().getNodeId().getNodeId();
+    }
+    return false;
+}
+
+static bool acceptsScalar(ValueRank valueRank) noexcept {
+    return valueRank == ValueRank::Scalar || valueRank == ValueRank::ScalarOrOneDimension ||
+           valueRank == ValueRank::Any;
+}
+
+void validateVariableHandle(Server& server, const NodeId& id, const UA_DataType& type) {
+    if (services::readNodeClass(server, id) != NodeClass::Variable) {
+        throw BadStatus(UA_STATUSCODE_BADNODECLASSINVALID);
+    }
+    if (!acceptsScalar(services::readValueRank(server, id)) ||
+        !isSupertype(server, services::readDataType(server, id), asWrapper<NodeId>(type.typeId))) {
+        throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+    }
+}
+
+#if UAPP_OPEN62541_VER_EQ(1, 3) && !defined(UA_ENABLE_IMMUTABLE_NODES)
+
+/// Variable node with the value stored in the node, without value callbacks or historizing.
+static bool hasInternalValue(const UA_Node* node) noexcept {
+    if (node == nullptr || node->head.nodeClass != UA_NODECLASS_VARIABLE) {
+        return false;
+    }
+    const auto& variable = node->variableNode;
+    return variable.valueSource == UA_VALUESOURCE_DATA &&
+           variable.valueBackend.backendType == UA_VALUEBACKENDTYPE_NONE &&
+           variable.value.data.callback.onRead == nullptr &&
+           variable.value.data.callback.onWrite == nullptr && !variable.historizing;
+}
+
+/// Node of the nodestore, released at the end of the scope.
+class NodeRef {
+public:
+    NodeRef(UA_Server* server, const NodeId& id)
+        : ns_(UA_Server_getConfig(server)->nodestore),
+          node_(ns_.getNode(ns_.context, id.handle())) {}
+
+    ~NodeRef() {
+        if (node_ != nullptr) {
+            ns_.releaseNode(ns_.context, node_);
+        }
+    }
+
+    NodeRef(const NodeRef&) = delete;
+    NodeRef(NodeRef&&) noexcept = delete;
+    NodeRef& operator=(const NodeRef&) = delete;
+    NodeRef& operator=(NodeRef&&) noexcept = delete;
+
+    const UA_Node* get() const noexcept {
+        return node_;
+    }
+
+    /// Nodes are edited in-situ without `UA_ENABLE_IMMUTABLE_NODES` (see UA_Server_editNode).
+    UA_Node* getMutable() const noexcept {
+        return const_cast<UA_Node*>(node_);  // NOLINT
+    }
+
+private:
+    UA_Nodestore& ns_;
+    const UA_Node* node_;
+};
+
+/// Store the value directly into the node, false if the node requires the Write service.
+static bool tryWriteInternalValue(
+    UA_Server* server, const NodeId& id, const Variant& value, DateTime sourceTimestamp
+) {
+    const NodeAccessScope scope(NodeAccess::Write);
+    const NodeRef node(server, id);
+    if (!hasInternalValue(node.get())) {
+        return false;
+    }
+    UA_Variant copy;
+    throwOnBadStatus(UA_Variant_copy(value.handle(), &copy));
+    auto& dataValue = node.getMutable()->variableNode.value.data.value;
+    UA_Variant_clear(&dataValue.value);
+    dataValue.value = copy;
+    dataValue.hasValue = true;
+    dataValue.sourceTimestamp = sourceTimestamp.get();
+    dataValue.hasSourceTimestamp = true;
+    dataValue.serverTimestamp = UA_DateTime_now();
+    dataValue.hasServerTimestamp = true;
+    dataValue.status = UA_STATUSCODE_GOOD;
+    dataValue.hasStatus = false;
+    return true;
+}
+
+#endif
+
+void writeVariableHandle(
+    Server& server, const NodeId& id, const Variant& value, DateTime sourceTimestamp
+) {
+#if UAPP_OPEN62541_VER_EQ(1, 3) && !defined(UA_ENABLE_IMMUTABLE_NODES)
+    if (tryWriteInternalValue(server.handle(), id, value, sourceTimestamp)) {
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+        sampleEventDrivenMonitoredItems(server, id);
+#endif
+        return;
+    }
+#endif
+    // avoid copy of value
+    UA_DataValue dataValue{};
+    dataValue.value = *value.handle();  // shallow copy
+    dataValue.hasValue = true;
+    dataValue.sourceTimestamp = sourceTimestamp.get();
+    dataValue.hasSourceTimestamp = true;
+    services::writeDataValue(server, id, asWrapper<DataValue>(dataValue));
+}
+
+Variant readVariableHandle(Server& server, const NodeId& id) {
+#if UAPP_OPEN62541_VER_EQ(1, 3) && !defined(UA_ENABLE_IMMUTABLE_NODES)
+    {
+        const NodeRef node(server.handle(), id);
+        if (hasInternalValue(node.get())) {
+            return Variant(node.get()->variableNode.value.data.value.value);
+        }
+    }
+#endif
+    return services::readValue(server, id);
+}
+
+}  // namespace opcua::detail
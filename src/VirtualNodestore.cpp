@@ -0,0 +1,348 @@
+#include "VirtualNodestore.h"
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+
+#include <exception>
+#include <list>
+#include <mutex>
+#include <optional>
+#include <unordered_map>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+
+namespace opcua::detail {
+
+namespace {
+
+class Nodestore {
+public:
+    explicit Nodestore(const UA_Nodestore& inner)
+        : inner_(inner) {}
+
+    ~Nodestore() {
+        if (inner_.clear != nullptr) {
+            inner_.clear(inner_.context);
+        }
+    }
+
+    Nodestore(const Nodestore&) = delete;
+    Nodestore(Nodestore&&) noexcept = delete;
+    Nodestore& operator=(const Nodestore&) = delete;
+    Nodestore& operator=(Nodestore&&) noexcept = delete;
+
+    UA_Nodestore& inner() noexcept {
+        return inner_;
+    }
+
+    void addProvider(
+        uint16_t namespaceIndex, std::shared_ptr<VirtualNodeProvider> provider, size_t cacheSize
+    ) {
+        const std::lock_guard lock(mutex_);
+        const auto [it, inserted] = namespaces_.try_emplace(namespaceIndex);
+        if (!inserted) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        it->second.provider = std::move(provider);
+        it->second.cacheSize = cacheSize;
+    }
+
+    size_t getCachedCount(uint16_t namespaceIndex) const {
+        const std::lock_guard lock(mutex_);
+        const auto it = namespaces_.find(namespaceIndex);
+        return it != namespaces_.end() ? it->second.entries.size() : 0;
+    }
+
+    const UA_Node* getNode(const UA_NodeId& id) noexcept {
+        const auto* node = inner_.getNode(inner_.context, &id);
+        if (namespaces_.empty()) {
+            return node;
+        }
+        const std::lock_guard lock(mutex_);
+        auto* ns = findNamespace(id.namespaceIndex);
+        if (ns == nullptr) {
+            return node;
+        }
+        if (node != nullptr) {
+            touch(*ns, id);
+            return node;
+        }
+        if (!materialize(*ns, id)) {
+            return nullptr;
+        }
+        return inner_.getNode(inner_.context, &id);
+    }
+
+    UA_StatusCode getNodeCopy(const UA_NodeId& id, UA_Node** outNode) noexcept {
+        const auto status = inner_.getNodeCopy(inner_.context, &id, outNode);
+        if (status != UA_STATUSCODE_BADNODEIDUNKNOWN || namespaces_.empty()) {
+            return status;
+        }
+        const std::lock_guard lock(mutex_);
+        auto* ns = findNamespace(id.namespaceIndex);
+        if (ns == nullptr || !materialize(*ns, id)) {
+            return status;
+        }
+        return inner_.getNodeCopy(inner_.context, &id, outNode);
+    }
+
+    UA_StatusCode removeNode(const UA_NodeId& id) noexcept {
+        if (!namespaces_.empty()) {
+            const std::lock_guard lock(mutex_);
+            if (auto* ns = findNamespace(id.namespaceIndex); ns != nullptr) {
+                forget(*ns, id);
+            }
+        }
+        return inner_.removeNode(inner_.context, &id);
+    }
+
+    void mount(const NodeId& folderId, Span<const VirtualReference> references) {
+        UA_Node* folder = nullptr;
+        throwOnBadStatus(inner_.getNodeCopy(inner_.context, folderId.handle(), &folder));
+        UA_StatusCode status = UA_STATUSCODE_GOOD;
+        for (const auto& ref : references) {
+            status = addReference(*folder, ref, true);
+            if (status != UA_STATUSCODE_GOOD) {
+                break;
+            }
+        }
+        if (status != UA_STATUSCODE_GOOD) {
+            inner_.deleteNode(inner_.context, folder);
+            throw BadStatus(status);
+        }
+        throwOnBadStatus(inner_.replaceNode(inner_.context, folder));
+    }
+
+private:
+    struct Namespace {
+        std::shared_ptr<VirtualNodeProvider> provider;
+        size_t cacheSize{0};
+        std::list<NodeId> lru;  // most recently used first
+        std::unordered_map<NodeId, std::list<NodeId>::iterator> entries;
+    };
+
+    Namespace* findNamespace(uint16_t namespaceIndex) noexcept {
+        const auto it = namespaces_.find(namespaceIndex);
+        return it != namespaces_.end() ? &it->second : nullptr;
+    }
+
+    static void touch(Namespace& ns, const UA_NodeId& id) noexcept {
+        const auto it = ns.entries.find(asWrapper<NodeId>(id));
+        if (it != ns.entries.end()) {
+            ns.lru.splice(ns.lru.begin(), ns.lru, it->second);
+        }
+    }
+
+    static void forget(Namespace& ns, const UA_NodeId& id) noexcept {
+        const auto it = ns.entries.find(asWrapper<NodeId>(id));
+        if (it != ns.entries.end()) {
+            ns.lru.erase(it->second);
+            ns.entries.erase(it);
+        }
+    }
+
+    bool materialize(Namespace& ns, const UA_NodeId& id) noexcept {
+        try {
+            const auto definition = ns.provider->getNode(asWrapper<NodeId>(id));
+            if (!definition.has_value()) {
+                return false;
+            }
+            UA_Node* node = createNode(id, *definition);
+            if (node == nullptr) {
+                return false;
+            }
+            // the nodestore takes ownership of the node, also on failure
+            if (inner_.insertNode(inner_.context, node, nullptr) != UA_STATUSCODE_GOOD) {
+                return false;
+            }
+            ns.lru.emplace_front(id);
+            ns.entries.emplace(ns.lru.front(), ns.lru.begin());
+        } catch (const std::exception&) {
+            return false;
+        }
+        // evict the least recently used nodes, nodes in use are deleted with their last release
+        while (ns.entries.size() > ns.cacheSize) {
+            const auto& oldest = ns.lru.back();
+            inner_.removeNode(inner_.context, oldest.handle());
+            ns.entries.erase(oldest);
+            ns.lru.pop_back();
+        }
+        return true;
+    }
+
+    UA_Node* createNode(const UA_NodeId& id, const VirtualNode& definition) {
+        const auto nodeClass = static_cast<UA_NodeClass>(definition.nodeClass);
+        if (nodeClass != UA_NODECLASS_OBJECT && nodeClass != UA_NODECLASS_VARIABLE) {
+            return nullptr;
+        }
+        UA_Node* node = inner_.newNode(inner_.context, nodeClass);
+        if (node == nullptr) {
+            return nullptr;
+        }
+        UA_StatusCode status = UA_NodeId_copy(&id, &node->head.nodeId);
+        status |= UA_QualifiedName_copy(definition.browseName.handle(), &node->head.browseName);
+        if (nodeClass == UA_NODECLASS_OBJECT) {
+            status |= UA_Node_setAttributes(
+                node, definition.objectAttributes.handle(), &UA_TYPES[UA_TYPES_OBJECTATTRIBUTES]
+            );
+        } else {
+            status |= UA_Node_setAttributes(
+                node,
+                definition.variableAttributes.handle(),
+                &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]
+            );
+        }
+        if (!definition.typeDefinition.isNull()) {
+            const auto* type = inner_.getNode(inner_.context, definition.typeDefinition.handle());
+            if (type != nullptr) {
+                status |= addReference(
+                    *node,
+                    {ReferenceTypeId::HasTypeDefinition, definition.typeDefinition, {}},
+                    true,
+                    UA_QualifiedName_hash(&type->head.browseName)
+                );
+                inner_.releaseNode(inner_.context, type);
+            }
+        }
+        if (!definition.parent.target.isNull()) {
+            status |= addReference(*node, definition.parent, false);
+        }
+        for (const auto& child : definition.children) {
+            status |= addReference(*node, child, true);
+        }
+        if (status != UA_STATUSCODE_GOOD) {
+            inner_.deleteNode(inner_.context, node);
+            return nullptr;
+        }
+        return node;
+    }
+
+    UA_StatusCode addReference(UA_Node& node, const VirtualReference& ref, bool isForward) {
+        return addReference(
+            node, ref, isForward, UA_QualifiedName_hash(ref.targetBrowseName.handle())
+        );
+    }
+
+    UA_StatusCode addReference(
+        UA_Node& node, const VirtualReference& ref, bool isForward, UA_UInt32 targetNameHash
+    ) {
+        const auto index = getReferenceTypeIndex(ref.referenceType);
+        if (!index.has_value()) {
+            return UA_STATUSCODE_BADREFERENCETYPEIDINVALID;
+        }
+        UA_ExpandedNodeId target{};
+        target.nodeId = *ref.target.handle();  // shallow copy
+        const auto status = UA_Node_addReference(&node, *index, isForward, &target, targetNameHash);
+        return status == UA_STATUSCODE_BADDUPLICATEREFERENCENOTALLOWED ? UA_STATUSCODE_GOOD
+                                                                       : status;
+    }
+
+    std::optional<UA_Byte> getReferenceTypeIndex(const NodeId& referenceType) {
+        if (const auto it = referenceTypeIndices_.find(referenceType);
+            it != referenceTypeIndices_.end()) {
+            return it->second;
+        }
+        const auto* node = inner_.getNode(inner_.context, referenceType.handle());
+        if (node == nullptr) {
+            return std::nullopt;
+        }
+        std::optional<UA_Byte> index;
+        if (node->head.nodeClass == UA_NODECLASS_REFERENCETYPE) {
+            index = node->referenceTypeNode.referenceTypeIndex;
+            referenceTypeIndices_.emplace(referenceType, *index);
+        }
+        inner_.releaseNode(inner_.context, node);
+        return index;
+    }
+
+    UA_Nodestore inner_;
+    mutable std::mutex mutex_;
+    std::unordered_map<uint16_t, Namespace> namespaces_;
+    std::unordered_map<NodeId, UA_Byte> referenceTypeIndices_;
+};
+
+Nodestore& getNodestore(void* context) noexcept {
+    return *static_cast<Nodestore*>(context);
+}
+
+const UA_Node* getNode(void* context, const UA_NodeId* nodeId) {
+    return getNodestore(context).getNode(*nodeId);
+}
+
+Nodestore* findNodestore(const UA_Nodestore& ns) noexcept {
+    return ns.getNode == &getNode ? static_cast<Nodestore*>(ns.context) : nullptr;
+}
+
+Nodestore& installNodestore(UA_Nodestore& ns) {
+    if (auto* nodestore = findNodestore(ns)) {
+        return *nodestore;
+    }
+    auto* nodestore = new Nodestore(ns);  // NOLINT(cppcoreguidelines-owning-memory)
+    ns.context = nodestore;
+    ns.clear = [](void* context) {
+        delete &getNodestore(context);  // NOLINT(cppcoreguidelines-owning-memory)
+    };
+    ns.newNode = [](void* context, UA_NodeClass nodeClass) {
+        auto& inner = getNodestore(context).inner();
+        return inner.newNode(inner.context, nodeClass);
+    };
+    ns.deleteNode = [](void* context, UA_Node* node) {
+        auto& inner = getNodestore(context).inner();
+        inner.deleteNode(inner.context, node);
+    };
+    ns.getNode = &getNode;
+    ns.releaseNode = [](void* context, const UA_Node* node) {
+        auto& inner = getNodestore(context).inner();
+        inner.releaseNode(inner.context, node);
+    };
+    ns.getNodeCopy = [](void* context, const UA_NodeId* nodeId, UA_Node** outNode) {
+        return getNodestore(context).getNodeCopy(*nodeId, outNode);
+    };
+    ns.insertNode = [](void* context, UA_Node* node, UA_NodeId* addedNodeId) {
+        auto& inner = getNodestore(context).inner();
+        return inner.insertNode(inner.context, node, addedNodeId);
+    };
+    ns.replaceNode = [](void* context, UA_Node* node) {
+        auto& inner = getNodestore(context).inner();
+        return inner.replaceNode(inner.context, node);
+    };
+    ns.removeNode = [](void* context, const UA_NodeId* nodeId) {
+        return getNodestore(context).removeNode(*nodeId);
+    };
+    ns.getReferenceTypeId = [](void* context, UA_Byte refTypeIndex) {
+        auto& inner = getNodestore(context).inner();
+        return inner.getReferenceTypeId(inner.context, refTypeIndex);
+    };
+    ns.iterate = [](void* context, UA_NodestoreVisitor visitor, void* visitorContext) {
+        auto& inner = getNodestore(context).inner();
+        inner.iterate(inner.context, visitor, visitorContext);
+    };
+    return *nodestore;
+}
+
+}  // namespace
+
+void addVirtualNodeProvider(
+    UA_Nodestore& ns,
+    uint16_t namespaceIndex,
+    std::shared_ptr<VirtualNodeProvider> provider,
+    size_t cacheSize
+) {
+    installNodestore(ns).addProvider(namespaceIndex, std::move(provider), cacheSize);
+}
+
+void mountVirtualNodes(
+    UA_Nodestore& ns, const NodeId& folderId, Span<const VirtualReference> references
+) {
+    installNodestore(ns).mount(folderId, references);
+}
+
+size_t getVirtualNodeCount(const UA_Nodestore& ns, uint16_t namespaceIndex) noexcept {
+    const auto* nodestore = findNodestore(ns);
+    return nodestore != nullptr ? nodestore->getCachedCount(namespaceIndex) : 0;
+}
+
+}  // namespace opcua::detail
+
+#endif
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/VirtualNodes.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "open62541_impl.h"
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+
+namespace opcua::detail {
+
+/**
+ * Register a virtual node provider for a namespace.
+ *
+ * The nodestore of the server (default or read-optimized) is wrapped by a decorator with the first
+ * call, all calls are forwarded to the wrapped nodestore. Lookups of unknown nodes in a namespace
+ * owned by a provider are answered by the provider: the definition is inserted into the wrapped
+ * nodestore and tracked in a LRU list per namespace. The least recently used nodes are removed if
+ * the cache size is exceeded; nodes still in use are deleted with their last release.
+ *
+ * @exception BadStatus (BadInvalidArgument) If the namespace already has a provider
+ */
+void addVirtualNodeProvider(
+    UA_Nodestore& ns,
+    uint16_t namespaceIndex,
+    std::shared_ptr<VirtualNodeProvider> provider,
+    size_t cacheSize
+);
+
+/// Add forward references from a (non-virtual) folder to the top level virtual nodes.
+/// @exception BadStatus If the folder can't be edited
+void mountVirtualNodes(
+    UA_Nodestore& ns, const NodeId& folderId, Span<const VirtualReference> references
+);
+
+/// Number of materialized nodes of a namespace (0 if the nodestore isn't wrapped).
+size_t getVirtualNodeCount(const UA_Nodestore& ns, uint16_t namespaceIndex) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
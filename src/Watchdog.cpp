@@ -0,0 +1,119 @@
+#include "Watchdog.h"
+
+#include <array>
+#include <cstdio>  // snprintf
+#include <string>
+#include <utility>  // move
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Logger.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+
+namespace opcua::detail {
+
+static const char* getCallbackName(StatisticsCallback callback) noexcept {
+    switch (callback) {
+    case StatisticsCallback::ValueCallback:
+        return "Value callback";
+    case StatisticsCallback::DataSource:
+        return "Data source";
+    case StatisticsCallback::Method:
+        return "Method callback";
+    }
+    return "Callback";
+}
+
+static double toMilliseconds(std::chrono::nanoseconds duration) noexcept {
+    return std::chrono::duration<double, std::milli>(duration).count();
+}
+
+Watchdog::Watchdog(UA_Server* server, WatchdogOptions options, MigrateFunc migrate)
+    : server_(server),
+      options_(std::move(options)),
+      migrate_(std::move(migrate)),
+      lastCheck_(Statistics::Clock::now()) {}
+
+void Watchdog::checkCallback(
+    StatisticsCallback type, const UA_NodeId* nodeId, std::chrono::nanoseconds duration
+) noexcept {
+    if (duration <= options_.callbackBudget &&
+        duration.count() <= slowestNanos_.load(std::memory_order_relaxed)) {
+        return;
+    }
+    invokeCatchIgnore([&] {
+        static const NodeId nullId;
+        const NodeId& id = nodeId != nullptr ? asWrapper<NodeId>(*nodeId) : nullId;
+        WatchdogViolation violation;
+        bool migrate = false;
+        {
+            const std::lock_guard lock(mutex_);
+            if (duration.count() > slowestNanos_.load(std::memory_order_relaxed)) {
+                slowestNanos_.store(duration.count(), std::memory_order_relaxed);
+                slowest_.callback = type;
+                slowest_.nodeId = id;
+            }
+            if (duration <= options_.callbackBudget) {
+                return;
+            }
+            violation.type = WatchdogViolationType::Callback;
+            violation.callback = type;
+            violation.nodeId = id;
+            violation.duration = duration;
+            violation.count = ++violations_[id];
+            migrate = type == StatisticsCallback::Method && migrate_ &&
+                      violation.count == options_.migrateMethodsAfter;
+        }
+        report(violation);
+        if (migrate) {
+            migrate_(violation.nodeId);
+        }
+    });
+}
+
+void Watchdog::checkLoop() noexcept {
+    const auto now = Statistics::Clock::now();
+    const auto delay = now - lastCheck_ - options_.checkInterval;
+    lastCheck_ = now;
+    WatchdogViolation violation;
+    {
+        const std::lock_guard lock(mutex_);
+        violation = std::move(slowest_);
+        slowest_ = {};
+        slowestNanos_.store(0, std::memory_order_relaxed);
+    }
+    if (delay > options_.stallBudget) {
+        violation.type = WatchdogViolationType::Stall;
+        violation.duration = delay;
+        violation.count = 0;
+        report(violation);
+    }
+}
+
+void Watchdog::report(const WatchdogViolation& violation) noexcept {
+    if (options_.log) {
+        invokeCatchIgnore([&] {
+            std::array<char, 64> duration{};
+            std::snprintf(
+                duration.data(), duration.size(), "%.1f ms", toMilliseconds(violation.duration)
+            );
+            std::string msg;
+            if (violation.type == WatchdogViolationType::Stall) {
+                msg = "Event loop stalled for " + std::string(duration.data());
+                if (!violation.nodeId.isNull()) {
+                    msg += ", slowest: " + std::string(getCallbackName(violation.callback)) +
+                           " of " + violation.nodeId.toString();
+                }
+            } else {
+                msg = std::string(getCallbackName(violation.callback)) + " of " +
+                      violation.nodeId.toString() + " took " + duration.data() + " (" +
+                      std::to_string(violation.count) + " budget violations)";
+            }
+            log(server_, LogLevel::Warning, LogCategory::Server, msg);
+        });
+    }
+    if (options_.onViolation) {
+        invokeCatchIgnore([&] { options_.onViolation(violation); });
+    }
+}
+
+}  // namespace opcua::detail
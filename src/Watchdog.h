@@ -0,0 +1,56 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "open62541pp/Statistics.h"
+#include "open62541pp/Watchdog.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "open62541_impl.h"
+
+namespace opcua::detail {
+
+/**
+ * Watchdog of the event loop and node callbacks of a server.
+ *
+ * The event loop delay is measured by a repeated callback of the server (see checkLoop), node
+ * callbacks are checked after each invocation (see ServerContext::invokeNodeCallback). The
+ * slowest callback since the last loop check is tracked to name the offending node of a stall.
+ */
+class Watchdog {
+public:
+    /// Function to migrate a method to the async worker pool.
+    using MigrateFunc = std::function<void(const NodeId& methodId)>;
+
+    Watchdog(UA_Server* server, WatchdogOptions options, MigrateFunc migrate);
+
+    /// Check the duration of a node callback (thread-safe).
+    void checkCallback(
+        StatisticsCallback type, const UA_NodeId* nodeId, std::chrono::nanoseconds duration
+    ) noexcept;
+
+    /// Check the delay of the event loop, called by a repeated callback of the server.
+    void checkLoop() noexcept;
+
+    /// Id of the repeated callback.
+    uint64_t callbackId{0};
+
+private:
+    void report(const WatchdogViolation& violation) noexcept;
+
+    UA_Server* server_;
+    WatchdogOptions options_;
+    MigrateFunc migrate_;
+    Statistics::Clock::time_point lastCheck_;  // event loop only
+    std::mutex mutex_;
+    std::unordered_map<NodeId, uint64_t> violations_;
+    WatchdogViolation slowest_;  // slowest callback since the last loop check
+    std::atomic<int64_t> slowestNanos_{0};
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,198 @@
+#include "open62541pp/WriteCoalescer.h"
+
+#include <algorithm>  // max, min
+#include <mutex>
+#include <unordered_map>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Composed.h"
+
+#include "open62541_impl.h"
+#include "services/AsyncService.h"
+#include "services/OperationLimits.h"
+#include "services/RegisteredNodes.h"
+
+namespace opcua {
+
+struct WriteCoalescer::State {
+    struct Entry {
+        NodeId id;
+        DataValue value;
+        std::vector<services::AsyncCallback<>> callbacks;
+    };
+
+    Clock::duration flushInterval;
+    std::mutex mutex;
+    std::vector<Entry> pending;  // in order of the first write
+    std::unordered_map<NodeId, size_t> pendingIndex;
+    Clock::time_point lastFlush;
+    size_t inFlight{0};
+    ErrorCallback errorCallback;
+    uint64_t writes{0};
+    uint64_t coalesced{0};
+    uint64_t requests{0};
+
+    /// Invoke the callbacks of sent entries, outside of the lock.
+    void complete(Span<Entry> entries, Span<const StatusCode> results) {
+        ErrorCallback onError;
+        {
+            const std::lock_guard lock(mutex);
+            --inFlight;
+            onError = errorCallback;
+        }
+        for (size_t i = 0; i < entries.size(); ++i) {
+            const StatusCode status = results[i];
+            for (auto& callback : entries[i].callbacks) {
+                if (callback) {
+                    detail::invokeCatchIgnore(callback, status);
+                }
+            }
+            if (status.isBad() && onError) {
+                detail::invokeCatchIgnore(onError, entries[i].id, status);
+            }
+        }
+    }
+};
+
+WriteCoalescer::WriteCoalescer(Clock::duration flushInterval)
+    : state_(std::make_shared<State>()) {
+    state_->flushInterval = flushInterval;
+}
+
+void WriteCoalescer::write(
+    const NodeId& id, const DataValue& value, services::AsyncCallback<> callback
+) {
+    auto& state = *state_;
+    const std::lock_guard lock(state.mutex);
+    ++state.writes;
+    const auto [it, inserted] = state.pendingIndex.try_emplace(id, state.pending.size());
+    if (inserted) {
+        auto& entry = state.pending.emplace_back();
+        entry.id = id;
+        entry.value = value;
+        entry.callbacks.push_back(std::move(callback));
+        return;
+    }
+    ++state.coalesced;
+    auto& entry = state.pending[it->second];
+    entry.value = value;  // superseded callbacks complete with the newer value
+    entry.callbacks.push_back(std::move(callback));
+}
+
+std::future<void> WriteCoalescer::write(const NodeId& id, const DataValue& value) {
+    return detail::invokeWithFuture<void>([&](auto&& callback) {
+        write(id, value, std::move(callback));
+    });
+}
+
+void WriteCoalescer::setErrorCallback(ErrorCallback callback) {
+    const std::lock_guard lock(state_->mutex);
+    state_->errorCallback = std::move(callback);
+}
+
+size_t WriteCoalescer::flush(Client& client) {
+    using Entry = State::Entry;
+    if (getPendingCount() == 0) {
+        return 0;
+    }
+    // fetch the limits first, the client lock must not be acquired while holding our lock
+    const size_t limit = detail::getOperationLimits(client).maxNodesPerWrite;
+    auto entries = std::make_shared<std::vector<Entry>>();
+    size_t chunkSize = 0;
+    {
+        const std::lock_guard lock(state_->mutex);
+        entries->swap(state_->pending);
+        state_->pendingIndex.clear();
+        state_->lastFlush = Clock::now();
+        chunkSize = limit == 0 ? entries->size() : limit;
+        const size_t chunks = (entries->size() + chunkSize - 1) / chunkSize;
+        state_->inFlight += chunks;
+        state_->requests += chunks;
+    }
+
+    const auto aliases = detail::getNodeAliases(client, false);
+    std::vector<UA_WriteValue> items;
+    for (size_t offset = 0; offset < entries->size(); offset += chunkSize) {
+        const size_t count = std::min(chunkSize, entries->size() - offset);
+        const Span<Entry> chunk(entries->data() + offset, count);  // NOLINT
+        // shallow copies, the request is encoded immediately
+        items.assign(count, UA_WriteValue{});
+        for (size_t i = 0; i < count; ++i) {
+            items[i].nodeId = detail::substituteAlias(aliases.get(), *chunk[i].id.handle());
+            items[i].attributeId = UA_ATTRIBUTEID_VALUE;
+            items[i].value = *chunk[i].value.handle();
+            items[i].value.hasValue = true;
+        }
+        UA_WriteRequest request{};
+        request.nodesToWriteSize = items.size();
+        request.nodesToWrite = items.data();
+        try {
+            detail::sendAsyncRequest<WriteResponse>(
+                client,
+                request,
+                UA_TYPES[UA_TYPES_WRITEREQUEST],
+                [state = state_, entries, chunk](WriteResponse& response) {
+                    const StatusCode serviceResult = response->responseHeader.serviceResult;
+                    const auto results = response.getResults();
+                    std::vector<StatusCode> statuses(chunk.size(), serviceResult);
+                    for (size_t i = 0; i < chunk.size() && serviceResult.isGood(); ++i) {
+                        statuses[i] = i < results.size()
+                                          ? results[i]
+                                          : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+                    }
+                    state->complete(chunk, statuses);
+                }
+            );
+        } catch (const BadStatus& e) {
+            const std::vector<StatusCode> statuses(chunk.size(), e.code());
+            state_->complete(chunk, statuses);
+        }
+    }
+    return entries->size();
+}
+
+size_t WriteCoalescer::flushIfDue(Client& client) {
+    {
+        const std::lock_guard lock(state_->mutex);
+        if (state_->pending.empty() || state_->inFlight > 0 ||
+            Clock::now() - state_->lastFlush < state_->flushInterval) {
+            return 0;
+        }
+    }
+    return flush(client);
+}
+
+WriteCoalescer::Clock::duration WriteCoalescer::getNextFlush() const {
+    const std::lock_guard lock(state_->mutex);
+    if (state_->pending.empty() || state_->inFlight > 0) {
+        return Clock::duration::max();  // flushed after the responses are received
+    }
+    const auto remaining = state_->lastFlush + state_->flushInterval - Clock::now();
+    return std::max(remaining, Clock::duration::zero());
+}
+
+size_t WriteCoalescer::getPendingCount() const {
+    const std::lock_guard lock(state_->mutex);
+    return state_->pending.size();
+}
+
+uint64_t WriteCoalescer::getWriteCount() const {
+    const std::lock_guard lock(state_->mutex);
+    return state_->writes;
+}
+
+uint64_t WriteCoalescer::getCoalescedCount() const {
+    const std::lock_guard lock(state_->mutex);
+    return state_->coalesced;
+}
+
+uint64_t WriteCoalescer::getRequestCount() const {
+    const std::lock_guard lock(state_->mutex);
+    return state_->requests;
+}
+
+}  // namespace opcua
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>  // max, min
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+#include "open62541pp/Client.h"  // AdaptiveRequestSizing
+
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+/**
+ * Adaptive number of operations per request of a service.
+ *
+ * The size is halved if the server rejects a request with BadTooManyOperations or
+ * BadResponseTooLarge and increased by a quarter while the response time stays below the target
+ * latency. The size is bounded by the operation limit of the server.
+ *
+ * The smallest rejected size is kept as a ceiling: after a rejection, the size falls back to the
+ * largest accepted size and grows by halving the distance to the ceiling, so it settles just below
+ * the server's limit instead of oscillating. The ceiling is lifted after a long streak of
+ * successful requests, e.g. if the server's limit depends on its load.
+ */
+class AdaptiveRequestSize {
+public:
+    /// Current number of operations per request.
+    size_t get(uint32_t operationLimit, const AdaptiveRequestSizing& options) const noexcept {
+        const size_t size = size_.load(std::memory_order_relaxed);
+        return std::min(
+            std::max({size == 0 ? options.initialSize : size, options.minSize, size_t{1}}),
+            getMaxSize(operationLimit, options)
+        );
+    }
+
+    /**
+     * Update the size with the result of a request.
+     * @returns `true` if the request was rejected as too large and should be resent with the
+     *          reduced size
+     */
+    bool update(
+        size_t requested,
+        UA_StatusCode serviceResult,
+        std::chrono::steady_clock::duration latency,
+        uint32_t operationLimit,
+        const AdaptiveRequestSizing& options
+    ) noexcept {
+        const size_t minSize = std::max<size_t>(options.minSize, 1);
+        if (serviceResult == UA_STATUSCODE_BADTOOMANYOPERATIONS ||
+            serviceResult == UA_STATUSCODE_BADRESPONSETOOLARGE) {
+            successes_.store(0, std::memory_order_relaxed);
+            if (requested <= minSize) {
+                return false;
+            }
+            const size_t ceiling = ceiling_.load(std::memory_order_relaxed);
+            if (ceiling == 0 || requested < ceiling) {
+                ceiling_.store(requested, std::memory_order_relaxed);
+            }
+            size_t accepted = accepted_.load(std::memory_order_relaxed);
+            if (accepted >= requested) {
+                accepted = 0;  // the server's limit dropped
+                accepted_.store(0, std::memory_order_relaxed);
+            }
+            size_.store(std::max({minSize, requested / 2, accepted}), std::memory_order_relaxed);
+            return true;
+        }
+        if (serviceResult != UA_STATUSCODE_GOOD) {
+            return false;
+        }
+        if (accepted_.load(std::memory_order_relaxed) < requested) {
+            accepted_.store(requested, std::memory_order_relaxed);
+        }
+        if (successes_.fetch_add(1, std::memory_order_relaxed) + 1 >= ceilingDecayStreak) {
+            successes_.store(0, std::memory_order_relaxed);
+            ceiling_.store(0, std::memory_order_relaxed);
+        }
+        if (latency < options.targetLatency && requested == get(operationLimit, options)) {
+            // only full-sized requests indicate that larger requests would be fast as well
+            size_t grown = requested + std::max<size_t>(requested / 4, 1);
+            const size_t ceiling = ceiling_.load(std::memory_order_relaxed);
+            if (ceiling > requested) {
+                grown = std::min(grown, requested + (ceiling - requested) / 2);
+            }
+            size_.store(
+                std::min(grown, getMaxSize(operationLimit, options)), std::memory_order_relaxed
+            );
+        }
+        return false;
+    }
+
+    /// Reset to the initial size, e.g. after a connect to another server.
+    void reset() noexcept {
+        size_.store(0, std::memory_order_relaxed);
+        ceiling_.store(0, std::memory_order_relaxed);
+        accepted_.store(0, std::memory_order_relaxed);
+        successes_.store(0, std::memory_order_relaxed);
+    }
+
+    /// Number of consecutive successful requests until the ceiling is lifted.
+    static constexpr size_t ceilingDecayStreak = 1000;
+
+private:
+    static size_t getMaxSize(
+        uint32_t operationLimit, const AdaptiveRequestSizing& options
+    ) noexcept {
+        const size_t maxSize = std::max<size_t>(options.maxSize, 1);
+        return operationLimit == 0 ? maxSize : std::min<size_t>(operationLimit, maxSize);
+    }
+
+    std::atomic<size_t> size_{0};  // 0 = initial size
+    std::atomic<size_t> ceiling_{0};  // smallest rejected size, 0 = none
+    std::atomic<size_t> accepted_{0};  // largest accepted size
+    std::atomic<size_t> successes_{0};  // successful requests since the last rejection
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,179 @@
+#pragma once
+
+#include <algorithm>  // min, max
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+#include "../open62541_impl.h"
+#include "LastReportedValue.h"  // getNumericScalar
+
+namespace opcua::detail {
+
+/**
+ * Incremental computation of an aggregate over consecutive processing intervals.
+ *
+ * Samples are added in chronological order, the state of the current interval is constant in
+ * size (no sample buffer). Only good numeric scalar values are aggregated, other samples are
+ * ignored. The result of an interval has the interval start as source timestamp.
+ * Supported aggregates: Interpolative, Average, Minimum, Maximum and Count.
+ */
+class AggregateCalculator {
+public:
+    /// @exception BadStatus (BadAggregateNotSupported) If the aggregate type isn't supported
+    /// @exception BadStatus (BadMonitoredItemFilterInvalid) If the processing interval is invalid
+    AggregateCalculator(const NodeId& aggregateType, double processingInterval, UA_DateTime start)
+        : type_(toType(aggregateType)),
+          interval_(static_cast<int64_t>(processingInterval * UA_DATETIME_MSEC)),
+          start_(start) {
+        if (!(processingInterval > 0.0) || interval_ <= 0) {
+            throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMFILTERINVALID);
+        }
+    }
+
+    UA_DateTime getIntervalStart() const noexcept {
+        return start_;
+    }
+
+    /**
+     * Close all intervals that end before or at `time` and pass their results to `emit`.
+     * At most `maxResults` results are emitted, older intervals are skipped after long gaps.
+     */
+    template <typename F>
+    void advance(UA_DateTime time, F&& emit, size_t maxResults = 16) {
+        if (time < start_ + interval_) {
+            return;
+        }
+        const int64_t completed = (time - start_) / interval_;
+        if (completed > static_cast<int64_t>(maxResults)) {
+            // emit the current and the last completed interval, skip the empty ones in between
+            const UA_DateTime start = start_;
+            emit(finishInterval());
+            start_ = start + (completed - 1) * interval_;
+            emit(finishInterval());
+            return;
+        }
+        for (int64_t i = 0; i < completed; ++i) {
+            emit(finishInterval());
+        }
+    }
+
+    /// Add a sample of the current interval (call @ref advance with the sample time before).
+    void add(UA_DateTime time, const UA_DataValue& dv) noexcept {
+        if (dv.hasStatus && !StatusCode(dv.status).isGood()) {
+            return;
+        }
+        const auto value = getNumericScalar(dv.value);
+        if (!value.has_value()) {
+            return;
+        }
+        ++count_;
+        sum_ += *value;
+        min_ = count_ == 1 ? *value : std::min(min_, *value);
+        max_ = count_ == 1 ? *value : std::max(max_, *value);
+        if (!firstTime_.has_value()) {
+            firstTime_ = time;
+            firstValue_ = *value;
+        }
+        lastTime_ = time;
+        lastValue_ = *value;
+    }
+
+private:
+    enum class Type { Interpolative, Average, Minimum, Maximum, Count };
+
+    static Type toType(const NodeId& aggregateType) {
+        if (aggregateType == NodeId(ObjectId::AggregateFunction_Interpolative)) {
+            return Type::Interpolative;
+        }
+        if (aggregateType == NodeId(ObjectId::AggregateFunction_Average)) {
+            return Type::Average;
+        }
+        if (aggregateType == NodeId(ObjectId::AggregateFunction_Minimum)) {
+            return Type::Minimum;
+        }
+        if (aggregateType == NodeId(ObjectId::AggregateFunction_Maximum)) {
+            return Type::Maximum;
+        }
+        if (aggregateType == NodeId(ObjectId::AggregateFunction_Count)) {
+            return Type::Count;
+        }
+        throw BadStatus(UA_STATUSCODE_BADAGGREGATENOTSUPPORTED);
+    }
+
+    DataValue finishInterval() {
+        DataValue result;
+        result.setSourceTimestamp(DateTime(start_));
+        if (type_ == Type::Count) {
+            result.setValue(Variant::fromScalar(static_cast<uint32_t>(count_)));
+        } else if (type_ == Type::Interpolative) {
+            setInterpolated(result);
+        } else if (count_ == 0) {
+            result.setStatusCode(UA_STATUSCODE_BADNODATA);
+        } else if (type_ == Type::Average) {
+            result.setValue(Variant::fromScalar(sum_ / static_cast<double>(count_)));
+        } else {
+            result.setValue(Variant::fromScalar(type_ == Type::Minimum ? min_ : max_));
+        }
+
+        // the last sample is the bounding value of the next interval
+        if (lastTime_.has_value()) {
+            previousTime_ = lastTime_;
+            previousValue_ = lastValue_;
+        }
+        start_ += interval_;
+        count_ = 0;
+        sum_ = 0.0;
+        firstTime_.reset();
+        lastTime_.reset();
+        return result;
+    }
+
+    /// Value at the interval start, interpolated linearly between the bounding samples.
+    void setInterpolated(DataValue& result) const {
+        if (firstTime_.has_value() && *firstTime_ == start_) {
+            result.setValue(Variant::fromScalar(firstValue_));
+        } else if (firstTime_.has_value() && previousTime_.has_value()) {
+            const double ratio = static_cast<double>(start_ - *previousTime_) /
+                                 static_cast<double>(*firstTime_ - *previousTime_);
+            result.setValue(
+                Variant::fromScalar(previousValue_ + ratio * (firstValue_ - previousValue_))
+            );
+        } else if (previousTime_.has_value()) {
+            // no later sample, stepped extrapolation
+            result.setValue(Variant::fromScalar(previousValue_));
+            result.setStatusCode(UA_STATUSCODE_UNCERTAINDATASUBNORMAL);
+        } else if (firstTime_.has_value()) {
+            // no earlier sample, first value of the interval
+            result.setValue(Variant::fromScalar(firstValue_));
+            result.setStatusCode(UA_STATUSCODE_UNCERTAINDATASUBNORMAL);
+        } else {
+            result.setStatusCode(UA_STATUSCODE_BADNODATA);
+        }
+    }
+
+    Type type_;
+    int64_t interval_;  // 100 ns ticks
+    UA_DateTime start_;
+    // state of the current interval
+    uint64_t count_{0};
+    double sum_{0.0};
+    double min_{0.0};
+    double max_{0.0};
+    std::optional<UA_DateTime> firstTime_;
+    double firstValue_{0.0};
+    std::optional<UA_DateTime> lastTime_;
+    double lastValue_{0.0};
+    // last sample of the previous intervals
+    std::optional<UA_DateTime> previousTime_;
+    double previousValue_{0.0};
+};
+
+}  // namespace opcua::detail
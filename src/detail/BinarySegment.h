@@ -0,0 +1,94 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <cstring>  // memcmp
+#include <istream>
+#include <iterator>
+#include <ostream>
+#include <string>
+#include <string_view>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeConverter.h"  // guessDataType
+#include "open62541pp/types/Builtin.h"
+
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+/**
+ * Helpers for binary snapshot files: magic bytes followed by length-prefixed segments.
+ * Each segment is a value encoded with the OPC UA binary encoding, prefixed with its length
+ * (uint32, little endian).
+ */
+
+template <size_t N>
+inline bool hasBinaryMagic(std::istream& stream, const std::array<char, N>& magic) {
+    std::array<char, N> header{};
+    const auto position = stream.tellg();
+    stream.read(header.data(), header.size());
+    const bool match = stream.gcount() == static_cast<std::streamsize>(header.size()) &&
+                       header == magic;
+    stream.clear();
+    stream.seekg(position);
+    return match;
+}
+
+/// Read the whole stream into a buffer and strip the magic bytes.
+/// @exception BadStatus (BadDecodingError) If the magic bytes don't match
+template <size_t N>
+inline std::string readBinaryFile(std::istream& stream, const std::array<char, N>& magic) {
+    std::string buffer((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+    if (buffer.size() < magic.size() ||
+        std::memcmp(buffer.data(), magic.data(), magic.size()) != 0) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    buffer.erase(0, magic.size());
+    return buffer;
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+template <typename T>
+void writeBinarySegment(std::ostream& stream, const T& data) {
+    ByteString encoded;
+    throwOnBadStatus(UA_encodeBinary(&data, &guessDataType<T>(), encoded.handle()));
+    const auto length = static_cast<uint32_t>(encoded->length);
+    const std::array<char, 4> lengthBytes{
+        static_cast<char>(length & 0xFF),
+        static_cast<char>((length >> 8) & 0xFF),
+        static_cast<char>((length >> 16) & 0xFF),
+        static_cast<char>((length >> 24) & 0xFF),
+    };
+    stream.write(lengthBytes.data(), lengthBytes.size());
+    stream.write(reinterpret_cast<const char*>(encoded->data), encoded->length);  // NOLINT
+}
+
+/// Decode the next segment of the buffer in place and advance the buffer.
+/// @exception BadStatus (BadDecodingError) If the segment is invalid
+template <typename T>
+void readBinarySegment(std::string_view& buffer, T& data) {
+    if (buffer.size() < 4) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    const auto* bytes = reinterpret_cast<const uint8_t*>(buffer.data());  // NOLINT
+    const size_t length = static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+                          (static_cast<uint32_t>(bytes[2]) << 16) |
+                          (static_cast<uint32_t>(bytes[3]) << 24);
+    buffer.remove_prefix(4);
+    if (buffer.size() < length) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    UA_ByteString segment{length, const_cast<uint8_t*>(bytes + 4)};  // NOLINT, shallow
+    const auto status = UA_decodeBinary(&segment, &data, &guessDataType<T>(), nullptr);
+    if (status != UA_STATUSCODE_GOOD) {
+        throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+    }
+    buffer.remove_prefix(length);
+}
+
+#endif
+
+}  // namespace opcua::detail
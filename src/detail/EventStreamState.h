@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>  // max, min
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/EventStream.h"
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
+
+namespace opcua::detail {
+
+/**
+ * Queue of an event stream, shared by the EventStream handles and the server.
+ *
+ * Producers push under a mutex, the server thread takes the due events (limited by a token bucket)
+ * and triggers them outside of the lock. The event template is only accessed by the server thread.
+ */
+class EventStreamState {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    EventStreamState(
+        Server& server,
+        const NodeId& originId,
+        const NodeId& eventType,
+        Span<const QualifiedName> fields,
+        const EventStreamOptions& options
+    )
+        : originId_(originId),
+          fields_(fields.begin(), fields.end()),
+          options_(options),
+          event_(std::in_place, server, eventType, fields),
+          tokens_(getBurst()),
+          last_(Clock::now()) {}
+
+    Span<const QualifiedName> getFields() const noexcept {
+        return fields_;
+    }
+
+    const EventStreamOptions& getOptions() const noexcept {
+        return options_;
+    }
+
+    void push(std::string_view key, std::vector<Variant>&& values) {
+        if (values.size() != fields_.size()) {
+            throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+        }
+        const std::lock_guard lock(mutex_);
+        if (!key.empty()) {
+            const auto it = pendingByKey_.find(std::string(key));
+            if (it != pendingByKey_.end()) {
+                it->second->values = std::move(values);
+                ++coalesced_;
+                return;
+            }
+        }
+        if (options_.maxQueueSize > 0 && queue_.size() >= options_.maxQueueSize) {
+            popFront();
+            ++dropped_;
+        }
+        auto& entry = queue_.emplace_back(Entry{std::string(key), std::move(values)});
+        if (!entry.key.empty()) {
+            pendingByKey_.emplace(entry.key, &entry);
+        }
+    }
+
+    /// Trigger the due events (server thread).
+    void process() noexcept {
+        batch_.clear();
+        {
+            const std::lock_guard lock(mutex_);
+            size_t count = queue_.size();
+            if (options_.maxRate > 0) {
+                const auto now = Clock::now();
+                const std::chrono::duration<double> elapsed = now - last_;
+                last_ = now;
+                tokens_ = std::min(getBurst(), tokens_ + elapsed.count() * options_.maxRate);
+                count = std::min(count, static_cast<size_t>(tokens_));
+                tokens_ -= static_cast<double>(count);
+            }
+            for (size_t i = 0; i < count; ++i) {
+                batch_.push_back(std::move(queue_.front().values));
+                popFront();
+            }
+        }
+        if (!event_.has_value()) {
+            return;
+        }
+        for (const auto& values : batch_) {
+            try {
+                event_->trigger(values, originId_);
+                ++triggered_;
+            } catch (...) {  // NOLINT, ignore
+            }
+        }
+    }
+
+    /// Delete the event node, must be called before the server is deleted (server thread).
+    void close() noexcept {
+        event_.reset();
+    }
+
+    size_t getQueueSize() const {
+        const std::lock_guard lock(mutex_);
+        return queue_.size();
+    }
+
+    uint64_t getDroppedCount() const noexcept {
+        return dropped_;
+    }
+
+    uint64_t getCoalescedCount() const noexcept {
+        return coalesced_;
+    }
+
+    uint64_t getTriggeredCount() const noexcept {
+        return triggered_;
+    }
+
+private:
+    struct Entry {
+        std::string key;
+        std::vector<Variant> values;
+    };
+
+    double getBurst() const noexcept {
+        const std::chrono::duration<double> interval = options_.interval;
+        return std::max(1.0, options_.maxRate * interval.count());
+    }
+
+    void popFront() {
+        if (!queue_.front().key.empty()) {
+            pendingByKey_.erase(queue_.front().key);
+        }
+        queue_.pop_front();
+    }
+
+    NodeId originId_;
+    std::vector<QualifiedName> fields_;
+    EventStreamOptions options_;
+    std::optional<EventTemplate> event_;  // reset on close
+    std::vector<std::vector<Variant>> batch_;
+
+    mutable std::mutex mutex_;
+    std::deque<Entry> queue_;  // stable references on push_back/pop_front
+    std::unordered_map<std::string, Entry*> pendingByKey_;
+    double tokens_;
+    Clock::time_point last_;
+
+    std::atomic<uint64_t> dropped_{0};
+    std::atomic<uint64_t> coalesced_{0};
+    std::atomic<uint64_t> triggered_{0};
+};
+
+}  // namespace opcua::detail
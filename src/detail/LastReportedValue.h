@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cmath>  // abs
+#include <optional>
+
+#include "open62541pp/Common.h"  // TypeIndex
+#include "open62541pp/Config.h"
+#include "open62541pp/TypeWrapper.h"  // asWrapper
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Variant.h"
+
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+/// Last reported value and status of a monitored item to apply the client-side data change filter.
+struct LastReportedValue {
+    bool valid{false};
+    StatusCode status;
+    std::optional<double> numericValue;
+    Variant value;  // only non-numeric values
+};
+
+template <typename T>
+inline bool getNumericScalarAs(
+    const UA_Variant& variant, TypeIndex typeIndex, std::optional<double>& result
+) noexcept {
+    if (variant.type != &UA_TYPES[typeIndex]) {  // NOLINT
+        return false;
+    }
+    result = static_cast<double>(*static_cast<const T*>(variant.data));
+    return true;
+}
+
+inline std::optional<double> getNumericScalar(const UA_Variant& variant) noexcept {
+    std::optional<double> result;
+    if (variant.type == nullptr || variant.data == nullptr || !UA_Variant_isScalar(&variant)) {
+        return result;
+    }
+    // clang-format off
+    const bool numeric =
+    getNumericScalarAs<UA_Double>(variant, UA_TYPES_DOUBLE, result) ||
+    getNumericScalarAs<UA_Float>(variant, UA_TYPES_FLOAT, result) ||
+    getNumericScalarAs<UA_Int32>(variant, UA_TYPES_INT32, result) ||
+    getNumericScalarAs<UA_UInt32>(variant, UA_TYPES_UINT32, result) ||
+    getNumericScalarAs<UA_Int16>(variant, UA_TYPES_INT16, result) ||
+    getNumericScalarAs<UA_UInt16>(variant, UA_TYPES_UINT16, result) ||
+    getNumericScalarAs<UA_Int64>(variant, UA_TYPES_INT64, result) ||
+    getNumericScalarAs<UA_UInt64>(variant, UA_TYPES_UINT64, result) ||
+    getNumericScalarAs<UA_SByte>(variant, UA_TYPES_SBYTE, result) ||
+    getNumericScalarAs<UA_Byte>(variant, UA_TYPES_BYTE, result) ||
+    getNumericScalarAs<UA_Boolean>(variant, UA_TYPES_BOOLEAN, result);
+    // clang-format on
+    return numeric ? result : std::nullopt;
+}
+
+inline bool isEqualValue(const UA_Variant& lhs, const UA_Variant& rhs) noexcept {
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    return UA_order(&lhs, &rhs, &UA_TYPES[UA_TYPES_VARIANT]) == UA_ORDER_EQ;
+#else
+    // no generic comparison available, report every non-numeric change
+    (void)lhs;
+    (void)rhs;
+    return false;
+#endif
+}
+
+/// Apply client-side data change filter of monitored items (client or local) and poll items.
+/// @returns `true` if the notification should be reported
+template <typename MonitoredItem>
+bool applyClientFilter(MonitoredItem& monitoredItem, const UA_DataValue& dv) noexcept {
+    if (!monitoredItem.clientFilter.has_value()) {
+        return true;
+    }
+    const auto& filter = *monitoredItem.clientFilter;
+    auto& last = monitoredItem.lastReported;
+    const StatusCode status = dv.hasStatus ? dv.status : UA_STATUSCODE_GOOD;
+    const auto numericValue = getNumericScalar(dv.value);
+
+    if (last.valid && last.status == status) {
+        if (numericValue.has_value() && last.numericValue.has_value()) {
+            const double delta = std::abs(*numericValue - *last.numericValue);
+            if (filter.absoluteDeadband > 0.0 ? delta <= filter.absoluteDeadband
+                                              : filter.discardUnchanged && delta == 0.0) {
+                return false;
+            }
+        } else if (filter.discardUnchanged && !numericValue.has_value() &&
+                   !last.numericValue.has_value() && isEqualValue(dv.value, *last.value.handle())) {
+            return false;
+        }
+    }
+
+    last.valid = true;
+    last.status = status;
+    last.numericValue = numericValue;
+    if (numericValue.has_value()) {
+        last.value = {};
+    } else if (filter.discardUnchanged) {
+        try {
+            last.value = asWrapper<Variant>(dv.value);  // copy
+        } catch (...) {
+            last.value = {};
+        }
+    }
+    return true;
+}
+
+}  // namespace opcua::detail
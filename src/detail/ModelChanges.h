@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "open62541pp/Span.h"
+#include "open62541pp/types/Variant.h"
+
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+inline const UA_ModelChangeStructureDataType* getModelChange(const UA_ExtensionObject& eo) {
+    if (eo.encoding < UA_EXTENSIONOBJECT_DECODED ||
+        eo.content.decoded.type != &UA_TYPES[UA_TYPES_MODELCHANGESTRUCTUREDATATYPE]) {
+        return nullptr;
+    }
+    return static_cast<const UA_ModelChangeStructureDataType*>(eo.content.decoded.data);
+}
+
+/**
+ * Get the `Changes` field of a GeneralModelChangeEvent.
+ * The field is selected by BrowseCache::getModelChangeEventFilter. Changes that can't be decoded
+ * are returned as `nullptr`, the result is empty if the event has no change details.
+ */
+inline std::vector<const UA_ModelChangeStructureDataType*> getModelChanges(
+    Span<const Variant> eventFields
+) {
+    std::vector<const UA_ModelChangeStructureDataType*> changes;
+    if (eventFields.empty() || !eventFields[0].isArray()) {
+        return changes;
+    }
+    const auto& changesField = *eventFields[0].handle();
+    if (eventFields[0].isType(UA_TYPES[UA_TYPES_MODELCHANGESTRUCTUREDATATYPE])) {
+        const auto* array = static_cast<const UA_ModelChangeStructureDataType*>(changesField.data);
+        for (size_t i = 0; i < changesField.arrayLength; ++i) {
+            changes.push_back(&array[i]);  // NOLINT
+        }
+    } else if (eventFields[0].isType(UA_TYPES[UA_TYPES_EXTENSIONOBJECT])) {
+        const auto* array = static_cast<const UA_ExtensionObject*>(changesField.data);
+        for (size_t i = 0; i < changesField.arrayLength; ++i) {
+            changes.push_back(getModelChange(array[i]));  // NOLINT
+        }
+    }
+    return changes;
+}
+
+}  // namespace opcua::detail
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <atomic>
+#include <utility>  // move
+
+namespace opcua::detail {
+
+/**
+ * Unbounded lock-free multi-producer single-consumer queue.
+ *
+ * Intrusive linked list with a stub node (Dmitry Vyukov's MPSC queue). Producers only perform a
+ * single atomic exchange, the consumer never blocks producers. Every push allocates a node.
+ *
+ * @tparam T Default-constructible and movable value type
+ */
+template <typename T>
+class MpscQueue {
+public:
+    MpscQueue()
+        : head_(new Node),
+          tail_(head_.load()) {}
+
+    ~MpscQueue() {
+        T value;
+        while (pop(value)) {
+        }
+        delete tail_;  // stub
+    }
+
+    MpscQueue(const MpscQueue&) = delete;
+    MpscQueue(MpscQueue&&) noexcept = delete;
+    MpscQueue& operator=(const MpscQueue&) = delete;
+    MpscQueue& operator=(MpscQueue&&) noexcept = delete;
+
+    /// Push a value to the queue (thread-safe, any thread).
+    void push(T value) {
+        auto* node = new Node{std::move(value)};
+        Node* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+    /// Pop a value from the queue (consumer thread only).
+    /// @return `false` if the queue is empty
+    bool pop(T& value) {
+        Node* tail = tail_;
+        Node* next = tail->next.load(std::memory_order_acquire);
+        if (next == nullptr) {
+            return false;
+        }
+        value = std::move(next->value);
+        tail_ = next;  // next becomes the new stub
+        delete tail;
+        return true;
+    }
+
+private:
+    struct Node {
+        T value{};
+        std::atomic<Node*> next{nullptr};
+    };
+
+    std::atomic<Node*> head_;  // producers
+    Node* tail_;  // consumer
+};
+
+}  // namespace opcua::detail
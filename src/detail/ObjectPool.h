@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace opcua::detail {
+
+/**
+ * Slab allocator for objects with stable addresses.
+ *
+ * Objects are allocated in chunks of `ChunkSize` and recycled via a free list. Released objects
+ * are reset to a default-constructed state, i.e. captured resources are freed immediately.
+ * Not thread-safe.
+ *
+ * @tparam T Default-constructible and move-assignable object type
+ */
+template <typename T, size_t ChunkSize = 256>
+class ObjectPool {
+public:
+    /// Get an object from the pool. The object is in a default-constructed state.
+    T* acquire() {
+        if (freeList_.empty()) {
+            grow();
+        }
+        T* object = freeList_.back();
+        freeList_.pop_back();
+        return object;
+    }
+
+    /// Return an object to the pool.
+    void release(T* object) noexcept {
+        if (object == nullptr) {
+            return;
+        }
+        *object = T{};
+        freeList_.push_back(object);  // capacity reserved in grow, never reallocates
+    }
+
+    /// Number of allocated objects (in use and free).
+    size_t capacity() const noexcept {
+        return chunks_.size() * ChunkSize;
+    }
+
+private:
+    void grow() {
+        chunks_.push_back(std::make_unique<T[]>(ChunkSize));  // NOLINT
+        freeList_.reserve(capacity());
+        T* chunk = chunks_.back().get();
+        for (size_t i = ChunkSize; i > 0; --i) {
+            freeList_.push_back(&chunk[i - 1]);
+        }
+    }
+
+    std::vector<std::unique_ptr<T[]>> chunks_;  // NOLINT
+    std::vector<T*> freeList_;
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+
+namespace opcua::detail {
+
+/**
+ * Recursive mutex that can be released temporarily by the owning thread.
+ *
+ * Used to serialize the access to a client while a thread waits for the response of a
+ * multiplexed request: the lock is released with @ref unlockAll and restored with @ref relock,
+ * independent of the nesting depth.
+ * The number of waiting threads allows the event loop to yield the lock to pending requests.
+ */
+class ReentrantMutex {
+public:
+    void lock() {
+        const auto id = std::this_thread::get_id();
+        if (owner_.load() == id) {
+            ++depth_;
+            return;
+        }
+        ++waiters_;
+        mutex_.lock();
+        --waiters_;
+        owner_ = id;
+        depth_ = 1;
+    }
+
+    void unlock() noexcept {
+        if (--depth_ == 0) {
+            owner_ = std::thread::id();
+            mutex_.unlock();
+        }
+    }
+
+    /// Release the lock completely and return the nesting depth.
+    size_t unlockAll() noexcept {
+        const size_t depth = depth_;
+        depth_ = 0;
+        owner_ = std::thread::id();
+        mutex_.unlock();
+        return depth;
+    }
+
+    /// Reacquire the lock released with @ref unlockAll.
+    void relock(size_t depth) {
+        lock();
+        depth_ = depth;
+    }
+
+    bool isOwnedByCurrentThread() const noexcept {
+        return owner_.load() == std::this_thread::get_id();
+    }
+
+    /// Number of threads blocked in @ref lock.
+    size_t getWaiters() const noexcept {
+        return waiters_.load();
+    }
+
+private:
+    std::mutex mutex_;
+    std::atomic<std::thread::id> owner_{};
+    std::atomic<size_t> waiters_{0};
+    size_t depth_{0};
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>  // function, greater
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <utility>  // move
+#include <vector>
+
+#include "open62541pp/ThreadConfig.h"
+
+namespace opcua::detail {
+
+/**
+ * Periodic task scheduler with a pool of worker threads.
+ *
+ * Every task is executed with a fixed interval, measured from the end of the previous execution,
+ * so a slow task never runs concurrently with itself. Exceptions thrown by tasks are ignored.
+ * The worker threads are started with the first task and joined on destruction.
+ */
+class RefreshScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    explicit RefreshScheduler(size_t threadCount = 1, ThreadConfig threadConfig = {})
+        : threadCount_(threadCount == 0 ? 1 : threadCount),
+          threadConfig_(std::move(threadConfig)) {}
+
+    ~RefreshScheduler() {
+        {
+            const std::lock_guard lock(mutex_);
+            running_ = false;
+        }
+        cv_.notify_all();
+        for (auto& thread : threads_) {
+            thread.join();
+        }
+    }
+
+    RefreshScheduler(const RefreshScheduler&) = delete;
+    RefreshScheduler(RefreshScheduler&&) noexcept = delete;
+    RefreshScheduler& operator=(const RefreshScheduler&) = delete;
+    RefreshScheduler& operator=(RefreshScheduler&&) noexcept = delete;
+
+    /// Add a periodic task, the first execution is due immediately.
+    void add(Clock::duration interval, std::function<void()> task) {
+        {
+            const std::lock_guard lock(mutex_);
+            tasks_.push_back({interval, std::move(task)});
+            queue_.push({Clock::now(), tasks_.size() - 1});
+            if (threads_.empty()) {
+                for (size_t i = 0; i < threadCount_; ++i) {
+                    threads_.emplace_back([this, i] {
+                        applyThreadConfig(threadConfig_, i);
+                        run();
+                    });
+                }
+            }
+        }
+        cv_.notify_one();
+    }
+
+    size_t getTaskCount() const {
+        const std::lock_guard lock(mutex_);
+        return tasks_.size();
+    }
+
+private:
+    struct Task {
+        Clock::duration interval;
+        std::function<void()> function;
+    };
+
+    struct Entry {
+        Clock::time_point due;
+        size_t index;
+
+        bool operator>(const Entry& other) const noexcept {
+            return due > other.due;
+        }
+    };
+
+    void run() {
+        std::unique_lock lock(mutex_);
+        while (running_) {
+            if (queue_.empty()) {
+                cv_.wait(lock);
+                continue;
+            }
+            const Entry entry = queue_.top();
+            if (Clock::now() < entry.due) {
+                cv_.wait_until(lock, entry.due);
+                continue;
+            }
+            queue_.pop();
+            // tasks are never removed, the function outlives the unlocked execution
+            auto& task = tasks_[entry.index];
+            lock.unlock();
+            try {
+                task.function();
+            } catch (...) {  // NOLINT, ignore
+            }
+            lock.lock();
+            queue_.push({Clock::now() + task.interval, entry.index});
+            cv_.notify_one();
+        }
+    }
+
+    size_t threadCount_;
+    ThreadConfig threadConfig_;
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<Task> tasks_;  // stable references on push_back
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<>> queue_;
+    std::vector<std::thread> threads_;
+    bool running_{true};
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+
+#include "open62541pp/Statistics.h"  // LatencyHistogram
+#include "open62541pp/Subscription.h"  // SubscriptionStatistics
+#include "open62541pp/types/DateTime.h"
+
+#include "../open62541_impl.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua::detail {
+
+/// Info bits of a status code are DataValue info bits (Part 4, 7.39.1).
+constexpr UA_StatusCode statusInfoTypeMask = 0x00000C00;
+constexpr UA_StatusCode statusInfoTypeDataValue = 0x00000400;
+/// Overflow bit, set if the queue of the monitored item overflowed.
+constexpr UA_StatusCode statusInfoBitOverflow = 0x00000080;
+
+/// Counters of SubscriptionStatistics, updated by the notification callbacks.
+class SubscriptionHealth {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    void recordEvent() noexcept {
+        notificationCount_.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    void recordDataChange(const UA_DataValue& dv) noexcept {
+        notificationCount_.fetch_add(1, std::memory_order_relaxed);
+        if (dv.hasStatus && (dv.status & statusInfoTypeMask) == statusInfoTypeDataValue &&
+            (dv.status & statusInfoBitOverflow) != 0) {
+            overflowCount_.fetch_add(1, std::memory_order_relaxed);
+        }
+        const auto timestamp = dv.hasServerTimestamp   ? dv.serverTimestamp
+                               : dv.hasSourceTimestamp ? dv.sourceTimestamp
+                                                       : 0;
+        if (timestamp > 0) {
+            const auto delay = UA_DateTime_now() - timestamp;  // 100 ns intervals
+            if (delay >= 0) {
+                latency_.record(std::chrono::nanoseconds(delay * 100));
+            }
+        }
+    }
+
+    /// Fill the counters, the rate is computed since the previous call (or the creation).
+    void fill(SubscriptionStatistics& stats) noexcept {
+        stats.notificationCount = notificationCount_.load(std::memory_order_relaxed);
+        stats.overflowCount = overflowCount_.load(std::memory_order_relaxed);
+        stats.latencyMean = latency_.getMean();
+        stats.latencyP99 = latency_.getPercentile(99.0);
+        stats.latencyMax = latency_.getMax();
+
+        const std::lock_guard lock(mutex_);
+        const auto now = Clock::now();
+        const double elapsed = std::chrono::duration<double>(now - rateStart_).count();
+        if (elapsed > 0.0) {
+            stats.notificationsPerSecond =
+                static_cast<double>(stats.notificationCount - rateCount_) / elapsed;
+        }
+        rateStart_ = now;
+        rateCount_ = stats.notificationCount;
+    }
+
+private:
+    std::atomic<uint64_t> notificationCount_{0};
+    std::atomic<uint64_t> overflowCount_{0};
+    LatencyHistogram latency_;
+    std::mutex mutex_;
+    Clock::time_point rateStart_{Clock::now()};
+    uint64_t rateCount_{0};
+};
+
+}  // namespace opcua::detail
+
+#endif
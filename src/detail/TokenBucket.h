@@ -0,0 +1,43 @@
+#pragma once
+
+#include <algorithm>  // min
+#include <chrono>
+
+namespace opcua::detail {
+
+/**
+ * Token bucket rate limiter.
+ *
+ * The bucket holds up to `capacity` tokens and is refilled continuously with `rate` tokens per
+ * second. The bucket starts full, so bursts up to the capacity are allowed.
+ */
+class TokenBucket {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    TokenBucket(double rate, double capacity, Clock::time_point now) noexcept
+        : rate_(rate),
+          capacity_(capacity),
+          tokens_(capacity),
+          last_(now) {}
+
+    /// Take a token if available.
+    bool tryConsume(Clock::time_point now) noexcept {
+        const std::chrono::duration<double> elapsed = now - last_;
+        tokens_ = std::min(capacity_, tokens_ + elapsed.count() * rate_);
+        last_ = now;
+        if (tokens_ < 1.0) {
+            return false;
+        }
+        tokens_ -= 1.0;
+        return true;
+    }
+
+private:
+    double rate_;
+    double capacity_;
+    double tokens_;
+    Clock::time_point last_;
+};
+
+}  // namespace opcua::detail
@@ -0,0 +1,332 @@
+#pragma once
+
+#include <cctype>  // isxdigit
+#include <cstdint>
+#include <cstdlib>  // strtoul
+#include <istream>
+#include <optional>
+#include <streambuf>
+#include <string>
+#include <string_view>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/ErrorHandling.h"
+
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+/**
+ * Minimal streaming (pull) XML reader.
+ *
+ * Reads elements, attributes and text content of well-formed documents with a small buffer.
+ * Processing instructions, comments and DOCTYPE declarations are skipped, CDATA sections are
+ * reported as text. Namespace prefixes are stripped from element names. Doesn't validate the
+ * document, malformed input throws BadStatus (BadDecodingError).
+ */
+class XmlReader {
+public:
+    enum class Event {
+        StartElement,
+        EndElement,
+        Text,
+        EndDocument,
+    };
+
+    explicit XmlReader(std::istream& stream)
+        : buffer_(*stream.rdbuf()) {}
+
+    /// Read the next event.
+    Event next() {
+        if (pendingEnd_) {
+            pendingEnd_ = false;
+            return Event::EndElement;
+        }
+        text_.clear();
+        int c = buffer_.sgetc();
+        while (c != traits::eof() && c != '<') {
+            readCharacters('<');
+            c = buffer_.sgetc();
+        }
+        if (!text_.empty()) {
+            return Event::Text;
+        }
+        if (c == traits::eof()) {
+            return Event::EndDocument;
+        }
+        buffer_.sbumpc();  // '<'
+        c = buffer_.sgetc();
+        if (c == '?') {
+            skipUntil("?>");
+            return next();
+        }
+        if (c == '!') {
+            buffer_.sbumpc();
+            if (consume("--")) {
+                skipUntil("-->");
+                return next();
+            }
+            if (consume("[CDATA[")) {
+                readUntil("]]>", text_);
+                return text_.empty() ? next() : Event::Text;
+            }
+            skipUntil(">");  // DOCTYPE
+            return next();
+        }
+        if (c == '/') {
+            buffer_.sbumpc();
+            readName(name_);
+            skipWhitespace();
+            expect('>');
+            return Event::EndElement;
+        }
+        readName(name_);
+        readAttributes();
+        return Event::StartElement;
+    }
+
+    /// Local name of the current element (without namespace prefix).
+    std::string_view name() const noexcept {
+        const auto pos = name_.find(':');
+        return pos == std::string::npos ? std::string_view(name_)
+                                        : std::string_view(name_).substr(pos + 1);
+    }
+
+    /// Attribute value of the current start element.
+    std::optional<std::string_view> attribute(std::string_view attributeName) const noexcept {
+        for (const auto& [key, value] : attributes_) {
+            if (key == attributeName) {
+                return value;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// Text content of the current text event.
+    std::string_view text() const noexcept {
+        return text_;
+    }
+
+    /// Read the text content of the current start element including all child elements.
+    /// Consumes all events up to the corresponding end element.
+    std::string readText() {
+        std::string result;
+        size_t depth = 1;
+        while (depth > 0) {
+            switch (next()) {
+            case Event::StartElement:
+                ++depth;
+                break;
+            case Event::EndElement:
+                --depth;
+                break;
+            case Event::Text:
+                result += text_;
+                break;
+            case Event::EndDocument:
+                throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+            }
+        }
+        return result;
+    }
+
+    /// Skip the current start element including all child elements.
+    void skipElement() {
+        size_t depth = 1;
+        while (depth > 0) {
+            switch (next()) {
+            case Event::StartElement:
+                ++depth;
+                break;
+            case Event::EndElement:
+                --depth;
+                break;
+            case Event::Text:
+                break;
+            case Event::EndDocument:
+                throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+            }
+        }
+    }
+
+private:
+    using traits = std::streambuf::traits_type;
+
+    static bool isWhitespace(int c) noexcept {
+        return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+    }
+
+    /// Unicode scalar values except NUL, strtoul also accepts signs and whitespace.
+    static bool isValidCodePoint(std::string_view digits, unsigned long codePoint) noexcept {
+        const auto first = static_cast<unsigned char>(digits.front());
+        return std::isxdigit(first) != 0 && codePoint != 0 && codePoint <= 0x10FFFF &&
+               (codePoint < 0xD800 || codePoint > 0xDFFF);
+    }
+
+    static void appendUtf8(std::string& str, uint32_t codePoint) {
+        if (codePoint < 0x80) {
+            str += static_cast<char>(codePoint);
+        } else if (codePoint < 0x800) {
+            str += static_cast<char>(0xC0 | (codePoint >> 6));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else if (codePoint < 0x10000) {
+            str += static_cast<char>(0xE0 | (codePoint >> 12));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        } else {
+            str += static_cast<char>(0xF0 | (codePoint >> 18));
+            str += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            str += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            str += static_cast<char>(0x80 | (codePoint & 0x3F));
+        }
+    }
+
+    int get() {
+        const int c = buffer_.sbumpc();
+        if (c == traits::eof()) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+        return c;
+    }
+
+    void expect(char expected) {
+        if (get() != expected) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+    }
+
+    bool consume(std::string_view str) {
+        for (const char c : str) {
+            if (buffer_.sgetc() != c) {
+                return false;
+            }
+            buffer_.sbumpc();
+        }
+        return true;
+    }
+
+    void skipWhitespace() {
+        while (isWhitespace(buffer_.sgetc())) {
+            buffer_.sbumpc();
+        }
+    }
+
+    void readUntil(std::string_view delimiter, std::string& out) {
+        const size_t offset = out.size();
+        while (true) {
+            out += static_cast<char>(get());
+            if (out.size() - offset >= delimiter.size() &&
+                std::string_view(out).substr(out.size() - delimiter.size()) == delimiter) {
+                out.resize(out.size() - delimiter.size());
+                return;
+            }
+        }
+    }
+
+    void skipUntil(std::string_view delimiter) {
+        scratch_.clear();
+        readUntil(delimiter, scratch_);
+    }
+
+    void readName(std::string& out) {
+        out.clear();
+        int c = buffer_.sgetc();
+        while (c != traits::eof() && !isWhitespace(c) && c != '>' && c != '/' && c != '=') {
+            out += static_cast<char>(c);
+            buffer_.sbumpc();
+            c = buffer_.sgetc();
+        }
+        if (out.empty()) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+    }
+
+    void readEntity(std::string& out) {
+        scratch_.clear();
+        int c = get();
+        while (c != ';') {
+            scratch_ += static_cast<char>(c);
+            if (scratch_.size() > 8) {
+                throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+            }
+            c = get();
+        }
+        if (scratch_ == "lt") {
+            out += '<';
+        } else if (scratch_ == "gt") {
+            out += '>';
+        } else if (scratch_ == "amp") {
+            out += '&';
+        } else if (scratch_ == "quot") {
+            out += '"';
+        } else if (scratch_ == "apos") {
+            out += '\'';
+        } else if (scratch_.size() > 1 && scratch_[0] == '#') {
+            const bool hex = scratch_[1] == 'x';
+            const auto digits = scratch_.substr(hex ? 2 : 1);
+            char* end = nullptr;
+            const auto codePoint = std::strtoul(digits.c_str(), &end, hex ? 16 : 10);
+            if (digits.empty() || *end != '\0' || !isValidCodePoint(digits, codePoint)) {
+                throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+            }
+            appendUtf8(out, static_cast<uint32_t>(codePoint));
+        } else {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+    }
+
+    /// Read (and decode) characters until the delimiter or the end of the input.
+    void readCharacters(char delimiter) {
+        int c = buffer_.sgetc();
+        while (c != traits::eof() && c != delimiter) {
+            buffer_.sbumpc();
+            if (c == '&') {
+                readEntity(text_);
+            } else {
+                text_ += static_cast<char>(c);
+            }
+            c = buffer_.sgetc();
+        }
+    }
+
+    void readAttributes() {
+        attributes_.clear();
+        while (true) {
+            skipWhitespace();
+            const int c = buffer_.sgetc();
+            if (c == '/') {
+                buffer_.sbumpc();
+                expect('>');
+                pendingEnd_ = true;
+                return;
+            }
+            if (c == '>') {
+                buffer_.sbumpc();
+                return;
+            }
+            auto& [key, value] = attributes_.emplace_back();
+            readName(key);
+            skipWhitespace();
+            expect('=');
+            skipWhitespace();
+            const int quote = get();
+            if (quote != '"' && quote != '\'') {
+                throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+            }
+            text_.clear();
+            readCharacters(static_cast<char>(quote));
+            expect(static_cast<char>(quote));
+            value.swap(text_);
+        }
+    }
+
+    std::streambuf& buffer_;
+    bool pendingEnd_{false};
+    std::string name_;
+    std::string text_;
+    std::string scratch_;
+    std::vector<std::pair<std::string, std::string>> attributes_;
+};
+
+}  // namespace opcua::detail
@@ -42,6 +42,15 @@
 #endif
 #include <open62541/server_config_default.h>
 
+// pubsub
+#ifdef UA_ENABLE_PUBSUB
+#include <open62541/plugin/pubsub_udp.h>
+#include <open62541/server_pubsub.h>
+#ifdef UA_ENABLE_PUBSUB_ETH_UADP
+#include <open62541/plugin/pubsub_ethernet.h>
+#endif
+#endif
+
 #endif
 
 #ifndef _MSC_VER
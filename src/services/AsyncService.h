@@ -0,0 +1,150 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <exception>  // make_exception_ptr
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>  // move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/TypeWrapper.h"
+#include "open62541pp/services/Async.h"
+#include "open62541pp/types/Builtin.h"
+
+#include "../ClientContext.h"
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+inline void asyncServiceCallback(
+    UA_Client* client, [[maybe_unused]] void* userdata, uint32_t requestId, void* response
+) noexcept {
+    auto& callbacks = getContext(client).asyncCallbacks;
+    auto it = callbacks.find(requestId);
+    if (it == callbacks.end()) {
+        return;
+    }
+    auto callback = std::move(it->second);
+    callbacks.erase(it);
+    if (callback) {
+        invokeCatchIgnore(callback, response);
+    }
+}
+
+/**
+ * Send an asynchronous request and invoke the callback with the response.
+ * The callback is stored in the ClientContext and correlated by the request id.
+ * The response is cleared by open62541 after the callback, so results have to be swapped out.
+ * @exception BadStatus If the request could not be sent
+ */
+template <typename Response, typename Request>
+void sendAsyncRequest(
+    Client& client,
+    const Request& request,
+    const UA_DataType& requestType,
+    std::function<void(Response&)> callback
+) {
+    const std::lock_guard lock(client.getContext().mutex);
+    uint32_t requestId{};
+    const auto status = __UA_Client_AsyncService(
+        client.handle(),
+        &request,
+        &requestType,
+        asyncServiceCallback,
+        &UA_TYPES[Response::getTypeIndex()],
+        nullptr,
+        &requestId
+    );
+    throwOnBadStatus(status);
+    // responses are processed within UA_Client_run_iterate, so it's safe to register afterwards
+    client.getContext().asyncCallbacks[requestId] = [cb = std::move(callback)](void* response) {
+        cb(asWrapper<Response>(*static_cast<typename Response::NativeType*>(response)));
+    };
+}
+
+/**
+ * Send a request and wait for the response.
+ *
+ * If the event loop runs in a background thread (Client::runInBackground) and the function is
+ * called from another thread, the request is sent asynchronously. The client lock is released
+ * while the calling thread waits for the response, which is received by the event loop thread.
+ * This way, the requests of multiple threads are multiplexed over the connection. Otherwise, the
+ * request is sent synchronously.
+ *
+ * @return Native response, the caller takes ownership
+ */
+template <typename Response, typename Request>
+typename Response::NativeType sendRequest(
+    Client& client, const Request& request, const UA_DataType& requestType
+) {
+    auto& context = client.getContext();
+    typename Response::NativeType result{};
+    if (!context.isMultiplexed()) {
+        __UA_Client_Service(
+            client.handle(), &request, &requestType, &result, &UA_TYPES[Response::getTypeIndex()]
+        );
+        return result;
+    }
+    auto promise = std::make_shared<std::promise<Response>>();
+    auto future = promise->get_future();
+    try {
+        sendAsyncRequest<Response>(client, request, requestType, [promise](Response& response) {
+            promise->set_value(std::move(response));
+        });
+    } catch (const BadStatus& e) {
+        result.responseHeader.serviceResult = e.code();
+        return result;
+    }
+    // open62541 times out pending requests itself, the margin covers a stopped event loop
+    const auto timeout = std::chrono::milliseconds(UA_Client_getConfig(client.handle())->timeout);
+    const bool owned = context.mutex.isOwnedByCurrentThread();
+    const size_t depth = owned ? context.mutex.unlockAll() : 0;
+    const auto status = future.wait_for(2 * timeout + std::chrono::seconds(1));
+    if (owned) {
+        context.mutex.relock(depth);
+    }
+    if (status != std::future_status::ready) {
+        result.responseHeader.serviceResult = UA_STATUSCODE_BADTIMEOUT;
+        return result;
+    }
+    future.get().swap(result);
+    return result;
+}
+
+/// Create an AsyncCallback that fulfills the promise.
+template <typename T>
+AsyncCallback<T> createPromiseCallback(std::shared_ptr<std::promise<T>> promise) {
+    if constexpr (std::is_void_v<T>) {
+        return [promise = std::move(promise)](StatusCode status) {
+            if (status.isBad()) {
+                promise->set_exception(std::make_exception_ptr(BadStatus(status)));
+            } else {
+                promise->set_value();
+            }
+        };
+    } else {
+        return [promise = std::move(promise)](StatusCode status, T& result) {
+            if (status.isBad()) {
+                promise->set_exception(std::make_exception_ptr(BadStatus(status)));
+            } else {
+                promise->set_value(std::move(result));
+            }
+        };
+    }
+}
+
+/// Invoke an asynchronous function with a callback and return a future instead.
+template <typename T, typename F>
+std::future<T> invokeWithFuture(F&& fn) {
+    auto promise = std::make_shared<std::promise<T>>();
+    auto future = promise->get_future();
+    std::invoke(std::forward<F>(fn), createPromiseCallback<T>(std::move(promise)));
+    return future;
+}
+
+}  // namespace opcua::detail
@@ -1,16 +1,39 @@
 #include "open62541pp/services/Attribute.h"
 
+#include <algorithm>  // min
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>  // move, pair
+#include <vector>
+
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeAttributeCache.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/TypeWrapper.h"  // asWrapper, asNative
+#include "open62541pp/WriteCoalescer.h"
+#include "open62541pp/detail/helper.h"  // toNativeString
 
+#include "../ClientContext.h"
+#include "../NodeProfiler.h"  // NodeAccessScope
+#include "../ServerContext.h"
 #include "../open62541_impl.h"
+#include "AsyncService.h"
+#include "OperationLimits.h"
+#include "RegisteredNodes.h"
+#include "ServiceStatistics.h"
 
 namespace opcua::services {
 
 ReadResponse read(Client& client, const ReadRequest& request) {
-    ReadResponse response = UA_Client_Service_read(client.handle(), request);
+    ReadResponse response = detail::invokeService(client, StatisticsService::Read, [&] {
+        return detail::sendRequest<ReadResponse>(client, request, UA_TYPES[UA_TYPES_READREQUEST]);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
@@ -26,10 +49,19 @@ ReadResponse read(
     return read(client, asWrapper<ReadRequest>(request));
 }
 
+/// Convert the DataValue of a read operation into a result (empty if the status is bad).
+static Result<DataValue> toReadResult(DataValue&& dv) noexcept {
+    if (dv->hasStatus && detail::isBadStatus(dv->status)) {
+        return BadResult(dv->status);
+    }
+    const StatusCode code = dv->hasStatus ? dv->status : UA_STATUSCODE_GOOD;
+    return {std::move(dv), code};
+}
+
 template <>
-DataValue readAttribute<Server>(
+Result<DataValue> tryReadAttribute<Server>(
     Server& server, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
-) {
+) noexcept {
     UA_ReadValueId item{};
     item.nodeId = *id.handle();
     item.attributeId = static_cast<uint32_t>(attributeId);
@@ -37,31 +69,258 @@ DataValue readAttribute<Server>(
     DataValue result = UA_Server_read(
         server.handle(), &item, static_cast<UA_TimestampsToReturn>(timestamps)
     );
-    if (result->hasStatus) {
-        detail::throwOnBadStatus(result->status);
-    }
-    return result;
+    return toReadResult(std::move(result));
 }
 
 template <>
-DataValue readAttribute<Client>(
+Result<DataValue> tryReadAttribute<Client>(
     Client& client, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<DataValue> {
+        if (timestamps == TimestampsToReturn::Neither) {
+            if (const auto cache = client.getAttributeCache()) {
+                if (auto dv = cache->read(client, id, attributeId)) {
+                    return toReadResult(std::move(*dv));
+                }
+            }
+        }
+
+        UA_ReadValueId item{};
+        const auto aliases = detail::getNodeAliases(client);
+        item.nodeId = detail::substituteAlias(aliases.get(), *id.handle());
+        item.attributeId = static_cast<uint32_t>(attributeId);
+
+        UA_ReadRequest request{};
+        request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+        request.nodesToReadSize = 1;
+        request.nodesToRead = &item;
+        ReadResponse response = detail::invokeService(client, StatisticsService::Read, [&] {
+            return detail::sendRequest<ReadResponse>(
+                client, request, UA_TYPES[UA_TYPES_READREQUEST]
+            );
+        });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        if (detail::isBadStatus(serviceResult)) {
+            return BadResult(serviceResult);
+        }
+        auto results = response.getResults();
+        if (results.size() != 1) {
+            return BadResult(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        DataValue result;
+        result.swap(results[0]);
+        if (!result->hasValue && !(result->hasStatus && detail::isBadStatus(result->status))) {
+            return BadResult(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        return toReadResult(std::move(result));
+    });
+}
+
+template <typename T>
+DataValue readAttribute(
+    T& serverOrClient, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
 ) {
-    auto response = read(client, {{id, attributeId}}, timestamps);
-    auto results = response.getResults();
-    if (results.size() != 1 || !results[0]->hasValue) {
-        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    return tryReadAttribute(serverOrClient, id, attributeId, timestamps).value();
+}
+
+template <>
+void readAttributes<Server>(
+    Server& server,
+    Span<const ReadValueId> nodesToRead,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps
+) {
+    results.resize(nodesToRead.size());
+    for (size_t i = 0; i < nodesToRead.size(); ++i) {
+        results[i] = UA_Server_read(
+            server.handle(), nodesToRead[i].handle(), static_cast<UA_TimestampsToReturn>(timestamps)
+        );
     }
-    if (results[0]->hasStatus) {
-        detail::throwOnBadStatus(results[0]->status);
+}
+
+template <>
+void readAttributes<Client>(
+    Client& client,
+    Span<const ReadValueId> nodesToRead,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps
+) {
+    results.resize(nodesToRead.size());
+    const auto aliases = detail::getNodeAliases(client);
+    std::vector<UA_ReadValueId> substituted;
+    const auto sendChunk = [&](size_t offset, size_t count) {
+        const auto chunk = nodesToRead.subview(offset, count);
+        // avoid copy of nodesToRead
+        UA_ReadRequest request{};
+        request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+        request.nodesToReadSize = chunk.size();
+        request.nodesToRead = asNative(const_cast<ReadValueId*>(chunk.data()));  // NOLINT
+        if (aliases != nullptr) {
+            // shallow copies with the registered node ids
+            substituted.assign(request.nodesToRead, request.nodesToRead + chunk.size());
+            for (auto& item : substituted) {
+                item.nodeId = detail::substituteAlias(aliases.get(), item.nodeId);
+            }
+            request.nodesToRead = substituted.data();
+        }
+        ReadResponse response = detail::invokeService(client, StatisticsService::Read, [&] {
+            return detail::sendRequest<ReadResponse>(
+                client, request, UA_TYPES[UA_TYPES_READREQUEST]
+            );
+        });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        auto chunkResults = response.getResults();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            auto& result = results[offset + i];
+            if (detail::isBadStatus(serviceResult)) {
+                result = DataValue{};
+                result.setStatusCode(serviceResult);
+            } else if (i >= chunkResults.size()) {
+                result = DataValue{};
+                result.setStatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+            } else {
+                // the previous value is released with the response
+                result.swap(chunkResults[i]);
+            }
+        }
+        return serviceResult;
+    };
+    detail::forEachChunk(
+        client,
+        StatisticsService::Read,
+        detail::getOperationLimits(client).maxNodesPerRead,
+        nodesToRead.size(),
+        sendChunk
+    );
+}
+
+template <typename T>
+std::vector<DataValue> readAttributes(
+    T& serverOrClient, Span<const ReadValueId> nodesToRead, TimestampsToReturn timestamps
+) {
+    std::vector<DataValue> results;
+    readAttributes(serverOrClient, nodesToRead, results, timestamps);
+    return results;
+}
+
+template <typename T>
+void readValues(
+    T& serverOrClient,
+    Span<const NodeId> ids,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps
+) {
+    // avoid copy of ids
+    std::vector<UA_ReadValueId> items(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        items[i].nodeId = *ids[i].handle();  // shallow copy
+        items[i].attributeId = UA_ATTRIBUTEID_VALUE;
     }
-    DataValue result;
-    result.swap(response.getResults()[0]);
-    return result;
+    readAttributes(
+        serverOrClient, {asWrapper<ReadValueId>(items.data()), items.size()}, results, timestamps
+    );
+}
+
+template <typename T>
+std::vector<DataValue> readValues(
+    T& serverOrClient, Span<const NodeId> ids, TimestampsToReturn timestamps
+) {
+    std::vector<DataValue> results;
+    readValues(serverOrClient, ids, results, timestamps);
+    return results;
+}
+
+template <typename T>
+Result<void> tryReadAttributes(
+    T& serverOrClient,
+    Span<const ReadValueId> nodesToRead,
+    std::vector<DataValue>& results,
+    TimestampsToReturn timestamps
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<void> {
+        readAttributes(serverOrClient, nodesToRead, results, timestamps);
+        return {};
+    });
+}
+
+template <typename T>
+Result<std::vector<DataValue>> tryReadAttributes(
+    T& serverOrClient, Span<const ReadValueId> nodesToRead, TimestampsToReturn timestamps
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<std::vector<DataValue>> {
+        return readAttributes(serverOrClient, nodesToRead, timestamps);
+    });
+}
+
+// explicit template instantiation
+// clang-format off
+template DataValue readAttribute<Server>(Server&, const NodeId&, AttributeId, TimestampsToReturn);
+template DataValue readAttribute<Client>(Client&, const NodeId&, AttributeId, TimestampsToReturn);
+template Result<void> tryReadAttributes<Server>(Server&, Span<const ReadValueId>, std::vector<DataValue>&, TimestampsToReturn) noexcept;
+template Result<void> tryReadAttributes<Client>(Client&, Span<const ReadValueId>, std::vector<DataValue>&, TimestampsToReturn) noexcept;
+template Result<std::vector<DataValue>> tryReadAttributes<Server>(Server&, Span<const ReadValueId>, TimestampsToReturn) noexcept;
+template Result<std::vector<DataValue>> tryReadAttributes<Client>(Client&, Span<const ReadValueId>, TimestampsToReturn) noexcept;
+template std::vector<DataValue> readAttributes<Server>(Server&, Span<const ReadValueId>, TimestampsToReturn);
+template std::vector<DataValue> readAttributes<Client>(Client&, Span<const ReadValueId>, TimestampsToReturn);
+template void readValues<Server>(Server&, Span<const NodeId>, std::vector<DataValue>&, TimestampsToReturn);
+template void readValues<Client>(Client&, Span<const NodeId>, std::vector<DataValue>&, TimestampsToReturn);
+template std::vector<DataValue> readValues<Server>(Server&, Span<const NodeId>, TimestampsToReturn);
+template std::vector<DataValue> readValues<Client>(Client&, Span<const NodeId>, TimestampsToReturn);
+// clang-format on
+
+void readAttributeAsync(
+    Client& client,
+    const NodeId& id,
+    AttributeId attributeId,
+    TimestampsToReturn timestamps,
+    AsyncCallback<DataValue> callback
+) {
+    UA_ReadValueId item{};
+    const auto aliases = detail::getNodeAliases(client, false);
+    item.nodeId = detail::substituteAlias(aliases.get(), *id.handle());
+    item.attributeId = static_cast<uint32_t>(attributeId);
+
+    UA_ReadRequest request{};
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+    request.nodesToReadSize = 1;
+    request.nodesToRead = &item;
+
+    detail::sendAsyncRequest<ReadResponse>(
+        client,
+        request,
+        UA_TYPES[UA_TYPES_READREQUEST],
+        [cb = std::move(callback)](ReadResponse& response) {
+            DataValue result;
+            StatusCode status = response->responseHeader.serviceResult;
+            if (status.isGood()) {
+                auto results = response.getResults();
+                if (results.size() != 1) {
+                    status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                } else if (results[0]->hasStatus && detail::isBadStatus(results[0]->status)) {
+                    status = results[0]->status;
+                } else if (!results[0]->hasValue) {
+                    status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                } else {
+                    result.swap(results[0]);
+                }
+            }
+            cb(status, result);
+        }
+    );
+}
+
+std::future<DataValue> readAttributeAsync(
+    Client& client, const NodeId& id, AttributeId attributeId, TimestampsToReturn timestamps
+) {
+    return detail::invokeWithFuture<DataValue>([&](auto&& callback) {
+        readAttributeAsync(client, id, attributeId, timestamps, std::move(callback));
+    });
 }
 
 WriteResponse write(Client& client, const WriteRequest& request) {
-    WriteResponse response = UA_Client_Service_write(client.handle(), request);
+    WriteResponse response = detail::invokeService(client, StatisticsService::Write, [&] {
+        return detail::sendRequest<WriteResponse>(client, request, UA_TYPES[UA_TYPES_WRITEREQUEST]);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
@@ -75,9 +334,9 @@ WriteResponse write(Client& client, Span<const WriteValue> nodesToWrite) {
 }
 
 template <>
-void writeAttribute<Server>(
+Result<void> tryWriteAttribute<Server>(
     Server& server, const NodeId& id, AttributeId attributeId, const DataValue& value
-) {
+) noexcept {
     // avoid copy of value
     UA_WriteValue item{};
     item.nodeId = *id.handle();
@@ -85,27 +344,442 @@ void writeAttribute<Server>(
     item.value = *value.handle();  // shallow copy
     item.value.hasValue = true;
 
-    const auto status = UA_Server_write(server.handle(), &item);
-    detail::throwOnBadStatus(status);
+    const detail::NodeAccessScope scope(NodeAccess::Write);
+    const StatusCode status = UA_Server_write(server.handle(), &item);
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+    if (status.isGood() && attributeId == AttributeId::Value) {
+        detail::sampleEventDrivenMonitoredItems(server, id);
+    }
+#endif
+    return status;
 }
 
 template <>
-void writeAttribute<Client>(
+Result<void> tryWriteAttribute<Client>(
     Client& client, const NodeId& id, AttributeId attributeId, const DataValue& value
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<void> {
+        if (const auto cache = client.getAttributeCache()) {
+            cache->invalidate(id);
+        }
+        if (attributeId == AttributeId::Value) {
+            if (const auto coalescer = client.getWriteCoalescer()) {
+                coalescer->write(id, value, {});  // failures reported to the error callback
+                return {};
+            }
+        }
+        // avoid copy of value
+        UA_WriteValue item{};
+        const auto aliases = detail::getNodeAliases(client);
+        item.nodeId = detail::substituteAlias(aliases.get(), *id.handle());
+        item.attributeId = static_cast<uint32_t>(attributeId);
+        item.value = *value.handle();  // shallow copy
+        item.value.hasValue = true;
+
+        UA_WriteRequest request{};
+        request.nodesToWriteSize = 1;
+        request.nodesToWrite = &item;
+        WriteResponse response = detail::invokeService(client, StatisticsService::Write, [&] {
+            return detail::sendRequest<WriteResponse>(
+                client, request, UA_TYPES[UA_TYPES_WRITEREQUEST]
+            );
+        });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        if (detail::isBadStatus(serviceResult)) {
+            return BadResult(serviceResult);
+        }
+        const auto results = response.getResults();
+        if (results.size() != 1) {
+            return BadResult(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        return results[0];
+    });
+}
+
+template <typename T>
+void writeAttribute(
+    T& serverOrClient, const NodeId& id, AttributeId attributeId, const DataValue& value
 ) {
-    // avoid copy of value
+    tryWriteAttribute(serverOrClient, id, attributeId, value).value();
+}
+
+// explicit template instantiation
+template void writeAttribute<Server>(Server&, const NodeId&, AttributeId, const DataValue&);
+template void writeAttribute<Client>(Client&, const NodeId&, AttributeId, const DataValue&);
+
+void writeAttributeAsync(
+    Client& client,
+    const NodeId& id,
+    AttributeId attributeId,
+    const DataValue& value,
+    AsyncCallback<> callback
+) {
+    // avoid copy of value, request is encoded immediately
     UA_WriteValue item{};
-    item.nodeId = *id.handle();
+    const auto aliases = detail::getNodeAliases(client, false);
+    item.nodeId = detail::substituteAlias(aliases.get(), *id.handle());
     item.attributeId = static_cast<uint32_t>(attributeId);
     item.value = *value.handle();  // shallow copy
     item.value.hasValue = true;
 
-    auto response = write(client, {asWrapper<WriteValue>(&item), 1});
-    auto results = response.getResults();
-    if (results.size() != 1) {
-        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    UA_WriteRequest request{};
+    request.nodesToWriteSize = 1;
+    request.nodesToWrite = &item;
+
+    detail::sendAsyncRequest<WriteResponse>(
+        client,
+        request,
+        UA_TYPES[UA_TYPES_WRITEREQUEST],
+        [cb = std::move(callback)](WriteResponse& response) {
+            StatusCode status = response->responseHeader.serviceResult;
+            if (status.isGood()) {
+                auto results = response.getResults();
+                status = results.size() == 1 ? results[0]
+                                             : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+            }
+            cb(status);
+        }
+    );
+}
+
+std::future<void> writeAttributeAsync(
+    Client& client, const NodeId& id, AttributeId attributeId, const DataValue& value
+) {
+    return detail::invokeWithFuture<void>([&](auto&& callback) {
+        writeAttributeAsync(client, id, attributeId, value, std::move(callback));
+    });
+}
+
+namespace {
+
+/// Completed chunk requests of readArrayChunked / writeArrayChunked, shared with the callbacks.
+struct ChunkedTransfer {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::map<size_t, std::pair<StatusCode, DataValue>> completed;  // by chunk index
+};
+
+}  // namespace
+
+static std::string getChunkRange(size_t index, size_t length, size_t chunkElements) {
+    const auto first = static_cast<uint32_t>(index * chunkElements);
+    return NumericRange({{first, static_cast<uint32_t>(first + length - 1)}}).toString();
+}
+
+static void completeChunk(
+    ChunkedTransfer& transfer, size_t index, StatusCode status, DataValue&& value
+) {
+    {
+        const std::lock_guard lock(transfer.mutex);
+        transfer.completed.try_emplace(index, status, std::move(value));
+    }
+    transfer.cv.notify_one();
+}
+
+/// Wait until at least one chunk request completed and move the completed chunks to `ready`.
+/// Drives the client with runIterate unless the event loop runs in a background thread.
+static size_t collectChunks(
+    Client& client,
+    ChunkedTransfer& transfer,
+    std::map<size_t, std::pair<StatusCode, DataValue>>& ready
+) {
+    auto& context = client.getContext();
+    std::unique_lock lock(transfer.mutex);
+    if (!context.isMultiplexed()) {
+        while (transfer.completed.empty()) {
+            lock.unlock();
+            client.runIterate(10);
+            lock.lock();
+        }
+    } else {
+        // open62541 times out pending requests itself, the margin covers a stopped event loop
+        const auto timeout =
+            std::chrono::milliseconds(UA_Client_getConfig(client.handle())->timeout);
+        const bool owned = context.mutex.isOwnedByCurrentThread();
+        const size_t depth = owned ? context.mutex.unlockAll() : 0;
+        const bool completed = transfer.cv.wait_for(
+            lock, 2 * timeout + std::chrono::seconds(1), [&] { return !transfer.completed.empty(); }
+        );
+        if (owned) {
+            context.mutex.relock(depth);
+        }
+        if (!completed) {
+            throw BadStatus(UA_STATUSCODE_BADTIMEOUT);
+        }
+    }
+    const size_t count = transfer.completed.size();
+    ready.merge(transfer.completed);
+    transfer.completed.clear();
+    return count;
+}
+
+void readArrayChunked(
+    Client& client,
+    const NodeId& id,
+    size_t chunkElements,
+    const ArrayChunkCallback& callback,
+    size_t maxInFlight
+) {
+    if (chunkElements == 0 || maxInFlight == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    // the callbacks keep the state alive if we return or throw with chunks in flight
+    auto transfer = std::make_shared<ChunkedTransfer>();
+    const auto sendChunk = [&](size_t index) {
+        const auto range = getChunkRange(index, chunkElements, chunkElements);
+        UA_ReadValueId item{};
+        const auto aliases = detail::getNodeAliases(client, false);
+        item.nodeId = detail::substituteAlias(aliases.get(), *id.handle());
+        item.attributeId = UA_ATTRIBUTEID_VALUE;
+        item.indexRange = detail::toNativeString(range);  // request is encoded immediately
+
+        UA_ReadRequest request{};
+        request.timestampsToReturn = UA_TIMESTAMPSTORETURN_NEITHER;
+        request.nodesToReadSize = 1;
+        request.nodesToRead = &item;
+
+        detail::sendAsyncRequest<ReadResponse>(
+            client,
+            request,
+            UA_TYPES[UA_TYPES_READREQUEST],
+            [transfer, index](ReadResponse& response) {
+                StatusCode status = response->responseHeader.serviceResult;
+                DataValue result;
+                if (status.isGood()) {
+                    auto results = response.getResults();
+                    if (results.size() != 1) {
+                        status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                    } else {
+                        if (results[0]->hasStatus) {
+                            status = results[0]->status;
+                        }
+                        result.swap(results[0]);
+                    }
+                }
+                completeChunk(*transfer, index, status, std::move(result));
+            }
+        );
+    };
+
+    std::map<size_t, std::pair<StatusCode, DataValue>> ready;
+    size_t nextRequest = 0;
+    size_t nextDelivery = 0;
+    size_t inFlight = 0;
+    bool end = false;
+    while (!end) {
+        for (; inFlight < maxInFlight; ++inFlight) {
+            sendChunk(nextRequest++);
+        }
+        inFlight -= collectChunks(client, *transfer, ready);
+        // deliver in order, chunks after the end are discarded
+        for (auto it = ready.begin(); !end && it != ready.end() && it->first == nextDelivery;
+             it = ready.erase(it), ++nextDelivery) {
+            auto& [status, dv] = it->second;
+            if (status == UA_STATUSCODE_BADINDEXRANGENODATA) {
+                end = true;  // array length is a multiple of the chunk size
+                break;
+            }
+            detail::throwOnBadStatus(status);
+            auto& chunk = dv.getValue();
+            const size_t length = chunk.getArrayLength();
+            if (length < chunkElements) {
+                end = true;
+            }
+            if (length > 0) {
+                callback(nextDelivery * chunkElements, chunk);
+            }
+        }
+    }
+}
+
+void writeArrayChunked(
+    Client& client,
+    const NodeId& id,
+    const Variant& array,
+    size_t chunkElements,
+    size_t maxInFlight
+) {
+    if (chunkElements == 0 || maxInFlight == 0) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    if (!array.isArray()) {
+        throw BadVariantAccess("Variant is not an array");
+    }
+    const size_t size = array.getArrayLength();
+    if (size == 0) {
+        writeValue(client, id, array);
+        return;
+    }
+    const auto& type = *array.getDataType();
+    auto* data = static_cast<uint8_t*>(const_cast<void*>(array.data()));  // NOLINT
+    const size_t chunks = (size + chunkElements - 1) / chunkElements;
+
+    auto transfer = std::make_shared<ChunkedTransfer>();
+    const auto sendChunk = [&](size_t index) {
+        const size_t offset = index * chunkElements;
+        const size_t length = std::min(chunkElements, size - offset);
+        const auto range = getChunkRange(index, length, chunkElements);
+        // borrow the elements, the request is encoded immediately
+        UA_WriteValue item{};
+        const auto aliases = detail::getNodeAliases(client, false);
+        item.nodeId = detail::substituteAlias(aliases.get(), *id.handle());
+        item.attributeId = UA_ATTRIBUTEID_VALUE;
+        item.indexRange = detail::toNativeString(range);
+        item.value.hasValue = true;
+        item.value.value.type = &type;
+        item.value.value.storageType = UA_VARIANT_DATA_NODELETE;
+        item.value.value.data = data + offset * type.memSize;  // NOLINT
+        item.value.value.arrayLength = length;
+
+        UA_WriteRequest request{};
+        request.nodesToWriteSize = 1;
+        request.nodesToWrite = &item;
+
+        detail::sendAsyncRequest<WriteResponse>(
+            client,
+            request,
+            UA_TYPES[UA_TYPES_WRITEREQUEST],
+            [transfer, index](WriteResponse& response) {
+                StatusCode status = response->responseHeader.serviceResult;
+                if (status.isGood()) {
+                    auto results = response.getResults();
+                    status = results.size() == 1 ? results[0]
+                                                 : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+                }
+                completeChunk(*transfer, index, status, {});
+            }
+        );
+    };
+
+    std::map<size_t, std::pair<StatusCode, DataValue>> ready;
+    size_t nextRequest = 0;
+    size_t acknowledged = 0;
+    size_t inFlight = 0;
+    while (acknowledged < chunks) {
+        for (; inFlight < maxInFlight && nextRequest < chunks; ++inFlight) {
+            sendChunk(nextRequest++);
+        }
+        const size_t count = collectChunks(client, *transfer, ready);
+        inFlight -= count;
+        acknowledged += count;
+        for (const auto& [index, result] : ready) {
+            detail::throwOnBadStatus(result.first);
+        }
+        ready.clear();
+    }
+}
+
+template <>
+std::vector<StatusCode> writeAttributes<Server>(
+    Server& server, Span<const WriteValue> nodesToWrite
+) {
+    std::vector<StatusCode> results;
+    results.reserve(nodesToWrite.size());
+    const detail::NodeAccessScope scope(NodeAccess::Write);
+    for (const auto& item : nodesToWrite) {
+        results.emplace_back(UA_Server_write(server.handle(), item.handle()));
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+        if (results.back().isGood() && item.getAttributeId() == AttributeId::Value) {
+            detail::sampleEventDrivenMonitoredItems(server, item.getNodeId());
+        }
+#endif
     }
-    detail::throwOnBadStatus(results[0]);
+    return results;
 }
 
+template <>
+std::vector<StatusCode> writeAttributes<Client>(
+    Client& client, Span<const WriteValue> nodesToWrite
+) {
+    if (const auto cache = client.getAttributeCache()) {
+        for (const auto& item : nodesToWrite) {
+            cache->invalidate(item.getNodeId());
+        }
+    }
+    std::vector<StatusCode> results(nodesToWrite.size());
+    const auto aliases = detail::getNodeAliases(client);
+    std::vector<UA_WriteValue> substituted;
+    const auto sendChunk = [&](size_t offset, size_t count) {
+        const auto chunk = nodesToWrite.subview(offset, count);
+        // avoid copy of nodesToWrite
+        UA_WriteRequest request{};
+        request.nodesToWriteSize = chunk.size();
+        request.nodesToWrite = asNative(const_cast<WriteValue*>(chunk.data()));  // NOLINT
+        if (aliases != nullptr) {
+            // shallow copies with the registered node ids
+            substituted.assign(request.nodesToWrite, request.nodesToWrite + chunk.size());
+            for (auto& item : substituted) {
+                item.nodeId = detail::substituteAlias(aliases.get(), item.nodeId);
+            }
+            request.nodesToWrite = substituted.data();
+        }
+        WriteResponse response = detail::invokeService(client, StatisticsService::Write, [&] {
+            return detail::sendRequest<WriteResponse>(
+                client, request, UA_TYPES[UA_TYPES_WRITEREQUEST]
+            );
+        });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        const auto chunkResults = response.getResults();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            if (detail::isBadStatus(serviceResult)) {
+                results[offset + i] = serviceResult;
+            } else if (i >= chunkResults.size()) {
+                results[offset + i] = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            } else {
+                results[offset + i] = chunkResults[i];
+            }
+        }
+        return serviceResult;
+    };
+    detail::forEachChunk(
+        client,
+        StatisticsService::Write,
+        detail::getOperationLimits(client).maxNodesPerWrite,
+        nodesToWrite.size(),
+        sendChunk
+    );
+    return results;
+}
+
+template <typename T>
+std::vector<StatusCode> writeValues(
+    T& serverOrClient, Span<const NodeId> ids, Span<const Variant> values
+) {
+    if (ids.size() != values.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    // avoid copy of ids and values
+    std::vector<UA_WriteValue> items(ids.size());
+    for (size_t i = 0; i < ids.size(); ++i) {
+        items[i].nodeId = *ids[i].handle();  // shallow copy
+        items[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        items[i].value.value = *values[i].handle();  // shallow copy
+        items[i].value.hasValue = true;
+    }
+    return writeAttributes(serverOrClient, {asWrapper<WriteValue>(items.data()), items.size()});
+}
+
+template <typename T>
+Result<std::vector<StatusCode>> tryWriteAttributes(
+    T& serverOrClient, Span<const WriteValue> nodesToWrite
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<std::vector<StatusCode>> {
+        return writeAttributes(serverOrClient, nodesToWrite);
+    });
+}
+
+// explicit template instantiation
+template Result<std::vector<StatusCode>> tryWriteAttributes<Server>(
+    Server&, Span<const WriteValue>
+) noexcept;
+template Result<std::vector<StatusCode>> tryWriteAttributes<Client>(
+    Client&, Span<const WriteValue>
+) noexcept;
+template std::vector<StatusCode> writeValues<Server>(
+    Server&, Span<const NodeId>, Span<const Variant>
+);
+template std::vector<StatusCode> writeValues<Client>(
+    Client&, Span<const NodeId>, Span<const Variant>
+);
+
 }  // namespace opcua::services
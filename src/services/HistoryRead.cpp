@@ -0,0 +1,158 @@
+#include "open62541pp/services/HistoryRead.h"
+
+#ifdef UA_ENABLE_HISTORIZING
+
+#include <algorithm>  // min
+#include <utility>  // exchange, move
+
+#include "open62541pp/Client.h"
+#include "open62541pp/TypeWrapper.h"
+
+#include "../open62541_impl.h"
+#include "OperationLimits.h"
+#include "ServiceStatistics.h"
+
+namespace opcua::services {
+
+using HistoryReadResponse = TypeWrapper<UA_HistoryReadResponse, UA_TYPES_HISTORYREADRESPONSE>;
+
+HistoryRawReader::HistoryRawReader(
+    Client& client,
+    Span<const NodeId> ids,
+    DateTime startTime,
+    DateTime endTime,
+    const HistoryReadRawOptions& options
+)
+    : client_(&client),
+      startTime_(startTime),
+      endTime_(endTime),
+      options_(options) {
+    nodes_.reserve(ids.size());
+    for (const auto& id : ids) {
+        nodes_.push_back({id, {}, {}, {}, false});
+    }
+}
+
+HistoryRawReader::HistoryRawReader(HistoryRawReader&& other) noexcept
+    : client_(std::exchange(other.client_, nullptr)),
+      startTime_(other.startTime_),
+      endTime_(other.endTime_),
+      options_(other.options_),
+      nodes_(std::move(other.nodes_)) {}
+
+/// Send a history read request for the given nodes.
+/// The node ids and continuation points are shallow copies of the node states.
+static UA_HistoryReadResponse sendHistoryReadRaw(
+    Client& client,
+    UA_ReadRawModifiedDetails& details,
+    const HistoryReadRawOptions& options,
+    bool releaseContinuationPoints,
+    std::vector<UA_HistoryReadValueId>& items
+) {
+    UA_HistoryReadRequest request{};
+    UA_ExtensionObject_setValue(
+        &request.historyReadDetails, &details, &UA_TYPES[UA_TYPES_READRAWMODIFIEDDETAILS]
+    );
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(options.timestamps);
+    request.releaseContinuationPoints = releaseContinuationPoints;
+    request.nodesToReadSize = items.size();
+    request.nodesToRead = items.data();
+    return detail::invokeService(client, StatisticsService::HistoryRead, [&] {
+        return UA_Client_Service_historyRead(client.handle(), request);
+    });
+}
+
+HistoryRawReader::~HistoryRawReader() {
+    if (client_ == nullptr) {
+        return;
+    }
+    std::vector<UA_HistoryReadValueId> items;
+    for (const auto& node : nodes_) {
+        if (!node.done && !node.continuationPoint.empty()) {
+            auto& item = items.emplace_back();
+            item.nodeId = *node.id.handle();  // shallow copy
+            item.continuationPoint = *node.continuationPoint.handle();  // shallow copy
+        }
+    }
+    if (items.empty()) {
+        return;
+    }
+    try {
+        UA_ReadRawModifiedDetails details{};
+        const HistoryReadResponse response(
+            sendHistoryReadRaw(*client_, details, options_, true, items)
+        );
+    } catch (...) {  // NOLINT, ignore
+    }
+}
+
+/// Move the values of a history read result into the node state (reuses the value buffer).
+static void takeHistoryData(UA_HistoryReadResult& result, std::vector<DataValue>& values) {
+    const auto& data = result.historyData;
+    if (data.encoding != UA_EXTENSIONOBJECT_DECODED &&
+        data.encoding != UA_EXTENSIONOBJECT_DECODED_NODELETE) {
+        return;
+    }
+    if (data.content.decoded.type != &UA_TYPES[UA_TYPES_HISTORYDATA]) {
+        return;
+    }
+    auto* historyData = static_cast<UA_HistoryData*>(data.content.decoded.data);
+    values.resize(historyData->dataValuesSize);
+    for (size_t i = 0; i < historyData->dataValuesSize; ++i) {
+        values[i].swap(historyData->dataValues[i]);  // NOLINT
+    }
+}
+
+bool HistoryRawReader::next() {
+    std::vector<size_t> pending;
+    for (size_t i = 0; i < nodes_.size(); ++i) {
+        nodes_[i].values.clear();
+        if (!nodes_[i].done) {
+            pending.push_back(i);
+        }
+    }
+    if (pending.empty()) {
+        return false;
+    }
+
+    UA_ReadRawModifiedDetails details{};
+    details.isReadModified = false;
+    details.startTime = startTime_.get();
+    details.endTime = endTime_.get();
+    details.numValuesPerNode = options_.numValuesPerNode;
+    details.returnBounds = options_.returnBounds;
+
+    const size_t chunkSize = detail::getChunkSize(
+        detail::getOperationLimits(*client_).maxNodesPerHistoryReadData, pending.size()
+    );
+    std::vector<UA_HistoryReadValueId> items;
+    for (size_t offset = 0; offset < pending.size(); offset += chunkSize) {
+        const size_t count = std::min(chunkSize, pending.size() - offset);
+        items.assign(count, UA_HistoryReadValueId{});
+        for (size_t i = 0; i < count; ++i) {
+            const auto& node = nodes_[pending[offset + i]];
+            items[i].nodeId = *node.id.handle();  // shallow copy
+            items[i].continuationPoint = *node.continuationPoint.handle();  // shallow copy
+        }
+
+        HistoryReadResponse response(sendHistoryReadRaw(*client_, details, options_, false, items));
+        detail::throwOnBadStatus(response->responseHeader.serviceResult);
+        if (response->resultsSize != count) {
+            throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+
+        for (size_t i = 0; i < count; ++i) {
+            auto& node = nodes_[pending[offset + i]];
+            auto& result = response->results[i];  // NOLINT
+            node.status = result.statusCode;
+            node.continuationPoint.swap(result.continuationPoint);
+            takeHistoryData(result, node.values);
+            node.done = detail::isBadStatus(node.status) || node.continuationPoint.empty();
+        }
+    }
+    return true;
+}
+
+}  // namespace opcua::services
+
+#endif
@@ -4,6 +4,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <utility>  // move
 
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
@@ -13,15 +14,151 @@
 #include "open62541pp/types/Variant.h"
 
 #include "../open62541_impl.h"
+#include "AsyncService.h"
+#include "OperationLimits.h"
+#include "ServiceStatistics.h"
 
 namespace opcua::services {
 
-template <>
-std::vector<Variant> call(
+/// Call a method and collect the output arguments in a vector of type `Vector`, e.g. a
+/// `std::pmr::vector` with storage from a memory resource.
+template <typename Vector>
+static Result<Vector> tryCallImpl(
     Server& server,
     const NodeId& objectId,
     const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    const typename Vector::allocator_type& allocator
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<Vector> {
+        UA_CallMethodRequest request{};
+        request.objectId = objectId;
+        request.methodId = methodId;
+        request.inputArgumentsSize = inputArguments.size();
+        request.inputArguments = const_cast<UA_Variant*>(  // NOLINT
+            asNative(inputArguments.data())
+        );
+
+        using CallResult = TypeWrapper<UA_CallMethodResult, UA_TYPES_CALLMETHODRESULT>;
+        CallResult result = UA_Server_call(server.handle(), &request);
+        if (detail::isBadStatus(result->statusCode)) {
+            return BadResult(result->statusCode);
+        }
+        for (size_t i = 0; i < result->inputArgumentResultsSize; ++i) {
+            if (detail::isBadStatus(result->inputArgumentResults[i])) {  // NOLINT
+                return BadResult(result->inputArgumentResults[i]);  // NOLINT
+            }
+        }
+        auto* first = result->outputArguments;
+        auto* last = result->outputArguments + result->outputArgumentsSize;  // NOLINT
+        return Vector(std::make_move_iterator(first), std::make_move_iterator(last), allocator);
+    });
+}
+
+template <typename Vector>
+static Result<Vector> tryCallImpl(
+    Client& client,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    const typename Vector::allocator_type& allocator
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<Vector> {
+        size_t outputSize{};
+        UA_Variant* output{};
+        const auto status = detail::invokeService(client, StatisticsService::Call, [&] {
+            return UA_Client_call(
+                client.handle(),
+                objectId,
+                methodId,
+                inputArguments.size(),
+                asNative(inputArguments.data()),
+                &outputSize,
+                &output
+            );
+        });
+        Vector result(
+            std::make_move_iterator(output),
+            std::make_move_iterator(output + outputSize),  // NOLINT
+            allocator
+        );
+        UA_free(output);  // NOLINT
+        if (detail::isBadStatus(status)) {
+            return BadResult(status);
+        }
+        return {std::move(result)};
+    });
+}
+
+template <typename T>
+Result<std::vector<Variant>> tryCall(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
     Span<const Variant> inputArguments
+) noexcept {
+    return tryCallImpl<std::vector<Variant>>(
+        serverOrClient, objectId, methodId, inputArguments, {}
+    );
+}
+
+// explicit template instantiation
+template Result<std::vector<Variant>> tryCall<Server>(
+    Server&, const NodeId&, const NodeId&, Span<const Variant>
+) noexcept;
+template Result<std::vector<Variant>> tryCall<Client>(
+    Client&, const NodeId&, const NodeId&, Span<const Variant>
+) noexcept;
+
+template <typename T>
+std::vector<Variant> call(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+) {
+    return tryCall(serverOrClient, objectId, methodId, inputArguments).value();
+}
+
+// explicit template instantiation
+template std::vector<Variant> call<Server>(
+    Server&, const NodeId&, const NodeId&, Span<const Variant>
+);
+template std::vector<Variant> call<Client>(
+    Client&, const NodeId&, const NodeId&, Span<const Variant>
+);
+
+#ifdef UAPP_HAS_PMR
+template <typename T>
+std::pmr::vector<Variant> call(
+    T& serverOrClient,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    std::pmr::memory_resource* resource
+) {
+    auto result = tryCallImpl<std::pmr::vector<Variant>>(
+        serverOrClient, objectId, methodId, inputArguments, resource
+    );
+    return std::move(result).value();
+}
+
+// explicit template instantiation
+template std::pmr::vector<Variant> call<Server>(
+    Server&, const NodeId&, const NodeId&, Span<const Variant>, std::pmr::memory_resource*
+);
+template std::pmr::vector<Variant> call<Client>(
+    Client&, const NodeId&, const NodeId&, Span<const Variant>, std::pmr::memory_resource*
+);
+#endif
+
+template <>
+void call(
+    Server& server,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    Span<Variant> outputArguments
 ) {
     UA_CallMethodRequest request{};
     request.objectId = objectId;
@@ -30,43 +167,180 @@ std::vector<Variant> call(
     request.inputArguments = const_cast<UA_Variant*>(asNative(inputArguments.data()));  // NOLINT
 
     using Result = TypeWrapper<UA_CallMethodResult, UA_TYPES_CALLMETHODRESULT>;
-    const Result result = UA_Server_call(server.handle(), &request);
+    Result result = UA_Server_call(server.handle(), &request);
     detail::throwOnBadStatus(result->statusCode);
     for (size_t i = 0; i < result->inputArgumentResultsSize; ++i) {
         detail::throwOnBadStatus(result->inputArgumentResults[i]);  // NOLINT
     }
-
-    return {
-        std::make_move_iterator(result->outputArguments),
-        std::make_move_iterator(result->outputArguments + result->outputArgumentsSize)  // NOLINT
-    };
+    if (result->outputArgumentsSize != outputArguments.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    for (size_t i = 0; i < outputArguments.size(); ++i) {
+        outputArguments[i].swap(result->outputArguments[i]);  // NOLINT
+    }
 }
 
 template <>
-std::vector<Variant> call(
+void call(
     Client& client,
     const NodeId& objectId,
     const NodeId& methodId,
-    Span<const Variant> inputArguments
+    Span<const Variant> inputArguments,
+    Span<Variant> outputArguments
 ) {
     size_t outputSize{};
     UA_Variant* output{};
-    const auto status = UA_Client_call(
-        client.handle(),
-        objectId,
-        methodId,
-        inputArguments.size(),
-        asNative(inputArguments.data()),
-        &outputSize,
-        &output
+    const auto status = detail::invokeService(client, StatisticsService::Call, [&] {
+        return UA_Client_call(
+            client.handle(),
+            objectId,
+            methodId,
+            inputArguments.size(),
+            asNative(inputArguments.data()),
+            &outputSize,
+            &output
+        );
+    });
+    const bool sizeMatch = outputSize == outputArguments.size();
+    if (status == UA_STATUSCODE_GOOD && sizeMatch) {
+        for (size_t i = 0; i < outputSize; ++i) {
+            outputArguments[i].swap(output[i]);  // NOLINT
+        }
+    }
+    UA_Array_delete(output, outputSize, &UA_TYPES[UA_TYPES_VARIANT]);
+    detail::throwOnBadStatus(status);
+    if (!sizeMatch) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+}
+
+template <>
+std::vector<CallMethodResult> callBatch<Server>(
+    Server& server, Span<const CallMethodRequest> methodsToCall
+) {
+    std::vector<CallMethodResult> results;
+    results.reserve(methodsToCall.size());
+    for (const auto& request : methodsToCall) {
+        results.emplace_back(UA_Server_call(server.handle(), request.handle()));
+    }
+    return results;
+}
+
+template <>
+std::vector<CallMethodResult> callBatch<Client>(
+    Client& client, Span<const CallMethodRequest> methodsToCall
+) {
+    std::vector<CallMethodResult> results(methodsToCall.size());
+    const auto sendChunk = [&](size_t offset, size_t count) {
+        const auto chunk = methodsToCall.subview(offset, count);
+        // avoid copy of methodsToCall
+        UA_CallRequest request{};
+        request.methodsToCallSize = chunk.size();
+        request.methodsToCall = asNative(const_cast<CallMethodRequest*>(chunk.data()));  // NOLINT
+        using Response = TypeWrapper<UA_CallResponse, UA_TYPES_CALLRESPONSE>;
+        Response response = detail::invokeService(client, StatisticsService::Call, [&] {
+            return detail::sendRequest<Response>(client, request, UA_TYPES[UA_TYPES_CALLREQUEST]);
+        });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            auto& result = results[offset + i];
+            if (detail::isBadStatus(serviceResult)) {
+                result->statusCode = serviceResult;
+            } else if (i >= response->resultsSize) {
+                result->statusCode = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            } else {
+                result.swap(response->results[i]);  // NOLINT
+            }
+        }
+        return serviceResult;
+    };
+    detail::forEachChunk(
+        client,
+        StatisticsService::Call,
+        detail::getOperationLimits(client).maxNodesPerMethodCall,
+        methodsToCall.size(),
+        sendChunk
     );
-    std::vector<Variant> result(
-        std::make_move_iterator(output),
-        std::make_move_iterator(output + outputSize)  // NOLINT
+    return results;
+}
+
+template <typename T>
+Result<std::vector<CallMethodResult>> tryCallBatch(
+    T& serverOrClient, Span<const CallMethodRequest> methodsToCall
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<std::vector<CallMethodResult>> {
+        return callBatch(serverOrClient, methodsToCall);
+    });
+}
+
+// explicit template instantiation
+template Result<std::vector<CallMethodResult>> tryCallBatch<Server>(
+    Server&, Span<const CallMethodRequest>
+) noexcept;
+template Result<std::vector<CallMethodResult>> tryCallBatch<Client>(
+    Client&, Span<const CallMethodRequest>
+) noexcept;
+
+void callAsync(
+    Client& client,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments,
+    AsyncCallback<std::vector<Variant>> callback
+) {
+    // avoid copy of input arguments, request is encoded immediately
+    UA_CallMethodRequest item{};
+    item.objectId = objectId;
+    item.methodId = methodId;
+    item.inputArgumentsSize = inputArguments.size();
+    item.inputArguments = const_cast<UA_Variant*>(asNative(inputArguments.data()));  // NOLINT
+
+    UA_CallRequest request{};
+    request.methodsToCallSize = 1;
+    request.methodsToCall = &item;
+
+    using CallResponse = TypeWrapper<UA_CallResponse, UA_TYPES_CALLRESPONSE>;
+    detail::sendAsyncRequest<CallResponse>(
+        client,
+        request,
+        UA_TYPES[UA_TYPES_CALLREQUEST],
+        [cb = std::move(callback)](CallResponse& response) {
+            std::vector<Variant> outputs;
+            StatusCode status = response->responseHeader.serviceResult;
+            if (status.isGood()) {
+                if (response->resultsSize != 1) {
+                    status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                } else {
+                    const auto& result = *response->results;
+                    status = result.statusCode;
+                    for (size_t i = 0; i < result.inputArgumentResultsSize; ++i) {
+                        if (detail::isBadStatus(result.inputArgumentResults[i])) {  // NOLINT
+                            status = result.inputArgumentResults[i];  // NOLINT
+                            break;
+                        }
+                    }
+                }
+            }
+            if (status.isGood()) {
+                auto& result = *response->results;
+                auto* first = result.outputArguments;
+                auto* last = result.outputArguments + result.outputArgumentsSize;  // NOLINT
+                outputs.assign(std::make_move_iterator(first), std::make_move_iterator(last));
+            }
+            cb(status, outputs);
+        }
     );
-    UA_free(output);  // NOLINT
-    detail::throwOnBadStatus(status);
-    return result;
+}
+
+std::future<std::vector<Variant>> callAsync(
+    Client& client,
+    const NodeId& objectId,
+    const NodeId& methodId,
+    Span<const Variant> inputArguments
+) {
+    return detail::invokeWithFuture<std::vector<Variant>>([&](auto&& callback) {
+        callAsync(client, objectId, methodId, inputArguments, std::move(callback));
+    });
 }
 
 }  // namespace opcua::services
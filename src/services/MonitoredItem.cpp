@@ -2,25 +2,73 @@
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
+#include <algorithm>  // min, sort, stable_sort
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <type_traits>  // is_same_v
+#include <unordered_map>
 #include <utility>  // move
+#include <vector>
 
 #include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/EventFilterBuilder.h"  // SharedEventFilter
+#include "open62541pp/NodeIds.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/Span.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/services/Method.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/DateTime.h"
 #include "open62541pp/types/Variant.h"
 
 #include "../ClientContext.h"
+#include "../NodeProfiler.h"
 #include "../ServerContext.h"
+#include "../detail/AggregateCalculator.h"
+#include "../detail/LastReportedValue.h"
 #include "../open62541_impl.h"
+#include "OperationLimits.h"
+#include "ServiceStatistics.h"
+#include "SubscriptionRecovery.h"
 
 namespace opcua::services {
 
+void MonitoringParameters::setAggregateFilter(
+    AggregateFunction function, double processingInterval
+) {
+    setFilter(AggregateFilter(
+        DateTime::now(), NodeId(0, static_cast<uint32_t>(function)), processingInterval
+    ));
+}
+
+/// Store the requested parameters to recreate the item, a shared event filter is not copied.
+static void storeParameters(
+    ClientContext::MonitoredItem& monitoredItem, MonitoringParameters& parameters
+) {
+    const auto& eventFilter = monitoredItem.eventFilter;
+    if (!eventFilter.has_value() ||
+        parameters.filter.getDecodedData() != static_cast<const void*>(&eventFilter->get())) {
+        monitoredItem.parameters = parameters;
+        return;
+    }
+    ExtensionObject filter = std::move(parameters.filter);
+    monitoredItem.parameters = parameters;  // without the filter
+    monitoredItem.parameters.filter = eventFilter->toExtensionObject();
+    parameters.filter = std::move(filter);
+}
+
+/// Server timestamp or source timestamp of a data change, 0 if the value has no timestamps.
+static UA_DateTime getTimestamp(const UA_DataValue& dv) noexcept {
+    if (dv.hasServerTimestamp) {
+        return dv.serverTimestamp;
+    }
+    return dv.hasSourceTimestamp ? dv.sourceTimestamp : 0;
+}
+
 static void dataChangeNotificationCallback(
     [[maybe_unused]] UA_Server* server,
     uint32_t monitoredItemId,
@@ -35,7 +83,10 @@ static void dataChangeNotificationCallback(
     }
     auto* monitoredItem = static_cast<ServerContext::MonitoredItem*>(monitoredItemContext);
     auto& callback = monitoredItem->dataChangeCallback;
-    if (callback) {
+    if (callback && detail::applyClientFilter(*monitoredItem, *value)) {
+        if (monitoredItem->health != nullptr) {
+            monitoredItem->health->recordDataChange(*value);
+        }
         detail::invokeCatchIgnore([&] {
             callback(0U, monitoredItemId, asWrapper<DataValue>(*value));
         });
@@ -50,6 +101,39 @@ static void dataChangeNotificationCallback(
     void* monContext,
     UA_DataValue* value
 ) noexcept {
+    if (monContext != nullptr) {
+        auto* monitoredItem = static_cast<ClientContext::MonitoredItem*>(monContext);
+        const auto timestamp = getTimestamp(*value);
+        if (std::exchange(monitoredItem->transferred, false) && timestamp != 0 &&
+            timestamp <= monitoredItem->lastTimestamp) {
+            return;  // initial value of a transferred subscription, delivered before
+        }
+        monitoredItem->lastTimestamp = timestamp;
+        if (!detail::applyClientFilter(*monitoredItem, *value)) {
+            return;
+        }
+    }
+    if (subContext != nullptr) {
+        auto* subscription = static_cast<ClientContext::Subscription*>(subContext);
+        ++subscription->notificationCount;
+        subscription->health.recordDataChange(*value);
+        if (subscription->notificationQueue != nullptr) {
+            subscription->notificationQueue->push({monId, std::move(asWrapper<DataValue>(*value))});
+            return;
+        }
+        if (subscription->dataChangeBatchCallback) {
+            detail::invokeCatchIgnore([&] {
+                if (subscription->pendingDataChanges.empty()) {
+                    getContext(client).pendingDataChangeBatches.push_back(subId);
+                }
+                // take ownership, the notification is cleared with the PublishResponse anyway
+                subscription->pendingDataChanges.push_back(
+                    {monId, std::move(asWrapper<DataValue>(*value))}
+                );
+            });
+            return;
+        }
+    }
     if (monContext == nullptr) {
         return;
     }
@@ -69,6 +153,11 @@ static void eventNotificationCallback(
     size_t nEventFields,
     UA_Variant* eventFields
 ) noexcept {
+    if (subContext != nullptr) {
+        auto* subscription = static_cast<ClientContext::Subscription*>(subContext);
+        ++subscription->notificationCount;
+        subscription->health.recordEvent();
+    }
     if (monContext == nullptr) {
         return;
     }
@@ -95,7 +184,7 @@ static void deleteMonitoredItemCallback(
         }
     }
     ClientContext& clientContext = getContext(client);
-    clientContext.monitoredItems.erase({subId, monId});
+    clientContext.eraseMonitoredItem(subId, monId);
 }
 
 inline static void copyMonitoringParametersToNative(
@@ -129,31 +218,232 @@ uint32_t createMonitoredItemDataChange(
     request.monitoringMode = static_cast<UA_MonitoringMode>(monitoringMode);
     copyMonitoringParametersToNative(parameters, request.requestedParameters);
 
-    auto monitoredItemContext = std::make_unique<ClientContext::MonitoredItem>();
-    monitoredItemContext->itemToMonitor = itemToMonitor;
+    auto& clientContext = client.getContext();
+    auto* monitoredItemContext = clientContext.monitoredItemPool.acquire();
+    monitoredItemContext->setItemToMonitor(itemToMonitor, clientContext.nodeIdPool.get());
     monitoredItemContext->dataChangeCallback = std::move(dataChangeCallback);
     monitoredItemContext->deleteCallback = std::move(deleteCallback);
+    monitoredItemContext->monitoringMode = monitoringMode;
+    monitoredItemContext->parameters = parameters;
 
     using Result = TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
-    const Result result = UA_Client_MonitoredItems_createDataChange(
-        client.handle(),
-        subscriptionId,
-        static_cast<UA_TimestampsToReturn>(parameters.timestamps),
-        request,
-        monitoredItemContext.get(),
-        dataChangeNotificationCallback,
-        deleteMonitoredItemCallback
-    );
-    detail::throwOnBadStatus(result->statusCode);
+    const Result result = detail::invokeService(client, StatisticsService::MonitoredItem, [&] {
+        return UA_Client_MonitoredItems_createDataChange(
+            client.handle(),
+            subscriptionId,
+            static_cast<UA_TimestampsToReturn>(parameters.timestamps),
+            request,
+            monitoredItemContext,
+            dataChangeNotificationCallback,
+            deleteMonitoredItemCallback
+        );
+    });
+    if (detail::isBadStatus(result->statusCode)) {
+        clientContext.monitoredItemPool.release(monitoredItemContext);
+        detail::throwOnBadStatus(result->statusCode);
+    }
     reviseMonitoringParameters(parameters, result);
 
     const auto monitoredItemId = result->monitoredItemId;
-    client.getContext().monitoredItems.insert_or_assign(
-        {subscriptionId, monitoredItemId}, std::move(monitoredItemContext)
-    );
+    clientContext.insertMonitoredItem(subscriptionId, monitoredItemId, monitoredItemContext);
     return monitoredItemId;
 }
 
+std::vector<MonitoredItemCreateResult> createMonitoredItemsDataChange(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const ReadValueId> itemsToMonitor,
+    MonitoringMode monitoringMode,
+    const MonitoringParameters& parameters,
+    const DataChangeNotificationCallback& dataChangeCallback,
+    const DeleteMonitoredItemCallback& deleteCallback
+) {
+    auto& clientContext = client.getContext();
+    std::vector<MonitoredItemCreateResult> results(itemsToMonitor.size());
+    const size_t chunkSize = detail::getChunkSize(
+        detail::getOperationLimits(client).maxMonitoredItemsPerCall, itemsToMonitor.size()
+    );
+
+    std::vector<UA_MonitoredItemCreateRequest> items;
+    std::vector<void*> contexts;
+    std::vector<UA_Client_DataChangeNotificationCallback> callbacks;
+    std::vector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks;
+    for (size_t offset = 0; offset < itemsToMonitor.size(); offset += chunkSize) {
+        const auto chunk = itemsToMonitor.subview(offset, chunkSize);
+        items.assign(chunk.size(), {});
+        contexts.assign(chunk.size(), nullptr);
+        callbacks.assign(chunk.size(), dataChangeNotificationCallback);
+        deleteCallbacks.assign(chunk.size(), deleteMonitoredItemCallback);
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            items[i].itemToMonitor = *chunk[i].handle();  // shallow copy
+            items[i].monitoringMode = static_cast<UA_MonitoringMode>(monitoringMode);
+            copyMonitoringParametersToNative(parameters, items[i].requestedParameters);
+
+            auto* monitoredItemContext = clientContext.monitoredItemPool.acquire();
+            monitoredItemContext->setItemToMonitor(chunk[i], clientContext.nodeIdPool.get());
+            monitoredItemContext->dataChangeCallback = dataChangeCallback;
+            monitoredItemContext->deleteCallback = deleteCallback;
+            monitoredItemContext->monitoringMode = monitoringMode;
+            monitoredItemContext->parameters = parameters;
+            contexts[i] = monitoredItemContext;
+        }
+
+        UA_CreateMonitoredItemsRequest request{};
+        request.subscriptionId = subscriptionId;
+        request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(parameters.timestamps);
+        request.itemsToCreateSize = items.size();
+        request.itemsToCreate = items.data();
+
+        using Response =
+            TypeWrapper<UA_CreateMonitoredItemsResponse, UA_TYPES_CREATEMONITOREDITEMSRESPONSE>;
+        const Response response = detail::invokeService(
+            client, StatisticsService::MonitoredItem, [&] {
+                return UA_Client_MonitoredItems_createDataChanges(
+                    client.handle(),
+                    request,
+                    contexts.data(),
+                    callbacks.data(),
+                    deleteCallbacks.data()
+                );
+            }
+        );
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            auto* monitoredItemContext = static_cast<ClientContext::MonitoredItem*>(contexts[i]);
+            auto& result = results[offset + i];
+            if (detail::isBadStatus(serviceResult)) {
+                result.statusCode = serviceResult;
+            } else if (i >= response->resultsSize) {
+                result.statusCode = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            } else {
+                const auto& chunkResult = response->results[i];  // NOLINT
+                result.statusCode = chunkResult.statusCode;
+                result.monitoredItemId = chunkResult.monitoredItemId;
+                result.revisedSamplingInterval = chunkResult.revisedSamplingInterval;
+                result.revisedQueueSize = chunkResult.revisedQueueSize;
+            }
+            if (result.statusCode.isBad()) {
+                clientContext.monitoredItemPool.release(monitoredItemContext);
+            } else {
+                clientContext.insertMonitoredItem(
+                    subscriptionId, result.monitoredItemId, monitoredItemContext
+                );
+            }
+        }
+    }
+    return results;
+}
+
+/// Read the monitored value of an event-driven monitored item and report it.
+static void sampleEventDriven(
+    Server& server, uint32_t monitoredItemId, ServerContext::MonitoredItem& monitoredItem
+) noexcept {
+    if (monitoredItem.monitoringMode != MonitoringMode::Reporting) {
+        return;
+    }
+    DataValue value;
+    {
+        const detail::NodeAccessScope scope(NodeAccess::Sample);
+        value = UA_Server_read(
+            server.handle(),
+            monitoredItem.itemToMonitor.handle(),
+            static_cast<UA_TimestampsToReturn>(monitoredItem.timestamps)
+        );
+    }
+    dataChangeNotificationCallback(
+        server.handle(),
+        monitoredItemId,
+        &monitoredItem,
+        monitoredItem.getNodeId().handle(),
+        nullptr,
+        static_cast<uint32_t>(monitoredItem.itemToMonitor.getAttributeId()),
+        value.handle()
+    );
+}
+
+/// Check if the monitored item reports the plain value of the node (shareable sample).
+static bool isValueSample(const ServerContext::MonitoredItem& monitoredItem) noexcept {
+    const UA_ReadValueId& item = *monitoredItem.itemToMonitor.handle();
+    return item.attributeId == UA_ATTRIBUTEID_VALUE && item.indexRange.length == 0;
+}
+
+/// Report the value sample of a node to an event-driven monitored item without a copy.
+static void reportEventDrivenSample(
+    Server& server,
+    uint32_t monitoredItemId,
+    ServerContext::MonitoredItem& monitoredItem,
+    const UA_DataValue& sample,
+    const SharedVariant& payload
+) noexcept {
+    if (monitoredItem.monitoringMode != MonitoringMode::Reporting) {
+        return;
+    }
+    // shallow view of the sample with the timestamps requested by the monitored item
+    UA_DataValue view = sample;
+    view.value = *payload->handle();
+    const auto timestamps = monitoredItem.timestamps;
+    if (timestamps == TimestampsToReturn::Server || timestamps == TimestampsToReturn::Neither) {
+        view.hasSourceTimestamp = false;
+        view.hasSourcePicoseconds = false;
+    }
+    if (timestamps == TimestampsToReturn::Source || timestamps == TimestampsToReturn::Neither) {
+        view.hasServerTimestamp = false;
+        view.hasServerPicoseconds = false;
+    }
+    // shared data change callbacks hand out the payload instead of copying the view
+    auto& context = server.getContext();
+    const SharedVariant* previous = context.sharedSample;
+    context.sharedSample = &payload;
+    dataChangeNotificationCallback(
+        server.handle(),
+        monitoredItemId,
+        &monitoredItem,
+        monitoredItem.getNodeId().handle(),
+        nullptr,
+        UA_ATTRIBUTEID_VALUE,
+        &view
+    );
+    context.sharedSample = previous;
+}
+
+/// Sample the monitored value of an aggregate monitored item and report completed intervals.
+static void sampleAggregate(UA_Server* server, void* data) noexcept {
+    auto* monitoredItem = static_cast<ServerContext::MonitoredItem*>(data);
+    auto& monitoredItems = monitoredItem->serverContext->monitoredItems;
+    const uint32_t monitoredItemId = monitoredItem->monitoredItemId;
+    const UA_DateTime now = UA_DateTime_now();
+    std::vector<DataValue> results;
+    detail::invokeCatchIgnore([&] {
+        monitoredItem->aggregate->advance(now, [&](DataValue&& result) {
+            results.push_back(std::move(result));
+        });
+        if (monitoredItem->monitoringMode != MonitoringMode::Disabled) {
+            const detail::NodeAccessScope scope(NodeAccess::Sample);
+            const DataValue value = UA_Server_read(
+                server, monitoredItem->itemToMonitor.handle(), UA_TIMESTAMPSTORETURN_NEITHER
+            );
+            monitoredItem->aggregate->add(now, *value.handle());
+        }
+    });
+    if (monitoredItem->monitoringMode != MonitoringMode::Reporting) {
+        return;
+    }
+    for (const auto& result : results) {
+        // callbacks might delete the monitored item
+        const auto it = monitoredItems.find(monitoredItemId);
+        if (it == monitoredItems.end() || it->second.get() != monitoredItem) {
+            return;
+        }
+        auto& callback = monitoredItem->dataChangeCallback;
+        if (callback) {
+            if (monitoredItem->health != nullptr) {
+                monitoredItem->health->recordDataChange(*result.handle());
+            }
+            detail::invokeCatchIgnore([&] { callback(0U, monitoredItemId, result); });
+        }
+    }
+}
+
 uint32_t createMonitoredItemDataChange(
     Server& server,
     const ReadValueId& itemToMonitor,
@@ -161,14 +451,40 @@ uint32_t createMonitoredItemDataChange(
     MonitoringParameters& parameters,
     DataChangeNotificationCallback dataChangeCallback
 ) {
+    // open62541 doesn't support aggregates, compute them with a calculator of the wrapper
+    std::optional<AggregateFilter> aggregateFilter;
+    std::unique_ptr<detail::AggregateCalculator> aggregate;
+    if (const auto* filter = parameters.filter.getDecodedData<AggregateFilter>()) {
+        aggregateFilter = *filter;
+        const UA_DateTime startTime = filter->getStartTime().get();
+        aggregate = std::make_unique<detail::AggregateCalculator>(
+            filter->getAggregateType(),
+            filter->getProcessingInterval(),
+            startTime != 0 ? startTime : UA_DateTime_now()
+        );
+    }
+
     UA_MonitoredItemCreateRequest request{};
     request.itemToMonitor = *itemToMonitor.handle();
-    request.monitoringMode = static_cast<UA_MonitoringMode>(monitoringMode);
+    // event-driven and aggregate items are created disabled, they are sampled by the wrapper
+    request.monitoringMode = static_cast<UA_MonitoringMode>(
+        parameters.eventDriven || aggregate ? MonitoringMode::Disabled : monitoringMode
+    );
     copyMonitoringParametersToNative(parameters, request.requestedParameters);
+    if (aggregate) {
+        request.requestedParameters.filter = UA_ExtensionObject{};
+    }
 
     auto monitoredItemContext = std::make_unique<ServerContext::MonitoredItem>();
     monitoredItemContext->itemToMonitor = itemToMonitor;
     monitoredItemContext->dataChangeCallback = std::move(dataChangeCallback);
+    monitoredItemContext->health = &server.getContext().subscriptionHealth;
+    monitoredItemContext->timestamps = parameters.timestamps;
+    monitoredItemContext->monitoringMode = monitoringMode;
+    monitoredItemContext->eventDriven = parameters.eventDriven;
+    if (parameters.eventDriven) {
+        monitoredItemContext->clientFilter = ClientDataChangeFilter{};  // discard unchanged
+    }
 
     using Result = TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
     const Result result = UA_Server_createDataChangeMonitoredItem(
@@ -182,51 +498,137 @@ uint32_t createMonitoredItemDataChange(
     reviseMonitoringParameters(parameters, result);
 
     const auto monitoredItemId = result->monitoredItemId;
-    server.getContext().monitoredItems.insert_or_assign(
-        monitoredItemId, std::move(monitoredItemContext)
-    );
+    auto& context = server.getContext();
+    auto* monitoredItem = monitoredItemContext.get();
+    monitoredItem->monitoredItemId = monitoredItemId;
+    monitoredItem->serverContext = &context;
+    if (aggregate) {
+        const double processingInterval = aggregateFilter->getProcessingInterval();
+        const double samplingInterval =
+            parameters.samplingInterval > 0.0 ? parameters.samplingInterval : 100.0;
+        const auto status = UA_Server_addRepeatedCallback(
+            server.handle(),
+            sampleAggregate,
+            monitoredItem,
+            std::min(samplingInterval, processingInterval),
+            &monitoredItem->aggregateCallbackId
+        );
+        if (detail::isBadStatus(status)) {
+            UA_Server_deleteMonitoredItem(server.handle(), monitoredItemId);
+            detail::throwOnBadStatus(status);
+        }
+        UA_AggregateFilterResult filterResult{};
+        filterResult.revisedStartTime = aggregate->getIntervalStart();
+        filterResult.revisedProcessingInterval = processingInterval;
+        filterResult.revisedAggregateConfiguration = aggregateFilter->getAggregateConfiguration();
+        parameters.filter = ExtensionObject::fromDecodedCopy(
+            &filterResult, UA_TYPES[UA_TYPES_AGGREGATEFILTERRESULT]
+        );
+        monitoredItem->aggregate = std::move(aggregate);
+    }
+    context.monitoredItems.insert_or_assign(monitoredItemId, std::move(monitoredItemContext));
+    if (monitoredItem->eventDriven) {
+        context.eventDrivenMonitoredItems[monitoredItem->getNodeId()].push_back(monitoredItemId);
+        sampleEventDriven(server, monitoredItemId, *monitoredItem);  // initial value
+    }
     return monitoredItemId;
 }
 
-uint32_t createMonitoredItemEvent(
+static uint32_t createMonitoredItemEventImpl(
     Client& client,
     uint32_t subscriptionId,
     const ReadValueId& itemToMonitor,
     MonitoringMode monitoringMode,
     MonitoringParameters& parameters,
+    const SharedEventFilter* filter,
     EventNotificationCallback eventCallback,
     DeleteMonitoredItemCallback deleteCallback
 ) {
+    if (filter != nullptr) {
+        parameters.filter = filter->toExtensionObject();
+    }
     UA_MonitoredItemCreateRequest request{};
     request.itemToMonitor = *itemToMonitor.handle();
     request.monitoringMode = static_cast<UA_MonitoringMode>(monitoringMode);
     copyMonitoringParametersToNative(parameters, request.requestedParameters);
 
-    auto monitoredItemContext = std::make_unique<ClientContext::MonitoredItem>();
-    monitoredItemContext->itemToMonitor = itemToMonitor;
+    auto& clientContext = client.getContext();
+    auto* monitoredItemContext = clientContext.monitoredItemPool.acquire();
+    monitoredItemContext->setItemToMonitor(itemToMonitor, clientContext.nodeIdPool.get());
     monitoredItemContext->eventCallback = std::move(eventCallback);
     monitoredItemContext->deleteCallback = std::move(deleteCallback);
+    monitoredItemContext->monitoringMode = monitoringMode;
+    if (filter != nullptr) {
+        monitoredItemContext->eventFilter = *filter;
+    }
+    storeParameters(*monitoredItemContext, parameters);
 
     using Result = TypeWrapper<UA_MonitoredItemCreateResult, UA_TYPES_MONITOREDITEMCREATERESULT>;
-    const Result result = UA_Client_MonitoredItems_createEvent(
-        client.handle(),
-        subscriptionId,
-        static_cast<UA_TimestampsToReturn>(parameters.timestamps),
-        request,
-        monitoredItemContext.get(),
-        eventNotificationCallback,
-        deleteMonitoredItemCallback
-    );
-    detail::throwOnBadStatus(result->statusCode);
+    const Result result = detail::invokeService(client, StatisticsService::MonitoredItem, [&] {
+        return UA_Client_MonitoredItems_createEvent(
+            client.handle(),
+            subscriptionId,
+            static_cast<UA_TimestampsToReturn>(parameters.timestamps),
+            request,
+            monitoredItemContext,
+            eventNotificationCallback,
+            deleteMonitoredItemCallback
+        );
+    });
+    if (detail::isBadStatus(result->statusCode)) {
+        clientContext.monitoredItemPool.release(monitoredItemContext);
+        detail::throwOnBadStatus(result->statusCode);
+    }
     reviseMonitoringParameters(parameters, result);
 
     const auto monitoredItemId = result->monitoredItemId;
-    client.getContext().monitoredItems.insert_or_assign(
-        {subscriptionId, monitoredItemId}, std::move(monitoredItemContext)
-    );
+    clientContext.insertMonitoredItem(subscriptionId, monitoredItemId, monitoredItemContext);
     return monitoredItemId;
 }
 
+uint32_t createMonitoredItemEvent(
+    Client& client,
+    uint32_t subscriptionId,
+    const ReadValueId& itemToMonitor,
+    MonitoringMode monitoringMode,
+    MonitoringParameters& parameters,
+    EventNotificationCallback eventCallback,
+    DeleteMonitoredItemCallback deleteCallback
+) {
+    return createMonitoredItemEventImpl(
+        client,
+        subscriptionId,
+        itemToMonitor,
+        monitoringMode,
+        parameters,
+        nullptr,
+        std::move(eventCallback),
+        std::move(deleteCallback)
+    );
+}
+
+uint32_t createMonitoredItemEvent(
+    Client& client,
+    uint32_t subscriptionId,
+    const ReadValueId& itemToMonitor,
+    MonitoringMode monitoringMode,
+    MonitoringParameters& parameters,
+    const SharedEventFilter& filter,
+    EventNotificationCallback eventCallback,
+    DeleteMonitoredItemCallback deleteCallback
+) {
+    return createMonitoredItemEventImpl(
+        client,
+        subscriptionId,
+        itemToMonitor,
+        monitoringMode,
+        parameters,
+        &filter,
+        std::move(eventCallback),
+        std::move(deleteCallback)
+    );
+}
+
 void modifyMonitoredItem(
     Client& client,
     uint32_t subscriptionId,
@@ -245,16 +647,51 @@ void modifyMonitoredItem(
 
     using Response =
         TypeWrapper<UA_ModifyMonitoredItemsResponse, UA_TYPES_MODIFYMONITOREDITEMSRESPONSE>;
-    const Response response = UA_Client_MonitoredItems_modify(client.handle(), request);
+    const Response response = detail::invokeService(client, StatisticsService::MonitoredItem, [&] {
+        return UA_Client_MonitoredItems_modify(client.handle(), request);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     if (response->resultsSize != 1) {
         throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
     }
     auto* result = response->results;
     detail::throwOnBadStatus(result->statusCode);
+    auto* monitoredItem = client.getContext().findMonitoredItem(subscriptionId, monitoredItemId);
+    if (monitoredItem != nullptr) {
+        storeParameters(*monitoredItem, parameters);  // requested parameters
+    }
     reviseMonitoringParameters(parameters, result);
 }
 
+void setClientDataChangeFilter(
+    Client& client,
+    uint32_t subscriptionId,
+    uint32_t monitoredItemId,
+    std::optional<ClientDataChangeFilter> filter
+) {
+    auto* monitoredItem = client.getContext().findMonitoredItem(subscriptionId, monitoredItemId);
+    if (monitoredItem == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    monitoredItem->clientFilter = filter;
+    monitoredItem->lastReported = {};
+}
+
+void setClientDataChangeFilter(
+    Server& server, uint32_t monitoredItemId, std::optional<ClientDataChangeFilter> filter
+) {
+    auto& monitoredItems = server.getContext().monitoredItems;
+    const auto it = monitoredItems.find(monitoredItemId);
+    if (it == monitoredItems.end()) {
+        throw BadStatus(UA_STATUSCODE_BADMONITOREDITEMIDINVALID);
+    }
+    it->second->clientFilter = filter;
+    if (!filter.has_value() && it->second->eventDriven) {
+        it->second->clientFilter = ClientDataChangeFilter{};  // discard unchanged
+    }
+    it->second->lastReported = {};
+}
+
 void setMonitoringMode(
     Client& client, uint32_t subscriptionId, uint32_t monitoredItemId, MonitoringMode monitoringMode
 ) {
@@ -265,12 +702,62 @@ void setMonitoringMode(
     request.monitoredItemIds = &monitoredItemId;
 
     using Response = TypeWrapper<UA_SetMonitoringModeResponse, UA_TYPES_SETMONITORINGMODERESPONSE>;
-    const Response response = UA_Client_MonitoredItems_setMonitoringMode(client.handle(), request);
+    const Response response = detail::invokeService(client, StatisticsService::MonitoredItem, [&] {
+        return UA_Client_MonitoredItems_setMonitoringMode(client.handle(), request);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     if (response->resultsSize != 1) {
         throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
     }
     detail::throwOnBadStatus(*response->results);
+    auto* monitoredItem = client.getContext().findMonitoredItem(subscriptionId, monitoredItemId);
+    if (monitoredItem != nullptr) {
+        monitoredItem->monitoringMode = monitoringMode;
+    }
+}
+
+std::vector<StatusCode> setMonitoringMode(
+    Client& client,
+    uint32_t subscriptionId,
+    Span<const uint32_t> monitoredItemIds,
+    MonitoringMode monitoringMode
+) {
+    std::vector<StatusCode> results(monitoredItemIds.size());
+    const size_t chunkSize = detail::getChunkSize(
+        detail::getOperationLimits(client).maxMonitoredItemsPerCall, monitoredItemIds.size()
+    );
+    for (size_t offset = 0; offset < monitoredItemIds.size(); offset += chunkSize) {
+        const auto chunk = monitoredItemIds.subview(offset, chunkSize);
+        UA_SetMonitoringModeRequest request{};
+        request.subscriptionId = subscriptionId;
+        request.monitoringMode = static_cast<UA_MonitoringMode>(monitoringMode);
+        request.monitoredItemIdsSize = chunk.size();
+        request.monitoredItemIds = const_cast<uint32_t*>(chunk.data());  // NOLINT
+
+        using Response =
+            TypeWrapper<UA_SetMonitoringModeResponse, UA_TYPES_SETMONITORINGMODERESPONSE>;
+        const Response response = detail::invokeService(
+            client, StatisticsService::MonitoredItem, [&] {
+                return UA_Client_MonitoredItems_setMonitoringMode(client.handle(), request);
+            }
+        );
+        const StatusCode serviceResult = response->responseHeader.serviceResult;
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            auto& result = results[offset + i];
+            if (serviceResult.isBad()) {
+                result = serviceResult;
+            } else if (i < response->resultsSize) {
+                result = response->results[i];  // NOLINT
+            } else {
+                result = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            }
+            auto* monitoredItem = client.getContext().findMonitoredItem(subscriptionId, chunk[i]);
+            if (monitoredItem != nullptr && result.isGood()) {
+                monitoredItem->monitoringMode = monitoringMode;
+            }
+        }
+    }
+    return results;
 }
 
 void setTriggering(
@@ -289,7 +776,9 @@ void setTriggering(
     request.linksToRemove = const_cast<uint32_t*>(linksToRemove.data());  // NOLINT
 
     using Response = TypeWrapper<UA_SetTriggeringResponse, UA_TYPES_SETTRIGGERINGRESPONSE>;
-    const Response response = UA_Client_MonitoredItems_setTriggering(client.handle(), request);
+    const Response response = detail::invokeService(client, StatisticsService::MonitoredItem, [&] {
+        return UA_Client_MonitoredItems_setTriggering(client.handle(), request);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     for (auto&& status : Span(response->addResults, response->addResultsSize)) {
         detail::throwOnBadStatus(status);
@@ -300,18 +789,488 @@ void setTriggering(
 }
 
 void deleteMonitoredItem(Client& client, uint32_t subscriptionId, uint32_t monitoredItemId) {
-    const auto status = UA_Client_MonitoredItems_deleteSingle(
-        client.handle(), subscriptionId, monitoredItemId
-    );
+    const auto status = detail::invokeService(client, StatisticsService::MonitoredItem, [&] {
+        return UA_Client_MonitoredItems_deleteSingle(
+            client.handle(), subscriptionId, monitoredItemId
+        );
+    });
     detail::throwOnBadStatus(status);
 }
 
 void deleteMonitoredItem(Server& server, uint32_t monitoredItemId) {
     const auto status = UA_Server_deleteMonitoredItem(server.handle(), monitoredItemId);
     detail::throwOnBadStatus(status);
-    server.getContext().monitoredItems.erase(monitoredItemId);
+    auto& context = server.getContext();
+    const auto it = context.monitoredItems.find(monitoredItemId);
+    if (it == context.monitoredItems.end()) {
+        return;
+    }
+    if (it->second->aggregateCallbackId != 0) {
+        UA_Server_removeRepeatedCallback(server.handle(), it->second->aggregateCallbackId);
+    }
+    if (it->second->eventDriven) {
+        const auto itIds = context.eventDrivenMonitoredItems.find(it->second->getNodeId());
+        if (itIds != context.eventDrivenMonitoredItems.end()) {
+            auto& ids = itIds->second;
+            ids.erase(std::remove(ids.begin(), ids.end(), monitoredItemId), ids.end());
+            if (ids.empty()) {
+                context.eventDrivenMonitoredItems.erase(itIds);
+            }
+        }
+    }
+    context.monitoredItems.erase(it);
 }
 
 }  // namespace opcua::services
 
+namespace opcua::detail {
+
+namespace {
+
+using MonitoredItemContext = ClientContext::MonitoredItem;
+
+/// Monitored item detached from its subscription during the recreation.
+struct DetachedMonitoredItem {
+    uint32_t monId;
+    MonitoredItemContext* context;
+    services::DeleteMonitoredItemCallback deleteCallback;
+};
+
+/// Recreate a chunk of monitored items with the same kind (data change/event) and timestamps.
+void recreateMonitoredItems(
+    Client& client,
+    uint32_t subId,
+    bool event,
+    TimestampsToReturn timestamps,
+    Span<DetachedMonitoredItem> items,
+    std::vector<DetachedMonitoredItem>& failed,
+    std::vector<std::pair<uint32_t, uint32_t>>& monIds
+) {
+    std::vector<UA_MonitoredItemCreateRequest> requests(items.size());
+    std::vector<void*> contexts(items.size());
+    std::vector<UA_Client_DataChangeNotificationCallback> dataChangeCallbacks(
+        items.size(), services::dataChangeNotificationCallback
+    );
+    std::vector<UA_Client_EventNotificationCallback> eventCallbacks(
+        items.size(), services::eventNotificationCallback
+    );
+    std::vector<UA_Client_DeleteMonitoredItemCallback> deleteCallbacks(
+        items.size(), services::deleteMonitoredItemCallback
+    );
+    for (size_t i = 0; i < items.size(); ++i) {
+        auto& context = *items[i].context;
+        requests[i].itemToMonitor = *context.itemToMonitor.handle();  // shallow copy
+        requests[i].itemToMonitor.nodeId = *context.getNodeId().handle();  // shallow copy
+        requests[i].monitoringMode = static_cast<UA_MonitoringMode>(context.monitoringMode);
+        services::copyMonitoringParametersToNative(
+            context.parameters, requests[i].requestedParameters
+        );
+        context.lastReported = {};
+        contexts[i] = &context;
+    }
+
+    UA_CreateMonitoredItemsRequest request{};
+    request.subscriptionId = subId;
+    request.timestampsToReturn = static_cast<UA_TimestampsToReturn>(timestamps);
+    request.itemsToCreateSize = requests.size();
+    request.itemsToCreate = requests.data();
+
+    using Response =
+        TypeWrapper<UA_CreateMonitoredItemsResponse, UA_TYPES_CREATEMONITOREDITEMSRESPONSE>;
+    const Response response = invokeService(client, StatisticsService::MonitoredItem, [&] {
+        if (event) {
+            return UA_Client_MonitoredItems_createEvents(
+                client.handle(),
+                request,
+                contexts.data(),
+                eventCallbacks.data(),
+                deleteCallbacks.data()
+            );
+        }
+        return UA_Client_MonitoredItems_createDataChanges(
+            client.handle(),
+            request,
+            contexts.data(),
+            dataChangeCallbacks.data(),
+            deleteCallbacks.data()
+        );
+    });
+    auto& clientContext = client.getContext();
+    for (size_t i = 0; i < items.size(); ++i) {
+        const bool good = isGoodStatus(response->responseHeader.serviceResult) &&
+                          i < response->resultsSize &&
+                          isGoodStatus(response->results[i].statusCode);  // NOLINT
+        if (!good) {
+            failed.push_back(std::move(items[i]));
+            continue;
+        }
+        const uint32_t monId = response->results[i].monitoredItemId;  // NOLINT
+        items[i].context->deleteCallback = std::move(items[i].deleteCallback);
+        clientContext.insertMonitoredItem(subId, monId, items[i].context);
+        monIds.emplace_back(items[i].monId, monId);
+    }
+}
+
+/// Recreate a subscription that couldn't be transferred, reusing the subscription context.
+void recreateSubscription(Client& client, uint32_t oldSubId) {
+    auto& clientContext = client.getContext();
+    const auto it = clientContext.subscriptions.find(oldSubId);
+    if (it == clientContext.subscriptions.end()) {
+        return;
+    }
+    // detach the contexts, the native delete callbacks must neither invoke the user callbacks nor
+    // release the contexts
+    std::unique_ptr<ClientContext::Subscription> sub = std::move(it->second);
+    clientContext.subscriptions.erase(it);
+    auto deleteCallback = std::move(sub->deleteCallback);
+    sub->deleteCallback = nullptr;
+    std::vector<DetachedMonitoredItem> items;
+    items.reserve(sub->monitoredItems.size());
+    for (auto& [monId, context] : sub->monitoredItems) {
+        items.push_back({monId, context, std::move(context->deleteCallback)});
+        context->deleteCallback = nullptr;
+    }
+    sub->monitoredItems.clear();
+    sub->pendingDataChanges.clear();
+
+    // remove the stale subscription from the native client (and from the server, if it exists)
+    UA_Client_Subscriptions_deleteSingle(client.handle(), oldSubId);
+
+    const auto& parameters = sub->parameters;
+    UA_CreateSubscriptionRequest request{};
+    request.requestedPublishingInterval = parameters.publishingInterval;
+    request.requestedLifetimeCount = parameters.lifetimeCount;
+    request.requestedMaxKeepAliveCount = parameters.maxKeepAliveCount;
+    request.maxNotificationsPerPublish = parameters.maxNotificationsPerPublish;
+    request.publishingEnabled = sub->publishingEnabled;
+    request.priority = parameters.priority;
+
+    using Response =
+        TypeWrapper<UA_CreateSubscriptionResponse, UA_TYPES_CREATESUBSCRIPTIONRESPONSE>;
+    const Response response = invokeService(client, StatisticsService::Subscription, [&] {
+        return UA_Client_Subscriptions_create(
+            client.handle(),
+            request,
+            sub.get(),
+            nullptr,  // statusChangeCallback
+            deleteSubscriptionCallback
+        );
+    });
+
+    std::vector<DetachedMonitoredItem> failed;
+    std::vector<std::pair<uint32_t, uint32_t>> monIds;
+    if (isBadStatus(response->responseHeader.serviceResult)) {
+        failed = std::move(items);
+    } else {
+        const uint32_t newSubId = response->subscriptionId;
+        sub->parameters.publishingInterval = response->revisedPublishingInterval;
+        sub->parameters.lifetimeCount = response->revisedLifetimeCount;
+        sub->parameters.maxKeepAliveCount = response->revisedMaxKeepAliveCount;
+        sub->deleteCallback = std::move(deleteCallback);
+        clientContext.subscriptions.insert_or_assign(newSubId, std::move(sub));
+
+        // group by kind and timestamps (per request), chunk by the operation limit
+        std::stable_sort(items.begin(), items.end(), [](const auto& lhs, const auto& rhs) {
+            const auto key = [](const DetachedMonitoredItem& item) {
+                return std::pair(
+                    static_cast<bool>(item.context->eventCallback),
+                    item.context->parameters.timestamps
+                );
+            };
+            return key(lhs) < key(rhs);
+        });
+        const size_t chunkSize = getChunkSize(
+            getOperationLimits(client).maxMonitoredItemsPerCall, items.size()
+        );
+        size_t first = 0;
+        while (first < items.size()) {
+            const bool event = static_cast<bool>(items[first].context->eventCallback);
+            const auto timestamps = items[first].context->parameters.timestamps;
+            size_t last = first + 1;
+            while (last < items.size() && last - first < chunkSize &&
+                   static_cast<bool>(items[last].context->eventCallback) == event &&
+                   items[last].context->parameters.timestamps == timestamps) {
+                ++last;
+            }
+            recreateMonitoredItems(
+                client,
+                newSubId,
+                event,
+                timestamps,
+                Span(items.data() + first, last - first),  // NOLINT
+                failed,
+                monIds
+            );
+            first = last;
+        }
+
+        auto& callback = clientContext.subscriptionRecreatedCallback;
+        if (callback) {
+            invokeCatchIgnore([&] { callback(oldSubId, newSubId, monIds); });
+        }
+    }
+
+    // monitored items that couldn't be recreated are deleted
+    for (auto& item : failed) {
+        if (item.deleteCallback) {
+            invokeCatchIgnore([&] { item.deleteCallback(oldSubId, item.monId); });
+        }
+        clientContext.monitoredItemPool.release(item.context);
+    }
+    if (sub != nullptr && deleteCallback) {
+        invokeCatchIgnore([&] { deleteCallback(oldSubId); });
+    }
+}
+
+void invokeNotificationGapCallback(
+    Client& client, uint32_t subId, Span<const uint32_t> missingSequenceNumbers
+) {
+    auto& callback = client.getContext().notificationGapCallback;
+    if (callback) {
+        invokeCatchIgnore([&] { callback(subId, missingSequenceNumbers); });
+    }
+}
+
+/// Map the client handles of the monitored items to their ids (standard GetMonitoredItems method).
+std::unordered_map<uint32_t, uint32_t> getMonitoredItemIdsByClientHandle(
+    [[maybe_unused]] Client& client, [[maybe_unused]] uint32_t subId
+) {
+#ifdef UA_ENABLE_METHODCALLS
+    const auto outputs = services::call(
+        client,
+        ObjectId::Server,
+        MethodId::Server_GetMonitoredItems,
+        {Variant::fromScalar(subId)}
+    );
+    if (outputs.size() != 2) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+    const auto serverHandles = outputs[0].getArrayCopy<uint32_t>();
+    const auto clientHandles = outputs[1].getArrayCopy<uint32_t>();
+    std::unordered_map<uint32_t, uint32_t> monIds;
+    for (size_t i = 0; i < std::min(serverHandles.size(), clientHandles.size()); ++i) {
+        monIds.emplace(clientHandles[i], serverHandles[i]);
+    }
+    return monIds;
+#else
+    throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+#endif
+}
+
+/// Deliver the notifications of a republished message through the native callbacks.
+void dispatchNotificationMessage(
+    Client& client,
+    uint32_t subId,
+    UA_NotificationMessage& message,
+    const std::unordered_map<uint32_t, uint32_t>& monIds
+) {
+    auto& clientContext = client.getContext();
+    for (size_t i = 0; i < message.notificationDataSize; ++i) {
+        auto& data = message.notificationData[i];  // NOLINT
+        if (data.encoding != UA_EXTENSIONOBJECT_DECODED) {
+            continue;
+        }
+        if (data.content.decoded.type == &UA_TYPES[UA_TYPES_DATACHANGENOTIFICATION]) {
+            auto* notification =
+                static_cast<UA_DataChangeNotification*>(data.content.decoded.data);
+            for (size_t j = 0; j < notification->monitoredItemsSize; ++j) {
+                auto& item = notification->monitoredItems[j];  // NOLINT
+                const auto monId = monIds.find(item.clientHandle);
+                if (monId == monIds.end()) {
+                    continue;
+                }
+                // items are looked up for every notification, callbacks might delete them
+                auto* context = clientContext.findMonitoredItem(subId, monId->second);
+                if (context == nullptr) {
+                    continue;
+                }
+                // skip notifications that were already delivered before the connection loss
+                const auto timestamp = services::getTimestamp(item.value);
+                if (timestamp != 0 && timestamp <= context->lastTimestamp) {
+                    continue;
+                }
+                services::dataChangeNotificationCallback(
+                    client.handle(),
+                    subId,
+                    clientContext.subscriptions.at(subId).get(),
+                    monId->second,
+                    context,
+                    &item.value
+                );
+            }
+        } else if (data.content.decoded.type == &UA_TYPES[UA_TYPES_EVENTNOTIFICATIONLIST]) {
+            auto* notification = static_cast<UA_EventNotificationList*>(data.content.decoded.data);
+            for (size_t j = 0; j < notification->eventsSize; ++j) {
+                auto& event = notification->events[j];  // NOLINT
+                const auto monId = monIds.find(event.clientHandle);
+                if (monId == monIds.end()) {
+                    continue;
+                }
+                auto* context = clientContext.findMonitoredItem(subId, monId->second);
+                if (context == nullptr) {
+                    continue;
+                }
+                services::eventNotificationCallback(
+                    client.handle(),
+                    subId,
+                    clientContext.subscriptions.at(subId).get(),
+                    monId->second,
+                    context,
+                    event.eventFieldsSize,
+                    event.eventFields
+                );
+            }
+        }
+    }
+}
+
+/**
+ * Republish the notification messages retained by the server for a transferred subscription.
+ * Runs before the first Publish request of the new session, so the recovered notifications are
+ * delivered in order before any new notification.
+ */
+void republishNotifications(Client& client, uint32_t subId, Span<const uint32_t> sequenceNumbers) {
+    if (sequenceNumbers.empty()) {
+        return;
+    }
+    std::vector<uint32_t> sorted(sequenceNumbers.begin(), sequenceNumbers.end());
+    std::sort(sorted.begin(), sorted.end());  // wrap around (after 2^32 messages) is ignored
+    std::vector<uint32_t> missing;
+    std::unordered_map<uint32_t, uint32_t> monIds;
+    try {
+        monIds = getMonitoredItemIdsByClientHandle(client, subId);
+    } catch (...) {
+        invokeNotificationGapCallback(client, subId, sorted);
+        return;
+    }
+    for (const auto sequenceNumber : sorted) {
+        if (client.getContext().subscriptions.count(subId) == 0) {
+            return;  // deleted within a callback
+        }
+        UA_RepublishRequest request{};
+        request.subscriptionId = subId;
+        request.retransmitSequenceNumber = sequenceNumber;
+        using Response = TypeWrapper<UA_RepublishResponse, UA_TYPES_REPUBLISHRESPONSE>;
+        Response response;
+        invokeService(client, StatisticsService::Subscription, [&] {
+            __UA_Client_Service(
+                client.handle(),
+                &request,
+                &UA_TYPES[UA_TYPES_REPUBLISHREQUEST],
+                response.handle(),
+                &UA_TYPES[UA_TYPES_REPUBLISHRESPONSE]
+            );
+            return response->responseHeader.serviceResult;
+        });
+        if (isBadStatus(response->responseHeader.serviceResult)) {
+            missing.push_back(sequenceNumber);
+            continue;
+        }
+        dispatchNotificationMessage(client, subId, response->notificationMessage, monIds);
+    }
+    client.getContext().dispatchDataChangeBatches();
+    if (!missing.empty()) {
+        invokeNotificationGapCallback(client, subId, missing);
+    }
+}
+
+}  // namespace
+
+void recoverSubscriptions(Client& client) noexcept {
+    auto& clientContext = client.getContext();
+    if (clientContext.subscriptions.empty()) {
+        return;
+    }
+    std::vector<uint32_t> subIds;
+    subIds.reserve(clientContext.subscriptions.size());
+    for (const auto& [subId, _] : clientContext.subscriptions) {
+        subIds.push_back(subId);
+    }
+
+    UA_TransferSubscriptionsRequest request{};
+    request.subscriptionIdsSize = subIds.size();
+    request.subscriptionIds = subIds.data();
+    request.sendInitialValues = true;
+
+    using Response =
+        TypeWrapper<UA_TransferSubscriptionsResponse, UA_TYPES_TRANSFERSUBSCRIPTIONSRESPONSE>;
+    Response response;
+    invokeService(client, StatisticsService::Subscription, [&] {
+        __UA_Client_Service(
+            client.handle(),
+            &request,
+            &UA_TYPES[UA_TYPES_TRANSFERSUBSCRIPTIONSREQUEST],
+            response.handle(),
+            &UA_TYPES[UA_TYPES_TRANSFERSUBSCRIPTIONSRESPONSE]
+        );
+        return response->responseHeader.serviceResult;
+    });
+
+    for (size_t i = 0; i < subIds.size(); ++i) {
+        const bool transferred = isGoodStatus(response->responseHeader.serviceResult) &&
+                                 i < response->resultsSize &&
+                                 isGoodStatus(response->results[i].statusCode);  // NOLINT
+        if (!transferred) {
+            invokeCatchIgnore([&] { recreateSubscription(client, subIds[i]); });
+            invokeNotificationGapCallback(client, subIds[i], {});
+            continue;
+        }
+        const auto& result = response->results[i];  // NOLINT
+        invokeCatchIgnore([&] {
+            republishNotifications(
+                client,
+                subIds[i],
+                {result.availableSequenceNumbers, result.availableSequenceNumbersSize}
+            );
+        });
+        const auto sub = clientContext.subscriptions.find(subIds[i]);
+        if (sub != clientContext.subscriptions.end()) {
+            for (auto& [monId, monitoredItem] : sub->second->monitoredItems) {
+                monitoredItem->transferred = true;
+            }
+        }
+    }
+}
+
+void sampleEventDrivenMonitoredItems(Server& server, const NodeId& id) noexcept {
+    auto& context = server.getContext();
+    if (context.eventDrivenMonitoredItems.empty()) {
+        return;
+    }
+    const auto it = context.eventDrivenMonitoredItems.find(id);
+    if (it == context.eventDrivenMonitoredItems.end()) {
+        return;
+    }
+    // read the value once for all monitored items of the node, reported without copies
+    DataValue sample;
+    std::optional<SharedVariant> payload;
+    // callbacks might create or delete monitored items of the node, iterate over a copy of the
+    // ids and look up each item by id
+    const std::vector<uint32_t> ids = it->second;
+    for (const uint32_t monId : ids) {
+        const auto itItem = context.monitoredItems.find(monId);
+        if (itItem != context.monitoredItems.end()) {
+            auto& monitoredItem = *itItem->second;
+            if (services::isValueSample(monitoredItem)) {
+                if (!payload.has_value()) {
+                    const NodeAccessScope scope(NodeAccess::Sample);
+                    sample = UA_Server_read(
+                        server.handle(),
+                        monitoredItem.itemToMonitor.handle(),
+                        UA_TIMESTAMPSTORETURN_BOTH
+                    );
+                    payload.emplace(std::move(sample.getValue()));
+                }
+                services::reportEventDrivenSample(
+                    server, monId, monitoredItem, *sample.handle(), *payload
+                );
+            } else {
+                services::sampleEventDriven(server, monId, monitoredItem);
+            }
+        }
+    }
+}
+
+}  // namespace opcua::detail
+
 #endif
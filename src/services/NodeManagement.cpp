@@ -1,41 +1,63 @@
 #include "open62541pp/services/NodeManagement.h"
 
+#include <algorithm>  // fill, min, reverse
 #include <cassert>
+#include <memory>
 #include <utility>  // move
+#include <vector>
 
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/Statistics.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/detail/helper.h"
+#include "open62541pp/services/View.h"  // browseRecursive
 #include "open62541pp/types/Variant.h"
 
+#include "../AsyncMethodDispatcher.h"
 #include "../ServerContext.h"
 #include "../open62541_impl.h"
+#include "OperationLimits.h"
+#include "ServiceStatistics.h"
 
 namespace opcua::services {
 
 AddNodesResponse addNodes(Client& client, const AddNodesRequest& request) {
-    AddNodesResponse response = UA_Client_Service_addNodes(client.handle(), request);
+    AddNodesResponse response = detail::invokeService(
+        client, StatisticsService::NodeManagement, [&] {
+            return UA_Client_Service_addNodes(client.handle(), request);
+        }
+    );
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
 
 AddReferencesResponse addReferences(Client& client, const AddReferencesRequest& request) {
-    AddReferencesResponse response = UA_Client_Service_addReferences(client.handle(), request);
+    AddReferencesResponse response = detail::invokeService(
+        client, StatisticsService::NodeManagement, [&] {
+            return UA_Client_Service_addReferences(client.handle(), request);
+        }
+    );
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
 
 DeleteNodesResponse deleteNodes(Client& client, const DeleteNodesRequest& request) {
-    DeleteNodesResponse response = UA_Client_Service_deleteNodes(client.handle(), request);
+    DeleteNodesResponse response = detail::invokeService(
+        client, StatisticsService::NodeManagement, [&] {
+            return UA_Client_Service_deleteNodes(client.handle(), request);
+        }
+    );
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
 
 DeleteReferencesResponse deleteReferences(Client& client, const DeleteReferencesRequest& request) {
-    DeleteReferencesResponse response = UA_Client_Service_deleteReferences(
-        client.handle(), request
+    DeleteReferencesResponse response = detail::invokeService(
+        client, StatisticsService::NodeManagement, [&] {
+            return UA_Client_Service_deleteReferences(client.handle(), request);
+        }
     );
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
@@ -112,7 +134,7 @@ static UA_StatusCode methodCallback(
     [[maybe_unused]] UA_Server* server,
     [[maybe_unused]] const UA_NodeId* sessionId,
     [[maybe_unused]] void* sessionContext,
-    [[maybe_unused]] const UA_NodeId* methodId,
+    const UA_NodeId* methodId,
     void* methodContext,
     [[maybe_unused]] const UA_NodeId* objectId,
     [[maybe_unused]] void* objectContext,
@@ -125,11 +147,16 @@ static UA_StatusCode methodCallback(
     const auto* nodeContext = static_cast<ServerContext::NodeContext*>(methodContext);
     const auto& callback = nodeContext->methodCallback;
     if (callback) {
-        return detail::invokeCatchStatus([&] {
-            callback(
-                {asWrapper<Variant>(input), inputSize}, {asWrapper<Variant>(output), outputSize}
-            );
-        });
+        return nodeContext->server->invokeNodeCallback(
+            StatisticsCallback::Method,
+            "Method",
+            methodId,
+            [&] {
+                callback(
+                    {asWrapper<Variant>(input), inputSize}, {asWrapper<Variant>(output), outputSize}
+                );
+            }
+        );
     }
     return UA_STATUSCODE_BADINTERNALERROR;
 }
@@ -168,6 +195,72 @@ NodeId addMethod(
     return outputNodeId;
 }
 
+#ifdef UAPP_ASYNC_METHODS
+MethodCompletion::MethodCompletion(
+    std::shared_ptr<AsyncMethodDispatcher> dispatcher, void* context
+) noexcept
+    : dispatcher_(std::move(dispatcher)),
+      context_(context) {}
+
+MethodCompletion::~MethodCompletion() {
+    fail(UA_STATUSCODE_BADINTERNALERROR);
+}
+
+MethodCompletion::MethodCompletion(MethodCompletion&& other) noexcept
+    : dispatcher_(std::move(other.dispatcher_)),
+      context_(other.context_) {}
+
+MethodCompletion& MethodCompletion::operator=(MethodCompletion&& other) noexcept {
+    if (this != &other) {
+        fail(UA_STATUSCODE_BADINTERNALERROR);
+        dispatcher_ = std::move(other.dispatcher_);
+        context_ = other.context_;
+    }
+    return *this;
+}
+
+void MethodCompletion::complete(Span<const Variant> output) {
+    if (auto dispatcher = std::move(dispatcher_)) {
+        dispatcher->setResult(context_, UA_STATUSCODE_GOOD, output);
+    }
+}
+
+void MethodCompletion::fail(StatusCode status) noexcept {
+    if (auto dispatcher = std::move(dispatcher_)) {
+        dispatcher->setResult(context_, status, {});
+    }
+}
+
+NodeId addMethodAsync(
+    Server& server,
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    AsyncMethodCallback callback,
+    Span<const Argument> inputArguments,
+    Span<const Argument> outputArguments,
+    const MethodAttributes& attributes,
+    const NodeId& referenceType
+) {
+    auto& context = server.getContext();
+    getAsyncMethodDispatcher(server.handle(), context);
+    NodeId outputNodeId = addMethod(
+        server,
+        parentId,
+        id,
+        browseName,
+        {},  // callback is invoked by the dispatcher
+        inputArguments,
+        outputArguments,
+        attributes,
+        referenceType
+    );
+    context.getOrCreateNodeContext(outputNodeId)->asyncMethodCallback = std::move(callback);
+    detail::throwOnBadStatus(UA_Server_setMethodNodeAsync(server.handle(), outputNodeId, true));
+    return outputNodeId;
+}
+#endif
+
 template <>
 NodeId addMethod(
     Client& client,
@@ -246,6 +339,7 @@ template <>
 void deleteNode<Server>(Server& server, const NodeId& id, bool deleteReferences) {
     const auto status = UA_Server_deleteNode(server.handle(), id, deleteReferences);
     detail::throwOnBadStatus(status);
+    server.getContext().eraseNodeContexts(Span<const NodeId>(&id, 1));
 }
 
 template <>
@@ -266,6 +360,99 @@ void deleteNode<Client>(Client& client, const NodeId& id, bool deleteReferences)
     detail::throwOnBadStatus(results[0]);
 }
 
+template <>
+std::vector<StatusCode> deleteNodes<Server>(
+    Server& server, Span<const NodeId> ids, bool deleteReferences
+) {
+    std::vector<StatusCode> results;
+    results.reserve(ids.size());
+    std::vector<NodeId> deleted;
+    deleted.reserve(ids.size());
+    for (const auto& id : ids) {
+        const auto status = UA_Server_deleteNode(server.handle(), id, deleteReferences);
+        results.emplace_back(status);
+        if (status == UA_STATUSCODE_GOOD) {
+            deleted.push_back(id);
+        }
+    }
+    server.getContext().eraseNodeContexts(deleted);
+    return results;
+}
+
+template <>
+std::vector<StatusCode> deleteNodes<Client>(
+    Client& client, Span<const NodeId> ids, bool deleteReferences
+) {
+    const auto& limits = detail::getOperationLimits(client);
+    std::vector<StatusCode> results;
+    results.reserve(ids.size());
+    std::vector<UA_DeleteNodesItem> items;
+    const size_t chunkSize = detail::getChunkSize(limits.maxNodesPerNodeManagement, ids.size());
+    for (size_t offset = 0; offset < ids.size(); offset += chunkSize) {
+        const auto chunk = ids.subview(offset, chunkSize);
+        items.assign(chunk.size(), UA_DeleteNodesItem{});
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            items[i].nodeId = *chunk[i].handle();  // shallow copy
+            items[i].deleteTargetReferences = deleteReferences;
+        }
+        UA_DeleteNodesRequest request{};
+        request.nodesToDeleteSize = items.size();
+        request.nodesToDelete = items.data();
+        auto response = deleteNodes(client, asWrapper<DeleteNodesRequest>(request));
+        auto chunkResults = response.getResults();
+        if (chunkResults.size() != chunk.size()) {
+            throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        results.insert(results.end(), chunkResults.begin(), chunkResults.end());
+    }
+    return results;
+}
+
+/// Add a descendant of the subtree root, the nodes of namespace 0 are kept.
+static void addSubtreeNode(
+    std::vector<NodeId>& ids, const NodeId& rootId, const ExpandedNodeId& id
+) {
+    if (id.isLocal() && id.getNodeId().getNamespaceIndex() != 0 && id.getNodeId() != rootId) {
+        ids.push_back(id.getNodeId());
+    }
+}
+
+template <typename T>
+static void deleteSubtreeNodes(T& serverOrClient, std::vector<NodeId>& ids, const NodeId& rootId) {
+    // results of the recursive browse are ordered top-down, delete the leaves first
+    std::reverse(ids.begin(), ids.end());
+    ids.push_back(rootId);
+    const auto results = deleteNodes(serverOrClient, Span<const NodeId>(ids), true);
+    for (const auto& status : results) {
+        // descendants might have been deleted with their parent already
+        if (status != UA_STATUSCODE_BADNODEIDUNKNOWN) {
+            detail::throwOnBadStatus(status);
+        }
+    }
+}
+
+static BrowseDescription getSubtreeBrowseDescription(const NodeId& rootId) {
+    return {rootId, BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences};
+}
+
+template <>
+void deleteSubtree<Server>(Server& server, const NodeId& rootId) {
+    std::vector<NodeId> ids;
+    for (const auto& id : browseRecursive(server, getSubtreeBrowseDescription(rootId))) {
+        addSubtreeNode(ids, rootId, id);
+    }
+    deleteSubtreeNodes(server, ids, rootId);
+}
+
+template <>
+void deleteSubtree<Client>(Client& client, const NodeId& rootId) {
+    std::vector<NodeId> ids;
+    browseRecursive(client, getSubtreeBrowseDescription(rootId), [&](const auto& ref) {
+        addSubtreeNode(ids, rootId, ref.getNodeId());
+    });
+    deleteSubtreeNodes(client, ids, rootId);
+}
+
 template <>
 void deleteReference<Server>(
     Server& server,
@@ -309,4 +496,212 @@ void deleteReference<Client>(
     detail::throwOnBadStatus(results[0]);
 }
 
+/* ------------------------------------------ NodeBatch ----------------------------------------- */
+
+void NodeBatch::reserve(size_t nodeCount, size_t referenceCount) {
+    nodes_.reserve(nodeCount);
+    references_.reserve(referenceCount);
+}
+
+NodeBatch& NodeBatch::addObject(
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    const ObjectAttributes& attributes,
+    const NodeId& objectType,
+    const NodeId& referenceType
+) {
+    nodes_.emplace_back(
+        ExpandedNodeId(parentId),
+        referenceType,
+        ExpandedNodeId(id),
+        QualifiedName(id.getNamespaceIndex(), browseName),
+        NodeClass::Object,
+        ExtensionObject::fromDecodedCopy(attributes),
+        ExpandedNodeId(objectType)
+    );
+    return *this;
+}
+
+NodeBatch& NodeBatch::addFolder(
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    const ObjectAttributes& attributes,
+    const NodeId& referenceType
+) {
+    return addObject(
+        parentId, id, browseName, attributes, ObjectTypeId::FolderType, referenceType
+    );
+}
+
+NodeBatch& NodeBatch::addVariable(
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    const VariableAttributes& attributes,
+    const NodeId& variableType,
+    const NodeId& referenceType
+) {
+    nodes_.emplace_back(
+        ExpandedNodeId(parentId),
+        referenceType,
+        ExpandedNodeId(id),
+        QualifiedName(id.getNamespaceIndex(), browseName),
+        NodeClass::Variable,
+        ExtensionObject::fromDecodedCopy(attributes),
+        ExpandedNodeId(variableType)
+    );
+    return *this;
+}
+
+NodeBatch& NodeBatch::addProperty(
+    const NodeId& parentId,
+    const NodeId& id,
+    std::string_view browseName,
+    const VariableAttributes& attributes
+) {
+    return addVariable(
+        parentId,
+        id,
+        browseName,
+        attributes,
+        VariableTypeId::PropertyType,
+        ReferenceTypeId::HasProperty
+    );
+}
+
+NodeBatch& NodeBatch::addReference(
+    const NodeId& sourceId, const NodeId& targetId, const NodeId& referenceType, bool forward
+) {
+    references_.emplace_back(
+        sourceId, referenceType, forward, "", ExpandedNodeId(targetId), NodeClass::Unspecified
+    );
+    return *this;
+}
+
+NodeBatch& NodeBatch::addNode(AddNodesItem item) {
+    nodes_.push_back(std::move(item));
+    return *this;
+}
+
+NodeBatch& NodeBatch::addReference(AddReferencesItem item) {
+    references_.push_back(std::move(item));
+    return *this;
+}
+
+void NodeBatch::clear() noexcept {
+    nodes_.clear();
+    references_.clear();
+}
+
+bool NodeBatchResult::isGood() const noexcept {
+    const auto isGoodStatus = [](const StatusCode& code) { return code.isGood(); };
+    return std::all_of(nodeStatusCodes.begin(), nodeStatusCodes.end(), isGoodStatus) &&
+           std::all_of(referenceStatusCodes.begin(), referenceStatusCodes.end(), isGoodStatus);
+}
+
+template <>
+NodeBatchResult addNodes<Server>(Server& server, const NodeBatch& batch) {
+    const auto nodes = batch.getNodes();
+    const auto references = batch.getReferences();
+    NodeBatchResult result;
+    result.nodeIds.resize(nodes.size());
+    result.nodeStatusCodes.reserve(nodes.size());
+    result.referenceStatusCodes.reserve(references.size());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+        const UA_AddNodesItem& item = *nodes[i].handle();
+        result.nodeStatusCodes.emplace_back(__UA_Server_addNode(
+            server.handle(),
+            item.nodeClass,
+            &item.requestedNewNodeId.nodeId,
+            &item.parentNodeId.nodeId,
+            &item.referenceTypeId,
+            item.browseName,
+            &item.typeDefinition.nodeId,
+            static_cast<const UA_NodeAttributes*>(item.nodeAttributes.content.decoded.data),
+            item.nodeAttributes.content.decoded.type,
+            nullptr,  // nodeContext
+            result.nodeIds[i].handle()
+        ));
+    }
+    for (const auto& reference : references) {
+        const UA_AddReferencesItem& item = *reference.handle();
+        result.referenceStatusCodes.emplace_back(UA_Server_addReference(
+            server.handle(),
+            item.sourceNodeId,
+            item.referenceTypeId,
+            item.targetNodeId,
+            item.isForward
+        ));
+    }
+    return result;
+}
+
+template <>
+NodeBatchResult addNodes<Client>(Client& client, const NodeBatch& batch) {
+    const auto nodes = batch.getNodes();
+    const auto references = batch.getReferences();
+    const auto& limits = detail::getOperationLimits(client);
+    NodeBatchResult result;
+    result.nodeIds.resize(nodes.size());
+    result.nodeStatusCodes.resize(nodes.size());
+    result.referenceStatusCodes.resize(references.size());
+    // earlier chunks might already be added, report the failed service for the remaining items
+    const auto fillRemaining = [&](size_t nodeOffset, size_t referenceOffset, StatusCode status) {
+        auto& nodeCodes = result.nodeStatusCodes;
+        auto& referenceCodes = result.referenceStatusCodes;
+        std::fill(nodeCodes.begin() + nodeOffset, nodeCodes.end(), status);
+        std::fill(referenceCodes.begin() + referenceOffset, referenceCodes.end(), status);
+    };
+
+    const size_t nodesChunkSize =
+        detail::getChunkSize(limits.maxNodesPerNodeManagement, nodes.size());
+    for (size_t offset = 0; offset < nodes.size(); offset += nodesChunkSize) {
+        const auto chunk = nodes.subview(offset, nodesChunkSize);
+        UA_AddNodesRequest request{};
+        request.nodesToAddSize = chunk.size();
+        request.nodesToAdd = const_cast<UA_AddNodesItem*>(asNative(chunk.data()));  // NOLINT
+        AddNodesResponse response;
+        try {
+            response = addNodes(client, asWrapper<AddNodesRequest>(request));
+        } catch (const BadStatus& e) {
+            fillRemaining(offset, 0, e.code());
+            return result;
+        }
+        auto results = response.getResults();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            if (i >= results.size()) {
+                result.nodeStatusCodes[offset + i] = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                continue;
+            }
+            result.nodeStatusCodes[offset + i] = results[i]->statusCode;
+            result.nodeIds[offset + i].swap(results[i]->addedNodeId);
+        }
+    }
+
+    const size_t referencesChunkSize =
+        detail::getChunkSize(limits.maxNodesPerNodeManagement, references.size());
+    for (size_t offset = 0; offset < references.size(); offset += referencesChunkSize) {
+        const auto chunk = references.subview(offset, referencesChunkSize);
+        UA_AddReferencesRequest request{};
+        request.referencesToAddSize = chunk.size();
+        request.referencesToAdd =
+            const_cast<UA_AddReferencesItem*>(asNative(chunk.data()));  // NOLINT
+        AddReferencesResponse response;
+        try {
+            response = addReferences(client, asWrapper<AddReferencesRequest>(request));
+        } catch (const BadStatus& e) {
+            fillRemaining(nodes.size(), offset, e.code());
+            return result;
+        }
+        const auto results = response.getResults();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            result.referenceStatusCodes[offset + i] =
+                i < results.size() ? results[i] : StatusCode(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+    }
+    return result;
+}
+
 }  // namespace opcua::services
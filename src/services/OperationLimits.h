@@ -0,0 +1,120 @@
+#pragma once
+
+#include <algorithm>  // max, min
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "../ClientContext.h"
+#include "../open62541_impl.h"
+#include "ServiceStatistics.h"
+
+namespace opcua::detail {
+
+inline uint32_t readOperationLimit(const DataValue& dv) noexcept {
+    if (dv.hasStatusCode() && isBadStatus(dv->status)) {
+        return 0;
+    }
+    if (!dv.getValue().isScalar() || !dv.getValue().isType(Type::UInt32)) {
+        return 0;
+    }
+    return dv.getValue().getScalar<uint32_t>();
+}
+
+/// Get the operation limits of the connected server.
+/// The limits are read once per session with a single request, unknown limits are set to `0`.
+inline const ClientContext::OperationLimits& getOperationLimits(Client& client) {
+    auto& context = client.getContext();
+    const std::lock_guard lock(context.mutex);
+    auto& limits = context.operationLimits;
+    if (!limits.fetched) {
+        limits.fetched = true;
+        const std::array<NodeId, 8> ids{
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxMonitoredItemsPerCall,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerNodeManagement,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerBrowse,
+            VariableId::
+                Server_ServerCapabilities_OperationLimits_MaxNodesPerTranslateBrowsePathsToNodeIds,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerMethodCall,
+            VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerHistoryReadData,
+        };
+        std::array<UA_ReadValueId, 8> items{};
+        for (size_t i = 0; i < ids.size(); ++i) {
+            items[i].nodeId = *ids[i].handle();  // shallow copy
+            items[i].attributeId = UA_ATTRIBUTEID_VALUE;
+        }
+        UA_ReadRequest request{};
+        request.nodesToReadSize = items.size();
+        request.nodesToRead = items.data();
+        ReadResponse response = detail::invokeService(client, StatisticsService::Read, [&] {
+            return UA_Client_Service_read(client.handle(), request);
+        });
+        const auto results = response.getResults();
+        if (response->responseHeader.serviceResult == UA_STATUSCODE_GOOD &&
+            results.size() == items.size()) {
+            limits.maxNodesPerRead = readOperationLimit(results[0]);
+            limits.maxNodesPerWrite = readOperationLimit(results[1]);
+            limits.maxMonitoredItemsPerCall = readOperationLimit(results[2]);
+            limits.maxNodesPerNodeManagement = readOperationLimit(results[3]);
+            limits.maxNodesPerBrowse = readOperationLimit(results[4]);
+            limits.maxNodesPerTranslateBrowsePaths = readOperationLimit(results[5]);
+            limits.maxNodesPerMethodCall = readOperationLimit(results[6]);
+            limits.maxNodesPerHistoryReadData = readOperationLimit(results[7]);
+        }
+    }
+    return limits;
+}
+
+/// Get the number of operations per request for the given limit (`0` = no limit).
+constexpr size_t getChunkSize(uint32_t operationLimit, size_t size) noexcept {
+    return operationLimit == 0 ? std::max<size_t>(size, 1) : operationLimit;
+}
+
+/**
+ * Send operations in chunks of at most the operation limit, or of the adaptive request size if
+ * enabled (see Client::setAdaptiveRequestSizing).
+ * @param sendChunk Send the operations `[offset, offset + count)` and return the service result,
+ *                  chunks rejected as too large are resent with a reduced size
+ */
+template <typename SendChunk>
+void forEachChunk(
+    Client& client,
+    StatisticsService service,
+    uint32_t operationLimit,
+    size_t size,
+    SendChunk&& sendChunk
+) {
+    const auto& options = client.getContext().requestSizing;
+    if (!options.has_value()) {
+        const size_t chunkSize = getChunkSize(operationLimit, size);
+        for (size_t offset = 0; offset < size; offset += chunkSize) {
+            sendChunk(offset, std::min(chunkSize, size - offset));
+        }
+        return;
+    }
+    auto& adaptive = client.getContext().requestSizes.at(static_cast<size_t>(service));
+    size_t offset = 0;
+    while (offset < size) {
+        const size_t count = std::min(adaptive.get(operationLimit, *options), size - offset);
+        const auto start = std::chrono::steady_clock::now();
+        const UA_StatusCode serviceResult = sendChunk(offset, count);
+        const auto latency = std::chrono::steady_clock::now() - start;
+        if (!adaptive.update(count, serviceResult, latency, operationLimit, *options)) {
+            offset += count;
+        }
+    }
+}
+
+}  // namespace opcua::detail
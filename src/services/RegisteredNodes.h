@@ -0,0 +1,88 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/NodeId.h"
+
+#include "../ClientContext.h"
+#include "../open62541_impl.h"
+#include "ServiceStatistics.h"
+
+namespace opcua::detail {
+
+using NodeAliases = std::unordered_map<NodeId, NodeId>;
+
+/// Register the nodes and return the new aliases, falls back to the original node ids on failure.
+inline NodeAliases registerNodeAliases(Client& client, const NodeAliases& aliases) {
+    std::vector<UA_NodeId> ids;
+    ids.reserve(aliases.size());
+    for (const auto& [id, alias] : aliases) {
+        ids.push_back(*id.handle());  // shallow copy
+    }
+    UA_RegisterNodesRequest request{};
+    request.nodesToRegisterSize = ids.size();
+    request.nodesToRegister = ids.data();
+    RegisterNodesResponse response = detail::invokeService(client, StatisticsService::Browse, [&] {
+        return UA_Client_Service_registerNodes(client.handle(), request);
+    });
+    const auto registered = response.getRegisteredNodeIds();
+    const bool success = response->responseHeader.serviceResult == UA_STATUSCODE_GOOD &&
+                         registered.size() == ids.size();
+    NodeAliases result;
+    size_t i = 0;
+    for (const auto& [id, alias] : aliases) {
+        result.emplace(id, success ? registered[i++] : id);
+    }
+    return result;
+}
+
+/**
+ * Get the aliases of the registered nodes for the current session (`nullptr` if no nodes are
+ * registered). The nodes are registered again if the session was re-created.
+ * The returned snapshot is immutable and must be kept alive until the request is encoded, because
+ * @ref substituteAlias returns shallow copies of its node ids.
+ * @param reregister Register outdated nodes synchronously, otherwise return `nullptr`
+ *                   (e.g. for asynchronous requests that might be sent from within callbacks)
+ */
+inline std::shared_ptr<const NodeAliases> getNodeAliases(Client& client, bool reregister = true) {
+    auto& context = client.getContext();
+    const std::lock_guard lock(context.mutex);
+    auto& registeredNodes = context.registeredNodes;
+    if (registeredNodes.aliases == nullptr) {
+        return nullptr;
+    }
+    if (registeredNodes.outdated) {
+        if (!reregister) {
+            return nullptr;
+        }
+        registeredNodes.outdated = false;
+        // the lock is released while a multiplexed request waits for its response
+        const auto previous = registeredNodes.aliases;
+        auto aliases = std::make_shared<const NodeAliases>(registerNodeAliases(client, *previous));
+        if (registeredNodes.aliases == previous) {
+            registeredNodes.aliases = aliases;
+        } else {
+            registeredNodes.outdated = true;  // changed concurrently, register again next time
+        }
+        return aliases;
+    }
+    return registeredNodes.aliases;
+}
+
+/// Substitute the node id with its registered alias (shallow).
+inline const UA_NodeId& substituteAlias(const NodeAliases* aliases, const UA_NodeId& id) noexcept {
+    if (aliases != nullptr) {
+        const auto it = aliases->find(asWrapper<NodeId>(id));
+        if (it != aliases->end()) {
+            return *it->second.handle();
+        }
+    }
+    return id;
+}
+
+}  // namespace opcua::detail
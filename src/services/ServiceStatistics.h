@@ -0,0 +1,78 @@
+#pragma once
+
+#include <functional>  // invoke
+#include <mutex>
+#include <string_view>
+#include <type_traits>
+#include <utility>  // forward
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/Tracer.h"
+
+#include "../ClientContext.h"
+#include "../open62541_impl.h"
+
+namespace opcua::detail {
+
+template <typename T, typename = void>
+struct HasResponseHeader : std::false_type {};
+
+template <typename T>
+struct HasResponseHeader<T, std::void_t<decltype(std::declval<T>().responseHeader)>>
+    : std::true_type {};
+
+/// Get the service result of a native response, result (with `statusCode`) or status code.
+template <typename T>
+UA_StatusCode getServiceResult(const T& response) noexcept {
+    if constexpr (std::is_same_v<T, UA_StatusCode>) {
+        return response;
+    } else if constexpr (HasResponseHeader<T>::value) {
+        return response.responseHeader.serviceResult;
+    } else {
+        return response.statusCode;
+    }
+}
+
+constexpr std::string_view getServiceName(StatisticsService service) noexcept {
+    switch (service) {
+    case StatisticsService::Read:
+        return "Read";
+    case StatisticsService::Write:
+        return "Write";
+    case StatisticsService::Browse:
+        return "Browse";
+    case StatisticsService::Call:
+        return "Call";
+    case StatisticsService::NodeManagement:
+        return "NodeManagement";
+    case StatisticsService::Subscription:
+        return "Subscription";
+    case StatisticsService::MonitoredItem:
+        return "MonitoredItem";
+    case StatisticsService::HistoryRead:
+        return "HistoryRead";
+    default:
+        return "Unknown";
+    }
+}
+
+/// Invoke a synchronous client service, record its latency in the client statistics and trace it
+/// with the client's tracer.
+/// The function must return the native response (or status code) of the service.
+/// The client is locked during the call, so services can be used from multiple threads if the
+/// event loop runs in the background (Client::runInBackground).
+template <typename F>
+auto invokeService(Client& client, StatisticsService service, F&& func) {
+    auto& context = client.getContext();
+    const std::lock_guard lock(context.mutex);
+    TraceSpan span(context.tracer.get(), getServiceName(service));
+    const auto start = Statistics::Clock::now();
+    auto response = std::invoke(std::forward<F>(func));
+    const UA_StatusCode status = getServiceResult(response);
+    context.statistics.record(service, start, status);
+    span.setStatus(status);
+    return response;
+}
+
+}  // namespace opcua::detail
@@ -2,20 +2,25 @@
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 
+#include <algorithm>
+#include <chrono>
 #include <memory>
 #include <utility>  // move
 
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NotificationQueue.h"
 #include "open62541pp/TypeWrapper.h"
 #include "open62541pp/open62541.h"
 
 #include "../ClientContext.h"
 #include "../open62541_impl.h"
+#include "ServiceStatistics.h"
+#include "SubscriptionRecovery.h"
 
-namespace opcua::services {
+namespace opcua {
 
-static void deleteSubscriptionCallback(
+void detail::deleteSubscriptionCallback(
     UA_Client* client, uint32_t subId, void* subContext
 ) noexcept {
     if (subContext != nullptr) {
@@ -26,9 +31,11 @@ static void deleteSubscriptionCallback(
         }
     }
     ClientContext& clientContext = getContext(client);
-    clientContext.subscriptions.erase(subId);
+    clientContext.eraseSubscription(subId);
 }
 
+namespace services {
+
 uint32_t createSubscription(
     Client& client,
     SubscriptionParameters& parameters,
@@ -48,13 +55,15 @@ uint32_t createSubscription(
 
     using Response =
         TypeWrapper<UA_CreateSubscriptionResponse, UA_TYPES_CREATESUBSCRIPTIONRESPONSE>;
-    const Response response = UA_Client_Subscriptions_create(
-        client.handle(),
-        request,
-        subscriptionContext.get(),
-        nullptr,  // statusChangeCallback
-        deleteSubscriptionCallback
-    );
+    const Response response = detail::invokeService(client, StatisticsService::Subscription, [&] {
+        return UA_Client_Subscriptions_create(
+            client.handle(),
+            request,
+            subscriptionContext.get(),
+            nullptr,  // statusChangeCallback
+            detail::deleteSubscriptionCallback
+        );
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
 
     // update revised parameters
@@ -62,6 +71,8 @@ uint32_t createSubscription(
     parameters.lifetimeCount = response->revisedLifetimeCount;
     parameters.maxKeepAliveCount = response->revisedMaxKeepAliveCount;
 
+    subscriptionContext->parameters = parameters;
+    subscriptionContext->publishingEnabled = publishingEnabled;
     const auto subscriptionId = response->subscriptionId;
     client.getContext().subscriptions.insert_or_assign(
         subscriptionId, std::move(subscriptionContext)
@@ -83,13 +94,29 @@ void modifySubscription(
 
     using Response =
         TypeWrapper<UA_ModifySubscriptionResponse, UA_TYPES_MODIFYSUBSCRIPTIONRESPONSE>;
-    const Response response = UA_Client_Subscriptions_modify(client.handle(), request);
+    const Response response = detail::invokeService(client, StatisticsService::Subscription, [&] {
+        return UA_Client_Subscriptions_modify(client.handle(), request);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
 
     // update revised parameters
     parameters.publishingInterval = response->revisedPublishingInterval;
     parameters.lifetimeCount = response->revisedLifetimeCount;
     parameters.maxKeepAliveCount = response->revisedMaxKeepAliveCount;
+
+    auto& subscriptions = client.getContext().subscriptions;
+    auto it = subscriptions.find(subscriptionId);
+    if (it != subscriptions.end()) {
+        auto& subscription = *it->second;
+        subscription.parameters = parameters;
+        if (subscription.adaptivePublishing.has_value()) {
+            // rebase keep-alive and lifetime periods
+            subscription.adaptivePublishing->keepAlivePeriod =
+                parameters.publishingInterval * parameters.maxKeepAliveCount;
+            subscription.adaptivePublishing->lifetimePeriod =
+                parameters.publishingInterval * parameters.lifetimeCount;
+        }
+    }
 }
 
 void setPublishingMode(Client& client, uint32_t subscriptionId, bool publishing) {
@@ -99,20 +126,89 @@ void setPublishingMode(Client& client, uint32_t subscriptionId, bool publishing)
     request.subscriptionIds = &subscriptionId;
 
     using Response = TypeWrapper<UA_SetPublishingModeResponse, UA_TYPES_SETPUBLISHINGMODERESPONSE>;
-    const Response response = UA_Client_Subscriptions_setPublishingMode(client.handle(), request);
+    const Response response = detail::invokeService(client, StatisticsService::Subscription, [&] {
+        return UA_Client_Subscriptions_setPublishingMode(client.handle(), request);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
 
     if (response->resultsSize != 1) {
         throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
     }
     detail::throwOnBadStatus(*response->results);
+
+    auto& subscriptions = client.getContext().subscriptions;
+    auto it = subscriptions.find(subscriptionId);
+    if (it != subscriptions.end()) {
+        it->second->publishingEnabled = publishing;
+    }
+}
+
+void setDataChangeBatchCallback(
+    Client& client, uint32_t subscriptionId, DataChangeBatchCallback callback
+) {
+    auto& subscriptions = client.getContext().subscriptions;
+    auto it = subscriptions.find(subscriptionId);
+    if (it == subscriptions.end()) {
+        throw BadStatus(UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID);
+    }
+    it->second->dataChangeBatchCallback = std::move(callback);
+}
+
+void setNotificationQueue(
+    Client& client, uint32_t subscriptionId, std::shared_ptr<NotificationQueue> queue
+) {
+    auto& subscriptions = client.getContext().subscriptions;
+    auto it = subscriptions.find(subscriptionId);
+    if (it == subscriptions.end()) {
+        throw BadStatus(UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID);
+    }
+    it->second->notificationQueue = std::move(queue);
+}
+
+void setAdaptivePublishing(
+    Client& client, uint32_t subscriptionId, std::optional<AdaptivePublishingPolicy> policy
+) {
+    auto& subscriptions = client.getContext().subscriptions;
+    auto it = subscriptions.find(subscriptionId);
+    if (it == subscriptions.end()) {
+        throw BadStatus(UA_STATUSCODE_BADSUBSCRIPTIONIDINVALID);
+    }
+    auto& subscription = *it->second;
+    if (!policy.has_value()) {
+        subscription.adaptivePublishing.reset();
+        return;
+    }
+    if (policy->minPublishingInterval <= 0.0 ||
+        policy->minPublishingInterval > policy->maxPublishingInterval ||
+        policy->maxNotificationsPerSecond <= 0.0 || policy->evaluationInterval <= 0.0 ||
+        policy->minPublishRequests == 0 ||
+        policy->minPublishRequests > policy->maxPublishRequests) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+    const auto& parameters = subscription.parameters;
+    ClientContext::Subscription::AdaptivePublishing adaptive{};
+    adaptive.policy = *policy;
+    adaptive.keepAlivePeriod = parameters.publishingInterval * parameters.maxKeepAliveCount;
+    adaptive.lifetimePeriod = parameters.publishingInterval * parameters.lifetimeCount;
+    adaptive.publishRequests = std::clamp(
+        UA_Client_getConfig(client.handle())->outStandingPublishRequests,
+        policy->minPublishRequests,
+        policy->maxPublishRequests
+    );
+    adaptive.windowStart = std::chrono::steady_clock::now();
+    subscription.notificationCount = 0;
+    subscription.adaptivePublishing = adaptive;
 }
 
 void deleteSubscription(Client& client, uint32_t subscriptionId) {
-    const auto status = UA_Client_Subscriptions_deleteSingle(client.handle(), subscriptionId);
+    const auto status = detail::invokeService(client, StatisticsService::Subscription, [&] {
+        return UA_Client_Subscriptions_deleteSingle(client.handle(), subscriptionId);
+    });
     detail::throwOnBadStatus(status);
 }
 
-}  // namespace opcua::services
+}  // namespace services
+
+}  // namespace opcua
 
 #endif
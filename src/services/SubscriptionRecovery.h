@@ -0,0 +1,38 @@
+#pragma once
+
+#include <cstdint>
+
+#include "open62541pp/Config.h"
+
+#include "../open62541_impl.h"
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+
+namespace opcua {
+class Client;
+}  // namespace opcua
+
+namespace opcua::detail {
+
+/// Native delete callback of client subscriptions (Subscription.cpp).
+void deleteSubscriptionCallback(UA_Client* client, uint32_t subId, void* subContext) noexcept;
+
+/**
+ * Recover the subscriptions of the client after a reconnect (MonitoredItem.cpp).
+ *
+ * All subscriptions are transferred to the current session with a single TransferSubscriptions
+ * request. Subscriptions that can't be transferred (e.g. deleted with the previous session) are
+ * recreated with their stored parameters and their monitored items are recreated with batched
+ * CreateMonitoredItems requests. The subscription and monitored item contexts are reused, so the
+ * callbacks and client-side state stay untouched, only the ids change.
+ *
+ * Notification messages retained by the server for transferred subscriptions (available sequence
+ * numbers) are requested with Republish and dispatched through the native notification callbacks.
+ * Data changes with timestamps not newer than the last received one are skipped, they were already
+ * delivered before the connection loss. Lost messages are reported with the gap callback.
+ */
+void recoverSubscriptions(Client& client) noexcept;
+
+}  // namespace opcua::detail
+
+#endif
@@ -1,30 +1,89 @@
 #include "open62541pp/services/View.h"
 
-#include <algorithm>  // transform
+#include <algorithm>  // min, max, transform
 #include <cstddef>
+#include <deque>
+#include <exception>
+#include <iterator>  // make_move_iterator
+#include <memory>
+#include <type_traits>  // is_same_v
+#include <unordered_set>
+#include <utility>  // exchange, move
+#include <vector>
 
+#include "open62541pp/BrowseCache.h"
 #include "open62541pp/Client.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/NodeIds.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/TypeWrapper.h"
+#include "open62541pp/services/Attribute.h"  // readAttributes
 #include "open62541pp/types/Builtin.h"
 
+#include "../NodeProfiler.h"
 #include "../open62541_impl.h"
+#include "AsyncService.h"
+#include "OperationLimits.h"
+#include "ServiceStatistics.h"
 
 namespace opcua::services {
 
 BrowseResponse browse(Client& client, const BrowseRequest& request) {
-    BrowseResponse response = UA_Client_Service_browse(client.handle(), request);
+    BrowseResponse response = detail::invokeService(client, StatisticsService::Browse, [&] {
+        return detail::sendRequest<BrowseResponse>(
+            client, request, UA_TYPES[UA_TYPES_BROWSEREQUEST]
+        );
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
 
 template <>
-BrowseResult browse<Server>(Server& server, const BrowseDescription& bd, uint32_t maxReferences) {
+Result<BrowseResult> tryBrowse<Server>(
+    Server& server, const BrowseDescription& bd, uint32_t maxReferences
+) noexcept {
+    const detail::NodeAccessScope scope(NodeAccess::Browse);
     BrowseResult result = UA_Server_browse(server.handle(), maxReferences, bd.handle());
-    detail::throwOnBadStatus(result->statusCode);
-    return result;
+    if (detail::isBadStatus(result->statusCode)) {
+        return BadResult(result->statusCode);
+    }
+    return {std::move(result)};
+}
+
+template <>
+Result<BrowseResult> tryBrowse<Client>(
+    Client& client, const BrowseDescription& bd, uint32_t maxReferences
+) noexcept {
+    return detail::tryInvoke([&]() -> Result<BrowseResult> {
+        UA_BrowseRequest request{};
+        request.requestedMaxReferencesPerNode = maxReferences;
+        request.nodesToBrowseSize = 1;
+        request.nodesToBrowse = const_cast<UA_BrowseDescription*>(bd.handle());  // NOLINT
+
+        BrowseResponse response = detail::invokeService(client, StatisticsService::Browse, [&] {
+            return detail::sendRequest<BrowseResponse>(
+                client, request, UA_TYPES[UA_TYPES_BROWSEREQUEST]
+            );
+        });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        if (detail::isBadStatus(serviceResult)) {
+            return BadResult(serviceResult);
+        }
+        if (response->resultsSize != 1) {
+            return BadResult(UA_STATUSCODE_BADUNEXPECTEDERROR);
+        }
+        if (detail::isBadStatus(response->results->statusCode)) {
+            return BadResult(response->results->statusCode);
+        }
+        BrowseResult result;
+        result.swap(*response->results);
+        return {std::move(result)};
+    });
+}
+
+template <>
+BrowseResult browse<Server>(Server& server, const BrowseDescription& bd, uint32_t maxReferences) {
+    return tryBrowse(server, bd, maxReferences).value();
 }
 
 template <>
@@ -44,8 +103,53 @@ BrowseResult browse<Client>(Client& client, const BrowseDescription& bd, uint32_
     return result;
 }
 
+void browseAsync(
+    Client& client,
+    const BrowseDescription& bd,
+    uint32_t maxReferences,
+    AsyncCallback<BrowseResult> callback
+) {
+    UA_BrowseRequest request{};
+    request.requestedMaxReferencesPerNode = maxReferences;
+    request.nodesToBrowseSize = 1;
+    request.nodesToBrowse = const_cast<UA_BrowseDescription*>(bd.handle());  // NOLINT
+
+    detail::sendAsyncRequest<BrowseResponse>(
+        client,
+        request,
+        UA_TYPES[UA_TYPES_BROWSEREQUEST],
+        [cb = std::move(callback)](BrowseResponse& response) {
+            BrowseResult result;
+            StatusCode status = response->responseHeader.serviceResult;
+            if (status.isGood()) {
+                if (response->resultsSize != 1) {
+                    status = UA_STATUSCODE_BADUNEXPECTEDERROR;
+                } else {
+                    status = response->results->statusCode;
+                    if (status.isGood()) {
+                        result.swap(*response->results);
+                    }
+                }
+            }
+            cb(status, result);
+        }
+    );
+}
+
+std::future<BrowseResult> browseAsync(
+    Client& client, const BrowseDescription& bd, uint32_t maxReferences
+) {
+    return detail::invokeWithFuture<BrowseResult>([&](auto&& callback) {
+        browseAsync(client, bd, maxReferences, std::move(callback));
+    });
+}
+
 BrowseNextResponse browseNext(Client& client, const BrowseNextRequest& request) {
-    BrowseNextResponse response = UA_Client_Service_browseNext(client.handle(), request);
+    BrowseNextResponse response = detail::invokeService(client, StatisticsService::Browse, [&] {
+        return detail::sendRequest<BrowseNextResponse>(
+            client, request, UA_TYPES[UA_TYPES_BROWSENEXTREQUEST]
+        );
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
@@ -54,6 +158,7 @@ template <>
 BrowseResult browseNext<Server>(
     Server& server, bool releaseContinuationPoint, const ByteString& continuationPoint
 ) {
+    const detail::NodeAccessScope scope(NodeAccess::Browse);
     BrowseResult result = UA_Server_browseNext(
         server.handle(), releaseContinuationPoint, continuationPoint.handle()
     );
@@ -80,25 +185,190 @@ BrowseResult browseNext<Client>(
     return result;
 }
 
-template <typename T>
-std::vector<ReferenceDescription> browseAll(
-    T& serverOrClient, const BrowseDescription& bd, uint32_t maxReferences
+template <typename T, typename Vector>
+static void browseAllUncached(
+    T& serverOrClient, const BrowseDescription& bd, Vector& refs, uint32_t maxReferences
 ) {
     auto response = browse(serverOrClient, bd, maxReferences);
-    std::vector<ReferenceDescription> refs(response.getReferences());
+    auto refsFirst = response.getReferences();
+    refs.assign(
+        std::make_move_iterator(refsFirst.begin()), std::make_move_iterator(refsFirst.end())
+    );
     while (!response.getContinuationPoint().empty()) {
-        const bool release = (refs.size() >= maxReferences);
+        const bool release = (maxReferences > 0) && (refs.size() >= maxReferences);
         response = browseNext(serverOrClient, release, response.getContinuationPoint());
         auto refsNext = response.getReferences();
-        refs.insert(refs.end(), refsNext.begin(), refsNext.end());
+        refs.insert(
+            refs.end(),
+            std::make_move_iterator(refsNext.begin()),
+            std::make_move_iterator(refsNext.end())
+        );
     }
     if ((maxReferences > 0) && (refs.size() > maxReferences)) {
         refs.resize(maxReferences);
     }
+}
+
+template <typename T>
+void browseAll(
+    T& serverOrClient,
+    const BrowseDescription& bd,
+    std::vector<ReferenceDescription>& references,
+    uint32_t maxReferences
+) {
+    if constexpr (std::is_same_v<T, Client>) {
+        if (const auto cache = serverOrClient.getBrowseCache()) {
+            if (auto refs = cache->find(bd, maxReferences)) {
+                references.assign(
+                    std::make_move_iterator(refs->begin()), std::make_move_iterator(refs->end())
+                );
+                return;
+            }
+            browseAllUncached(serverOrClient, bd, references, maxReferences);
+            cache->insert(bd, maxReferences, references);
+            return;
+        }
+    }
+    browseAllUncached(serverOrClient, bd, references, maxReferences);
+}
+
+template <typename T>
+std::vector<ReferenceDescription> browseAll(
+    T& serverOrClient, const BrowseDescription& bd, uint32_t maxReferences
+) {
+    std::vector<ReferenceDescription> refs;
+    browseAll(serverOrClient, bd, refs, maxReferences);
+    return refs;
+}
+
+#ifdef UAPP_HAS_PMR
+template <typename T>
+std::pmr::vector<ReferenceDescription> browseAll(
+    T& serverOrClient,
+    const BrowseDescription& bd,
+    std::pmr::memory_resource* resource,
+    uint32_t maxReferences
+) {
+    std::pmr::vector<ReferenceDescription> refs(resource);
+    if constexpr (std::is_same_v<T, Client>) {
+        if (serverOrClient.getBrowseCache() != nullptr) {
+            auto cached = browseAll(serverOrClient, bd, maxReferences);
+            refs.assign(
+                std::make_move_iterator(cached.begin()), std::make_move_iterator(cached.end())
+            );
+            return refs;
+        }
+    }
+    browseAllUncached(serverOrClient, bd, refs, maxReferences);
     return refs;
 }
+#endif
+
+template <typename T>
+BrowseRange<T>::BrowseRange(T& serverOrClient, const BrowseDescription& bd, uint32_t pageSize)
+    : connection_(&serverOrClient),
+      bd_(bd),
+      pageSize_(pageSize) {}
+
+template <typename T>
+BrowseRange<T>::BrowseRange(BrowseRange&& other) noexcept
+    : connection_(std::exchange(other.connection_, nullptr)),
+      bd_(std::move(other.bd_)),
+      pageSize_(other.pageSize_),
+      started_(other.started_),
+      page_(std::move(other.page_)) {}
+
+template <typename T>
+BrowseRange<T>::~BrowseRange() {
+    try {
+        release();
+    } catch (...) {  // NOLINT, ignore
+    }
+}
+
+template <typename T>
+bool BrowseRange<T>::next() {
+    if (connection_ == nullptr) {
+        return false;
+    }
+    if (!started_) {
+        started_ = true;
+        page_ = browse(*connection_, bd_, pageSize_);
+        return true;
+    }
+    if (page_.getContinuationPoint().empty()) {
+        page_ = BrowseResult();
+        return false;
+    }
+    page_ = browseNext(*connection_, false, page_.getContinuationPoint());
+    return true;
+}
+
+template <typename T>
+void BrowseRange<T>::release() {
+    started_ = true;
+    if (connection_ == nullptr || page_.getContinuationPoint().empty()) {
+        page_ = BrowseResult();
+        return;
+    }
+    const ByteString continuationPoint = page_.getContinuationPoint();
+    page_ = BrowseResult();
+    browseNext(*connection_, true, continuationPoint);
+}
+
+Span<const DataValue> BrowseAttributesResult::getColumn(AttributeId attributeId) const noexcept {
+    for (size_t i = 0; i < attributeIds.size() && i < columns.size(); ++i) {
+        if (attributeIds[i] == attributeId) {
+            return columns[i];
+        }
+    }
+    return {};
+}
+
+template <typename T>
+BrowseAttributesResult browseWithAttributes(
+    T& serverOrClient,
+    const BrowseDescription& bd,
+    Span<const AttributeId> attributeIds,
+    TimestampsToReturn timestamps
+) {
+    BrowseAttributesResult result;
+    result.references = browseAll(serverOrClient, bd);
+    result.attributeIds.assign(attributeIds.begin(), attributeIds.end());
+    result.nodeIds.reserve(result.references.size());
+    std::vector<ReadValueId> nodesToRead;
+    nodesToRead.reserve(result.references.size() * attributeIds.size());
+    for (const auto& ref : result.references) {
+        result.nodeIds.push_back(ref.getNodeId().getNodeId());
+        if (ref.getNodeId().isLocal()) {
+            for (const auto attributeId : attributeIds) {
+                nodesToRead.emplace_back(ref.getNodeId().getNodeId(), attributeId);
+            }
+        }
+    }
+    const auto values = readAttributes(serverOrClient, nodesToRead, timestamps);
+
+    // transpose the batched results (rows of targets) to columns of attributes
+    result.columns.resize(attributeIds.size());
+    for (auto& column : result.columns) {
+        column.resize(result.references.size());
+    }
+    size_t offset = 0;
+    for (size_t row = 0; row < result.references.size(); ++row) {
+        const bool local = result.references[row].getNodeId().isLocal();
+        for (size_t col = 0; col < attributeIds.size(); ++col) {
+            if (local) {
+                result.columns[col][row] = values[offset++];
+            } else {
+                result.columns[col][row].setStatusCode(UA_STATUSCODE_BADNODEIDUNKNOWN);
+            }
+        }
+    }
+    return result;
+}
 
 std::vector<ExpandedNodeId> browseRecursive(Server& server, const BrowseDescription& bd) {
+    const detail::NodeAccessScope scope(NodeAccess::Browse);
     size_t arraySize{};
     UA_ExpandedNodeId* array{};
     const auto status = UA_Server_browseRecursive(server.handle(), bd.handle(), &arraySize, &array);
@@ -111,11 +381,165 @@ std::vector<ExpandedNodeId> browseRecursive(Server& server, const BrowseDescript
     return result;
 }
 
+namespace {
+
+/// State of a recursive client browse, shared with the callbacks of pending requests.
+struct RecursiveBrowse {
+    Client& client;
+    UA_BrowseDescription description{};  // template for all browse requests (shallow)
+    uint32_t nodeClassMask{};
+    size_t maxNodesPerRequest{};
+    std::function<void(const ReferenceDescription& ref)> onReference;
+    std::deque<NodeId> nodesToBrowse;
+    std::deque<ByteString> continuationPoints;
+    std::unordered_set<NodeId> visited;
+    size_t pendingRequests{0};
+    StatusCode status;
+    std::exception_ptr exception;
+
+    bool failed() const noexcept {
+        return status.isBad() || exception != nullptr;
+    }
+
+    bool hasWork() const noexcept {
+        return !continuationPoints.empty() || !nodesToBrowse.empty();
+    }
+
+    void processResults(Span<BrowseResult> results) {
+        for (auto& result : results) {
+            if (result.getStatusCode().isBad()) {
+                continue;  // node doesn't exist anymore or is not browsable
+            }
+            for (const auto& ref : result.getReferences()) {
+                const auto& target = ref.getNodeId();
+                if (!target.isLocal() || !visited.insert(target.getNodeId()).second) {
+                    continue;
+                }
+                if (nodeClassMask == UA_NODECLASS_UNSPECIFIED ||
+                    (nodeClassMask & static_cast<uint32_t>(ref.getNodeClass())) != 0) {
+                    onReference(ref);
+                }
+                nodesToBrowse.push_back(target.getNodeId());
+            }
+            if (!result.getContinuationPoint().empty()) {
+                continuationPoints.push_back(result.getContinuationPoint());
+            }
+        }
+    }
+
+    template <typename Response>
+    void handleResponse(Response& response) {
+        --pendingRequests;
+        if (failed()) {
+            return;
+        }
+        status = response->responseHeader.serviceResult;
+        if (status.isBad()) {
+            return;
+        }
+        try {
+            processResults(response.getResults());
+        } catch (...) {
+            exception = std::current_exception();
+        }
+    }
+};
+
+}  // namespace
+
+static void sendBrowseNext(const std::shared_ptr<RecursiveBrowse>& state) {
+    const size_t count = std::min(state->continuationPoints.size(), state->maxNodesPerRequest);
+    std::vector<UA_ByteString> continuationPoints(count);
+    for (size_t i = 0; i < count; ++i) {
+        continuationPoints[i] = *state->continuationPoints[i].handle();  // shallow copy
+    }
+    UA_BrowseNextRequest request{};
+    request.releaseContinuationPoints = false;
+    request.continuationPointsSize = count;
+    request.continuationPoints = continuationPoints.data();
+    detail::sendAsyncRequest<BrowseNextResponse>(
+        state->client,
+        request,
+        UA_TYPES[UA_TYPES_BROWSENEXTREQUEST],
+        [state](BrowseNextResponse& response) { state->handleResponse(response); }
+    );
+    state->continuationPoints.erase(
+        state->continuationPoints.begin(),
+        state->continuationPoints.begin() + static_cast<std::ptrdiff_t>(count)
+    );
+    ++state->pendingRequests;
+}
+
+static void sendBrowse(const std::shared_ptr<RecursiveBrowse>& state) {
+    const size_t count = std::min(state->nodesToBrowse.size(), state->maxNodesPerRequest);
+    std::vector<UA_BrowseDescription> descriptions(count, state->description);
+    for (size_t i = 0; i < count; ++i) {
+        descriptions[i].nodeId = *state->nodesToBrowse[i].handle();  // shallow copy
+    }
+    UA_BrowseRequest request{};
+    request.nodesToBrowseSize = count;
+    request.nodesToBrowse = descriptions.data();
+    detail::sendAsyncRequest<BrowseResponse>(
+        state->client,
+        request,
+        UA_TYPES[UA_TYPES_BROWSEREQUEST],
+        [state](BrowseResponse& response) { state->handleResponse(response); }
+    );
+    state->nodesToBrowse.erase(
+        state->nodesToBrowse.begin(),
+        state->nodesToBrowse.begin() + static_cast<std::ptrdiff_t>(count)
+    );
+    ++state->pendingRequests;
+}
+
+void browseRecursive(
+    Client& client,
+    const BrowseDescription& bd,
+    std::function<void(const ReferenceDescription& ref)> onReference,
+    size_t maxConcurrentRequests
+) {
+    const auto& limits = detail::getOperationLimits(client);
+    auto state = std::make_shared<RecursiveBrowse>(RecursiveBrowse{client});
+    state->description = *bd.handle();  // shallow copy
+    state->description.nodeClassMask = UA_NODECLASS_UNSPECIFIED;  // recurse into all nodes
+    state->description.resultMask |= UA_BROWSERESULTMASK_NODECLASS;
+    state->nodeClassMask = bd->nodeClassMask;
+    state->maxNodesPerRequest = detail::getChunkSize(limits.maxNodesPerBrowse, 1000);
+    state->onReference = std::move(onReference);
+    state->nodesToBrowse.push_back(bd.getNodeId());
+    state->visited.insert(bd.getNodeId());
+
+    maxConcurrentRequests = std::max<size_t>(maxConcurrentRequests, 1);
+    while (true) {
+        // continuation points first to release server resources as early as possible
+        while (!state->failed() && state->hasWork() &&
+               state->pendingRequests < maxConcurrentRequests) {
+            if (!state->continuationPoints.empty()) {
+                sendBrowseNext(state);
+            } else {
+                sendBrowse(state);
+            }
+        }
+        if (state->pendingRequests == 0) {
+            break;
+        }
+        client.runIterate(100);
+    }
+    if (state->exception) {
+        std::rethrow_exception(state->exception);
+    }
+    detail::throwOnBadStatus(state->status);
+}
+
 TranslateBrowsePathsToNodeIdsResponse translateBrowsePathsToNodeIds(
     Client& client, const TranslateBrowsePathsToNodeIdsRequest& request
 ) {
     TranslateBrowsePathsToNodeIdsResponse response =
-        UA_Client_Service_translateBrowsePathsToNodeIds(client.handle(), request);
+        detail::invokeService(client, StatisticsService::Browse, [&] {
+            return detail::sendRequest<TranslateBrowsePathsToNodeIdsResponse>(
+                client, request, UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST]
+            );
+        });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
@@ -124,6 +548,7 @@ template <>
 BrowsePathResult translateBrowsePathToNodeIds<Server>(
     Server& server, const BrowsePath& browsePath
 ) {
+    const detail::NodeAccessScope scope(NodeAccess::Browse);
     BrowsePathResult result = UA_Server_translateBrowsePathToNodeIds(
         server.handle(), browsePath.handle()
     );
@@ -151,6 +576,62 @@ BrowsePathResult translateBrowsePathToNodeIds<Client>(
     return result;
 }
 
+template <>
+std::vector<BrowsePathResult> translateBrowsePathsToNodeIds<Server>(
+    Server& server, Span<const BrowsePath> browsePaths
+) {
+    const detail::NodeAccessScope scope(NodeAccess::Browse);
+    std::vector<BrowsePathResult> results;
+    results.reserve(browsePaths.size());
+    for (const auto& browsePath : browsePaths) {
+        results.emplace_back(
+            UA_Server_translateBrowsePathToNodeIds(server.handle(), browsePath.handle())
+        );
+    }
+    return results;
+}
+
+template <>
+std::vector<BrowsePathResult> translateBrowsePathsToNodeIds<Client>(
+    Client& client, Span<const BrowsePath> browsePaths
+) {
+    std::vector<BrowsePathResult> results(browsePaths.size());
+    const auto sendChunk = [&](size_t offset, size_t count) {
+        const auto chunk = browsePaths.subview(offset, count);
+        // avoid copy of browsePaths
+        UA_TranslateBrowsePathsToNodeIdsRequest request{};
+        request.browsePathsSize = chunk.size();
+        request.browsePaths = asNative(const_cast<BrowsePath*>(chunk.data()));  // NOLINT
+        TranslateBrowsePathsToNodeIdsResponse response =
+            detail::invokeService(client, StatisticsService::Browse, [&] {
+                return detail::sendRequest<TranslateBrowsePathsToNodeIdsResponse>(
+                    client, request, UA_TYPES[UA_TYPES_TRANSLATEBROWSEPATHSTONODEIDSREQUEST]
+                );
+            });
+        const UA_StatusCode serviceResult = response->responseHeader.serviceResult;
+        auto chunkResults = response.getResults();
+        for (size_t i = 0; i < chunk.size(); ++i) {
+            auto& result = results[offset + i];
+            if (detail::isBadStatus(serviceResult)) {
+                result->statusCode = serviceResult;
+            } else if (i >= chunkResults.size()) {
+                result->statusCode = UA_STATUSCODE_BADUNEXPECTEDERROR;
+            } else {
+                result.swap(chunkResults[i]);
+            }
+        }
+        return serviceResult;
+    };
+    detail::forEachChunk(
+        client,
+        StatisticsService::Browse,
+        detail::getOperationLimits(client).maxNodesPerTranslateBrowsePaths,
+        browsePaths.size(),
+        sendChunk
+    );
+    return results;
+}
+
 template <typename T>
 BrowsePathResult browseSimplifiedBrowsePath(
     T& serverOrClient, const NodeId& origin, Span<const QualifiedName> browsePath
@@ -169,13 +650,19 @@ BrowsePathResult browseSimplifiedBrowsePath(
 }
 
 RegisterNodesResponse registerNodes(Client& client, const RegisterNodesRequest& request) {
-    RegisterNodesResponse response = UA_Client_Service_registerNodes(client.handle(), request);
+    RegisterNodesResponse response = detail::invokeService(client, StatisticsService::Browse, [&] {
+        return UA_Client_Service_registerNodes(client.handle(), request);
+    });
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
 
 UnregisterNodesResponse unregisterNodes(Client& client, const UnregisterNodesRequest& request) {
-    UnregisterNodesResponse response = UA_Client_Service_unregisterNodes(client.handle(), request);
+    UnregisterNodesResponse response = detail::invokeService(
+        client, StatisticsService::Browse, [&] {
+            return UA_Client_Service_unregisterNodes(client.handle(), request);
+        }
+    );
     detail::throwOnBadStatus(response->responseHeader.serviceResult);
     return response;
 }
@@ -185,6 +672,18 @@ UnregisterNodesResponse unregisterNodes(Client& client, const UnregisterNodesReq
 
 template std::vector<ReferenceDescription> browseAll<Server>(Server&, const BrowseDescription&, uint32_t);
 template std::vector<ReferenceDescription> browseAll<Client>(Client&, const BrowseDescription&, uint32_t);
+template void browseAll<Server>(Server&, const BrowseDescription&, std::vector<ReferenceDescription>&, uint32_t);
+template void browseAll<Client>(Client&, const BrowseDescription&, std::vector<ReferenceDescription>&, uint32_t);
+#ifdef UAPP_HAS_PMR
+template std::pmr::vector<ReferenceDescription> browseAll<Server>(Server&, const BrowseDescription&, std::pmr::memory_resource*, uint32_t);
+template std::pmr::vector<ReferenceDescription> browseAll<Client>(Client&, const BrowseDescription&, std::pmr::memory_resource*, uint32_t);
+#endif
+
+template class BrowseRange<Server>;
+template class BrowseRange<Client>;
+
+template BrowseAttributesResult browseWithAttributes<Server>(Server&, const BrowseDescription&, Span<const AttributeId>, TimestampsToReturn);
+template BrowseAttributesResult browseWithAttributes<Client>(Client&, const BrowseDescription&, Span<const AttributeId>, TimestampsToReturn);
 
 template BrowsePathResult browseSimplifiedBrowsePath<Server>(Server&, const NodeId&, Span<const QualifiedName>);
 template BrowsePathResult browseSimplifiedBrowsePath<Client>(Client&, const NodeId&, Span<const QualifiedName>);
@@ -330,4 +330,14 @@ std::string NumericRange::toString() const {
     return ss.str();
 }
 
+const NumericRange& NumericRangeCache::get(std::string_view encodedRange) {
+    std::string key(encodedRange);
+    const auto it = ranges_.find(key);
+    if (it != ranges_.end()) {
+        return it->second;
+    }
+    NumericRange range(encodedRange);
+    return ranges_.emplace(std::move(key), std::move(range)).first->second;
+}
+
 }  // namespace opcua
@@ -321,6 +321,14 @@ Argument::Argument(
     copyArray(arrayDimensions, &handle()->arrayDimensions, handle()->arrayDimensionsSize);
 }
 
+CallMethodRequest::CallMethodRequest(
+    NodeId objectId, NodeId methodId, Span<const Variant> inputArguments
+) {
+    assign(std::move(objectId), handle()->objectId);
+    assign(std::move(methodId), handle()->methodId);
+    copyArray(inputArguments, &handle()->inputArguments, handle()->inputArgumentsSize);
+}
+
 #endif
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
@@ -523,6 +531,15 @@ AggregateFilter::AggregateFilter(
     assign(aggregateConfiguration, handle()->aggregateConfiguration);  // TODO: make wrapper?
 }
 
+AggregateFilter::AggregateFilter(
+    DateTime startTime, NodeId aggregateType, double processingInterval
+) {
+    assign(std::move(startTime), handle()->startTime);
+    assign(std::move(aggregateType), handle()->aggregateType);
+    assign(processingInterval, handle()->processingInterval);
+    handle()->aggregateConfiguration.useServerCapabilitiesDefaults = true;
+}
+
 #endif
 
 }  // namespace opcua
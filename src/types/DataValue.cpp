@@ -1,5 +1,7 @@
 #include "open62541pp/types/DataValue.h"
 
+#include <utility>  // exchange, move
+
 #include "../open62541_impl.h"
 
 namespace opcua {
@@ -73,6 +75,11 @@ const Variant& DataValue::getValue() const noexcept {
     return asWrapper<Variant>(handle()->value);
 }
 
+Variant DataValue::takeValue() noexcept {
+    handle()->hasValue = false;
+    return Variant(std::exchange(handle()->value, {}));
+}
+
 DateTime DataValue::getSourceTimestamp() const noexcept {
     return DateTime(handle()->sourceTimestamp);  // NOLINT
 }
@@ -1,8 +1,14 @@
 #include "open62541pp/types/ExtensionObject.h"
 
+#include <algorithm>  // max
+#include <cstdint>
+
+#include "open62541pp/BinaryEncoding.h"
+#include "open62541pp/DataTypeRegistry.h"
 #include "open62541pp/ErrorHandling.h"
 #include "open62541pp/types/Builtin.h"
 #include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
 
 namespace opcua {
 
@@ -87,4 +93,271 @@ const void* ExtensionObject::getDecodedData() const noexcept {
     return nullptr;
 }
 
+#if UAPP_OPEN62541_VER_GE(1, 3)
+
+static bool isSameDataType(const UA_DataType* lhs, const UA_DataType& rhs) noexcept {
+    return lhs != nullptr && (lhs == &rhs || UA_NodeId_equal(&lhs->typeId, &rhs.typeId));
+}
+
+static bool hasBinaryBodyOf(const UA_ExtensionObject& obj, const UA_DataType& type) noexcept {
+    return obj.encoding == UA_EXTENSIONOBJECT_ENCODED_BYTESTRING &&
+           UA_NodeId_equal(&obj.content.encoded.typeId, &type.binaryEncodingId);  // NOLINT
+}
+
+template <typename CustomTypes>
+static void* decodeInPlace(
+    UA_ExtensionObject& obj, const UA_DataType& type, const CustomTypes& customTypes
+) {
+    const auto& body = obj.content.encoded.body;  // NOLINT
+    void* data = UA_new(&type);
+    if (data == nullptr) {
+        throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+    }
+    try {
+        decodeBinary({body.data, body.length}, data, type, customTypes);
+    } catch (...) {
+        UA_delete(data, &type);
+        throw;
+    }
+    UA_ExtensionObject_clear(&obj);
+    obj.encoding = UA_EXTENSIONOBJECT_DECODED;
+    obj.content.decoded.type = &type;  // NOLINT
+    obj.content.decoded.data = data;  // NOLINT
+    return data;
+}
+
+void* ExtensionObject::decode(const UA_DataType& type, Span<const DataType> customTypes) {
+    if (isDecoded()) {
+        return isSameDataType(getDecodedDataType(), type) ? getDecodedData() : nullptr;
+    }
+    if (!hasBinaryBodyOf(*handle(), type)) {
+        return nullptr;
+    }
+    return decodeInPlace(*handle(), type, customTypes);
+}
+
+void* ExtensionObject::decode(const DataTypeRegistry& registry) {
+    if (isDecoded()) {
+        return getDecodedData();
+    }
+    if (handle()->encoding != UA_EXTENSIONOBJECT_ENCODED_BYTESTRING) {
+        return nullptr;
+    }
+    const auto& encodingId = asWrapper<NodeId>(handle()->content.encoded.typeId);  // NOLINT
+    const UA_DataType* type = registry.findByBinaryEncodingId(encodingId);
+    if (type == nullptr) {
+        type = DataTypeRegistry::findBuiltinByBinaryEncodingId(encodingId);
+    }
+    if (type == nullptr) {
+        return nullptr;
+    }
+    return decodeInPlace(*handle(), *type, registry);
+}
+
+/// Size of the binary encoding of fixed-size types, 0 for types with variable size.
+static size_t getFixedEncodingSize(const UA_DataType& type) noexcept {
+    switch (type.typeKind) {
+    case UA_DATATYPEKIND_BOOLEAN:
+    case UA_DATATYPEKIND_SBYTE:
+    case UA_DATATYPEKIND_BYTE:
+        return 1;
+    case UA_DATATYPEKIND_INT16:
+    case UA_DATATYPEKIND_UINT16:
+        return 2;
+    case UA_DATATYPEKIND_INT32:
+    case UA_DATATYPEKIND_UINT32:
+    case UA_DATATYPEKIND_FLOAT:
+    case UA_DATATYPEKIND_STATUSCODE:
+    case UA_DATATYPEKIND_ENUM:
+        return 4;
+    case UA_DATATYPEKIND_INT64:
+    case UA_DATATYPEKIND_UINT64:
+    case UA_DATATYPEKIND_DOUBLE:
+    case UA_DATATYPEKIND_DATETIME:
+        return 8;
+    case UA_DATATYPEKIND_GUID:
+        return 16;
+    default:
+        return 0;
+    }
+}
+
+namespace {
+
+/// Cursor over an encoded structure body to skip members without decoding them.
+class EncodedBodyReader {
+public:
+    EncodedBodyReader(Span<const uint8_t> body, Span<const DataType> customTypes)
+        : body_(body),
+          customTypes_(customTypes) {}
+
+    Span<const uint8_t> remaining() const noexcept {
+        return body_.subview(offset_);
+    }
+
+    void advance(size_t bytes) {
+        if (bytes > body_.size() - offset_) {
+            throw BadStatus(UA_STATUSCODE_BADDECODINGERROR);
+        }
+        offset_ += bytes;
+    }
+
+    int32_t readLength() {
+        const auto bytes = remaining();
+        advance(4);
+        return static_cast<int32_t>(
+            static_cast<uint32_t>(bytes[0]) | (static_cast<uint32_t>(bytes[1]) << 8) |
+            (static_cast<uint32_t>(bytes[2]) << 16) | (static_cast<uint32_t>(bytes[3]) << 24)
+        );
+    }
+
+    /// Decode a scalar at the current position and advance past it.
+    void decodeScalar(void* data, const UA_DataType& type) {
+        decodeBinary(remaining(), data, type, customTypes_);
+        const size_t fixedSize = getFixedEncodingSize(type);
+        advance(fixedSize > 0 ? fixedSize : calcSizeBinary(data, type));
+    }
+
+    void skipScalar(const UA_DataType& type) {
+        if (const size_t fixedSize = getFixedEncodingSize(type); fixedSize > 0) {
+            advance(fixedSize);
+            return;
+        }
+        switch (type.typeKind) {
+        case UA_DATATYPEKIND_STRING:
+        case UA_DATATYPEKIND_BYTESTRING:
+        case UA_DATATYPEKIND_XMLELEMENT:
+            advance(static_cast<size_t>(std::max<int32_t>(readLength(), 0)));
+            return;
+        case UA_DATATYPEKIND_STRUCTURE:
+            for (size_t i = 0; i < type.membersSize; ++i) {
+                skipMember(type.members[i]);  // NOLINT
+            }
+            return;
+        default: {
+            // decode and discard, the encoded size is recomputed from the decoded value
+            void* data = UA_new(&type);
+            if (data == nullptr) {
+                throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+            }
+            try {
+                decodeScalar(data, type);
+            } catch (...) {
+                UA_delete(data, &type);
+                throw;
+            }
+            UA_delete(data, &type);
+        }
+        }
+    }
+
+    void skipMember(const UA_DataTypeMember& member) {
+        if (!member.isArray) {
+            skipScalar(*member.memberType);
+            return;
+        }
+        const int32_t length = readLength();
+        const size_t fixedSize = getFixedEncodingSize(*member.memberType);
+        if (fixedSize > 0) {
+            advance(static_cast<size_t>(std::max<int32_t>(length, 0)) * fixedSize);
+            return;
+        }
+        for (int32_t i = 0; i < length; ++i) {
+            skipScalar(*member.memberType);
+        }
+    }
+
+private:
+    Span<const uint8_t> body_;
+    Span<const DataType> customTypes_;
+    size_t offset_{0};
+};
+
+}  // namespace
+
+static Variant decodeEncodedMember(
+    const UA_ByteString& body,
+    const UA_DataType& type,
+    size_t memberIndex,
+    Span<const DataType> customTypes
+) {
+    EncodedBodyReader reader({body.data, body.length}, customTypes);
+    for (size_t i = 0; i < memberIndex; ++i) {
+        reader.skipMember(type.members[i]);  // NOLINT
+    }
+    const auto& member = type.members[memberIndex];  // NOLINT
+    const auto& memberType = *member.memberType;
+    Variant result;
+    if (!member.isArray) {
+        void* data = UA_new(&memberType);
+        if (data == nullptr) {
+            throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+        }
+        UA_Variant_setScalar(result.handle(), data, &memberType);  // take ownership
+        decodeBinary(reader.remaining(), data, memberType, customTypes);
+        return result;
+    }
+    const int32_t length = reader.readLength();
+    const size_t size = static_cast<size_t>(std::max<int32_t>(length, 0));
+    void* array = UA_Array_new(size, &memberType);
+    if (array == nullptr && size > 0) {
+        throw BadStatus(UA_STATUSCODE_BADOUTOFMEMORY);
+    }
+    UA_Variant_setArray(result.handle(), array, size, &memberType);  // take ownership
+    auto* element = static_cast<uint8_t*>(array);
+    for (size_t i = 0; i < size; ++i) {
+        reader.decodeScalar(element, memberType);
+        element += memberType.memSize;  // NOLINT
+    }
+    return result;
+}
+
+static Variant copyDecodedMember(const void* data, const UA_DataType& type, size_t memberIndex) {
+    auto ptr = reinterpret_cast<uintptr_t>(data);  // NOLINT
+    for (size_t i = 0; i < memberIndex; ++i) {
+        const auto& member = type.members[i];  // NOLINT
+        ptr += member.padding;
+        ptr += member.isArray ? sizeof(size_t) + sizeof(void*) : member.memberType->memSize;
+    }
+    const auto& member = type.members[memberIndex];  // NOLINT
+    ptr += member.padding;
+    Variant result;
+    UA_StatusCode status{};
+    if (member.isArray) {
+        const size_t size = *reinterpret_cast<const size_t*>(ptr);  // NOLINT
+        const void* array = *reinterpret_cast<void* const*>(ptr + sizeof(size_t));  // NOLINT
+        status = UA_Variant_setArrayCopy(result.handle(), array, size, member.memberType);
+    } else {
+        const void* scalar = reinterpret_cast<const void*>(ptr);  // NOLINT
+        status = UA_Variant_setScalarCopy(result.handle(), scalar, member.memberType);
+    }
+    detail::throwOnBadStatus(status);
+    return result;
+}
+
+Variant ExtensionObject::decodeMember(
+    const UA_DataType& type, size_t memberIndex, Span<const DataType> customTypes
+) const {
+    if (type.typeKind != UA_DATATYPEKIND_STRUCTURE) {
+        throw BadStatus(UA_STATUSCODE_BADNOTSUPPORTED);
+    }
+    if (memberIndex >= type.membersSize) {
+        throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);
+    }
+    if (isDecoded()) {
+        if (!isSameDataType(getDecodedDataType(), type)) {
+            throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+        }
+        return copyDecodedMember(getDecodedData(), type, memberIndex);
+    }
+    if (!hasBinaryBodyOf(*handle(), type)) {
+        throw BadStatus(UA_STATUSCODE_BADTYPEMISMATCH);
+    }
+    return decodeEncodedMember(
+        handle()->content.encoded.body, type, memberIndex, customTypes  // NOLINT
+    );
+}
+
+#endif
+
 }  // namespace opcua
@@ -1,5 +1,7 @@
 #include "open62541pp/types/Variant.h"
 
+#include <algorithm>  // min
+
 #include "open62541pp/detail/helper.h"
 #include "open62541pp/overloads/comparison.h"
 #include "open62541pp/types/NodeId.h"
@@ -114,6 +116,58 @@ void Variant::checkIsArray() const {
     }
 }
 
+std::pair<size_t, size_t> Variant::getContiguousRange(const NumericRange& range) const {
+    // row-major dimensions of the array
+    const size_t length = handle()->arrayLength;
+    Span<const uint32_t> dimensions = getArrayDimensions();
+    const uint32_t flatDimensions[1]{static_cast<uint32_t>(length)};  // NOLINT
+    if (dimensions.empty()) {
+        dimensions = flatDimensions;
+    }
+    const auto& ranges = range.get();
+    if (ranges.empty() || ranges.size() != dimensions.size()) {
+        throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);
+    }
+    size_t offset = 0;
+    size_t count = 1;
+    size_t stride = 1;
+    bool partial = false;  // a truncated dimension was found (walking from the innermost)
+    for (size_t i = ranges.size(); i-- > 0;) {
+        const auto& dim = ranges[i];
+        if (dim.min > dim.max) {
+            throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);
+        }
+        if (dim.min >= dimensions[i]) {
+            throw BadStatus(UA_STATUSCODE_BADINDEXRANGENODATA);
+        }
+        const size_t max = std::min<size_t>(dim.max, dimensions[i] - 1);
+        const size_t extent = max - dim.min + 1;
+        if (partial && extent > 1) {
+            throw BadStatus(UA_STATUSCODE_BADINDEXRANGEINVALID);  // not contiguous
+        }
+        if (extent < dimensions[i]) {
+            partial = true;
+        }
+        offset += dim.min * stride;
+        count *= extent;
+        stride *= dimensions[i];
+    }
+    if (offset + count > length) {
+        throw BadStatus(UA_STATUSCODE_BADINDEXRANGENODATA);
+    }
+    return {offset, count};
+}
+
+Variant Variant::copyRange(const NumericRange& range) const {
+    const auto& dimensions = range.get();
+    UA_NumericRange native{};
+    native.dimensionsSize = dimensions.size();
+    native.dimensions = const_cast<UA_NumericRangeDimension*>(dimensions.data());  // NOLINT
+    Variant result;
+    detail::throwOnBadStatus(UA_Variant_copyRange(handle(), result.handle(), native));
+    return result;
+}
+
 void Variant::setScalarImpl(void* value, const UA_DataType& type, bool own) noexcept {
     clear();
     UA_Variant_setScalar(handle(), value, &type);
@@ -122,6 +176,9 @@ void Variant::setScalarImpl(void* value, const UA_DataType& type, bool own) noex
 
 void Variant::setScalarCopyImpl(const void* value, const UA_DataType& type) {
     clear();
+#ifdef UAPP_ENABLE_ALLOC_STATS
+    detail::recordDeepCopy();
+#endif
     const auto status = UA_Variant_setScalarCopy(handle(), value, &type);
     detail::throwOnBadStatus(status);
     handle()->storageType = UA_VARIANT_DATA;
@@ -133,8 +190,43 @@ void Variant::setArrayImpl(void* array, size_t size, const UA_DataType& type, bo
     handle()->storageType = own ? UA_VARIANT_DATA : UA_VARIANT_DATA_NODELETE;
 }
 
+void Variant::checkArrayDimensions(size_t size, Span<const uint32_t> dimensions) {
+    if (dimensions.empty()) {
+        return;
+    }
+    size_t product = 1;
+    for (const auto dim : dimensions) {
+        product *= dim;
+    }
+    if (product != size) {
+        throw BadStatus(UA_STATUSCODE_BADINVALIDARGUMENT);
+    }
+}
+
+void Variant::setArrayDimensionsImpl(Span<const uint32_t> dimensions, bool copy) {
+    if (dimensions.empty()) {
+        return;
+    }
+    if (copy) {
+        const auto status = UA_Array_copy(
+            dimensions.data(),
+            dimensions.size(),
+            reinterpret_cast<void**>(&handle()->arrayDimensions),  // NOLINT
+            &UA_TYPES[UA_TYPES_UINT32]
+        );
+        detail::throwOnBadStatus(status);
+    } else {
+        // borrowed like the data, not freed with storage type UA_VARIANT_DATA_NODELETE
+        handle()->arrayDimensions = const_cast<uint32_t*>(dimensions.data());  // NOLINT
+    }
+    handle()->arrayDimensionsSize = dimensions.size();
+}
+
 void Variant::setArrayCopyImpl(const void* array, size_t size, const UA_DataType& type) {
     clear();
+#ifdef UAPP_ENABLE_ALLOC_STATS
+    detail::recordDeepCopy();
+#endif
     const auto status = UA_Variant_setArrayCopy(handle(), array, size, &type);
     detail::throwOnBadStatus(status);
     handle()->storageType = UA_VARIANT_DATA;
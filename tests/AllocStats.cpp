@@ -0,0 +1,78 @@
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/AllocStats.h"
+#include "open62541pp/ThreadConfig.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/Variant.h"
+
+#include "open62541_impl.h"
+
+using namespace opcua;
+
+#ifdef UAPP_ENABLE_ALLOC_STATS
+TEST_CASE("AllocStats") {
+    SUBCASE("Deep copies") {
+        const String str("test");
+        const AllocStatsScope scope;
+        const String copy(str);  // NOLINT
+        CHECK(scope.get().deepCopies == 1);
+        const auto var = Variant::fromScalar(str);
+        CHECK(scope.get().deepCopies == 2);
+        const String created("no copy");
+        CHECK(scope.get().deepCopies == 2);
+    }
+
+    SUBCASE("Allocations") {
+        if (!isAllocCountingEnabled()) {
+            MESSAGE("allocator hooks not available (UA_ENABLE_MALLOC_SINGLETON)");
+            return;
+        }
+        const AllocStatsScope scope;
+        void* ptr = UA_malloc(100);
+        ptr = UA_realloc(ptr, 200);
+        UA_free(ptr);
+        const auto stats = scope.get();
+        CHECK(stats.allocations == 1);
+        CHECK(stats.reallocations == 1);
+        CHECK(stats.deallocations == 1);
+        CHECK(stats.allocatedBytes == 300);
+    }
+
+    SUBCASE("Thread counters and totals") {
+        const auto totalBefore = getAllocStats();
+        const auto threadBefore = getThreadAllocStats();
+        std::thread([] {
+            const String str("thread");
+            for (int i = 0; i < 10; ++i) {
+                const String copy(str);  // NOLINT
+            }
+            CHECK(getThreadAllocStats().deepCopies == 10);
+        }).join();
+        CHECK((getThreadAllocStats() - threadBefore).deepCopies == 0);
+        CHECK((getAllocStats() - totalBefore).deepCopies >= 10);
+    }
+
+    SUBCASE("Allocations of other threads") {
+        if (!isAllocCountingEnabled()) {
+            MESSAGE("allocator hooks not available (UA_ENABLE_MALLOC_SINGLETON)");
+            return;
+        }
+        std::thread([] {
+            // allocator hooks of open62541 are thread-local
+            CHECK_FALSE(isAllocCountingEnabled());
+            enableAllocCounting();
+            CHECK(isAllocCountingEnabled());
+            const AllocStatsScope scope;
+            UA_free(UA_malloc(100));
+            CHECK(scope.get().allocations == 1);
+            CHECK(scope.get().deallocations == 1);
+        }).join();
+        std::thread([] {
+            applyThreadConfig({});
+            CHECK(isAllocCountingEnabled());
+        }).join();
+    }
+}
+#endif
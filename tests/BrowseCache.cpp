@@ -0,0 +1,265 @@
+#include <chrono>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/BrowseCache.h"
+#include "open62541pp/BrowsePathCache.h"
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NodeAttributeCache.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+using namespace std::literals::chrono_literals;
+
+TEST_CASE("BrowseCache") {
+    const BrowseDescription bd(ObjectId::ObjectsFolder, BrowseDirection::Forward);
+
+    SUBCASE("Find and insert") {
+        BrowseCache cache;
+        CHECK_FALSE(cache.find(bd).has_value());
+        CHECK(cache.getMissCount() == 1);
+
+        cache.insert(bd, 0, std::vector<ReferenceDescription>(2));
+        CHECK(cache.size() == 1);
+        CHECK(cache.find(bd).value().size() == 2);
+        CHECK(cache.getHitCount() == 1);
+
+        // different browse description or limit
+        CHECK_FALSE(cache.find({ObjectId::ObjectsFolder, BrowseDirection::Inverse}).has_value());
+        CHECK_FALSE(cache.find(bd, 1).has_value());
+
+        cache.insert(bd, 0, std::vector<ReferenceDescription>(3));
+        CHECK(cache.size() == 1);
+        CHECK(cache.find(bd).value().size() == 3);
+
+        cache.invalidate(ObjectId::ObjectsFolder);
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Time to live") {
+        BrowseCache cache(1ms);
+        cache.insert(bd, 0, {});
+        std::this_thread::sleep_for(5ms);
+        CHECK_FALSE(cache.find(bd).has_value());
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Model change event") {
+        BrowseCache cache;
+        cache.insert(bd, 0, {});
+        cache.insert({ObjectId::Server, BrowseDirection::Forward}, 0, {});
+
+        UA_ModelChangeStructureDataType change{};
+        change.affected = UA_NODEID_NUMERIC(0, UA_NS0ID_SERVER);
+        change.verb = 0x10;  // DataTypeChanged
+        std::vector<Variant> eventFields(1);
+        eventFields[0].setArray(
+            Span(&change, 1), UA_TYPES[UA_TYPES_MODELCHANGESTRUCTUREDATATYPE]
+        );
+        cache.handleModelChangeEvent(eventFields);
+        CHECK(cache.size() == 1);
+
+        // inverse references of the (unreported) target node change as well
+        cache.insert({ObjectId::Server, BrowseDirection::Forward}, 0, {});
+        change.verb = 0x04;  // ReferenceAdded
+        cache.handleModelChangeEvent(eventFields);
+        CHECK(cache.size() == 0);
+
+        cache.insert(bd, 0, {});
+        change.verb = 0x01;  // NodeAdded
+        cache.handleModelChangeEvent(eventFields);
+        CHECK(cache.size() == 0);
+
+        cache.insert(bd, 0, {});
+        cache.handleModelChangeEvent({});
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Client") {
+        Server server;
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect("opc.tcp://localhost:4840");
+
+        auto cache = std::make_shared<BrowseCache>();
+        client.setBrowseCache(cache);
+        CHECK(client.getBrowseCache() == cache);
+
+        const auto refs = client.getObjectsNode().browseReferences();
+        CHECK(cache.use_count() == 2);
+        CHECK(cache->size() == 1);
+        CHECK(cache->getMissCount() == 1);
+        CHECK(client.getObjectsNode().browseReferences().size() == refs.size());
+        CHECK(cache->getHitCount() == 1);
+
+        // cache is not invalidated automatically without model change events
+        server.getObjectsNode().addObject({1, 1000}, "Object");
+        CHECK(client.getObjectsNode().browseReferences().size() == refs.size());
+        cache->clear();
+        CHECK(client.getObjectsNode().browseReferences().size() == refs.size() + 1);
+
+        client.setBrowseCache(nullptr);
+        CHECK(client.getBrowseCache() == nullptr);
+    }
+}
+
+TEST_CASE("NodeAttributeCache") {
+    SUBCASE("Find and insert") {
+        NodeAttributeCache cache;
+        CHECK(NodeAttributeCache::isCached(AttributeId::DisplayName));
+        CHECK_FALSE(NodeAttributeCache::isCached(AttributeId::Value));
+        CHECK_FALSE(NodeAttributeCache::isCached(AttributeId::UserAccessLevel));
+
+        const NodeId id(1, 1000);
+        CHECK_FALSE(cache.find(id, AttributeId::DisplayName).has_value());
+        std::vector<DataValue> values(NodeAttributeCache::getCachedAttributes().size());
+        values[1] = DataValue(Variant::fromScalar(QualifiedName(1, "Node")));
+        values[2].setStatusCode(UA_STATUSCODE_BADATTRIBUTEIDINVALID);
+        values[3].setStatusCode(UA_STATUSCODE_BADCONNECTIONCLOSED);
+        cache.insert(id, values);
+        CHECK(cache.size() == 1);
+        CHECK(cache.find(id, AttributeId::BrowseName)->getValue().getScalar<QualifiedName>() ==
+              QualifiedName(1, "Node"));
+        CHECK(cache.find(id, AttributeId::DisplayName)->getStatusCode().get() ==
+              UA_STATUSCODE_BADATTRIBUTEIDINVALID);
+        CHECK_FALSE(cache.find(id, AttributeId::Description).has_value());  // transient error
+        CHECK(cache.getHitCount() == 2);
+        CHECK(cache.getMissCount() == 2);
+        cache.invalidate(id);
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Client") {
+        Server server;
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect("opc.tcp://localhost:4840");
+
+        const NodeId id(1, 1000);
+        server.getObjectsNode().addVariable(id, "Variable");
+        server.getObjectsNode().addObject({1, 1001}, "Object");
+
+        auto cache = std::make_shared<NodeAttributeCache>();
+        client.setAttributeCache(cache);
+        CHECK(client.getAttributeCache() == cache);
+
+        auto node = client.getNode(id);
+        CHECK(node.readBrowseName() == QualifiedName(1, "Variable"));
+        CHECK(cache->size() == 1);
+        CHECK(cache->getMissCount() == 1);
+        CHECK(node.readNodeClass() == NodeClass::Variable);
+        CHECK(node.readValueRank() == ValueRank::Any);
+        CHECK_THROWS_WITH(node.readIsAbstract(), "BadAttributeIdInvalid");
+        CHECK(cache->getHitCount() == 3);
+
+        // not invalidated by server-side changes
+        server.getNode(id).writeDisplayName({"", "Server"});
+        CHECK(node.readDisplayName().getText() == "Variable");
+        // invalidated by client writes
+        node.writeDisplayName({"", "Client"});
+        CHECK(node.readDisplayName().getText() == "Client");
+
+        // prefetch a browse result with a single call
+        cache->clear();
+        const auto refs = client.getObjectsNode().browseReferences(
+            BrowseDirection::Forward, ReferenceTypeId::HierarchicalReferences
+        );
+        cache->prefetch(client, refs);
+        CHECK(cache->size() == refs.size());
+        const auto misses = cache->getMissCount();
+        CHECK(client.getNode({1, 1001}).readNodeClass() == NodeClass::Object);
+        CHECK(cache->getMissCount() == misses);
+
+        // unknown nodes are not cached
+        CHECK_THROWS(client.getNode({1, 9999}).readDisplayName());
+        CHECK(cache->size() == refs.size());
+
+        client.setAttributeCache(nullptr);
+        CHECK(client.getAttributeCache() == nullptr);
+    }
+}
+
+TEST_CASE("BrowsePathCache") {
+    const SimplifiedBrowsePath path{ObjectId::ObjectsFolder, {{2, "Device"}, {2, "Value"}}};
+
+    SUBCASE("Find and insert") {
+        BrowsePathCache cache;
+        CHECK_FALSE(cache.find(path).has_value());
+        cache.insert(path, {2, 1000});
+        CHECK(cache.size() == 1);
+        CHECK(cache.find(path).value() == NodeId(2, 1000));
+        CHECK_FALSE(cache.find({ObjectId::ObjectsFolder, {{2, "Device"}}}).has_value());
+        cache.clear();
+        CHECK(cache.size() == 0);
+    }
+
+    SUBCASE("Revalidate") {
+        BrowsePathCache cache;
+        cache.revalidate(std::vector<std::string>{"ns0", "ns1", "ns2", "ns3"});
+        cache.insert(path, {2, 1000});
+        cache.insert({ObjectId::ObjectsFolder, {{3, "Other"}}}, {3, 1000});
+
+        // ns2 moved to index 1, ns3 removed
+        cache.revalidate(std::vector<std::string>{"ns0", "ns2"});
+        CHECK(cache.size() == 1);
+        CHECK(cache.getNamespaceArray().size() == 2);
+        const SimplifiedBrowsePath remapped{ObjectId::ObjectsFolder, {{1, "Device"}, {1, "Value"}}};
+        CHECK(cache.find(remapped).value() == NodeId(1, 1000));
+    }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    SUBCASE("Save and load") {
+        BrowsePathCache cache;
+        cache.revalidate(std::vector<std::string>{"ns0", "ns1", "ns2"});
+        cache.insert(path, {2, 1000});
+        cache.insert({ObjectId::Server, {}}, ObjectId::Server);
+
+        std::stringstream stream;
+        cache.save(stream);
+        const auto loaded = BrowsePathCache::load(stream);
+        CHECK(loaded.size() == 2);
+        CHECK(loaded.getNamespaceArray() == cache.getNamespaceArray());
+        CHECK(loaded.find(path).value() == NodeId(2, 1000));
+
+        std::istringstream invalid("UAPPBPC1");
+        CHECK_THROWS_WITH(BrowsePathCache::load(invalid), "BadDecodingError");
+    }
+#endif
+
+    SUBCASE("Resolve") {
+        Server server;
+        const auto ns = server.registerNamespace("http://example.com/");
+        server.getObjectsNode().addObject({ns, 1000}, "Device").addVariable({ns, 1001}, "Value");
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect("opc.tcp://localhost:4840");
+
+        const std::vector<SimplifiedBrowsePath> paths{
+            {ObjectId::ObjectsFolder, {{ns, "Device"}, {ns, "Value"}}},
+            {ObjectId::ObjectsFolder, {{ns, "Unknown"}}},
+        };
+        BrowsePathCache cache;
+        const auto ids = resolveBrowsePaths(client, paths, cache);
+        CHECK(ids.size() == 2);
+        CHECK(ids[0] == NodeId(ns, 1001));
+        CHECK(ids[1].isNull());
+        CHECK(cache.size() == 1);  // unresolved paths are not cached
+        CHECK(cache.getNamespaceArray() == client.getNamespaceArray());
+
+        // served from cache
+        cache.insert(paths[0], {ns, 2000});
+        CHECK(resolveBrowsePaths(client, paths, cache)[0] == NodeId(ns, 2000));
+    }
+}
@@ -1,12 +1,37 @@
+#include <algorithm>  // all_of, equal, fill, find_if, remove_if
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <string_view>
 #include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <arpa/inet.h>  // htonl, htons
+#include <netinet/in.h>
+#include <netinet/tcp.h>  // TCP_NODELAY
+#include <poll.h>
+#include <sys/socket.h>
+#include <unistd.h>  // close
+#endif
 
 #include <doctest/doctest.h>
 
 #include "open62541pp/AccessControl.h"
 #include "open62541pp/Client.h"
+#include "open62541pp/ClientFarm.h"
+#include "open62541pp/ClientPool.h"
+#include "open62541pp/Discovery.h"
+#include "open62541pp/NamespaceTable.h"
+#include "open62541pp/Node.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/WriteCoalescer.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
 
 #include "open62541_impl.h"
 
@@ -124,6 +149,125 @@ TEST_CASE("Client run/stop") {
     CHECK_FALSE(client.isRunning());
 }
 
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+TEST_CASE("Client in-process connection") {
+    AccessControlDefault accessControl(true, {{"username", "password"}});
+    Server server;
+    server.setAccessControl(accessControl);
+    const NodeId id{1, 1000};
+    services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    services::writeValue(server, id, Variant::fromScalar(11.11));
+    ServerRunner serverRunner(server);
+    Client client;
+
+    SUBCASE("Read and write") {
+        client.connect(server);
+        CHECK(client.isConnected());
+        CHECK(client.getSocketFd() == -1);
+        CHECK(services::readValue(client, id).getScalarCopy<double>() == 11.11);
+        services::writeValue(client, id, Variant::fromScalar(22.22));
+        CHECK(services::readValue(server, id).getScalarCopy<double>() == 22.22);
+        CHECK(server.getSessions().size() == 1);
+        client.disconnect();
+        CHECK_FALSE(client.isConnected());
+    }
+
+    SUBCASE("Login") {
+        CHECK_THROWS(client.connect(server, {"username", "wrong"}));
+        client.connect(server, {"username", "password"});
+        CHECK(client.isConnected());
+    }
+
+    SUBCASE("Multiple clients") {
+        std::vector<Client> clients(5);
+        for (auto& c : clients) {
+            c.connect(server);
+        }
+        for (auto& c : clients) {
+            CHECK(services::readValue(c, id).getScalarCopy<double>() == 11.11);
+        }
+    }
+}
+#endif
+
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3) && defined(__linux__)
+TEST_CASE("Client in-process connection latency") {
+    Server server;
+    server.setLogger({});
+    server.setNetworkBackend(NetworkBackend::Epoll);
+    // messages must wake up the network thread, not wait for the command interval
+    server.runInBackground(1000);
+    Client client;
+
+    const auto start = std::chrono::steady_clock::now();
+    client.connect(server);
+    for (int i = 0; i < 10; ++i) {
+        services::readValue(client, {0, UA_NS0ID_SERVER_SERVERSTATUS_STATE});
+    }
+    CHECK(std::chrono::steady_clock::now() - start < 500ms);
+
+    client.disconnect();
+    server.stop();
+}
+#endif
+
+#if UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3) && !defined(_WIN32)
+TEST_CASE("Client external polling") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    CHECK(client.getSocketFd() == -1);
+
+    client.connect(localServerUrl);
+    const int fd = client.getSocketFd();
+    CHECK(fd >= 0);
+    CHECK(client.getNextTimeout() <= 1000ms);
+
+    auto future = services::readAttributeAsync(
+        client, {0, UA_NS0ID_SERVER_SERVERSTATUS_STATE}, AttributeId::Value
+    );
+    for (size_t i = 0; i < 100; ++i) {
+        if (future.wait_for(0ms) == std::future_status::ready) {
+            break;
+        }
+        pollfd pfd{fd, POLLIN, 0};
+        ::poll(&pfd, 1, static_cast<int>(client.getNextTimeout().count()));
+        client.processEvents();  // doesn't block
+    }
+    REQUIRE(future.wait_for(0ms) == std::future_status::ready);
+    CHECK(future.get().getValue().isScalar());
+
+    client.disconnect();
+    CHECK(client.getSocketFd() == -1);
+}
+
+TEST_CASE("Client socket options") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    TransportConfig transport;
+    transport.noDelay = false;
+    transport.socketSendBufferSize = 1 << 18;
+    client.setTransportConfig(transport);
+    transport = {};
+    transport.socketRecvBufferSize = 1 << 18;
+    client.setTransportConfig(transport);  // merged with the previous socket options
+
+    client.connect(localServerUrl);
+    const int fd = client.getSocketFd();
+    REQUIRE(fd >= 0);
+    const auto getOption = [&](int level, int name) {
+        int value = 0;
+        socklen_t length = sizeof(value);
+        REQUIRE(::getsockopt(fd, level, name, &value, &length) == 0);
+        return value;
+    };
+    CHECK(getOption(IPPROTO_TCP, TCP_NODELAY) == 0);
+    CHECK(getOption(SOL_SOCKET, SO_SNDBUF) >= 1 << 18);  // doubled by Linux
+    CHECK(getOption(SOL_SOCKET, SO_RCVBUF) >= 1 << 18);
+}
+#endif
+
 TEST_CASE("Client state callbacks") {
     Server server;
     ServerRunner serverRunner(server);
@@ -170,6 +314,29 @@ TEST_CASE("Client configuration") {
         client.setTimeout(333);
         CHECK(config->timeout == 333);
     }
+
+    SUBCASE("Set transport config") {
+        const auto maxChunkCount = config->localConnectionConfig.localMaxChunkCount;
+        TransportConfig transport;
+        transport.sendBufferSize = 1 << 20;
+        transport.recvBufferSize = 1 << 20;
+        transport.maxMessageSize = 0;
+        client.setTransportConfig(transport);
+        CHECK(config->localConnectionConfig.sendBufferSize == 1 << 20);
+        CHECK(config->localConnectionConfig.recvBufferSize == 1 << 20);
+        CHECK(config->localConnectionConfig.localMaxMessageSize == 0);
+        CHECK(config->localConnectionConfig.localMaxChunkCount == maxChunkCount);  // unchanged
+    }
+
+    SUBCASE("Set secure channel options") {
+        SecureChannelOptions options;
+        options.chunkSize = 1 << 20;
+        options.lifetime = 60'000;
+        client.setSecureChannelOptions(options);
+        CHECK(config->localConnectionConfig.sendBufferSize == 1 << 20);
+        CHECK(config->localConnectionConfig.recvBufferSize == 1 << 20);
+        CHECK(config->secureChannelLifeTime == 60'000);
+    }
 }
 
 TEST_CASE("Client methods") {
@@ -184,4 +351,592 @@ TEST_CASE("Client methods") {
         CHECK(namespaces.at(0) == "http://opcfoundation.org/UA/");
         CHECK(namespaces.at(1) == "urn:open62541.server.application");
     }
+
+    SUBCASE("Namespace table") {
+        const auto table = client.getNamespaceTable();
+        CHECK(table->getUris() == client.getNamespaceArray());
+        CHECK(table->find("urn:open62541.server.application") == 1);
+        CHECK(client.getNamespaceTable() == table);  // cached
+    }
+
+    SUBCASE("Register hot nodes") {
+        const NodeId id{1, "Hot"};
+        server.getObjectsNode().addVariable(id, "Hot").writeValueScalar<int32_t>(1);
+        const std::vector<NodeId> ids{id};
+        client.registerHotNodes(ids);
+
+        auto node = client.getNode(id);
+        node.writeValueScalar<int32_t>(2);
+        CHECK(node.readValueScalar<int32_t>() == 2);
+        CHECK(services::readValues(client, ids).at(0).getValue().getScalar<int32_t>() == 2);
+
+        // registered again after reconnect
+        client.disconnect();
+        client.connect(localServerUrl);
+        CHECK(node.readValueScalar<int32_t>() == 2);
+
+        client.unregisterHotNodes(ids);
+        CHECK(node.readValueScalar<int32_t>() == 2);
+    }
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 1) && !defined(_WIN32)
+/// TCP proxy to a local server, counts the GetEndpoints requests of unencrypted connections.
+class GetEndpointsCountingProxy {
+public:
+    GetEndpointsCountingProxy(uint16_t port, uint16_t serverPort)
+        : serverPort_(serverPort) {
+        listenFd_ = ::socket(AF_INET, SOCK_STREAM, 0);
+        const int one = 1;
+        ::setsockopt(listenFd_, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(port);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        REQUIRE(::bind(listenFd_, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0);  // NOLINT
+        REQUIRE(::listen(listenFd_, 8) == 0);
+        thread_ = std::thread([this] { run(); });
+    }
+
+    ~GetEndpointsCountingProxy() {
+        stop_ = true;
+        thread_.join();
+        ::close(listenFd_);
+    }
+
+    GetEndpointsCountingProxy(const GetEndpointsCountingProxy&) = delete;
+    GetEndpointsCountingProxy(GetEndpointsCountingProxy&&) noexcept = delete;
+    GetEndpointsCountingProxy& operator=(const GetEndpointsCountingProxy&) = delete;
+    GetEndpointsCountingProxy& operator=(GetEndpointsCountingProxy&&) noexcept = delete;
+
+    size_t getEndpointsRequests() const noexcept {
+        return getEndpointsRequests_;
+    }
+
+private:
+    struct Link {
+        int client;
+        int server;
+        std::vector<uint8_t> request;  // received bytes of the current client message
+    };
+
+    void accept(std::vector<Link>& links) {
+        const int client = ::accept(listenFd_, nullptr, nullptr);
+        const int server = ::socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in addr{};
+        addr.sin_family = AF_INET;
+        addr.sin_port = htons(serverPort_);
+        addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        if (::connect(server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {  // NOLINT
+            ::close(client);
+            ::close(server);
+            return;
+        }
+        links.push_back({client, server, {}});
+    }
+
+    /// Count the GetEndpoints requests (type id ns=0;i=428) of the complete client messages.
+    void inspect(Link& link) {
+        auto& buf = link.request;
+        while (buf.size() >= 8) {
+            const size_t size = buf[4] | (buf[5] << 8) | (buf[6] << 16) | (buf[7] << 24);
+            if (size < 8 || buf.size() < size) {
+                break;
+            }
+            // MSG header (24 bytes) followed by the type id in four byte encoding
+            if (std::equal(buf.begin(), buf.begin() + 3, "MSG") && size >= 28 && buf[24] == 1 &&
+                buf[25] == 0 && (buf[26] | (buf[27] << 8)) == 428) {
+                ++getEndpointsRequests_;
+            }
+            buf.erase(buf.begin(), buf.begin() + static_cast<std::ptrdiff_t>(size));
+        }
+    }
+
+    /// Forward the available data, false if the connection is closed.
+    bool forward(Link& link, bool fromClient) {
+        std::array<uint8_t, 4096> data{};
+        const ssize_t n = ::recv(fromClient ? link.client : link.server, data.data(), data.size(), 0);
+        if (n <= 0) {
+            return false;
+        }
+        if (fromClient) {
+            link.request.insert(link.request.end(), data.begin(), data.begin() + n);
+            inspect(link);
+        }
+        const int to = fromClient ? link.server : link.client;
+        return ::send(to, data.data(), static_cast<size_t>(n), MSG_NOSIGNAL) == n;
+    }
+
+    void run() {
+        std::vector<Link> links;
+        std::vector<pollfd> fds;
+        while (!stop_) {
+            fds.assign(1, {listenFd_, POLLIN, 0});
+            for (const auto& link : links) {
+                fds.push_back({link.client, POLLIN, 0});
+                fds.push_back({link.server, POLLIN, 0});
+            }
+            if (::poll(fds.data(), fds.size(), 10) <= 0) {
+                continue;
+            }
+            for (size_t i = 0; i < links.size(); ++i) {
+                const auto& clientFd = fds[1 + 2 * i];
+                const auto& serverFd = fds[2 + 2 * i];
+                bool open = true;
+                if (clientFd.revents != 0) {
+                    open = forward(links[i], true);
+                }
+                if (open && serverFd.revents != 0) {
+                    open = forward(links[i], false);
+                }
+                if (!open) {
+                    ::close(links[i].client);
+                    ::close(links[i].server);
+                    links[i].client = -1;
+                }
+            }
+            links.erase(
+                std::remove_if(
+                    links.begin(), links.end(), [](const Link& link) { return link.client < 0; }
+                ),
+                links.end()
+            );
+            if ((fds[0].revents & POLLIN) != 0) {
+                accept(links);
+            }
+        }
+        for (const auto& link : links) {
+            ::close(link.client);
+            ::close(link.server);
+        }
+    }
+
+    uint16_t serverPort_;
+    int listenFd_{-1};
+    std::atomic<bool> stop_{false};
+    std::atomic<size_t> getEndpointsRequests_{0};
+    std::thread thread_;
+};
+#endif
+
+TEST_CASE("Client endpoint cache") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.setEndpointCaching(true);
+
+    const auto endpoints = client.getEndpoints(localServerUrl);
+    CHECK(!endpoints.empty());
+    CHECK(client.getEndpoints(localServerUrl).size() == endpoints.size());
+
+    for (int i = 0; i < 3; ++i) {
+        client.connect(localServerUrl);
+        CHECK(client.isConnected());
+        client.disconnect();
+    }
+
+#if UAPP_OPEN62541_VER_GE(1, 1) && !defined(_WIN32)
+    SUBCASE("Reconnects skip GetEndpoints") {
+        GetEndpointsCountingProxy proxy(4850, 4840);
+        const std::string proxyUrl = "opc.tcp://localhost:4850";
+        client.connect(proxyUrl);
+        CHECK(proxy.getEndpointsRequests() == 1);
+        client.disconnect();
+        client.connect(proxyUrl);  // preselected endpoint of the cache
+        CHECK(client.isConnected());
+        CHECK(proxy.getEndpointsRequests() == 1);
+        client.disconnect();
+    }
+
+    SUBCASE("Endpoint selected in the client config is kept") {
+        GetEndpointsCountingProxy proxy(4850, 4840);
+        const std::string proxyUrl = "opc.tcp://localhost:4850";
+        Client configured;  // select the endpoint before the cache is used
+        configured.setEndpointCaching(true);
+        const auto& endpoint = endpoints.at(0);
+        const auto tokens = endpoint.getUserIdentityTokens();
+        const auto anonymous = std::find_if(tokens.begin(), tokens.end(), [](const auto& token) {
+            return token.getTokenType() == UserTokenType::Anonymous;
+        });
+        REQUIRE(anonymous != tokens.end());
+        auto* config = UA_Client_getConfig(configured.handle());
+        UA_EndpointDescription_clear(&config->endpoint);
+        UA_EndpointDescription_copy(endpoint.handle(), &config->endpoint);
+        UA_UserTokenPolicy_clear(&config->userTokenPolicy);
+        UA_UserTokenPolicy_copy(anonymous->handle(), &config->userTokenPolicy);
+
+        // cache misses use the configured endpoint instead of requesting the endpoints
+        configured.connect(proxyUrl);
+        CHECK(configured.isConnected());
+        CHECK(proxy.getEndpointsRequests() == 0);
+        configured.disconnect();
+        configured.clearEndpointCache();
+        configured.connect(proxyUrl);
+        CHECK(proxy.getEndpointsRequests() == 0);
+        configured.disconnect();
+    }
+#endif
+
+    client.clearEndpointCache();
+    client.setEndpointCaching(false);
+    client.connect(localServerUrl);
+    CHECK(client.isConnected());
+}
+
+TEST_CASE("Discovery") {
+    Server server;
+    ServerRunner serverRunner(server);
+    const std::vector<std::string> urls{
+        std::string(localServerUrl),
+        "opc.tcp://localhost:4999",  // unreachable
+        std::string(localServerUrl),
+    };
+
+    SUBCASE("Concurrent requests with cache") {
+        auto cache = std::make_shared<DiscoveryCache>(
+            std::chrono::minutes(1), std::chrono::minutes(1)
+        );
+        Discovery discovery({2, 1000}, cache);
+        CHECK(discovery.getCache() == cache);
+
+        const auto endpoints = discovery.getEndpoints(urls);
+        CHECK(endpoints.size() == 3);
+        CHECK(endpoints[0].hasValue());
+        CHECK(endpoints[0]->size() == 1);
+        CHECK(endpoints[1].code().isBad());
+        CHECK(endpoints[2]->size() == 1);
+        CHECK(cache->size() == 2);
+        CHECK(cache->getMissCount() == 3);
+
+        // served from the cache, incl. the failure
+        const auto cached = discovery.getEndpoints(urls);
+        CHECK(cache->getHitCount() == 3);
+        CHECK(cached[0]->size() == 1);
+        CHECK(cached[1].code() == endpoints[1].code());
+
+        const auto servers = discovery.findServers(urls);
+        CHECK(servers[0]->size() == 1);
+        CHECK(servers[1].code().isBad());
+
+        cache->invalidate(urls[1]);
+        CHECK(cache->size() == 1);
+        cache->clear();
+        CHECK(cache->size() == 0);
+    }
+
+    SUBCASE("Failures are not cached by default") {
+        Discovery discovery({2, 1000});
+        CHECK(discovery.getEndpoints(urls)[1].code().isBad());
+        CHECK(discovery.getCache()->size() == 1);
+    }
+
+    SUBCASE("Client with discovery cache") {
+        auto cache = std::make_shared<DiscoveryCache>();
+        Client client;
+        client.setDiscoveryCache(cache);
+        CHECK(client.getDiscoveryCache() == cache);
+
+        const auto endpoints = client.getEndpoints(localServerUrl);
+        CHECK(endpoints.size() == 1);
+        CHECK(client.getEndpoints(localServerUrl).size() == 1);
+        CHECK(client.findServers(localServerUrl).size() == 1);
+        CHECK(cache->getHitCount() == 1);
+
+        // shared with discovery
+        Discovery discovery({1, 1000}, cache);
+        CHECK(discovery.getEndpoints(Span<const std::string>(urls.data(), 1))[0]->size() == 1);
+        CHECK(cache->getHitCount() == 2);
+    }
+}
+
+TEST_CASE("ClientFarm") {
+    Server server;
+    server.getObjectsNode().addVariable({1, 1000}, "variable").writeValueScalar(11);
+    ServerRunner serverRunner(server);
+
+    ClientFarmOptions options;
+    options.threads = 2;
+    options.reconnect.initialDelay = 50ms;
+    ClientFarm farm(options, [](const ClientFarmEndpoint&) {
+        auto client = std::make_unique<Client>();
+        client->setTimeout(1000);
+        return client;
+    });
+
+    std::mutex mutex;
+    std::vector<size_t> received(5, 0);
+    farm.setSink([&](Span<ClientFarmResult> results) {
+        const std::lock_guard lock(mutex);  // serialized anyway
+        for (const auto& result : results) {
+            if (result.status.isGood() && result.values.size() == 1 &&
+                result.values[0].getValue().getScalarCopy<int>() == 11) {
+                ++received.at(result.endpoint);
+            }
+        }
+    });
+
+    const std::vector<ReadValueId> items{ReadValueId({1, 1000}, AttributeId::Value)};
+    for (size_t i = 0; i < 4; ++i) {
+        CHECK(farm.addEndpoint({std::string(localServerUrl), std::nullopt, items, 10ms}) == i);
+    }
+    // unreachable endpoint must not block the others
+    farm.addEndpoint({"opc.tcp://localhost:4999", std::nullopt, items, 10ms});
+    CHECK(farm.size() == 5);
+
+    farm.start();
+    CHECK(farm.isRunning());
+    CHECK_THROWS_WITH(farm.addEndpoint({}), "BadInvalidState");
+
+    for (size_t i = 0; i < 500 && farm.getConnectedCount() < 4; ++i) {
+        std::this_thread::sleep_for(10ms);
+    }
+    std::this_thread::sleep_for(200ms);
+    farm.stop();
+
+    CHECK_FALSE(farm.isRunning());
+    for (size_t i = 0; i < 4; ++i) {
+        CHECK(received[i] > 1);
+    }
+    CHECK(received[4] == 0);
+    CHECK(farm.getState(4) == ClientFarmState::Disconnected);
+}
+
+TEST_CASE("ClientPool") {
+    Server server;
+    const size_t nodeCount = 20;
+    std::vector<NodeId> ids;
+    for (size_t i = 0; i < nodeCount; ++i) {
+        const NodeId id(1, static_cast<uint32_t>(1000 + i));
+        server.getObjectsNode().addVariable(id, "variable").writeValueScalar(0);
+        ids.push_back(id);
+    }
+    ServerRunner serverRunner(server);
+
+    ClientPool pool(3);
+    CHECK(pool.size() == 3);
+    pool.setTimeout(5000);
+    pool.connect(localServerUrl);
+    for (size_t i = 0; i < pool.size(); ++i) {
+        CHECK(pool.getClient(i).isConnected());
+    }
+
+    SUBCASE("Submit") {
+        auto future = pool.submit([](Client& client) { return client.getNamespaceArray(); });
+        CHECK(future.get().size() >= 1);
+    }
+
+    SUBCASE("Submit with exception") {
+        auto future = pool.submit([](Client& client) {
+            return services::readValue(client, {1, 999}).getScalarCopy<int>();
+        });
+        CHECK_THROWS_AS(future.get(), BadStatus);
+    }
+
+    SUBCASE("Batched read and write") {
+        std::vector<Variant> values;
+        for (size_t i = 0; i < nodeCount; ++i) {
+            values.push_back(Variant::fromScalar(static_cast<int>(i)));
+        }
+        const auto statusCodes = pool.writeValues(ids, values);
+        CHECK(statusCodes.size() == nodeCount);
+        CHECK(std::all_of(statusCodes.begin(), statusCodes.end(), [](auto code) {
+            return code.isGood();
+        }));
+
+        const auto results = pool.readValues(ids);
+        REQUIRE(results.size() == nodeCount);
+        for (size_t i = 0; i < nodeCount; ++i) {
+            CHECK(results[i].getValue().getScalarCopy<int>() == static_cast<int>(i));
+        }
+    }
+
+    SUBCASE("Write with size mismatch") {
+        CHECK_THROWS_AS(pool.writeValues(ids, {}), BadStatus);
+    }
+}
+
+TEST_CASE("Client with background event loop") {
+    Server server;
+    const size_t threadCount = 4;
+    for (size_t i = 0; i < threadCount; ++i) {
+        server.getObjectsNode()
+            .addVariable({1, static_cast<uint32_t>(1000 + i)}, "variable")
+            .writeValueScalar(0);
+    }
+    ServerRunner serverRunner(server);
+
+    Client client;
+    client.connect(localServerUrl);
+    client.runInBackground();
+    CHECK(client.isRunning());
+    CHECK_THROWS_AS(client.runIterate(), BadStatus);
+
+    std::vector<std::thread> threads;
+    std::vector<int> results(threadCount, 0);  // not vector<bool>, written concurrently
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i] {
+            const NodeId id(1, static_cast<uint32_t>(1000 + i));
+            bool ok = true;
+            for (int value = 1; value <= 50; ++value) {
+                services::writeValue(client, id, Variant::fromScalar(value));
+                ok &= services::readValue(client, id).getScalarCopy<int>() == value;
+            }
+            results[i] = ok ? 1 : 0;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(std::all_of(results.begin(), results.end(), [](int ok) { return ok != 0; }));
+
+    // registered node aliases are replaced while other threads use them
+    threads.clear();
+    std::fill(results.begin(), results.end(), 0);
+    for (size_t i = 0; i < threadCount; ++i) {
+        threads.emplace_back([&, i] {
+            const std::vector<NodeId> ids{NodeId(1, static_cast<uint32_t>(1000 + i))};
+            bool ok = true;
+            for (int value = 1; value <= 50; ++value) {
+                client.registerHotNodes(ids);
+                services::writeValue(client, ids[0], Variant::fromScalar(value));
+                ok &= services::readValues(client, ids).at(0).getValue().getScalarCopy<int>() ==
+                      value;
+                client.unregisterHotNodes(ids);
+            }
+            results[i] = ok ? 1 : 0;
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    CHECK(std::all_of(results.begin(), results.end(), [](int ok) { return ok != 0; }));
+
+    client.stop();
+    CHECK_FALSE(client.isRunning());
+    // synchronous requests after the background loop, from the calling thread
+    CHECK(services::readValue(client, {1, 1000}).getScalarCopy<int>() == 50);
+}
+
+TEST_CASE("WriteCoalescer") {
+    Server server;
+    const NodeId id{1, 1000};
+    server.getObjectsNode().addVariable(id, "variable").writeValueScalar(0);
+    ServerRunner serverRunner(server);
+
+    Client client;
+    client.connect(localServerUrl);
+
+    SUBCASE("Coalesce writes of the same node") {
+        WriteCoalescer coalescer(std::chrono::seconds(10));
+        auto future1 = coalescer.write(id, DataValue::fromScalar(1));
+        auto future2 = coalescer.write(id, DataValue::fromScalar(2));
+        auto future3 = coalescer.write(id, DataValue::fromScalar(3));
+        CHECK(coalescer.getPendingCount() == 1);
+        CHECK(coalescer.getWriteCount() == 3);
+        CHECK(coalescer.getCoalescedCount() == 2);
+
+        CHECK(coalescer.flush(client) == 1);
+        CHECK(coalescer.getPendingCount() == 0);
+        CHECK(coalescer.getRequestCount() == 1);
+        for (size_t i = 0; i < 500 && future3.wait_for(0s) != std::future_status::ready; ++i) {
+            client.runIterate(10);
+        }
+        REQUIRE(future3.wait_for(0s) == std::future_status::ready);
+        CHECK_NOTHROW(future1.get());  // superseded, completed with the last write
+        CHECK_NOTHROW(future2.get());
+        CHECK_NOTHROW(future3.get());
+        CHECK(services::readValue(client, id).getScalarCopy<int>() == 3);
+
+        // rate limited
+        coalescer.write(id, DataValue::fromScalar(4), {});
+        CHECK(coalescer.flushIfDue(client) == 0);
+        CHECK(coalescer.getNextFlush() > 0s);
+    }
+
+    SUBCASE("Attached to client") {
+        auto coalescer = std::make_shared<WriteCoalescer>(WriteCoalescer::Clock::duration::zero());
+        std::vector<StatusCode> errors;
+        coalescer->setErrorCallback([&](const NodeId&, StatusCode status) {
+            errors.push_back(status);
+        });
+        client.setWriteCoalescer(coalescer);
+        CHECK(client.getWriteCoalescer() == coalescer);
+
+        Node node(client, id);
+        for (int value = 1; value <= 10; ++value) {
+            node.writeValueScalar(value);  // enqueued
+        }
+        services::writeValue(client, {1, 9999}, Variant::fromScalar(0));  // unknown node
+        CHECK(coalescer->getPendingCount() == 2);
+
+        client.runIterate(0);  // flush
+        CHECK(coalescer->getPendingCount() == 0);
+        CHECK(coalescer->getRequestCount() == 1);
+        for (int i = 0; i < 100 && errors.empty(); ++i) {
+            client.runIterate(10);
+        }
+        CHECK(errors == std::vector<StatusCode>{UA_STATUSCODE_BADNODEIDUNKNOWN});
+        CHECK(node.readValueScalar<int>() == 10);
+    }
+}
+
+TEST_CASE("PollGroup") {
+    Server server;
+    const NodeId id{1, 1000};
+    server.getObjectsNode().addVariable(id, "variable").writeValueScalar(1.0);
+    ServerRunner serverRunner(server);
+
+    Client client;
+    client.connect(localServerUrl);
+    Node node(client, id);
+
+    PollGroupParameters parameters{};
+    parameters.interval = 10.0;
+    auto pollGroup = client.createPollGroup(parameters);
+    CHECK(client.getPollGroups() == std::vector<PollGroup>{pollGroup});
+    CHECK(pollGroup.getParameters().interval == 10.0);
+
+    std::vector<double> values;
+    std::vector<uint32_t> itemIds;
+    services::ClientDataChangeFilter filter{};
+    filter.absoluteDeadband = 0.5;
+    const uint32_t itemId = pollGroup.addItem(
+        id,
+        [&](uint32_t pollGroupId, uint32_t monId, const DataValue& dv) {
+            CHECK(pollGroupId == pollGroup.getPollGroupId());
+            itemIds.push_back(monId);
+            values.push_back(dv.getValue().getScalarCopy<double>());
+        },
+        filter
+    );
+    CHECK(pollGroup.getItemIds() == std::vector<uint32_t>{itemId});
+
+    const auto runFor = [&](std::chrono::milliseconds duration) {
+        const auto end = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < end) {
+            client.runIterate(5);
+        }
+    };
+
+    runFor(100ms);
+    CHECK(values == std::vector<double>{1.0});  // unchanged values discarded
+    CHECK(itemIds == std::vector<uint32_t>{itemId});
+    CHECK(client.getNextTimeout() <= 10ms);
+
+    node.writeValueScalar(1.2);  // within deadband
+    runFor(100ms);
+    CHECK(values.size() == 1);
+
+    node.writeValueScalar(2.0);
+    runFor(100ms);
+    CHECK(values == std::vector<double>{1.0, 2.0});
+
+    pollGroup.removeItem(itemId);
+    node.writeValueScalar(3.0);
+    runFor(100ms);
+    CHECK(values.size() == 2);
+
+    pollGroup.deletePollGroup();
+    CHECK(client.getPollGroups().empty());
+    CHECK_THROWS_AS(pollGroup.getParameters(), BadStatus);
 }
@@ -1,4 +1,5 @@
 #include <string>
+#include <vector>
 
 #include <doctest/doctest.h>
 
@@ -6,6 +7,8 @@
 #include "open62541pp/Config.h"
 #include "open62541pp/Crypto.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
 
 #include "open62541_impl.h"
 
@@ -13,6 +16,14 @@
 
 using namespace opcua;
 
+TEST_CASE("Crypto backend") {
+#ifdef UA_ENABLE_ENCRYPTION
+    CHECK(crypto::getCryptoBackend() != crypto::CryptoBackend::None);
+#else
+    CHECK(crypto::getCryptoBackend() == crypto::CryptoBackend::None);
+#endif
+}
+
 #ifdef UA_ENABLE_ENCRYPTION
 
 #ifdef UAPP_CREATE_CERTIFICATE
@@ -48,6 +59,16 @@ TEST_CASE("Create certificate") {
         CHECK(!cert.privateKey.empty());
         CHECK(!cert.certificate.empty());
     }
+
+    SUBCASE("Convert PEM to DER") {
+        const auto pem = crypto::createCertificate(
+            {String{"C=DE"}}, {String{"DNS:localhost"}}, 2048, crypto::CertificateFormat::PEM
+        );
+        const auto der = crypto::convertPemToDer(pem.certificate);
+        CHECK(!der.empty());
+        CHECK(der.handle()->data[0] == 0x30);  // ASN.1 sequence
+        CHECK(crypto::convertPemToDer(der).toBase64() == der.toBase64());
+    }
 }
 
 TEST_CASE("Encrypted connection server/client") {
@@ -102,6 +123,33 @@ TEST_CASE("Encrypted connection server/client") {
         client.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
         CHECK_NOTHROW(client.connect("opc.tcp://localhost:4840"));
     }
+
+    SUBCASE("Connect with secure channel options") {
+        SecureChannelOptions options;
+        options.chunkSize = 1024 * 1024;
+        options.lifetime = 60 * 60 * 1000;
+
+        Server server(
+            4840, certServer.certificate, certServer.privateKey, {certClient.certificate}, {}, {}
+        );
+        server.setSecureChannelOptions(options);
+        const std::vector<double> array(100'000, 1.0);  // larger than the default chunk size
+        const NodeId id{1, "Array"};
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            id,
+            "Array",
+            VariableAttributes{}.setValueRank(ValueRank::OneDimension).setValueArray(array)
+        );
+        ServerRunner serverRunner(server);
+
+        Client client(certClient.certificate, certClient.privateKey, {certServer.certificate}, {});
+        client.setSecurityMode(MessageSecurityMode::SignAndEncrypt);
+        client.setSecureChannelOptions(options);
+        CHECK_NOTHROW(client.connect("opc.tcp://localhost:4840"));
+        CHECK(services::readValue(client, id).getArrayCopy<double>() == array);
+    }
 }
 
 #endif  // ifdef UAPP_CREATE_CERTIFICATE
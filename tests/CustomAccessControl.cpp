@@ -333,3 +333,123 @@ TEST_CASE("CustomAccessControl") {
         );
     }
 }
+
+class AccessControlCounter : public AccessControlDefault {
+public:
+    uint32_t getUserRightsMask(Session& session, const NodeId& nodeId) override {
+        ++calls;
+        if (throwing) {
+            throw std::runtime_error("Not cached");
+        }
+        return AccessControlDefault::getUserRightsMask(session, nodeId);
+    }
+
+    size_t calls = 0;
+    bool throwing = false;
+};
+
+TEST_CASE("CustomAccessControl decision cache") {
+    Server server;
+    CustomAccessControl customAccessControl(server);
+    auto& native = UA_Server_getConfig(server.handle())->accessControl;
+    detail::clearUaAccessControl(native);
+
+    AccessControlCounter accessControl;
+    customAccessControl.setAccessControl(accessControl);
+
+    NodeId sessionId(0, 1000);
+    NodeId nodeId(1, 1);
+    const auto getUserRightsMask = [&] {
+        return native.getUserRightsMask(
+            server.handle(), &native, sessionId.handle(), nullptr, nodeId.handle(), nullptr
+        );
+    };
+
+    SUBCASE("Disabled by default") {
+        CHECK_FALSE(customAccessControl.isCaching());
+        getUserRightsMask();
+        getUserRightsMask();
+        CHECK(accessControl.calls == 2);
+    }
+
+    SUBCASE("Cache decisions per session and node") {
+        customAccessControl.setCaching(true);
+        CHECK(getUserRightsMask() == 0xFFFFFFFF);
+        CHECK(getUserRightsMask() == 0xFFFFFFFF);
+        CHECK(accessControl.calls == 1);
+
+        nodeId = NodeId(1, 2);
+        getUserRightsMask();
+        CHECK(accessControl.calls == 2);
+
+        customAccessControl.invalidateCache(sessionId);
+        getUserRightsMask();
+        CHECK(accessControl.calls == 3);
+
+        customAccessControl.invalidateCache();
+        getUserRightsMask();
+        CHECK(accessControl.calls == 4);
+
+        customAccessControl.onSessionClosed(sessionId);
+        getUserRightsMask();
+        CHECK(accessControl.calls == 5);
+    }
+
+    SUBCASE("Don't cache exceptions") {
+        customAccessControl.setCaching(true);
+        accessControl.throwing = true;
+        CHECK(getUserRightsMask() == 0);
+        CHECK(getUserRightsMask() == 0);
+        CHECK(accessControl.calls == 2);
+    }
+}
+
+TEST_CASE("CustomAccessControl request policy") {
+    Server server;
+    CustomAccessControl customAccessControl(server);
+    auto& native = UA_Server_getConfig(server.handle())->accessControl;
+    detail::clearUaAccessControl(native);
+
+    AccessControlDefault accessControl;
+    customAccessControl.setAccessControl(accessControl);
+
+    NodeId sessionId(0, 1000);
+    NodeId nodeId(1, 1);
+    const auto getUserAccessLevel = [&] {
+        return native.getUserAccessLevel(
+            server.handle(), &native, sessionId.handle(), nullptr, nodeId.handle(), nullptr
+        );
+    };
+
+    SUBCASE("Unlimited by default") {
+        for (int i = 0; i < 100; ++i) {
+            CHECK(getUserAccessLevel() == 0xFF);
+        }
+    }
+
+    SUBCASE("Throttle session with empty token bucket") {
+        customAccessControl.setRequestPolicy({1.0, 2.0, {}});
+        CHECK(getUserAccessLevel() == 0xFF);
+        CHECK(getUserAccessLevel() == 0xFF);
+        CHECK(getUserAccessLevel() == 0x00);
+        // other sessions are not affected
+        sessionId = NodeId(0, 1001);
+        CHECK(getUserAccessLevel() == 0xFF);
+        // reset with session activation
+        sessionId = NodeId(0, 1000);
+        customAccessControl.onSessionActivated(sessionId);
+        CHECK(getUserAccessLevel() == 0xFF);
+    }
+
+    SUBCASE("Weighted sessions") {
+        RequestPolicy policy{1.0, 1.0, {}};
+        policy.weight = [](Session& session) {
+            return session.getSessionId() == NodeId(0, 1000) ? 3.0 : 1.0;
+        };
+        customAccessControl.setRequestPolicy(policy);
+        for (int i = 0; i < 3; ++i) {
+            CHECK(getUserAccessLevel() == 0xFF);
+        }
+        CHECK(getUserAccessLevel() == 0x00);
+    }
+}
@@ -1,7 +1,13 @@
+#include <cstdint>
+#include <utility>  // move
+#include <vector>
+
 #include <doctest/doctest.h>
 
 #include "open62541pp/DataType.h"
+#include "open62541pp/DataTypeRegistry.h"
 #include "open62541pp/open62541.h"
+#include "open62541pp/types/NodeId.h"
 
 #include "CustomDataTypes.h"
 
@@ -25,3 +31,74 @@ TEST_CASE("CustomDataTypes") {
     CHECK(dataTypeArray->types[1] == UA_TYPES[UA_TYPES_FLOAT]);
     CHECK(dataTypeArray->types[2] == UA_TYPES[UA_TYPES_STRING]);
 }
+
+TEST_CASE("DataTypeRegistry") {
+    const auto parent = DataTypeRegistry::create({DataType{UA_TYPES[UA_TYPES_INT32]}});
+    const auto registry = DataTypeRegistry::create(
+        {DataType{UA_TYPES[UA_TYPES_FLOAT]}, DataType{UA_TYPES[UA_TYPES_STRING]}}, parent
+    );
+
+    SUBCASE("Chained native arrays") {
+        const UA_DataTypeArray* array = registry->handle();
+        REQUIRE(array != nullptr);
+        CHECK(array->typesSize == 2);
+        CHECK(array->next == parent->handle());
+        CHECK(array->next->typesSize == 1);
+        CHECK(array->next->next == nullptr);
+    }
+
+    SUBCASE("Lookup") {
+        const auto* dt = registry->findByTypeId(NodeId(UA_TYPES[UA_TYPES_STRING].typeId));
+        REQUIRE(dt != nullptr);
+        CHECK(*dt == UA_TYPES[UA_TYPES_STRING]);
+        // found in parent
+        CHECK(registry->findByTypeId(NodeId(UA_TYPES[UA_TYPES_INT32].typeId)) != nullptr);
+        CHECK(parent->findByTypeId(NodeId(UA_TYPES[UA_TYPES_FLOAT].typeId)) == nullptr);
+        const auto encodingId = DataType(UA_TYPES[UA_TYPES_FLOAT]).getBinaryEncodingId();
+        CHECK(registry->findByBinaryEncodingId(encodingId) != nullptr);
+    }
+
+    SUBCASE("Lookup of builtin data types") {
+        const auto& type = UA_TYPES[UA_TYPES_READVALUEID];
+        CHECK(DataTypeRegistry::findBuiltinByTypeId(NodeId(type.typeId)) == &type);
+        CHECK(
+            DataTypeRegistry::findBuiltinByBinaryEncodingId(DataType(type).getBinaryEncodingId()) ==
+            &type
+        );
+        CHECK(DataTypeRegistry::findBuiltinByTypeId({1, 1}) == nullptr);
+    }
+
+    SUBCASE("Lookup with many data types") {
+        std::vector<DataType> dataTypes;
+        for (uint32_t i = 0; i < 400; ++i) {
+            DataType dt(UA_TYPES[UA_TYPES_INT32]);
+            dt.setTypeId({2, 1000 + i});
+            dt.setBinaryEncodingId({2, 5000 + i});
+            dataTypes.push_back(std::move(dt));
+        }
+        const auto large = DataTypeRegistry::create(std::move(dataTypes));
+        for (uint32_t i = 0; i < 400; ++i) {
+            const auto* dt = large->findByTypeId({2, 1000 + i});
+            REQUIRE(dt != nullptr);
+            CHECK(NodeId(dt->typeId) == NodeId(2, 1000 + i));
+            CHECK(large->findByBinaryEncodingId({2, 5000 + i}) == dt);
+        }
+        CHECK(large->findByTypeId({2, 1400}) == nullptr);
+        CHECK(large->findByBinaryEncodingId({2, 1000}) == nullptr);
+    }
+
+    SUBCASE("Shared by multiple instances") {
+        const UA_DataTypeArray* config1{};
+        const UA_DataTypeArray* config2{};
+        CustomDataTypes customDataTypes1(&config1);
+        CustomDataTypes customDataTypes2(&config2);
+        customDataTypes1.setRegistry(registry);
+        customDataTypes2.setRegistry(registry);
+        CHECK(config1 == registry->handle());
+        CHECK(config2 == registry->handle());
+        CHECK(registry.use_count() == 3);
+        customDataTypes1.setCustomDataTypes({});
+        CHECK(config1 != registry->handle());
+        CHECK(registry.use_count() == 2);
+    }
+}
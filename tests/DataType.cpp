@@ -1,13 +1,22 @@
+#include <array>
+#include <cstddef>  // offsetof
+#include <cstdint>
 #include <string_view>
 #include <utility>  // move
+#include <vector>
 
 #include <doctest/doctest.h>
 
+#include "open62541pp/BinaryEncoding.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/DataType.h"
 #include "open62541pp/DataTypeBuilder.h"
+#include "open62541pp/DataTypeRegistry.h"
+#include "open62541pp/ErrorHandling.h"
 #include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/ExtensionObject.h"
 #include "open62541pp/types/NodeId.h"
+#include "open62541pp/types/Variant.h"
 
 using namespace opcua;
 
@@ -322,3 +331,145 @@ TEST_CASE("DataTypeBuilder") {
         CHECK(dtNative == dtWrapper);
     }
 }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+struct Telemetry {
+    int32_t id;
+    double value;
+    size_t samplesSize;
+    float* samples;
+};
+
+static constexpr StaticStructureType pointStaticType(
+    "Point",
+    1,
+    1001,
+    1,
+    {staticField<&Point::x>("x"), staticField<&Point::y>("y"), staticField<&Point::z>("z")}
+);
+
+static constexpr StaticStructureType telemetryStaticType(
+    "Telemetry",
+    1,
+    1005,
+    5,
+    {
+        staticField<&Telemetry::id>("id"),
+        staticField<&Telemetry::value>("value"),
+        staticArrayField<&Telemetry::samplesSize, &Telemetry::samples>("samples"),
+    }
+);
+
+TEST_CASE("StaticStructureType") {
+    SUBCASE("Overlayable struct") {
+        const UA_DataType& dt = pointStaticType;
+        CHECK(NodeId(dt.typeId) == NodeId(1, 1001));
+        CHECK(NodeId(dt.binaryEncodingId) == NodeId(1, 1));
+        CHECK(dt.memSize == sizeof(Point));
+        CHECK(dt.typeKind == UA_DATATYPEKIND_STRUCTURE);
+        CHECK(dt.pointerFree);
+        CHECK(dt.overlayable == UA_BINARY_OVERLAYABLE_FLOAT);
+        REQUIRE(dt.membersSize == 3);
+        for (size_t i = 0; i < 3; ++i) {
+            CHECK(dt.members[i].memberType == &UA_TYPES[UA_TYPES_FLOAT]);
+            CHECK(dt.members[i].padding == pointMembers[i].padding);
+        }
+    }
+
+    SUBCASE("Struct with padding and array") {
+        const UA_DataType& dt = telemetryStaticType;
+        CHECK_FALSE(dt.pointerFree);
+        CHECK_FALSE(dt.overlayable);
+        REQUIRE(dt.membersSize == 3);
+        CHECK(dt.members[0].padding == 0);
+        CHECK(dt.members[1].padding == offsetof(Telemetry, value) - sizeof(int32_t));
+        CHECK(dt.members[2].padding == 0);
+        CHECK(dt.members[2].isArray);
+
+        std::array<float, 2> samples{1.5F, 2.5F};
+        const Telemetry telemetry{3, 4.5, samples.size(), samples.data()};
+        const ByteString encoded = encodeBinary(&telemetry, dt);
+        Telemetry decoded{};
+        decodeBinary({encoded.handle()->data, encoded.handle()->length}, &decoded, dt);
+        CHECK(decoded.id == 3);
+        CHECK(decoded.value == 4.5);
+        REQUIRE(decoded.samplesSize == 2);
+        CHECK(decoded.samples[1] == 2.5F);
+        UA_clear(&decoded, &dt);
+    }
+
+    SUBCASE("Convert to DataType") {
+        const DataType dt = telemetryStaticType.getDataType();
+        CHECK(dt.getTypeId() == NodeId(1, 1005));
+        CHECK(dt.getMembers().size() == 3);
+    }
+}
+
+TEST_CASE("ExtensionObject lazy decoding") {
+    struct Record {
+        UA_String name;
+        size_t valuesSize;
+        double* values;
+        int32_t status;
+    };
+
+    const auto dt = DataTypeBuilder<Record>::createStructure("Record", {1, 1004}, {1, 4})
+                        .addField<&Record::name>("name", UA_TYPES[UA_TYPES_STRING])
+                        .addField<&Record::valuesSize, &Record::values>("values")
+                        .addField<&Record::status>("status")
+                        .build();
+
+    std::array<double, 3> values{1.0, 2.0, 3.0};
+    Record record{UA_STRING(const_cast<char*>("record")), values.size(), values.data(), 7};
+    const ByteString body = encodeBinary(&record, dt);
+
+    ExtensionObject obj;
+    obj->encoding = UA_EXTENSIONOBJECT_ENCODED_BYTESTRING;
+    obj->content.encoded.typeId = UA_NODEID_NUMERIC(1, 4);
+    UA_ByteString_copy(body.handle(), &obj->content.encoded.body);
+    CHECK(obj.isEncoded());
+
+    SUBCASE("Decode member from encoded body") {
+        CHECK(obj.decodeMember(dt, 0).getScalarCopy<String>() == "record");
+        CHECK(obj.decodeMember(dt, 1).getArrayCopy<double>() == std::vector<double>{1, 2, 3});
+        CHECK(obj.decodeMember(dt, 2).getScalarCopy<int32_t>() == 7);
+        CHECK(obj.isEncoded());
+        CHECK_THROWS_AS(obj.decodeMember(dt, 3), BadStatus);
+    }
+
+    SUBCASE("Decode on first access") {
+        auto* decoded = obj.decodedAs<Record>(dt);
+        REQUIRE(decoded != nullptr);
+        CHECK(obj.isDecoded());
+        CHECK(decoded->status == 7);
+        CHECK(decoded->valuesSize == 3);
+        CHECK(obj.decodedAs<Record>(dt) == decoded);  // cached
+        CHECK(obj.decodeMember(dt, 2).getScalarCopy<int32_t>() == 7);
+        CHECK(obj.decode(UA_TYPES[UA_TYPES_INT32]) == nullptr);
+    }
+
+    SUBCASE("Decode with data type of the registry") {
+        const auto registry = DataTypeRegistry::create({dt});
+        ExtensionObject copy(obj);  // destroy before the registry
+        auto* decoded = static_cast<Record*>(copy.decode(*registry));
+        REQUIRE(decoded != nullptr);
+        CHECK(copy.getDecodedDataType() == registry->findByTypeId({1, 1004}));
+        CHECK(decoded->status == 7);
+        CHECK(copy.decode(*registry) == decoded);  // cached
+        // builtin data types are resolved without registry entries
+        const auto& readValueIdType = UA_TYPES[UA_TYPES_READVALUEID];
+        UA_ReadValueId readValueId{};
+        readValueId.attributeId = 13;
+        const ByteString readValueIdBody = encodeBinary(readValueId);
+        ExtensionObject builtin;
+        builtin->encoding = UA_EXTENSIONOBJECT_ENCODED_BYTESTRING;
+        builtin->content.encoded.typeId = readValueIdType.binaryEncodingId;
+        UA_ByteString_copy(readValueIdBody.handle(), &builtin->content.encoded.body);
+        const auto* decodedReadValueId = static_cast<UA_ReadValueId*>(builtin.decode(*registry));
+        REQUIRE(decodedReadValueId != nullptr);
+        CHECK(builtin.getDecodedDataType() == &readValueIdType);
+        CHECK(decodedReadValueId->attributeId == 13);
+        CHECK(ExtensionObject{}.decode(*registry) == nullptr);
+    }
+}
+#endif
@@ -1,6 +1,7 @@
 #include <doctest/doctest.h>
 
 #include "open62541pp/ErrorHandling.h"
+#include "open62541pp/Result.h"
 
 using namespace opcua;
 
@@ -24,3 +25,47 @@ TEST_CASE("invokeCatchStatus") {
         UA_STATUSCODE_BADINTERNALERROR
     );
 }
+
+TEST_CASE("Result") {
+    SUBCASE("Value") {
+        Result<int> result(5);
+        CHECK(result);
+        CHECK(result.hasValue());
+        CHECK(result.code() == UA_STATUSCODE_GOOD);
+        CHECK(result.value() == 5);
+        CHECK(*result == 5);
+        CHECK(result.valueOr(1) == 5);
+    }
+
+    SUBCASE("Value with uncertain status code") {
+        const Result<int> result(5, UA_STATUSCODE_UNCERTAININITIALVALUE);
+        CHECK(result);
+        CHECK(result.code() == UA_STATUSCODE_UNCERTAININITIALVALUE);
+        CHECK(result.value() == 5);
+    }
+
+    SUBCASE("Bad result") {
+        const Result<int> result = BadResult(UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK_FALSE(result);
+        CHECK(result.code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK_THROWS_WITH(result.value(), "BadNodeIdUnknown");
+        CHECK(result.valueOr(1) == 1);
+    }
+
+    SUBCASE("Void") {
+        CHECK(Result<void>());
+        CHECK(Result<void>(UA_STATUSCODE_UNCERTAIN));
+        CHECK_FALSE(Result<void>(UA_STATUSCODE_BADTIMEOUT));
+        CHECK_NOTHROW(Result<void>().value());
+        CHECK_THROWS_WITH(Result<void>(UA_STATUSCODE_BADTIMEOUT).value(), "BadTimeout");
+    }
+
+    SUBCASE("tryInvoke") {
+        const auto result = detail::tryInvoke([]() -> Result<int> {
+            throw BadStatus(UA_STATUSCODE_BADTIMEOUT);
+        });
+        CHECK(result.code() == UA_STATUSCODE_BADTIMEOUT);
+        CHECK(detail::tryInvoke([]() -> Result<int> { throw std::runtime_error("test"); }).code() ==
+              UA_STATUSCODE_BADINTERNALERROR);
+    }
+}
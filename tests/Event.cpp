@@ -1,9 +1,13 @@
+#include <chrono>
 #include <memory>
+#include <thread>
+#include <vector>
 
 #include <doctest/doctest.h>
 
 #include "open62541pp/Config.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/EventStream.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/services/Attribute.h"
 
@@ -49,4 +53,108 @@ TEST_CASE("Event") {
     }
 }
 
+TEST_CASE("EventTemplate") {
+    Server server;
+
+    SUBCASE("Invalid field") {
+        CHECK_THROWS_WITH(
+            EventTemplate(server, ObjectTypeId::BaseEventType, {{0, "Invalid"}}), "BadNoMatch"
+        );
+    }
+
+    SUBCASE("Trigger with field values") {
+        const std::vector<QualifiedName> fields{{0, "Severity"}, {0, "Message"}};
+        EventTemplate event(server, ObjectTypeId::BaseEventType, fields);
+        CHECK(event.getFields().size() == 2);
+        CHECK(event.getFieldIds().size() == 2);
+
+        const auto severityId = event.getFieldIds()[0];
+        const auto nodeId = event.getEvent().getNodeId();
+        CHECK_NOTHROW(event.trigger({
+            Variant::fromScalar(uint16_t{500}),
+            Variant::fromScalar(LocalizedText("", "Message")),
+        }));
+        CHECK(services::readValue(server, severityId).getScalarCopy<uint16_t>() == 500);
+
+        // reuse node, keep previous value of empty variants
+        const auto eventId1 = event.trigger({Variant::fromScalar(uint16_t{100}), Variant{}});
+        const auto eventId2 = event.trigger({Variant{}, Variant{}});
+        CHECK(eventId1 != eventId2);
+        CHECK(event.getEvent().getNodeId() == nodeId);
+        CHECK(services::readValue(server, severityId).getScalarCopy<uint16_t>() == 100);
+
+        CHECK_THROWS_WITH(event.trigger({}), "BadInvalidArgument");
+    }
+}
+
+TEST_CASE("EventStream") {
+    Server server;
+    const NodeId originId(ObjectId::Server);
+    const NodeId eventType(ObjectTypeId::BaseEventType);
+    const std::vector<QualifiedName> fields{{0, "Severity"}};
+    const auto severity = [](uint16_t value) {
+        return std::vector<Variant>{Variant::fromScalar(value)};
+    };
+    const auto iterateFor = [&](std::chrono::milliseconds duration) {
+        const auto until = std::chrono::steady_clock::now() + duration;
+        while (std::chrono::steady_clock::now() < until) {
+            server.runIterate();
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+    };
+
+    SUBCASE("Trigger queued events in batches") {
+        EventStreamOptions options;
+        options.interval = std::chrono::milliseconds(10);
+        auto stream = server.createEventStream(originId, eventType, fields, options);
+        CHECK(stream.getFields().size() == 1);
+        CHECK_THROWS_WITH(stream.push({}), "BadInvalidArgument");
+
+        std::thread producer([&] {
+            for (uint16_t i = 1; i <= 100; ++i) {
+                stream.push(severity(i));
+            }
+        });
+        producer.join();
+        iterateFor(std::chrono::milliseconds(100));
+        CHECK(stream.getQueueSize() == 0);
+        CHECK(stream.getTriggeredCount() == 100);
+    }
+
+    SUBCASE("Coalesce events with the same condition key") {
+        auto stream = server.createEventStream(originId, eventType, fields);
+        stream.push("alarm1", severity(100));
+        stream.push("alarm1", severity(200));
+        stream.push("alarm2", severity(300));
+        stream.push("alarm1", severity(400));
+        CHECK(stream.getQueueSize() == 2);
+        CHECK(stream.getCoalescedCount() == 2);
+    }
+
+    SUBCASE("Drop oldest events on overflow") {
+        EventStreamOptions options;
+        options.maxQueueSize = 2;
+        auto stream = server.createEventStream(originId, eventType, fields, options);
+        stream.push(severity(100));
+        stream.push(severity(200));
+        stream.push(severity(300));
+        CHECK(stream.getQueueSize() == 2);
+        CHECK(stream.getDroppedCount() == 1);
+    }
+
+    SUBCASE("Limit rate") {
+        EventStreamOptions options;
+        options.maxRate = 20;
+        options.interval = std::chrono::milliseconds(10);
+        auto stream = server.createEventStream(originId, eventType, fields, options);
+        for (uint16_t i = 1; i <= 100; ++i) {
+            stream.push(severity(i));
+        }
+        iterateFor(std::chrono::milliseconds(200));
+        CHECK(stream.getTriggeredCount() > 0);
+        CHECK(stream.getTriggeredCount() < 20);
+        CHECK(stream.getQueueSize() == 100 - stream.getTriggeredCount());
+    }
+}
+
 #endif
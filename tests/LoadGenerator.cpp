@@ -0,0 +1,115 @@
+#include <algorithm>  // all_of
+#include <array>
+#include <cstdint>
+#include <stdexcept>  // invalid_argument
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Server.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
+
+#include "LoadGenerator.h"
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+TEST_CASE("Load generator options") {
+    using loadgen::parseOptions;
+    const auto options = parseOptions(
+        {"opc.tcp://localhost:4840", "--sessions", "3", "--mix", "read=1,browse=2"}
+    );
+    CHECK(options.endpointUrl == "opc.tcp://localhost:4840");
+    CHECK(options.sessions == 3);
+    CHECK(options.mix == std::array<double, 4>{1.0, 0.0, 2.0, 0.0});
+
+    CHECK_THROWS_AS(parseOptions({}), std::invalid_argument);
+    CHECK_THROWS_AS(parseOptions({"url", "--sessions"}), std::invalid_argument);
+    CHECK_THROWS_AS(parseOptions({"url", "--unknown", "1"}), std::invalid_argument);
+    CHECK_THROWS_AS(parseOptions({"url", "--mix", "read=0"}), std::invalid_argument);
+    CHECK_THROWS_AS(parseOptions({"url", "--mix", "write=1"}), std::invalid_argument);
+    CHECK_THROWS_AS(parseOptions({"url", "--read-node", "invalid"}), std::invalid_argument);
+}
+
+TEST_CASE("Load generator smoke test") {
+    Server server;
+    const NodeId id{1, 1000};
+    services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    services::writeValue(server, id, Variant::fromScalar(11.11));
+    ServerRunner serverRunner(server);
+
+    const auto read = static_cast<size_t>(loadgen::Operation::Read);
+    const auto write = static_cast<size_t>(loadgen::Operation::Write);
+    const auto browse = static_cast<size_t>(loadgen::Operation::Browse);
+    const auto call = static_cast<size_t>(loadgen::Operation::Call);
+
+    SUBCASE("As fast as possible") {
+        const auto options = loadgen::parseOptions(
+            {"opc.tcp://localhost:4840",
+             "--sessions",
+             "2",
+             "--warmup",
+             "0.1",
+             "--duration",
+             "0.5",
+             "--mix",
+             "read=1,write=1,browse=1",
+             "--write-node",
+             "ns=1;i=1000"}
+        );
+        const auto report = loadgen::run(options);
+        CHECK(report.elapsed >= 0.5);
+        REQUIRE(report.failures.size() == 2);
+        CHECK(std::all_of(report.failures.begin(), report.failures.end(), [](const auto& f) {
+            return f.empty();
+        }));
+        for (const auto i : {read, write, browse}) {
+            CHECK(report.operations[i].latency.count() > 0);
+            CHECK(report.operations[i].errors == 0);
+        }
+        CHECK(report.operations[call].latency.count() == 0);
+        CHECK(report.notifications == 0);
+    }
+
+    SUBCASE("Fixed rate with progress") {
+        const auto options = loadgen::parseOptions(
+            {"opc.tcp://localhost:4840",
+             "--warmup",
+             "0.1",
+             "--duration",
+             "1.2",
+             "--rate",
+             "20",
+             "--subscribe",
+             "1",
+             "--publishing",
+             "50",
+             "--sampling",
+             "10"}
+        );
+        std::vector<uint64_t> progress;
+        const auto report = loadgen::run(options, [&](double, uint64_t operations, auto, auto) {
+            progress.push_back(operations);
+        });
+        CHECK(progress.size() == 1);
+        const auto count = report.operations[read].latency.count();
+        CHECK(count >= 10);  // 24 expected, tolerate slow runners
+        CHECK(count <= 26);
+        CHECK(progress.at(0) <= count);
+        CHECK(report.operations[read].errors == 0);
+        CHECK(report.notifications > 0);
+    }
+
+    SUBCASE("Unreachable endpoint") {
+        const auto options = loadgen::parseOptions(
+            {"opc.tcp://localhost:4999", "--warmup", "0", "--duration", "0.1"}
+        );
+        const auto report = loadgen::run(options);
+        REQUIRE(report.failures.size() == 1);
+        CHECK_FALSE(report.failures[0].empty());
+        CHECK(report.operations[read].latency.count() == 0);
+    }
+}
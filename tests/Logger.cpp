@@ -1,10 +1,18 @@
+#include <fstream>
+#include <iterator>  // istreambuf_iterator
+#include <memory>
 #include <string>
+#include <utility>  // pair
+#include <vector>
 
 #include <doctest/doctest.h>
 
+#include "open62541pp/BinaryLogSink.h"
 #include "open62541pp/Client.h"
+#include "open62541pp/ErrorHandling.h"
 #include "open62541pp/Logger.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/types/Builtin.h"  // fs
 
 using namespace opcua;
 
@@ -31,3 +39,94 @@ TEST_CASE_TEMPLATE("Log with custom logger", T, Server, Client) {
     CHECK(lastLogCategory == LogCategory::Server);
     CHECK(lastMessage == "Message from native");
 }
+
+TEST_CASE_TEMPLATE("Log with minimum log level", T, Server, Client) {
+    T serverOrClient;
+
+    std::vector<std::string> messages;
+    LoggerOptions options;
+    options.minLevel = LogLevel::Warning;
+    serverOrClient.setLogger(
+        [&](LogLevel, LogCategory, std::string_view message) { messages.emplace_back(message); },
+        options
+    );
+
+    log(serverOrClient, LogLevel::Info, LogCategory::Server, "Info");
+    log(serverOrClient, LogLevel::Warning, LogCategory::Server, "Warning");
+    log(serverOrClient, LogLevel::Error, LogCategory::Server, "Error");
+    CHECK(messages == std::vector<std::string>{"Warning", "Error"});
+}
+
+TEST_CASE_TEMPLATE("Log with async logger", T, Server, Client) {
+    T serverOrClient;
+
+    std::vector<std::pair<LogLevel, std::string>> messages;
+    LoggerOptions options;
+    options.async = true;
+    options.asyncCapacity = 4;
+
+    SUBCASE("Messages are flushed in order") {
+        serverOrClient.setLogger(
+            [&](LogLevel level, LogCategory, std::string_view message) {
+                messages.emplace_back(level, message);
+            },
+            options
+        );
+        log(serverOrClient, LogLevel::Info, LogCategory::Server, "Message 1");
+        log(serverOrClient, LogLevel::Error, LogCategory::Server, "Message 2");
+        serverOrClient.setLogger({});  // stop background thread and flush
+
+        REQUIRE(messages.size() == 2);
+        CHECK(messages[0] == std::pair{LogLevel::Info, std::string("Message 1")});
+        CHECK(messages[1] == std::pair{LogLevel::Error, std::string("Message 2")});
+    }
+
+    SUBCASE("Long messages are truncated") {
+        serverOrClient.setLogger(
+            [&](LogLevel level, LogCategory, std::string_view message) {
+                messages.emplace_back(level, message);
+            },
+            options
+        );
+        log(serverOrClient, LogLevel::Info, LogCategory::Server, std::string(1000, 'x'));
+        serverOrClient.setLogger({});
+
+        REQUIRE(messages.size() == 1);
+        CHECK(messages[0].second == std::string(asyncMaxMessageLength, 'x'));
+    }
+}
+
+TEST_CASE_TEMPLATE("Log with binary log sink", T, Server, Client) {
+    T serverOrClient;
+
+    const auto filepath = fs::temp_directory_path() / "open62541pp_binary.log";
+    {
+        LoggerOptions options;
+        options.binarySink = std::make_shared<BinaryLogSink>(filepath.string());
+        serverOrClient.setLogger({}, options);
+        log(serverOrClient, LogLevel::Info, LogCategory::Server, "Message 1");
+        log(serverOrClient, LogLevel::Info, LogCategory::Server, "Message 1");
+        log(serverOrClient, LogLevel::Info, LogCategory::Server, "Message 2");
+        // formats built at runtime, the intern table is bounded
+        for (int i = 0; i < 5000; ++i) {
+            const auto msg = "Runtime " + std::to_string(i);
+            log(serverOrClient, LogLevel::Info, LogCategory::Server, msg);
+        }
+        serverOrClient.setLogger({});  // release and flush sink
+    }
+
+    std::ifstream stream(filepath, std::ios::binary);
+    const std::string content(
+        (std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>()
+    );
+    CHECK(content.substr(0, 8) == "UAPPBLOG");
+    // format strings are stored once
+    CHECK(content.find("Message 1") != std::string::npos);
+    CHECK(content.find("Message 1") == content.rfind("Message 1"));
+    CHECK(content.find("Message 2") != std::string::npos);
+    CHECK(content.find("Runtime 4999") != std::string::npos);
+}
+
+TEST_CASE("BinaryLogSink with invalid file path") {
+    CHECK_THROWS_AS(BinaryLogSink("/invalid/dir/binary.log"), BadStatus);
+}
@@ -1,6 +1,8 @@
 #include <doctest/doctest.h>
 
 #include <algorithm>  // any_of
+#include <cstdint>
+#include <vector>
 
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
@@ -249,3 +251,69 @@ TEST_CASE("Node") {
     SUBCASE("Client") { testNode(client); };
     // clang-format on
 }
+
+TEST_CASE("Node typed variable handle (server)") {
+    Server server;
+    auto objNode = server.getObjectsNode();
+    auto varNode = objNode.addVariable(
+        {1, "Counter"},
+        "Counter",
+        VariableAttributes{}
+            .setAccessLevel(0xFF)
+            .setDataType<int32_t>()
+            .setValueRank(ValueRank::Scalar)
+            .setValueScalar(0)
+    );
+
+    SUBCASE("Write and read") {
+        auto handle = varNode.typed<int32_t>();
+        CHECK(handle.getNodeId() == varNode.getNodeId());
+        handle.write(11);
+        CHECK(handle.read() == 11);
+        CHECK(varNode.readValueScalar<int32_t>() == 11);
+
+        const auto timestamp = DateTime::now();
+        handle.write(22, timestamp);
+        const auto dataValue = varNode.readDataValue();
+        CHECK(dataValue.getValue().getScalar<int32_t>() == 22);
+        CHECK(dataValue.getSourceTimestamp().get() == timestamp.get());
+    }
+
+    SUBCASE("Write with value callback") {
+        int valueAfterWrite = 0;
+        ValueCallback callback;
+        callback.onAfterWrite = [&](const DataValue& value) {
+            valueAfterWrite = value.getValue().getScalar<int32_t>();
+        };
+        server.setVariableNodeValueCallback(varNode.getNodeId(), callback);
+        auto handle = varNode.typed<int32_t>();
+        handle.write(33);
+        CHECK(valueAfterWrite == 33);
+        CHECK(handle.read() == 33);
+    }
+
+    SUBCASE("Supertype of data type") {
+        auto numberNode = objNode.addVariable(
+            {1, "Number"},
+            "Number",
+            VariableAttributes{}.setDataType(DataTypeId::Number).setValueScalar(1.0)
+        );
+        auto handle = numberNode.typed<double>();
+        handle.write(1.5);
+        CHECK(handle.read() == 1.5);
+    }
+
+    SUBCASE("Validation") {
+        CHECK_THROWS_WITH(varNode.typed<double>(), "BadTypeMismatch");
+        CHECK_THROWS_WITH(objNode.typed<int32_t>(), "BadNodeClassInvalid");
+        auto arrayNode = objNode.addVariable(
+            {1, "Array"},
+            "Array",
+            VariableAttributes{}
+                .setDataType<int32_t>()
+                .setValueRank(ValueRank::OneDimension)
+                .setValueArray(std::vector<int32_t>{1, 2, 3})
+        );
+        CHECK_THROWS_WITH(arrayNode.typed<int32_t>(), "BadTypeMismatch");
+    }
+}
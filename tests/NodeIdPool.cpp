@@ -0,0 +1,81 @@
+#include <memory>
+#include <unordered_map>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/MonitoredItem.h"
+#include "open62541pp/NodeIdPool.h"
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Subscription.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+TEST_CASE("NodeIdPool") {
+    NodeIdPool pool;
+
+    SUBCASE("Intern") {
+        const auto id1 = pool.intern({1, "Device/Sensor/Temperature"});
+        const auto id2 = pool.intern({1, "Device/Sensor/Temperature"});
+        const auto id3 = pool.intern({1, "Device/Sensor/Pressure"});
+        CHECK(pool.size() == 2);
+        CHECK(id1 == id2);
+        CHECK(&id1.get() == &id2.get());  // shared instance
+        CHECK(id1 != id3);
+        CHECK(id1.get() == NodeId(1, "Device/Sensor/Temperature"));
+        CHECK(id1.hash() == NodeId(1, "Device/Sensor/Temperature").hash());
+        CHECK(id1.useCount() == 3);  // pool, id1, id2
+    }
+
+    SUBCASE("Different pools") {
+        NodeIdPool other;
+        CHECK(pool.intern({1, "Test"}) == other.intern({1, "Test"}));
+        CHECK(pool.intern({1, "Test"}) != other.intern({1, "Other"}));
+    }
+
+    SUBCASE("Null") {
+        const InternedNodeId id;
+        CHECK(id.get().isNull());
+        CHECK(id == InternedNodeId());
+        CHECK(id.hash() == NodeId().hash());
+    }
+
+    SUBCASE("Purge") {
+        auto id = pool.intern({1, "Test"});
+        pool.intern({1, "Unused"});
+        CHECK(pool.purge() == 1);
+        CHECK(pool.size() == 1);
+        CHECK(id.get() == NodeId(1, "Test"));
+    }
+
+    SUBCASE("Hash map key") {
+        std::unordered_map<InternedNodeId, int> map;
+        map[pool.intern({1, "Test"})] = 1;
+        CHECK(map.at(pool.intern({1, "Test"})) == 1);
+    }
+}
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("NodeIdPool with client monitored items") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    auto pool = std::make_shared<NodeIdPool>();
+    client.setNodeIdPool(pool);
+    CHECK(client.getNodeIdPool() == pool);
+
+    auto sub = client.createSubscription();
+    const NodeId id(VariableId::Server_ServerStatus_CurrentTime);
+    auto mon1 = sub.subscribeDataChange(id, AttributeId::Value, {});
+    auto mon2 = sub.subscribeDataChange(id, AttributeId::Value, {});
+    CHECK(pool->size() == 1);
+    CHECK(mon1.getNodeId() == id);
+    CHECK(&mon1.getNodeId() == &mon2.getNodeId());
+    CHECK(mon1.getAttributeId() == AttributeId::Value);
+}
+#endif
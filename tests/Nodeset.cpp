@@ -0,0 +1,286 @@
+#include <cstdio>  // remove
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <utility>  // move
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Config.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Nodeset.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/ValueBackend.h"
+#include "open62541pp/types/Composed.h"
+#include "open62541pp/types/Variant.h"
+
+#include "detail/XmlReader.h"
+#include "open62541_impl.h"
+
+using namespace opcua;
+
+constexpr std::string_view nodesetXml = R"(<?xml version="1.0" encoding="utf-8"?>
+<UANodeSet xmlns="http://opcfoundation.org/UA/2011/03/UANodeSet.xsd"
+           xmlns:uax="http://opcfoundation.org/UA/2008/02/Types.xsd">
+  <NamespaceUris>
+    <Uri>http://example.com/nodeset/</Uri>
+  </NamespaceUris>
+  <Aliases>
+    <Alias Alias="Double">i=11</Alias>
+    <Alias Alias="HasComponent">i=47</Alias>
+    <Alias Alias="HasProperty">i=46</Alias>
+    <Alias Alias="Organizes">i=35</Alias>
+    <Alias Alias="HasTypeDefinition">i=40</Alias>
+  </Aliases>
+  <!-- variable defined before its parent -->
+  <UAVariable NodeId="ns=1;i=2001" BrowseName="1:Temperature" DataType="Double"
+              ParentNodeId="ns=1;i=1000" AccessLevel="3">
+    <DisplayName>Temperature &amp; more</DisplayName>
+    <References>
+      <Reference ReferenceType="HasTypeDefinition">i=63</Reference>
+      <Reference ReferenceType="HasComponent" IsForward="false">ns=1;i=1000</Reference>
+    </References>
+    <Value>
+      <uax:Double>21.5</uax:Double>
+    </Value>
+  </UAVariable>
+  <UAObject NodeId="ns=1;i=1000" BrowseName="1:Device">
+    <DisplayName Locale="en">Device</DisplayName>
+    <References>
+      <Reference ReferenceType="Organizes" IsForward="false">i=85</Reference>
+      <Reference ReferenceType="HasTypeDefinition">i=58</Reference>
+      <Reference ReferenceType="HasComponent">ns=1;i=2001</Reference>
+      <Reference ReferenceType="HasProperty">ns=1;i=2002</Reference>
+    </References>
+  </UAObject>
+  <UAVariable NodeId="ns=1;s=Values" BrowseName="1:Values" DataType="i=6" ValueRank="1"
+              ArrayDimensions="3">
+    <References>
+      <Reference ReferenceType="HasProperty" IsForward="false">ns=1;i=1000</Reference>
+    </References>
+    <Value>
+      <uax:ListOfInt32>
+        <uax:Int32>1</uax:Int32>
+        <uax:Int32>2</uax:Int32>
+        <uax:Int32>3</uax:Int32>
+      </uax:ListOfInt32>
+    </Value>
+  </UAVariable>
+</UANodeSet>
+)";
+
+TEST_CASE("XmlReader") {
+    std::istringstream stream(R"(<?xml version="1.0"?><!-- c --><a x="1 &lt; 2"><b/>t&#x41;</a>)");
+    detail::XmlReader reader(stream);
+    CHECK(reader.next() == detail::XmlReader::Event::StartElement);
+    CHECK(reader.name() == "a");
+    CHECK(reader.attribute("x") == "1 < 2");
+    CHECK_FALSE(reader.attribute("y").has_value());
+    CHECK(reader.next() == detail::XmlReader::Event::StartElement);
+    CHECK(reader.name() == "b");
+    CHECK(reader.next() == detail::XmlReader::Event::EndElement);
+    CHECK(reader.next() == detail::XmlReader::Event::Text);
+    CHECK(reader.text() == "tA");
+    CHECK(reader.next() == detail::XmlReader::Event::EndElement);
+    CHECK(reader.next() == detail::XmlReader::Event::EndDocument);
+}
+
+TEST_CASE("XmlReader character references") {
+    const auto readText = [](std::string_view text) {
+        std::istringstream stream("<a>" + std::string(text) + "</a>");
+        detail::XmlReader reader(stream);
+        reader.next();
+        reader.next();
+        return std::string(reader.text());
+    };
+    CHECK(readText("&#65;&#xE4;&#x20AC;&#x10FFFF;") == "A\xC3\xA4\xE2\x82\xAC\xF4\x8F\xBF\xBF");
+    for (const auto* invalid :
+         {"&#0;", "&#x0;", "&#x110000;", "&#xD800;", "&#xDFFF;", "&#-1;", "&#+65;", "&#x;"}) {
+        CAPTURE(invalid);
+        CHECK_THROWS_WITH(readText(invalid), "BadDecodingError");
+    }
+}
+
+TEST_CASE("Nodeset") {
+    std::istringstream stream{std::string(nodesetXml)};
+    auto nodeset = readNodesetXml(stream);
+    CHECK(nodeset.namespaceUris.size() == 1);
+    CHECK(nodeset.namespaceUris.at(0) == "http://example.com/nodeset/");
+
+    const auto nodes = nodeset.nodes.getNodes();
+    REQUIRE(nodes.size() == 3);
+    // parent sorted before child
+    CHECK(nodes[0].getRequestedNewNodeId().getNodeId() == NodeId(1, 1000));
+    CHECK(nodes[0].getTypeDefinition().getNodeId() == NodeId(0, UA_NS0ID_BASEOBJECTTYPE));
+    CHECK(nodes[1].getRequestedNewNodeId().getNodeId() == NodeId(1, 2001));
+    CHECK(nodes[1].getParentNodeId().getNodeId() == NodeId(1, 1000));
+    CHECK(nodes[1].getReferenceTypeId() == NodeId(0, UA_NS0ID_HASCOMPONENT));
+    // forward reference of parent is deduplicated, reference to unknown node is kept
+    CHECK(nodeset.nodes.getReferences().size() == 1);
+
+    SUBCASE("Malformed") {
+        std::istringstream malformed("<UANodeSet><UAObject NodeId=\"i=1\"></UANodeSet>");
+        CHECK_THROWS_WITH(readNodesetXml(malformed), "BadDecodingError");
+    }
+
+    SUBCASE("Load into server") {
+        Server server;
+        const auto namespaceIndex = server.registerNamespace("http://example.com/other/");
+        const auto result = server.loadNodeset(std::move(nodeset));
+        CHECK(result.nodeStatusCodes.size() == 3);
+        CHECK(result.nodeStatusCodes.at(0).isGood());
+        CHECK(result.nodeStatusCodes.at(1).isGood());
+        CHECK(result.nodeStatusCodes.at(2).isGood());
+        CHECK(result.referenceStatusCodes.at(0).isBad());  // ns=1;i=2002 not defined
+
+        // namespace remapped
+        const auto ns = static_cast<uint16_t>(namespaceIndex + 1);
+        auto variable = server.getNode({ns, 2001});
+        CHECK(variable.readDisplayName().getText() == "Temperature & more");
+        CHECK(variable.readValueScalar<double>() == 21.5);
+        CHECK(variable.readBrowseName() == QualifiedName(ns, "Temperature"));
+        CHECK(server.getNode({ns, "Values"}).readValueArray<int32_t>() == std::vector{1, 2, 3});
+    }
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+    SUBCASE("Binary snapshot") {
+        std::stringstream binary;
+        writeNodesetBinary(nodeset, binary);
+        CHECK(detail::isNodesetBinary(binary));
+        const auto restored = readNodesetBinary(binary);
+        CHECK(restored.namespaceUris == nodeset.namespaceUris);
+        CHECK(restored.nodes.getNodes().size() == 3);
+        CHECK(restored.nodes.getReferences().size() == 1);
+        const auto& node = restored.nodes.getNodes()[1];
+        CHECK(node.getRequestedNewNodeId().getNodeId() == NodeId(1, 2001));
+        CHECK(node.getBrowseName() == QualifiedName(1, "Temperature"));
+        CHECK(
+            node.getNodeAttributes().getDecodedDataType() == &UA_TYPES[UA_TYPES_VARIABLEATTRIBUTES]
+        );
+
+        std::istringstream invalid("UAPPNSB1xyz");
+        CHECK_THROWS_WITH(readNodesetBinary(invalid), "BadDecodingError");
+    }
+#endif
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+TEST_CASE("Server snapshot") {
+    const char* filepath = "test_snapshot.bin";
+    const NodeId objectId(1, 1000);
+    const NodeId variableId(1, 1001);
+    const NodeId dataSourceId(1, 1002);
+
+    const auto createDataSource = [](int value) {
+        ValueBackendDataSource dataSource;
+        dataSource.read = [value](DataValue& dv, const NumericRange&, bool) {
+            dv.getValue().setScalarCopy(value);
+            return UA_STATUSCODE_GOOD;
+        };
+        return dataSource;
+    };
+
+    {
+        Server server;
+        auto object = server.getObjectsNode().addObject(objectId, "Device");
+        object.addVariable(variableId, "Temperature").writeValueScalar(21.5);
+        object.addVariable(dataSourceId, "Counter");
+        server.setVariableNodeValueBackend(dataSourceId, createDataSource(7));
+
+        const auto nodeset = exportNodeset(server);
+        CHECK(nodeset.nodes.getNodes().size() == 3);
+        CHECK(nodeset.nodes.getNodes()[0].getRequestedNewNodeId().getNodeId() == objectId);
+        CHECK_NOTHROW(server.writeSnapshot(filepath));
+    }
+
+    Server server;
+    std::vector<std::pair<NodeId, ValueBackendDataSource>> dataSources;
+    dataSources.emplace_back(dataSourceId, createDataSource(9));
+    const auto result = server.restoreSnapshot(filepath, {}, dataSources);
+    CHECK(result.nodeStatusCodes.size() == 3);
+    CHECK(result.isGood());
+    CHECK(server.getNode(variableId).readValueScalar<double>() == 21.5);
+    CHECK(server.getNode(variableId).readBrowseName() == QualifiedName(1, "Temperature"));
+    CHECK(server.getNode(variableId).browseParent().getNodeId() == objectId);
+    CHECK(server.getNode(dataSourceId).readValueScalar<int>() == 9);
+
+    CHECK_THROWS_WITH(server.restoreSnapshot("unknown.bin"), "BadNotFound");
+    std::remove(filepath);
+}
+
+TEST_CASE("Export nodeset with continuation points") {
+    Server server;
+    const NodeId objectId(1, 1000);
+    auto object = server.getObjectsNode().addObject(objectId, "Device");
+    for (uint32_t i = 1; i <= 5; ++i) {
+        object.addVariable({1, 1000 + i}, "Variable");
+    }
+
+    // browse results are split into single references
+    UA_Server_getConfig(server.handle())->maxReferencesPerNode = 1;
+    const auto nodeset = exportNodeset(server);
+    const auto nodes = nodeset.nodes.getNodes();
+    REQUIRE(nodes.size() == 6);
+    CHECK(nodes[0].getRequestedNewNodeId().getNodeId() == objectId);
+    CHECK(nodes[0].getParentNodeId().getNodeId() == NodeId(0, UA_NS0ID_OBJECTSFOLDER));
+    CHECK(nodes[0].getTypeDefinition().getNodeId() == NodeId(0, UA_NS0ID_BASEOBJECTTYPE));
+    for (size_t i = 1; i < nodes.size(); ++i) {
+        CHECK(nodes[i].getParentNodeId().getNodeId() == objectId);
+        CHECK(nodes[i].getReferenceTypeId() == NodeId(0, UA_NS0ID_HASCOMPONENT));
+        CHECK(
+            nodes[i].getTypeDefinition().getNodeId() ==
+            NodeId(0, UA_NS0ID_BASEDATAVARIABLETYPE)
+        );
+    }
+}
+#endif
+
+TEST_CASE("Server apply model") {
+    Server server;
+    const NodeId rootId(1, "Model");
+    server.getObjectsNode().addFolder(rootId, "Model");
+
+    const auto createModel = [&](std::vector<std::pair<std::string_view, int32_t>> variables) {
+        Nodeset model;
+        for (const auto& [name, value] : variables) {
+            model.nodes.addVariable(
+                rootId,
+                {1, std::string(name)},
+                name,
+                VariableAttributes{}.setDataType<int32_t>().setValueScalar(value)
+            );
+        }
+        return model;
+    };
+
+    auto changes = server.applyModel(rootId, createModel({{"A", 1}, {"B", 2}}));
+    CHECK(changes.addedNodes == std::vector<NodeId>{{1, "A"}, {1, "B"}});
+    CHECK(changes.deletedNodes.empty());
+    CHECK(changes.addResult.isGood());
+    CHECK(server.getNode({1, "B"}).readValueScalar<int32_t>() == 2);
+
+    SUBCASE("Unchanged") {
+        changes = server.applyModel(rootId, createModel({{"A", 1}, {"B", 2}}));
+        CHECK(changes.empty());
+    }
+
+    SUBCASE("Add, update and delete") {
+        changes = server.applyModel(rootId, createModel({{"B", 3}, {"C", 4}}));
+        CHECK(changes.addedNodes == std::vector<NodeId>{{1, "C"}});
+        CHECK(changes.deletedNodes == std::vector<NodeId>{{1, "A"}});
+        CHECK(changes.updatedNodes == std::vector<NodeId>{{1, "B"}});
+        CHECK(server.getNode({1, "B"}).readValueScalar<int32_t>() == 3);
+        CHECK(server.getNode({1, "C"}).readValueScalar<int32_t>() == 4);
+        CHECK_THROWS_WITH(server.getNode({1, "A"}).readValueScalar<int32_t>(), "BadNodeIdUnknown");
+    }
+
+    SUBCASE("Replace node class") {
+        Nodeset model = createModel({{"A", 1}});
+        model.nodes.addObject(rootId, {1, "B"}, "B");
+        changes = server.applyModel(rootId, std::move(model));
+        CHECK(changes.deletedNodes == std::vector<NodeId>{{1, "B"}});
+        CHECK(changes.addedNodes == std::vector<NodeId>{{1, "B"}});
+        CHECK(server.getNode({1, "B"}).readNodeClass() == NodeClass::Object);
+    }
+}
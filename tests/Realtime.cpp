@@ -0,0 +1,90 @@
+#include <chrono>
+#include <thread>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Config.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Realtime.h"
+#include "open62541pp/Server.h"
+
+#include "helper/Runner.h"
+#include "open62541_impl.h"  // UA_Server_addRepeatedCallback
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+TEST_CASE("Realtime profile") {
+    Server server;
+    CHECK(server.getRealtimeStatistics().poolBytes == 0);
+
+    RealtimeOptions options;
+    options.maxSessions = 2;
+    options.maxMonitoredItems = 10;
+    options.maxQueueSize = 2;
+    options.warmupIterations = 10;
+    options.violationAction = RealtimeViolationAction::Count;
+    server.enableRealtime(options);
+
+    SUBCASE("Preallocated pool") {
+        const auto stats = server.getRealtimeStatistics();
+        CHECK(stats.poolBytes > 0);
+        CHECK(stats.blocksInUse == 0);
+        CHECK(stats.iterations == 0);
+    }
+
+    SUBCASE("Iterations") {
+        for (int i = 0; i < 20; ++i) {
+            server.runIterate();
+        }
+        const auto stats = server.getRealtimeStatistics();
+        CHECK(stats.iterations == 20);
+        CHECK(stats.violations <= stats.poolMisses);
+        CHECK_THROWS_WITH(server.enableRealtime(options), "BadInvalidState");
+    }
+
+    SUBCASE("Pool misses after the warm-up are violations") {
+        for (uint64_t i = 0; i < options.warmupIterations; ++i) {
+            server.runIterate();
+        }
+        const auto before = server.getRealtimeStatistics();
+
+        // larger than the largest block size of the pool
+        UA_UInt64 callbackId = 0;
+        const auto allocate = [](UA_Server*, void*) {
+            void* data = UA_malloc(1024 * 1024);  // NOLINT
+            UA_free(data);  // NOLINT
+        };
+        REQUIRE(
+            UA_Server_addRepeatedCallback(server.handle(), allocate, nullptr, 1.0, &callbackId) ==
+            UA_STATUSCODE_GOOD
+        );
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (server.getRealtimeStatistics().violations == before.violations &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            server.runIterate();
+        }
+        UA_Server_removeCallback(server.handle(), callbackId);
+
+        const auto stats = server.getRealtimeStatistics();
+        CHECK(stats.poolMisses > before.poolMisses);
+        CHECK(stats.violations > before.violations);
+    }
+
+    SUBCASE("Serve client requests from the pool") {
+        {
+            ServerRunner serverRunner(server);
+            Client client;
+            client.connect("opc.tcp://localhost:4840");
+            for (int i = 0; i < 10; ++i) {
+                client.getNode(VariableId::Server_ServerStatus_CurrentTime).readValue();
+            }
+        }
+        const auto stats = server.getRealtimeStatistics();
+        CHECK(stats.iterations > 0);
+        CHECK(stats.poolAllocations > 0);
+    }
+}
+#endif
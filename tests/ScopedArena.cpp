@@ -0,0 +1,91 @@
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/ScopedArena.h"
+#include "open62541pp/types/Builtin.h"
+#include "open62541pp/types/DataValue.h"
+#include "open62541pp/types/Variant.h"
+
+#include "open62541_impl.h"
+
+using namespace opcua;
+
+#ifdef UA_ENABLE_MALLOC_SINGLETON
+TEST_CASE("ScopedArena") {
+    SUBCASE("Allocations") {
+        CHECK(ScopedArena::getCurrent() == nullptr);
+        ScopedArena arena(256);
+        CHECK(ScopedArena::getCurrent() == &arena);
+
+        void* ptr = UA_malloc(10);
+        CHECK(arena.contains(ptr));
+        CHECK(arena.getAllocatedBytes() >= 10);
+        UA_free(ptr);  // no-op
+
+        // oversized allocation
+        void* large = UA_calloc(1, 1000);
+        CHECK(arena.contains(large));
+        CHECK(static_cast<char*>(large)[999] == 0);  // NOLINT
+
+        // realloc preserves content
+        auto* str = static_cast<char*>(UA_malloc(4));
+        std::memcpy(str, "abc", 4);
+        str = static_cast<char*>(UA_realloc(str, 64));
+        CHECK(std::string(str) == "abc");
+    }
+
+    SUBCASE("Wrapper types") {
+        String outside("created outside of the arena");
+        {
+            ScopedArena arena;
+            const String inside("created inside of the arena");
+            CHECK(arena.contains(inside->data));
+            CHECK_FALSE(arena.contains(outside->data));
+
+            std::vector<DataValue> batch(100);
+            for (auto& dv : batch) {
+                dv.setValue(Variant::fromScalar(std::string("value")));
+            }
+            CHECK(arena.contains(batch[0].getValue().data()));
+
+            // modify and free objects allocated outside the arena
+            outside = String("reassigned inside of the arena");
+            CHECK(arena.contains(outside->data));
+            outside = String();
+        }
+        CHECK(ScopedArena::getCurrent() == nullptr);
+        outside = String("after the arena");
+        CHECK(std::string(outside.get()) == "after the arena");
+    }
+
+    SUBCASE("Nested") {
+        ScopedArena outer;
+        void* ptr = UA_malloc(8);
+        {
+            ScopedArena inner;
+            CHECK(inner.getCurrent() == &inner);
+            UA_free(ptr);  // no-op, owned by outer arena
+            CHECK(inner.contains(UA_malloc(8)));
+        }
+        CHECK(ScopedArena::getCurrent() == &outer);
+    }
+
+    SUBCASE("Nested realloc of outer allocation") {
+        ScopedArena outer;
+        auto* str = static_cast<char*>(UA_malloc(4));
+        std::memcpy(str, "abc", 4);
+        {
+            ScopedArena inner;
+            str = static_cast<char*>(UA_realloc(str, 1000));
+            CHECK(outer.contains(str));
+            CHECK_FALSE(inner.contains(str));
+            std::memset(str + 3, 'x', 996);  // NOLINT
+            str[999] = '\0';  // NOLINT
+        }
+        CHECK(std::string(str) == "abc" + std::string(996, 'x'));
+    }
+}
+#endif
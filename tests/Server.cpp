@@ -1,16 +1,76 @@
+#include <algorithm>  // count, find_if
+#include <atomic>
 #include <chrono>
+#include <cstring>  // memcmp
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>  // runtime_error
+#include <string>
+#include <string_view>
 #include <thread>
+#include <utility>  // pair
+#include <vector>
 
 #include <doctest/doctest.h>
 
+#include "open62541pp/Client.h"
+#include "open62541pp/NamespaceTable.h"
 #include "open62541pp/Node.h"
+#include "open62541pp/ObjectTemplate.h"
+#include "open62541pp/PubSub.h"
+#include "open62541pp/ReverseConnect.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/ServerGroup.h"
+#include "open62541pp/ThreadConfig.h"
 #include "open62541pp/ValueBackend.h"
+#include "open62541pp/ValuePublisher.h"
+#include "open62541pp/VirtualNodes.h"
 #include "open62541pp/detail/helper.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/NodeManagement.h"
 #include "open62541pp/types/NodeId.h"
 
+#include "EpollNetworkLayer.h"  // UAPP_EPOLL_NETWORK_LAYER
+#include "SharedMemoryTransport.h"  // UAPP_SHARED_MEMORY_TRANSPORT
 #include "open62541_impl.h"
 
+#include "helper/Runner.h"
+
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+#include <netinet/in.h>
+#include <netinet/tcp.h>  // TCP_NODELAY
+#include <sys/socket.h>
+
+/// Find the server socket of a local connection by the address of the client socket.
+static int findPeerSocket(int clientFd) {
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-reinterpret-cast)
+    sockaddr_storage clientAddr{};
+    socklen_t clientLength = sizeof(clientAddr);
+    ::getsockname(clientFd, reinterpret_cast<sockaddr*>(&clientAddr), &clientLength);
+    for (int fd = 0; fd < 4096; ++fd) {
+        sockaddr_storage peerAddr{};
+        socklen_t peerLength = sizeof(peerAddr);
+        if (fd == clientFd ||
+            ::getpeername(fd, reinterpret_cast<sockaddr*>(&peerAddr), &peerLength) != 0) {
+            continue;
+        }
+        if (peerLength == clientLength && std::memcmp(&peerAddr, &clientAddr, peerLength) == 0) {
+            return fd;
+        }
+    }
+    return -1;
+    // NOLINTEND(cppcoreguidelines-pro-type-reinterpret-cast)
+}
+#endif
+
 using namespace std::chrono_literals;
 using namespace opcua;
 
@@ -28,6 +88,77 @@ TEST_CASE("Server constructors") {
     }
 }
 
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+TEST_CASE("Server with read-optimized nodestore") {
+    Server server(4840, {}, NodestoreType::ReadOptimized);
+
+    // namespace 0 built with the custom nodestore
+    CHECK(server.getObjectsNode().readBrowseName() == QualifiedName(0, "Objects"));
+
+    auto node = server.getObjectsNode().addVariable({1, 1000}, "variable");
+    node.writeValueScalar(11.11);  // replaces the node copy
+    CHECK(node.readValueScalar<double>() == 11.11);
+    CHECK(server.getObjectsNode().browseChild({{1, "variable"}}) == node);
+
+    // numeric ids assigned by the nodestore
+    auto assigned = server.getObjectsNode().addObject({1, 0}, "object");
+    CHECK(assigned.getNodeId() != NodeId(1, 0));
+    CHECK(server.getNode(assigned.getNodeId()).readBrowseName() == QualifiedName(1, "object"));
+
+    CHECK_THROWS_WITH(
+        server.getObjectsNode().addVariable({1, 1000}, "duplicate"), "BadNodeIdExists"
+    );
+
+    node.deleteNode();
+    CHECK_THROWS_WITH(node.readValueScalar<double>(), "BadNodeIdUnknown");
+
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+    CHECK(client.getNode(assigned.getNodeId()).readBrowseName() == QualifiedName(1, "object"));
+}
+
+TEST_CASE("Server with shared namespace zero") {
+    Server server1(4840, {}, NodestoreType::SharedNamespaceZero);
+    Server server2(4841, {}, NodestoreType::SharedNamespaceZero);
+
+    for (auto* server : {&server1, &server2}) {
+        CHECK(server->getObjectsNode().readBrowseName() == QualifiedName(0, "Objects"));
+        CHECK(server->getNode(ObjectId::Server).readBrowseName() == QualifiedName(0, "Server"));
+    }
+
+    SUBCASE("Edits are private to a server") {
+        server1.getNode(VariableId::Server_Auditing).writeValueScalar(true);
+        CHECK(server1.getNode(VariableId::Server_Auditing).readValueScalar<bool>() == true);
+        CHECK(server2.getNode(VariableId::Server_Auditing).readValueScalar<bool>() == false);
+    }
+
+    SUBCASE("Removed nodes are private to a server") {
+        server1.getNode(VariableId::Server_Auditing).deleteNode();
+        CHECK_THROWS_WITH(
+            server1.getNode(VariableId::Server_Auditing).readValueScalar<bool>(),
+            "BadNodeIdUnknown"
+        );
+        CHECK(server2.getNode(VariableId::Server_Auditing).readValueScalar<bool>() == false);
+        CHECK_NOTHROW(
+            server1.getNode(ObjectId::Server).addVariable(VariableId::Server_Auditing, "Auditing")
+        );
+    }
+
+    SUBCASE("Further servers use the shared namespace zero") {
+        Server server3(4842, {}, NodestoreType::SharedNamespaceZero);
+        server3.getObjectsNode().addObject({1, 1000}, "object");
+        CHECK(server3.getObjectsNode().browseChild({{1, "object"}}).getNodeId() == NodeId(1, 1000));
+        CHECK(server3.getNode(ObjectId::Server).readBrowseName() == QualifiedName(0, "Server"));
+    }
+
+    ServerRunner serverRunner(server2);
+    Client client;
+    client.connect("opc.tcp://localhost:4841");
+    CHECK(client.getNode(ObjectId::Server).readBrowseName() == QualifiedName(0, "Server"));
+}
+#endif
+
 #ifdef UA_ENABLE_ENCRYPTION
 TEST_CASE("Server encryption") {
     Server server(
@@ -43,6 +174,267 @@ TEST_CASE("Server encryption") {
 }
 #endif
 
+TEST_CASE("Server network backend") {
+    Server server;
+    CHECK(server.getNetworkFd() == -1);
+    server.setNetworkBackend(NetworkBackend::Default);  // no-op
+    CHECK(server.getNetworkFd() == -1);
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    TransportConfig transport;
+    transport.recvBufferSize = 1 << 17;
+    transport.noDelay = false;
+    transport.socketSendBufferSize = 1 << 18;
+    server.setTransportConfig(transport);
+    server.setNetworkBackend(NetworkBackend::Epoll);
+    CHECK(server.getNetworkFd() >= 0);
+    auto* config = UA_Server_getConfig(server.handle());
+    CHECK(config->networkLayers[0].localConnectionConfig.recvBufferSize == 1 << 17);
+
+    SUBCASE("Switch back to default backend") {
+        server.setNetworkBackend(NetworkBackend::Default);
+        CHECK(server.getNetworkFd() == -1);
+        CHECK(config->networkLayers[0].localConnectionConfig.recvBufferSize == 1 << 17);
+    }
+
+    SUBCASE("Connect clients") {
+        const NodeId id{1, 1000};
+        services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+        services::writeValue(server, id, Variant::fromScalar(11.11));
+
+        ServerRunner serverRunner(server);
+        std::vector<Client> clients(10);
+        for (auto& client : clients) {
+            client.connect("opc.tcp://localhost:4840");
+        }
+        for (auto& client : clients) {
+            CHECK(services::readValue(client, id).getScalarCopy<double>() == 11.11);
+        }
+
+        // socket options of the accepted connections
+        const int fd = findPeerSocket(clients.front().getSocketFd());
+        REQUIRE(fd >= 0);
+        int value = -1;
+        socklen_t length = sizeof(value);
+        CHECK(::getsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &value, &length) == 0);
+        CHECK(value == 0);
+        CHECK(::getsockopt(fd, SOL_SOCKET, SO_SNDBUF, &value, &length) == 0);
+        CHECK(value >= 1 << 18);  // doubled by Linux
+
+        clients.front().disconnect();
+        CHECK(services::readValue(clients.back(), id).getScalarCopy<double>() == 11.11);
+    }
+
+    SUBCASE("Set backend while running") {
+        server.runIterate();
+        CHECK_THROWS_WITH(server.setNetworkBackend(NetworkBackend::Default), "BadInvalidState");
+        server.stop();
+    }
+#else
+    CHECK_THROWS_WITH(server.setNetworkBackend(NetworkBackend::Epoll), "BadNotSupported");
+#endif
+}
+
+TEST_CASE("ServerGroup") {
+    ServerGroupOptions options;
+    options.threads = 2;
+    ServerGroup group(options);
+
+    std::mutex mutex;
+    std::vector<size_t> logged(3, 0);
+    group.setLogger([&](size_t server, LogLevel, LogCategory, std::string_view) {
+        const std::lock_guard lock(mutex);  // serialized anyway
+        ++logged.at(server);
+    });
+
+    for (uint16_t i = 0; i < 3; ++i) {
+        auto& server = group.addServer(4860 + i);
+        server.getObjectsNode().addVariable({1, 1000}, "variable").writeValueScalar<int>(i);
+    }
+    CHECK(group.size() == 3);
+    CHECK_THROWS(group.getServer(3));
+
+    group.start();
+    CHECK(group.isRunning());
+    CHECK_THROWS_WITH(group.addServer(4863), "BadInvalidState");
+    for (size_t i = 0; i < group.size(); ++i) {
+        CHECK(group.getServer(i).isRunning());
+    }
+
+    SUBCASE("Connect clients") {
+        for (uint16_t i = 0; i < 3; ++i) {
+            Client client;
+            client.connect("opc.tcp://localhost:" + std::to_string(4860 + i));
+            CHECK(client.getNode({1, 1000}).readValueScalar<int>() == i);
+        }
+    }
+
+    SUBCASE("Post commands") {
+        auto future = group.getServer(1).execute([&] {
+            return group.getServer(1).getNode({1, 1000}).readValueScalar<int>();
+        });
+        CHECK(future.get() == 1);
+    }
+
+    group.stop();
+    CHECK_FALSE(group.isRunning());
+    for (size_t i = 0; i < group.size(); ++i) {
+        CHECK_FALSE(group.getServer(i).isRunning());
+        CHECK(logged[i] > 0);
+    }
+}
+
+TEST_CASE("Server shared memory transport") {
+    Server server;
+#ifdef UAPP_SHARED_MEMORY_TRANSPORT
+    CHECK_THROWS_WITH(server.addSharedMemoryTransport(""), "BadInvalidArgument");
+    CHECK_THROWS_WITH(server.addSharedMemoryTransport("a/b"), "BadInvalidArgument");
+
+    const NodeId id{1, 1000};
+    services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    services::writeValue(server, id, Variant::fromScalar(11.11));
+
+    SharedMemoryOptions options;
+    options.maxConnections = 2;
+    options.ringSize = 4096;  // messages larger than the ring are streamed
+
+    SUBCASE("Alongside TCP") {
+        server.addSharedMemoryTransport("uapp-test", options);
+        auto* config = UA_Server_getConfig(server.handle());
+        CHECK(config->networkLayersSize == 2);
+
+        ServerRunner serverRunner(server);
+        Client tcpClient;
+        tcpClient.connect("opc.tcp://localhost:4840");
+        Client shmClient;
+        shmClient.connect("opc.shm://uapp-test");
+        CHECK(shmClient.getSocketFd() == -1);
+        CHECK(services::readValue(shmClient, id).getScalarCopy<double>() == 11.11);
+        CHECK(services::readValue(tcpClient, id).getScalarCopy<double>() == 11.11);
+
+        const std::vector<double> array(10000, 1.0);
+        services::writeValue(shmClient, id, Variant::fromArray(array));
+        CHECK(services::readValue(shmClient, id).getArrayCopy<double>() == array);
+
+        // all slots in use
+        Client second;
+        second.connect("opc.shm://uapp-test");
+        Client third;
+        CHECK_THROWS(third.connect("opc.shm://uapp-test"));
+
+        // slot is freed after disconnect
+        second.disconnect();
+        third.connect("opc.shm://uapp-test");
+        CHECK(services::readValue(third, id).getScalarCopy<double>() == 11.11);
+    }
+
+    SUBCASE("Exclusive") {
+        options.exclusive = true;
+        server.addSharedMemoryTransport("uapp-test", options);
+        auto* config = UA_Server_getConfig(server.handle());
+        CHECK(config->networkLayersSize == 1);
+
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect("opc.shm://uapp-test");
+        CHECK(services::readValue(client, id).getScalarCopy<double>() == 11.11);
+        Client tcpClient;
+        CHECK_THROWS(tcpClient.connect("opc.tcp://localhost:4840"));
+    }
+
+    SUBCASE("Unknown name") {
+        ServerRunner serverRunner(server);
+        Client client;
+        CHECK_THROWS(client.connect("opc.shm://uapp-unknown"));
+    }
+
+    SUBCASE("Invalid ring size") {
+        server.addSharedMemoryTransport("uapp-test", options);
+        ServerRunner serverRunner(server);
+
+        // header: magic, version, slot count, ring size
+        const int fd = ::shm_open("/uapp-uapp-test", O_RDWR, 0);
+        REQUIRE(fd >= 0);
+        void* base = ::mmap(nullptr, 16, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+        ::close(fd);
+        REQUIRE(base != MAP_FAILED);
+        auto* ringSize = static_cast<uint32_t*>(base) + 3;  // NOLINT
+        REQUIRE(*ringSize == 4096);
+
+        std::vector<std::string> warnings;
+        Client client;
+        client.setLogger([&](LogLevel level, LogCategory, std::string_view message) {
+            if (level == LogLevel::Warning) {
+                warnings.emplace_back(message);
+            }
+        });
+        for (const uint32_t invalid : {0U, 3000U, 8192U}) {
+            *ringSize = invalid;
+            CHECK_THROWS(client.connect("opc.shm://uapp-test"));
+        }
+        CHECK(std::count(
+                  warnings.begin(),
+                  warnings.end(),
+                  "Invalid shared memory segment of the endpoint"
+              ) == 3);
+
+        *ringSize = 4096;
+        client.connect("opc.shm://uapp-test");
+        CHECK(services::readValue(client, id).getScalarCopy<double>() == 11.11);
+        ::munmap(base, 16);
+    }
+
+    SUBCASE("Add transport while running") {
+        server.runIterate();
+        CHECK_THROWS_WITH(server.addSharedMemoryTransport("uapp-test"), "BadInvalidState");
+        server.stop();
+    }
+#else
+    CHECK_THROWS_WITH(server.addSharedMemoryTransport("uapp-test"), "BadNotSupported");
+#endif
+}
+
+TEST_CASE("Server reverse connect") {
+    Server server;
+    CHECK_THROWS_WITH(server.addReverseConnect("opc.tcp://localhost:4841"), "BadNotSupported");
+
+#ifdef UAPP_EPOLL_NETWORK_LAYER
+    server.setNetworkBackend(NetworkBackend::Epoll);
+    CHECK_THROWS_WITH(server.addReverseConnect("http://localhost"), "BadTcpEndpointUrlInvalid");
+    CHECK_THROWS_WITH(server.removeReverseConnect(1), "BadNotFound");
+
+    const NodeId id{1, 1000};
+    services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    services::writeValue(server, id, Variant::fromScalar(11.11));
+
+    ReverseConnectListener listener(0, 2);
+    std::atomic<int> activated{0};
+    std::promise<double> value;
+    listener.onSessionActivated([&](Client& client, const ReverseHello& hello) {
+        CHECK_FALSE(hello.serverUri.empty());
+        CHECK(hello.endpointUrl.rfind("opc.tcp://", 0) == 0);
+        if (activated++ == 0) {
+            value.set_value(services::readValue(client, id).getScalarCopy<double>());
+        }
+    });
+    listener.start();
+    CHECK(listener.getPort() != 0);
+
+    ServerRunner serverRunner(server);
+    const auto url = "opc.tcp://localhost:" + std::to_string(listener.getPort());
+    const auto reverseId = server.addReverseConnect(url);
+    auto future = value.get_future();
+    REQUIRE(future.wait_for(std::chrono::seconds(5)) == std::future_status::ready);
+    CHECK(future.get() == 11.11);
+    CHECK(listener.getSessionCount() == 1);
+    CHECK(server.getSessionCount() == 1);
+
+    server.removeReverseConnect(reverseId);
+    CHECK_THROWS_WITH(server.removeReverseConnect(reverseId), "BadNotFound");
+    listener.stop();
+#endif
+}
+
 TEST_CASE("Server equality operators") {
     Server server;
     CHECK(server == server);
@@ -79,6 +471,62 @@ TEST_CASE("Server run/stop/runIterate") {
         server.stop();
         CHECK_FALSE(server.isRunning());
     }
+
+    SUBCASE("Run in background fails") {
+        // the repeated callback for queued commands is rejected with a zero interval
+        CHECK_THROWS_AS(server.runInBackground(0), BadStatus);
+        CHECK_FALSE(server.isRunning());
+        // startup was rolled back, the server can be started again
+        server.runInBackground(10);
+        CHECK(server.isRunning());
+        server.stop();
+        CHECK_FALSE(server.isRunning());
+    }
+
+    SUBCASE("Run in background") {
+        server.setLogger({});  // disable logging to prevent data races
+        server.runInBackground(1);
+        CHECK(server.isRunning());
+
+        // write values concurrently from multiple threads
+        const NodeId id{1, 1000};
+        server.execute([&] {
+            services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+        }).get();
+
+        std::vector<std::thread> threads;
+        for (int32_t t = 0; t < 4; ++t) {
+            threads.emplace_back([&, t] {
+                for (int32_t i = 0; i < 100; ++i) {
+                    server.post([&, value = 100 * t + i] {
+                        services::writeValue(server, id, Variant::fromScalar(value));
+                    });
+                }
+            });
+        }
+        for (auto& thread : threads) {
+            thread.join();
+        }
+
+        auto future = server.execute([&] { return services::readValue(server, id); });
+        CHECK(future.get().isType(Type::Int32));
+
+        auto futureException = server.execute([&] {
+            return services::readValue(server, {1, "unknown"});
+        });
+        CHECK_THROWS_AS(futureException.get(), BadStatus);
+
+        server.stop();
+        CHECK_FALSE(server.isRunning());
+    }
+
+    SUBCASE("Post commands without background thread") {
+        bool executed = false;
+        server.post([&] { executed = true; });
+        CHECK_FALSE(executed);
+        server.runIterate();
+        CHECK(executed);
+    }
 }
 
 TEST_CASE("Server configuration") {
@@ -100,6 +548,57 @@ TEST_CASE("Server configuration") {
         CHECK(detail::toString(config->applicationDescription.productUri) == "http://product.com");
     }
 
+    SUBCASE("Set transport config / secure channel options") {
+        auto* config = UA_Server_getConfig(server.handle());
+        REQUIRE(config->networkLayersSize > 0);
+
+        TransportConfig transport;
+        transport.sendBufferSize = 1 << 20;
+        transport.maxChunkCount = 16;
+        server.setTransportConfig(transport);
+        CHECK(config->networkLayers[0].localConnectionConfig.sendBufferSize == 1 << 20);
+        CHECK(config->networkLayers[0].localConnectionConfig.localMaxChunkCount == 16);
+
+        SecureChannelOptions options;
+        options.chunkSize = 1 << 18;
+        options.lifetime = 60'000;
+        server.setSecureChannelOptions(options);
+        CHECK(config->networkLayers[0].localConnectionConfig.sendBufferSize == 1 << 18);
+        CHECK(config->networkLayers[0].localConnectionConfig.recvBufferSize == 1 << 18);
+        CHECK(config->networkLayers[0].localConnectionConfig.localMaxChunkCount == 16);
+        CHECK(config->maxSecurityTokenLifetime == 60'000);
+    }
+
+    SUBCASE("Set limits") {
+        auto* config = UA_Server_getConfig(server.handle());
+        ServerLimits limits;
+        limits.maxNodesPerRead = 100;
+        limits.maxNodesPerWrite = 50;
+        limits.maxSessions = 10;
+        server.setLimits(limits);
+        CHECK(config->maxNodesPerRead == 100);
+        CHECK(config->maxNodesPerWrite == 50);
+        CHECK(config->maxSessions == 10);
+        const auto advertised = services::readValue(
+            server, VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead
+        );
+        CHECK(advertised.getScalarCopy<uint32_t>() == 100);
+
+#if defined(UA_ENABLE_SUBSCRIPTIONS) && UAPP_OPEN62541_VER_GE(1, 1)
+        ServerLimits quota;
+        quota.monitoredItemQueueMemory = 1 << 20;
+        CHECK_THROWS_WITH(server.setLimits(quota), "BadInvalidArgument");  // maxMonitoredItems
+
+        quota.maxMonitoredItems = 1024;
+        quota.maxSubscriptionsPerSession = 5;
+        quota.estimatedNotificationSize = 256;
+        server.setLimits(quota);
+        CHECK(config->maxMonitoredItems == 1024);
+        CHECK(config->maxSubscriptionsPerSession == 5);
+        CHECK(config->queueSizeLimits.max == 4);  // 1 MiB / 1024 items / 256 bytes
+#endif
+    }
+
     SUBCASE("Namespace array") {
         const auto namespaces = server.getNamespaceArray();
         CHECK(namespaces.size() == 2);
@@ -115,6 +614,25 @@ TEST_CASE("Server configuration") {
         CHECK(server.getNamespaceArray().at(3) == "test2");
     }
 
+    SUBCASE("Namespace table") {
+        const auto table = server.getNamespaceTable();
+        CHECK(table->size() == 2);
+        CHECK(table->find("http://opcfoundation.org/UA/") == 0);
+        CHECK(table->getUri(1) == "urn:open62541.server.application");
+        CHECK_FALSE(table->find("test1").has_value());
+        CHECK_FALSE(table->getUri(2).has_value());
+        CHECK(server.getNamespaceTable() == table);  // cached
+
+        CHECK(server.registerNamespace("test1") == 2);
+        const auto refreshed = server.getNamespaceTable();
+        CHECK(refreshed != table);
+        CHECK(refreshed->find("test1") == 2);
+        CHECK(table->size() == 2);  // snapshot is not modified
+
+        CHECK(server.registerNamespace("test1") == 2);  // existing namespace
+        CHECK(server.getNamespaceTable() == refreshed);
+    }
+
     SUBCASE("Get default nodes") {
         // clang-format off
             CHECK_EQ(server.getRootNode().getNodeId(),    NodeId{0, UA_NS0ID_ROOTFOLDER});
@@ -162,6 +680,113 @@ TEST_CASE("ValueCallback") {
     CHECK(valueAfterWrite == 2);
 }
 
+TEST_CASE("ValueCallback minRefreshAge") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeValueScalar<int>(1);
+
+    int refreshes = 0;
+    ValueCallback valueCallback;
+    valueCallback.onBeforeRead = [&](const DataValue&) { ++refreshes; };
+    valueCallback.minRefreshAge = std::chrono::hours(1);
+    server.setVariableNodeValueCallback(id, valueCallback);
+
+    node.readValueScalar<int>();
+    node.readValueScalar<int>();
+    CHECK(refreshes == 1);
+}
+
+TEST_CASE("ValueCallbackGroup") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    for (const auto& id : ids) {
+        server.getObjectsNode().addVariable(id, "testVariable").writeValueScalar<int32_t>(0);
+    }
+
+    int refreshes = 0;
+    ValueCallbackGroup group;
+    group.onBeforeRead = [&](Span<const NodeId> groupIds) {
+        ++refreshes;
+        for (size_t i = 0; i < groupIds.size(); ++i) {
+            services::writeValue(
+                server, groupIds[i], Variant::fromScalar(static_cast<int32_t>(refreshes * 10 + i))
+            );
+        }
+    };
+    group.maxAge = std::chrono::hours(1);
+
+    SUBCASE("Single refresh for all nodes") {
+        server.setVariableNodeValueCallbackGroup(ids, group);
+        CHECK(services::readValue(server, ids[0]).getScalarCopy<int32_t>() == 10);
+        CHECK(services::readValue(server, ids[1]).getScalarCopy<int32_t>() == 11);
+        CHECK(services::readValue(server, ids[2]).getScalarCopy<int32_t>() == 12);
+        CHECK(refreshes == 1);
+
+        // node already read since the last refresh -> new refresh
+        CHECK(services::readValue(server, ids[1]).getScalarCopy<int32_t>() == 21);
+        CHECK(refreshes == 2);
+    }
+
+    SUBCASE("Minimum refresh age") {
+        group.minRefreshAge = std::chrono::hours(1);
+        server.setVariableNodeValueCallbackGroup(ids, group);
+        CHECK(services::readValue(server, ids[0]).getScalarCopy<int32_t>() == 10);
+        CHECK(services::readValue(server, ids[0]).getScalarCopy<int32_t>() == 10);
+        CHECK(refreshes == 1);
+    }
+}
+
+TEST_CASE("Server watchdog") {
+    Server server;
+    std::vector<WatchdogViolation> violations;
+
+    WatchdogOptions options;
+    options.stallBudget = 50ms;
+    options.checkInterval = 10ms;
+    options.callbackBudget = 1ms;
+    options.log = false;
+    options.onViolation = [&](const WatchdogViolation& violation) {
+        violations.push_back(violation);
+    };
+    server.enableWatchdog(options);
+
+    NodeId id{1, "Slow"};
+    auto node = server.getObjectsNode().addVariable(id, "Slow");
+    node.writeValueScalar<int>(1);
+    ValueCallback valueCallback;
+    valueCallback.onBeforeRead = [](const DataValue&) { std::this_thread::sleep_for(5ms); };
+    server.setVariableNodeValueCallback(id, valueCallback);
+
+    SUBCASE("Callback budget") {
+        node.readValueScalar<int>();
+        node.readValueScalar<int>();
+        REQUIRE(violations.size() == 2);
+        CHECK(violations[1].type == WatchdogViolationType::Callback);
+        CHECK(violations[1].callback == StatisticsCallback::ValueCallback);
+        CHECK(violations[1].nodeId == id);
+        CHECK(violations[1].duration >= 5ms);
+        CHECK(violations[1].count == 2);
+    }
+
+    SUBCASE("Event loop stall") {
+        server.runIterate();
+        std::this_thread::sleep_for(200ms);
+        server.runIterate();
+        const auto stall = std::find_if(violations.begin(), violations.end(), [](const auto& v) {
+            return v.type == WatchdogViolationType::Stall;
+        });
+        REQUIRE(stall != violations.end());
+        CHECK(stall->duration > 50ms);
+    }
+
+    SUBCASE("Disable") {
+        server.disableWatchdog();
+        node.readValueScalar<int>();
+        CHECK(violations.empty());
+    }
+}
+
 TEST_CASE("DataSource") {
     Server server;
     NodeId id{1, 1000};
@@ -190,6 +815,30 @@ TEST_CASE("DataSource") {
     CHECK(data == 1);
 }
 
+TEST_CASE("DataSource bulk registration") {
+    Server server;
+    constexpr int count = 100;
+
+    std::vector<int> data(count, 0);
+    std::vector<std::pair<NodeId, ValueBackendDataSource>> backends;
+    for (int i = 0; i < count; ++i) {
+        const NodeId id{1, static_cast<uint32_t>(1000 + i)};
+        server.getObjectsNode().addVariable(id, "testVariable");
+        ValueBackendDataSource dataSource;
+        dataSource.read = [&data, i](DataValue& value, const NumericRange&, bool) {
+            value.getValue().setScalar(data[i]);
+            return UA_STATUSCODE_GOOD;
+        };
+        backends.emplace_back(id, std::move(dataSource));
+    }
+
+    CHECK_NOTHROW(server.setVariableNodeValueBackends(backends));
+
+    data[42] = 42;
+    CHECK(server.getNode({1, 1042}).readValueScalar<int>() == 42);
+    CHECK(server.getNode({1, 1043}).readValueScalar<int>() == 0);
+}
+
 TEST_CASE("DataSource with empty callbacks") {
     Server server;
     NodeId id{1, 1000};
@@ -227,3 +876,749 @@ TEST_CASE("DataSource with exception in callback") {
         CHECK_THROWS_AS_MESSAGE(node.readValue(), BadStatus, "BadInternalError");
     }
 }
+
+TEST_CASE("DataSourceGroup") {
+    Server server;
+    const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 1002}};
+    for (const auto& id : ids) {
+        server.getObjectsNode().addVariable(id, "testVariable");
+    }
+
+    int batchReads = 0;
+    std::vector<NodeId> writtenIds;
+    ValueBackendDataSourceGroup group;
+    group.read = [&](Span<DataSourceGroupItem> items) {
+        ++batchReads;
+        for (size_t i = 0; i < items.size(); ++i) {
+            items[i].value.getValue().setScalarCopy(static_cast<int32_t>(i) + batchReads * 10);
+        }
+    };
+    group.write = [&](const NodeId& id, const DataValue&, const NumericRange&) -> StatusCode {
+        writtenIds.push_back(id);
+        return UA_STATUSCODE_GOOD;
+    };
+    group.maxAge = std::chrono::hours(1);
+    server.setVariableNodeValueBackendGroup(ids, group);
+
+    SUBCASE("Single batch read for all nodes") {
+        CHECK(services::readValue(server, ids[0]).getScalarCopy<int32_t>() == 10);
+        CHECK(services::readValue(server, ids[1]).getScalarCopy<int32_t>() == 11);
+        CHECK(services::readValue(server, ids[2]).getScalarCopy<int32_t>() == 12);
+        CHECK(batchReads == 1);
+
+        // node already served from current batch -> new batch
+        CHECK(services::readValue(server, ids[1]).getScalarCopy<int32_t>() == 21);
+        CHECK(batchReads == 2);
+    }
+
+    SUBCASE("Write discards current batch") {
+        CHECK(services::readValue(server, ids[0]).getScalarCopy<int32_t>() == 10);
+        services::writeValue(server, ids[1], Variant::fromScalar(int32_t{5}));
+        CHECK(writtenIds == std::vector<NodeId>{ids[1]});
+        CHECK(services::readValue(server, ids[2]).getScalarCopy<int32_t>() == 22);
+        CHECK(batchReads == 2);
+    }
+
+    SUBCASE("Exception in batch read") {
+        group.read = [](Span<DataSourceGroupItem>) {
+            throw BadStatus(UA_STATUSCODE_BADCOMMUNICATIONERROR);
+        };
+        server.setVariableNodeValueBackendGroup(ids, group);
+        CHECK_THROWS_AS_MESSAGE(
+            services::readValue(server, ids[0]), BadStatus, "BadCommunicationError"
+        );
+    }
+}
+
+namespace {
+struct CounterDataSource {
+    int32_t counter = 0;
+    std::shared_ptr<int> lifetime;  // tracks the lifetime of the data source object
+
+    StatusCode read(DataValue& value, const NumericRange&, bool) {
+        value.getValue().setScalarCopy(counter++);
+        return UA_STATUSCODE_GOOD;
+    }
+
+    StatusCode write(const DataValue& value, const NumericRange&) {
+        counter = value.getValue().getScalarCopy<int32_t>();
+        return UA_STATUSCODE_GOOD;
+    }
+};
+
+struct ReadOnlyDataSource {
+    StatusCode read(DataValue&, const NumericRange&, bool) {
+        throw BadStatus(UA_STATUSCODE_BADUNEXPECTEDERROR);
+    }
+};
+}  // namespace
+
+TEST_CASE("Typed DataSource") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+
+    SUBCASE("Read and write") {
+        server.setVariableNodeValueBackend(id, CounterDataSource{});
+        CHECK(node.readValueScalar<int32_t>() == 0);
+        CHECK(node.readValueScalar<int32_t>() == 1);
+        node.writeValueScalar<int32_t>(10);
+        CHECK(node.readValueScalar<int32_t>() == 10);
+    }
+
+    SUBCASE("Without write function and exception in read function") {
+        server.setVariableNodeValueBackend(id, ReadOnlyDataSource{});
+        CHECK_THROWS_AS_MESSAGE(node.readValue(), BadStatus, "BadUnexpectedError");
+        CHECK_THROWS_AS_MESSAGE(
+            node.writeValueScalar<int32_t>(1), BadStatus, "BadWriteNotSupported"
+        );
+    }
+
+    SUBCASE("Replace with other backend") {
+        CounterDataSource counter;
+        counter.lifetime = std::make_shared<int>(0);
+        const std::weak_ptr<int> lifetime = counter.lifetime;
+        server.setVariableNodeValueBackend(id, std::move(counter));
+        CHECK(!lifetime.expired());
+        ValueBackendDataSource dataSource;
+        dataSource.read = [&](DataValue& value, const NumericRange&, bool) -> StatusCode {
+            value.getValue().setScalarCopy(42);
+            return UA_STATUSCODE_GOOD;
+        };
+        server.setVariableNodeValueBackend(id, dataSource);
+        CHECK(node.readValueScalar<int32_t>() == 42);
+        CHECK(lifetime.expired());  // released with the replaced backend
+    }
+}
+
+#if UAPP_OPEN62541_VER_GE(1, 2)
+TEST_CASE("External value backend") {
+    Server server;
+    NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+
+    SUBCASE("Scalar") {
+        double value = 11.1;
+        server.setVariableNodeValueBackendExternal(id, &value);
+        CHECK(node.readValueScalar<double>() == 11.1);
+        value = 22.2;
+        CHECK(node.readValueScalar<double>() == 22.2);
+
+        // write into user memory
+        node.writeValueScalar(33.3);
+        CHECK(value == 33.3);
+        CHECK_THROWS_AS_MESSAGE(node.writeValueScalar(1), BadStatus, "BadTypeMismatch");
+    }
+
+    SUBCASE("Read-only scalar") {
+        const int32_t value = 42;
+        server.setVariableNodeValueBackendExternal(id, &value);
+        CHECK(node.readValueScalar<int32_t>() == 42);
+        CHECK_THROWS_AS_MESSAGE(
+            node.writeValueScalar<int32_t>(1), BadStatus, "BadWriteNotSupported"
+        );
+    }
+
+    SUBCASE("Array") {
+        std::vector<float> values{1.0F, 2.0F, 3.0F};
+        server.setVariableNodeValueBackendExternal(id, Span<float>(values));
+        CHECK(node.readValueArray<float>() == values);
+        values[1] = 22.0F;
+        CHECK(node.readValueArray<float>() == values);
+
+        const std::vector<float> newValues{4.0F, 5.0F, 6.0F};
+        node.writeValueArray(newValues);
+        CHECK(values == newValues);
+        CHECK_THROWS_AS_MESSAGE(
+            node.writeValueArray(std::vector<float>{1.0F}), BadStatus, "BadTypeMismatch"
+        );
+    }
+
+    SUBCASE("Status and source timestamp") {
+        double value = 1.0;
+        ValueBackendExternalStatus status;
+        server.setVariableNodeValueBackendExternal(id, &value, &status);
+        CHECK(node.readDataValue().getStatusCode() == UA_STATUSCODE_GOOD);
+        CHECK_FALSE(node.readDataValue().hasSourceTimestamp());
+
+        const auto timestamp = DateTime::now();
+        status.status = UA_STATUSCODE_UNCERTAININITIALVALUE;
+        status.sourceTimestamp = timestamp.get();
+        const auto dv = node.readDataValue();
+        CHECK(dv.getStatusCode() == UA_STATUSCODE_UNCERTAININITIALVALUE);
+        CHECK(dv.getSourceTimestamp().get() == timestamp.get());
+        CHECK(dv.getValue().getScalarCopy<double>() == 1.0);
+    }
+}
+#endif
+
+TEST_CASE("ValuePublisher") {
+    Server server;
+    const NodeId id1{1, 1000};
+    const NodeId id2{1, 1001};
+    auto node1 = server.getObjectsNode().addVariable(id1, "testVariable1");
+    auto node2 = server.getObjectsNode().addVariable(id2, "testVariable2");
+    node1.writeValueScalar(1.0);
+
+    const std::vector<NodeId> ids{id1, id2};
+
+    SUBCASE("Type mismatch") {
+        CHECK_THROWS_AS_MESSAGE(
+            server.createValuePublisher<int32_t>(ids), BadStatus, "BadTypeMismatch"
+        );
+    }
+
+    SUBCASE("Non-existing node") {
+        const std::vector<NodeId> invalidIds{{1, 9999}};
+        CHECK_THROWS_AS_MESSAGE(
+            server.createValuePublisher<double>(invalidIds), BadStatus, "BadNodeIdUnknown"
+        );
+    }
+
+    SUBCASE("Publish values") {
+        auto publisher = server.createValuePublisher<double>(ids);
+        CHECK(publisher.size() == 2);
+        CHECK(publisher.getNodeIds()[1] == id2);
+
+        // initialized with current values
+        CHECK(publisher.getValue(0) == 1.0);
+        CHECK(node1.readValueScalar<double>() == 1.0);
+        CHECK(node2.readValueScalar<double>() == 0.0);
+
+        const auto timestamp = DateTime::now();
+        publisher.publish(0, 11.1, timestamp);
+        publisher.publish(1, 22.2);
+        CHECK(node1.readValueScalar<double>() == 11.1);
+        CHECK(node2.readValueScalar<double>() == 22.2);
+        CHECK(node1.readDataValue().getSourceTimestamp().get() == timestamp.get());
+
+        const std::vector<double> values{33.3, 44.4};
+        publisher.publish(values, DateTime::now());
+        CHECK(node1.readValueScalar<double>() == 33.3);
+        CHECK(node2.readValueScalar<double>() == 44.4);
+
+        // read-only
+        CHECK_THROWS_AS_MESSAGE(node1.writeValueScalar(1.0), BadStatus, "BadWriteNotSupported");
+    }
+
+    SUBCASE("Publish from other thread") {
+        auto publisher = server.createValuePublisher<double>(ids);
+        std::thread producer([&] {
+            for (int i = 1; i <= 1000; ++i) {
+                publisher.publish(0, static_cast<double>(i));
+            }
+        });
+        double last = 0.0;
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (last < 1000.0 && std::chrono::steady_clock::now() < deadline) {
+            const auto current = node1.readValueScalar<double>();
+            CHECK(current >= last);
+            last = current;
+        }
+        producer.join();
+        CHECK(node1.readValueScalar<double>() == 1000.0);
+    }
+}
+
+TEST_CASE("ValueRefresh") {
+    std::atomic<int> refreshCount{0};  // outlives the server and its worker threads
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeValueScalar(0.0);
+    const auto waitForValue = [&](double value) {
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (node.readValueScalar<double>() < value &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(1ms);
+        }
+        return node.readValueScalar<double>() >= value;
+    };
+
+    SUBCASE("Type mismatch") {
+        CHECK_THROWS_AS_MESSAGE(
+            server.addValueRefresh<int32_t>(id, 10ms, [] { return 1; }),
+            BadStatus,
+            "BadTypeMismatch"
+        );
+    }
+
+    SUBCASE("Refresh in background") {
+        server.setValueRefreshThreads(2);
+        server.addValueRefresh<double>(id, 1ms, [&] {
+            return static_cast<double>(++refreshCount);
+        });
+        CHECK_THROWS_AS_MESSAGE(server.setValueRefreshThreads(1), BadStatus, "BadInvalidState");
+        CHECK_THROWS_AS_MESSAGE(server.setWorkerThreads(4), BadStatus, "BadInvalidState");
+
+        CHECK(waitForValue(3.0));
+        CHECK(refreshCount >= 3);
+        CHECK(node.readDataValue().hasSourceTimestamp());
+    }
+
+    SUBCASE("Refresh with shared worker thread count") {
+        server.setWorkerThreads(4);
+        server.addValueRefresh<double>(id, 1ms, [&] {
+            return static_cast<double>(++refreshCount);
+        });
+        CHECK(waitForValue(3.0));
+        CHECK(refreshCount >= 3);
+    }
+
+    SUBCASE("Refresh with worker thread config") {
+        ThreadConfig config;
+        config.name = "uapp-refresh";
+        server.setThreadConfig(ThreadRole::Worker, config);
+        server.addValueRefresh<double>(id, 1ms, [&] {
+            return static_cast<double>(++refreshCount);
+        });
+        CHECK_THROWS_AS_MESSAGE(
+            server.setThreadConfig(ThreadRole::Worker, config), BadStatus, "BadInvalidState"
+        );
+        CHECK_NOTHROW(server.setThreadConfig(ThreadRole::EventLoop, config));
+        CHECK(waitForValue(3.0));
+        CHECK(refreshCount >= 3);
+    }
+
+    SUBCASE("Exception in refresh function keeps previous value") {
+        server.addValueRefresh<double>(id, 1ms, []() -> double {
+            throw std::runtime_error("device offline");
+        });
+        std::this_thread::sleep_for(10ms);
+        CHECK(node.readValueScalar<double>() == 0.0);
+    }
+}
+
+TEST_CASE("ThreadConfig") {
+    const auto applyInThread = [](const ThreadConfig& config) {
+        StatusCode status;
+        std::thread([&] { status = applyThreadConfig(config, 1); }).join();
+        return status;
+    };
+
+    CHECK(applyInThread({}) == UA_STATUSCODE_GOOD);
+#ifdef __linux__
+    ThreadConfig config;
+    config.name = "uapp-thread-config-test";  // truncated
+    CHECK(applyInThread(config) == UA_STATUSCODE_GOOD);
+    config.cpus = {-1};
+    CHECK(applyInThread(config) == UA_STATUSCODE_BADINVALIDARGUMENT);
+#endif
+}
+
+#ifdef UA_ENABLE_HISTORIZING
+TEST_CASE("Historizing") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeValueScalar(0.0);
+    server.enableHistorizing(id, {3});
+
+    CHECK(node.readAccessLevel() & UA_ACCESSLEVELMASK_HISTORYREAD);
+    CHECK(services::readAttributeScalar<bool>(server, id, AttributeId::Historizing));
+
+    // source timestamps 1..5 seconds after the epoch, the first two values are overwritten
+    for (int i = 1; i <= 5; ++i) {
+        DataValue dv(Variant::fromScalar(static_cast<double>(i)));
+        dv.setSourceTimestamp(DateTime::fromUnixTime(i));
+        node.writeDataValue(dv);
+    }
+
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    std::vector<double> values;
+    auto readRaw = [&](DateTime startTime, DateTime endTime, uint32_t maxItems) {
+        values.clear();
+        const auto status = UA_Client_HistoryRead_raw(
+            client.handle(),
+            id.handle(),
+            [](UA_Client* /* client */,
+               const UA_NodeId* /* nodeId */,
+               UA_Boolean /* moreDataAvailable */,
+               const UA_ExtensionObject* data,
+               void* ctx) {
+                const auto* historyData = static_cast<const UA_HistoryData*>(
+                    data->content.decoded.data
+                );
+                for (size_t i = 0; i < historyData->dataValuesSize; ++i) {
+                    const auto& dv = asWrapper<DataValue>(historyData->dataValues[i]);  // NOLINT
+                    static_cast<std::vector<double>*>(ctx)->push_back(
+                        dv.getValue().getScalarCopy<double>()
+                    );
+                }
+                return UA_TRUE;  // continue with continuation point
+            },
+            startTime,
+            endTime,
+            UA_STRING_NULL,
+            false,
+            maxItems,
+            UA_TIMESTAMPSTORETURN_BOTH,
+            &values
+        );
+        detail::throwOnBadStatus(status);
+    };
+
+    SUBCASE("Forward") {
+        readRaw(DateTime::fromUnixTime(1), DateTime::fromUnixTime(5), 0);
+        CHECK(values == std::vector<double>{3.0, 4.0});
+    }
+
+    SUBCASE("Forward with continuation points") {
+        readRaw(DateTime::fromUnixTime(1), DateTime::fromUnixTime(10), 1);
+        CHECK(values == std::vector<double>{3.0, 4.0, 5.0});
+    }
+
+    SUBCASE("Reverse") {
+        readRaw(DateTime::fromUnixTime(10), DateTime::fromUnixTime(3), 0);
+        CHECK(values == std::vector<double>{5.0, 4.0});
+    }
+}
+#endif
+
+TEST_CASE("ObjectTemplate") {
+    Server server;
+    const NodeId typeId(1, "RobotType");
+    services::addObjectType(server, ObjectTypeId::BaseObjectType, typeId, "RobotType");
+    const auto speedId = services::addVariable(
+        server, typeId, {1, "RobotType.Speed"}, "Speed", VariableAttributes{}.setValueScalar(1.5)
+    );
+    services::addModellingRule(server, speedId, ModellingRule::Mandatory);
+    const auto motorId = services::addObject(server, typeId, {1, "RobotType.Motor"}, "Motor");
+    services::addModellingRule(server, motorId, ModellingRule::Mandatory);
+    const auto currentId = services::addVariable(server, motorId, {1, "Motor.Current"}, "Current");
+    services::addModellingRule(server, currentId, ModellingRule::Mandatory);
+    const auto extraId = services::addVariable(server, typeId, {1, "RobotType.Extra"}, "Extra");
+    services::addModellingRule(server, extraId, ModellingRule::Optional);
+
+    ObjectTemplate robot(server, typeId);
+    CHECK(robot.getObjectType() == typeId);
+    CHECK(robot.size() == 3);
+    const std::vector<QualifiedName> currentPath{{1, "Motor"}, {1, "Current"}};
+    CHECK(robot.contains(currentPath));
+    CHECK_FALSE(robot.contains(std::vector<QualifiedName>{{1, "Extra"}}));
+    CHECK_THROWS_WITH(robot.bind(std::vector<QualifiedName>{{1, "Extra"}}, {}), "BadNoMatch");
+
+    std::vector<NodeId> bound;
+    robot.bind(currentPath, [&](Server&, const NodeId& id) { bound.push_back(id); });
+
+    for (uint32_t i = 0; i < 2; ++i) {
+        const auto id = robot.instantiate(ObjectId::ObjectsFolder, {1, 100 + i}, "Robot");
+        auto instance = server.getNode(id);
+        const auto typeDefinitions = instance.browseReferencedNodes(
+            BrowseDirection::Forward, ReferenceTypeId::HasTypeDefinition
+        );
+        CHECK(typeDefinitions.at(0).getNodeId() == typeId);
+        CHECK(instance.browseChild({{1, "Speed"}}).readValueScalar<double>() == 1.5);
+        CHECK(instance.browseChild(currentPath).getNodeId() == bound.at(i));
+        CHECK_THROWS(instance.browseChild({{1, "Extra"}}));
+    }
+    CHECK(bound.size() == 2);
+}
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+TEST_CASE("Virtual nodes") {
+    class TagProvider : public VirtualNodeProvider {
+    public:
+        explicit TagProvider(uint16_t ns)
+            : ns_(ns) {}
+
+        std::vector<VirtualReference> getRootNodes() override {
+            return {{ReferenceTypeId::Organizes, {ns_, "Tags"}, {ns_, "Tags"}}};
+        }
+
+        std::optional<VirtualNode> getNode(const NodeId& id) override {
+            ++requests;
+            const auto name = std::string(std::string_view(id.getIdentifierAs<String>()));
+            VirtualNode node;
+            node.browseName = {ns_, name};
+            if (name == "Tags") {
+                node.typeDefinition = ObjectTypeId::FolderType;
+                node.parent = {ReferenceTypeId::Organizes, ObjectId::ObjectsFolder, {0, "Objects"}};
+                for (int i = 0; i < 1000; ++i) {
+                    const auto tag = "Tag" + std::to_string(i);
+                    node.children.push_back(
+                        {ReferenceTypeId::HasComponent, {ns_, tag}, {ns_, tag}}
+                    );
+                }
+                return node;
+            }
+            if (name.rfind("Tag", 0) != 0) {
+                return std::nullopt;
+            }
+            node.nodeClass = NodeClass::Variable;
+            node.typeDefinition = VariableTypeId::BaseDataVariableType;
+            node.variableAttributes.setDataType<int32_t>().setValueScalar(
+                std::stoi(name.substr(3))
+            );
+            node.parent = {ReferenceTypeId::HasComponent, {ns_, "Tags"}, {ns_, "Tags"}};
+            return node;
+        }
+
+        int requests = 0;
+
+    private:
+        uint16_t ns_;
+    };
+
+    Server server;
+    const auto ns = server.registerNamespace("urn:virtual");
+    auto provider = std::make_shared<TagProvider>(ns);
+    server.addVirtualNodes(ObjectId::ObjectsFolder, ns, provider, 2);
+    CHECK(server.getVirtualNodeCount(ns) == 0);
+    CHECK_THROWS_WITH(
+        server.addVirtualNodes(ObjectId::ObjectsFolder, ns, provider), "BadInvalidArgument"
+    );
+
+    auto tags = server.getNode(ObjectId::ObjectsFolder).browseChild({{ns, "Tags"}});
+    CHECK(tags.getNodeId() == NodeId(ns, "Tags"));
+    CHECK(tags.browseChildren(ReferenceTypeId::HasComponent).size() == 1000);
+    CHECK(tags.browseChild({{ns, "Tag42"}}).readValueScalar<int32_t>() == 42);
+    CHECK(server.getNode({ns, "Tag7"}).readValueScalar<int32_t>() == 7);
+    CHECK(server.getVirtualNodeCount(ns) == 2);
+    CHECK_THROWS_WITH(server.getNode({ns, "Unknown"}).readDisplayName(), "BadNodeIdUnknown");
+
+    // evicted nodes are requested again
+    const auto requests = provider->requests;
+    CHECK(server.getNode({ns, "Tag42"}).readValueScalar<int32_t>() == 42);
+    CHECK(provider->requests > requests);
+}
+#endif
+
+#if UAPP_OPEN62541_VER_EQ(1, 3)
+TEST_CASE("Server node profiler") {
+    Server server;
+    NodeProfilerOptions options;
+    options.sampleInterval = 1;
+    options.topCount = 10;
+    options.diagnosticNodeId = {1, "HotNodes"};
+    server.enableNodeProfiler(options);
+    CHECK_THROWS_WITH(server.enableNodeProfiler(), "BadInvalidState");
+
+    const NodeId hotId{1, "Hot"};
+    const NodeId warmId{1, "Warm"};
+    auto objects = server.getObjectsNode();
+    objects.addVariable(hotId, "Hot").writeValueScalar(1);
+    objects.addVariable(warmId, "Warm").writeValueScalar(1);
+    server.resetNodeProfiler();
+    CHECK(server.getHotNodes().empty());
+
+    for (int i = 0; i < 100; ++i) {
+        server.getNode(hotId).readValueScalar<int>();
+    }
+    for (int i = 0; i < 10; ++i) {
+        server.getNode(warmId).writeValueScalar(i);
+    }
+    server.getObjectsNode().browseChildren();
+
+    const auto hotNodes = server.getHotNodes();
+    REQUIRE(!hotNodes.empty());
+    CHECK(hotNodes.size() <= 10);
+    CHECK(hotNodes[0].id == hotId);
+    CHECK(hotNodes[0].count >= 100);
+    CHECK(hotNodes[0].getCount(NodeAccess::Read) >= 100);
+    const auto warm = std::find_if(hotNodes.begin(), hotNodes.end(), [&](const auto& hotNode) {
+        return hotNode.id == warmId;
+    });
+    REQUIRE(warm != hotNodes.end());
+    CHECK(warm->getCount(NodeAccess::Write) >= 10);
+
+    const auto report = server.getNode(options.diagnosticNodeId).readValueArray<std::string>();
+    CHECK(!report.empty());
+    CHECK(report.size() <= 10);
+}
+#endif
+
+#ifdef UA_ENABLE_PUBSUB
+TEST_CASE("PubSub publisher") {
+    Server server;
+    const NodeId variableId{1, "Temperature"};
+    services::addVariable(
+        server,
+        ObjectId::ObjectsFolder,
+        variableId,
+        "Temperature",
+        VariableAttributes{}.setDataType(DataTypeId::Double).setValueScalar(21.5)
+    );
+
+    PubSubConnection connection = server.addPubSubConnection({});
+    CHECK(!connection.getId().isNull());
+
+    PublishedDataSet dataSet = server.addPublishedDataSet("DataSet");
+    CHECK(!dataSet.addField(variableId, "Temperature").isNull());
+
+    PublishedDataSet rtDataSet = server.addPublishedDataSet("RealtimeDataSet");
+    DataValue counter = DataValue::fromScalar<uint32_t>(0);
+    CHECK(!rtDataSet.addField(counter, "Counter").isNull());
+
+    // the published data sets are received by a reader of the same connection (multicast loop)
+    const NodeId receivedId{1, "Received"};
+    const auto addReader = [&](uint16_t writerGroupId, uint16_t dataSetWriterId, NodeId dataType) {
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            receivedId,
+            "Received",
+            VariableAttributes{}.setDataType(dataType)
+        );
+        ReaderGroup readerGroup = connection.addReaderGroup({});
+        DataSetReaderConfig readerConfig;
+        readerConfig.writerGroupId = writerGroupId;
+        readerConfig.dataSetWriterId = dataSetWriterId;
+        readerConfig.fields = {{"Received", std::move(dataType), receivedId}};
+        readerGroup.addDataSetReader(readerConfig);
+        readerGroup.setOperational();
+        return readerGroup;
+    };
+    const auto receive = [&](auto predicate) {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (std::chrono::steady_clock::now() < deadline) {
+            server.runIterate();
+            const auto value = services::readValue(server, receivedId);
+            if (!value.isEmpty() && predicate(value)) {
+                return true;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return false;
+    };
+
+    SUBCASE("Writer group") {
+        ReaderGroup readerGroup = addReader(1, 1, DataTypeId::Double);
+        WriterGroupConfig config;
+        config.publishingInterval = 10;
+        WriterGroup group = connection.addWriterGroup(config);
+        CHECK(!group.addDataSetWriter(dataSet, 1).isNull());
+        CHECK_NOTHROW(group.setOperational());
+        CHECK(receive([](const Variant& value) { return value.getScalarCopy<double>() == 21.5; }));
+        CHECK_NOTHROW(group.setDisabled());
+        CHECK_NOTHROW(group.remove());
+        readerGroup.setDisabled();
+    }
+
+    SUBCASE("Writer group with fixed size messages") {
+        ReaderGroup readerGroup = addReader(2, 2, DataTypeId::UInt32);
+        WriterGroupConfig config;
+        config.writerGroupId = 2;
+        config.publishingInterval = 10;
+        config.rtLevel = PubSubRtLevel::FixedSize;
+        WriterGroup group = connection.addWriterGroup(config);
+        CHECK(!group.addDataSetWriter(rtDataSet, 2).isNull());
+        CHECK_NOTHROW(group.setOperational());
+        counter.getValue().getScalar<uint32_t>() = 1;  // updated in place
+        CHECK(receive([](const Variant& value) { return value.getScalarCopy<uint32_t>() == 1; }));
+        CHECK_NOTHROW(group.setDisabled());
+        readerGroup.setDisabled();
+    }
+
+    CHECK_NOTHROW(dataSet.remove());
+    CHECK_NOTHROW(connection.remove());
+}
+
+TEST_CASE("PubSub subscriber") {
+    Server server;
+    const NodeId positionId{1, "Position"};
+    const NodeId velocityId{1, "Velocity"};
+    const auto addVariable = [&](const NodeId& id, std::string_view name) {
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            id,
+            name,
+            VariableAttributes{}.setDataType(DataTypeId::Double).setValueScalar(0.0)
+        );
+    };
+    addVariable(positionId, "Position");
+    addVariable(velocityId, "Velocity");
+
+    PubSubConnection connection = server.addPubSubConnection({});
+
+    SUBCASE("Target variables") {
+        ReaderGroup group = connection.addReaderGroup({});
+        DataSetReaderConfig config;
+        config.fields = {{"Position", DataTypeId::Double, positionId}};
+        DataSetReader reader = group.addDataSetReader(config);
+        CHECK(!reader.getId().isNull());
+        CHECK_NOTHROW(group.setOperational());
+        server.runIterate();
+        CHECK_NOTHROW(group.setDisabled());
+        CHECK_NOTHROW(reader.remove());
+        CHECK_NOTHROW(group.remove());
+    }
+
+    SUBCASE("User memory with fixed size messages") {
+        struct Axis {
+            double position;
+            double velocity;
+        } axis{1.0, 2.0};
+
+        DataValue position(Variant::fromScalar(axis.position));
+        DataValue velocity(Variant::fromScalar(axis.velocity));
+        ReaderGroup group = connection.addReaderGroup({"ReaderGroup", PubSubRtLevel::FixedSize});
+        DataSetReaderConfig config;
+        config.fields = {
+            {"Position", DataTypeId::Double, positionId, &position},
+            {"Velocity", DataTypeId::Double, velocityId, &velocity},
+        };
+        config.onMessage = [] {};
+        CHECK(!group.addDataSetReader(config).getId().isNull());
+
+        // target variables mirror the user memory
+        axis.position = 3.0;
+        CHECK(services::readValue(server, positionId).getScalarCopy<double>() == 3.0);
+
+        CHECK_NOTHROW(group.setOperational());
+        server.runIterate();
+        CHECK_NOTHROW(group.setDisabled());
+    }
+
+    SUBCASE("Publish and receive") {
+        const NodeId setpointId{1, "Setpoint"};
+        addVariable(setpointId, "Setpoint");
+        services::writeValue(server, setpointId, Variant::fromScalar(42.0));
+
+        PublishedDataSet dataSet = server.addPublishedDataSet("DataSet");
+        dataSet.addField(setpointId, "Setpoint");
+        WriterGroupConfig writerGroupConfig;
+        writerGroupConfig.publishingInterval = 10;
+        WriterGroup writerGroup = connection.addWriterGroup(writerGroupConfig);
+        writerGroup.addDataSetWriter(dataSet, 1);
+
+        ReaderGroup readerGroup = connection.addReaderGroup({});
+        DataSetReaderConfig config;
+        config.fields = {{"Setpoint", DataTypeId::Double, positionId}};
+        readerGroup.addDataSetReader(config);
+
+        writerGroup.setOperational();
+        readerGroup.setOperational();
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        double position = 0.0;
+        while (position != 42.0 && std::chrono::steady_clock::now() < deadline) {
+            server.runIterate();
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            position = services::readValue(server, positionId).getScalarCopy<double>();
+        }
+        CHECK(position == 42.0);
+        readerGroup.setDisabled();
+        writerGroup.setDisabled();
+    }
+
+    SUBCASE("Invalid configurations") {
+        ReaderGroup group = connection.addReaderGroup({});
+        DataSetReaderConfig config;
+        CHECK_THROWS_WITH(group.addDataSetReader(config), "BadInvalidArgument");
+        config.fields = {{"Position", DataTypeId::Double, positionId}};
+        config.onMessage = [] {};
+        CHECK_THROWS_WITH(group.addDataSetReader(config), "BadInvalidArgument");
+
+        // fields without user memory in realtime mode
+        ReaderGroup rtGroup = connection.addReaderGroup({"RtGroup", PubSubRtLevel::FixedSize});
+        config.onMessage = nullptr;
+        CHECK_THROWS_WITH(rtGroup.addDataSetReader(config), "BadInvalidArgument");
+    }
+
+    CHECK_NOTHROW(connection.remove());
+}
+#endif
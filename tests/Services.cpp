@@ -1,5 +1,10 @@
+#include <algorithm>  // any_of
 #include <chrono>
+#include <future>
+#include <string>
+#include <string_view>
 #include <thread>
+#include <tuple>
 #include <utility>  // pair
 #include <variant>
 #include <vector>
@@ -9,7 +14,9 @@
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
 #include "open62541pp/Event.h"
+#include "open62541pp/Node.h"
 #include "open62541pp/NodeIds.h"
+#include "open62541pp/RequestBuilder.h"
 #include "open62541pp/Server.h"
 #include "open62541pp/services/services.h"
 #include "open62541pp/types/DateTime.h"
@@ -126,11 +133,58 @@ TEST_CASE("NodeManagement service set (server & client)") {
             ));
         }
 
+        SUBCASE("Add node batch") {
+            services::NodeBatch batch;
+            batch.reserve(4, 1);
+            batch.addFolder(objectsId, {1, 1000}, "folder")
+                .addObject({1, 1000}, {1, 1001}, "object")
+                .addVariable({1, 1001}, {1, 1002}, "variable")
+                .addProperty({1, 1001}, {1, 1003}, "property")
+                .addVariable({1, 9999}, {1, 1004}, "orphan")  // unknown parent
+                .addReference({1, 1000}, {1, 1002}, ReferenceTypeId::Organizes);
+            CHECK(batch.getNodes().size() == 5);
+            CHECK(batch.getReferences().size() == 1);
+
+            const auto result = services::addNodes(serverOrClient, batch);
+            CHECK(result.nodeIds.size() == 5);
+            CHECK(result.nodeStatusCodes.size() == 5);
+            CHECK(result.referenceStatusCodes.size() == 1);
+            CHECK(result.nodeIds.at(0) == NodeId(1, 1000));
+            CHECK(result.nodeIds.at(3) == NodeId(1, 1003));
+            CHECK(result.nodeStatusCodes.at(3).isGood());
+            CHECK(result.nodeStatusCodes.at(4) == UA_STATUSCODE_BADPARENTNODEIDINVALID);
+            CHECK(result.referenceStatusCodes.at(0).isGood());
+            CHECK_FALSE(result.isGood());
+
+            batch.clear();
+            CHECK(batch.getNodes().empty());
+            CHECK(services::addNodes(serverOrClient, batch).isGood());
+        }
+
         SUBCASE("Delete node") {
             services::addObject(serverOrClient, objectsId, {1, 1000}, "object");
             services::deleteNode(serverOrClient, {1, 1000});
             CHECK_THROWS_WITH(services::deleteNode(serverOrClient, {1, 1000}), "BadNodeIdUnknown");
         }
+
+        SUBCASE("Delete nodes and subtree") {
+            services::addObject(serverOrClient, objectsId, {1, 1000}, "object");
+            services::addObject(serverOrClient, objectsId, {1, 1001}, "object");
+            const std::vector<NodeId> ids{{1, 1000}, {1, 1001}, {1, 9999}};
+            const auto results = services::deleteNodes(serverOrClient, Span(ids));
+            CHECK(results.size() == 3);
+            CHECK(results.at(0).isGood());
+            CHECK(results.at(1).isGood());
+            CHECK(results.at(2) == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+            services::addFolder(serverOrClient, objectsId, {1, 2000}, "root");
+            services::addObject(serverOrClient, {1, 2000}, {1, 2001}, "object");
+            services::addVariable(serverOrClient, {1, 2001}, {1, 2002}, "variable");
+            services::deleteSubtree(serverOrClient, {1, 2000});
+            for (const auto& id : {NodeId(1, 2000), NodeId(1, 2001), NodeId(1, 2002)}) {
+                CHECK_THROWS_WITH(services::deleteNode(serverOrClient, id), "BadNodeIdUnknown");
+            }
+        }
     };
 
     // clang-format off
@@ -139,6 +193,44 @@ TEST_CASE("NodeManagement service set (server & client)") {
     // clang-format on
 }
 
+TEST_CASE("NodeManagement node batch with a failing request (client)") {
+    Server server;
+    ServerLimits limits;
+    limits.maxNodesPerNodeManagement = 1;  // one request per node
+    server.setLimits(limits);
+    // delay the second node beyond the client timeout
+    UA_Server_getConfig(server.handle())->nodeLifecycle.constructor =
+        [](UA_Server*, const UA_NodeId*, void*, const UA_NodeId* nodeId, void**) {
+            if (asWrapper<NodeId>(*nodeId) == NodeId(1, 1001)) {
+                std::this_thread::sleep_for(500ms);
+            }
+            return UA_STATUSCODE_GOOD;
+        };
+    ServerRunner serverRunner(server);
+    Client client;
+    client.setTimeout(200);
+    client.connect("opc.tcp://localhost:4840");
+
+    const NodeId objectsId{0, UA_NS0ID_OBJECTSFOLDER};
+    services::NodeBatch batch;
+    batch.addObject(objectsId, {1, 1000}, "added")
+        .addObject(objectsId, {1, 1001}, "slow")
+        .addObject(objectsId, {1, 1002}, "not sent")
+        .addReference({1, 1000}, {1, 1002}, ReferenceTypeId::Organizes);
+
+    services::NodeBatchResult result;
+    CHECK_NOTHROW(result = services::addNodes(client, batch));
+    REQUIRE(result.nodeStatusCodes.size() == 3);
+    REQUIRE(result.referenceStatusCodes.size() == 1);
+    CHECK(result.nodeStatusCodes[0].isGood());
+    CHECK(result.nodeIds[0] == NodeId(1, 1000));  // result of the committed chunk is kept
+    CHECK(result.nodeStatusCodes[1] == UA_STATUSCODE_BADTIMEOUT);
+    CHECK(result.nodeStatusCodes[2] == UA_STATUSCODE_BADTIMEOUT);
+    CHECK(result.nodeIds[2].isNull());
+    CHECK(result.referenceStatusCodes[0] == UA_STATUSCODE_BADTIMEOUT);
+    CHECK_FALSE(result.isGood());
+}
+
 TEST_CASE("Attribute service set (server)") {
     Server server;
     const NodeId objectsId{0, UA_NS0ID_OBJECTSFOLDER};
@@ -392,6 +484,514 @@ TEST_CASE("Attribute service set (server & client)") {
     // clang-format on
 }
 
+TEST_CASE("Attribute service set without exceptions (server & client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const NodeId id{1, 1000};
+    services::addVariable(
+        server,
+        {0, UA_NS0ID_OBJECTSFOLDER},
+        id,
+        "variable",
+        VariableAttributes{}
+            .setAccessLevel(UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE)
+            .setDataType(DataTypeId::Double)
+    );
+    const NodeId unknownId{1, 999};
+
+    const auto testTryServices = [&](auto& serverOrClient) {
+        CHECK(services::tryWriteValue(serverOrClient, id, Variant::fromScalar(11.1)));
+        auto value = services::tryReadValue(serverOrClient, id);
+        CHECK(value);
+        CHECK(value->template getScalarCopy<double>() == 11.1);
+
+        auto dv = services::tryReadAttribute(serverOrClient, unknownId, AttributeId::Value);
+        CHECK_FALSE(dv);
+        CHECK(dv.code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK_THROWS_WITH(
+            services::readAttribute(serverOrClient, unknownId, AttributeId::Value),
+            "BadNodeIdUnknown"
+        );
+
+        const auto written = services::tryWriteValue(
+            serverOrClient, unknownId, Variant::fromScalar(1.0)
+        );
+        CHECK(written.code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(services::tryWriteValue(serverOrClient, id, Variant::fromScalar(true)).code() ==
+              UA_STATUSCODE_BADTYPEMISMATCH);
+
+        const std::vector<ReadValueId> items{
+            {id, AttributeId::Value},
+            {unknownId, AttributeId::Value},
+        };
+        const auto results = services::tryReadAttributes(serverOrClient, items);
+        CHECK(results);
+        CHECK(results->size() == 2);
+        CHECK(results->at(0).getStatusCode() == UA_STATUSCODE_GOOD);
+        CHECK(results->at(1).getStatusCode() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+        const auto browsed = services::tryBrowse(
+            serverOrClient, BrowseDescription(unknownId, BrowseDirection::Forward)
+        );
+        CHECK(browsed.code() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(services::tryBrowse(
+            serverOrClient, BrowseDescription(id, BrowseDirection::Both)
+        ));
+    };
+
+    SUBCASE("Server") {
+        testTryServices(server);
+    }
+    SUBCASE("Client") {
+        testTryServices(client);
+    }
+
+    SUBCASE("Client disconnected") {
+        client.disconnect();
+        CHECK_FALSE(services::tryReadValue(client, id));
+    }
+}
+
+TEST_CASE("Attribute service set batched (server & client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    // limit max nodes per read/write to test chunking of client requests
+    UA_Server_getConfig(server.handle())->maxNodesPerRead = 2;
+    UA_Server_getConfig(server.handle())->maxNodesPerWrite = 2;
+    services::writeValue(
+        server,
+        VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerRead,
+        Variant::fromScalar<uint32_t>(2)
+    );
+    services::writeValue(
+        server,
+        VariableId::Server_ServerCapabilities_OperationLimits_MaxNodesPerWrite,
+        Variant::fromScalar<uint32_t>(2)
+    );
+
+    std::vector<NodeId> ids;
+    for (int32_t i = 0; i < 5; ++i) {
+        const NodeId id(1, 1000 + i);
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            id,
+            "variable",
+            VariableAttributes{}
+                .setAccessLevel(UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE)
+                .setDataType(DataTypeId::Int32)
+                .setValueScalar(i)
+        );
+        ids.push_back(id);
+    }
+
+    const auto testBatched = [&](auto& serverOrClient) {
+        SUBCASE("readValues") {
+            const auto results = services::readValues(serverOrClient, ids);
+            CHECK(results.size() == ids.size());
+            for (int32_t i = 0; i < 5; ++i) {
+                CHECK(results.at(i).getValue().template getScalarCopy<int32_t>() == i);
+            }
+        }
+
+        SUBCASE("readValues into existing vector") {
+            std::vector<DataValue> results(10);
+            results.reserve(20);
+            const auto* data = results.data();
+            for (int iteration = 0; iteration < 2; ++iteration) {
+                services::readValues(serverOrClient, ids, results);
+                CHECK(results.size() == ids.size());
+                CHECK(results.data() == data);  // no reallocation
+                for (int32_t i = 0; i < 5; ++i) {
+                    CHECK(results.at(i).getValue().template getScalarCopy<int32_t>() == i);
+                }
+            }
+        }
+
+        SUBCASE("readValuesColumnar") {
+            std::vector<NodeId> nodes = ids;
+            nodes.emplace_back(1, "unknown");
+            const auto columns = services::readValuesColumnar<double>(serverOrClient, nodes);
+            CHECK(columns.size() == 6);
+            for (int32_t i = 0; i < 5; ++i) {
+                CHECK(columns.values.at(i) == static_cast<double>(i));
+                CHECK(columns.statusCodes.at(i).isGood());
+                CHECK(columns.serverTimestamps.at(i).get() != 0);
+            }
+            CHECK(columns.statusCodes.at(5) == UA_STATUSCODE_BADNODEIDUNKNOWN);
+
+            const auto strings = services::readValuesColumnar<String>(serverOrClient, ids);
+            CHECK(strings.statusCodes.at(0) == UA_STATUSCODE_BADTYPEMISMATCH);
+        }
+
+        SUBCASE("readAttributes with unknown node") {
+            const std::vector<ReadValueId> items{
+                {ids.at(0), AttributeId::Value},
+                {NodeId(1, "unknown"), AttributeId::Value},
+                {ids.at(1), AttributeId::DisplayName},
+            };
+            const auto results = services::readAttributes(serverOrClient, items);
+            CHECK(results.size() == 3);
+            CHECK(results.at(0).getValue().template getScalarCopy<int32_t>() == 0);
+            CHECK(results.at(1).getStatusCode() == UA_STATUSCODE_BADNODEIDUNKNOWN);
+            CHECK(
+                results.at(2).getValue().template getScalarCopy<LocalizedText>() ==
+                LocalizedText("", "variable")
+            );
+        }
+
+        SUBCASE("writeValues") {
+            std::vector<Variant> values;
+            for (int32_t i = 0; i < 5; ++i) {
+                values.push_back(Variant::fromScalar(10 * i));
+            }
+            const auto results = services::writeValues(serverOrClient, ids, values);
+            CHECK(results.size() == ids.size());
+            for (int32_t i = 0; i < 5; ++i) {
+                CHECK(results.at(i) == UA_STATUSCODE_GOOD);
+                CHECK(services::readValue(server, ids.at(i)).getScalarCopy<int32_t>() == 10 * i);
+            }
+        }
+
+        SUBCASE("writeValues with invalid type") {
+            const std::vector<Variant> values{
+                Variant::fromScalar<int32_t>(1),
+                Variant::fromScalar<double>(2.0),
+            };
+            const auto results = services::writeValues(
+                serverOrClient, Span<const NodeId>(ids).first(2), values
+            );
+            CHECK(results.size() == 2);
+            CHECK(results.at(0) == UA_STATUSCODE_GOOD);
+            CHECK(results.at(1) == UA_STATUSCODE_BADTYPEMISMATCH);
+        }
+
+        SUBCASE("writeValues with size mismatch") {
+            CHECK_THROWS_AS(services::writeValues(serverOrClient, ids, {}), BadStatus);
+        }
+    };
+
+    // clang-format off
+    SUBCASE("Server") { testBatched(server); }
+    SUBCASE("Client") { testBatched(client); }
+    // clang-format on
+}
+
+TEST_CASE("Attribute service set with adaptive request sizing (client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    // limit max nodes per read without advertising the limit
+    UA_Server_getConfig(server.handle())->maxNodesPerRead = 3;
+
+    std::vector<NodeId> ids;
+    for (int32_t i = 0; i < 10; ++i) {
+        const NodeId id(1, 1000 + i);
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            id,
+            "variable",
+            VariableAttributes{}.setDataType(DataTypeId::Int32).setValueScalar(i)
+        );
+        ids.push_back(id);
+    }
+
+    SUBCASE("Without adaptive sizing") {
+        const auto results = services::readValues(client, ids);
+        CHECK(results.at(0).getStatusCode() == UA_STATUSCODE_BADTOOMANYOPERATIONS);
+    }
+
+    SUBCASE("Shrink on BadTooManyOperations") {
+        AdaptiveRequestSizing options;
+        options.initialSize = 8;
+        client.setAdaptiveRequestSizing(options);
+        for (int run = 0; run < 2; ++run) {
+            const auto results = services::readValues(client, ids);
+            REQUIRE(results.size() == ids.size());
+            for (int32_t i = 0; i < 10; ++i) {
+                CHECK(results.at(i).getValue().getScalarCopy<int32_t>() == i);
+            }
+        }
+    }
+}
+
+TEST_CASE("ReadRequestBuilder") {
+    Server server;
+    std::vector<NodeId> ids;
+    for (int32_t i = 0; i < 100; ++i) {
+        const NodeId id(1, "variable" + std::to_string(i));
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            id,
+            "variable",
+            VariableAttributes{}.setDataType(DataTypeId::Int32).setValueScalar(i)
+        );
+        ids.push_back(id);
+    }
+
+    ReadRequestBuilder builder;
+    builder.reserve(ids.size(), ids.size() * 16);
+    for (const auto& id : ids) {
+        builder.add(id, AttributeId::Value);
+    }
+    builder.add(ids[0], AttributeId::DisplayName).add(ObjectId::Server, AttributeId::NodeClass);
+    CHECK(builder.size() == ids.size() + 2);
+    CHECK(builder.getArenaSize() > 0);
+
+    const auto items = builder.getItems();
+    CHECK(items[5].getNodeId() == ids[5]);
+    const auto* nested = items[5].getNodeId().handle()->identifier.string.data;  // NOLINT
+    CHECK(nested != ids[5].handle()->identifier.string.data);  // NOLINT, copied to arena
+    CHECK(items[100].getAttributeId() == AttributeId::DisplayName);
+    CHECK(items[101].getNodeId() == NodeId(ObjectId::Server));
+
+    const auto values = services::readAttributes(server, items);
+    REQUIRE(values.size() == builder.size());
+    for (int32_t i = 0; i < 100; ++i) {
+        CHECK(values[i].getValue().getScalarCopy<int32_t>() == i);
+    }
+
+    SUBCASE("Index range and relocation after growth") {
+        ReadRequestBuilder small;
+        small.add(ids[1], AttributeId::Value, "1:2");
+        for (const auto& id : ids) {
+            small.add(id);  // grow arena
+        }
+        const auto smallItems = small.getItems();
+        CHECK(smallItems[0].getIndexRange() == std::string_view("1:2"));
+        CHECK(smallItems[0].getNodeId() == ids[1]);
+        CHECK(smallItems.back().getNodeId() == ids.back());
+    }
+
+    builder.clear();
+    CHECK(builder.size() == 0);
+    CHECK(builder.getArenaSize() == 0);
+}
+
+TEST_CASE("Async services (client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const NodeId id{1, 1000};
+    services::addVariable(
+        server,
+        ObjectId::ObjectsFolder,
+        id,
+        "variable",
+        VariableAttributes{}
+            .setAccessLevel(UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE)
+            .setDataType(DataTypeId::Int32)
+            .setValueScalar(11)
+    );
+
+    // drive the client until the condition holds, a lost response fails instead of hanging
+    const auto waitUntil = [&](const auto& condition) {
+        const auto deadline = std::chrono::steady_clock::now() + 5s;
+        while (!condition() && std::chrono::steady_clock::now() < deadline) {
+            client.runIterate(10);
+        }
+        return condition();
+    };
+    const auto waitFor = [&](auto& future) {
+        return waitUntil([&] { return future.wait_for(0ms) == std::future_status::ready; });
+    };
+
+    SUBCASE("readAttributeAsync (callback)") {
+        bool invoked = false;
+        services::readAttributeAsync(
+            client,
+            id,
+            AttributeId::Value,
+            TimestampsToReturn::Neither,
+            [&](StatusCode status, DataValue& dv) {
+                invoked = true;
+                CHECK(status.isGood());
+                CHECK(dv.getValue().getScalarCopy<int32_t>() == 11);
+            }
+        );
+        REQUIRE(waitUntil([&] { return invoked; }));
+    }
+
+    SUBCASE("readAttributeAsync (future)") {
+        auto future = services::readAttributeAsync(client, id, AttributeId::Value);
+        REQUIRE(waitFor(future));
+        CHECK(future.get().getValue().getScalarCopy<int32_t>() == 11);
+    }
+
+    SUBCASE("readAttributeAsync with unknown node") {
+        auto future = services::readAttributeAsync(client, {1, "unknown"}, AttributeId::Value);
+        REQUIRE(waitFor(future));
+        CHECK_THROWS_WITH(future.get(), "BadNodeIdUnknown");
+    }
+
+    SUBCASE("writeAttributeAsync") {
+        auto future = services::writeAttributeAsync(
+            client, id, AttributeId::Value, DataValue::fromScalar<int32_t>(22)
+        );
+        REQUIRE(waitFor(future));
+        CHECK_NOTHROW(future.get());
+        CHECK(services::readValue(server, id).getScalarCopy<int32_t>() == 22);
+    }
+
+    SUBCASE("browseAsync") {
+        auto future = services::browseAsync(
+            client, BrowseDescription(ObjectId::ObjectsFolder, BrowseDirection::Forward)
+        );
+        REQUIRE(waitFor(future));
+        const auto result = future.get();
+        const auto refs = result.getReferences();
+        CHECK(std::any_of(refs.begin(), refs.end(), [&](const auto& ref) {
+            return ref.getNodeId().getNodeId() == id;
+        }));
+    }
+
+    SUBCASE("readArrayChunked / writeArrayChunked") {
+        const NodeId arrayId{1, 1001};
+        std::vector<int32_t> array(1000);
+        for (size_t i = 0; i < array.size(); ++i) {
+            array[i] = static_cast<int32_t>(i);
+        }
+        services::addVariable(
+            server,
+            ObjectId::ObjectsFolder,
+            arrayId,
+            "array",
+            VariableAttributes{}
+                .setAccessLevel(UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE)
+                .setDataType(DataTypeId::Int32)
+                .setValueRank(ValueRank::OneDimension)
+                .setValueArray(array)
+        );
+
+        for (const size_t chunkElements : {64, 100, 2000}) {
+            CAPTURE(chunkElements);
+            std::vector<int32_t> received;
+            size_t chunks = 0;
+            services::readArrayChunked(
+                client,
+                arrayId,
+                chunkElements,
+                [&](size_t offset, Variant& chunk) {
+                    CHECK(offset == received.size());
+                    const auto values = chunk.getArrayCopy<int32_t>();
+                    received.insert(received.end(), values.begin(), values.end());
+                    ++chunks;
+                },
+                3
+            );
+            CHECK(received == array);
+            CHECK(chunks == (array.size() + chunkElements - 1) / chunkElements);
+        }
+
+        std::vector<int32_t> output(array.size());
+        CHECK(services::readArrayChunked(client, arrayId, Span(output), 128) == array.size());
+        CHECK(output == array);
+        std::vector<int32_t> tooSmall(10);
+        CHECK_THROWS_AS(services::readArrayChunked(client, arrayId, Span(tooSmall), 8), BadStatus);
+
+        std::reverse(array.begin(), array.end());
+        services::writeArrayChunked(client, arrayId, Variant::fromArray(array), 300, 2);
+        CHECK(services::readValue(server, arrayId).getArrayCopy<int32_t>() == array);
+
+        CHECK_THROWS_AS(
+            services::readArrayChunked(client, arrayId, 0, [](size_t, Variant&) {}), BadStatus
+        );
+    }
+
+    SUBCASE("Multiple requests in flight") {
+        std::vector<std::future<DataValue>> futures;
+        for (size_t i = 0; i < 100; ++i) {
+            futures.push_back(services::readAttributeAsync(client, id, AttributeId::Value));
+        }
+        for (auto& future : futures) {
+            REQUIRE(waitFor(future));
+            CHECK(future.get().getValue().getScalarCopy<int32_t>() == 11);
+        }
+    }
+}
+
+#ifdef UAPP_HAS_COROUTINES
+namespace {
+/// Minimal eagerly started coroutine type.
+struct Task {
+    struct promise_type {
+        Task get_return_object() noexcept {
+            return {};
+        }
+
+        std::suspend_never initial_suspend() noexcept {
+            return {};
+        }
+
+        std::suspend_never final_suspend() noexcept {
+            return {};
+        }
+
+        void return_void() noexcept {}
+
+        void unhandled_exception() noexcept {}
+    };
+};
+}  // namespace
+
+TEST_CASE("Awaitable services (client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const NodeId id{1, 1000};
+    services::addVariable(
+        server,
+        ObjectId::ObjectsFolder,
+        id,
+        "variable",
+        VariableAttributes{}
+            .setAccessLevel(UA_ACCESSLEVELMASK_READ | UA_ACCESSLEVELMASK_WRITE)
+            .setDataType(DataTypeId::Int32)
+            .setValueScalar(11)
+    );
+
+    bool done = false;
+    int32_t valueRead = 0;
+    bool throws = false;
+    // keep lambda alive, captures are referenced by the coroutine frame
+    const auto coroutine = [&]() -> Task {
+        auto node = client.getNode(id);
+        co_await node.writeValueAwait(Variant::fromScalar<int32_t>(22));
+        const Variant value = co_await node.readValueAwait();
+        valueRead = value.getScalarCopy<int32_t>();
+        try {
+            co_await services::readValueAwait(client, {1, "unknown"});
+        } catch (const BadStatus&) {
+            throws = true;
+        }
+        done = true;
+    };
+    coroutine();
+
+    const auto deadline = std::chrono::steady_clock::now() + 5s;
+    while (!done && std::chrono::steady_clock::now() < deadline) {
+        client.runIterate(10);
+    }
+    REQUIRE(done);
+    CHECK(valueRead == 22);
+    CHECK(throws);
+}
+#endif
+
 TEST_CASE("View service set (server & client)") {
     Server server;
     ServerRunner serverRunner(server);
@@ -455,6 +1055,62 @@ TEST_CASE("View service set (server & client)") {
             const BrowseDescription bd(id, BrowseDirection::Both);
             CHECK(services::browseAll(serverOrClient, bd, 0).size() == 2);
             CHECK(services::browseAll(serverOrClient, bd, 1).size() == 1);
+
+            std::vector<ReferenceDescription> refs(5);
+            services::browseAll(serverOrClient, bd, refs);
+            CHECK(refs.size() == 2);
+            CHECK(refs.capacity() >= 5);
+
+#ifdef UAPP_HAS_PMR
+            std::pmr::monotonic_buffer_resource resource;
+            const auto refsPmr = services::browseAll(serverOrClient, bd, &resource);
+            CHECK(refsPmr.size() == 2);
+            CHECK(refsPmr.get_allocator().resource() == &resource);
+#endif
+        }
+
+        SUBCASE("BrowseRange") {
+            const BrowseDescription bd({0, UA_NS0ID_SERVER}, BrowseDirection::Both);
+            const auto refs = services::browseAll(serverOrClient, bd);
+            CHECK(refs.size() > 2);
+
+            services::BrowseRange range(serverOrClient, bd, 1);
+            std::vector<ReferenceDescription> paged;
+            for (auto& ref : range) {
+                paged.push_back(std::move(ref));
+            }
+            REQUIRE(paged.size() == refs.size());
+            for (size_t i = 0; i < refs.size(); ++i) {
+                CHECK(paged[i].getNodeId() == refs[i].getNodeId());
+            }
+            CHECK_FALSE(range.next());
+
+            // stop early and release the continuation point
+            services::BrowseRange partial(serverOrClient, bd, 1);
+            CHECK(partial.next());
+            CHECK(partial.getReferences().size() == 1);
+            partial.release();
+            CHECK_FALSE(partial.next());
+            CHECK(partial.getReferences().empty());
+        }
+
+        SUBCASE("browseWithAttributes") {
+            const BrowseDescription bd(
+                {0, UA_NS0ID_OBJECTSFOLDER}, BrowseDirection::Forward, ReferenceTypeId::HasComponent
+            );
+            const std::vector<AttributeId> attributeIds{
+                AttributeId::DisplayName, AttributeId::DataType, AttributeId::Value
+            };
+            const auto result = services::browseWithAttributes(serverOrClient, bd, attributeIds);
+            CHECK(result.references.size() == 1);
+            CHECK(result.nodeIds == std::vector<NodeId>{id});
+            CHECK(result.columns.size() == 3);
+            const auto displayNames = result.getColumn(AttributeId::DisplayName);
+            CHECK(displayNames.size() == 1);
+            CHECK(displayNames[0].getValue().getScalar<LocalizedText>().getText() == "Variable");
+            CHECK(result.getColumn(AttributeId::DataType)[0].getStatusCode().isGood());
+            CHECK(result.getColumn(AttributeId::Value).size() == 1);
+            CHECK(result.getColumn(AttributeId::BrowseName).empty());
         }
 
         SUBCASE("browseSimplifiedBrowsePath") {
@@ -469,6 +1125,27 @@ TEST_CASE("View service set (server & client)") {
             CHECK(targets[0].getRemainingPathIndex() == 0xffffffff);
             CHECK(targets[0].getTargetId().getNodeId() == id);
         }
+
+        SUBCASE("translateBrowsePathsToNodeIds (batched)") {
+            const auto createPath = [](std::string_view name) {
+                return BrowsePath(
+                    ObjectId::ObjectsFolder,
+                    {{ReferenceTypeId::HierarchicalReferences, false, true, {1, name}}}
+                );
+            };
+            const std::vector<BrowsePath> browsePaths{
+                createPath("Variable"),
+                createPath("Unknown"),
+            };
+            const auto results = services::translateBrowsePathsToNodeIds(
+                serverOrClient, browsePaths
+            );
+            CHECK(results.size() == 2);
+            CHECK(results[0].getStatusCode().isGood());
+            CHECK(results[0].getTargets().size() == 1);
+            CHECK(results[0].getTargets()[0].getTargetId().getNodeId() == id);
+            CHECK(results[1].getStatusCode().isBad());
+        }
     };
 
     // clang-format off
@@ -512,6 +1189,53 @@ TEST_CASE("View service set (server)") {
     }
 }
 
+TEST_CASE("View service set (client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    SUBCASE("browseRecursive") {
+        const BrowseDescription bd(
+            ObjectId::Server,
+            BrowseDirection::Forward,
+            ReferenceTypeId::References,
+            true,
+            UA_NODECLASS_VARIABLE
+        );
+
+        std::vector<ExpandedNodeId> results;
+        services::browseRecursive(client, bd, [&](const ReferenceDescription& ref) {
+            CHECK(ref.getNodeClass() == NodeClass::Variable);
+            results.push_back(ref.getNodeId());
+        });
+        CHECK(results.size() == services::browseRecursive(server, bd).size());
+
+        auto contains = [&](const NodeId& id) {
+            return std::find(results.begin(), results.end(), ExpandedNodeId(id)) != results.end();
+        };
+
+        CHECK(contains(VariableId::Server_ServerStatus));
+        CHECK(contains(VariableId::Server_ServerStatus_BuildInfo));
+        CHECK(contains(VariableId::Server_ServerStatus_BuildInfo_SoftwareVersion));
+    }
+
+    SUBCASE("browseRecursive with exception in callback") {
+        const BrowseDescription bd(ObjectId::Server, BrowseDirection::Forward);
+        CHECK_THROWS_WITH(
+            services::browseRecursive(
+                client,
+                bd,
+                [](const ReferenceDescription&) {
+                    throw BadStatus(UA_STATUSCODE_BADINTERNALERROR);
+                },
+                1
+            ),
+            "BadInternalError"
+        );
+    }
+}
+
 #ifdef UA_ENABLE_METHODCALLS
 TEST_CASE("Method service set (server & client)") {
     Server server;
@@ -560,6 +1284,21 @@ TEST_CASE("Method service set (server & client)") {
             CHECK(outputs.at(0).getScalarCopy<int32_t>() == 3);
         }
 
+#ifdef UAPP_HAS_PMR
+        SUBCASE("Check result with memory resource") {
+            std::pmr::monotonic_buffer_resource resource;
+            const std::vector<Variant> inputs{
+                Variant::fromScalar<int32_t>(1), Variant::fromScalar<int32_t>(2)
+            };
+            const auto outputs = services::call(
+                serverOrClient, objectsId, methodId, inputs, &resource
+            );
+            CHECK(outputs.get_allocator().resource() == &resource);
+            CHECK(outputs.size() == 1);
+            CHECK(outputs.at(0).getScalarCopy<int32_t>() == 3);
+        }
+#endif
+
         SUBCASE("Propagate exception") {
             throwException = true;
             CHECK_THROWS_WITH(
@@ -606,6 +1345,30 @@ TEST_CASE("Method service set (server & client)") {
                 "BadTooManyArguments"
             );
         }
+
+        SUBCASE("Batch") {
+            std::vector<CallMethodRequest> requests;
+            for (int32_t i = 0; i < 10; ++i) {
+                const std::vector<Variant> inputs{
+                    Variant::fromScalar(i),
+                    Variant::fromScalar(i),
+                };
+                requests.emplace_back(objectsId, methodId, inputs);
+            }
+            requests.emplace_back(objectsId, methodId);  // missing arguments
+            requests.emplace_back(objectsId, NodeId(1, 9999));  // unknown method
+
+            const auto results = services::callBatch(serverOrClient, requests);
+            CHECK(results.size() == requests.size());
+            for (size_t i = 0; i < 10; ++i) {
+                CHECK(results.at(i).getStatusCode() == UA_STATUSCODE_GOOD);
+                const auto outputs = results.at(i).getOutputArguments();
+                CHECK(outputs.size() == 1);
+                CHECK(outputs[0].getScalarCopy<int32_t>() == static_cast<int32_t>(2 * i));
+            }
+            CHECK(results.at(10).getStatusCode() == UA_STATUSCODE_BADARGUMENTSMISSING);
+            CHECK(results.at(11).getStatusCode().isBad());
+        }
     };
 
     // clang-format off
@@ -615,6 +1378,147 @@ TEST_CASE("Method service set (server & client)") {
 }
 #endif
 
+#ifdef UA_ENABLE_METHODCALLS
+TEST_CASE("Method service set with typed methods (server & client)") {
+    Server server;
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const NodeId addId{1, 1000};
+    const NodeId describeId{1, 1001};
+    const NodeId minMaxId{1, 1002};
+
+    services::addMethod<int32_t(int32_t, int32_t)>(
+        server, objectsId, addId, "add", [](int32_t a, int32_t b) { return a + b; }
+    );
+    const std::vector<std::string_view> names{"name", "value"};
+    services::addMethod<std::string(std::string_view, double)>(
+        server,
+        objectsId,
+        describeId,
+        "describe",
+        [](std::string_view name, double value) {
+            return std::string(name) + "=" + std::to_string(static_cast<int>(value));
+        },
+        names
+    );
+    services::addMethod<std::tuple<double, double>(double, double)>(
+        server,
+        objectsId,
+        minMaxId,
+        "minMax",
+        [](double a, double b) { return std::tuple{std::min(a, b), std::max(a, b)}; }
+    );
+
+    SUBCASE("Argument descriptors") {
+        const auto arguments = Node(server, describeId)
+                                   .browseChild({{0, "InputArguments"}})
+                                   .readValueArray<Argument>();
+        CHECK(arguments.size() == 2);
+        CHECK(arguments.at(0).getName() == "name");
+        CHECK(arguments.at(0).getDataType() == NodeId(DataTypeId::String));
+        CHECK(arguments.at(1).getName() == "value");
+        CHECK(arguments.at(1).getDataType() == NodeId(DataTypeId::Double));
+    }
+
+    const auto testCall = [&](auto& serverOrClient) {
+        int32_t sum{};
+        services::callTyped(serverOrClient, objectsId, addId, sum, int32_t{1}, int32_t{2});
+        CHECK(sum == 3);
+
+        std::string description;
+        services::callTyped(
+            serverOrClient, objectsId, describeId, description, std::string_view("x"), 42.0
+        );
+        CHECK(description == "x=42");
+
+        double min{};
+        double max{};
+        services::callTyped(serverOrClient, objectsId, minMaxId, std::tie(min, max), 2.0, 1.0);
+        CHECK(min == 1.0);
+        CHECK(max == 2.0);
+
+        CHECK_THROWS_WITH(
+            services::callTyped(serverOrClient, objectsId, addId, sum, 1.0, 2.0),
+            "BadInvalidArgument"
+        );
+    };
+
+    // clang-format off
+    SUBCASE("Server") { testCall(server); };
+    SUBCASE("Client") { testCall(client); };
+    // clang-format on
+}
+#endif
+
+#ifdef UAPP_ASYNC_METHODS
+TEST_CASE("Method service set with async methods (client)") {
+    Server server;
+    server.setAsyncMethodThreads(2);
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const NodeId objectsId{ObjectId::ObjectsFolder};
+    const NodeId methodId{1, 1000};
+
+    bool fail = false;
+    std::vector<std::thread> threads;
+    services::addMethodAsync(
+        server,
+        objectsId,
+        methodId,
+        "add",
+        [&](Span<const Variant> inputs, services::MethodCompletion completion) {
+            if (fail) {
+                completion.fail(UA_STATUSCODE_BADUNEXPECTEDERROR);
+                return;
+            }
+            const auto a = inputs[0].getScalarCopy<int32_t>();
+            const auto b = inputs[1].getScalarCopy<int32_t>();
+            // complete from other thread
+            threads.emplace_back([a, b, completion = std::move(completion)]() mutable {
+                std::this_thread::sleep_for(10ms);
+                const std::vector<Variant> outputs{Variant::fromScalar(a + b)};
+                completion.complete(outputs);
+            });
+        },
+        {
+            Argument("a", {"en-US", "first number"}, DataTypeId::Int32, ValueRank::Scalar),
+            Argument("b", {"en-US", "second number"}, DataTypeId::Int32, ValueRank::Scalar),
+        },
+        {
+            Argument("sum", {"en-US", "sum of both numbers"}, DataTypeId::Int32, ValueRank::Scalar),
+        }
+    );
+    CHECK_THROWS_WITH(server.setAsyncMethodThreads(1), "BadInvalidState");
+
+    const std::vector<Variant> inputs{
+        Variant::fromScalar<int32_t>(1),
+        Variant::fromScalar<int32_t>(2),
+    };
+
+    SUBCASE("Check result") {
+        const std::vector<Variant> outputs = services::call(client, objectsId, methodId, inputs);
+        CHECK(outputs.size() == 1);
+        CHECK(outputs.at(0).getScalarCopy<int32_t>() == 3);
+    }
+
+    SUBCASE("Fail") {
+        fail = true;
+        CHECK_THROWS_WITH(
+            services::call(client, objectsId, methodId, inputs), "BadUnexpectedError"
+        );
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
+#endif
+
 #ifdef UA_ENABLE_SUBSCRIPTIONS
 TEST_CASE("Subscription service set (client)") {
     Server server;
@@ -883,3 +1787,66 @@ TEST_CASE("MonitoredItem service set (server)") {
     }
 }
 #endif
+
+#ifdef UA_ENABLE_HISTORIZING
+TEST_CASE("HistoryRead service (client)") {
+    Server server;
+    const NodeId id1{1, 1000};
+    const NodeId id2{1, 1001};
+    for (const auto& id : {id1, id2}) {
+        services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+        server.enableHistorizing(id);
+        for (int i = 1; i <= 5; ++i) {
+            DataValue dv(Variant::fromScalar(static_cast<double>(i)));
+            dv.setSourceTimestamp(DateTime::fromUnixTime(i));
+            services::writeDataValue(server, id, dv);
+        }
+    }
+
+    ServerRunner serverRunner(server);
+    Client client;
+    client.connect("opc.tcp://localhost:4840");
+
+    const auto startTime = DateTime::fromUnixTime(2);
+    const auto endTime = DateTime::fromUnixTime(10);
+
+    SUBCASE("Lazy range") {
+        std::vector<double> values;
+        for (const auto& dv : services::historyReadRaw(client, id1, startTime, endTime, {2})) {
+            values.push_back(dv.getValue().getScalarCopy<double>());
+        }
+        CHECK(values == std::vector<double>{2.0, 3.0, 4.0, 5.0});
+    }
+
+    SUBCASE("Lazy range of unknown node") {
+        auto range = services::historyReadRaw(client, {1, 999}, startTime, endTime);
+        CHECK_THROWS_AS(range.begin(), BadStatus);
+    }
+
+    SUBCASE("Batched reader") {
+        const std::vector<NodeId> ids{id1, id2, {1, 999}};
+        services::HistoryRawReader reader(client, ids, startTime, endTime, {3});
+        CHECK(reader.size() == 3);
+
+        std::vector<size_t> counts(ids.size());
+        size_t batches = 0;
+        while (reader.next()) {
+            ++batches;
+            for (size_t i = 0; i < reader.size(); ++i) {
+                counts[i] += reader.getValues(i).size();
+            }
+        }
+        CHECK(batches == 2);
+        CHECK(counts == std::vector<size_t>{4, 4, 0});
+        CHECK(reader.isDone(0));
+        CHECK(reader.getStatusCode(0).isGood());
+        CHECK(reader.getStatusCode(2).isBad());
+    }
+
+    SUBCASE("Release continuation points on destruction") {
+        services::HistoryRawReader reader(client, {id1}, startTime, endTime, {1});
+        CHECK(reader.next());
+        CHECK_FALSE(reader.isDone(0));
+    }
+}
+#endif
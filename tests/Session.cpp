@@ -1,3 +1,6 @@
+#include <string>
+#include <vector>
+
 #include <doctest/doctest.h>
 
 #include "open62541pp/Client.h"
@@ -25,6 +28,38 @@ TEST_CASE("Session") {
         CHECK(server.getSessions().empty());
     }
 
+    SUBCASE("Session context") {
+        struct Roles {
+            std::vector<std::string> names;
+        };
+
+        Session inactive(server, {1, 1000});
+        CHECK_THROWS_WITH(inactive.emplaceContext<Roles>(), "BadSessionIdInvalid");
+        CHECK(inactive.getContext<Roles>() == nullptr);
+
+        client.connect(localServerUrl);
+        CHECK(server.getSessionCount() == 1);
+        auto session = server.getSessions().at(0);
+        CHECK(session.getContext<Roles>() == nullptr);
+        session.emplaceContext<Roles>(Roles{{"operator"}});
+
+        size_t count = 0;
+        server.forEachSession([&](Session& s) {
+            ++count;
+            auto* roles = s.getContext<Roles>();
+            REQUIRE(roles != nullptr);
+            CHECK(roles->names.at(0) == "operator");
+            CHECK(s.getContext<int>() == nullptr);  // other type
+        });
+        CHECK(count == 1);
+
+        session.resetContext();
+        CHECK(session.getContext<Roles>() == nullptr);
+
+        client.disconnect();
+        CHECK(server.getSessionCount() == 0);
+    }
+
 #if UAPP_OPEN62541_VER_GE(1, 3)
     SUBCASE("Session attributes") {
         client.connect(localServerUrl);
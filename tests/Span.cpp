@@ -3,6 +3,7 @@
 
 #include <doctest/doctest.h>
 
+#include "open62541pp/ArrayView.h"
 #include "open62541pp/Span.h"
 
 using namespace opcua;
@@ -162,3 +163,43 @@ TEST_CASE("Span comparison") {
         CHECK(Span(vec2Double) != Span(vec1));
     }
 }
+
+TEST_CASE("ArrayView") {
+    std::vector<int> vec(2 * 3 * 4);
+    for (size_t i = 0; i < vec.size(); ++i) {
+        vec[i] = static_cast<int>(i);
+    }
+    const ArrayView<int, 3> view(vec.data(), {2, 3, 4});
+    CHECK(view.rank() == 3);
+    CHECK(view.size() == vec.size());
+    CHECK(!view.empty());
+    CHECK(view.stride(0) == 12);
+    CHECK(view.stride(1) == 4);
+    CHECK(view.stride(2) == 1);
+    CHECK(view(0, 0, 0) == 0);
+    CHECK(view(1, 2, 3) == 23);
+    CHECK(view(1, 0, 2) == 14);
+    CHECK(view.flat().data() == vec.data());
+    CHECK(view.flat().size() == vec.size());
+
+    SUBCASE("Sub-array views") {
+        const auto matrix = view[1];
+        CHECK(matrix.rank() == 2);
+        CHECK(matrix.data() == vec.data() + 12);
+        CHECK(matrix(2, 3) == 23);
+        CHECK(matrix[2][3] == 23);
+    }
+
+    SUBCASE("Const view") {
+        const ArrayView<const int, 3> constView = view;
+        CHECK(constView.data() == view.data());
+        CHECK(constView.extents() == view.extents());
+    }
+
+    SUBCASE("Empty") {
+        constexpr ArrayView<int, 2> empty;
+        CHECK(empty.size() == 0);
+        CHECK(empty.empty());
+        CHECK(empty.data() == nullptr);
+    }
+}
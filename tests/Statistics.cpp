@@ -0,0 +1,116 @@
+#include <chrono>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Statistics.h"
+#include "open62541pp/ValueBackend.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+using namespace std::chrono_literals;
+
+TEST_CASE("LatencyHistogram") {
+    LatencyHistogram histogram;
+
+    SUBCASE("Empty") {
+        CHECK(histogram.getCount() == 0);
+        CHECK(histogram.getSum() == 0ns);
+        CHECK(histogram.getMean() == 0ns);
+        CHECK(histogram.getMax() == 0ns);
+        CHECK(histogram.getPercentile(50) == 0ns);
+    }
+
+    SUBCASE("Record") {
+        for (int i = 1; i <= 100; ++i) {
+            histogram.record(std::chrono::microseconds(i));
+        }
+        CHECK(histogram.getCount() == 100);
+        CHECK(histogram.getSum() == 5050us);
+        CHECK(histogram.getMean() == 50500ns);
+        CHECK(histogram.getMax() == 100us);
+        CHECK(histogram.getPercentile(100) == 100us);
+
+        // relative error <= 12.5%
+        const auto p50 = histogram.getPercentile(50);
+        CHECK(p50 >= 50us);
+        CHECK(p50 <= 57us);
+        const auto p99 = histogram.getPercentile(99);
+        CHECK(p99 >= 99us);
+        CHECK(p99 <= 100us);
+    }
+
+    SUBCASE("Small and large values") {
+        histogram.record(0ns);
+        histogram.record(-1ns);  // clamped to 0
+        histogram.record(5ns);
+        histogram.record(1h);  // overflow bucket
+        CHECK(histogram.getCount() == 4);
+        CHECK(histogram.getPercentile(25) == 0ns);
+        CHECK(histogram.getPercentile(75) == 5ns);
+        CHECK(histogram.getPercentile(100) == 1h);
+        CHECK(histogram.getMax() == 1h);
+    }
+
+    SUBCASE("Reset") {
+        histogram.record(1ms);
+        histogram.reset();
+        CHECK(histogram.getCount() == 0);
+        CHECK(histogram.getMax() == 0ns);
+        CHECK(histogram.getPercentile(50) == 0ns);
+    }
+}
+
+TEST_CASE("Statistics") {
+    Server server;
+
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    int data = 0;
+    ValueBackendDataSource dataSource;
+    dataSource.read = [&](DataValue& value, const NumericRange&, bool) {
+        value.getValue().setScalar(data);
+        return UA_STATUSCODE_GOOD;
+    };
+    dataSource.write = [&](const DataValue&, const NumericRange&) {
+        return UA_STATUSCODE_BADNOTWRITABLE;
+    };
+    server.setVariableNodeValueBackend(id, dataSource);
+
+    SUBCASE("Server callbacks") {
+        auto& stats = server.getStatistics().getCallback(StatisticsCallback::DataSource);
+        CHECK(stats.latency.getCount() == 0);
+        node.readValueScalar<int>();
+        CHECK(stats.latency.getCount() == 1);
+        CHECK(stats.errorCount == 0);
+        CHECK_THROWS(node.writeValueScalar<int>(1));
+        CHECK(stats.latency.getCount() == 2);
+        CHECK(stats.errorCount == 1);
+        server.getStatistics().reset();
+        CHECK(stats.latency.getCount() == 0);
+        CHECK(stats.errorCount == 0);
+    }
+
+    SUBCASE("Client services") {
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect("opc.tcp://localhost:4840");
+        client.getStatistics().reset();
+
+        auto clientNode = client.getNode(id);
+        clientNode.readValueScalar<int>();
+        CHECK_THROWS(clientNode.writeValueScalar<int>(1));
+
+        const auto& read = client.getStatistics().getService(StatisticsService::Read);
+        const auto& write = client.getStatistics().getService(StatisticsService::Write);
+        CHECK(read.latency.getCount() == 1);
+        CHECK(read.latency.getMax() > 0ns);
+        CHECK(write.latency.getCount() == 1);
+        // service result is good, only the operation failed
+        CHECK(write.errorCount == 0);
+        CHECK(client.getStatistics().getService(StatisticsService::Call).latency.getCount() == 0);
+    }
+}
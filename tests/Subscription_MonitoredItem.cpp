@@ -1,22 +1,143 @@
+#include <algorithm>  // find
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include <doctest/doctest.h>
 
+#include "open62541pp/AccessControl.h"
 #include "open62541pp/Client.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/Event.h"
+#include "open62541pp/EventFields.h"
+#include "open62541pp/EventFilterBuilder.h"
 #include "open62541pp/MonitoredItem.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/NotificationBatch.h"
+#include "open62541pp/NotificationQueue.h"
 #include "open62541pp/Server.h"
+#include "open62541pp/SharedVariant.h"
 #include "open62541pp/Subscription.h"
+#include "open62541pp/services/Attribute.h"
+#include "open62541pp/services/MonitoredItem.h"
+#include "open62541pp/services/NodeManagement.h"
 #include "open62541pp/types/Composed.h"
 #include "open62541pp/types/Variant.h"
 
 #include "helper/Runner.h"
 
+#if defined(__linux__)
+#include <sys/socket.h>
+#include <unistd.h>  // close, dup2
+#endif
+
 using namespace opcua;
 using namespace std::literals::chrono_literals;
 
 #ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("NotificationQueue") {
+    SUBCASE("Capacity") {
+        CHECK(NotificationQueue(0).capacity() == 1);
+        CHECK(NotificationQueue(3).capacity() == 4);
+        CHECK(NotificationQueue(4).capacity() == 4);
+    }
+
+    SUBCASE("Push & pop") {
+        NotificationQueue queue(2);
+        NotificationQueue::Notification notification;
+        CHECK_FALSE(queue.tryPop(notification));
+
+        CHECK(queue.push({1, DataValue::fromScalar(11)}));
+        CHECK(queue.push({2, DataValue::fromScalar(22)}));
+        CHECK_FALSE(queue.push({3, DataValue::fromScalar(33)}));  // discarded
+        CHECK(queue.size() == 2);
+        CHECK(queue.getDroppedCount() == 1);
+
+        CHECK(queue.tryPop(notification));
+        CHECK(notification.monId == 1);
+        CHECK(notification.value.getValue().getScalar<int>() == 11);
+
+        CHECK(queue.push({4, DataValue::fromScalar(44)}));
+        std::vector<NotificationQueue::Notification> batch;
+        CHECK(queue.poll(batch) == 2);
+        CHECK(batch.size() == 2);
+        CHECK(batch[0].monId == 2);
+        CHECK(batch[1].monId == 4);
+        CHECK(queue.size() == 0);
+    }
+
+    SUBCASE("Concurrent producer & consumer") {
+        NotificationQueue queue(16, NotificationQueueOverflow::Block);
+        constexpr uint32_t count = 10000;
+        std::thread producer([&] {
+            for (uint32_t i = 1; i <= count; ++i) {
+                queue.push({i, DataValue{}});
+            }
+        });
+        uint32_t expected = 1;
+        NotificationQueue::Notification notification;
+        while (expected <= count) {
+            if (queue.tryPop(notification)) {
+                CHECK(notification.monId == expected);
+                expected++;
+            }
+        }
+        producer.join();
+        CHECK(queue.getDroppedCount() == 0);
+    }
+}
+
+TEST_CASE("NotificationBatchBuilder") {
+    std::vector<ColumnarNotificationBatch> batches;
+    NotificationBatchOptions options{};
+    options.maxRows = 3;
+    options.maxAge = 0ms;
+    NotificationBatchBuilder builder(options, [&](ColumnarNotificationBatch& batch) {
+        batches.push_back(std::move(batch));
+    });
+
+    const NodeId node1(1, 1);
+    const NodeId node2(1, 2);
+    builder.append(1, node1, DataValue::fromScalar(11));
+    builder.append(2, node2, DataValue::fromScalar(String("text")));
+    CHECK(builder.size() == 2);
+    CHECK(batches.empty());
+
+    DataValue dv = DataValue::fromScalar(1.5f);
+    dv.setStatusCode(UA_STATUSCODE_UNCERTAIN);
+    dv.setSourceTimestamp(DateTime(123));
+    builder.append(1, node1, dv);  // full
+    CHECK(builder.size() == 0);
+    REQUIRE(batches.size() == 1);
+    CHECK(builder.getBatchCount() == 1);
+
+    const auto& batch = batches[0];
+    CHECK(batch.size() == 3);
+    CHECK(batch.monIds == std::vector<uint32_t>{1, 2, 1});
+    CHECK(batch.nodeIndexes == std::vector<uint32_t>{0, 1, 0});
+    CHECK(batch.nodeIds == std::vector<NodeId>{node1, node2});
+    CHECK(batch.numericValues[0] == 11.0);
+    CHECK(std::isnan(batch.numericValues[1]));
+    CHECK(batch.numericValues[2] == 1.5);
+    CHECK(batch.values[0].isEmpty());
+    CHECK(batch.values[1].getScalar<String>() == String("text"));
+    CHECK(batch.statusCodes[2] == UA_STATUSCODE_UNCERTAIN);
+    CHECK(batch.sourceTimestamps[2] == DateTime(123));
+    CHECK(batch.serverTimestamps[2] == DateTime(0));
+
+    builder.append(3, node2, DataValue::fromScalar(1));
+    builder.flush();
+    REQUIRE(batches.size() == 2);
+    CHECK(batches[1].nodeIds == std::vector<NodeId>{node2});  // dictionary per batch
+    CHECK(batches[1].nodeIndexes == std::vector<uint32_t>{0});
+}
+
 TEST_CASE("Subscription & MonitoredItem (server)") {
     Server server;
 
@@ -45,11 +166,333 @@ TEST_CASE("Subscription & MonitoredItem (server)") {
     std::this_thread::sleep_for(100ms);
     server.runIterate();
     CHECK(notificationCount > 0);
+    CHECK(sub.getStatistics().notificationCount == notificationCount);
 
     mon.deleteMonitoredItem();
     CHECK(sub.getMonitoredItems().empty());
 }
 
+TEST_CASE("Subscription & MonitoredItem with client-side filter (server)") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeDataType(DataTypeId::Double);
+    node.writeValueScalar(10.0);
+
+    auto sub = server.createSubscription();
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.samplingInterval = 0.0;  // = fastest practical
+
+    std::vector<double> values;
+    auto mon = sub.subscribeDataChange(
+        id,
+        AttributeId::Value,
+        MonitoringMode::Reporting,
+        monitoringParameters,
+        [&](const auto&, const DataValue& dv) {
+            values.push_back(dv.getValue().getScalarCopy<double>());
+        }
+    );
+    services::ClientDataChangeFilter filter{};
+    filter.absoluteDeadband = 1.0;
+    mon.setClientDataChangeFilter(filter);
+
+    const auto iterate = [&] {
+        std::this_thread::sleep_for(10ms);
+        server.runIterate();
+    };
+    iterate();
+    node.writeValueScalar(12.0);
+    iterate();
+    node.writeValueScalar(12.5);  // within deadband
+    iterate();
+    node.writeValueScalar(14.0);
+    iterate();
+
+    CHECK(std::find(values.begin(), values.end(), 12.0) != values.end());
+    CHECK(std::find(values.begin(), values.end(), 12.5) == values.end());
+    CHECK(values.back() == 14.0);
+
+    CHECK_THROWS_WITH(
+        services::setClientDataChangeFilter(server, 999999, filter), "BadMonitoredItemIdInvalid"
+    );
+}
+
+TEST_CASE("Subscription & MonitoredItem event-driven (server)") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeDataType(DataTypeId::Double);
+    node.writeValueScalar(1.0);
+
+    auto sub = server.createSubscription();
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.eventDriven = true;
+
+    std::vector<double> values;
+    auto mon = sub.subscribeDataChange(
+        id,
+        AttributeId::Value,
+        MonitoringMode::Reporting,
+        monitoringParameters,
+        [&](const auto&, const DataValue& dv) {
+            values.push_back(dv.getValue().getScalarCopy<double>());
+        }
+    );
+    CHECK(values == std::vector<double>{1.0});  // initial value
+
+    SUBCASE("Write") {
+        node.writeValueScalar(2.0);  // sampled without server iteration
+        node.writeValueScalar(2.0);  // unchanged
+        node.writeValueScalar(3.0);
+        CHECK(values == std::vector<double>{1.0, 2.0, 3.0});
+        std::this_thread::sleep_for(50ms);
+        server.runIterate();
+        CHECK(values.size() == 3);  // not sampled periodically
+    }
+
+    SUBCASE("Notify data source changes") {
+        double current = 5.0;
+        ValueBackendDataSource dataSource;
+        dataSource.read = [&](DataValue& dv, const NumericRange&, bool) {
+            dv.setValue(Variant::fromScalar(current));
+        };
+        server.setVariableNodeValueBackend(id, dataSource);
+        current = 6.0;
+        server.notifyValueChanged(id);
+        server.notifyValueChanged(id);  // unchanged
+        CHECK(values == std::vector<double>{1.0, 6.0});
+    }
+
+    SUBCASE("Value publisher") {
+        auto publisher = server.createValuePublisher<double>(Span<const NodeId>(&id, 1));
+        publisher.publish(0, 7.0);
+        CHECK(values.size() == 1);
+        server.runIterate();
+        CHECK(values == std::vector<double>{1.0, 7.0});
+    }
+
+    SUBCASE("Delete") {
+        mon.deleteMonitoredItem();
+        node.writeValueScalar(2.0);
+        CHECK(values.size() == 1);
+    }
+
+    SUBCASE("Delete monitored items of the node within a callback") {
+        std::vector<double> lastValues;
+        std::optional<MonitoredItem<Server>> last;
+        auto deleting = sub.subscribeDataChange(
+            id,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto&, const DataValue& dv) {
+                if (dv.getValue().getScalarCopy<double>() == 2.0) {
+                    mon.deleteMonitoredItem();  // sampled before
+                    last->deleteMonitoredItem();  // not sampled yet
+                }
+            }
+        );
+        last = sub.subscribeDataChange(
+            id,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto&, const DataValue& dv) {
+                lastValues.push_back(dv.getValue().getScalarCopy<double>());
+            }
+        );
+        node.writeValueScalar(2.0);
+        node.writeValueScalar(3.0);
+        CHECK(values == std::vector<double>{1.0, 2.0});
+        CHECK(lastValues == std::vector<double>{1.0});
+        deleting.deleteMonitoredItem();
+    }
+}
+
+TEST_CASE("Subscription & MonitoredItem aggregate (server)") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeDataType(DataTypeId::Double);
+    node.writeValueScalar(2.0);
+
+    auto sub = server.createSubscription();
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.samplingInterval = 5.0;
+
+    std::vector<DataValue> results;
+    auto subscribe = [&] {
+        return sub.subscribeDataChange(
+            id,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto&, const DataValue& dv) { results.push_back(dv); }
+        );
+    };
+    auto iterateUntilReported = [&] {
+        for (int i = 0; i < 100 && results.empty(); ++i) {
+            server.runIterate();
+            std::this_thread::sleep_for(5ms);
+        }
+    };
+
+    SUBCASE("Average") {
+        monitoringParameters.setAggregateFilter(services::AggregateFunction::Average, 50.0);
+        auto mon = subscribe();
+        CHECK(monitoringParameters.filter.getDecodedDataType() ==
+              &UA_TYPES[UA_TYPES_AGGREGATEFILTERRESULT]);
+        iterateUntilReported();
+        REQUIRE(!results.empty());
+        CHECK(results[0].getValue().getScalarCopy<double>() == 2.0);
+        CHECK(results[0].hasSourceTimestamp());
+    }
+
+    SUBCASE("Count") {
+        monitoringParameters.setAggregateFilter(services::AggregateFunction::Count, 50.0);
+        auto mon = subscribe();
+        iterateUntilReported();
+        REQUIRE(!results.empty());
+        CHECK(results[0].getValue().isType(Type::UInt32));
+    }
+
+    SUBCASE("Minimum and maximum of changing values") {
+        // all values are written and sampled within the first processing interval
+        const auto iterateFor = [&](auto duration) {
+            const auto until = std::chrono::steady_clock::now() + duration;
+            while (std::chrono::steady_clock::now() < until) {
+                server.runIterate();
+                std::this_thread::sleep_for(1ms);
+            }
+        };
+        for (const auto function :
+             {services::AggregateFunction::Minimum, services::AggregateFunction::Maximum}) {
+            results.clear();
+            monitoringParameters.setAggregateFilter(function, 500.0);
+            auto mon = subscribe();
+            for (const double value : {5.0, 1.0, 3.0}) {
+                iterateFor(30ms);
+                node.writeValueScalar(value);
+            }
+            node.writeValueScalar(2.0);
+            iterateUntilReported();
+            REQUIRE(!results.empty());
+            const double expected = function == services::AggregateFunction::Minimum ? 1.0 : 5.0;
+            CHECK(results[0].getValue().getScalarCopy<double>() == expected);
+            mon.deleteMonitoredItem();
+        }
+    }
+
+    SUBCASE("Delete") {
+        monitoringParameters.setAggregateFilter(services::AggregateFunction::Maximum, 10.0);
+        auto mon = subscribe();
+        mon.deleteMonitoredItem();
+        std::this_thread::sleep_for(20ms);
+        server.runIterate();
+        CHECK(results.empty());
+    }
+
+    SUBCASE("Unsupported aggregate") {
+        monitoringParameters.setFilter(
+            AggregateFilter(DateTime::now(), ObjectId::AggregateFunction_Total, 50.0)
+        );
+        CHECK_THROWS_WITH(subscribe(), "BadAggregateNotSupported");
+    }
+}
+
+TEST_CASE("Subscription & MonitoredItem with typed callback (server)") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeDataType(DataTypeId::Double);
+    node.writeValueScalar(11.1);
+
+    auto sub = server.createSubscription();
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.samplingInterval = 0.0;  // = fastest practical
+
+    SUBCASE("Type mismatch") {
+        CHECK_THROWS_WITH(
+            sub.subscribeDataChange<int32_t>(
+                id,
+                MonitoringMode::Reporting,
+                monitoringParameters,
+                [](const auto&, const int32_t&, DateTime, StatusCode) {}
+            ),
+            "BadTypeMismatch"
+        );
+    }
+
+    SUBCASE("Scalar") {
+        double lastValue = 0.0;
+        StatusCode lastStatus = UA_STATUSCODE_BADUNEXPECTEDERROR;
+        sub.subscribeDataChange<double>(
+            id,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto& item, const double& value, DateTime, StatusCode status) {
+                CHECK(item.getNodeId() == id);
+                lastValue = value;
+                lastStatus = status;
+            }
+        );
+        std::this_thread::sleep_for(100ms);
+        server.runIterate();
+        CHECK(lastValue == 11.1);
+        CHECK(lastStatus.isGood());
+    }
+}
+
+TEST_CASE("SharedVariant") {
+    SharedVariant value(Variant::fromArray(std::vector<double>{1.0, 2.0, 3.0}));
+    CHECK(value.useCount() == 1);
+
+    SharedVariant copy = value;  // NOLINT
+    CHECK(value.useCount() == 2);
+    CHECK(copy->handle()->data == value->handle()->data);
+
+    copy.mutate() = Variant::fromScalar(4.0);  // copy-on-write
+    CHECK(value.useCount() == 1);
+    CHECK(copy.useCount() == 1);
+    CHECK(value->getArrayLength() == 3);
+    CHECK(copy->getScalarCopy<double>() == 4.0);
+}
+
+TEST_CASE("Subscription & MonitoredItem with shared values (server)") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    node.writeDataType(DataTypeId::Double);
+    node.writeValueArray(std::vector<double>{1.0, 2.0, 3.0});
+
+    auto sub = server.createSubscription();
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.eventDriven = true;
+
+    std::vector<SharedVariant> values;
+    for (size_t i = 0; i < 2; ++i) {
+        sub.subscribeDataChangeShared(
+            id,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto& item, const SharedVariant& value, DateTime, StatusCode status) {
+                CHECK(item.getNodeId() == id);
+                CHECK(status.isGood());
+                values.push_back(value);
+            }
+        );
+    }
+    values.clear();
+
+    node.writeValueArray(std::vector<double>{4.0, 5.0});
+    REQUIRE(values.size() == 2);
+    CHECK(values[0]->getArrayLength() == 2);
+    // both monitored items share the same payload
+    CHECK(values[0]->handle()->data == values[1]->handle()->data);
+    CHECK(values[0].useCount() == 2);
+}
+
 TEST_CASE("Subscription & MonitoredItem (client)") {
     Server server;
     ServerRunner serverRunner(server);
@@ -156,6 +599,297 @@ TEST_CASE("Subscription & MonitoredItem (client)") {
         CHECK(monItem2.getMonitoredItemId() == monId2);
     }
 
+    SUBCASE("Monitor data change with batched request") {
+        auto sub = client.createSubscription();
+        const std::vector<NodeId> ids{
+            VariableId::Server_ServerStatus_CurrentTime,
+            VariableId::Server_ServerStatus_StartTime,
+            {1, 999999},  // unknown node
+        };
+
+        MonitoringParameters monitoringParameters{};
+        std::set<uint32_t> notifiedIds;
+        const auto items = sub.subscribeDataChange(
+            ids,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto& item, const DataValue&) {
+                CHECK(item.getAttributeId() == AttributeId::Value);
+                notifiedIds.insert(item.getMonitoredItemId());
+            }
+        );
+        CHECK(items.size() == 3);
+        CHECK(items[0].getMonitoredItemId() != 0);
+        CHECK(items[1].getMonitoredItemId() != 0);
+        CHECK(items[2].getMonitoredItemId() == 0);
+        CHECK(items[1].getNodeId() == ids[1]);
+        CHECK(sub.getMonitoredItems().size() == 2);
+
+        client.runIterate();
+        CHECK(notifiedIds.count(items[0].getMonitoredItemId()) == 1);
+        CHECK(notifiedIds.count(items[1].getMonitoredItemId()) == 1);
+
+        const std::vector<ReadValueId> itemsToMonitor{
+            {VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value},
+            {{1, 999999}, AttributeId::Value},
+        };
+        const auto results = services::createMonitoredItemsDataChange(
+            client,
+            sub.getSubscriptionId(),
+            itemsToMonitor,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            {}
+        );
+        CHECK(results.size() == 2);
+        CHECK(results[0].statusCode.isGood());
+        CHECK(results[0].monitoredItemId != 0);
+        CHECK(results[1].statusCode == UA_STATUSCODE_BADNODEIDUNKNOWN);
+        CHECK(sub.getMonitoredItems().size() == 3);
+    }
+
+    SUBCASE("Monitor data change with batched delivery") {
+        auto sub = client.createSubscription();
+        const std::vector<NodeId> ids{
+            VariableId::Server_ServerStatus_CurrentTime,
+            VariableId::Server_ServerStatus_StartTime,
+        };
+
+        MonitoringParameters monitoringParameters{};
+        size_t itemNotificationCount = 0;
+        const auto items = sub.subscribeDataChange(
+            ids,
+            AttributeId::Value,
+            MonitoringMode::Reporting,
+            monitoringParameters,
+            [&](const auto&, const DataValue&) { itemNotificationCount++; }
+        );
+
+        std::set<uint32_t> notifiedIds;
+        size_t batchCount = 0;
+        sub.setDataChangeBatchCallback(
+            [&](uint32_t subId, Span<const services::DataChangeNotification> notifications) {
+                CHECK(subId == sub.getSubscriptionId());
+                for (const auto& notification : notifications) {
+                    CHECK(notification.value.hasValue());
+                    notifiedIds.insert(notification.monId);
+                }
+                batchCount++;
+            }
+        );
+
+        client.runIterate();
+        CHECK(itemNotificationCount == 0);
+        CHECK(batchCount > 0);
+        CHECK(notifiedIds.count(items[0].getMonitoredItemId()) == 1);
+        CHECK(notifiedIds.count(items[1].getMonitoredItemId()) == 1);
+
+        CHECK_THROWS_WITH(
+            services::setDataChangeBatchCallback(client, 999999, {}), "BadSubscriptionIdInvalid"
+        );
+    }
+
+    SUBCASE("Monitor data change with typed callback") {
+        auto sub = client.createSubscription();
+        DateTime currentTime;
+        sub.subscribeDataChange<DateTime>(
+            VariableId::Server_ServerStatus_CurrentTime,
+            [&](const auto&, const DateTime& value, DateTime, StatusCode status) {
+                CHECK(status.isGood());
+                currentTime = value;
+            }
+        );
+        client.runIterate();
+        CHECK(currentTime.get() != 0);
+
+        CHECK_THROWS_WITH(
+            sub.subscribeDataChange<std::string>(
+                VariableId::Server_ServerStatus_CurrentTime,
+                [](const auto&, const std::string&, DateTime, StatusCode) {}
+            ),
+            "BadTypeMismatch"
+        );
+    }
+
+    SUBCASE("Monitor data change with notification queue") {
+        auto sub = client.createSubscription();
+        size_t itemNotificationCount = 0;
+        auto mon = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](const auto&, const DataValue&) { itemNotificationCount++; }
+        );
+        auto queue = sub.enableNotificationQueue(64);
+        CHECK(queue->capacity() == 64);
+
+        client.runIterate();
+        CHECK(itemNotificationCount == 0);
+
+        std::vector<NotificationQueue::Notification> batch;
+        std::thread consumer([&] { queue->poll(batch); });
+        consumer.join();
+        CHECK(!batch.empty());
+        CHECK(batch.at(0).monId == mon.getMonitoredItemId());
+        CHECK(batch.at(0).value.hasValue());
+
+        sub.disableNotificationQueue();
+    }
+
+    SUBCASE("Statistics") {
+        auto sub = client.createSubscription();
+        size_t itemNotificationCount = 0;
+        sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime,
+            AttributeId::Value,
+            [&](const auto&, const DataValue&) { itemNotificationCount++; }
+        );
+        client.runIterate();
+        CHECK(itemNotificationCount > 0);
+
+        const auto stats = sub.getStatistics();
+        CHECK(stats.notificationCount == itemNotificationCount);
+        CHECK(stats.notificationsPerSecond > 0.0);
+        CHECK(stats.overflowCount == 0);
+        CHECK(stats.latencyMax >= stats.latencyMean);
+        CHECK(stats.queuedCount == 0);
+        CHECK(stats.publishRequests > 0);
+
+        sub.deleteSubscription();
+        CHECK_THROWS_WITH(sub.getStatistics(), "BadSubscriptionIdInvalid");
+    }
+
+    SUBCASE("Adaptive publishing") {
+        SubscriptionParameters parameters{};
+        auto sub = client.createSubscription(parameters);
+        sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value, [](auto&&...) {}
+        );
+
+        services::AdaptivePublishingPolicy policy{};
+        policy.minPublishingInterval = 1000.0;
+        policy.maxPublishingInterval = 100.0;
+        CHECK_THROWS_WITH(sub.enableAdaptivePublishing(policy), "BadInvalidArgument");
+
+        // light load (CurrentTime changes once per second): the interval is halved down to the
+        // lower bound (minimum publishing interval of the server), keeping the keep-alive period
+        const auto initial = sub.getStatistics().parameters;
+        CHECK(initial.publishingInterval == 500.0);
+        const double keepAlivePeriod = initial.publishingInterval * initial.maxKeepAliveCount;
+        policy.minPublishingInterval = 100.0;
+        policy.maxPublishingInterval = 1000.0;
+        policy.evaluationInterval = 1.0;
+        sub.enableAdaptivePublishing(policy);
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (sub.getStatistics().parameters.publishingInterval > 100.0 &&
+               std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            client.runIterate();
+        }
+        const auto revised = sub.getStatistics().parameters;
+        CHECK(revised.publishingInterval == 100.0);
+        CHECK(revised.maxKeepAliveCount * revised.publishingInterval == keepAlivePeriod);
+        CHECK(revised.maxNotificationsPerPublish == 100);  // budget of 1000 per second
+
+        sub.disableAdaptivePublishing();
+        for (int i = 0; i < 3; ++i) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            client.runIterate();
+        }
+        CHECK(sub.getStatistics().parameters.publishingInterval == 100.0);  // kept fixed
+
+        CHECK_THROWS_WITH(
+            services::setAdaptivePublishing(client, 11U, policy), "BadSubscriptionIdInvalid"
+        );
+    }
+
+    SUBCASE("Monitor data change with client-side filter") {
+        const NodeId id{1, 2000};
+        auto node = client.getObjectsNode().addVariable(id, "filtered");
+        node.writeValueScalar(10.0);
+
+        SubscriptionParameters subscriptionParameters{};
+        subscriptionParameters.publishingInterval = 100.0;
+        auto sub = client.createSubscription(subscriptionParameters);
+        MonitoringParameters monitoringParameters{};
+        monitoringParameters.samplingInterval = 0.0;  // = fastest practical
+        const auto subscribe = [&](std::vector<double>& values) {
+            return sub.subscribeDataChange(
+                id,
+                AttributeId::Value,
+                MonitoringMode::Reporting,
+                monitoringParameters,
+                [&](const auto&, const DataValue& dv) {
+                    values.push_back(dv.getValue().getScalarCopy<double>());
+                }
+            );
+        };
+        std::vector<double> values;
+        std::vector<double> unfilteredValues;  // proves that the suppressed value was received
+        auto mon = subscribe(values);
+        auto unfiltered = subscribe(unfilteredValues);
+        services::ClientDataChangeFilter filter{};
+        filter.absoluteDeadband = 1.0;
+        mon.setClientDataChangeFilter(filter);
+
+        const auto iterateUntilReceived = [&](double value) {
+            const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+            while ((unfilteredValues.empty() || unfilteredValues.back() != value) &&
+                   std::chrono::steady_clock::now() < deadline) {
+                client.runIterate(10);
+            }
+        };
+        iterateUntilReceived(10.0);
+        node.writeValueScalar(10.5);  // within deadband
+        iterateUntilReceived(10.5);
+        node.writeValueScalar(12.0);
+        iterateUntilReceived(12.0);
+        client.runIterate(10);  // both notifications of a publish response are processed
+
+        CHECK(unfilteredValues == std::vector<double>{10.0, 10.5, 12.0});
+        CHECK(values == std::vector<double>{10.0, 12.0});
+
+        CHECK_THROWS_WITH(
+            services::setClientDataChangeFilter(client, sub.getSubscriptionId(), 999999, filter),
+            "BadMonitoredItemIdInvalid"
+        );
+    }
+
+    SUBCASE("Triggered reporting") {
+        auto sub = client.createSubscription();
+        auto trigger = sub.subscribeDataChange(
+            VariableId::Server_ServerStatus_CurrentTime, AttributeId::Value, {}
+        );
+
+        size_t notificationCount = 0;
+        const std::vector<NodeId> ids{
+            VariableId::Server_ServerStatus_State,
+            VariableId::Server_ServerStatus_StartTime,
+        };
+        MonitoringParameters monitoringParameters{};
+        auto linked = sub.linkTriggered(
+            trigger,
+            ids,
+            AttributeId::Value,
+            monitoringParameters,
+            [&](const auto&, const DataValue&) { notificationCount++; }
+        );
+        CHECK(linked.size() == 2);
+        CHECK(linked.at(0).getMonitoredItemId() != 0U);
+        CHECK(linked.at(1).getMonitoredItemId() != 0U);
+
+        // sampling items report with the notifications of the triggering item
+        for (int i = 0; i < 10 && notificationCount < 2; ++i) {
+            client.runIterate(100);
+        }
+        CHECK(notificationCount >= 2);
+
+        sub.unlinkTriggered(trigger, linked);
+        sub.linkTriggered(trigger, linked);
+        const MonitoredItem<Client> invalid(client, sub.getSubscriptionId(), 999);
+        CHECK_THROWS(sub.linkTriggered(invalid, linked));
+    }
+
     SUBCASE("Modify monitored item") {
         auto sub = client.createSubscription();
         auto mon = sub.subscribeDataChange(
@@ -195,6 +929,337 @@ TEST_CASE("Subscription & MonitoredItem (client)") {
         CHECK(sub.getMonitoredItems().size() == 1);
         CHECK(sub.getMonitoredItems().at(0) == mon);
     }
+
+    SUBCASE("Monitor typed event") {
+        struct Alarm {
+            uint16_t severity{};
+            LocalizedText message;
+        };
+
+        auto sub = client.createSubscription();
+        std::vector<Alarm> alarms;
+        sub.subscribeEvent(
+            ObjectId::Server,
+            EventFields<Alarm>()
+                .add(&Alarm::severity, {{0, "Severity"}})
+                .add(&Alarm::message, {{0, "Message"}}),
+            [&](const MonitoredItem<Client>&, const Alarm& alarm) { alarms.push_back(alarm); }
+        );
+        client.runIterate();
+
+        auto event = server.createEvent();
+        event.writeSeverity(300U);
+        event.writeMessage({"", "Alarm"});
+        event.trigger();
+
+        for (int i = 0; i < 10 && alarms.empty(); ++i) {
+            client.runIterate();
+            std::this_thread::sleep_for(10ms);
+        }
+        CHECK(alarms.size() == 1);
+        CHECK(alarms.at(0).severity == 300);
+        CHECK(alarms.at(0).message.getText() == "Alarm");
+    }
+
+    SUBCASE("Monitor events with a shared filter") {
+        const auto filter =
+            EventFilterBuilder()
+                .select({{0, "Severity"}})
+                .where({{0, "Severity"}}, FilterOperator::GreaterThanOrEqual, uint16_t{500})
+                .build();
+
+        auto sub = client.createSubscription();
+        std::vector<uint16_t> severities;
+        const auto onEvent = [&](const auto&, Span<const Variant> eventFields) {
+            severities.push_back(eventFields[0].getScalarCopy<uint16_t>());
+        };
+        sub.subscribeEvent(ObjectId::Server, filter, onEvent);
+        sub.subscribeEvent(ObjectId::Server, filter.get(), onEvent);  // copy of the filter
+        client.runIterate();
+
+        for (const int severity : {300, 600}) {
+            auto event = server.createEvent();
+            event.writeSeverity(static_cast<uint16_t>(severity));
+            event.trigger();
+        }
+
+        for (int i = 0; i < 10 && severities.size() < 2; ++i) {
+            client.runIterate();
+            std::this_thread::sleep_for(10ms);
+        }
+        CHECK(severities == std::vector<uint16_t>{600, 600});
+    }
 #endif
 }
 #endif
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS_EVENTS
+TEST_CASE("EventFields") {
+    struct Alarm {
+        DateTime time;
+        uint16_t severity{};
+        std::string sourceName;
+    };
+
+    auto fields = EventFields<Alarm>()
+                      .add(&Alarm::time, {{0, "Time"}})
+                      .add(&Alarm::severity, {{0, "Severity"}})
+                      .add(&Alarm::sourceName, {{0, "SourceName"}});
+
+    SUBCASE("Select clauses") {
+        const auto selectClauses = fields.getSelectClauses();
+        CHECK(selectClauses.size() == 3);
+        CHECK(selectClauses[1].getTypeDefinitionId() == NodeId(ObjectTypeId::BaseEventType));
+        CHECK(selectClauses[1].getBrowsePath().size() == 1);
+        CHECK(selectClauses[1].getBrowsePath()[0] == QualifiedName(0, "Severity"));
+        CHECK(selectClauses[1].getAttributeId() == AttributeId::Value);
+        CHECK(fields.createEventFilter().getSelectClauses().size() == 3);
+    }
+
+    SUBCASE("Decode") {
+        const std::vector<Variant> eventFields{
+            Variant::fromScalar(DateTime(1)),
+            Variant::fromScalar(uint16_t{500}),
+            Variant::fromScalar(std::string("Source")),
+        };
+        const Alarm alarm = fields.decode(eventFields);
+        CHECK(alarm.time == DateTime(1));
+        CHECK(alarm.severity == 500);
+        CHECK(alarm.sourceName == "Source");
+    }
+
+    SUBCASE("Decode empty and mismatching fields") {
+        const std::vector<Variant> eventFields{
+            Variant{},
+            Variant::fromScalar(1.0),
+        };
+        const Alarm alarm = fields.decode(eventFields);
+        CHECK(alarm.time == DateTime());
+        CHECK(alarm.severity == 0);
+        CHECK(alarm.sourceName.empty());
+    }
+}
+
+TEST_CASE("EventFilterBuilder") {
+    EventFilterBuilder builder;
+    builder.select({{0, "Time"}})
+        .select({{0, "Severity"}})
+        .whereOfType(ObjectTypeId::BaseEventType)
+        .where({{0, "Severity"}}, FilterOperator::GreaterThanOrEqual, uint16_t{500});
+    CHECK(builder.getSelectClauses().size() == 2);
+
+    const SharedEventFilter filter = builder.build();
+    CHECK(filter->getSelectClauses().size() == 2);
+    CHECK(filter->getSelectClauses()[1].getBrowsePath()[0] == QualifiedName(0, "Severity"));
+    const auto elements = filter->getWhereClause().getElements();
+    REQUIRE(elements.size() == 3);
+    CHECK(elements[0].getFilterOperator() == FilterOperator::And);
+    CHECK(elements[1].getFilterOperator() == FilterOperator::OfType);
+    CHECK(elements[2].getFilterOperator() == FilterOperator::GreaterThanOrEqual);
+
+    SUBCASE("Shared without copies") {
+        const SharedEventFilter copy = filter;  // NOLINT
+        CHECK(&copy.get() == &filter.get());
+        const auto extensionObject = filter.toExtensionObject();
+        CHECK(extensionObject.getDecodedData() == &filter.get());
+    }
+
+    SUBCASE("Without where clause") {
+        const auto selectOnly = EventFilterBuilder().select({{0, "Message"}}).build();
+        CHECK(selectOnly->getWhereClause().getElements().empty());
+    }
+}
+#endif
+
+#ifdef UA_ENABLE_SUBSCRIPTIONS
+TEST_CASE("Subscription & MonitoredItem recovery after reconnect (client)") {
+    auto server = std::make_unique<Server>();
+    auto serverRunner = std::make_unique<ServerRunner>(*server);
+    Client client;
+    ReconnectOptions reconnectOptions{};
+    reconnectOptions.initialDelay = 10ms;
+    reconnectOptions.maxDelay = 100ms;
+    client.setReconnect(reconnectOptions);
+    client.connect("opc.tcp://localhost:4840");
+
+    auto sub = client.createSubscription();
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.samplingInterval = 0.0;  // = fastest practical
+    size_t notificationCount = 0;
+    auto mon = sub.subscribeDataChange(
+        VariableId::Server_ServerStatus_CurrentTime,
+        AttributeId::Value,
+        MonitoringMode::Reporting,
+        monitoringParameters,
+        [&](const auto&, const DataValue&) { notificationCount++; }
+    );
+
+    size_t recreatedCount = 0;
+    uint32_t oldSubId = 0;
+    uint32_t newSubId = 0;
+    std::vector<std::pair<uint32_t, uint32_t>> monIds;
+    client.onSubscriptionRecreated([&](uint32_t oldId, uint32_t newId, auto ids) {
+        recreatedCount++;
+        oldSubId = oldId;
+        newSubId = newId;
+        monIds.assign(ids.begin(), ids.end());
+    });
+
+    std::vector<uint32_t> gapSubIds;
+    size_t gapSequenceNumbers = 0;
+    client.onNotificationGap([&](uint32_t subId, Span<const uint32_t> sequenceNumbers) {
+        gapSubIds.push_back(subId);
+        gapSequenceNumbers += sequenceNumbers.size();
+    });
+
+    SUBCASE("Recreate subscriptions after server restart") {
+        serverRunner.reset();
+        server.reset();
+        server = std::make_unique<Server>();
+        serverRunner = std::make_unique<ServerRunner>(*server);
+
+        for (int i = 0; i < 500 && recreatedCount == 0; ++i) {
+            client.runIterate(10);
+        }
+        REQUIRE(recreatedCount == 1);
+        CHECK(oldSubId == sub.getSubscriptionId());
+        REQUIRE(monIds.size() == 1);
+        CHECK(monIds[0].first == mon.getMonitoredItemId());
+        CHECK(client.getSubscriptions().size() == 1);
+        CHECK(client.getSubscriptions().at(0).getSubscriptionId() == newSubId);
+        // notifications during the restart are lost, the number is unknown
+        REQUIRE(gapSubIds.size() == 1);
+        CHECK(gapSubIds[0] == oldSubId);
+        CHECK(gapSequenceNumbers == 0);
+
+        notificationCount = 0;
+        for (int i = 0; i < 100 && notificationCount == 0; ++i) {
+            client.runIterate(10);
+        }
+        CHECK(notificationCount > 0);
+    }
+
+    SUBCASE("Maximum number of attempts") {
+        reconnectOptions.maxAttempts = 2;
+        client.setReconnect(reconnectOptions);
+        serverRunner.reset();
+        server.reset();
+
+        const auto runUntilFailure = [&] {
+            for (int i = 0; i < 500; ++i) {
+                client.runIterate(10);
+            }
+        };
+        CHECK_THROWS_AS(runUntilFailure(), BadStatus);
+    }
+}
+#endif
+
+#if defined(UA_ENABLE_SUBSCRIPTIONS) && defined(UA_ENABLE_METHODCALLS) && defined(__linux__) && \
+    UAPP_OPEN62541_VER_GE(1, 1) && UAPP_OPEN62541_VER_LE(1, 3)
+/// Drop the connection of a client without reading pending messages, like a broken link.
+static void dropConnection(Client& client) {
+    const int fd = client.getSocketFd();
+    REQUIRE(fd >= 0);
+    const int unconnected = ::socket(AF_INET, SOCK_STREAM, 0);
+    REQUIRE(unconnected >= 0);
+    REQUIRE(::dup2(unconnected, fd) == fd);  // closes the connection, unread data is discarded
+    ::close(unconnected);
+}
+
+TEST_CASE("Subscription republish after connection loss (client)") {
+    // fail the recovery by denying the GetMonitoredItems method, required to map client handles
+    class RecoveryAccessControl : public AccessControlDefault {
+    public:
+        bool getUserExecutableOnObject(
+            Session& session, const NodeId& methodId, const NodeId& objectId
+        ) override {
+            if (denyGetMonitoredItems && methodId == NodeId(MethodId::Server_GetMonitoredItems)) {
+                return false;
+            }
+            return AccessControlDefault::getUserExecutableOnObject(session, methodId, objectId);
+        }
+
+        std::atomic<bool> denyGetMonitoredItems{false};
+    };
+
+    RecoveryAccessControl accessControl;
+    Server server;
+    server.setAccessControl(accessControl);
+    const NodeId id{1, 1000};
+    services::addVariable(server, {0, UA_NS0ID_OBJECTSFOLDER}, id, "variable");
+    services::writeValue(server, id, Variant::fromScalar(1.0));
+    ServerRunner serverRunner(server);
+
+    Client writer;
+    writer.connect("opc.tcp://localhost:4840");
+    Client client;
+    ReconnectOptions reconnectOptions{};
+    reconnectOptions.initialDelay = 10ms;
+    reconnectOptions.maxDelay = 100ms;
+    client.setReconnect(reconnectOptions);
+    client.connect("opc.tcp://localhost:4840");
+
+    SubscriptionParameters subscriptionParameters{};
+    subscriptionParameters.publishingInterval = 20.0;
+    auto sub = client.createSubscription(subscriptionParameters);
+    MonitoringParameters monitoringParameters{};
+    monitoringParameters.samplingInterval = 0.0;  // = fastest practical
+    std::vector<double> values;
+    sub.subscribeDataChange(
+        id,
+        AttributeId::Value,
+        MonitoringMode::Reporting,
+        monitoringParameters,
+        [&](const auto&, const DataValue& dv) {
+            values.push_back(dv.getValue().getScalarCopy<double>());
+        }
+    );
+
+    std::vector<uint32_t> gapSubIds;
+    size_t gapSequenceNumbers = 0;
+    client.onNotificationGap([&](uint32_t subId, Span<const uint32_t> sequenceNumbers) {
+        gapSubIds.push_back(subId);
+        gapSequenceNumbers += sequenceNumbers.size();
+    });
+
+    for (int i = 0; i < 100 && values.empty(); ++i) {
+        client.runIterate(10);
+    }
+    REQUIRE(values == std::vector<double>{1.0});
+
+    // the server publishes the change with an outstanding Publish request, the client doesn't
+    // read the response before the connection is lost
+    services::writeValue(writer, id, Variant::fromScalar(2.0));
+    std::this_thread::sleep_for(200ms);
+
+    SUBCASE("Missed notification is republished once") {
+        dropConnection(client);
+        for (int i = 0; i < 200 && values.size() < 2; ++i) {
+            client.runIterate(10);
+        }
+        // keep publishing to catch duplicates, e.g. initial values of the transfer
+        for (int i = 0; i < 20; ++i) {
+            client.runIterate(10);
+        }
+        CHECK(values == std::vector<double>{1.0, 2.0});
+        CHECK(gapSubIds.empty());
+    }
+
+    SUBCASE("Gap is reported if the recovery fails") {
+        accessControl.denyGetMonitoredItems = true;
+        dropConnection(client);
+        for (int i = 0; i < 200 && gapSubIds.empty(); ++i) {
+            client.runIterate(10);
+        }
+        REQUIRE(gapSubIds.size() == 1);
+        CHECK(gapSubIds[0] == sub.getSubscriptionId());
+        CHECK(gapSequenceNumbers >= 1);  // the retained message with the change
+        // the current value is sent with the transfer (initial values)
+        for (int i = 0; i < 200 && values.size() < 2; ++i) {
+            client.runIterate(10);
+        }
+        CHECK(values == std::vector<double>{1.0, 2.0});
+    }
+}
+#endif
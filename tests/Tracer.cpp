@@ -0,0 +1,102 @@
+#include <memory>
+#include <string>
+#include <utility>  // pair
+#include <vector>
+
+#include <doctest/doctest.h>
+
+#include "open62541pp/Client.h"
+#include "open62541pp/Node.h"
+#include "open62541pp/Server.h"
+#include "open62541pp/Tracer.h"
+#include "open62541pp/ValueBackend.h"
+
+#include "helper/Runner.h"
+
+using namespace opcua;
+
+namespace {
+
+class RecordingTracer : public Tracer {
+public:
+    void* startSpan(std::string_view name) override {
+        started.emplace_back(name);
+        return &started.back();
+    }
+
+    void endSpan(void* span, UA_StatusCode status) noexcept override {
+        ended.emplace_back(*static_cast<std::string*>(span), status);
+    }
+
+    std::vector<std::string> started;
+    std::vector<std::pair<std::string, UA_StatusCode>> ended;
+};
+
+}  // namespace
+
+TEST_CASE("Tracer sampling") {
+    RecordingTracer tracer;
+    CHECK(tracer.getSamplingRatio() == 1.0);
+    CHECK(tracer.shouldSample());
+
+    tracer.setSamplingRatio(0.0);
+    CHECK_FALSE(tracer.shouldSample());
+
+    tracer.setSamplingRatio(0.25);
+    int sampled = 0;
+    for (int i = 0; i < 100; ++i) {
+        sampled += tracer.shouldSample() ? 1 : 0;
+    }
+    CHECK(sampled == 25);
+
+    tracer.setSamplingRatio(2.0);  // clamped
+    CHECK(tracer.getSamplingRatio() == 1.0);
+}
+
+TEST_CASE("Tracer spans") {
+    Server server;
+    const NodeId id{1, 1000};
+    auto node = server.getObjectsNode().addVariable(id, "testVariable");
+    ValueBackendDataSource dataSource;
+    dataSource.read = [&](DataValue& value, const NumericRange&, bool) {
+        value.getValue().setScalar(1);
+        return UA_STATUSCODE_GOOD;
+    };
+    dataSource.write = [&](const DataValue&, const NumericRange&) {
+        return UA_STATUSCODE_BADNOTWRITABLE;
+    };
+    server.setVariableNodeValueBackend(id, dataSource);
+
+    SUBCASE("Server callbacks") {
+        auto tracer = std::make_shared<RecordingTracer>();
+        tracer->started.reserve(8);  // span handles point into the vector
+        server.setTracer(tracer);
+        node.readValueScalar<int>();
+        CHECK_THROWS(node.writeValueScalar<int>(2));
+        CHECK(tracer->started == std::vector<std::string>{"DataSource", "DataSource"});
+        REQUIRE(tracer->ended.size() == 2);
+        CHECK(tracer->ended[0].second == UA_STATUSCODE_GOOD);
+        CHECK(tracer->ended[1].second == UA_STATUSCODE_BADNOTWRITABLE);
+
+        server.setTracer(nullptr);
+        node.readValueScalar<int>();
+        CHECK(tracer->started.size() == 2);
+    }
+
+    SUBCASE("Client services") {
+        ServerRunner serverRunner(server);
+        Client client;
+        client.connect("opc.tcp://localhost:4840");
+
+        auto tracer = std::make_shared<RecordingTracer>();
+        tracer->started.reserve(8);
+        client.setTracer(tracer);
+        client.getNode(id).readValueScalar<int>();
+        client.setTracer(nullptr);
+
+        CHECK(tracer->started == std::vector<std::string>{"Read"});
+        REQUIRE(tracer->ended.size() == 1);
+        CHECK(tracer->ended[0].first == "Read");
+        CHECK(tracer->ended[0].second == UA_STATUSCODE_GOOD);
+    }
+}
@@ -1,3 +1,7 @@
+#include <chrono>
+#include <string>
+#include <vector>
+
 #include <doctest/doctest.h>
 
 #include "open62541pp/TypeConverter.h"
@@ -141,4 +145,52 @@ TEST_CASE("TypeConverter std::chrono::time_point") {
         TypeConverter<TimePoint>::fromNative(src, dst);
         CHECK(dst.time_since_epoch().count() == 0);
     }
+
+    SUBCASE("Arrays") {
+        CHECK(detail::hasArrayConversion<TimePoint>);
+        const std::vector<TimePoint> src{
+            TimePoint{}, TimePoint{std::chrono::seconds(1)}, TimePoint{std::chrono::hours(24)}
+        };
+        auto* native = detail::toNativeArrayAlloc(src.begin(), src.end());
+        CHECK(native[0] == UA_DATETIME_UNIX_EPOCH);  // NOLINT
+        CHECK(native[1] == UA_DATETIME_UNIX_EPOCH + UA_DATETIME_SEC);  // NOLINT
+        CHECK(detail::fromNativeArray<TimePoint>(native, src.size()) == src);
+        UA_Array_delete(native, src.size(), &UA_TYPES[UA_TYPES_DATETIME]);
+
+        UA_DateTime beforeEpoch = 0;  // clamped to Unix epoch
+        CHECK(detail::fromNativeArray<TimePoint>(&beforeEpoch, 1).at(0) == TimePoint{});
+    }
+}
+
+TEST_CASE("TypeConverter StatusCode") {
+    StatusCode dst;
+    TypeConverter<StatusCode>::fromNative(UA_STATUSCODE_BADTIMEOUT, dst);
+    CHECK(dst == UA_STATUSCODE_BADTIMEOUT);
+    UA_StatusCode native{};
+    TypeConverter<StatusCode>::toNative(dst, native);
+    CHECK(native == UA_STATUSCODE_BADTIMEOUT);
+}
+
+TEST_CASE("TypeConverter trivially mappable arrays") {
+    SUBCASE("isTriviallyMappable") {
+        CHECK(detail::isTriviallyMappable<UA_Float>);
+        CHECK(detail::isTriviallyMappable<const UA_Double>);
+        CHECK(detail::isTriviallyMappable<UA_NodeClass>);
+        CHECK(detail::isTriviallyMappable<DateTime>);
+        CHECK(detail::isTriviallyMappable<StatusCode>);
+        CHECK_FALSE(detail::isTriviallyMappable<UA_String>);
+        CHECK_FALSE(detail::isTriviallyMappable<std::string>);
+        CHECK_FALSE(detail::isTriviallyMappable<std::chrono::system_clock::time_point>);
+    }
+
+    SUBCASE("Roundtrip") {
+        const std::vector<DateTime> src{DateTime(1), DateTime(2), DateTime(3)};
+        auto* native = detail::toNativeArrayAlloc(src.begin(), src.end());
+        CHECK(native[0] == 1);  // NOLINT
+        CHECK(native[2] == 3);  // NOLINT
+        const auto dst = detail::fromNativeArray<DateTime>(native, src.size());
+        CHECK(dst.size() == 3);
+        CHECK(dst[1].get() == 2);
+        UA_Array_delete(native, src.size(), &UA_TYPES[UA_TYPES_DATETIME]);
+    }
 }
@@ -127,6 +127,14 @@ TEST_CASE("TypeWrapper") {
 
         // UA_String_clear not necessary, because data is now owned by wrapper
     }
+
+    SUBCASE("Release") {
+        TypeWrapper<UA_String, UA_TYPES_STRING> wrapper(UA_STRING_ALLOC("test"));
+        UA_String str = wrapper.release();
+        CHECK(wrapper.handle()->data == nullptr);
+        CHECK(detail::toString(str) == "test");
+        UA_String_clear(&str);
+    }
 }
 
 TEST_CASE("asWrapper / asNative") {
@@ -1,13 +1,27 @@
+#include <algorithm>
 #include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
 #include <utility>  // move
 #include <vector>
 
 #include <doctest/doctest.h>
 
+#include "open62541pp/BinaryEncoding.h"
+#include "open62541pp/CachedClock.h"
 #include "open62541pp/Common.h"
+#include "open62541pp/Compression.h"
 #include "open62541pp/Config.h"
+#include "open62541pp/ErrorHandling.h"
+#include "open62541pp/NodeIdNames.h"
 #include "open62541pp/NodeIds.h"
 #include "open62541pp/detail/helper.h"  // detail::toString
 #include "open62541pp/types/Builtin.h"
@@ -17,6 +31,7 @@
 #include "open62541pp/types/ExtensionObject.h"
 #include "open62541pp/types/NodeId.h"
 #include "open62541pp/types/Variant.h"
+#include "open62541pp/types/VariantView.h"
 
 using namespace opcua;
 
@@ -173,6 +188,25 @@ TEST_CASE("Guid") {
     }
 }
 
+TEST_CASE("QualifiedNameView") {
+    const std::string name("Severity");
+    const QualifiedNameView view(1, name);
+    CHECK(view->getNamespaceIndex() == 1);
+    CHECK(view->getName() == "Severity");
+    CHECK(view->getName().data() == name.data());  // no copy
+    const QualifiedName& ref = view;
+    CHECK(ref == QualifiedName(1, "Severity"));
+    const QualifiedName copy(view);  // deep copy
+    CHECK(copy.getName().data() != name.data());
+}
+
+TEST_CASE("LocalizedTextView") {
+    const LocalizedTextView view("en-US", "text");
+    CHECK(view->getLocale() == "en-US");
+    CHECK(view->getText() == "text");
+    CHECK(view.get() == LocalizedText("en-US", "text"));
+}
+
 TEST_CASE("NumericRangeDimension") {
     CHECK(NumericRangeDimension{} == NumericRangeDimension{});
     CHECK(NumericRangeDimension{1, 2} == NumericRangeDimension{1, 2});
@@ -210,6 +244,18 @@ TEST_CASE("NumericRange") {
         CHECK(nr.get().at(2) == NumericRangeDimension{5, 5});
     }
 
+    SUBCASE("Cache") {
+        NumericRangeCache cache;
+        const auto& nr = cache.get("1:2,0:3");
+        CHECK(nr.get().size() == 2);
+        CHECK(&cache.get("1:2,0:3") == &nr);  // parsed once
+        CHECK(cache.size() == 1);
+        CHECK_THROWS(cache.get("abc"));
+        CHECK(cache.size() == 1);
+        cache.clear();
+        CHECK(cache.size() == 0);
+    }
+
     SUBCASE("toString") {
         CHECK(NumericRange({{1, 1}}).toString() == "1");
         CHECK(NumericRange({{1, 2}}).toString() == "1:2");
@@ -266,6 +312,29 @@ TEST_CASE("DateTime") {
     }
 }
 
+TEST_CASE("CachedClock") {
+    REQUIRE_FALSE(CachedClock::isActive());
+
+    CachedClock::addSource();
+    CHECK(CachedClock::isActive());
+    const auto cached = CachedClock::now();
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    CHECK(CachedClock::now() == cached);
+    CachedClock::update();
+    CHECK(CachedClock::now().get() > cached.get());
+    CachedClock::removeSource();
+    CHECK_FALSE(CachedClock::isActive());
+
+    {
+        const CachedClockTicker ticker(std::chrono::milliseconds(1));
+        CHECK(CachedClock::isActive());
+        const auto first = CachedClock::now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK(CachedClock::now().get() > first.get());
+    }
+    CHECK_FALSE(CachedClock::isActive());
+}
+
 TEST_CASE("NodeId") {
     SUBCASE("Construct with numeric identifier") {
         NodeId id(1, 123);
@@ -362,6 +431,50 @@ TEST_CASE("NodeId") {
     }
 }
 
+TEST_CASE("NodeId names") {
+    CHECK(lookupNodeId("Server_ServerStatus_CurrentTime") ==
+          NodeId(VariableId::Server_ServerStatus_CurrentTime));
+    CHECK(lookupNodeId("BaseDataVariableType") == NodeId(VariableTypeId::BaseDataVariableType));
+    CHECK(lookupNodeId("HasSubtype") == NodeId(ReferenceTypeId::HasSubtype));
+    CHECK(lookupNodeId("Boolean") == NodeId(DataTypeId::Boolean));
+    CHECK_FALSE(lookupNodeId("").has_value());
+    CHECK_FALSE(lookupNodeId("Unknown").has_value());
+    CHECK_FALSE(lookupNodeId("boolean").has_value());
+
+    CHECK(lookupNodeIdName(UA_NS0ID_SERVER_SERVERSTATUS_CURRENTTIME) ==
+          "Server_ServerStatus_CurrentTime");
+    CHECK(lookupNodeIdName(NodeId(ObjectId::ObjectsFolder)) == "ObjectsFolder");
+    CHECK(lookupNodeIdName(0).empty());
+    CHECK(lookupNodeIdName(NodeId(1, UA_NS0ID_OBJECTSFOLDER)).empty());
+    CHECK(lookupNodeIdName(NodeId(0, "ObjectsFolder")).empty());
+}
+
+TEST_CASE("NumericNodeId") {
+    static constexpr NumericNodeId id(ObjectId::ObjectsFolder);
+    static_assert(id.getNamespaceIndex() == 0);
+    static_assert(id.getIdentifier() == UA_NS0ID_OBJECTSFOLDER);
+    static_assert(id == NumericNodeId(0, UA_NS0ID_OBJECTSFOLDER));
+    static_assert(id != NumericNodeId(1, UA_NS0ID_OBJECTSFOLDER));
+
+    const NodeId& ref = id;
+    CHECK(ref == NodeId(0, UA_NS0ID_OBJECTSFOLDER));
+    CHECK(ref.handle() == id.handle());  // no copy
+    CHECK(std::hash<NumericNodeId>()(id) == std::hash<NodeId>()(ref));
+}
+
+TEST_CASE("HashedNodeId") {
+    const HashedNodeId id(NodeId(1, "Test"));
+    CHECK(id.hash() == NodeId(1, "Test").hash());
+    CHECK(id.get() == NodeId(1, "Test"));
+    CHECK(id == HashedNodeId(NodeId(1, "Test")));
+    CHECK(id != HashedNodeId(NodeId(1, "Other")));
+    CHECK(HashedNodeId().hash() == NodeId().hash());
+
+    std::unordered_map<HashedNodeId, int> map;
+    map[id] = 1;
+    CHECK(map.at(NodeId(1, "Test")) == 1);
+}
+
 TEST_CASE("ExpandedNodeId") {
     ExpandedNodeId idLocal({1, "local"}, {}, 0);
     CHECK(idLocal.isLocal());
@@ -574,6 +687,17 @@ TEST_CASE("Variant") {
         CHECK_THROWS(var.getArrayCopy<int32_t>());
         CHECK_THROWS(var.getArrayCopy<bool>());
         CHECK(var.getArrayCopy<float>() == array);
+
+#ifdef UAPP_HAS_PMR
+        std::array<std::byte, 64> buffer{};
+        std::pmr::monotonic_buffer_resource resource(
+            buffer.data(), buffer.size(), std::pmr::null_memory_resource()
+        );
+        const auto copy = var.getArrayCopy<float>(&resource);
+        CHECK(copy.get_allocator().resource() == &resource);
+        CHECK(std::equal(copy.begin(), copy.end(), array.begin(), array.end()));
+        CHECK_THROWS_AS(var.getArrayCopy<int32_t>(&resource), BadVariantAccess);
+#endif
     }
 
     SUBCASE("Set/get array reference") {
@@ -629,6 +753,97 @@ TEST_CASE("Variant") {
         CHECK(var.getArrayCopy<std::string>() == value);
     }
 
+    SUBCASE("Take scalar/array (move)") {
+        Variant var = Variant::fromScalar(String("test"));
+        const auto* data = static_cast<UA_String*>(var.data())->data;
+        const String str = var.takeScalar<String>();
+        CHECK(str.handle()->data == data);  // no copy
+        CHECK(var.isEmpty());
+
+        var = Variant::fromArray(std::vector<std::string>{"a", "b"});
+        CHECK(var.takeArray<std::string>() == std::vector<std::string>{"a", "b"});  // converted
+        CHECK(var.isEmpty());
+
+        // data not owned by the variant is copied
+        String value("borrowed");
+        var.setScalar(value);
+        CHECK(var.takeScalar<String>() == value);
+        CHECK(value.handle()->data != nullptr);
+
+        CHECK_THROWS(Variant::fromScalar(1).takeArray<int>());
+    }
+
+    SUBCASE("Get array range (zero-copy)") {
+        std::vector<int32_t> array{0, 1, 2, 3, 4, 5, 6, 7};
+        Variant var;
+        var.setArray(array);
+        const auto view = var.getArrayRange<int32_t>(NumericRange("2:5"));
+        CHECK(view.data() == array.data() + 2);
+        CHECK(view.size() == 4);
+        CHECK(var.getArrayRange<int32_t>(NumericRange("6:10")).size() == 2);  // truncated
+        CHECK(var.getArrayRange<int32_t>(NumericRange("3")).size() == 1);
+        CHECK_THROWS_AS(var.getArrayRange<int32_t>(NumericRange("8:9")), BadStatus);
+        CHECK_THROWS_AS(var.getArrayRange<int32_t>(NumericRange("0:1,0:1")), BadStatus);
+        CHECK_THROWS(var.getArrayRange<double>(NumericRange("0:1")));
+
+        const auto copy = var.copyRange(NumericRange("1:2"));
+        CHECK(copy.getArrayCopy<int32_t>() == std::vector<int32_t>{1, 2});
+        CHECK(copy.data() != array.data() + 1);
+    }
+
+    SUBCASE("Multi-dimensional array view") {
+        std::vector<float> image(2 * 3);
+        const std::array<uint32_t, 2> dimensions{2, 3};
+        Variant var;
+        var.setArray(Span(image), dimensions);
+        CHECK(var.data() == image.data());  // no copy
+        CHECK(var.getArrayDimensions().data() == dimensions.data());
+
+        auto view = var.getArrayView<float, 2>();
+        CHECK(view.extent(0) == 2);
+        CHECK(view.extent(1) == 3);
+        CHECK(view.stride(0) == 3);
+        view(1, 2) = 1.5F;
+        CHECK(image[5] == 1.5F);
+        CHECK(view[1][2] == 1.5F);
+        CHECK(view[1].data() == image.data() + 3);
+
+        CHECK_THROWS_AS((var.getArrayView<float, 3>()), BadVariantAccess);
+        CHECK_THROWS_AS((var.getArrayView<int32_t, 2>()), BadVariantAccess);
+        CHECK_THROWS_AS(var.setArray(Span(image), Span<const uint32_t>({4, 2})), BadStatus);
+
+        const std::array<uint32_t, 2> transposed{3, 2};
+        var.setArrayCopy(Span(image), transposed);
+        CHECK(var.data() != image.data());
+        CHECK(var.getArrayDimensions().data() != transposed.data());
+        CHECK(std::as_const(var).getArrayView<float, 2>()(2, 1) == 1.5F);
+
+        var.setArray(image);  // no dimensions, rank 1
+        CHECK(var.getArrayView<float, 1>().size() == 6);
+    }
+
+    SUBCASE("String array view") {
+        std::vector<String> array{String("a"), String(""), String("tag")};
+        Variant var;
+        var.setArray(array);
+        const auto view = var.getArrayView<std::string_view>();
+        CHECK(view.size() == 3);
+        CHECK(view.data() == array[0].handle());
+        CHECK(view[0] == "a");
+        CHECK(view[1].empty());
+        CHECK(view.back() == "tag");
+        CHECK(view[2].data() == (const char*)array[2]->data);  // no copy
+        CHECK(std::vector<std::string_view>(view.begin(), view.end()) ==
+              std::vector<std::string_view>{"a", "", "tag"});
+        CHECK(std::find(view.begin(), view.end(), "tag") - view.begin() == 2);
+
+        CHECK_THROWS_AS(Variant().getArrayView<std::string_view>(), BadVariantAccess);
+        CHECK_THROWS_AS(
+            Variant::fromArray(std::vector<int>{1}).getArrayView<std::string_view>(),
+            BadVariantAccess
+        );
+    }
+
     SUBCASE("Set array from initializer list") {
         Variant var;
         var.setArrayCopy<const int>({1, 2, 3});  // TODO: avoid manual template types
@@ -680,6 +895,110 @@ TEST_CASE("Variant") {
     }
 }
 
+TEST_CASE("Variant numeric array conversion") {
+    SUBCASE("saturateCast") {
+        CHECK(detail::saturateCast<int16_t>(100000) == 32767);
+        CHECK(detail::saturateCast<int16_t>(-100000) == -32768);
+        CHECK(detail::saturateCast<uint16_t>(-1) == 0);
+        CHECK(detail::saturateCast<int32_t>(uint32_t{4000000000}) == 2147483647);
+        CHECK(detail::saturateCast<uint8_t>(300.5) == 255);
+        CHECK(detail::saturateCast<int64_t>(1e30) == INT64_MAX);
+        CHECK(detail::saturateCast<int32_t>(-2.7) == -2);
+        CHECK(detail::saturateCast<int32_t>(std::numeric_limits<double>::quiet_NaN()) == 0);
+        CHECK(detail::saturateCast<float>(int16_t{-5}) == -5.0f);
+    }
+
+    SUBCASE("getArrayAs") {
+        std::vector<int16_t> raw{-100, 0, 100, 200};
+        const auto var = Variant::fromArray(raw);
+        std::vector<float> output(raw.size());
+        var.getArrayAs<float>(output);
+        CHECK(output == std::vector<float>{-100.0f, 0.0f, 100.0f, 200.0f});
+
+        var.getArrayAs<float>(output, 0.5, 10.0);
+        CHECK(output == std::vector<float>{-40.0f, 10.0f, 60.0f, 110.0f});
+
+        std::vector<uint8_t> bytes(raw.size());
+        var.getArrayAs<uint8_t>(bytes);
+        CHECK(bytes == std::vector<uint8_t>{0, 0, 100, 200});
+
+        std::vector<float> invalidSize(2);
+        CHECK_THROWS_AS(var.getArrayAs<float>(invalidSize), BadVariantAccess);
+        std::vector<float> single(1);
+        CHECK_THROWS_AS(
+            Variant::fromArray(std::vector<std::string>{"a"}).getArrayAs<float>(single),
+            BadVariantAccess
+        );
+    }
+
+    SUBCASE("setArrayAs") {
+        const std::vector<double> values{1.5, -2.5, 1e40};
+        Variant var;
+        var.setArrayAs<float>(values);
+        CHECK(var.isType(Type::Float));
+        CHECK(var.getArrayLength() == 3);
+        CHECK(var.getArray<float>()[0] == 1.5f);
+
+        var.setArrayAs<int32_t>(values, 2.0, 1.0);
+        CHECK(var.isType(Type::Int32));
+        CHECK(var.getArrayCopy<int32_t>() == std::vector<int32_t>{4, -4, INT32_MAX});
+    }
+}
+
+TEST_CASE("VariantView") {
+    SUBCASE("Span") {
+        std::vector<int32_t> array{1, 2, 3};
+        const VariantView view(Span<const int32_t>{array});
+        CHECK(view->isArray());
+        CHECK(view->isType(Type::Int32));
+        CHECK(view->data() == array.data());
+        CHECK(view->handle()->storageType == UA_VARIANT_DATA_NODELETE);
+        CHECK(view.getKeepAlive() == nullptr);
+
+        const VariantView copy(view);  // NOLINT
+        CHECK(copy->data() == array.data());
+    }
+
+    SUBCASE("String views") {
+        const std::string tag("tag");
+        const std::vector<std::string_view> array{"a", "", tag};
+        const VariantView view(array);
+        CHECK(view->isArray());
+        CHECK(view->isType(Type::String));
+        CHECK(view->handle()->storageType == UA_VARIANT_DATA_NODELETE);
+        CHECK(view.getKeepAlive() != nullptr);  // owns the UA_String headers
+        CHECK(view->getArrayView<std::string_view>()[2].data() == tag.data());  // no copy
+        CHECK(view->getArrayCopy<std::string>() == std::vector<std::string>{"a", "", "tag"});
+
+        const VariantView copy(view);  // NOLINT
+        CHECK(copy->data() == view->data());
+    }
+
+    SUBCASE("Shared array") {
+        auto array = std::make_shared<const std::vector<double>>(std::vector<double>{1.0, 2.0});
+        const auto* data = array->data();
+        VariantView view(array);
+        array.reset();
+        CHECK(view.getKeepAlive().use_count() == 1);
+        CHECK(view->data() == data);
+        CHECK(view->getArray<double>()[1] == 2.0);
+
+        VariantView copy;
+        copy = view;
+        CHECK(view.getKeepAlive().use_count() == 2);
+        view = VariantView();
+        CHECK(copy->getArrayCopy<double>() == std::vector<double>{1.0, 2.0});
+    }
+
+    SUBCASE("Borrow") {
+        const std::vector<int32_t> array{1, 2, 3};
+        const VariantView view(Span<const int32_t>{array});
+        DataValue dv;
+        dv.setValue(view.borrow());
+        CHECK(dv.getValue().data() == array.data());
+    }
+}
+
 TEST_CASE("DataValue") {
     SUBCASE("Create from scalar") {
         CHECK(DataValue::fromScalar(5).getValue().getScalar<int>() == 5);
@@ -738,6 +1057,14 @@ TEST_CASE("DataValue") {
             CHECK(dv.getValue().getScalar<float>() == value);
             CHECK(dv->value.data == &value);
         }
+        SUBCASE("Take value (move)") {
+            dv.setValue(Variant::fromScalar(String("test")));
+            const auto* data = dv->value.data;
+            const Variant var = dv.takeValue();
+            CHECK(var.data() == data);
+            CHECK_FALSE(dv.hasValue());
+            CHECK(dv.getValue().isEmpty());
+        }
         SUBCASE("Value (copy)") {
             float value = 11.11f;
             Variant var;
@@ -1252,6 +1579,16 @@ TEST_CASE("DataChangeFilter") {
     CHECK(dataChangeFilter.getTrigger() == DataChangeTrigger::StatusValue);
     CHECK(dataChangeFilter.getDeadbandType() == DeadbandType::Percent);
     CHECK(dataChangeFilter.getDeadbandValue() == 11.11);
+
+    const auto absolute = DataChangeFilter::absoluteDeadband(0.5);
+    CHECK(absolute.getTrigger() == DataChangeTrigger::StatusValue);
+    CHECK(absolute.getDeadbandType() == DeadbandType::Absolute);
+    CHECK(absolute.getDeadbandValue() == 0.5);
+
+    const auto percent = DataChangeFilter::percentDeadband(10.0, DataChangeTrigger::Status);
+    CHECK(percent.getTrigger() == DataChangeTrigger::Status);
+    CHECK(percent.getDeadbandType() == DeadbandType::Percent);
+    CHECK(percent.getDeadbandValue() == 10.0);
 }
 
 TEST_CASE("EventFilter") {
@@ -1283,6 +1620,155 @@ TEST_CASE("AggregateFilter") {
     CHECK(aggregateFilter.getAggregateType() == NodeId(ObjectId::AggregateFunction_Average));
     CHECK(aggregateFilter.getProcessingInterval() == 11.11);
     CHECK(aggregateFilter.getAggregateConfiguration().useSlopedExtrapolation == true);
+
+    const AggregateFilter aggregateFilterDefaults(
+        startTime, ObjectId::AggregateFunction_Average, 11.11
+    );
+    CHECK(aggregateFilterDefaults.getAggregateConfiguration().useServerCapabilitiesDefaults);
 }
 
 #endif
+
+#if UAPP_OPEN62541_VER_GE(1, 3)
+TEST_CASE("Binary encoding") {
+    std::vector<DataValue> values;
+    for (int i = 0; i < 10; ++i) {
+        values.push_back(DataValue::fromScalar(i));
+    }
+
+    size_t size = 0;
+    for (const auto& dv : values) {
+        size += calcSizeBinary(dv);
+    }
+    CHECK(size > 0);
+
+    SUBCASE("Encode into preallocated buffer") {
+        std::vector<uint8_t> buffer(size);
+        Span<uint8_t> out(buffer);
+        for (const auto& dv : values) {
+            const size_t written = encodeBinary(dv, out);
+            CHECK(written == calcSizeBinary(dv));
+            out = out.subview(written);
+        }
+        CHECK(out.empty());
+
+        Span<const uint8_t> in(buffer);
+        for (int i = 0; i < 10; ++i) {
+            const auto dv = decodeBinary<DataValue>(in);
+            CHECK(dv.getValue().getScalarCopy<int>() == i);
+            in = in.subview(calcSizeBinary(dv));
+        }
+    }
+
+    SUBCASE("Buffer too small") {
+        std::vector<uint8_t> buffer(calcSizeBinary(values[0]) - 1);
+        CHECK_THROWS_AS(encodeBinary(values[0], Span<uint8_t>(buffer)), BadStatus);
+        CHECK_THROWS_AS(encodeBinary(values[0], Span<uint8_t>()), BadStatus);
+    }
+
+    SUBCASE("Encode into ByteString") {
+        const String str("test");
+        const ByteString encoded = encodeBinary(str);
+        CHECK(encoded.handle()->length == calcSizeBinary(str));
+        const Span<const uint8_t> in(encoded.handle()->data, encoded.handle()->length);
+        CHECK(decodeBinary<String>(in) == "test");
+    }
+
+    SUBCASE("Decode invalid data") {
+        const std::array<uint8_t, 2> invalid{0xFF, 0xFF};
+        CHECK_THROWS_AS(decodeBinary<String>(invalid), BadStatus);
+    }
+}
+
+TEST_CASE("Payload compression") {
+    // simple run-length encoding as test codec: pairs of (count, byte)
+    const CompressionCodec rle{
+        CompressionAlgorithm::Custom,
+        [](size_t size) { return 2 * size; },
+        [](Span<const uint8_t> input, Span<uint8_t> output) {
+            size_t n = 0;
+            for (size_t i = 0; i < input.size();) {
+                size_t run = 1;
+                while (i + run < input.size() && run < 255 && input[i + run] == input[i]) {
+                    ++run;
+                }
+                output[n++] = static_cast<uint8_t>(run);
+                output[n++] = input[i];
+                i += run;
+            }
+            return n;
+        },
+        [](Span<const uint8_t> input, Span<uint8_t> output) {
+            size_t n = 0;
+            for (size_t i = 0; i + 1 < input.size() && n < output.size(); i += 2) {
+                for (size_t j = 0; j < input[i] && n < output.size(); ++j) {
+                    output[n++] = input[i + 1];
+                }
+            }
+            return n;
+        },
+    };
+
+    std::vector<float> waveform(100000, 1.0F);
+    waveform[42] = 2.0F;
+    const std::array<uint32_t, 2> dimensions{1000, 100};
+    Variant value;
+    value.setArrayCopy(Span(waveform), dimensions);
+    const size_t encodedSize = calcSizeBinary(*value.handle());
+
+    SUBCASE("Roundtrip") {
+        Variant var = value;
+        CHECK(compressValue(var, rle));
+        CHECK(isCompressedPayload(var));
+        CHECK(var.getScalar<ByteString>()->length < encodedSize / 10);
+        CHECK_FALSE(compressValue(var, rle));  // already compressed
+
+        CHECK(decompressValue(var, {&rle, 1}));
+        CHECK(var.getArrayCopy<float>() == waveform);
+        CHECK(var.getArrayDimensions().size() == 2);
+        CHECK_FALSE(decompressValue(var, {&rle, 1}));
+    }
+
+    SUBCASE("Algorithm None") {
+        Variant var = value;
+        CHECK(compressValue(var, CompressionCodec{}));
+        CHECK(isCompressedPayload(var));
+        CHECK(decompressValue(var, {}));
+        CHECK(var.getArrayCopy<float>() == waveform);
+    }
+
+    SUBCASE("Small values are not compressed") {
+        Variant var = Variant::fromScalar(ByteString("small"));
+        CHECK_FALSE(compressValue(var, rle));
+        CHECK_FALSE(isCompressedPayload(var));
+    }
+
+    SUBCASE("Missing codec and size limit") {
+        Variant var = value;
+        CHECK(compressValue(var, rle));
+        CHECK_THROWS_AS(decompressValue(var, {}), BadStatus);
+        CompressionOptions options;
+        options.maxDecompressedSize = encodedSize - 1;
+        CHECK_THROWS_AS(decompressValue(var, {&rle, 1}, options), BadStatus);
+    }
+
+    SUBCASE("Data source") {
+        ValueBackendDataSource source;
+        source.read = [&](DataValue& dv, const NumericRange&, bool) {
+            dv.setValue(value);
+            return UA_STATUSCODE_GOOD;
+        };
+        Variant written;
+        source.write = [&](const DataValue& dv, const NumericRange&) {
+            written = dv.getValue();
+            return UA_STATUSCODE_GOOD;
+        };
+        auto compressed = compressDataSource(source, rle);
+        DataValue dv;
+        CHECK(compressed.read(dv, {}, false) == UA_STATUSCODE_GOOD);
+        CHECK(isCompressedPayload(dv.getValue()));
+        CHECK(compressed.write(dv, {}) == UA_STATUSCODE_GOOD);
+        CHECK(written.getArrayCopy<float>() == waveform);
+    }
+}
+#endif
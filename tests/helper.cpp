@@ -1,10 +1,19 @@
+#include <chrono>
 #include <cstring>
+#include <set>
+#include <string>
+#include <utility>  // pair
+#include <vector>
 
 #include <doctest/doctest.h>
 
 #include "open62541_impl.h"  // UA_String_clear
 #include "open62541pp/detail/helper.h"
 
+#include "detail/AdaptiveRequestSize.h"
+#include "detail/AggregateCalculator.h"
+#include "detail/ObjectPool.h"
+
 using namespace opcua;
 
 TEST_CASE("getDataType") {
@@ -72,3 +81,123 @@ TEST_CASE("String conversion UA_String -> string") {
         UA_String_clear(&str);
     }
 }
+
+TEST_CASE("ObjectPool") {
+    detail::ObjectPool<std::string, 4> pool;
+    CHECK(pool.capacity() == 0);
+
+    std::set<std::string*> objects;
+    for (int i = 0; i < 5; ++i) {
+        auto* object = pool.acquire();
+        CHECK(object->empty());
+        *object = "test";
+        objects.insert(object);
+    }
+    CHECK(objects.size() == 5);
+    CHECK(pool.capacity() == 8);
+
+    auto* released = *objects.begin();
+    pool.release(released);
+    CHECK(released->empty());  // reset on release
+    CHECK(pool.acquire() == released);  // recycled
+    CHECK(pool.capacity() == 8);
+
+    pool.release(nullptr);
+}
+
+TEST_CASE("AdaptiveRequestSize") {
+    detail::AdaptiveRequestSize requestSize;
+    AdaptiveRequestSizing options;
+    options.initialSize = 100;
+    const auto fast = std::chrono::milliseconds(1);
+    const auto request = [&](size_t limit) {
+        const size_t size = requestSize.get(0, options);
+        const auto status = size > limit ? UA_STATUSCODE_BADTOOMANYOPERATIONS : UA_STATUSCODE_GOOD;
+        requestSize.update(size, status, fast, 0, options);
+        return size;
+    };
+
+    SUBCASE("Settles below the limit") {
+        size_t rejected = 0;
+        for (size_t i = 0; i < 100; ++i) {
+            if (request(150) > 150) {
+                ++rejected;
+            }
+        }
+        CHECK(rejected <= 4);  // no oscillation between rejected and halved sizes
+        CHECK(requestSize.get(0, options) == 150);
+    }
+
+    SUBCASE("Ceiling is lifted after a streak of successful requests") {
+        request(0);  // rejected
+        CHECK(requestSize.get(0, options) == 50);
+        for (size_t i = 0; i < detail::AdaptiveRequestSize::ceilingDecayStreak; ++i) {
+            CHECK(request(1000) < 100);
+        }
+        for (size_t i = 0; i < 10; ++i) {
+            request(1000);
+        }
+        CHECK(requestSize.get(0, options) > 100);
+    }
+
+    SUBCASE("Reset") {
+        request(0);
+        requestSize.reset();
+        CHECK(requestSize.get(0, options) == 100);
+    }
+}
+
+TEST_CASE("AggregateCalculator") {
+    const UA_DateTime start = 1000 * UA_DATETIME_MSEC;
+    const auto calculate = [&](ObjectId aggregateType) {
+        detail::AggregateCalculator calculator(aggregateType, 100.0, start);
+        std::vector<DataValue> results;
+        const auto emit = [&](DataValue&& result) { results.push_back(std::move(result)); };
+        // changing values within the first interval, one sample in the second interval
+        const std::vector<std::pair<int64_t, double>> samples{
+            {0, 1.0}, {25, 3.0}, {50, 5.0}, {75, 7.0}, {125, 2.0}
+        };
+        for (const auto& [offset, value] : samples) {
+            const UA_DateTime time = start + offset * UA_DATETIME_MSEC;
+            calculator.advance(time, emit);
+            calculator.add(time, *DataValue(Variant::fromScalar(value)).handle());
+        }
+        calculator.advance(start + 200 * UA_DATETIME_MSEC, emit);
+        REQUIRE(results.size() == 2);
+        CHECK(results[0].getSourceTimestamp().get() == start);
+        CHECK(results[1].getSourceTimestamp().get() == start + 100 * UA_DATETIME_MSEC);
+        return results;
+    };
+
+    SUBCASE("Average") {
+        const auto results = calculate(ObjectId::AggregateFunction_Average);
+        CHECK(results[0].getValue().getScalarCopy<double>() == 4.0);
+        CHECK(results[1].getValue().getScalarCopy<double>() == 2.0);
+    }
+
+    SUBCASE("Count") {
+        const auto results = calculate(ObjectId::AggregateFunction_Count);
+        CHECK(results[0].getValue().getScalarCopy<uint32_t>() == 4);
+        CHECK(results[1].getValue().getScalarCopy<uint32_t>() == 1);
+    }
+
+    SUBCASE("Minimum") {
+        const auto results = calculate(ObjectId::AggregateFunction_Minimum);
+        CHECK(results[0].getValue().getScalarCopy<double>() == 1.0);
+        CHECK(results[1].getValue().getScalarCopy<double>() == 2.0);
+    }
+
+    SUBCASE("Maximum") {
+        const auto results = calculate(ObjectId::AggregateFunction_Maximum);
+        CHECK(results[0].getValue().getScalarCopy<double>() == 7.0);
+        CHECK(results[1].getValue().getScalarCopy<double>() == 2.0);
+    }
+
+    SUBCASE("Interpolative") {
+        const auto results = calculate(ObjectId::AggregateFunction_Interpolative);
+        CHECK(results[0].getValue().getScalarCopy<double>() == 1.0);  // sample at interval start
+        // interpolated between the samples at 75 ms (7.0) and 125 ms (2.0)
+        CHECK(results[1].getValue().getScalarCopy<double>() == 4.5);
+        CHECK(results[1].getStatusCode().isGood());
+    }
+}
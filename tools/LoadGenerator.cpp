@@ -0,0 +1,361 @@
+#include "LoadGenerator.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>  // strtod
+#include <exception>
+#include <memory>
+#include <ostream>
+#include <random>
+#include <stdexcept>  // invalid_argument
+#include <thread>
+
+#include "open62541pp/open62541pp.h"
+
+using namespace opcua;
+using Clock = std::chrono::steady_clock;
+
+namespace loadgen {
+
+double Histogram::percentile(double p) const noexcept {
+    const auto rank = static_cast<uint64_t>(std::ceil(p * static_cast<double>(count_)));
+    uint64_t sum = 0;
+    for (size_t i = 0; i < bucketCount; ++i) {
+        sum += buckets_[i];
+        if (sum >= rank && sum > 0) {
+            return std::min(upperBound(i), max_);
+        }
+    }
+    return max_;
+}
+
+void Histogram::print(std::ostream& os) const {
+    uint64_t largest = 0;
+    std::array<uint64_t, bucketCount / subBuckets> octaves{};
+    for (size_t i = 0; i < bucketCount; ++i) {
+        octaves[i / subBuckets] += buckets_[i];
+        largest = std::max(largest, octaves[i / subBuckets]);
+    }
+    for (size_t i = 0; i < octaves.size(); ++i) {
+        if (octaves[i] == 0) {
+            continue;
+        }
+        const auto bar = static_cast<size_t>(40 * octaves[i] / largest);
+        std::array<char, 64> line{};
+        std::snprintf(
+            line.data(),
+            line.size(),
+            "    < %10.0f us %10llu ",
+            std::exp2(static_cast<double>(i + 1)),
+            static_cast<unsigned long long>(octaves[i])
+        );
+        os << line.data() << std::string(std::max<size_t>(bar, 1), '#') << "\n";
+    }
+}
+
+namespace {
+
+struct Session {
+    std::array<OperationStats, 4> stats;
+    std::atomic<uint64_t> operations{0};  // sampled by the progress output
+    std::atomic<uint64_t> errors{0};
+    std::atomic<uint64_t> notifications{0};
+    std::string failure;  // connect or setup error
+};
+
+NodeId parseNodeId(std::string_view str) {
+    NodeId id;
+    const auto status = UA_NodeId_parse(id.handle(), detail::toNativeString(str));
+    if (status != UA_STATUSCODE_GOOD) {
+        throw std::invalid_argument("Invalid node id: " + std::string(str));
+    }
+    return id;
+}
+
+double parseNumber(std::string_view str) {
+    const std::string s(str);
+    char* end = nullptr;
+    const double value = std::strtod(s.c_str(), &end);
+    if (end == s.c_str() || *end != '\0' || value < 0) {
+        throw std::invalid_argument("Invalid number: " + s);
+    }
+    return value;
+}
+
+std::vector<std::string_view> split(std::string_view str, char delimiter) {
+    std::vector<std::string_view> result;
+    while (true) {
+        const auto pos = str.find(delimiter);
+        result.push_back(str.substr(0, pos));
+        if (pos == std::string_view::npos) {
+            return result;
+        }
+        str.remove_prefix(pos + 1);
+    }
+}
+
+std::array<double, 4> parseMix(std::string_view str) {
+    std::array<double, 4> mix{};
+    for (const auto entry : split(str, ',')) {
+        const auto parts = split(entry, '=');
+        const auto it = std::find(operationNames.begin(), operationNames.end(), parts[0]);
+        if (parts.size() != 2 || it == operationNames.end()) {
+            throw std::invalid_argument("Invalid operation mix: " + std::string(entry));
+        }
+        mix[static_cast<size_t>(it - operationNames.begin())] = parseNumber(parts[1]);
+    }
+    return mix;
+}
+
+bool execute(Client& client, Operation operation, const Options& options, const Variant& value) {
+    switch (operation) {
+    case Operation::Read:
+        services::readValue(client, options.readNode);
+        return true;
+    case Operation::Write:
+        services::writeValue(client, *options.writeNode, value);
+        return true;
+    case Operation::Browse:
+        return services::browse(
+                   client, BrowseDescription(options.browseNode, BrowseDirection::Forward)
+        )
+            .getStatusCode()
+            .isGood();
+    case Operation::Call:
+        services::call(client, options.call->first, options.call->second, {});
+        return true;
+    }
+    return false;
+}
+
+void runSession(
+    Session& session,
+    const Options& options,
+    const std::atomic<bool>& recording,
+    const std::atomic<bool>& stopping,
+    size_t index
+) {
+    Client client;
+    client.setLogger({});  // keep the output clean, errors are counted
+    std::optional<Subscription<Client>> subscription;
+    Variant writeValue;
+    try {
+        if (options.login) {
+            client.connect(options.endpointUrl, *options.login);
+        } else {
+            client.connect(options.endpointUrl);
+        }
+        if (options.writeNode) {
+            writeValue = services::readValue(client, *options.writeNode);
+        }
+        if (options.subscribe > 0) {
+            SubscriptionParameters subscriptionParameters;
+            subscriptionParameters.publishingInterval = options.publishing;
+            subscription = client.createSubscription(subscriptionParameters);
+            MonitoringParameters parameters;
+            parameters.samplingInterval = options.sampling;
+            const std::vector<NodeId> ids(options.subscribe, options.monitorNode);
+            subscription->subscribeDataChange(
+                ids,
+                AttributeId::Value,
+                MonitoringMode::Reporting,
+                parameters,
+                [&](const auto&, const DataValue&) {
+                    if (recording.load(std::memory_order_relaxed)) {
+                        session.notifications.fetch_add(1, std::memory_order_relaxed);
+                    }
+                }
+            );
+        }
+    } catch (const std::exception& e) {
+        session.failure = e.what();
+        return;
+    }
+
+    std::mt19937 random(static_cast<std::mt19937::result_type>(index + 1));
+    std::discrete_distribution<size_t> mix(options.mix.begin(), options.mix.end());
+    const auto period = options.rate > 0
+                            ? std::chrono::duration_cast<Clock::duration>(
+                                  std::chrono::duration<double>(1.0 / options.rate)
+                              )
+                            : Clock::duration::zero();
+    // spread the first operation of the sessions over a period
+    auto scheduled = Clock::now() + period * index / options.sessions;
+
+    while (!stopping.load(std::memory_order_relaxed)) {
+        if (period > Clock::duration::zero()) {
+            // process subscriptions while waiting for the next scheduled operation
+            for (auto now = Clock::now(); now < scheduled; now = Clock::now()) {
+                const auto wait = std::chrono::ceil<std::chrono::milliseconds>(scheduled - now);
+                client.runIterate(static_cast<uint16_t>(std::min<int64_t>(wait.count(), 100)));
+            }
+        }
+        const auto operation = static_cast<Operation>(mix(random));
+        const auto start = period > Clock::duration::zero() ? scheduled : Clock::now();
+        bool good = false;
+        try {
+            good = execute(client, operation, options, writeValue);
+        } catch (const BadStatus&) {
+            good = false;
+        }
+        const auto stop = Clock::now();
+        scheduled += period;
+
+        if (!client.isConnected()) {
+            // the session is lost, reconnect with the next operation (counts as errors meanwhile)
+            try {
+                if (options.login) {
+                    client.connect(options.endpointUrl, *options.login);
+                } else {
+                    client.connect(options.endpointUrl);
+                }
+            } catch (const BadStatus&) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            }
+        }
+        if (!recording.load(std::memory_order_relaxed)) {
+            continue;
+        }
+        auto& stats = session.stats[static_cast<size_t>(operation)];
+        stats.latency.record(std::chrono::duration<double, std::micro>(stop - start).count());
+        session.operations.fetch_add(1, std::memory_order_relaxed);
+        if (!good) {
+            ++stats.errors;
+            session.errors.fetch_add(1, std::memory_order_relaxed);
+        }
+        if (period == Clock::duration::zero() && options.subscribe > 0) {
+            client.runIterate(0);  // process notifications between back-to-back operations
+        }
+    }
+}
+
+}  // namespace
+
+Options parseOptions(const std::vector<std::string_view>& args) {
+    if (args.empty()) {
+        throw std::invalid_argument("Missing endpoint url");
+    }
+    Options options;
+    options.endpointUrl = std::string(args[0]);
+    std::string username;
+    std::string password;
+    for (size_t i = 1; i < args.size(); ++i) {
+        const auto option = args[i];
+        if (i + 1 >= args.size()) {
+            throw std::invalid_argument("Missing value of option " + std::string(option));
+        }
+        const auto value = args[++i];
+        if (option == "--sessions") {
+            options.sessions = std::max<size_t>(static_cast<size_t>(parseNumber(value)), 1);
+        } else if (option == "--duration") {
+            options.duration = parseNumber(value);
+        } else if (option == "--warmup") {
+            options.warmup = parseNumber(value);
+        } else if (option == "--rate") {
+            options.rate = parseNumber(value);
+        } else if (option == "--mix") {
+            options.mix = parseMix(value);
+        } else if (option == "--read-node") {
+            options.readNode = parseNodeId(value);
+        } else if (option == "--write-node") {
+            options.writeNode = parseNodeId(value);
+        } else if (option == "--browse-node") {
+            options.browseNode = parseNodeId(value);
+        } else if (option == "--call") {
+            const auto ids = split(value, ',');
+            if (ids.size() != 2) {
+                throw std::invalid_argument("Invalid method: " + std::string(value));
+            }
+            options.call.emplace(parseNodeId(ids[0]), parseNodeId(ids[1]));
+        } else if (option == "--subscribe") {
+            options.subscribe = static_cast<size_t>(parseNumber(value));
+        } else if (option == "--monitor-node") {
+            options.monitorNode = parseNodeId(value);
+        } else if (option == "--sampling") {
+            options.sampling = parseNumber(value);
+        } else if (option == "--publishing") {
+            options.publishing = parseNumber(value);
+        } else if (option == "--username") {
+            username = value;
+        } else if (option == "--password") {
+            password = value;
+        } else {
+            throw std::invalid_argument("Unknown option " + std::string(option));
+        }
+    }
+    if (!username.empty()) {
+        options.login = Login{username, password};
+    }
+    if (options.mix[static_cast<size_t>(Operation::Write)] > 0 && !options.writeNode) {
+        throw std::invalid_argument("Operation write requires --write-node");
+    }
+    if (options.mix[static_cast<size_t>(Operation::Call)] > 0 && !options.call) {
+        throw std::invalid_argument("Operation call requires --call");
+    }
+    if (options.mix[0] + options.mix[1] + options.mix[2] + options.mix[3] <= 0) {
+        throw std::invalid_argument("Operation mix without operations");
+    }
+    return options;
+}
+
+Report run(const Options& options, const ProgressCallback& progress) {
+    std::atomic<bool> recording{false};
+    std::atomic<bool> stopping{false};
+    std::vector<std::unique_ptr<Session>> sessions;
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < options.sessions; ++i) {
+        sessions.push_back(std::make_unique<Session>());
+        threads.emplace_back([&, &session = *sessions.back(), i] {
+            runSession(session, options, recording, stopping, i);
+        });
+    }
+
+    std::this_thread::sleep_for(std::chrono::duration<double>(options.warmup));
+    recording = true;
+    const auto start = Clock::now();
+    const auto end = start + std::chrono::duration_cast<Clock::duration>(
+                                 std::chrono::duration<double>(options.duration)
+                             );
+    constexpr std::chrono::seconds progressInterval{1};
+    for (auto next = start + progressInterval; next <= end; next += progressInterval) {
+        std::this_thread::sleep_until(next);
+        uint64_t operations = 0;
+        uint64_t errors = 0;
+        uint64_t notifications = 0;
+        for (const auto& session : sessions) {
+            operations += session->operations;
+            errors += session->errors;
+            notifications += session->notifications;
+        }
+        if (progress) {
+            progress(
+                std::chrono::duration<double>(next - start).count(),
+                operations,
+                errors,
+                notifications
+            );
+        }
+    }
+    std::this_thread::sleep_until(end);
+    recording = false;
+    const auto elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+    stopping = true;
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Report report;
+    report.elapsed = elapsed;
+    for (const auto& session : sessions) {
+        for (size_t i = 0; i < report.operations.size(); ++i) {
+            report.operations[i].latency.merge(session->stats[i].latency);
+            report.operations[i].errors += session->stats[i].errors;
+        }
+        report.notifications += session->notifications;
+        report.failures.push_back(session->failure);
+    }
+    return report;
+}
+
+}  // namespace loadgen
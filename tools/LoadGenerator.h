@@ -0,0 +1,119 @@
+#pragma once
+
+#include <algorithm>  // max, min
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iosfwd>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>  // pair
+#include <vector>
+
+#include "open62541pp/AccessControl.h"  // Login
+#include "open62541pp/NodeIds.h"
+#include "open62541pp/types/NodeId.h"
+
+/**
+ * Core of the load generator opcua-loadgen, separated from the command line tool for tests.
+ */
+namespace loadgen {
+
+enum class Operation : size_t { Read, Write, Browse, Call };
+
+constexpr std::array<std::string_view, 4> operationNames{"read", "write", "browse", "call"};
+
+struct Options {
+    std::string endpointUrl;
+    size_t sessions{1};
+    double duration{10.0};
+    double warmup{1.0};
+    double rate{0.0};
+    std::array<double, 4> mix{1.0, 0.0, 0.0, 0.0};
+    opcua::NodeId readNode{opcua::VariableId::Server_ServerStatus_CurrentTime};
+    std::optional<opcua::NodeId> writeNode;
+    opcua::NodeId browseNode{opcua::ObjectId::ObjectsFolder};
+    std::optional<std::pair<opcua::NodeId, opcua::NodeId>> call;
+    size_t subscribe{0};
+    opcua::NodeId monitorNode{opcua::VariableId::Server_ServerStatus_CurrentTime};
+    double sampling{100.0};
+    double publishing{100.0};
+    std::optional<opcua::Login> login;
+};
+
+/**
+ * Latency histogram with logarithmic buckets (4 buckets per power of 2) from 1 us to ~2^32 us.
+ */
+class Histogram {
+public:
+    static constexpr size_t subBuckets = 4;
+    static constexpr size_t bucketCount = 32 * subBuckets;
+
+    void record(double microseconds) noexcept {
+        const double value = std::max(microseconds, 1.0);
+        const auto index = static_cast<size_t>(std::log2(value) * subBuckets);
+        ++buckets_[std::min(index, bucketCount - 1)];
+        ++count_;
+        max_ = std::max(max_, microseconds);
+    }
+
+    void merge(const Histogram& other) noexcept {
+        for (size_t i = 0; i < bucketCount; ++i) {
+            buckets_[i] += other.buckets_[i];
+        }
+        count_ += other.count_;
+        max_ = std::max(max_, other.max_);
+    }
+
+    uint64_t count() const noexcept {
+        return count_;
+    }
+
+    double max() const noexcept {
+        return max_;
+    }
+
+    /// Upper bound of the bucket of the `p`-th percentile (0...1).
+    double percentile(double p) const noexcept;
+
+    /// Print counts per power of 2.
+    void print(std::ostream& os) const;
+
+private:
+    static double upperBound(size_t index) noexcept {
+        return std::exp2(static_cast<double>(index + 1) / subBuckets);
+    }
+
+    std::array<uint64_t, bucketCount> buckets_{};
+    uint64_t count_{0};
+    double max_{0.0};
+};
+
+struct OperationStats {
+    Histogram latency;  // one entry per recorded operation
+    uint64_t errors{0};
+};
+
+/// Results of a run, merged over all sessions.
+struct Report {
+    std::array<OperationStats, 4> operations;
+    uint64_t notifications{0};
+    double elapsed{0.0};  // duration of the measurement in seconds
+    std::vector<std::string> failures;  // connect or setup error per session, empty if none
+};
+
+/// Cumulative counts of the running measurement, called once per second.
+using ProgressCallback = std::function<void(
+    double seconds, uint64_t operations, uint64_t errors, uint64_t notifications
+)>;
+
+/// Parse the command line arguments (without program name).
+/// @exception std::invalid_argument If an argument is invalid
+Options parseOptions(const std::vector<std::string_view>& args);
+
+/// Run the sessions for the warmup and measurement duration and collect the results.
+Report run(const Options& options, const ProgressCallback& progress = {});
+
+}  // namespace loadgen
@@ -0,0 +1,140 @@
+"""Render a binary log written by opcua::BinaryLogSink as text.
+
+Usage: python decode_binary_log.py <logfile> [--byteorder little|big]
+"""
+
+import argparse
+import re
+import struct
+import sys
+from datetime import datetime, timezone
+from pathlib import Path
+
+MAGIC = b"UAPPBLOG"
+VERSION = 1
+
+LOG_LEVELS = ("trace", "debug", "info", "warning", "error", "fatal")
+LOG_CATEGORIES = (
+    "network",
+    "channel",
+    "session",
+    "server",
+    "client",
+    "userland",
+    "securitypolicy",
+)
+
+# %[flags][width][.precision][length]conversion
+SPECIFIER = re.compile(
+    r"%([-+ #0]*)(\*|\d+)?(?:\.(\*|\d+))?(hh|h|ll|l|q|j|z|t|L)?([diouxXeEfFgGaAcspn%])"
+)
+
+
+class Reader:
+    def __init__(self, data: bytes, byteorder: str):
+        self.data = data
+        self.pos = 0
+        self.prefix = "<" if byteorder == "little" else ">"
+
+    def eof(self) -> bool:
+        return self.pos >= len(self.data)
+
+    def read(self, fmt: str):
+        size = struct.calcsize(self.prefix + fmt)
+        values = struct.unpack_from(self.prefix + fmt, self.data, self.pos)
+        self.pos += size
+        return values[0] if len(values) == 1 else values
+
+    def read_bytes(self, length: int) -> bytes:
+        value = self.data[self.pos : self.pos + length]
+        self.pos += length
+        return value
+
+
+def decode_arguments(reader: Reader):
+    args = []
+    while not reader.eof():
+        tag = reader.read("c")
+        if tag == b"i":
+            args.append(reader.read("q"))
+        elif tag in (b"u", b"p"):
+            args.append(reader.read("Q"))
+        elif tag == b"d":
+            args.append(reader.read("d"))
+        elif tag == b"s":
+            length = reader.read("I")
+            args.append(reader.read_bytes(length).decode("utf-8", errors="replace"))
+        else:
+            raise ValueError(f"Invalid argument tag: {tag!r}")
+    return args
+
+
+def render(fmt: str, args: list) -> str:
+    it = iter(args)
+
+    def replace(match: re.Match) -> str:
+        flags, width, precision, _, conversion = match.groups()
+        if conversion == "%":
+            return "%"
+        if conversion == "n":
+            return ""
+        if width == "*":
+            width = str(next(it))
+        if precision == "*":
+            precision = str(next(it))
+        spec = "%" + flags + (width or "") + (f".{precision}" if precision is not None else "")
+        value = next(it)
+        if conversion == "c":
+            return (spec + "c") % chr(value)
+        if conversion == "p":
+            return (spec + "s") % hex(value)
+        if conversion == "u":
+            conversion = "d"
+        return (spec + conversion) % value
+
+    try:
+        return SPECIFIER.sub(replace, fmt)
+    except (StopIteration, TypeError, ValueError):
+        return fmt + " <invalid arguments>"
+
+
+def decode(data: bytes, byteorder: str):
+    reader = Reader(data, byteorder)
+    if reader.read_bytes(len(MAGIC)) != MAGIC:
+        raise ValueError("Not a binary log file")
+    version = reader.read("I")
+    if version != VERSION:
+        raise ValueError(f"Unsupported version: {version}")
+
+    formats = {}
+    while not reader.eof():
+        record_type = reader.read("c")
+        if record_type == b"F":
+            format_id, length = reader.read("II")
+            formats[format_id] = reader.read_bytes(length).decode("utf-8", errors="replace")
+        elif record_type == b"M":
+            format_id, level, category, timestamp, args_size = reader.read("IBBqI")
+            args = decode_arguments(Reader(reader.read_bytes(args_size), byteorder))
+            time = datetime.fromtimestamp(timestamp / 1e9, tz=timezone.utc)
+            yield "[{}] {}/{}\t{}".format(
+                time.isoformat(timespec="microseconds"),
+                LOG_LEVELS[level] if level < len(LOG_LEVELS) else "unknown",
+                LOG_CATEGORIES[category] if category < len(LOG_CATEGORIES) else "unknown",
+                render(formats.get(format_id, "<unknown format>"), args),
+            )
+        else:
+            raise ValueError(f"Invalid record type: {record_type!r}")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("logfile", type=Path)
+    parser.add_argument("--byteorder", choices=("little", "big"), default=sys.byteorder)
+    args = parser.parse_args()
+
+    for line in decode(args.logfile.read_bytes(), args.byteorder):
+        print(line)
+
+
+if __name__ == "__main__":
+    main()
@@ -5,6 +5,17 @@ from pathlib import Path
 URL = "http://www.opcfoundation.org/UA/schemas/1.04/NodeIds.csv"
 HERE = Path(__file__).parent
 HEADER_FILE = HERE.parent / "include" / "open62541pp" / "NodeIds.h"
+NAMES_FILE = HERE.parent / "src" / "NodeIdNamesTable.h"
+
+NODECLASSES = (
+    "DataType",
+    "ReferenceType",
+    "ObjectType",
+    "VariableType",
+    "Object",
+    "Variable",
+    "Method",
+)
 
 TEMPLATE_HEADER = """
 /* ---------------------------------------------------------------------------------------------- */
@@ -53,6 +64,143 @@ enum class {enum_name} : uint32_t {{
 """.strip()
 
 
+TEMPLATE_NAMES = """
+/* ---------------------------------------------------------------------------------------------- */
+/*                                   Generated - do not modify!                                   */
+/* ---------------------------------------------------------------------------------------------- */
+
+#pragma once
+
+#include <cstdint>
+#include <string_view>
+
+namespace opcua::detail {{
+
+/// Symbolic name of a node id defined by the OPC UA specification (namespace 0).
+struct NodeIdName {{
+    std::string_view name;
+    uint32_t id;
+}};
+
+/// FNV-1a hash of a symbolic name.
+constexpr uint32_t hashNodeIdName(std::string_view name) noexcept {{
+    uint32_t hash = 2166136261U;
+    for (const char c : name) {{
+        hash ^= static_cast<uint8_t>(c);
+        hash *= 16777619U;
+    }}
+    return hash;
+}}
+
+/// Hash of a symbolic name with a seed (MurmurHash3 finalizer).
+constexpr uint32_t hashNodeIdName(uint32_t hash, uint32_t seed) noexcept {{
+    hash ^= seed * 0x9e3779b9U;
+    hash ^= hash >> 16U;
+    hash *= 0x85ebca6bU;
+    hash ^= hash >> 13U;
+    hash *= 0xc2b2ae35U;
+    hash ^= hash >> 16U;
+    return hash;
+}}
+
+// clang-format off
+
+/// Node ids with their symbolic names, sorted by id.
+inline constexpr NodeIdName nodeIdNames[] = {{
+{names}
+}};
+
+/// Perfect hash of the symbolic names (hash and displace):
+/// `seed = nodeIdNameSeeds[hashNodeIdName(hash, 0) % {bucket_count}]`,
+/// `index = nodeIdNameSlots[hashNodeIdName(hash, seed) % {slot_count}]`.
+inline constexpr uint32_t nodeIdNameSeeds[{bucket_count}] = {{
+{seeds}
+}};
+
+/// Indices of nodeIdNames, {empty} for empty slots.
+inline constexpr uint16_t nodeIdNameSlots[{slot_count}] = {{
+{slots}
+}};
+
+// clang-format on
+
+}}  // namespace opcua::detail
+""".lstrip()
+
+
+def fnv1a(name: str) -> int:
+    hash = 2166136261
+    for c in name.encode():
+        hash ^= c
+        hash = (hash * 16777619) & 0xFFFFFFFF
+    return hash
+
+
+def mix(hash: int, seed: int) -> int:
+    hash ^= (seed * 0x9E3779B9) & 0xFFFFFFFF
+    hash ^= hash >> 16
+    hash = (hash * 0x85EBCA6B) & 0xFFFFFFFF
+    hash ^= hash >> 13
+    hash = (hash * 0xC2B2AE35) & 0xFFFFFFFF
+    hash ^= hash >> 16
+    return hash
+
+
+def next_power_of_two(value: int) -> int:
+    result = 1
+    while result < value:
+        result <<= 1
+    return result
+
+
+def gen_perfect_hash(names: list[str]) -> tuple[list[int], list[int]]:
+    """Hash and displace: find a seed per bucket that maps all names of the bucket to free slots."""
+    empty = 0xFFFF
+    assert len(names) < empty
+    hashes = [fnv1a(name) for name in names]
+    assert len(set(hashes)) == len(hashes), "hash collision of symbolic names"
+    bucket_count = next_power_of_two(len(names) // 4 + 1)
+    slot_count = next_power_of_two(len(names))
+    buckets = defaultdict(list)
+    for index, hash in enumerate(hashes):
+        buckets[mix(hash, 0) % bucket_count].append(index)
+    seeds = [0] * bucket_count
+    slots = [empty] * slot_count
+    for bucket, indices in sorted(buckets.items(), key=lambda item: -len(item[1])):
+        seed = 1
+        while True:
+            targets = [mix(hashes[i], seed) % slot_count for i in indices]
+            if len(set(targets)) == len(targets) and all(slots[t] == empty for t in targets):
+                break
+            seed += 1
+        seeds[bucket] = seed
+        for index, target in zip(indices, targets):
+            slots[target] = index
+    return seeds, slots
+
+
+def gen_lookup_table(nodeids: dict[str, list[tuple[str, int]]]) -> str:
+    entries = sorted(
+        (id, name) for nodeclass in NODECLASSES for name, id in nodeids[nodeclass]
+    )
+    seeds, slots = gen_perfect_hash([name for _, name in entries])
+
+    def gen_rows(values: list[int], per_row: int) -> str:
+        return "\n".join(
+            "    " + " ".join(f"{v}," for v in values[i : i + per_row])
+            for i in range(0, len(values), per_row)
+        )
+
+    return TEMPLATE_NAMES.format(
+        names="\n".join(f'    {{"{name}", {id}}},' for id, name in entries),
+        bucket_count=len(seeds),
+        slot_count=len(slots),
+        empty=0xFFFF,
+        seeds=gen_rows(seeds, 16),
+        slots=gen_rows(slots, 16),
+    )
+
+
 def main():
     opener = urllib.request.build_opener()
     opener.addheaders = [("User-agent", "Mozilla/5.0")]
@@ -74,20 +222,10 @@ def main():
             body=body,
         )
 
-    enums = [
-        gen_enum_definition(f"{nodeclass}Id", nodeclass)
-        for nodeclass in (
-            "DataType",
-            "ReferenceType",
-            "ObjectType",
-            "VariableType",
-            "Object",
-            "Variable",
-            "Method",
-        )
-    ]
+    enums = [gen_enum_definition(f"{nodeclass}Id", nodeclass) for nodeclass in NODECLASSES]
     header = TEMPLATE_HEADER.format(body="\n\n".join(enums))
     HEADER_FILE.write_text(header)
+    NAMES_FILE.write_text(gen_lookup_table(nodeids))
 
 
 if __name__ == "__main__":
@@ -0,0 +1,143 @@
+/**
+ * opcua-loadgen: Load generator to stress-test OPC UA servers.
+ *
+ * Opens K sessions (one client and thread per session) and issues a weighted mix of reads, writes,
+ * browses and method calls against the target endpoint, either at a fixed rate or as fast as
+ * possible. Optionally, each session creates a subscription with monitored items.
+ *
+ * Reports throughput, error rates and latency histograms per operation. With a fixed rate, the
+ * latency is measured from the scheduled start time of the operation (open-loop), so stalls of the
+ * server are not hidden by delayed requests (coordinated omission).
+ *
+ * Run `opcua-loadgen --help` for the options.
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>  // EXIT_FAILURE, EXIT_SUCCESS
+#include <exception>
+#include <iostream>
+#include <string_view>
+#include <vector>
+
+#include "LoadGenerator.h"
+
+using namespace loadgen;
+
+namespace {
+
+constexpr std::string_view usage = R"(Usage: opcua-loadgen <endpoint url> [options]
+
+Options:
+  --sessions <k>            Number of sessions/clients, one thread each (default: 1)
+  --duration <s>            Duration of the measurement in seconds (default: 10)
+  --warmup <s>              Duration before the measurement in seconds (default: 1)
+  --rate <n>                Operations per second per session, 0 = as fast as possible (default: 0)
+  --mix <op=weight,...>     Weights of the operations read, write, browse, call
+                            (default: read=1)
+  --read-node <id>          Node to read (default: i=2258, Server_ServerStatus_CurrentTime)
+  --write-node <id>         Node to write, the value read at start is written back
+  --browse-node <id>        Node to browse (default: i=85, ObjectsFolder)
+  --call <object>,<method>  Method to call without input arguments
+  --subscribe <n>           Monitored items per session, 0 = no subscription (default: 0)
+  --monitor-node <id>       Monitored node (default: i=2258)
+  --sampling <ms>           Sampling interval of the monitored items (default: 100)
+  --publishing <ms>         Publishing interval of the subscriptions (default: 100)
+  --username <name>         Login with username and password
+  --password <password>
+
+Node ids are given in the string format of the standard, e.g. ns=1;s=Temperature.
+)";
+
+void printReport(const Report& report) {
+    const auto& total = report.operations;
+    std::printf(
+        "\n%-8s %12s %12s %8s %10s %10s %10s %10s %10s\n",
+        "op",
+        "count",
+        "ops/s",
+        "errors",
+        "p50 us",
+        "p90 us",
+        "p99 us",
+        "p99.9 us",
+        "max us"
+    );
+    for (size_t i = 0; i < total.size(); ++i) {
+        const auto& stats = total[i];
+        const auto count = stats.latency.count();
+        if (count == 0) {
+            continue;
+        }
+        std::printf(
+            "%-8s %12llu %12.1f %7.2f%% %10.0f %10.0f %10.0f %10.0f %10.0f\n",
+            operationNames[i].data(),
+            static_cast<unsigned long long>(count),
+            static_cast<double>(count) / report.elapsed,
+            100.0 * static_cast<double>(stats.errors) / static_cast<double>(count),
+            stats.latency.percentile(0.50),
+            stats.latency.percentile(0.90),
+            stats.latency.percentile(0.99),
+            stats.latency.percentile(0.999),
+            stats.latency.max()
+        );
+    }
+    if (report.notifications > 0) {
+        std::printf(
+            "notifications: %llu (%.1f/s)\n",
+            static_cast<unsigned long long>(report.notifications),
+            static_cast<double>(report.notifications) / report.elapsed
+        );
+    }
+    for (size_t i = 0; i < total.size(); ++i) {
+        if (total[i].latency.count() == 0) {
+            continue;
+        }
+        std::cout << "\nLatency histogram " << operationNames[i] << ":\n";
+        total[i].latency.print(std::cout);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+    const std::vector<std::string_view> args(argv + 1, argv + argc);  // NOLINT
+    if (args.empty() || args[0] == "--help" || args[0] == "-h") {
+        std::cout << usage;
+        return args.empty() ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+    Options options;
+    try {
+        options = parseOptions(args);
+    } catch (const std::exception& e) {
+        std::cerr << e.what() << "\n\n" << usage;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t lastOperations = 0;
+    uint64_t lastErrors = 0;
+    const auto report = run(
+        options,
+        [&](double seconds, uint64_t operations, uint64_t errors, uint64_t notifications) {
+            std::printf(
+                "t=%4.0fs  ops/s %10llu  errors/s %6llu  notifications %10llu\n",
+                seconds,
+                static_cast<unsigned long long>(operations - lastOperations),
+                static_cast<unsigned long long>(errors - lastErrors),
+                static_cast<unsigned long long>(notifications)
+            );
+            lastOperations = operations;
+            lastErrors = errors;
+        }
+    );
+
+    size_t failed = 0;
+    for (size_t i = 0; i < report.failures.size(); ++i) {
+        if (!report.failures[i].empty()) {
+            ++failed;
+            std::cerr << "Session " << i << " failed: " << report.failures[i] << "\n";
+        }
+    }
+    printReport(report);
+    return failed == report.failures.size() ? EXIT_FAILURE : EXIT_SUCCESS;
+}